@@ -0,0 +1,31 @@
+#ifndef __BEAM_H
+#define __BEAM_H
+#include "lcd.h"
+
+#ifdef __cplusplus
+ extern "C" {
+#endif /* __cplusplus */
+
+// Racing the beam: one framebuffer, it is shown and drawn at the same time.
+// The screen is cut to horizontal bands, a band is drawn just after the LTDC has
+// read it out and must be ready before the LTDC comes back to it in the next frame.
+// The LTDC line event marks the end of every band.
+#define BEAM_BANDS              8
+#define BEAM_BAND_H             (DisplayHEIGHT / BEAM_BANDS)    // 60 lines
+
+extern volatile uint32_t BeamBands;     // bands read out by the LTDC since Beam_Start()
+extern uint32_t BeamMissed;             // bands not ready in time, they could tear
+
+void    Beam_Start(void);
+void    Beam_Stop(void);
+uint8_t Beam_Active(void);
+// draws every band of Frame: Background is copied to the band, then Draw() is
+// called with the clip set to the band. Returns 0 if a band missed its time
+uint8_t Beam_Render(uint32_t Background, uint32_t Frame, void (*Draw)(void));
+void    Beam_LineEvent(void);   // from HAL_LTDC_LineEvenCallback() only
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __BEAM_H */
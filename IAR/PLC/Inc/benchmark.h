@@ -0,0 +1,70 @@
+#ifndef __BENCHMARK_H
+#define __BENCHMARK_H
+#include "stm32f7xx_hal.h"
+
+#ifdef __cplusplus
+ extern "C" {
+#endif /* __cplusplus */
+
+// Drawing benchmarks, they run once after LCD_Init() and draw over the screen.
+// Read the results in the debugger, all values are CPU cycles (216 = 1 us)
+//#define BENCHMARK_GRAPHICS
+
+#define BENCH_POLY_POINTS       800     // one point per x of the screen
+
+typedef struct{
+ uint32_t Thin;         // LCD_DrawLine() chain, the old trend
+ uint32_t Width[4];     // 1, 2, 4, 8 pixels, miter joins, butt caps
+ uint32_t Bevel3;       // 3 pixels, bevel joins
+ uint32_t Round3;       // 3 pixels, round caps
+}BenchPolyline;
+
+#define BENCH_FILL_SIZES        11      // 1, 2, 4 ... 512, 800 pixels in one line
+
+typedef struct{
+ uint16_t Size[BENCH_FILL_SIZES];
+ uint32_t Cpu[BENCH_FILL_SIZES];    // word stores
+ uint32_t Hal[BENCH_FILL_SIZES];    // HAL_DMA2D_Init + Start + PollForTransfer
+ uint32_t Reg[BENCH_FILL_SIZES];    // the job ring on dma2d_reg.c, submit + wait
+ uint16_t BreakEven;                // the first size where Reg beats Cpu, 0 - never
+}BenchFillResult;
+
+typedef struct{
+ uint32_t Naive[2];     // the whole screen, ROT_90 and ROT_270, one pixel at a time
+ uint32_t Blocked[2];   // the same by ROT_BLOCK blocks in DTCM
+ uint32_t NaiveDirty;   // a 64 x 64 changed part, ROT_90
+ uint32_t BlockedDirty;
+}BenchRotateResult;
+
+typedef struct{
+ uint32_t BitLoop;      // characters per second, RIAD_80pt digits, no cache: DrawChar or the run coded spans
+ uint32_t CacheCold;    // the A8 cache, every sign expanded first
+ uint32_t CacheWarm;    // the A8 cache, the signs are there
+ uint32_t A4;           // RIAD_80pt_AA digits, 4bpp anti-aliased, DMA2D A4 straight from the font
+}BenchTextResult;
+
+typedef struct{
+ uint32_t Soft;         // a uGUI window redrawn by UG_Update(), pixel by pixel
+ uint32_t Dma2d;        // the same with the drivers of ugui_dma2d.c, with the wait for the jobs
+ uint32_t Button;       // UG_Update() after a new color of one button, only its damage is drawn
+ uint32_t Textbox;      // UG_Update() after a new text of one text box
+}BenchUGuiResult;
+
+extern BenchPolyline BenchPoly;
+extern BenchFillResult BenchFill;
+extern BenchRotateResult BenchRotate;
+extern BenchTextResult BenchText;
+extern BenchUGuiResult BenchUGui;
+
+void Benchmark_Run(void);
+void Benchmark_Polyline(void);
+void Benchmark_Fill(void);
+void Benchmark_Rotate(void);
+void Benchmark_Text(void);
+void Benchmark_UGui(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __BENCHMARK_H */
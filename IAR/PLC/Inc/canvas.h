@@ -0,0 +1,58 @@
+#ifndef __CANVAS_H
+#define __CANVAS_H
+#include "lcd.h"
+
+#ifdef __cplusplus
+ extern "C" {
+#endif /* __cplusplus */
+
+// Virtual canvas: an ARGB8888 picture bigger than its window, shown by the second
+// LTDC layer. The pitch of the layer is the width of the canvas, scrolling is a new
+// start address (CFBAR) loaded in the vertical blanking, nothing is redrawn.
+// A ring canvas scrolls without end: it holds the window twice (+1 hidden line),
+// a new strip is drawn to both copies, so any position gives a whole window.
+#define CANVAS_PLAIN            0
+#define CANVAS_RING_X           1       // new columns at the right, trends
+#define CANVAS_RING_Y           2       // new lines at the bottom, logs and lists
+#define CANVAS_LAYER            1       // LTDC layer over the GUI
+
+typedef struct{
+ uint32_t Address;      // pixel 0, 0 of the canvas
+ uint16_t Width;        // pixels, the LTDC pitch
+ uint16_t Height;
+ uint16_t Period;       // ring canvas: the second copy is Period pixels further
+ uint8_t  Ring;         // CANVAS_PLAIN ...
+ int16_t  WinX;         // the window on the screen
+ int16_t  WinY;
+ uint16_t WinW;
+ uint16_t WinH;
+ int16_t  ScrollX;      // canvas pixel in the left top corner of the window
+ int16_t  ScrollY;
+}Canvas;
+
+typedef struct{
+ Canvas   View;         // CANVAS_RING_X
+ uint16_t Next;         // column of the next sample
+ int16_t  Last;         // the last value, pixels from the bottom
+ uint32_t Color;
+ uint32_t Back;
+}Trend;
+
+// Width, Height: the whole canvas for CANVAS_PLAIN, ignored for a ring
+void Canvas_Init(Canvas * c, uint32_t Address, uint8_t Ring, uint16_t Width, uint16_t Height,
+                 int16_t WinX, int16_t WinY, uint16_t WinW, uint16_t WinH);
+uint32_t Canvas_Size(const Canvas * c);         // bytes
+void Canvas_Show(Canvas * c);
+void Canvas_Hide(void);
+void Canvas_ScrollTo(Canvas * c, int16_t x, int16_t y);
+// Draw() with the canvas coordinates and the clip x, y, w, h, twice for a ring
+void Canvas_Draw(Canvas * c, int16_t x, int16_t y, uint16_t w, uint16_t h, void (*Draw)(void));
+
+void Trend_Init(Trend * t, uint32_t Address, int16_t WinX, int16_t WinY, uint16_t WinW, uint16_t WinH, uint32_t Color, uint32_t Back);
+void Trend_Add(Trend * t, int16_t Value);      // one column, the trend moves left by one pixel
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __CANVAS_H */
@@ -0,0 +1,35 @@
+#ifndef __DMA2D_JOBS_H
+#define __DMA2D_JOBS_H
+#include "dma2d_reg.h"
+
+#ifdef __cplusplus
+ extern "C" {
+#endif /* __cplusplus */
+
+// DMA2D command ring: the jobs are started one by one from the transfer complete
+// interrupt, the CPU goes on drawing and waits only for the fence it needs.
+// A fence is the number of the job, it is done when all the jobs up to it are done.
+#define JOBS_RING_SIZE          32      // power of two
+
+extern volatile uint32_t JobsErrors;   // transfer or configuration errors, the job is counted as done
+
+void     Jobs_Init(void);
+uint32_t Jobs_Submit(const DMA2D_Job * Job);
+uint32_t Jobs_Fill(uint32_t Dst, uint32_t xSize, uint32_t ySize, uint32_t DstOffLine, uint32_t Color);
+uint32_t Jobs_Copy(uint32_t Src, uint32_t Dst, uint32_t xSize, uint32_t ySize, uint32_t SrcOffLine, uint32_t DstOffLine);
+uint32_t Jobs_CopyPFC(uint32_t Src, uint32_t Dst, uint32_t xSize, uint32_t ySize, uint32_t SrcOffLine, uint32_t DstOffLine, uint32_t SrcColorMode);
+// CM_L8, CM_L4 source expanded by the foreground CLUT, Colors entries of ARGB8888 at Clut
+uint32_t Jobs_CopyCLUT(uint32_t Src, uint32_t Dst, uint32_t xSize, uint32_t ySize, uint32_t SrcOffLine, uint32_t DstOffLine, uint32_t SrcColorMode, uint32_t Clut, uint16_t Colors);
+uint32_t Jobs_BlendCLUT(uint32_t Fore, uint32_t Back, uint32_t Dst, uint32_t xSize, uint32_t ySize, uint32_t ForeOffLine, uint32_t BackOffLine, uint32_t DstOffLine, uint32_t ForeColorMode, uint32_t Clut, uint16_t Colors);
+uint32_t Jobs_Blend(uint32_t Fore, uint32_t Back, uint32_t Dst, uint32_t xSize, uint32_t ySize, uint32_t ForeOffLine, uint32_t BackOffLine, uint32_t DstOffLine, uint32_t ForeColorMode, uint32_t ForeAlpha);
+uint8_t  Jobs_Done(uint32_t Fence);
+void     Jobs_Wait(uint32_t Fence);
+void     Jobs_WaitIdle(void);
+uint8_t  Jobs_Idle(void);
+void     Jobs_Next(void);       // from the DMA2D callbacks only
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __DMA2D_JOBS_H */
@@ -0,0 +1,46 @@
+#ifndef __DMA2D_REG_H
+#define __DMA2D_REG_H
+#include "stm32f7xx_hal.h"
+
+#ifdef __cplusplus
+ extern "C" {
+#endif /* __cplusplus */
+
+// Register level DMA2D start: the last written configuration is kept and only the
+// registers which change are written, HAL_DMA2D_Init/ConfigLayer are not used.
+// HAL_DMA2D_IRQHandler() still serves the interrupt and calls the hdma2d callbacks.
+// Call D2D_Invalidate() after any HAL_DMA2D_* call which writes the registers.
+// A CLUT is loaded only when the palette address or size changes: call D2D_Invalidate()
+// (DMA2D idle) when the colors at the same address are changed.
+
+#define DMA2D_FILL_BREAK_EVEN   128     // pixels, a smaller fill is faster by CPU, see BenchFill
+
+typedef struct{
+ uint32_t Mode;         // DMA2D_R2M, DMA2D_M2M, DMA2D_M2M_PFC, DMA2D_M2M_BLEND
+ uint32_t Src;          // color for DMA2D_R2M, else the foreground address
+ uint32_t Back;         // background address, DMA2D_M2M_BLEND only
+ uint32_t Dst;
+ uint16_t xSize;
+ uint16_t ySize;
+ uint16_t SrcOffLine;   // pixels to skip at the end of the lines
+ uint16_t BackOffLine;
+ uint16_t DstOffLine;
+ uint32_t ColorMode;    // output, DMA2D_ARGB8888 ...
+ uint32_t SrcColorMode; // CM_ARGB8888 ...
+ uint32_t BackColorMode;
+ uint32_t AlphaMode;    // foreground DMA2D_NO_MODIF_ALPHA ...
+ uint32_t Alpha;        // foreground alpha, the whole ARGB color for CM_A8 and CM_A4
+ uint32_t Clut;         // CM_L8, CM_L4: the ARGB8888 palette of the foreground
+ uint16_t ClutSize;     // colors, 256 max
+}DMA2D_Job;
+
+void D2D_Init(void (*Complete)(DMA2D_HandleTypeDef *), void (*Error)(DMA2D_HandleTypeDef *));
+void D2D_Invalidate(void);
+void D2D_Start(const DMA2D_Job * Job);   // the transfer complete interrupt is on
+uint8_t D2D_Busy(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __DMA2D_REG_H */
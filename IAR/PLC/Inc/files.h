@@ -1,6 +1,44 @@
 #ifndef _FILES_H
 #define _FILES_H
 #include "variables.h"
+#include "fonts.h"
 
 void WriteNewTextFileSD(uint8_t * buff,  char const * NameOfFile, uint32_t NumberOfBytes); // just write text file buffer to write, Name of File in notation "0:/FILEDIR/filename.ext" and number of bytes to write
+
+// Screenshot of the shown layer to a 24 bit BMP, step by step from the main loop:
+// DMA2D turns SHOT_LINES lines to RGB888 while the last SHOT_LINES go to the card,
+// there is no copy of the whole frame. The lines come from the layer shown at the
+// time they are read, a frame flip during the capture is not waited for.
+#define SHOT_LINES              16      // 16 x 2400 bytes = 75 sectors, the writes stay sector aligned
+#define SHOT_HEADER             512     // the pixels start at a sector too
+#define SHOT_TIMEOUT_MS         10000   // the capture is given up after it
+#define SHOT_ADDRESS            (SDRAM_BANK_ADDR + SHOT_OFFSET) // 2 x SHOT_LINES lines RGB888
+
+#define SHOT_IDLE               0
+#define SHOT_BUSY               1
+#define SHOT_DONE               2
+#define SHOT_ERROR              3       // FatFs failed
+#define SHOT_TIMEOUT            4
+
+typedef struct{
+ uint8_t  Result;       // SHOT_DONE ...
+ uint32_t Ms;           // the whole capture
+ uint32_t MaxStep;      // CPU cycles of the longest Shot_Step(), the UI stops for it
+ uint16_t Steps;
+}ShotStat;
+
+extern ShotStat ShotLast;
+
+uint8_t Shot_Start(char const * NameOfFile);   // 0 - a capture is running already
+void    Shot_Step(void);                        // every pass of the main loop, one write at most
+uint8_t Shot_State(void);
+
+// A font file of Tools/ttf2font.py --bin: the header, the descriptors and the bitmaps
+// are read to Address as they are, Font points into them. Returns the bytes taken
+// (a multiple of 4), 0 - no file or not a font. The glyph cache is emptied.
+#define FONT_ADDRESS            (SDRAM_BANK_ADDR + FONT_OFFSET)
+#define FONT_AREA_SIZE          0x00100000
+#define FONT_FILE_HEADER        16
+
+uint32_t Font_Load(char const * NameOfFile, sFONT * Font, uint32_t Address);
 #endif
\ No newline at end of file
@@ -0,0 +1,24 @@
+#ifndef __FONT_RLE_H
+#define __FONT_RLE_H
+#include "fonts.h"
+#include "spans.h"
+
+#ifdef __cplusplus
+ extern "C" {
+#endif /* __cplusplus */
+
+// Run coded fonts (sFONT.rle != 0), made by Tools/font_rle.py. A sign is a list of
+// row groups from the top: [repeat 1..255][n][n x (gap, length)], the gap is counted
+// from the end of the last span of the row. The groups end at Font->Height rows.
+// FONT_INFO()->Offset is the offset of the sign in rle, FONT_INFO()->Wide is as before.
+
+// spans of the sign to span(), the gaps too if the back color is not transparent
+void FontRLE_Draw(const sFONT * Font, uint8_t Code, int16_t x, int16_t y, uint32_t Color, uint32_t BackColor, SpanFunc span);
+// A8 mask of the sign (0 or 255 per pixel), Wide x Height bytes
+void FontRLE_Expand(const sFONT * Font, uint8_t Code, uint8_t * dst);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __FONT_RLE_H */
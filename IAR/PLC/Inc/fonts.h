@@ -18,9 +18,31 @@ typedef struct _tFont
   const struct FONT_CHAR_INFO *tableInfo;
 //  uint16_t Width;
   uint16_t Height;
-  
+  const uint8_t *rle;   // 0 - 1bpp table, else run coded signs, see font_rle.h
+  uint8_t Bpp;          // 0 or 1, 2 and 4 - the coverage of the pixel (Tools/ttf2font.py),
+                        // 4bpp rows have the first pixel in the low nibble, as DMA2D A4 reads them
+  const uint8_t *map;   // 0 - tableInfo[code - ' '], else tableInfo[map[code]], a subset font
 } sFONT;
 
+// The descriptor of the sign of a code, never out of tableInfo: a subset font maps the
+// codes it has no sign for to its replacement sign, a full one the codes below ' '
+#define FONT_REPLACEMENT        '?'
+#define FONT_INFO(f, c)         (&(f)->tableInfo[(f)->map ? (f)->map[(uint8_t)(c)] : \
+                                  (((uint8_t)(c) < ' ') ? FONT_REPLACEMENT - ' ' : (uint8_t)(c) - ' ')])
+
+// Where a font is built from: FONT_FULL - the 1bpp table Src/<font>.c, FONT_RLE - the
+// run coded Src/<font>_rle.c (Tools/font_rle.py), FONT_SUBSET - Src/<font>_sub.c with
+// the signs the UI draws only (Tools/font_subset.py). Not given - FONT_FULL.
+#define FONT_FULL       0
+#define FONT_RLE        1
+#define FONT_SUBSET     2
+
+#define RIAD_16pt_FROM  FONT_SUBSET     // the labels of userinterface.c and the digits
+#define RIAD_20pt_FROM  FONT_RLE
+#define RIAD_30pt_FROM  FONT_SUBSET     // the numbers only: - . 0..9 and the space (number.h)
+#define RIAD_40pt_FROM  FONT_SUBSET
+#define RIAD_80pt_FROM  FONT_SUBSET
+
 extern sFONT GOST_B_23_var;
 extern sFONT ARIALB_16pt;
 extern sFONT RIAD_16pt;
@@ -28,6 +50,7 @@ extern sFONT RIAD_20pt;
 extern sFONT RIAD_30pt;
 extern sFONT RIAD_40pt;
 extern sFONT RIAD_80pt;
+extern sFONT RIAD_80pt_AA;     // 4bpp, the digits, + , - . / and the space only
 
 
 #define LINE(x) ((x) * (((sFONT *)LCD_GetFont())->Height))
@@ -0,0 +1,33 @@
+#ifndef __GLYPHS_H
+#define __GLYPHS_H
+#include "lcd.h"
+
+#ifdef __cplusplus
+ extern "C" {
+#endif /* __cplusplus */
+
+// Glyph cache: a 1bpp sign of a font is expanded once to an A8 mask (0 or 255 per
+// pixel, 2 and 4bpp fonts keep their coverage) in SDRAM, the text is drawn by DMA2D M2M_BLEND, A8 foreground with the text
+// color. The signs are found by the font and the code. A full cache is emptied at once.
+#define GLYPH_ADDRESS           (SDRAM_BANK_ADDR + GLYPH_OFFSET)
+#define GLYPH_CACHE_SIZE        0x00100000      // 1 MB, ~200 signs of RIAD_80pt
+#define GLYPH_SLOTS             512     // power of two, 3/4 of it is used
+
+typedef struct{
+ const sFONT * Font;    // 0 - free slot
+ uint16_t Code;
+ uint16_t Wide;         // pixels, the pitch of the mask
+ uint32_t Address;      // Wide x Font->Height bytes
+}GlyphEntry;
+
+extern uint32_t GlyphMisses;    // signs expanded
+extern uint32_t GlyphFlushes;
+
+const GlyphEntry * Glyph_Get(const sFONT * Font, uint16_t Code);
+void Glyph_Flush(void);         // waits for the DMA2D jobs, they may read the masks
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __GLYPHS_H */
@@ -2,8 +2,12 @@
 #define __GUI_H
 
 #define MAX_OBJECTS_Q   64
-#define MAX_PARAMS_Q    8
+#define MAX_PARAMS_Q    9
 #define MAX_Z_INDEX     8   //max index is 7 (0-7)
+#define GUI_TILED       0   // 1 - only the changed tiles of the screen are drawn, tiles.h
+#define GUI_BEAM_MODE   0   // 1 - start with one layer drawn in bands behind the LTDC, beam.h
+#define GUI_TRANSITIONS 0   // 1 - ViewScreen() pushes the screens in and out, transition.h
+#define GUI_ROTATION    0   // 90 or 270 - the UI is 480x800 and turned to the panel, rotate.h
 
 //////// Types of objects
 #define         LINE_TYPE                    1
@@ -22,6 +26,8 @@
 #define         ROTATING_FILLED_POLY_TYPE    14
 #define         RECT_TYPE                    15
 #define         IMAGE_WITH_TRANSP            16
+#define         THICK_POLY_TYPE              17   // points, count, width, join, cap
+#define         NUMBER_TYPE                  18   // x, y, int32_t *, mode, kerning, font, back color, cells, decimals
 ////////////////////////
 
 #include "variables.h"
@@ -46,5 +52,9 @@ uint8_t GUI_Del_Obj(GUI_Object* deleteObj); // delete Object
 uint8_t GUI_Hide_Obj(GUI_Object* hideObj); // hide Object
 uint8_t GUI_SetVisibility_Obj(GUI_Object* Obj, uint32_t Value); //set Visibility
  void Show_GUI(void);
+void GUI_Invalidate(int16_t x1, int16_t y1, int16_t x2, int16_t y2); // redraw it, the objects don't know it has changed
+void GUI_InvalidateAll(void);
+void GUI_SetBeamMode(uint8_t On);
+void GUI_Transition(uint8_t Type);
  
 #endif
@@ -32,6 +32,10 @@
 #include "ff.h"
 #include "rtc.h"
 #include "leds.h"
+#include "perf.h"
+#include "benchmark.h"
+#include "dma2d_jobs.h"
+#include "ltdc_mon.h"
 #define DOR_interface 1
 
 #ifdef PTZ_interface
@@ -39,11 +39,29 @@ typedef struct
   int16_t Y;
 }Point, * pPoint; 
 
+typedef struct 
+{
+  int16_t X0;     /* left column, inclusive  */
+  int16_t Y0;     /* top line, inclusive     */
+  int16_t X1;     /* right column, inclusive */
+  int16_t Y1;     /* bottom line, inclusive  */
+}ClipRect;
+
+typedef struct
+{
+  uint32_t Address;  /* pixel OriginX, OriginY, 0 - the layer we draw on now */
+  uint16_t Pitch;    /* pixels per line                                      */
+  int16_t  OriginX;  /* screen position of the first pixel                   */
+  int16_t  OriginY;
+}DrawSurface;
+
 typedef struct {
   uint16_t index;
   uint16_t xsize;
   uint16_t ysize;
   uint32_t address;
+  uint32_t clut;     /* L8 image: the ARGB8888 palette, 0 - RGB888 */
+  uint16_t colors;
 }ImageInfo;   
 /** 
   * @brief  Line mode structures definition  
@@ -55,6 +73,19 @@ typedef enum
   LEFT_MODE               = 0x03     /* Left mode   */
 }Text_AlignModeTypdef;
 
+/* A string measured and aligned once: the signs are only placed when it is drawn */
+#define TEXT_LAYOUT_CHARS      24       // longer strings are measured on every draw
+
+typedef struct
+{
+  const sFONT * Font;
+  int16_t  DX, DY;                      // the first sign from the anchor, the alignment
+  int16_t  Width;                       // pixels, the kerning after the last sign is not in it
+  uint8_t  Count;
+  uint8_t  Codes[TEXT_LAYOUT_CHARS];
+  int16_t  X[TEXT_LAYOUT_CHARS];        // of every sign from the first one
+}TextLayout;
+
 /**
   * @}
   */ 
@@ -63,6 +94,7 @@ typedef enum
   * @{
   */ 
 #define MAX_LAYER_NUMBER       ((uint32_t)2)
+#define CLIP_STACK_DEPTH       8
 
 #define LCD_LayerCfgTypeDef    LTDC_LayerCfgTypeDef
 
@@ -122,6 +154,14 @@ typedef enum
 #define LAYER_BACK_OFFSET       LAYER_3_OFFSET + LAYERS_SIZE            // BACKGROUND
 #define IMAGE_1_OFFSET          LAYER_BACK_OFFSET + LAYERS_SIZE         // big image 1   
 #define IMAGE_2_OFFSET          IMAGE_1_OFFSET + LAYERS_SIZE            //big image 2
+#define DIGITS_OFFSET           0x01700000                              // 1 MB, sprites of the big numbers, the images end below it
+#define FONT_OFFSET             0x01800000                              // 1 MB, fonts loaded from SD
+#define GLYPH_OFFSET            0x01900000                              // 1 MB, A8 glyph cache
+#define SHOT_OFFSET             0x01A00000                              // 2 x 16 lines RGB888, screenshots
+#define PORTRAIT_OFFSET         0x01A29000                              // 480x800x4, the rotated UI under the overlay
+#define OVERLAY_OFFSET          0x01BA0000                              // 800x480x1, L8 overlay under the canvases
+#define CANVAS_OFFSET           0x01C00000                              // 4 MB at the top of SDRAM, virtual canvases
+#define CANVAS_SIZE             0x00400000
 #define DisplayHEIGHT           480 // pixels
 #define DisplayWIDTH            800 // pixels
 #define PixelWIDTH              4   // bytes
@@ -155,6 +195,7 @@ uint32_t LCD_GetTextColor(void);
 void     LCD_SetBackColor(uint32_t Color);
 uint32_t LCD_GetBackColor(void);
 void     LCD_SetFont(sFONT *fonts);
+void     LCD_SetGlyphCache(uint8_t On);      // 1 - the text goes by DMA2D from the A8 cache, glyphs.h
 sFONT    *LCD_GetFont(void);
 
 uint32_t LCD_ReadPixel(uint16_t Xpos, uint16_t Ypos);
@@ -163,22 +204,43 @@ void     LCD_Clear(uint32_t Color);
 void     LCD_ClearStringLine(uint32_t Line);
 void     LCD_DisplayStringAtLine(uint16_t Line, uint8_t *ptr, uint8_t Kerning);
 void     LCD_DisplayStringAt(uint16_t Xpos, uint16_t Ypos, uint8_t *Text, Text_AlignModeTypdef Mode, uint8_t kerning);
-void     LCD_DisplayChar(uint16_t Xpos, uint16_t Ypos, uint8_t Ascii);
+void     LCD_DisplayStringAtUTF8(uint16_t Xpos, uint16_t Ypos, const uint8_t *Text, Text_AlignModeTypdef Mode, uint8_t kerning); // up to TEXT_MAX - 1 characters
+void     LCD_DisplayChar(int16_t Xpos, int16_t Ypos, uint8_t Ascii);
+uint8_t  LCD_LayoutString(TextLayout * Layout, sFONT * Font, const uint8_t *Text, Text_AlignModeTypdef Mode, uint8_t Kerning); // 0 - too long
+void     LCD_DrawLayout(const TextLayout * Layout, int16_t Xpos, int16_t Ypos);      // the text and back colors as they are set
 
-void     LCD_DrawHLine(uint16_t Xpos, uint16_t Ypos, uint16_t Length);
-void     LCD_DrawVLine(uint16_t Xpos, uint16_t Ypos, uint16_t Length);
-void     LCD_DrawLine(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2);
-void     LCD_DrawRect(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2);
+void     LCD_DrawHLine(int16_t Xpos, int16_t Ypos, uint16_t Length);
+void     LCD_DrawVLine(int16_t Xpos, int16_t Ypos, uint16_t Length);
+void     LCD_DrawLine(int16_t x1, int16_t y1, int16_t x2, int16_t y2);
+void     LCD_DrawRect(int16_t x1, int16_t y1, int16_t x2, int16_t y2);
 void     LCD_DrawCircle(uint16_t Xpos, uint16_t Ypos, uint16_t Radius);
 void     LCD_DrawPolygon(pPoint Points, uint16_t PointCount);
 void     LCD_DrawEllipse(int Xpos, int Ypos, int XRadius, int YRadius);
 void     LCD_DrawBitmap(uint32_t Xpos, uint32_t Ypos, uint8_t *pbmp);
 
-void     LCD_FillRect(uint32_t x1, uint32_t y1, uint32_t x2, uint32_t y2);
+void     LCD_FillRect(int16_t x1, int16_t y1, int16_t x2, int16_t y2);
 void     LCD_FillCircle(uint16_t Xpos, uint16_t Ypos, uint16_t Radius);
 void     LCD_FillPolygon(pPoint Points, uint16_t PointCount);
 void     LCD_FillEllipse(int Xpos, int Ypos, int XRadius, int YRadius);
-void     LCD_FillTriangle(uint16_t x1, uint16_t x2, uint16_t x3, uint16_t y1, uint16_t y2, uint16_t y3);
+void     LCD_FillTriangle(int16_t x1, int16_t x2, int16_t x3, int16_t y1, int16_t y2, int16_t y3);
+void     LCD_DrawRoundRect(int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t Radius);
+void     LCD_FillRoundRect(int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t Radius);
+void     LCD_FillArc(int16_t Xpos, int16_t Ypos, uint16_t RadiusOut, uint16_t RadiusIn, uint8_t Quadrants); // SPAN_TOP_LEFT ... of spans.h
+void     LCD_FillSpan(int16_t y, int16_t x1, int16_t x2, uint32_t color);
+
+/* Clipping, every primitive draws only inside the top rectangle of the stack */
+uint8_t  LCD_ClipPush(int16_t x1, int16_t y1, int16_t x2, int16_t y2);
+uint8_t  LCD_ClipPushSurface(int16_t x1, int16_t y1, int16_t x2, int16_t y2);
+void     LCD_ClipPop(void);
+void     LCD_ClipReset(void);
+const ClipRect* LCD_GetClip(void);
+
+/* Drawing surface, the primitives write to it with the screen coordinates.
+   A surface smaller than the screen needs a clip inside it */
+void     LCD_SetSurface(uint32_t Address, uint16_t Pitch, int16_t OriginX, int16_t OriginY);
+void     LCD_ResetSurface(void);
+uint32_t LCD_SurfaceAddress(int16_t x, int16_t y);
+uint16_t LCD_SurfacePitch(void);
 
 void     LCD_DisplayOff(void);
 void     LCD_DisplayOn(void);
@@ -187,10 +249,10 @@ void     LCD_SetColorPixel(uint32_t Color);
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////
 void LCD_DrawFullCircle(uint16_t Xpos, uint16_t Ypos, uint16_t radius);
 void LCD_InitParams(uint32_t LayerIndex, uint32_t BackColor, uint32_t TextColor, sFONT* pFont);
-void Fast_LCD_DrawPixel(uint16_t Xpos, uint16_t Ypos, uint32_t ARGB_Code);
+void Fast_LCD_DrawPixel(int16_t Xpos, int16_t Ypos, uint32_t ARGB_Code);
 void LCD_SetLight(uint16_t);
-void DrawFastLineVertical(uint16_t x1, uint16_t y1, uint16_t y2);
-void DrawFastLineHorizontal(uint16_t y1, uint16_t x1, uint16_t x2);
+void DrawFastLineVertical(int16_t x1, int16_t y1, int16_t y2);
+void DrawFastLineHorizontal(int16_t y1, int16_t x1, int16_t x2);
 //void LCD_Fill_Image(uint32_t ImageAddress, uint32_t x, uint32_t y, uint32_t xSize, uint32_t ySize);
 void LCD_Fill_Image(ImageInfo * Image, uint32_t x, uint32_t y);
 void LCD_Fill_ImageTRANSP(ImageInfo * Image, uint32_t x, uint32_t y);
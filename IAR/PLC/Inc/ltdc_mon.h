@@ -0,0 +1,52 @@
+#ifndef __LTDC_MON_H
+#define __LTDC_MON_H
+#include "lcd.h"
+#include "dma2d_reg.h"
+
+#ifdef __cplusplus
+ extern "C" {
+#endif /* __cplusplus */
+
+// LTDC errors, SDRAM traffic of every master and the pixel clock.
+// LTDC FIFO underruns mean the SDRAM is too busy for the refresh, the answer is
+// a longer DMA2D dead time between its bursts first, then a lower refresh rate.
+// Without underruns for a while it steps back.
+#define MON_REFRESH_DEFAULT     58      // Hz, PLLSAIN 204 = 25.5 MHz pixel clock, the old value
+#define MON_REFRESH_MIN         40
+#define MON_REFRESH_MAX         75
+#define MON_REFRESH_STEP        4
+#define MON_DEAD_TIME_STEP      32      // AHB cycles between the DMA2D accesses
+#define MON_DEAD_TIME_MAX       224
+#define MON_CALM_FRAMES         256     // GUI frames without underruns to step back
+#define MON_SDRAM_START         0xC0000000
+
+typedef struct{
+ uint32_t Ltdc;         // bytes read by the LTDC, from the time, the refresh rate and the layers
+ uint32_t Dma2d;        // bytes of the DMA2D jobs from and to SDRAM
+ uint32_t Cpu;          // bytes of the software drawing to SDRAM
+ uint32_t Cycles;       // length of the GUI frame
+ uint32_t Load;         // % of the SDRAM peak, 16 bit at HCLK/2 is 1 byte per CPU cycle
+}MonBytes;
+
+extern volatile uint32_t MonUnderruns;          // LTDC FIFO underruns
+extern volatile uint32_t MonTransferErrors;     // LTDC AHB transfer errors
+extern uint32_t MonBackOffs;                    // how many times the load was lowered
+extern MonBytes MonFrame;                       // the last GUI frame
+extern MonBytes MonCount;                       // the frame in progress, Dma2d and Cpu only
+
+#define MON_CPU_BYTES(n)        (MonCount.Cpu += (n))
+
+void     Mon_Init(void);
+uint8_t  Mon_SetRefresh(uint16_t Hz);   // LCD_ERROR if the PLLSAI can't do it
+uint16_t Mon_GetRefresh(void);
+uint32_t Mon_PixelClock(void);          // Hz
+void     Mon_SetDeadTime(uint8_t Cycles);       // DMA2D AHB dead time, 0 - full speed
+void     Mon_Frame(void);               // once per GUI frame
+void     Mon_Error(uint32_t ErrorCode); // from HAL_LTDC_ErrorCallback()
+void     Mon_Dma2dJob(const DMA2D_Job * Job);   // from D2D_Start()
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __LTDC_MON_H */
@@ -0,0 +1,40 @@
+#ifndef __NUMBER_H
+#define __NUMBER_H
+#include "lcd.h"
+
+#ifdef __cplusplus
+ extern "C" {
+#endif /* __cplusplus */
+
+// Big numbers: the signs of a number "0123456789- ." are drawn once for a font, a
+// color and a back color to ARGB8888 sprites in SDRAM, a number is a row of cells
+// of one width (the widest digit + kerning, the point has its own narrow cell) and
+// every cell is one DMA2D copy. A new value changes only the cells of the other
+// digits, the width of the number stays, so only these cells are redrawn (gui.c).
+// The row is aligned to x as a string of LCD_DisplayStringAt(), CENTER_MODE to the
+// middle of x and y. The digits are centered in the row by whole cells, else every
+// cell would move with the length of the value.
+#define NUM_CELLS_MAX           12      // characters of a number with the sign and the point
+#define NUM_SETS                8       // fonts x colors with sprites, more flush them all
+#define DIGITS_ADDRESS          (SDRAM_BANK_ADDR + DIGITS_OFFSET)
+#define DIGITS_AREA_SIZE        0x00100000
+
+// Value / 10^Decimals in Cells characters, "-0.50", the rest is ' ': before it
+// (RIGHT_MODE), after it (LEFT_MODE) or the half on both sides (CENTER_MODE).
+// Too long - all the digits are '-', the point stays. Returns the length (Cells)
+uint8_t  Num_Format(uint8_t * Dst, int32_t Value, uint8_t Cells, uint8_t Decimals, Text_AlignModeTypdef Mode);
+// The sprites for the font and the colors, not while drawing to a tile or a band:
+// they are drawn with the surface of SDRAM. 0 - no room, the cells are drawn by the font
+uint8_t  Num_Prepare(const sFONT * Font, uint32_t Color, uint32_t BackColor, uint8_t Kerning);
+// pixels from x of the number to the left of the cell, Cell = the length - to the right end
+int16_t  Num_CellX(const sFONT * Font, uint8_t Kerning, const uint8_t * Text, uint8_t Cell, Text_AlignModeTypdef Mode);
+// Text of Num_Format() aligned to Xpos, Ypos, in the clip of the surface
+void     Num_Draw(const sFONT * Font, uint32_t Color, uint32_t BackColor, uint8_t Kerning,
+                  int16_t Xpos, int16_t Ypos, const uint8_t * Text, Text_AlignModeTypdef Mode);
+void     Num_Flush(void);       // the fonts have changed (Font_Load)
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __NUMBER_H */
@@ -0,0 +1,29 @@
+#ifndef __OVERLAY_H
+#define __OVERLAY_H
+#include "lcd.h"
+
+#ifdef __cplusplus
+ extern "C" {
+#endif /* __cplusplus */
+
+// L8 overlay: UI chrome on the second LTDC layer, one byte per pixel and the
+// LTDC CLUT, a quarter of the SDRAM and of the LTDC reads of an ARGB8888 layer.
+// Index OVERLAY_CLEAR is transparent by color keying, its color must not be
+// used by the other entries. Photos and the camera stay ARGB8888 on layer 0.
+// The overlay, the canvas and the screen transitions share the layer.
+#define OVERLAY_LAYER           1
+#define OVERLAY_ADDRESS         (SDRAM_BANK_ADDR + OVERLAY_OFFSET)
+#define OVERLAY_CLEAR           0       // the transparent index
+
+void Overlay_SetPalette(const uint32_t * Palette, uint16_t Colors);     // ARGB8888, the alpha is not used
+void Overlay_Show(int16_t x, int16_t y, uint16_t w, uint16_t h);        // the window on the screen
+void Overlay_Hide(void);
+void Overlay_Fill(int16_t x, int16_t y, uint16_t w, uint16_t h, uint8_t Index);  // overlay coordinates
+// an L8 image made with the overlay palette, the indices are copied as they are
+void Overlay_DrawImage(const ImageInfo * Image, int16_t x, int16_t y);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __OVERLAY_H */
@@ -0,0 +1,33 @@
+#ifndef __PERF_H
+#define __PERF_H
+#include "stm32f7xx_hal.h"
+
+#ifdef __cplusplus
+ extern "C" {
+#endif /* __cplusplus */
+
+// cycle counters on the DWT CYCCNT, 216 cycles = 1 us
+typedef struct{
+ uint32_t Start;       // CYCCNT when the measure begins
+ uint32_t Last;        // cycles of the last measure
+ uint32_t Min;
+ uint32_t Max;
+ uint32_t Avg;         // running average, new value with weight 1/16
+ uint32_t Count;       // how many measures were done
+}PerfCounter;
+
+extern PerfCounter PerfFrame;     // Run_GUI() + Show_GUI()
+extern PerfCounter PerfRelease;   // GUI_Release() only, the drawing itself
+
+void Perf_Init(void);
+void Perf_Reset(PerfCounter * Counter);
+void Perf_Start(PerfCounter * Counter);
+void Perf_Stop(PerfCounter * Counter);
+uint32_t Perf_Cycles(void);
+uint32_t Perf_CyclesToUs(uint32_t Cycles);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __PERF_H */
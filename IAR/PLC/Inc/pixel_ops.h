@@ -0,0 +1,25 @@
+#ifndef __PIXEL_OPS_H
+#define __PIXEL_OPS_H
+#include "stm32f7xx_hal.h"
+
+#ifdef __cplusplus
+ extern "C" {
+#endif /* __cplusplus */
+
+// CPU pixel kernels for the work DMA2D can't take (it has no color key for RGB888),
+// every kernel does one line of Count pixels. The Pix_*_Ref versions are plain C
+// and give the same bits, Tools/test_pixel_ops.c checks it on the host.
+
+// copies the pixels of Src which are not Key, only RGB is compared
+void Pix_ColorKey(uint32_t * Dst, const uint32_t * Src, uint32_t Count, uint32_t Key);
+// B, G, R bytes to opaque ARGB8888, four pixels from three words
+void Pix_RGB888ToARGB8888(uint32_t * Dst, const uint8_t * Src, uint32_t Count);
+
+void Pix_ColorKey_Ref(uint32_t * Dst, const uint32_t * Src, uint32_t Count, uint32_t Key);
+void Pix_RGB888ToARGB8888_Ref(uint32_t * Dst, const uint8_t * Src, uint32_t Count);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __PIXEL_OPS_H */
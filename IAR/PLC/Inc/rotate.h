@@ -0,0 +1,37 @@
+#ifndef __ROTATE_H
+#define __ROTATE_H
+#include "lcd.h"
+
+#ifdef __cplusplus
+ extern "C" {
+#endif /* __cplusplus */
+
+// Portrait mode: the UI is drawn in 480x800 coordinates to an off-screen surface
+// and only the changed part is turned to the landscape layer. DMA2D can't rotate,
+// the CPU does it by blocks: a block is read from SDRAM line by line to DTCM and
+// written out line by line again, the SDRAM sees short bursts, not one pixel per row.
+#define ROT_90                  90      // clockwise, the top of the UI is at the right side
+#define ROT_270                 270     // counterclockwise
+#define ROT_PORTRAIT_W          DisplayHEIGHT
+#define ROT_PORTRAIT_H          DisplayWIDTH
+#define ROT_PORTRAIT_ADDRESS    (SDRAM_BANK_ADDR + PORTRAIT_OFFSET)
+#define ROT_BLOCK               32      // pixels, 32 x 32 x 4 = 4 KB
+#define ROT_BLOCK_ADDR          0x2000C000      // DTCM, after the tiles
+
+extern uint32_t RotPixels;      // turned by the last Rot_Render()
+
+void Rot_Invalidate(int16_t x1, int16_t y1, int16_t x2, int16_t y2);   // portrait coordinates
+void Rot_InvalidateAll(void);
+// The dirty part of the portrait surface is drawn (Background is a 480x800 picture),
+// then it and the part changed one frame before are turned to the landscape Frame.
+// Returns 0 if nothing has changed
+uint8_t Rot_Render(uint32_t Background, uint32_t Frame, void (*Draw)(void), uint16_t Dir);
+// x, y, w, h of the portrait Src to the landscape Dst
+void Rot_Region(uint32_t Src, uint32_t Dst, int16_t x, int16_t y, uint16_t w, uint16_t h, uint16_t Dir);
+void Rot_RegionNaive(uint32_t Src, uint32_t Dst, int16_t x, int16_t y, uint16_t w, uint16_t h, uint16_t Dir);  // per pixel, for the benchmark
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __ROTATE_H */
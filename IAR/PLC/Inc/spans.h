@@ -0,0 +1,35 @@
+#ifndef __SPANS_H
+#define __SPANS_H
+#include <stdint.h>
+
+#ifdef __cplusplus
+ extern "C" {
+#endif /* __cplusplus */
+
+// Span generators: every shape is sent to the backend as horizontal spans
+// x1..x2 (inclusive) on the line y. Filled shapes give exactly one span per line.
+typedef void (*SpanFunc)(int16_t y, int16_t x1, int16_t x2, uint32_t color);
+
+#define SPAN_TABLE_SIZE         512     // max radius is SPAN_TABLE_SIZE - 1
+
+// quadrants for Span_FillArc, the same bits as the corners of dma2d_graphic
+#define SPAN_TOP_LEFT           0x01
+#define SPAN_TOP_RIGHT          0x02
+#define SPAN_BOTTOM_RIGHT       0x04
+#define SPAN_BOTTOM_LEFT        0x08
+#define SPAN_ALL_QUADRANTS      0x0F
+
+void Span_FillCircle(int16_t xc, int16_t yc, uint16_t r, uint32_t color, SpanFunc span);
+void Span_DrawCircle(int16_t xc, int16_t yc, uint16_t r, uint32_t color, SpanFunc span);
+void Span_FillEllipse(int16_t xc, int16_t yc, uint16_t rx, uint16_t ry, uint32_t color, SpanFunc span);
+void Span_DrawEllipse(int16_t xc, int16_t yc, uint16_t rx, uint16_t ry, uint32_t color, SpanFunc span);
+void Span_FillRoundRect(int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t r, uint32_t color, SpanFunc span);
+void Span_DrawRoundRect(int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t r, uint32_t color, SpanFunc span);
+// ring between rIn and rOut in the given quadrants, rIn = 0 - no hole
+void Span_FillArc(int16_t xc, int16_t yc, uint16_t rOut, uint16_t rIn, uint8_t quadrants, uint32_t color, SpanFunc span);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __SPANS_H */
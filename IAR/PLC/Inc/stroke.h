@@ -0,0 +1,31 @@
+#ifndef __STROKE_H
+#define __STROKE_H
+#include "lcd.h"
+
+#ifdef __cplusplus
+ extern "C" {
+#endif /* __cplusplus */
+
+// Thick lines: every segment, join and cap is a convex polygon which is
+// scanned to horizontal spans for LCD_FillSpan, the color is the text color
+#define STROKE_JOIN_MITER       0
+#define STROKE_JOIN_BEVEL       1
+#define STROKE_CAP_BUTT         0
+#define STROKE_CAP_ROUND        1
+#define STROKE_MITER_LIMIT      4.0f    // miter length / width, longer miters become bevels
+
+typedef struct{
+  uint8_t Width;        // pixels
+  uint8_t Join;         // STROKE_JOIN_MITER or STROKE_JOIN_BEVEL
+  uint8_t Cap;          // STROKE_CAP_BUTT or STROKE_CAP_ROUND
+  float   MiterLimit;   // STROKE_MITER_LIMIT if you don't know
+}StrokeStyle;
+
+void LCD_DrawThickLine(int16_t x1, int16_t y1, int16_t x2, int16_t y2, const StrokeStyle * Style);
+void LCD_DrawThickPolyline(const Point * Points, uint16_t PointCount, const StrokeStyle * Style);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __STROKE_H */
@@ -0,0 +1,22 @@
+#ifndef __TEXT_H
+#define __TEXT_H
+#include <stdint.h>
+
+#ifdef __cplusplus
+ extern "C" {
+#endif /* __cplusplus */
+
+// UTF-8 text for the 8 bit fonts: a code point is folded to its CP1251 code, the code
+// of the fonts (the UI strings of userinterface.c are CP1251 too), the font finds the
+// sign by it (FONT_INFO). The characters CP1251 doesn't have become FONT_REPLACEMENT.
+#define TEXT_MAX                128     // bytes of a CP1251 string made from UTF-8, with the 0
+
+uint8_t  Text_Cp1251(uint32_t Unicode);
+// Size - bytes of Dst with the 0, returns the length, bad UTF-8 gives FONT_REPLACEMENT
+uint16_t Text_FromUTF8(uint8_t * Dst, const uint8_t * Utf8, uint16_t Size);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __TEXT_H */
@@ -0,0 +1,31 @@
+#ifndef __TILES_H
+#define __TILES_H
+#include "lcd.h"
+
+#ifdef __cplusplus
+ extern "C" {
+#endif /* __cplusplus */
+
+// Tiled renderer: the screen is cut to tiles, only the dirty ones are drawn.
+// A tile is drawn in DTCM (no cache, no SDRAM traffic), the background comes in
+// and the ready tile goes out to the layer by DMA2D. Two tile buffers: DMA2D
+// moves one while the CPU draws the other.
+#define TILE_W                  64      // pixels, 64 x 32 x 4 = 8 KB
+#define TILE_H                  32
+#define TILES_X                 ((DisplayWIDTH + TILE_W - 1) / TILE_W)
+#define TILES_Y                 ((DisplayHEIGHT + TILE_H - 1) / TILE_H)
+#define TILE_BUFFERS_ADDR       0x20008000      // DTCM, 2 tiles
+
+extern uint16_t TilesDrawn;     // dirty tiles of the last frame
+
+void     Tiles_Invalidate(int16_t x1, int16_t y1, int16_t x2, int16_t y2);
+void     Tiles_InvalidateAll(void);
+// draws the dirty tiles of the layer Frame: Background is copied to the tile,
+// then Draw() is called with the clip and the surface set to the tile
+uint16_t Tiles_Render(uint32_t Background, uint32_t Frame, void (*Draw)(void));
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __TILES_H */
@@ -0,0 +1,40 @@
+#ifndef __TRANSITION_H
+#define __TRANSITION_H
+#include "lcd.h"
+
+#ifdef __cplusplus
+ extern "C" {
+#endif /* __cplusplus */
+
+// Screen transitions by the LTDC only: the new screen is drawn once to a spare
+// buffer shown by the second LTDC layer, then every frame only the layer address,
+// window and constant alpha are written and reloaded in the vertical blanking.
+// The CPU and DMA2D draw nothing while it moves.
+#define TRANS_NONE              0
+#define TRANS_FADE              1
+#define TRANS_SLIDE_LEFT        2       // the new screen comes from the right over the old one
+#define TRANS_SLIDE_RIGHT       3
+#define TRANS_PUSH_LEFT         4       // the new screen pushes the old one out to the left
+#define TRANS_PUSH_RIGHT        5
+
+#define TRANS_FRAMES            20      // LTDC frames, about 1/3 s
+#define TRANS_BUFFER            (SDRAM_BANK_ADDR + LAYER_3_OFFSET)
+
+typedef struct{
+ uint32_t RenderCycles; // drawing of the new screen
+ uint32_t Frames;       // LTDC frames of the animation
+ uint32_t Missed;       // steps which took more than one LTDC frame
+ uint32_t MaxCycles;    // the longest step
+}TransStat;
+
+extern TransStat TransLast;
+
+// Render(Address) draws the new screen to Address, the screen shown now is left
+// with the new screen when it is done
+void Trans_Run(uint8_t Type, uint16_t Frames, void (*Render)(uint32_t Address));
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __TRANSITION_H */
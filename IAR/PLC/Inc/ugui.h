@@ -28,7 +28,7 @@
 //
 //  Oct 11, 2014  V0.1  First release.
 /* -------------------------------------------------------------------------------- */
-#include "system.h"
+#include "stm32f7xx_hal.h"
 
 #ifndef __UGUI_H
 #define __UGUI_H
@@ -518,9 +518,12 @@ typedef struct
 #define DRIVER_ENABLED                                (1<<1)
 
 /* Supported drivers */
-#define NUMBER_OF_DRIVERS                             2
+#define NUMBER_OF_DRIVERS                             5
 #define DRIVER_DRAW_LINE                              0
 #define DRIVER_FILL_FRAME                             1
+#define DRIVER_DRAW_BMP                               2  /* UG_RESULT (*)(UG_S16 xp, UG_S16 yp, UG_BMP* bmp) */
+#define DRIVER_PUT_CHAR                               3  /* UG_RESULT (*)(UG_S16 x, UG_S16 y, UG_S16 w, UG_S16 h, unsigned char* p, UG_COLOR fc, UG_COLOR bc), p - the bits of the char */
+#define DRIVER_SET_CLIP                               4  /* UG_RESULT (*)(UG_AREA* a), a == NULL - the clip is removed */
 
 /* -------------------------------------------------------------------------------- */
 /* -- GUI CORE STRUCTURE                                                        -- */
@@ -558,6 +561,7 @@ typedef struct
    UG_COLOR desktop_color;
    UG_U8 state;
    UG_DRIVER driver[NUMBER_OF_DRIVERS];
+   UG_AREA damage;  /* to be drawn again by the next UG_Update(), xs > xe - nothing */
 } UG_GUI;
 
 #define UG_SATUS_WAIT_FOR_UPDATE                      (1<<0)
@@ -740,6 +744,7 @@ void UG_FontSetVSpace( UG_U16 s );
 /* Miscellaneous functions */
 void UG_WaitForUpdate( void );
 void UG_Update( void );
+void UG_Invalidate( UG_S16 xs, UG_S16 ys, UG_S16 xe, UG_S16 ye );
 void UG_DrawBMP( UG_S16 xp, UG_S16 yp, UG_BMP* bmp );
 void UG_TouchUpdate( UG_S16 xp, UG_S16 yp, UG_U8 state );
 
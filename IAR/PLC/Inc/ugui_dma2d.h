@@ -0,0 +1,24 @@
+#ifndef __UGUI_DMA2D_H
+#define __UGUI_DMA2D_H
+#include "ugui.h"
+
+#ifdef __cplusplus
+ extern "C" {
+#endif /* __cplusplus */
+
+// uGUI on the layer we draw on (the surface and the clip of lcd.h): the frames,
+// the straight lines, the BMPs and the chars are DMA2D jobs of the ring, only the
+// other shapes go pixel by pixel (UGD_PSet waits for the jobs). The jobs run
+// while uGUI goes on, wait for them (Jobs_WaitIdle) before the CPU draws there
+// by lcd.h or the layer is shown. UG_Update() draws only the damage of the window
+// (UG_Invalidate, the changed objects), it is pushed to the clip stack meanwhile.
+#define UGD_CHAR_BYTES          2048    // the A8 mask of a char, FONT_32X53 fits
+
+void UGD_Init(UG_GUI * g);     // UG_Init() for the screen and the drivers
+void UGD_PSet(UG_S16 x, UG_S16 y, UG_COLOR c);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __UGUI_DMA2D_H */
@@ -11,10 +11,12 @@
 typedef struct{
  uint16_t width;
  uint16_t height;
+ uint32_t clut;   // 8 bit BMP: the ARGB8888 palette after the L8 pixels, 0 - RGB888
+ uint16_t colors;
 }ImgSize;
 
 typedef struct{
- uint8_t Ready;
+ uint8_t Ready;   // 1 - the DMA2D job ring is empty
 }DMA2D_Status;
 
 extern volatile DMA2D_Status PLC_DMA2D_Status;
@@ -29,6 +31,7 @@ extern const uint32_t ProjectionLayerAddress[2]; // Were we fill out our objects
  void LCD_Layers_Init(void);
  void _HW_Fill_Region(uint32_t DstAddress, uint32_t xSize, uint32_t ySize, uint32_t OffLine, uint32_t color);
  void _HW_Fill_Image(uint32_t SrcAddress, uint32_t DstAddress, uint32_t xSize, uint32_t  ySize); 
+ void _HW_Fill_Image_PFC(uint32_t SrcAddress, uint32_t DstAddress, uint32_t xSize, uint32_t ySize, uint32_t SrcOffLine, uint32_t DstOffLine, uint32_t InputColorMode);
  void _HW_Fill_ImageToRAM(uint32_t SrcAddress, uint32_t DstAddress, uint32_t xSize, uint32_t  ySize); 
  ImgSize LoadBitmapFromSD(uint8_t *NameOfFile, uint32_t AddressOfImage);
  void TwoDigitsToChars(uint8_t * Src);
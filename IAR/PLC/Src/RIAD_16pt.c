@@ -2,6 +2,8 @@
 // 
 #include "variables.h"
 #include "fonts.h"
+
+#if RIAD_16pt_FROM == FONT_FULL
 // Character bitmaps for GOST type B 16pt
 const uint8_t RIAD_16ptBitmaps[] = 
 {
@@ -5843,4 +5845,5 @@ sFONT RIAD_16pt = {
   RIAD_16ptDescriptors,
 //  0, //variable width
   23, /* Height */
-};
\ No newline at end of file
+};
+#endif
@@ -0,0 +1,179 @@
+// 
+//  RIAD_16pt, 29 signs of RIAD_16pt.c, made by Tools/font_subset.py, don't edit
+// 
+#include "variables.h"
+#include "fonts.h"
+
+#if RIAD_16pt_FROM == FONT_SUBSET
+static const uint8_t Signs[] = 
+{
+	// @0 0x20 (2 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @23 0x2D (5 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @46 0x2F (7 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x06, 0x06, 0x04, 0x0C, 0x08, 0x08, 0x18, 0x10, 0x30, 0x20, 0x20, 0x60,
+	0x40, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0x00,
+	// @69 0x30 (9 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x7F, 0x00, 0x63, 0x00, 0xC1, 0x80,
+	0xC1, 0x80, 0xC1, 0x80, 0xC1, 0x80, 0xC1, 0x80, 0xC1, 0x80, 0xC1, 0x80, 0xC1, 0x80, 0x43, 0x00,
+	0x67, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @115 0x31 (5 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x18, 0x78, 0xD8, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+	0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @138 0x32 (9 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0xFE, 0x00, 0x03, 0x00, 0x03, 0x00,
+	0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x06, 0x00, 0x0C, 0x00, 0x1C, 0x00, 0x38, 0x00, 0x70, 0x00,
+	0xFF, 0x80, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @184 0x33 (8 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x3C, 0x7E, 0x03, 0x03, 0x03, 0x06, 0x3C, 0x0E, 0x03, 0x03, 0x03, 0x03,
+	0xC7, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @207 0x34 (10 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x03, 0x00, 0x05, 0x00, 0x0D, 0x00,
+	0x09, 0x00, 0x19, 0x00, 0x31, 0x00, 0x61, 0x00, 0x41, 0x00, 0xFF, 0xC0, 0x01, 0x00, 0x01, 0x00,
+	0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @253 0x35 (8 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x3F, 0x7F, 0x60, 0x60, 0x40, 0x78, 0x7E, 0x07, 0x03, 0x03, 0x03, 0x03,
+	0xC6, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @276 0x36 (9 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x1F, 0x00, 0x30, 0x00, 0x60, 0x00,
+	0xC0, 0x00, 0xDE, 0x00, 0xF7, 0x00, 0xC1, 0x80, 0xC1, 0x80, 0xC1, 0x80, 0xC1, 0x80, 0xC1, 0x80,
+	0x63, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @322 0x37 (9 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0xFF, 0x80, 0x01, 0x00, 0x03, 0x00,
+	0x02, 0x00, 0x06, 0x00, 0x04, 0x00, 0x0C, 0x00, 0x08, 0x00, 0x18, 0x00, 0x18, 0x00, 0x30, 0x00,
+	0x30, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @368 0x38 (9 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x77, 0x00, 0xC3, 0x00, 0xC1, 0x80,
+	0xC1, 0x00, 0x63, 0x00, 0x3E, 0x00, 0x7F, 0x00, 0xC3, 0x80, 0xC1, 0x80, 0xC1, 0x80, 0xC1, 0x80,
+	0xE3, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @414 0x39 (9 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x7F, 0x00, 0xC3, 0x00, 0xC1, 0x80,
+	0xC1, 0x80, 0xC1, 0x80, 0xC1, 0x80, 0x63, 0x80, 0x3D, 0x80, 0x01, 0x00, 0x03, 0x00, 0x06, 0x00,
+	0x1C, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @460 0xB2 (6 pixels wide)
+	0x30, 0x78, 0x0C, 0x0C, 0x08, 0x10, 0x20, 0x40, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @483 0xC5 (8 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0xFE, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFE, 0x80, 0x80, 0x80, 0x80, 0x80,
+	0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @506 0xCA (9 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x83, 0x00, 0x83, 0x00, 0x86, 0x00, 0x8C, 0x00,
+	0x98, 0x00, 0xB0, 0x00, 0xF0, 0x00, 0xFC, 0x00, 0x86, 0x00, 0x86, 0x00, 0x83, 0x00, 0x83, 0x00,
+	0x81, 0x80, 0x81, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @552 0xCB (11 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x10, 0x60, 0x10, 0x60, 0x10, 0x60,
+	0x10, 0x60, 0x10, 0x60, 0x10, 0x60, 0x10, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60,
+	0x60, 0x60, 0xC0, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @598 0xCE (13 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x30, 0xE0, 0x60, 0x70, 0xC0, 0x30,
+	0xC0, 0x30, 0xC0, 0x18, 0xC0, 0x18, 0xC0, 0x18, 0xC0, 0x18, 0xC0, 0x30, 0xE0, 0x30, 0x60, 0x60,
+	0x38, 0xE0, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @644 0xCF (10 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x80, 0xC0, 0x80, 0xC0, 0x80, 0xC0,
+	0x80, 0xC0, 0x80, 0xC0, 0x80, 0xC0, 0x80, 0xC0, 0x80, 0xC0, 0x80, 0xC0, 0x80, 0xC0, 0x80, 0xC0,
+	0x80, 0xC0, 0x80, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @690 0xD1 (10 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x38, 0x40, 0x60, 0x00, 0x60, 0x00,
+	0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xE0, 0x00, 0x70, 0x00,
+	0x3C, 0x40, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @736 0xDC (9 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00,
+	0x80, 0x00, 0xFC, 0x00, 0xFF, 0x00, 0x83, 0x00, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x83, 0x00,
+	0x8F, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @782 0xE1 (9 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x1F, 0x00, 0x30, 0x00, 0x60, 0x00, 0xC0, 0x00,
+	0xDE, 0x00, 0xA3, 0x00, 0xC1, 0x80, 0xC1, 0x80, 0xC1, 0x80, 0xC1, 0x80, 0xC1, 0x80, 0x41, 0x80,
+	0x63, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @828 0xE3 (7 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+	0xC0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @851 0xE8 (9 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xC1, 0x80, 0xC3, 0x80, 0xC7, 0x80, 0xC5, 0x80, 0xCD, 0x80, 0xC9, 0x80, 0xD9, 0x80, 0xD1, 0x80,
+	0xF1, 0x80, 0xE1, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @897 0xEA (8 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x8C, 0x98, 0xB0, 0xF0, 0xFC, 0x8C, 0x86,
+	0x86, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @920 0xEC (12 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x60, 0xE0, 0x70, 0xE0, 0xF0, 0xE0, 0xD1, 0xE0, 0xD9, 0x20, 0xDB, 0x20, 0xCB, 0x20, 0xCE, 0x20,
+	0xCE, 0x20, 0xC4, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @966 0xED (9 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xC1, 0x80, 0xC1, 0x80, 0xC1, 0x80, 0xC1, 0x80, 0xFF, 0x80, 0xC1, 0x80, 0xC1, 0x80, 0xC1, 0x80,
+	0xC1, 0x80, 0xC1, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1012 0xEE (10 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x3F, 0x00, 0x63, 0x80, 0xC1, 0x80, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC1, 0x80,
+	0x63, 0x80, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1058 0x3F (7 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0xFC, 0x8C, 0x06, 0x04, 0x0C, 0x18, 0x18, 0x30, 0x30, 0x30, 0x00, 0x00,
+	0x30, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static const struct FONT_CHAR_INFO Descriptors[] = 
+{
+	{2, 0}, 		// 0x20
+	{5, 23}, 		// 0x2D
+	{7, 46}, 		// 0x2F
+	{9, 69}, 		// 0x30
+	{5, 115}, 		// 0x31
+	{9, 138}, 		// 0x32
+	{8, 184}, 		// 0x33
+	{10, 207}, 		// 0x34
+	{8, 253}, 		// 0x35
+	{9, 276}, 		// 0x36
+	{9, 322}, 		// 0x37
+	{9, 368}, 		// 0x38
+	{9, 414}, 		// 0x39
+	{6, 460}, 		// 0xB2
+	{8, 483}, 		// 0xC5
+	{9, 506}, 		// 0xCA
+	{11, 552}, 		// 0xCB
+	{13, 598}, 		// 0xCE
+	{10, 644}, 		// 0xCF
+	{10, 690}, 		// 0xD1
+	{9, 736}, 		// 0xDC
+	{9, 782}, 		// 0xE1
+	{7, 828}, 		// 0xE3
+	{9, 851}, 		// 0xE8
+	{8, 897}, 		// 0xEA
+	{12, 920}, 		// 0xEC
+	{9, 966}, 		// 0xED
+	{10, 1012}, 		// 0xEE
+	{7, 1058}, 		// 0x3F
+};
+
+// the sign of every code, 0x3F for the codes which are not here
+static const uint8_t Map[256] = 
+{
+	 28,  28,  28,  28,  28,  28,  28,  28,  28,  28,  28,  28,  28,  28,  28,  28,
+	 28,  28,  28,  28,  28,  28,  28,  28,  28,  28,  28,  28,  28,  28,  28,  28,
+	  0,  28,  28,  28,  28,  28,  28,  28,  28,  28,  28,  28,  28,   1,  28,   2,
+	  3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  28,  28,  28,  28,  28,  28,
+	 28,  28,  28,  28,  28,  28,  28,  28,  28,  28,  28,  28,  28,  28,  28,  28,
+	 28,  28,  28,  28,  28,  28,  28,  28,  28,  28,  28,  28,  28,  28,  28,  28,
+	 28,  28,  28,  28,  28,  28,  28,  28,  28,  28,  28,  28,  28,  28,  28,  28,
+	 28,  28,  28,  28,  28,  28,  28,  28,  28,  28,  28,  28,  28,  28,  28,  28,
+	 28,  28,  28,  28,  28,  28,  28,  28,  28,  28,  28,  28,  28,  28,  28,  28,
+	 28,  28,  28,  28,  28,  28,  28,  28,  28,  28,  28,  28,  28,  28,  28,  28,
+	 28,  28,  28,  28,  28,  28,  28,  28,  28,  28,  28,  28,  28,  28,  28,  28,
+	 28,  28,  13,  28,  28,  28,  28,  28,  28,  28,  28,  28,  28,  28,  28,  28,
+	 28,  28,  28,  28,  28,  14,  28,  28,  28,  28,  15,  16,  28,  28,  17,  18,
+	 28,  19,  28,  28,  28,  28,  28,  28,  28,  28,  28,  28,  20,  28,  28,  28,
+	 28,  21,  28,  22,  28,  28,  28,  28,  23,  28,  24,  28,  25,  26,  27,  28,
+	 28,  28,  28,  28,  28,  28,  28,  28,  28,  28,  28,  28,  28,  28,  28,  28,
+};
+
+sFONT RIAD_16pt = {
+  Signs,
+  Descriptors,
+  23, /* Height */
+  0,
+  1, /* Bpp */
+  Map,
+};
+#endif
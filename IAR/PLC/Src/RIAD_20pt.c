@@ -2,6 +2,8 @@
 // 
 #include "variables.h"
 #include "fonts.h"
+
+#if RIAD_20pt_FROM == FONT_FULL
 // Character bitmaps for GOST type B 16pt
 const uint8_t RIAD_20ptBitmaps[] = 
 {
@@ -7407,4 +7409,5 @@ sFONT RIAD_20pt = {
   RIAD_20ptDescriptors,
 //  0, //variable width
   30, /* Height */
-};
\ No newline at end of file
+};
+#endif
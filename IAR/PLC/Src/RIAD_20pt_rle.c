@@ -0,0 +1,1317 @@
+// 
+//  RIAD_20pt, run coded by Tools/font_rle.py from RIAD_20pt.c, don't edit
+// 
+#include "variables.h"
+#include "fonts.h"
+
+#if RIAD_20pt_FROM == FONT_RLE
+const uint8_t RIAD_20ptRLE[] = 
+{
+	// @0 0x20 (2 pixels wide)
+	0x1E, 0x00,
+	// @2 0x21 (3 pixels wide)
+	0x05, 0x00, 0x0D, 0x01, 0x00, 0x02, 0x02, 0x00, 0x01, 0x01, 0x00, 0x02, 0x01, 0x01, 0x00, 0x03,
+	0x01, 0x01, 0x00, 0x02, 0x07, 0x00,
+	// @24 0x22 (7 pixels wide)
+	0x04, 0x00, 0x02, 0x02, 0x00, 0x03, 0x01, 0x03, 0x01, 0x02, 0x01, 0x02, 0x02, 0x02, 0x01, 0x02,
+	0x01, 0x01, 0x03, 0x02, 0x03, 0x02, 0x01, 0x01, 0x03, 0x01, 0x13, 0x00,
+	// @52 0x23 (11 pixels wide)
+	0x05, 0x00, 0x01, 0x02, 0x04, 0x02, 0x02, 0x02, 0x02, 0x02, 0x04, 0x01, 0x03, 0x02, 0x01, 0x02,
+	0x03, 0x02, 0x03, 0x02, 0x02, 0x02, 0x03, 0x02, 0x03, 0x01, 0x01, 0x01, 0x01, 0x0A, 0x01, 0x02,
+	0x03, 0x02, 0x02, 0x02, 0x03, 0x02, 0x03, 0x01, 0x03, 0x02, 0x02, 0x01, 0x00, 0x0B, 0x01, 0x02,
+	0x02, 0x02, 0x03, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x03, 0x02, 0x02, 0x01, 0x03, 0x02,
+	0x07, 0x00,
+	// @118 0x24 (10 pixels wide)
+	0x03, 0x00, 0x03, 0x01, 0x04, 0x02, 0x01, 0x01, 0x02, 0x07, 0x01, 0x01, 0x01, 0x08, 0x01, 0x01,
+	0x00, 0x03, 0x02, 0x01, 0x00, 0x02, 0x01, 0x01, 0x00, 0x03, 0x01, 0x01, 0x01, 0x04, 0x01, 0x01,
+	0x02, 0x05, 0x01, 0x01, 0x04, 0x04, 0x01, 0x01, 0x06, 0x03, 0x04, 0x01, 0x07, 0x03, 0x01, 0x02,
+	0x00, 0x02, 0x04, 0x03, 0x01, 0x01, 0x00, 0x08, 0x01, 0x01, 0x03, 0x03, 0x02, 0x01, 0x04, 0x02,
+	0x05, 0x00,
+	// @184 0x25 (20 pixels wide)
+	0x05, 0x00, 0x01, 0x02, 0x02, 0x04, 0x08, 0x01, 0x01, 0x02, 0x01, 0x06, 0x06, 0x02, 0x01, 0x03,
+	0x00, 0x02, 0x04, 0x02, 0x05, 0x01, 0x01, 0x03, 0x00, 0x02, 0x04, 0x02, 0x04, 0x02, 0x01, 0x03,
+	0x00, 0x02, 0x04, 0x02, 0x04, 0x01, 0x01, 0x03, 0x00, 0x02, 0x04, 0x02, 0x03, 0x02, 0x01, 0x03,
+	0x00, 0x02, 0x04, 0x02, 0x02, 0x02, 0x01, 0x04, 0x00, 0x02, 0x04, 0x02, 0x02, 0x01, 0x04, 0x01,
+	0x01, 0x04, 0x00, 0x02, 0x04, 0x01, 0x02, 0x02, 0x02, 0x05, 0x01, 0x04, 0x01, 0x06, 0x02, 0x01,
+	0x02, 0x02, 0x03, 0x02, 0x01, 0x04, 0x02, 0x04, 0x02, 0x02, 0x02, 0x01, 0x04, 0x02, 0x01, 0x03,
+	0x08, 0x01, 0x02, 0x02, 0x05, 0x01, 0x01, 0x03, 0x07, 0x02, 0x02, 0x02, 0x05, 0x02, 0x01, 0x03,
+	0x06, 0x02, 0x03, 0x02, 0x05, 0x02, 0x01, 0x03, 0x06, 0x01, 0x04, 0x02, 0x05, 0x01, 0x01, 0x03,
+	0x05, 0x02, 0x05, 0x02, 0x03, 0x02, 0x01, 0x03, 0x05, 0x01, 0x06, 0x02, 0x02, 0x03, 0x01, 0x02,
+	0x04, 0x02, 0x07, 0x05, 0x07, 0x00,
+	// @334 0x26 (15 pixels wide)
+	0x04, 0x00, 0x01, 0x01, 0x06, 0x01, 0x01, 0x01, 0x03, 0x06, 0x01, 0x02, 0x03, 0x02, 0x03, 0x02,
+	0x01, 0x02, 0x02, 0x02, 0x04, 0x02, 0x01, 0x02, 0x02, 0x02, 0x04, 0x03, 0x02, 0x02, 0x02, 0x02,
+	0x04, 0x02, 0x01, 0x02, 0x03, 0x02, 0x01, 0x03, 0x01, 0x01, 0x03, 0x05, 0x01, 0x02, 0x02, 0x05,
+	0x06, 0x02, 0x01, 0x03, 0x01, 0x03, 0x01, 0x03, 0x04, 0x03, 0x01, 0x03, 0x01, 0x02, 0x03, 0x02,
+	0x04, 0x02, 0x01, 0x03, 0x00, 0x02, 0x05, 0x02, 0x03, 0x02, 0x01, 0x03, 0x00, 0x02, 0x05, 0x03,
+	0x01, 0x03, 0x01, 0x02, 0x00, 0x02, 0x06, 0x05, 0x01, 0x02, 0x00, 0x02, 0x07, 0x03, 0x01, 0x02,
+	0x00, 0x03, 0x06, 0x04, 0x01, 0x03, 0x01, 0x04, 0x01, 0x04, 0x01, 0x03, 0x01, 0x02, 0x02, 0x07,
+	0x03, 0x03, 0x07, 0x00,
+	// @450 0x27 (3 pixels wide)
+	0x04, 0x00, 0x02, 0x01, 0x00, 0x03, 0x01, 0x01, 0x01, 0x02, 0x04, 0x01, 0x01, 0x01, 0x13, 0x00,
+	// @466 0x28 (5 pixels wide)
+	0x04, 0x00, 0x01, 0x01, 0x03, 0x02, 0x02, 0x01, 0x02, 0x02, 0x03, 0x01, 0x01, 0x02, 0x0B, 0x01,
+	0x00, 0x02, 0x02, 0x01, 0x01, 0x02, 0x02, 0x01, 0x02, 0x02, 0x01, 0x01, 0x03, 0x02, 0x04, 0x00,
+	// @498 0x29 (5 pixels wide)
+	0x04, 0x00, 0x02, 0x01, 0x00, 0x02, 0x02, 0x01, 0x01, 0x02, 0x03, 0x01, 0x02, 0x02, 0x08, 0x01,
+	0x03, 0x02, 0x04, 0x01, 0x02, 0x02, 0x02, 0x01, 0x01, 0x02, 0x01, 0x01, 0x00, 0x02, 0x04, 0x00,
+	// @530 0x2A (9 pixels wide)
+	0x05, 0x00, 0x01, 0x02, 0x01, 0x02, 0x03, 0x02, 0x01, 0x02, 0x02, 0x02, 0x01, 0x02, 0x01, 0x02,
+	0x03, 0x01, 0x01, 0x01, 0x01, 0x03, 0x00, 0x01, 0x03, 0x02, 0x02, 0x01, 0x01, 0x01, 0x00, 0x09,
+	0x01, 0x02, 0x03, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x01, 0x02, 0x01, 0x02, 0x02, 0x01,
+	0x03, 0x02, 0x01, 0x02, 0x02, 0x01, 0x03, 0x01, 0x10, 0x00,
+	// @588 0x2B (14 pixels wide)
+	0x09, 0x00, 0x06, 0x01, 0x06, 0x02, 0x02, 0x01, 0x00, 0x0E, 0x06, 0x01, 0x06, 0x02, 0x07, 0x00,
+	// @604 0x2C (3 pixels wide)
+	0x14, 0x00, 0x03, 0x01, 0x01, 0x02, 0x02, 0x01, 0x00, 0x02, 0x01, 0x01, 0x00, 0x01, 0x04, 0x00,
+	// @620 0x2D (6 pixels wide)
+	0x0F, 0x00, 0x02, 0x01, 0x00, 0x06, 0x0D, 0x00,
+	// @628 0x2E (4 pixels wide)
+	0x14, 0x00, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x00, 0x04, 0x01, 0x01, 0x01, 0x02, 0x07, 0x00,
+	// @644 0x2F (9 pixels wide)
+	0x04, 0x00, 0x03, 0x01, 0x07, 0x02, 0x02, 0x01, 0x06, 0x02, 0x01, 0x01, 0x06, 0x01, 0x02, 0x01,
+	0x05, 0x02, 0x02, 0x01, 0x04, 0x02, 0x01, 0x01, 0x04, 0x01, 0x02, 0x01, 0x03, 0x02, 0x03, 0x01,
+	0x02, 0x02, 0x02, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x02, 0x06, 0x00,
+	// @692 0x30 (12 pixels wide)
+	0x05, 0x00, 0x01, 0x01, 0x04, 0x04, 0x01, 0x01, 0x03, 0x07, 0x01, 0x02, 0x02, 0x02, 0x04, 0x02,
+	0x01, 0x02, 0x01, 0x03, 0x04, 0x03, 0x01, 0x02, 0x01, 0x02, 0x06, 0x02, 0x02, 0x02, 0x00, 0x03,
+	0x06, 0x03, 0x05, 0x02, 0x00, 0x02, 0x07, 0x03, 0x01, 0x02, 0x00, 0x03, 0x06, 0x03, 0x02, 0x02,
+	0x01, 0x02, 0x06, 0x02, 0x01, 0x02, 0x01, 0x03, 0x04, 0x03, 0x01, 0x01, 0x02, 0x08, 0x01, 0x01,
+	0x03, 0x06, 0x07, 0x00,
+	// @760 0x31 (6 pixels wide)
+	0x05, 0x00, 0x01, 0x01, 0x04, 0x02, 0x01, 0x01, 0x02, 0x04, 0x01, 0x01, 0x00, 0x06, 0x01, 0x02,
+	0x00, 0x02, 0x01, 0x03, 0x0E, 0x01, 0x03, 0x03, 0x07, 0x00,
+	// @786 0x32 (11 pixels wide)
+	0x05, 0x00, 0x01, 0x01, 0x03, 0x05, 0x01, 0x01, 0x01, 0x08, 0x01, 0x02, 0x01, 0x02, 0x04, 0x03,
+	0x01, 0x02, 0x01, 0x01, 0x06, 0x03, 0x03, 0x01, 0x09, 0x02, 0x01, 0x01, 0x08, 0x03, 0x01, 0x01,
+	0x08, 0x02, 0x01, 0x01, 0x07, 0x03, 0x01, 0x01, 0x06, 0x03, 0x01, 0x01, 0x05, 0x03, 0x01, 0x01,
+	0x04, 0x03, 0x01, 0x01, 0x03, 0x03, 0x01, 0x01, 0x02, 0x03, 0x01, 0x01, 0x01, 0x03, 0x02, 0x01,
+	0x00, 0x0B, 0x07, 0x00,
+	// @854 0x33 (11 pixels wide)
+	0x05, 0x00, 0x01, 0x01, 0x03, 0x05, 0x01, 0x01, 0x01, 0x08, 0x01, 0x02, 0x01, 0x02, 0x04, 0x03,
+	0x03, 0x01, 0x08, 0x02, 0x01, 0x01, 0x07, 0x03, 0x01, 0x01, 0x06, 0x03, 0x01, 0x01, 0x03, 0x04,
+	0x01, 0x01, 0x05, 0x04, 0x01, 0x01, 0x08, 0x02, 0x01, 0x01, 0x08, 0x03, 0x02, 0x01, 0x09, 0x02,
+	0x01, 0x01, 0x08, 0x03, 0x01, 0x01, 0x08, 0x02, 0x01, 0x01, 0x00, 0x0A, 0x01, 0x01, 0x01, 0x07,
+	0x07, 0x00,
+	// @920 0x34 (13 pixels wide)
+	0x05, 0x00, 0x02, 0x01, 0x08, 0x03, 0x01, 0x01, 0x07, 0x04, 0x01, 0x02, 0x06, 0x02, 0x01, 0x02,
+	0x01, 0x02, 0x05, 0x03, 0x01, 0x02, 0x01, 0x02, 0x05, 0x02, 0x02, 0x02, 0x01, 0x02, 0x04, 0x02,
+	0x03, 0x02, 0x01, 0x02, 0x03, 0x03, 0x03, 0x02, 0x01, 0x02, 0x03, 0x02, 0x04, 0x02, 0x01, 0x02,
+	0x02, 0x02, 0x05, 0x02, 0x01, 0x02, 0x01, 0x02, 0x06, 0x02, 0x01, 0x01, 0x01, 0x0C, 0x01, 0x01,
+	0x00, 0x0D, 0x05, 0x01, 0x09, 0x02, 0x07, 0x00,
+	// @992 0x35 (11 pixels wide)
+	0x05, 0x00, 0x02, 0x01, 0x02, 0x09, 0x04, 0x01, 0x02, 0x02, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01,
+	0x01, 0x07, 0x01, 0x01, 0x01, 0x09, 0x01, 0x01, 0x07, 0x03, 0x01, 0x01, 0x08, 0x03, 0x03, 0x01,
+	0x09, 0x02, 0x01, 0x01, 0x08, 0x03, 0x01, 0x01, 0x07, 0x03, 0x01, 0x01, 0x00, 0x09, 0x01, 0x01,
+	0x01, 0x07, 0x07, 0x00,
+	// @1044 0x36 (12 pixels wide)
+	0x05, 0x00, 0x01, 0x01, 0x07, 0x03, 0x01, 0x01, 0x05, 0x05, 0x01, 0x01, 0x03, 0x04, 0x01, 0x01,
+	0x02, 0x03, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x03, 0x02,
+	0x01, 0x01, 0x00, 0x0A, 0x01, 0x02, 0x00, 0x05, 0x02, 0x04, 0x01, 0x02, 0x00, 0x03, 0x06, 0x02,
+	0x01, 0x02, 0x00, 0x02, 0x07, 0x03, 0x02, 0x02, 0x00, 0x02, 0x08, 0x02, 0x01, 0x02, 0x00, 0x03,
+	0x06, 0x03, 0x01, 0x02, 0x01, 0x02, 0x06, 0x03, 0x01, 0x02, 0x01, 0x03, 0x04, 0x03, 0x01, 0x01,
+	0x02, 0x08, 0x01, 0x01, 0x03, 0x06, 0x07, 0x00,
+	// @1132 0x37 (11 pixels wide)
+	0x05, 0x00, 0x02, 0x01, 0x00, 0x0B, 0x02, 0x01, 0x08, 0x02, 0x02, 0x01, 0x07, 0x02, 0x02, 0x01,
+	0x06, 0x02, 0x01, 0x01, 0x05, 0x03, 0x01, 0x01, 0x05, 0x02, 0x01, 0x01, 0x04, 0x03, 0x01, 0x01,
+	0x04, 0x02, 0x01, 0x01, 0x03, 0x03, 0x01, 0x01, 0x03, 0x02, 0x01, 0x01, 0x02, 0x03, 0x01, 0x01,
+	0x02, 0x02, 0x01, 0x01, 0x01, 0x03, 0x01, 0x01, 0x01, 0x02, 0x07, 0x00,
+	// @1192 0x38 (12 pixels wide)
+	0x05, 0x00, 0x01, 0x01, 0x04, 0x04, 0x01, 0x01, 0x02, 0x08, 0x01, 0x02, 0x01, 0x03, 0x04, 0x03,
+	0x03, 0x02, 0x01, 0x02, 0x06, 0x02, 0x01, 0x02, 0x01, 0x03, 0x04, 0x03, 0x01, 0x02, 0x02, 0x03,
+	0x02, 0x03, 0x01, 0x01, 0x03, 0x05, 0x01, 0x01, 0x02, 0x08, 0x01, 0x02, 0x01, 0x03, 0x04, 0x03,
+	0x01, 0x02, 0x00, 0x03, 0x06, 0x03, 0x02, 0x02, 0x00, 0x02, 0x07, 0x03, 0x01, 0x02, 0x00, 0x03,
+	0x06, 0x03, 0x01, 0x02, 0x00, 0x03, 0x06, 0x02, 0x01, 0x02, 0x01, 0x04, 0x02, 0x04, 0x01, 0x01,
+	0x02, 0x07, 0x07, 0x00,
+	// @1276 0x39 (12 pixels wide)
+	0x05, 0x00, 0x01, 0x01, 0x04, 0x04, 0x01, 0x01, 0x02, 0x08, 0x01, 0x02, 0x01, 0x03, 0x04, 0x03,
+	0x01, 0x02, 0x01, 0x02, 0x06, 0x02, 0x01, 0x02, 0x00, 0x03, 0x06, 0x03, 0x02, 0x02, 0x00, 0x02,
+	0x07, 0x03, 0x02, 0x02, 0x00, 0x03, 0x06, 0x03, 0x01, 0x02, 0x01, 0x03, 0x04, 0x04, 0x01, 0x01,
+	0x02, 0x0A, 0x01, 0x02, 0x04, 0x03, 0x02, 0x02, 0x01, 0x01, 0x09, 0x02, 0x01, 0x01, 0x08, 0x03,
+	0x01, 0x01, 0x07, 0x03, 0x01, 0x01, 0x06, 0x03, 0x01, 0x01, 0x02, 0x06, 0x01, 0x01, 0x02, 0x04,
+	0x07, 0x00,
+	// @1358 0x3A (4 pixels wide)
+	0x0A, 0x00, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x03, 0x01, 0x01, 0x00, 0x04, 0x01, 0x01,
+	0x01, 0x02, 0x06, 0x00, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x00, 0x04, 0x01, 0x01, 0x01, 0x02,
+	0x07, 0x00,
+	// @1392 0x3B (2 pixels wide)
+	0x09, 0x00, 0x03, 0x01, 0x00, 0x02, 0x08, 0x00, 0x03, 0x01, 0x00, 0x02, 0x03, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x00, 0x01, 0x03, 0x00,
+	// @1414 0x3C (12 pixels wide)
+	0x09, 0x00, 0x01, 0x01, 0x0B, 0x01, 0x01, 0x01, 0x09, 0x03, 0x01, 0x01, 0x07, 0x03, 0x01, 0x01,
+	0x05, 0x03, 0x01, 0x01, 0x03, 0x03, 0x01, 0x01, 0x01, 0x03, 0x01, 0x01, 0x00, 0x02, 0x01, 0x01,
+	0x00, 0x03, 0x01, 0x01, 0x02, 0x03, 0x01, 0x01, 0x04, 0x03, 0x01, 0x01, 0x06, 0x03, 0x01, 0x01,
+	0x07, 0x04, 0x01, 0x01, 0x09, 0x03, 0x01, 0x01, 0x0B, 0x01, 0x07, 0x00,
+	// @1474 0x3D (14 pixels wide)
+	0x0C, 0x00, 0x02, 0x01, 0x00, 0x0E, 0x04, 0x00, 0x01, 0x01, 0x00, 0x0E, 0x0B, 0x00,
+	// @1488 0x3E (12 pixels wide)
+	0x09, 0x00, 0x01, 0x01, 0x00, 0x01, 0x01, 0x01, 0x00, 0x03, 0x01, 0x01, 0x02, 0x03, 0x01, 0x01,
+	0x04, 0x03, 0x01, 0x01, 0x06, 0x03, 0x01, 0x01, 0x08, 0x03, 0x01, 0x01, 0x0A, 0x02, 0x01, 0x01,
+	0x09, 0x03, 0x01, 0x01, 0x07, 0x04, 0x01, 0x01, 0x05, 0x04, 0x01, 0x01, 0x03, 0x04, 0x01, 0x01,
+	0x01, 0x04, 0x01, 0x01, 0x00, 0x03, 0x01, 0x01, 0x00, 0x01, 0x07, 0x00,
+	// @1548 0x3F (9 pixels wide)
+	0x04, 0x00, 0x01, 0x01, 0x04, 0x01, 0x01, 0x01, 0x00, 0x07, 0x01, 0x02, 0x01, 0x02, 0x01, 0x04,
+	0x03, 0x01, 0x06, 0x03, 0x01, 0x01, 0x06, 0x02, 0x01, 0x01, 0x05, 0x03, 0x01, 0x01, 0x04, 0x03,
+	0x01, 0x01, 0x04, 0x02, 0x01, 0x01, 0x03, 0x03, 0x03, 0x01, 0x03, 0x02, 0x02, 0x00, 0x01, 0x01,
+	0x03, 0x02, 0x02, 0x01, 0x02, 0x03, 0x07, 0x00,
+	// @1604 0x40 (18 pixels wide)
+	0x07, 0x00, 0x01, 0x01, 0x07, 0x06, 0x01, 0x02, 0x05, 0x03, 0x04, 0x03, 0x01, 0x02, 0x03, 0x03,
+	0x08, 0x02, 0x01, 0x02, 0x03, 0x01, 0x0B, 0x02, 0x01, 0x03, 0x02, 0x01, 0x07, 0x02, 0x04, 0x01,
+	0x01, 0x03, 0x01, 0x02, 0x04, 0x06, 0x03, 0x02, 0x01, 0x04, 0x01, 0x01, 0x04, 0x02, 0x04, 0x01,
+	0x03, 0x02, 0x02, 0x04, 0x00, 0x02, 0x03, 0x02, 0x04, 0x02, 0x03, 0x02, 0x01, 0x04, 0x00, 0x02,
+	0x02, 0x02, 0x05, 0x02, 0x03, 0x02, 0x01, 0x04, 0x00, 0x02, 0x02, 0x02, 0x05, 0x02, 0x03, 0x01,
+	0x01, 0x04, 0x00, 0x02, 0x02, 0x02, 0x04, 0x02, 0x03, 0x02, 0x01, 0x04, 0x00, 0x02, 0x03, 0x02,
+	0x02, 0x04, 0x02, 0x01, 0x01, 0x03, 0x01, 0x01, 0x03, 0x05, 0x01, 0x04, 0x01, 0x01, 0x01, 0x02,
+	0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x03, 0x02, 0x01, 0x02, 0x04, 0x04, 0x02, 0x03, 0x01, 0x01,
+	0x06, 0x05, 0x04, 0x00,
+	// @1736 0x41 (15 pixels wide)
+	0x05, 0x00, 0x01, 0x01, 0x06, 0x03, 0x01, 0x01, 0x05, 0x04, 0x01, 0x01, 0x05, 0x05, 0x01, 0x02,
+	0x05, 0x02, 0x01, 0x02, 0x01, 0x02, 0x04, 0x02, 0x02, 0x02, 0x01, 0x02, 0x04, 0x02, 0x02, 0x03,
+	0x01, 0x02, 0x04, 0x02, 0x03, 0x02, 0x01, 0x02, 0x03, 0x02, 0x04, 0x02, 0x01, 0x02, 0x03, 0x02,
+	0x04, 0x03, 0x01, 0x02, 0x03, 0x02, 0x05, 0x02, 0x01, 0x01, 0x02, 0x0A, 0x01, 0x01, 0x02, 0x0B,
+	0x01, 0x02, 0x02, 0x02, 0x07, 0x02, 0x01, 0x02, 0x01, 0x03, 0x07, 0x02, 0x01, 0x02, 0x01, 0x02,
+	0x08, 0x03, 0x01, 0x02, 0x01, 0x02, 0x09, 0x02, 0x01, 0x02, 0x00, 0x03, 0x09, 0x02, 0x01, 0x02,
+	0x00, 0x02, 0x0A, 0x03, 0x07, 0x00,
+	// @1838 0x42 (12 pixels wide)
+	0x05, 0x00, 0x01, 0x01, 0x00, 0x09, 0x01, 0x02, 0x00, 0x04, 0x01, 0x05, 0x04, 0x02, 0x00, 0x02,
+	0x06, 0x03, 0x01, 0x02, 0x00, 0x02, 0x06, 0x02, 0x01, 0x02, 0x00, 0x02, 0x03, 0x04, 0x01, 0x01,
+	0x00, 0x08, 0x01, 0x02, 0x00, 0x02, 0x04, 0x04, 0x01, 0x02, 0x00, 0x02, 0x06, 0x03, 0x01, 0x02,
+	0x00, 0x02, 0x07, 0x02, 0x01, 0x02, 0x00, 0x02, 0x07, 0x03, 0x02, 0x02, 0x00, 0x02, 0x07, 0x02,
+	0x01, 0x02, 0x00, 0x02, 0x06, 0x03, 0x01, 0x01, 0x00, 0x0A, 0x01, 0x01, 0x00, 0x08, 0x07, 0x00,
+	// @1918 0x43 (14 pixels wide)
+	0x05, 0x00, 0x01, 0x01, 0x05, 0x09, 0x01, 0x01, 0x03, 0x0A, 0x01, 0x01, 0x02, 0x04, 0x01, 0x01,
+	0x02, 0x02, 0x01, 0x01, 0x01, 0x03, 0x01, 0x01, 0x01, 0x02, 0x02, 0x01, 0x00, 0x03, 0x02, 0x01,
+	0x00, 0x02, 0x03, 0x01, 0x00, 0x03, 0x02, 0x01, 0x01, 0x03, 0x01, 0x01, 0x02, 0x04, 0x01, 0x01,
+	0x03, 0x0B, 0x01, 0x01, 0x05, 0x09, 0x07, 0x00,
+	// @1974 0x44 (15 pixels wide)
+	0x05, 0x00, 0x01, 0x01, 0x00, 0x0A, 0x01, 0x01, 0x00, 0x0C, 0x01, 0x02, 0x00, 0x02, 0x07, 0x04,
+	0x01, 0x02, 0x00, 0x02, 0x09, 0x03, 0x01, 0x02, 0x00, 0x02, 0x0A, 0x02, 0x03, 0x02, 0x00, 0x02,
+	0x0A, 0x03, 0x01, 0x02, 0x00, 0x02, 0x0B, 0x02, 0x03, 0x02, 0x00, 0x02, 0x0A, 0x03, 0x01, 0x02,
+	0x00, 0x02, 0x0A, 0x02, 0x01, 0x02, 0x00, 0x02, 0x09, 0x03, 0x01, 0x02, 0x00, 0x02, 0x08, 0x03,
+	0x01, 0x02, 0x00, 0x02, 0x07, 0x03, 0x01, 0x01, 0x00, 0x0B, 0x01, 0x01, 0x00, 0x09, 0x07, 0x00,
+	// @2054 0x45 (10 pixels wide)
+	0x05, 0x00, 0x02, 0x01, 0x00, 0x0A, 0x06, 0x01, 0x00, 0x02, 0x01, 0x01, 0x00, 0x09, 0x07, 0x01,
+	0x00, 0x02, 0x02, 0x01, 0x00, 0x0A, 0x07, 0x00,
+	// @2078 0x46 (10 pixels wide)
+	0x05, 0x00, 0x02, 0x01, 0x00, 0x0A, 0x06, 0x01, 0x00, 0x02, 0x02, 0x01, 0x00, 0x09, 0x08, 0x01,
+	0x00, 0x02, 0x07, 0x00,
+	// @2098 0x47 (15 pixels wide)
+	0x05, 0x00, 0x01, 0x01, 0x05, 0x09, 0x01, 0x01, 0x04, 0x0A, 0x01, 0x01, 0x02, 0x04, 0x01, 0x01,
+	0x02, 0x02, 0x01, 0x01, 0x01, 0x03, 0x01, 0x01, 0x01, 0x02, 0x02, 0x01, 0x00, 0x03, 0x02, 0x02,
+	0x00, 0x02, 0x07, 0x06, 0x03, 0x02, 0x00, 0x03, 0x0A, 0x02, 0x01, 0x02, 0x01, 0x03, 0x09, 0x02,
+	0x01, 0x02, 0x01, 0x04, 0x08, 0x02, 0x01, 0x02, 0x02, 0x04, 0x07, 0x02, 0x01, 0x01, 0x03, 0x0C,
+	0x01, 0x01, 0x05, 0x09, 0x07, 0x00,
+	// @2168 0x48 (14 pixels wide)
+	0x05, 0x00, 0x07, 0x02, 0x00, 0x02, 0x09, 0x03, 0x02, 0x01, 0x00, 0x0E, 0x09, 0x02, 0x00, 0x02,
+	0x09, 0x03, 0x07, 0x00,
+	// @2188 0x49 (2 pixels wide)
+	0x05, 0x00, 0x12, 0x01, 0x00, 0x02, 0x07, 0x00,
+	// @2196 0x4A (8 pixels wide)
+	0x05, 0x00, 0x0E, 0x01, 0x06, 0x02, 0x02, 0x01, 0x05, 0x03, 0x01, 0x01, 0x00, 0x07, 0x01, 0x01,
+	0x00, 0x06, 0x07, 0x00,
+	// @2216 0x4B (13 pixels wide)
+	0x05, 0x00, 0x01, 0x02, 0x00, 0x02, 0x07, 0x03, 0x01, 0x02, 0x00, 0x02, 0x06, 0x03, 0x01, 0x02,
+	0x00, 0x02, 0x05, 0x03, 0x01, 0x02, 0x00, 0x02, 0x04, 0x03, 0x01, 0x02, 0x00, 0x02, 0x04, 0x02,
+	0x01, 0x02, 0x00, 0x02, 0x03, 0x03, 0x01, 0x02, 0x00, 0x02, 0x02, 0x03, 0x02, 0x02, 0x00, 0x02,
+	0x01, 0x03, 0x01, 0x01, 0x00, 0x07, 0x01, 0x02, 0x00, 0x03, 0x02, 0x03, 0x02, 0x02, 0x00, 0x02,
+	0x04, 0x03, 0x01, 0x02, 0x00, 0x02, 0x05, 0x03, 0x02, 0x02, 0x00, 0x02, 0x06, 0x03, 0x01, 0x02,
+	0x00, 0x02, 0x07, 0x03, 0x01, 0x02, 0x00, 0x02, 0x08, 0x03, 0x07, 0x00,
+	// @2308 0x4C (10 pixels wide)
+	0x05, 0x00, 0x10, 0x01, 0x00, 0x02, 0x02, 0x01, 0x00, 0x0A, 0x07, 0x00,
+	// @2320 0x4D (18 pixels wide)
+	0x05, 0x00, 0x01, 0x02, 0x01, 0x03, 0x0A, 0x03, 0x01, 0x02, 0x01, 0x03, 0x09, 0x04, 0x02, 0x02,
+	0x01, 0x04, 0x08, 0x04, 0x01, 0x03, 0x01, 0x04, 0x07, 0x02, 0x01, 0x02, 0x01, 0x04, 0x00, 0x03,
+	0x01, 0x02, 0x06, 0x02, 0x01, 0x02, 0x01, 0x04, 0x00, 0x02, 0x02, 0x02, 0x06, 0x02, 0x01, 0x02,
+	0x01, 0x04, 0x00, 0x02, 0x02, 0x03, 0x04, 0x02, 0x02, 0x02, 0x01, 0x04, 0x00, 0x02, 0x03, 0x02,
+	0x04, 0x02, 0x02, 0x03, 0x01, 0x04, 0x00, 0x02, 0x03, 0x02, 0x03, 0x03, 0x02, 0x03, 0x01, 0x04,
+	0x00, 0x02, 0x03, 0x03, 0x02, 0x02, 0x03, 0x03, 0x01, 0x04, 0x00, 0x02, 0x04, 0x02, 0x02, 0x02,
+	0x03, 0x03, 0x02, 0x04, 0x00, 0x02, 0x04, 0x02, 0x01, 0x02, 0x05, 0x02, 0x01, 0x03, 0x00, 0x02,
+	0x05, 0x04, 0x05, 0x02, 0x02, 0x03, 0x00, 0x02, 0x05, 0x03, 0x06, 0x02, 0x01, 0x03, 0x00, 0x02,
+	0x06, 0x02, 0x06, 0x02, 0x07, 0x00,
+	// @2454 0x4E (14 pixels wide)
+	0x05, 0x00, 0x01, 0x02, 0x00, 0x03, 0x08, 0x03, 0x02, 0x02, 0x00, 0x04, 0x07, 0x03, 0x01, 0x03,
+	0x00, 0x02, 0x01, 0x02, 0x06, 0x03, 0x01, 0x03, 0x00, 0x02, 0x01, 0x03, 0x05, 0x03, 0x01, 0x03,
+	0x00, 0x02, 0x02, 0x02, 0x05, 0x03, 0x01, 0x03, 0x00, 0x02, 0x02, 0x03, 0x04, 0x03, 0x01, 0x03,
+	0x00, 0x02, 0x03, 0x02, 0x05, 0x02, 0x01, 0x03, 0x00, 0x02, 0x03, 0x03, 0x04, 0x02, 0x01, 0x03,
+	0x00, 0x02, 0x04, 0x03, 0x03, 0x02, 0x01, 0x03, 0x00, 0x02, 0x05, 0x02, 0x03, 0x02, 0x01, 0x03,
+	0x00, 0x02, 0x05, 0x03, 0x02, 0x02, 0x01, 0x03, 0x00, 0x02, 0x06, 0x02, 0x02, 0x02, 0x02, 0x03,
+	0x00, 0x02, 0x07, 0x02, 0x01, 0x02, 0x02, 0x02, 0x00, 0x02, 0x08, 0x04, 0x01, 0x02, 0x00, 0x02,
+	0x09, 0x03, 0x07, 0x00,
+	// @2570 0x4F (17 pixels wide)
+	0x05, 0x00, 0x01, 0x01, 0x04, 0x08, 0x01, 0x02, 0x03, 0x04, 0x02, 0x05, 0x01, 0x02, 0x02, 0x03,
+	0x07, 0x03, 0x01, 0x02, 0x01, 0x03, 0x08, 0x03, 0x01, 0x02, 0x01, 0x02, 0x0A, 0x03, 0x02, 0x02,
+	0x00, 0x03, 0x0B, 0x02, 0x01, 0x02, 0x00, 0x03, 0x0B, 0x03, 0x02, 0x02, 0x00, 0x02, 0x0C, 0x03,
+	0x03, 0x02, 0x00, 0x03, 0x0B, 0x02, 0x01, 0x02, 0x01, 0x03, 0x09, 0x03, 0x01, 0x02, 0x01, 0x03,
+	0x08, 0x03, 0x01, 0x02, 0x02, 0x03, 0x06, 0x03, 0x01, 0x01, 0x03, 0x0A, 0x01, 0x01, 0x05, 0x07,
+	0x07, 0x00,
+	// @2652 0x50 (11 pixels wide)
+	0x05, 0x00, 0x01, 0x01, 0x00, 0x09, 0x01, 0x01, 0x00, 0x0A, 0x01, 0x02, 0x00, 0x02, 0x06, 0x03,
+	0x04, 0x02, 0x00, 0x02, 0x07, 0x02, 0x01, 0x02, 0x00, 0x02, 0x06, 0x03, 0x01, 0x02, 0x00, 0x02,
+	0x05, 0x03, 0x01, 0x01, 0x00, 0x09, 0x01, 0x01, 0x00, 0x07, 0x07, 0x01, 0x00, 0x02, 0x07, 0x00,
+	// @2700 0x51 (17 pixels wide)
+	0x05, 0x00, 0x01, 0x01, 0x04, 0x08, 0x01, 0x02, 0x03, 0x04, 0x02, 0x05, 0x01, 0x02, 0x02, 0x03,
+	0x07, 0x03, 0x01, 0x02, 0x01, 0x03, 0x09, 0x02, 0x01, 0x02, 0x01, 0x02, 0x0A, 0x03, 0x02, 0x02,
+	0x00, 0x03, 0x0B, 0x02, 0x01, 0x02, 0x00, 0x03, 0x0B, 0x03, 0x02, 0x02, 0x00, 0x02, 0x0C, 0x03,
+	0x03, 0x02, 0x00, 0x03, 0x0B, 0x02, 0x01, 0x02, 0x01, 0x03, 0x09, 0x03, 0x01, 0x02, 0x01, 0x03,
+	0x08, 0x03, 0x01, 0x02, 0x02, 0x03, 0x06, 0x03, 0x01, 0x01, 0x03, 0x0A, 0x01, 0x01, 0x05, 0x06,
+	0x01, 0x01, 0x09, 0x07, 0x01, 0x01, 0x0C, 0x04, 0x01, 0x01, 0x0F, 0x01, 0x04, 0x00,
+	// @2794 0x52 (12 pixels wide)
+	0x05, 0x00, 0x01, 0x01, 0x00, 0x09, 0x01, 0x01, 0x00, 0x0A, 0x01, 0x02, 0x00, 0x02, 0x06, 0x03,
+	0x04, 0x02, 0x00, 0x02, 0x07, 0x02, 0x01, 0x02, 0x00, 0x02, 0x06, 0x02, 0x01, 0x01, 0x00, 0x09,
+	0x01, 0x01, 0x00, 0x08, 0x01, 0x02, 0x00, 0x02, 0x04, 0x03, 0x01, 0x02, 0x00, 0x02, 0x05, 0x03,
+	0x01, 0x02, 0x00, 0x02, 0x06, 0x02, 0x02, 0x02, 0x00, 0x02, 0x06, 0x03, 0x02, 0x02, 0x00, 0x02,
+	0x07, 0x02, 0x01, 0x02, 0x00, 0x02, 0x07, 0x03, 0x07, 0x00,
+	// @2868 0x53 (11 pixels wide)
+	0x05, 0x00, 0x01, 0x01, 0x03, 0x07, 0x01, 0x02, 0x02, 0x04, 0x01, 0x03, 0x01, 0x01, 0x01, 0x03,
+	0x03, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x03, 0x01, 0x01, 0x02, 0x04, 0x01, 0x01, 0x03, 0x05,
+	0x01, 0x01, 0x05, 0x05, 0x01, 0x01, 0x07, 0x03, 0x01, 0x01, 0x08, 0x03, 0x02, 0x01, 0x09, 0x02,
+	0x02, 0x01, 0x08, 0x03, 0x01, 0x01, 0x00, 0x0A, 0x01, 0x01, 0x01, 0x07, 0x07, 0x00,
+	// @2930 0x54 (13 pixels wide)
+	0x05, 0x00, 0x02, 0x01, 0x00, 0x0D, 0x10, 0x01, 0x06, 0x02, 0x07, 0x00,
+	// @2942 0x55 (13 pixels wide)
+	0x05, 0x00, 0x0C, 0x02, 0x00, 0x02, 0x09, 0x02, 0x02, 0x02, 0x00, 0x03, 0x08, 0x02, 0x01, 0x02,
+	0x01, 0x02, 0x07, 0x03, 0x01, 0x02, 0x01, 0x03, 0x05, 0x03, 0x01, 0x01, 0x02, 0x09, 0x01, 0x01,
+	0x03, 0x07, 0x07, 0x00,
+	// @2978 0x56 (15 pixels wide)
+	0x05, 0x00, 0x01, 0x02, 0x00, 0x03, 0x09, 0x03, 0x01, 0x02, 0x01, 0x02, 0x09, 0x03, 0x01, 0x02,
+	0x01, 0x03, 0x08, 0x02, 0x01, 0x02, 0x01, 0x03, 0x07, 0x03, 0x02, 0x02, 0x02, 0x02, 0x07, 0x02,
+	0x01, 0x02, 0x02, 0x03, 0x05, 0x03, 0x02, 0x02, 0x03, 0x02, 0x05, 0x02, 0x01, 0x02, 0x03, 0x03,
+	0x03, 0x03, 0x02, 0x02, 0x04, 0x02, 0x03, 0x02, 0x01, 0x02, 0x04, 0x03, 0x01, 0x03, 0x02, 0x02,
+	0x05, 0x02, 0x01, 0x02, 0x01, 0x01, 0x05, 0x05, 0x02, 0x01, 0x06, 0x03, 0x07, 0x00,
+	// @3056 0x57 (21 pixels wide)
+	0x05, 0x00, 0x02, 0x03, 0x00, 0x02, 0x07, 0x03, 0x07, 0x02, 0x01, 0x03, 0x00, 0x03, 0x06, 0x03,
+	0x07, 0x02, 0x01, 0x04, 0x00, 0x03, 0x05, 0x02, 0x01, 0x02, 0x05, 0x03, 0x02, 0x04, 0x01, 0x02,
+	0x05, 0x02, 0x01, 0x02, 0x05, 0x02, 0x01, 0x04, 0x01, 0x02, 0x05, 0x02, 0x01, 0x02, 0x04, 0x03,
+	0x01, 0x04, 0x01, 0x03, 0x03, 0x02, 0x02, 0x03, 0x03, 0x02, 0x02, 0x04, 0x02, 0x02, 0x03, 0x02,
+	0x03, 0x02, 0x03, 0x02, 0x01, 0x04, 0x02, 0x02, 0x03, 0x02, 0x03, 0x02, 0x02, 0x03, 0x01, 0x04,
+	0x02, 0x03, 0x01, 0x02, 0x04, 0x03, 0x01, 0x02, 0x02, 0x04, 0x03, 0x02, 0x01, 0x02, 0x05, 0x02,
+	0x01, 0x02, 0x01, 0x04, 0x03, 0x02, 0x01, 0x01, 0x06, 0x02, 0x01, 0x01, 0x01, 0x02, 0x03, 0x04,
+	0x06, 0x04, 0x02, 0x02, 0x04, 0x03, 0x07, 0x03, 0x07, 0x00,
+	// @3178 0x58 (13 pixels wide)
+	0x05, 0x00, 0x01, 0x02, 0x00, 0x03, 0x07, 0x03, 0x01, 0x02, 0x01, 0x03, 0x06, 0x03, 0x01, 0x02,
+	0x01, 0x03, 0x05, 0x03, 0x01, 0x02, 0x02, 0x03, 0x04, 0x02, 0x01, 0x02, 0x03, 0x02, 0x03, 0x03,
+	0x01, 0x02, 0x03, 0x03, 0x02, 0x02, 0x01, 0x02, 0x04, 0x02, 0x01, 0x02, 0x01, 0x01, 0x04, 0x05,
+	0x01, 0x01, 0x05, 0x03, 0x01, 0x01, 0x05, 0x04, 0x01, 0x02, 0x04, 0x02, 0x01, 0x02, 0x01, 0x02,
+	0x04, 0x02, 0x01, 0x03, 0x01, 0x02, 0x03, 0x02, 0x03, 0x02, 0x01, 0x02, 0x02, 0x03, 0x03, 0x03,
+	0x01, 0x02, 0x02, 0x02, 0x05, 0x03, 0x01, 0x02, 0x01, 0x03, 0x06, 0x02, 0x01, 0x02, 0x01, 0x02,
+	0x07, 0x03, 0x01, 0x02, 0x00, 0x03, 0x08, 0x02, 0x07, 0x00,
+	// @3284 0x59 (13 pixels wide)
+	0x05, 0x00, 0x01, 0x02, 0x00, 0x02, 0x09, 0x02, 0x01, 0x02, 0x00, 0x03, 0x07, 0x03, 0x01, 0x02,
+	0x01, 0x02, 0x07, 0x02, 0x01, 0x02, 0x01, 0x03, 0x05, 0x02, 0x01, 0x02, 0x02, 0x02, 0x04, 0x03,
+	0x01, 0x02, 0x02, 0x03, 0x03, 0x02, 0x01, 0x02, 0x03, 0x02, 0x02, 0x03, 0x01, 0x02, 0x04, 0x02,
+	0x01, 0x02, 0x01, 0x01, 0x04, 0x05, 0x01, 0x01, 0x05, 0x03, 0x08, 0x01, 0x05, 0x02, 0x07, 0x00,
+	// @3348 0x5A (13 pixels wide)
+	0x05, 0x00, 0x02, 0x01, 0x01, 0x0C, 0x01, 0x01, 0x09, 0x03, 0x01, 0x01, 0x09, 0x02, 0x01, 0x01,
+	0x08, 0x03, 0x01, 0x01, 0x07, 0x03, 0x01, 0x01, 0x07, 0x02, 0x01, 0x01, 0x06, 0x03, 0x01, 0x01,
+	0x05, 0x03, 0x01, 0x01, 0x05, 0x02, 0x01, 0x01, 0x04, 0x03, 0x01, 0x01, 0x03, 0x03, 0x01, 0x01,
+	0x03, 0x02, 0x01, 0x01, 0x02, 0x03, 0x01, 0x01, 0x01, 0x03, 0x01, 0x01, 0x01, 0x02, 0x02, 0x01,
+	0x00, 0x0D, 0x07, 0x00,
+	// @3416 0x5B (5 pixels wide)
+	0x04, 0x00, 0x02, 0x01, 0x00, 0x05, 0x13, 0x01, 0x00, 0x02, 0x01, 0x01, 0x00, 0x05, 0x04, 0x00,
+	// @3432 0x5C (9 pixels wide)
+	0x04, 0x00, 0x02, 0x01, 0x00, 0x02, 0x02, 0x01, 0x01, 0x02, 0x01, 0x01, 0x02, 0x01, 0x02, 0x01,
+	0x02, 0x02, 0x03, 0x01, 0x03, 0x02, 0x02, 0x01, 0x04, 0x02, 0x01, 0x01, 0x05, 0x01, 0x02, 0x01,
+	0x05, 0x02, 0x03, 0x01, 0x06, 0x02, 0x02, 0x01, 0x07, 0x02, 0x06, 0x00,
+	// @3476 0x5D (4 pixels wide)
+	0x04, 0x00, 0x02, 0x01, 0x00, 0x04, 0x13, 0x01, 0x03, 0x01, 0x01, 0x01, 0x00, 0x04, 0x04, 0x00,
+	// @3492 0x5E (12 pixels wide)
+	0x05, 0x00, 0x02, 0x01, 0x05, 0x02, 0x01, 0x01, 0x04, 0x04, 0x01, 0x02, 0x04, 0x02, 0x01, 0x01,
+	0x02, 0x02, 0x03, 0x02, 0x02, 0x02, 0x01, 0x02, 0x03, 0x01, 0x04, 0x02, 0x01, 0x02, 0x02, 0x02,
+	0x04, 0x02, 0x01, 0x02, 0x02, 0x01, 0x06, 0x02, 0x01, 0x02, 0x01, 0x02, 0x06, 0x02, 0x01, 0x02,
+	0x01, 0x02, 0x07, 0x01, 0x02, 0x02, 0x00, 0x02, 0x08, 0x02, 0x0C, 0x00,
+	// @3552 0x5F (14 pixels wide)
+	0x19, 0x00, 0x01, 0x01, 0x00, 0x0E, 0x04, 0x00,
+	// @3560 0x60 (4 pixels wide)
+	0x04, 0x00, 0x01, 0x01, 0x00, 0x02, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x03, 0x01, 0x01,
+	0x02, 0x02, 0x16, 0x00,
+	// @3580 0x61 (10 pixels wide)
+	0x0A, 0x00, 0x01, 0x01, 0x01, 0x07, 0x01, 0x02, 0x01, 0x03, 0x02, 0x03, 0x01, 0x01, 0x07, 0x03,
+	0x02, 0x01, 0x08, 0x02, 0x01, 0x01, 0x03, 0x07, 0x01, 0x02, 0x01, 0x04, 0x03, 0x02, 0x01, 0x02,
+	0x00, 0x03, 0x05, 0x02, 0x02, 0x02, 0x00, 0x02, 0x06, 0x02, 0x01, 0x02, 0x00, 0x03, 0x04, 0x03,
+	0x01, 0x02, 0x00, 0x04, 0x01, 0x05, 0x01, 0x02, 0x01, 0x06, 0x01, 0x02, 0x07, 0x00,
+	// @3642 0x62 (12 pixels wide)
+	0x04, 0x00, 0x06, 0x01, 0x00, 0x02, 0x01, 0x02, 0x00, 0x02, 0x02, 0x06, 0x01, 0x02, 0x00, 0x02,
+	0x01, 0x08, 0x01, 0x02, 0x00, 0x04, 0x05, 0x03, 0x01, 0x02, 0x00, 0x03, 0x06, 0x03, 0x05, 0x02,
+	0x00, 0x02, 0x08, 0x02, 0x01, 0x02, 0x00, 0x03, 0x06, 0x03, 0x01, 0x02, 0x00, 0x04, 0x04, 0x03,
+	0x01, 0x02, 0x00, 0x02, 0x01, 0x08, 0x01, 0x02, 0x00, 0x02, 0x02, 0x05, 0x07, 0x00,
+	// @3704 0x63 (10 pixels wide)
+	0x0A, 0x00, 0x01, 0x01, 0x03, 0x07, 0x01, 0x01, 0x02, 0x08, 0x01, 0x01, 0x01, 0x03, 0x01, 0x01,
+	0x01, 0x02, 0x01, 0x01, 0x00, 0x03, 0x02, 0x01, 0x00, 0x02, 0x02, 0x01, 0x00, 0x03, 0x01, 0x01,
+	0x01, 0x02, 0x01, 0x01, 0x01, 0x03, 0x01, 0x01, 0x02, 0x08, 0x01, 0x01, 0x03, 0x07, 0x07, 0x00,
+	// @3752 0x64 (12 pixels wide)
+	0x04, 0x00, 0x06, 0x01, 0x0A, 0x02, 0x01, 0x02, 0x03, 0x06, 0x01, 0x02, 0x01, 0x01, 0x02, 0x0A,
+	0x01, 0x02, 0x01, 0x03, 0x05, 0x03, 0x01, 0x02, 0x01, 0x02, 0x07, 0x02, 0x01, 0x02, 0x00, 0x03,
+	0x07, 0x02, 0x03, 0x02, 0x00, 0x02, 0x08, 0x02, 0x01, 0x02, 0x00, 0x03, 0x07, 0x02, 0x01, 0x02,
+	0x01, 0x02, 0x06, 0x03, 0x01, 0x02, 0x01, 0x03, 0x05, 0x03, 0x01, 0x01, 0x02, 0x0A, 0x01, 0x02,
+	0x03, 0x06, 0x01, 0x02, 0x07, 0x00,
+	// @3822 0x65 (12 pixels wide)
+	0x0A, 0x00, 0x01, 0x01, 0x03, 0x06, 0x01, 0x02, 0x02, 0x03, 0x02, 0x03, 0x01, 0x02, 0x01, 0x02,
+	0x05, 0x03, 0x01, 0x02, 0x01, 0x02, 0x06, 0x02, 0x01, 0x02, 0x00, 0x02, 0x07, 0x02, 0x02, 0x01,
+	0x00, 0x0C, 0x01, 0x01, 0x00, 0x02, 0x01, 0x01, 0x00, 0x03, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01,
+	0x01, 0x03, 0x01, 0x01, 0x02, 0x09, 0x01, 0x01, 0x03, 0x08, 0x07, 0x00,
+	// @3882 0x66 (9 pixels wide)
+	0x04, 0x00, 0x01, 0x01, 0x04, 0x05, 0x01, 0x02, 0x03, 0x04, 0x01, 0x01, 0x01, 0x01, 0x03, 0x02,
+	0x03, 0x01, 0x02, 0x03, 0x02, 0x01, 0x00, 0x08, 0x0B, 0x01, 0x02, 0x03, 0x07, 0x00,
+	// @3912 0x67 (12 pixels wide)
+	0x0A, 0x00, 0x01, 0x02, 0x03, 0x06, 0x01, 0x02, 0x01, 0x02, 0x02, 0x04, 0x01, 0x05, 0x01, 0x02,
+	0x01, 0x03, 0x05, 0x03, 0x01, 0x02, 0x01, 0x02, 0x06, 0x03, 0x01, 0x02, 0x00, 0x03, 0x07, 0x02,
+	0x03, 0x02, 0x00, 0x02, 0x08, 0x02, 0x01, 0x02, 0x00, 0x03, 0x07, 0x02, 0x01, 0x02, 0x01, 0x02,
+	0x06, 0x03, 0x01, 0x02, 0x01, 0x03, 0x04, 0x04, 0x01, 0x02, 0x02, 0x07, 0x01, 0x02, 0x01, 0x02,
+	0x03, 0x05, 0x02, 0x02, 0x01, 0x01, 0x0A, 0x02, 0x01, 0x01, 0x09, 0x03, 0x01, 0x01, 0x09, 0x02,
+	0x01, 0x02, 0x02, 0x01, 0x04, 0x04, 0x01, 0x01, 0x01, 0x09, 0x01, 0x01, 0x04, 0x03, 0x01, 0x00,
+	// @4008 0x68 (11 pixels wide)
+	0x04, 0x00, 0x06, 0x01, 0x00, 0x02, 0x01, 0x02, 0x00, 0x02, 0x02, 0x05, 0x01, 0x02, 0x00, 0x02,
+	0x01, 0x07, 0x02, 0x02, 0x00, 0x03, 0x05, 0x03, 0x09, 0x02, 0x00, 0x02, 0x07, 0x02, 0x07, 0x00,
+	// @4040 0x69 (3 pixels wide)
+	0x05, 0x00, 0x01, 0x01, 0x00, 0x02, 0x01, 0x01, 0x00, 0x03, 0x01, 0x01, 0x00, 0x02, 0x02, 0x00,
+	0x0D, 0x01, 0x00, 0x02, 0x07, 0x00,
+	// @4062 0x6A (6 pixels wide)
+	0x05, 0x00, 0x02, 0x01, 0x03, 0x03, 0x01, 0x01, 0x04, 0x01, 0x02, 0x00, 0x0E, 0x01, 0x03, 0x03,
+	0x02, 0x01, 0x03, 0x02, 0x01, 0x01, 0x01, 0x04, 0x01, 0x01, 0x00, 0x04, 0x01, 0x01, 0x00, 0x02,
+	0x01, 0x00,
+	// @4096 0x6B (11 pixels wide)
+	0x04, 0x00, 0x06, 0x01, 0x00, 0x02, 0x01, 0x02, 0x00, 0x02, 0x05, 0x03, 0x01, 0x02, 0x00, 0x02,
+	0x04, 0x03, 0x01, 0x02, 0x00, 0x02, 0x03, 0x03, 0x01, 0x02, 0x00, 0x02, 0x02, 0x03, 0x01, 0x02,
+	0x00, 0x02, 0x01, 0x03, 0x01, 0x02, 0x00, 0x02, 0x01, 0x02, 0x01, 0x01, 0x00, 0x06, 0x01, 0x02,
+	0x00, 0x03, 0x01, 0x03, 0x01, 0x02, 0x00, 0x02, 0x03, 0x03, 0x01, 0x02, 0x00, 0x02, 0x04, 0x02,
+	0x01, 0x02, 0x00, 0x02, 0x04, 0x03, 0x01, 0x02, 0x00, 0x02, 0x05, 0x03, 0x01, 0x02, 0x00, 0x02,
+	0x06, 0x03, 0x07, 0x00,
+	// @4180 0x6C (2 pixels wide)
+	0x04, 0x00, 0x13, 0x01, 0x00, 0x02, 0x07, 0x00,
+	// @4188 0x6D (19 pixels wide)
+	0x0A, 0x00, 0x01, 0x03, 0x00, 0x02, 0x01, 0x06, 0x03, 0x05, 0x01, 0x01, 0x00, 0x12, 0x01, 0x03,
+	0x00, 0x03, 0x04, 0x04, 0x05, 0x02, 0x01, 0x03, 0x00, 0x03, 0x05, 0x03, 0x05, 0x03, 0x09, 0x03,
+	0x00, 0x02, 0x06, 0x02, 0x06, 0x03, 0x07, 0x00,
+	// @4228 0x6E (11 pixels wide)
+	0x0A, 0x00, 0x01, 0x02, 0x00, 0x02, 0x02, 0x05, 0x01, 0x02, 0x00, 0x02, 0x01, 0x07, 0x02, 0x02,
+	0x00, 0x03, 0x05, 0x03, 0x09, 0x02, 0x00, 0x02, 0x07, 0x02, 0x07, 0x00,
+	// @4256 0x6F (13 pixels wide)
+	0x0A, 0x00, 0x01, 0x01, 0x03, 0x07, 0x01, 0x02, 0x02, 0x04, 0x01, 0x04, 0x01, 0x02, 0x01, 0x03,
+	0x05, 0x03, 0x01, 0x02, 0x01, 0x02, 0x07, 0x02, 0x02, 0x02, 0x00, 0x03, 0x07, 0x03, 0x01, 0x02,
+	0x00, 0x02, 0x08, 0x03, 0x02, 0x02, 0x00, 0x03, 0x07, 0x03, 0x01, 0x02, 0x01, 0x02, 0x07, 0x02,
+	0x01, 0x02, 0x01, 0x03, 0x05, 0x03, 0x01, 0x02, 0x02, 0x04, 0x01, 0x04, 0x01, 0x01, 0x03, 0x07,
+	0x07, 0x00,
+	// @4322 0x70 (12 pixels wide)
+	0x0A, 0x00, 0x01, 0x02, 0x00, 0x02, 0x02, 0x06, 0x01, 0x02, 0x00, 0x02, 0x01, 0x08, 0x01, 0x02,
+	0x00, 0x04, 0x05, 0x02, 0x01, 0x02, 0x00, 0x03, 0x06, 0x03, 0x05, 0x02, 0x00, 0x02, 0x08, 0x02,
+	0x01, 0x02, 0x00, 0x03, 0x06, 0x03, 0x01, 0x02, 0x00, 0x04, 0x04, 0x03, 0x01, 0x02, 0x00, 0x02,
+	0x01, 0x08, 0x01, 0x02, 0x00, 0x02, 0x02, 0x05, 0x05, 0x01, 0x00, 0x02, 0x02, 0x00,
+	// @4384 0x71 (12 pixels wide)
+	0x0A, 0x00, 0x01, 0x02, 0x03, 0x06, 0x01, 0x02, 0x01, 0x01, 0x02, 0x0A, 0x01, 0x02, 0x01, 0x03,
+	0x05, 0x03, 0x01, 0x02, 0x01, 0x02, 0x07, 0x02, 0x01, 0x02, 0x00, 0x03, 0x07, 0x02, 0x03, 0x02,
+	0x00, 0x02, 0x08, 0x02, 0x01, 0x02, 0x00, 0x03, 0x07, 0x02, 0x01, 0x02, 0x00, 0x03, 0x06, 0x03,
+	0x01, 0x02, 0x01, 0x03, 0x05, 0x03, 0x01, 0x01, 0x02, 0x0A, 0x01, 0x02, 0x03, 0x05, 0x02, 0x02,
+	0x05, 0x01, 0x0A, 0x02, 0x02, 0x00,
+	// @4454 0x72 (6 pixels wide)
+	0x0A, 0x00, 0x02, 0x02, 0x00, 0x02, 0x01, 0x03, 0x01, 0x01, 0x00, 0x04, 0x02, 0x01, 0x00, 0x03,
+	0x08, 0x01, 0x00, 0x02, 0x07, 0x00,
+	// @4476 0x73 (9 pixels wide)
+	0x0A, 0x00, 0x01, 0x01, 0x02, 0x06, 0x01, 0x02, 0x01, 0x03, 0x02, 0x02, 0x01, 0x01, 0x01, 0x02,
+	0x01, 0x01, 0x00, 0x03, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x04, 0x01, 0x01, 0x02, 0x05,
+	0x01, 0x01, 0x05, 0x03, 0x02, 0x01, 0x06, 0x03, 0x01, 0x01, 0x06, 0x02, 0x01, 0x01, 0x00, 0x08,
+	0x01, 0x01, 0x00, 0x07, 0x07, 0x00,
+	// @4530 0x74 (8 pixels wide)
+	0x07, 0x00, 0x01, 0x01, 0x03, 0x02, 0x02, 0x01, 0x02, 0x03, 0x02, 0x01, 0x00, 0x08, 0x07, 0x01,
+	0x02, 0x03, 0x02, 0x01, 0x03, 0x02, 0x01, 0x01, 0x03, 0x05, 0x01, 0x01, 0x04, 0x04, 0x07, 0x00,
+	// @4562 0x75 (11 pixels wide)
+	0x0A, 0x00, 0x08, 0x02, 0x00, 0x02, 0x07, 0x02, 0x01, 0x02, 0x00, 0x02, 0x06, 0x03, 0x01, 0x02,
+	0x00, 0x03, 0x05, 0x03, 0x01, 0x02, 0x00, 0x03, 0x04, 0x04, 0x01, 0x02, 0x01, 0x07, 0x01, 0x02,
+	0x01, 0x02, 0x02, 0x05, 0x02, 0x02, 0x07, 0x00,
+	// @4602 0x76 (11 pixels wide)
+	0x0A, 0x00, 0x02, 0x02, 0x00, 0x02, 0x07, 0x02, 0x01, 0x02, 0x00, 0x03, 0x05, 0x03, 0x02, 0x02,
+	0x01, 0x02, 0x05, 0x02, 0x01, 0x02, 0x01, 0x03, 0x03, 0x03, 0x01, 0x02, 0x02, 0x02, 0x03, 0x02,
+	0x01, 0x02, 0x02, 0x03, 0x02, 0x02, 0x03, 0x02, 0x03, 0x02, 0x01, 0x02, 0x02, 0x01, 0x04, 0x03,
+	0x07, 0x00,
+	// @4652 0x77 (18 pixels wide)
+	0x0A, 0x00, 0x01, 0x03, 0x00, 0x02, 0x06, 0x02, 0x06, 0x02, 0x01, 0x03, 0x00, 0x02, 0x05, 0x03,
+	0x06, 0x02, 0x01, 0x03, 0x00, 0x03, 0x04, 0x04, 0x04, 0x03, 0x01, 0x03, 0x01, 0x02, 0x04, 0x04,
+	0x04, 0x02, 0x01, 0x04, 0x01, 0x02, 0x04, 0x01, 0x01, 0x02, 0x04, 0x02, 0x01, 0x04, 0x01, 0x02,
+	0x03, 0x02, 0x02, 0x02, 0x03, 0x02, 0x01, 0x04, 0x01, 0x03, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+	0x01, 0x04, 0x02, 0x02, 0x02, 0x01, 0x03, 0x02, 0x02, 0x02, 0x01, 0x04, 0x02, 0x02, 0x01, 0x02,
+	0x04, 0x02, 0x01, 0x02, 0x01, 0x03, 0x02, 0x02, 0x01, 0x02, 0x04, 0x04, 0x01, 0x02, 0x03, 0x03,
+	0x05, 0x04, 0x01, 0x02, 0x03, 0x03, 0x06, 0x03, 0x01, 0x02, 0x03, 0x03, 0x06, 0x02, 0x07, 0x00,
+	// @4764 0x78 (11 pixels wide)
+	0x0A, 0x00, 0x01, 0x02, 0x00, 0x02, 0x06, 0x03, 0x01, 0x02, 0x01, 0x02, 0x04, 0x03, 0x01, 0x02,
+	0x01, 0x03, 0x03, 0x02, 0x01, 0x02, 0x02, 0x02, 0x02, 0x03, 0x01, 0x02, 0x03, 0x02, 0x01, 0x02,
+	0x01, 0x01, 0x03, 0x04, 0x01, 0x01, 0x04, 0x03, 0x01, 0x01, 0x03, 0x04, 0x01, 0x02, 0x02, 0x03,
+	0x01, 0x02, 0x01, 0x02, 0x02, 0x02, 0x02, 0x03, 0x01, 0x02, 0x01, 0x02, 0x04, 0x02, 0x01, 0x02,
+	0x00, 0x03, 0x04, 0x03, 0x01, 0x02, 0x00, 0x02, 0x06, 0x03, 0x07, 0x00,
+	// @4840 0x79 (12 pixels wide)
+	0x0A, 0x00, 0x01, 0x02, 0x00, 0x03, 0x07, 0x02, 0x01, 0x02, 0x01, 0x02, 0x06, 0x03, 0x01, 0x02,
+	0x01, 0x03, 0x05, 0x03, 0x01, 0x02, 0x02, 0x02, 0x05, 0x02, 0x01, 0x02, 0x02, 0x03, 0x03, 0x03,
+	0x01, 0x02, 0x02, 0x03, 0x03, 0x02, 0x01, 0x02, 0x03, 0x02, 0x03, 0x02, 0x01, 0x02, 0x03, 0x03,
+	0x01, 0x03, 0x02, 0x02, 0x04, 0x02, 0x01, 0x02, 0x01, 0x01, 0x04, 0x04, 0x02, 0x01, 0x05, 0x03,
+	0x01, 0x01, 0x05, 0x02, 0x01, 0x01, 0x04, 0x03, 0x01, 0x01, 0x03, 0x03, 0x01, 0x01, 0x02, 0x03,
+	0x01, 0x01, 0x01, 0x03, 0x01, 0x01, 0x01, 0x02, 0x01, 0x00,
+	// @4930 0x7A (11 pixels wide)
+	0x0A, 0x00, 0x02, 0x01, 0x01, 0x0A, 0x01, 0x01, 0x08, 0x02, 0x01, 0x01, 0x07, 0x02, 0x01, 0x01,
+	0x06, 0x03, 0x01, 0x01, 0x05, 0x03, 0x01, 0x01, 0x04, 0x03, 0x01, 0x01, 0x04, 0x02, 0x01, 0x01,
+	0x03, 0x03, 0x01, 0x01, 0x02, 0x03, 0x01, 0x01, 0x01, 0x03, 0x01, 0x01, 0x01, 0x0A, 0x01, 0x01,
+	0x00, 0x0B, 0x07, 0x00,
+	// @4982 0x7B (6 pixels wide)
+	0x04, 0x00, 0x01, 0x01, 0x05, 0x01, 0x01, 0x01, 0x02, 0x04, 0x01, 0x01, 0x02, 0x02, 0x03, 0x01,
+	0x02, 0x01, 0x04, 0x01, 0x02, 0x02, 0x02, 0x01, 0x00, 0x03, 0x01, 0x01, 0x02, 0x01, 0x04, 0x01,
+	0x02, 0x02, 0x02, 0x01, 0x02, 0x01, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x02, 0x03, 0x01, 0x01,
+	0x03, 0x03, 0x04, 0x00,
+	// @5034 0x7C (2 pixels wide)
+	0x03, 0x00, 0x1B, 0x01, 0x00, 0x02,
+	// @5040 0x7D (6 pixels wide)
+	0x04, 0x00, 0x01, 0x01, 0x00, 0x01, 0x01, 0x01, 0x00, 0x03, 0x08, 0x01, 0x02, 0x02, 0x02, 0x01,
+	0x03, 0x03, 0x08, 0x01, 0x02, 0x02, 0x01, 0x01, 0x01, 0x03, 0x01, 0x01, 0x00, 0x03, 0x04, 0x00,
+	// @5072 0x7E (14 pixels wide)
+	0x0D, 0x00, 0x01, 0x02, 0x02, 0x03, 0x07, 0x02, 0x01, 0x02, 0x01, 0x06, 0x05, 0x02, 0x01, 0x03,
+	0x01, 0x01, 0x03, 0x05, 0x01, 0x02, 0x01, 0x02, 0x00, 0x02, 0x05, 0x06, 0x0D, 0x00,
+	// @5102 0x7F (2 pixels wide)
+	0x1E, 0x00,
+	// @5104 0x80 (2 pixels wide)
+	0x1E, 0x00,
+	// @5106 0x81 (2 pixels wide)
+	0x1E, 0x00,
+	// @5108 0x82 (4 pixels wide)
+	0x15, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x03, 0x02, 0x01, 0x00, 0x04, 0x02, 0x01,
+	0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x01, 0x01, 0x00,
+	// @5136 0x83 (13 pixels wide)
+	0x03, 0x00, 0x01, 0x01, 0x0A, 0x01, 0x01, 0x02, 0x08, 0x02, 0x01, 0x02, 0x01, 0x02, 0x08, 0x01,
+	0x02, 0x02, 0x01, 0x02, 0x07, 0x01, 0x03, 0x01, 0x01, 0x01, 0x07, 0x01, 0x04, 0x01, 0x06, 0x02,
+	0x01, 0x01, 0x03, 0x08, 0x01, 0x01, 0x05, 0x03, 0x07, 0x01, 0x05, 0x02, 0x01, 0x01, 0x05, 0x01,
+	0x03, 0x01, 0x04, 0x02, 0x01, 0x02, 0x00, 0x01, 0x03, 0x01, 0x01, 0x02, 0x00, 0x02, 0x02, 0x01,
+	0x01, 0x02, 0x00, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x00,
+	// @5212 0x84 (9 pixels wide)
+	0x15, 0x00, 0x01, 0x02, 0x00, 0x03, 0x03, 0x02, 0x02, 0x02, 0x00, 0x04, 0x02, 0x03, 0x01, 0x02,
+	0x03, 0x01, 0x04, 0x01, 0x01, 0x02, 0x02, 0x01, 0x05, 0x01, 0x01, 0x02, 0x02, 0x01, 0x04, 0x01,
+	0x01, 0x02, 0x01, 0x01, 0x04, 0x01, 0x02, 0x00,
+	// @5252 0x85 (2 pixels wide)
+	0x1E, 0x00,
+	// @5254 0x86 (10 pixels wide)
+	0x03, 0x00, 0x03, 0x01, 0x04, 0x02, 0x03, 0x01, 0x04, 0x01, 0x01, 0x03, 0x00, 0x03, 0x01, 0x01,
+	0x02, 0x03, 0x01, 0x02, 0x00, 0x02, 0x01, 0x07, 0x04, 0x01, 0x04, 0x01, 0x03, 0x01, 0x04, 0x02,
+	0x0A, 0x01, 0x04, 0x01, 0x02, 0x00,
+	// @5292 0x87 (10 pixels wide)
+	0x03, 0x00, 0x03, 0x01, 0x04, 0x02, 0x03, 0x01, 0x04, 0x01, 0x01, 0x03, 0x00, 0x03, 0x01, 0x01,
+	0x02, 0x03, 0x01, 0x02, 0x00, 0x02, 0x01, 0x07, 0x04, 0x01, 0x04, 0x01, 0x02, 0x01, 0x04, 0x02,
+	0x03, 0x01, 0x04, 0x01, 0x01, 0x03, 0x00, 0x02, 0x02, 0x01, 0x03, 0x02, 0x01, 0x01, 0x00, 0x0A,
+	0x01, 0x03, 0x00, 0x01, 0x03, 0x01, 0x03, 0x02, 0x02, 0x01, 0x04, 0x01, 0x03, 0x01, 0x04, 0x02,
+	0x02, 0x00,
+	// @5358 0x88 (9 pixels wide)
+	0x01, 0x01, 0x03, 0x02, 0x01, 0x01, 0x02, 0x05, 0x01, 0x02, 0x00, 0x03, 0x03, 0x03, 0x1B, 0x00,
+	// @5374 0x89 (22 pixels wide)
+	0x03, 0x00, 0x01, 0x01, 0x0B, 0x01, 0x01, 0x02, 0x03, 0x04, 0x03, 0x02, 0x01, 0x02, 0x02, 0x02,
+	0x02, 0x05, 0x01, 0x03, 0x01, 0x02, 0x03, 0x01, 0x03, 0x01, 0x01, 0x03, 0x01, 0x02, 0x03, 0x01,
+	0x02, 0x01, 0x01, 0x03, 0x01, 0x01, 0x04, 0x01, 0x02, 0x01, 0x01, 0x03, 0x00, 0x02, 0x04, 0x01,
+	0x02, 0x01, 0x01, 0x03, 0x00, 0x02, 0x04, 0x01, 0x01, 0x01, 0x01, 0x03, 0x00, 0x02, 0x03, 0x01,
+	0x02, 0x01, 0x01, 0x03, 0x00, 0x02, 0x03, 0x01, 0x01, 0x01, 0x01, 0x05, 0x01, 0x01, 0x03, 0x01,
+	0x01, 0x01, 0x03, 0x02, 0x06, 0x02, 0x01, 0x06, 0x01, 0x04, 0x02, 0x01, 0x01, 0x02, 0x02, 0x01,
+	0x03, 0x02, 0x02, 0x01, 0x01, 0x05, 0x06, 0x01, 0x02, 0x01, 0x03, 0x01, 0x03, 0x01, 0x03, 0x01,
+	0x01, 0x05, 0x06, 0x01, 0x01, 0x02, 0x03, 0x01, 0x02, 0x02, 0x03, 0x01, 0x01, 0x05, 0x06, 0x01,
+	0x01, 0x01, 0x04, 0x01, 0x02, 0x01, 0x04, 0x01, 0x02, 0x05, 0x05, 0x01, 0x01, 0x02, 0x04, 0x01,
+	0x01, 0x02, 0x04, 0x01, 0x01, 0x05, 0x04, 0x01, 0x02, 0x02, 0x04, 0x01, 0x01, 0x02, 0x03, 0x01,
+	0x02, 0x05, 0x04, 0x01, 0x02, 0x02, 0x03, 0x01, 0x02, 0x02, 0x03, 0x01, 0x01, 0x05, 0x03, 0x01,
+	0x04, 0x01, 0x02, 0x01, 0x04, 0x01, 0x02, 0x01, 0x01, 0x03, 0x03, 0x01, 0x05, 0x02, 0x06, 0x02,
+	0x05, 0x00,
+	// @5568 0x8A (12 pixels wide)
+	0x01, 0x02, 0x02, 0x01, 0x06, 0x01, 0x01, 0x02, 0x03, 0x02, 0x02, 0x02, 0x01, 0x01, 0x04, 0x04,
+	0x01, 0x00, 0x01, 0x02, 0x04, 0x03, 0x03, 0x01, 0x01, 0x02, 0x02, 0x02, 0x03, 0x04, 0x01, 0x02,
+	0x01, 0x02, 0x06, 0x02, 0x02, 0x02, 0x01, 0x01, 0x08, 0x01, 0x02, 0x02, 0x01, 0x02, 0x07, 0x01,
+	0x01, 0x01, 0x01, 0x03, 0x01, 0x01, 0x02, 0x03, 0x01, 0x01, 0x02, 0x04, 0x01, 0x01, 0x04, 0x04,
+	0x01, 0x01, 0x05, 0x04, 0x01, 0x01, 0x07, 0x03, 0x01, 0x01, 0x08, 0x03, 0x01, 0x01, 0x09, 0x03,
+	0x03, 0x02, 0x00, 0x01, 0x09, 0x02, 0x01, 0x02, 0x00, 0x02, 0x08, 0x02, 0x01, 0x02, 0x00, 0x03,
+	0x06, 0x02, 0x01, 0x02, 0x01, 0x03, 0x04, 0x02, 0x01, 0x02, 0x00, 0x01, 0x03, 0x05, 0x04, 0x00,
+	// @5680 0x8B (6 pixels wide)
+	0x0C, 0x00, 0x01, 0x01, 0x05, 0x01, 0x01, 0x01, 0x04, 0x01, 0x01, 0x01, 0x03, 0x01, 0x01, 0x01,
+	0x02, 0x02, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x00, 0x02, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01,
+	0x02, 0x02, 0x01, 0x01, 0x03, 0x01, 0x01, 0x01, 0x04, 0x01, 0x02, 0x01, 0x05, 0x01, 0x06, 0x00,
+	// @5728 0x8C (26 pixels wide)
+	0x04, 0x00, 0x01, 0x01, 0x06, 0x05, 0x01, 0x02, 0x04, 0x02, 0x05, 0x0E, 0x01, 0x03, 0x03, 0x01,
+	0x08, 0x02, 0x09, 0x02, 0x01, 0x03, 0x02, 0x01, 0x0A, 0x01, 0x0A, 0x01, 0x01, 0x03, 0x01, 0x01,
+	0x0B, 0x01, 0x0A, 0x01, 0x01, 0x02, 0x01, 0x01, 0x0B, 0x01, 0x01, 0x02, 0x00, 0x02, 0x0B, 0x01,
+	0x02, 0x03, 0x00, 0x02, 0x0B, 0x01, 0x08, 0x01, 0x01, 0x03, 0x00, 0x02, 0x0B, 0x01, 0x07, 0x02,
+	0x01, 0x02, 0x00, 0x02, 0x0B, 0x0A, 0x03, 0x03, 0x00, 0x02, 0x0B, 0x01, 0x08, 0x01, 0x02, 0x02,
+	0x00, 0x02, 0x0B, 0x01, 0x02, 0x03, 0x01, 0x02, 0x0A, 0x01, 0x0B, 0x01, 0x01, 0x03, 0x02, 0x02,
+	0x09, 0x02, 0x09, 0x02, 0x01, 0x03, 0x03, 0x02, 0x08, 0x02, 0x08, 0x02, 0x01, 0x02, 0x04, 0x03,
+	0x03, 0x0F, 0x01, 0x01, 0x06, 0x04, 0x04, 0x00,
+	// @5848 0x8D (2 pixels wide)
+	0x1E, 0x00,
+	// @5850 0x8E (2 pixels wide)
+	0x1E, 0x00,
+	// @5852 0x8F (2 pixels wide)
+	0x1E, 0x00,
+	// @5854 0x90 (2 pixels wide)
+	0x1E, 0x00,
+	// @5856 0x91 (4 pixels wide)
+	0x03, 0x00, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x03, 0x01, 0x00, 0x01, 0x01, 0x01,
+	0x00, 0x03, 0x01, 0x01, 0x00, 0x04, 0x01, 0x01, 0x01, 0x02, 0x13, 0x00,
+	// @5884 0x92 (4 pixels wide)
+	0x03, 0x00, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x00, 0x03, 0x01, 0x01, 0x01, 0x03, 0x02, 0x01,
+	0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x01, 0x13, 0x00,
+	// @5912 0x93 (10 pixels wide)
+	0x03, 0x00, 0x01, 0x02, 0x02, 0x01, 0x05, 0x01, 0x01, 0x02, 0x01, 0x01, 0x06, 0x02, 0x01, 0x02,
+	0x00, 0x01, 0x06, 0x01, 0x02, 0x02, 0x00, 0x01, 0x05, 0x01, 0x01, 0x02, 0x00, 0x03, 0x04, 0x03,
+	0x01, 0x02, 0x00, 0x04, 0x03, 0x03, 0x01, 0x02, 0x01, 0x02, 0x04, 0x03, 0x13, 0x00,
+	// @5958 0x94 (10 pixels wide)
+	0x03, 0x00, 0x01, 0x02, 0x01, 0x01, 0x05, 0x02, 0x01, 0x02, 0x00, 0x03, 0x04, 0x03, 0x01, 0x02,
+	0x00, 0x03, 0x03, 0x04, 0x01, 0x02, 0x01, 0x03, 0x03, 0x03, 0x02, 0x02, 0x02, 0x01, 0x06, 0x01,
+	0x01, 0x02, 0x01, 0x01, 0x06, 0x01, 0x01, 0x02, 0x00, 0x01, 0x06, 0x01, 0x13, 0x00,
+	// @6004 0x95 (2 pixels wide)
+	0x1E, 0x00,
+	// @6006 0x96 (9 pixels wide)
+	0x0E, 0x00, 0x01, 0x01, 0x00, 0x09, 0x0F, 0x00,
+	// @6014 0x97 (26 pixels wide)
+	0x0E, 0x00, 0x01, 0x01, 0x00, 0x1A, 0x0F, 0x00,
+	// @6022 0x98 (8 pixels wide)
+	0x01, 0x00, 0x01, 0x02, 0x01, 0x02, 0x04, 0x01, 0x01, 0x03, 0x00, 0x01, 0x02, 0x02, 0x01, 0x02,
+	0x01, 0x02, 0x00, 0x01, 0x03, 0x03, 0x1A, 0x00,
+	// @6046 0x99 (25 pixels wide)
+	0x04, 0x00, 0x01, 0x03, 0x00, 0x09, 0x02, 0x03, 0x08, 0x03, 0x01, 0x05, 0x00, 0x01, 0x03, 0x01,
+	0x03, 0x01, 0x03, 0x02, 0x07, 0x02, 0x01, 0x03, 0x04, 0x01, 0x07, 0x03, 0x06, 0x02, 0x02, 0x05,
+	0x04, 0x01, 0x07, 0x01, 0x01, 0x01, 0x05, 0x01, 0x01, 0x01, 0x02, 0x05, 0x04, 0x01, 0x07, 0x01,
+	0x02, 0x01, 0x03, 0x01, 0x02, 0x01, 0x01, 0x05, 0x04, 0x01, 0x07, 0x01, 0x02, 0x02, 0x02, 0x01,
+	0x02, 0x01, 0x01, 0x05, 0x04, 0x01, 0x07, 0x01, 0x03, 0x01, 0x01, 0x01, 0x03, 0x01, 0x01, 0x04,
+	0x04, 0x01, 0x07, 0x01, 0x03, 0x03, 0x03, 0x01, 0x01, 0x04, 0x04, 0x01, 0x07, 0x01, 0x04, 0x01,
+	0x04, 0x01, 0x01, 0x04, 0x04, 0x01, 0x07, 0x01, 0x04, 0x01, 0x04, 0x02, 0x01, 0x07, 0x02, 0x02,
+	0x01, 0x02, 0x04, 0x01, 0x01, 0x01, 0x03, 0x01, 0x03, 0x01, 0x02, 0x01, 0x0D, 0x00,
+	// @6172 0x9A (9 pixels wide)
+	0x07, 0x00, 0x01, 0x02, 0x00, 0x03, 0x03, 0x03, 0x01, 0x01, 0x02, 0x04, 0x02, 0x00, 0x01, 0x02,
+	0x02, 0x03, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x03, 0x02, 0x01, 0x02, 0x01, 0x01, 0x04, 0x01,
+	0x01, 0x02, 0x00, 0x01, 0x05, 0x01, 0x01, 0x02, 0x00, 0x02, 0x04, 0x01, 0x01, 0x01, 0x01, 0x02,
+	0x01, 0x01, 0x01, 0x03, 0x01, 0x01, 0x03, 0x03, 0x01, 0x01, 0x04, 0x03, 0x01, 0x01, 0x05, 0x03,
+	0x01, 0x02, 0x00, 0x01, 0x05, 0x02, 0x02, 0x02, 0x00, 0x01, 0x06, 0x01, 0x01, 0x02, 0x00, 0x02,
+	0x04, 0x02, 0x01, 0x02, 0x00, 0x01, 0x01, 0x04, 0x04, 0x00,
+	// @6262 0x9B (6 pixels wide)
+	0x0C, 0x00, 0x01, 0x01, 0x00, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01,
+	0x03, 0x01, 0x01, 0x01, 0x03, 0x02, 0x01, 0x01, 0x03, 0x03, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01,
+	0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x00, 0x01, 0x06, 0x00,
+	// @6306 0x9C (16 pixels wide)
+	0x0A, 0x00, 0x01, 0x02, 0x03, 0x04, 0x03, 0x04, 0x01, 0x04, 0x02, 0x01, 0x03, 0x02, 0x02, 0x01,
+	0x02, 0x02, 0x01, 0x04, 0x01, 0x02, 0x04, 0x01, 0x01, 0x01, 0x04, 0x01, 0x01, 0x04, 0x01, 0x01,
+	0x05, 0x01, 0x01, 0x01, 0x04, 0x01, 0x01, 0x02, 0x00, 0x02, 0x05, 0x09, 0x01, 0x02, 0x00, 0x02,
+	0x05, 0x02, 0x02, 0x02, 0x00, 0x02, 0x06, 0x01, 0x01, 0x02, 0x00, 0x02, 0x05, 0x03, 0x01, 0x03,
+	0x00, 0x02, 0x05, 0x03, 0x05, 0x01, 0x01, 0x03, 0x01, 0x01, 0x05, 0x03, 0x05, 0x01, 0x01, 0x04,
+	0x01, 0x01, 0x05, 0x01, 0x01, 0x01, 0x04, 0x01, 0x01, 0x04, 0x01, 0x02, 0x03, 0x02, 0x01, 0x02,
+	0x03, 0x01, 0x01, 0x03, 0x02, 0x02, 0x02, 0x01, 0x02, 0x05, 0x01, 0x02, 0x04, 0x02, 0x05, 0x02,
+	0x05, 0x00,
+	// @6420 0x9D (2 pixels wide)
+	0x1E, 0x00,
+	// @6422 0x9E (2 pixels wide)
+	0x1E, 0x00,
+	// @6424 0x9F (18 pixels wide)
+	0x01, 0x02, 0x04, 0x03, 0x05, 0x02, 0x01, 0x02, 0x04, 0x03, 0x04, 0x03, 0x01, 0x02, 0x05, 0x01,
+	0x06, 0x01, 0x01, 0x00, 0x01, 0x02, 0x00, 0x07, 0x06, 0x05, 0x01, 0x02, 0x02, 0x03, 0x09, 0x02,
+	0x01, 0x02, 0x03, 0x02, 0x09, 0x01, 0x01, 0x02, 0x04, 0x02, 0x08, 0x01, 0x01, 0x02, 0x04, 0x03,
+	0x06, 0x01, 0x01, 0x02, 0x05, 0x02, 0x05, 0x02, 0x01, 0x02, 0x06, 0x02, 0x04, 0x01, 0x01, 0x02,
+	0x06, 0x02, 0x03, 0x01, 0x01, 0x02, 0x07, 0x02, 0x02, 0x01, 0x01, 0x01, 0x07, 0x04, 0x01, 0x01,
+	0x08, 0x03, 0x08, 0x01, 0x08, 0x02, 0x01, 0x01, 0x08, 0x03, 0x01, 0x01, 0x05, 0x08, 0x05, 0x00,
+	// @6520 0xA0 (2 pixels wide)
+	0x1E, 0x00,
+	// @6522 0xA1 (3 pixels wide)
+	0x0A, 0x00, 0x01, 0x01, 0x00, 0x02, 0x01, 0x01, 0x00, 0x03, 0x01, 0x01, 0x00, 0x02, 0x02, 0x00,
+	0x0D, 0x01, 0x00, 0x02, 0x02, 0x00,
+	// @6544 0xA2 (10 pixels wide)
+	0x05, 0x00, 0x03, 0x01, 0x05, 0x02, 0x01, 0x01, 0x03, 0x07, 0x01, 0x02, 0x02, 0x03, 0x03, 0x01,
+	0x01, 0x01, 0x01, 0x03, 0x01, 0x01, 0x00, 0x03, 0x04, 0x01, 0x00, 0x02, 0x02, 0x01, 0x00, 0x03,
+	0x01, 0x02, 0x01, 0x04, 0x04, 0x01, 0x01, 0x01, 0x02, 0x08, 0x01, 0x01, 0x04, 0x04, 0x02, 0x01,
+	0x05, 0x02, 0x07, 0x00,
+	// @6596 0xA3 (12 pixels wide)
+	0x05, 0x00, 0x01, 0x01, 0x06, 0x04, 0x01, 0x01, 0x04, 0x07, 0x01, 0x02, 0x04, 0x02, 0x04, 0x01,
+	0x05, 0x01, 0x03, 0x02, 0x02, 0x01, 0x01, 0x08, 0x01, 0x01, 0x03, 0x03, 0x02, 0x01, 0x04, 0x02,
+	0x02, 0x01, 0x03, 0x02, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x01, 0x0B, 0x01, 0x01, 0x00, 0x0C,
+	0x07, 0x00,
+	// @6646 0xA4 (12 pixels wide)
+	0x08, 0x00, 0x01, 0x02, 0x00, 0x02, 0x08, 0x02, 0x01, 0x01, 0x00, 0x0B, 0x01, 0x02, 0x01, 0x04,
+	0x02, 0x03, 0x01, 0x02, 0x01, 0x02, 0x05, 0x02, 0x04, 0x02, 0x01, 0x02, 0x06, 0x02, 0x01, 0x02,
+	0x01, 0x02, 0x05, 0x03, 0x01, 0x02, 0x02, 0x02, 0x03, 0x03, 0x01, 0x01, 0x01, 0x0A, 0x01, 0x03,
+	0x00, 0x02, 0x03, 0x02, 0x03, 0x02, 0x0A, 0x00,
+	// @6702 0xA5 (13 pixels wide)
+	0x05, 0x00, 0x01, 0x02, 0x00, 0x03, 0x08, 0x02, 0x01, 0x02, 0x01, 0x02, 0x07, 0x03, 0x01, 0x02,
+	0x02, 0x02, 0x06, 0x02, 0x01, 0x02, 0x02, 0x03, 0x04, 0x03, 0x01, 0x02, 0x03, 0x02, 0x04, 0x02,
+	0x01, 0x02, 0x03, 0x03, 0x02, 0x02, 0x01, 0x02, 0x04, 0x02, 0x02, 0x02, 0x01, 0x02, 0x04, 0x02,
+	0x01, 0x02, 0x01, 0x01, 0x05, 0x04, 0x01, 0x01, 0x01, 0x0B, 0x02, 0x01, 0x06, 0x02, 0x01, 0x01,
+	0x01, 0x0B, 0x05, 0x01, 0x06, 0x02, 0x07, 0x00,
+	// @6774 0xA6 (2 pixels wide)
+	0x05, 0x00, 0x09, 0x01, 0x00, 0x02, 0x04, 0x00, 0x0A, 0x01, 0x00, 0x02, 0x02, 0x00,
+	// @6788 0xA7 (10 pixels wide)
+	0x05, 0x00, 0x01, 0x01, 0x02, 0x07, 0x01, 0x02, 0x01, 0x03, 0x04, 0x01, 0x03, 0x01, 0x01, 0x02,
+	0x01, 0x01, 0x01, 0x04, 0x01, 0x01, 0x01, 0x07, 0x01, 0x02, 0x00, 0x02, 0x03, 0x04, 0x01, 0x02,
+	0x00, 0x02, 0x05, 0x03, 0x01, 0x02, 0x00, 0x02, 0x06, 0x02, 0x01, 0x02, 0x00, 0x03, 0x05, 0x02,
+	0x01, 0x02, 0x01, 0x05, 0x02, 0x02, 0x01, 0x01, 0x03, 0x06, 0x01, 0x01, 0x05, 0x04, 0x01, 0x01,
+	0x07, 0x03, 0x01, 0x01, 0x08, 0x02, 0x01, 0x01, 0x07, 0x03, 0x01, 0x02, 0x01, 0x01, 0x05, 0x02,
+	0x01, 0x01, 0x00, 0x08, 0x01, 0x01, 0x03, 0x03, 0x05, 0x00,
+	// @6878 0xA8 (8 pixels wide)
+	0x05, 0x00, 0x02, 0x02, 0x00, 0x03, 0x02, 0x03, 0x01, 0x02, 0x01, 0x01, 0x04, 0x01, 0x16, 0x00,
+	// @6894 0xA9 (16 pixels wide)
+	0x06, 0x00, 0x01, 0x01, 0x04, 0x08, 0x01, 0x02, 0x03, 0x02, 0x07, 0x02, 0x01, 0x02, 0x02, 0x01,
+	0x0A, 0x01, 0x01, 0x03, 0x01, 0x02, 0x03, 0x06, 0x02, 0x01, 0x01, 0x04, 0x01, 0x01, 0x03, 0x02,
+	0x04, 0x01, 0x02, 0x02, 0x01, 0x03, 0x00, 0x02, 0x02, 0x02, 0x09, 0x01, 0x04, 0x03, 0x00, 0x01,
+	0x03, 0x01, 0x0A, 0x01, 0x01, 0x03, 0x00, 0x02, 0x02, 0x02, 0x09, 0x01, 0x01, 0x04, 0x01, 0x01,
+	0x03, 0x02, 0x04, 0x01, 0x02, 0x02, 0x01, 0x03, 0x01, 0x02, 0x04, 0x04, 0x02, 0x02, 0x01, 0x02,
+	0x02, 0x02, 0x08, 0x02, 0x01, 0x02, 0x03, 0x02, 0x06, 0x02, 0x01, 0x01, 0x05, 0x07, 0x08, 0x00,
+	// @6990 0xAA (7 pixels wide)
+	0x07, 0x00, 0x01, 0x01, 0x01, 0x05, 0x01, 0x02, 0x01, 0x01, 0x02, 0x03, 0x01, 0x01, 0x05, 0x02,
+	0x01, 0x01, 0x03, 0x04, 0x01, 0x02, 0x01, 0x03, 0x01, 0x02, 0x02, 0x02, 0x00, 0x02, 0x03, 0x02,
+	0x01, 0x02, 0x00, 0x03, 0x01, 0x03, 0x01, 0x02, 0x01, 0x03, 0x02, 0x01, 0x0E, 0x00,
+	// @7036 0xAB (9 pixels wide)
+	0x0B, 0x00, 0x01, 0x02, 0x03, 0x02, 0x03, 0x01, 0x01, 0x02, 0x02, 0x02, 0x03, 0x02, 0x01, 0x02,
+	0x02, 0x02, 0x02, 0x02, 0x01, 0x02, 0x01, 0x02, 0x02, 0x02, 0x01, 0x02, 0x00, 0x02, 0x03, 0x02,
+	0x01, 0x02, 0x00, 0x02, 0x02, 0x02, 0x01, 0x02, 0x01, 0x02, 0x02, 0x02, 0x01, 0x02, 0x01, 0x02,
+	0x03, 0x02, 0x01, 0x02, 0x02, 0x02, 0x03, 0x02, 0x01, 0x02, 0x03, 0x02, 0x02, 0x02, 0x09, 0x00,
+	// @7100 0xAC (14 pixels wide)
+	0x0C, 0x00, 0x02, 0x01, 0x00, 0x0E, 0x06, 0x01, 0x0C, 0x02, 0x0A, 0x00,
+	// @7112 0xAD (2 pixels wide)
+	0x1E, 0x00,
+	// @7114 0xAE (9 pixels wide)
+	0x05, 0x00, 0x01, 0x02, 0x02, 0x02, 0x01, 0x03, 0x01, 0x02, 0x01, 0x01, 0x05, 0x01, 0x01, 0x04,
+	0x00, 0x02, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x04, 0x00, 0x01, 0x02, 0x01, 0x01, 0x02,
+	0x01, 0x01, 0x01, 0x03, 0x00, 0x01, 0x02, 0x03, 0x02, 0x01, 0x01, 0x04, 0x00, 0x02, 0x01, 0x01,
+	0x01, 0x02, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x05, 0x01, 0x01, 0x02, 0x02, 0x02, 0x01, 0x02,
+	0x11, 0x00,
+	// @7180 0xAF (6 pixels wide)
+	0x06, 0x00, 0x01, 0x01, 0x00, 0x06, 0x17, 0x00,
+	// @7188 0xB0 (7 pixels wide)
+	0x05, 0x00, 0x01, 0x01, 0x01, 0x05, 0x01, 0x02, 0x00, 0x02, 0x03, 0x02, 0x02, 0x02, 0x00, 0x01,
+	0x04, 0x02, 0x01, 0x02, 0x00, 0x02, 0x03, 0x02, 0x01, 0x01, 0x01, 0x05, 0x01, 0x01, 0x02, 0x02,
+	0x12, 0x00,
+	// @7222 0xB1 (14 pixels wide)
+	0x08, 0x00, 0x05, 0x01, 0x06, 0x02, 0x01, 0x01, 0x00, 0x0E, 0x06, 0x01, 0x06, 0x02, 0x01, 0x00,
+	0x02, 0x01, 0x00, 0x0E, 0x07, 0x00,
+	// @7244 0xB2 (8 pixels wide)
+	0x01, 0x01, 0x03, 0x02, 0x01, 0x01, 0x01, 0x06, 0x04, 0x01, 0x05, 0x02, 0x01, 0x01, 0x04, 0x02,
+	0x01, 0x01, 0x03, 0x02, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x00, 0x08,
+	0x13, 0x00,
+	// @7278 0xB3 (8 pixels wide)
+	0x01, 0x01, 0x03, 0x02, 0x01, 0x01, 0x01, 0x06, 0x02, 0x01, 0x05, 0x02, 0x01, 0x01, 0x04, 0x03,
+	0x01, 0x01, 0x02, 0x04, 0x01, 0x01, 0x05, 0x02, 0x01, 0x01, 0x06, 0x02, 0x01, 0x01, 0x05, 0x03,
+	0x01, 0x02, 0x01, 0x01, 0x02, 0x03, 0x01, 0x01, 0x00, 0x06, 0x13, 0x00,
+	// @7322 0xB4 (5 pixels wide)
+	0x04, 0x00, 0x01, 0x01, 0x02, 0x03, 0x01, 0x01, 0x01, 0x03, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01,
+	0x00, 0x02, 0x16, 0x00,
+	// @7342 0xB5 (12 pixels wide)
+	0x0A, 0x00, 0x09, 0x02, 0x00, 0x02, 0x07, 0x02, 0x01, 0x02, 0x00, 0x03, 0x05, 0x03, 0x01, 0x02,
+	0x00, 0x03, 0x04, 0x04, 0x01, 0x02, 0x00, 0x08, 0x01, 0x03, 0x01, 0x03, 0x00, 0x02, 0x01, 0x04,
+	0x02, 0x03, 0x05, 0x01, 0x00, 0x02, 0x02, 0x00,
+	// @7382 0xB6 (11 pixels wide)
+	0x05, 0x00, 0x01, 0x01, 0x03, 0x08, 0x01, 0x02, 0x02, 0x05, 0x02, 0x02, 0x01, 0x02, 0x01, 0x06,
+	0x02, 0x02, 0x05, 0x02, 0x00, 0x07, 0x02, 0x02, 0x01, 0x02, 0x01, 0x06, 0x02, 0x02, 0x01, 0x02,
+	0x02, 0x05, 0x02, 0x02, 0x01, 0x02, 0x03, 0x04, 0x02, 0x02, 0x08, 0x02, 0x05, 0x02, 0x02, 0x02,
+	0x06, 0x00,
+	// @7432 0xB7 (3 pixels wide)
+	0x0E, 0x00, 0x01, 0x01, 0x01, 0x02, 0x02, 0x01, 0x00, 0x03, 0x01, 0x01, 0x01, 0x01, 0x0C, 0x00,
+	// @7448 0xB8 (4 pixels wide)
+	0x17, 0x00, 0x02, 0x01, 0x01, 0x02, 0x02, 0x01, 0x02, 0x02, 0x01, 0x01, 0x00, 0x04, 0x02, 0x00,
+	// @7464 0xB9 (4 pixels wide)
+	0x01, 0x00, 0x01, 0x01, 0x00, 0x04, 0x01, 0x02, 0x00, 0x01, 0x01, 0x02, 0x08, 0x01, 0x02, 0x02,
+	0x13, 0x00,
+	// @7482 0xBA (9 pixels wide)
+	0x07, 0x00, 0x01, 0x01, 0x03, 0x04, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x02, 0x01, 0x02,
+	0x04, 0x02, 0x01, 0x02, 0x01, 0x01, 0x05, 0x02, 0x01, 0x02, 0x00, 0x02, 0x05, 0x02, 0x01, 0x02,
+	0x01, 0x01, 0x05, 0x02, 0x01, 0x02, 0x01, 0x02, 0x04, 0x02, 0x01, 0x02, 0x02, 0x02, 0x01, 0x03,
+	0x01, 0x01, 0x03, 0x04, 0x0E, 0x00,
+	// @7536 0xBB (9 pixels wide)
+	0x0B, 0x00, 0x01, 0x02, 0x00, 0x02, 0x02, 0x02, 0x01, 0x02, 0x01, 0x01, 0x03, 0x02, 0x01, 0x02,
+	0x01, 0x02, 0x03, 0x02, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x03, 0x02, 0x02, 0x02,
+	0x01, 0x02, 0x02, 0x02, 0x03, 0x02, 0x01, 0x02, 0x02, 0x01, 0x03, 0x02, 0x01, 0x02, 0x01, 0x02,
+	0x02, 0x02, 0x01, 0x02, 0x00, 0x02, 0x03, 0x01, 0x09, 0x00,
+	// @7594 0xBC (19 pixels wide)
+	0x05, 0x00, 0x01, 0x02, 0x02, 0x02, 0x09, 0x01, 0x01, 0x02, 0x00, 0x04, 0x08, 0x02, 0x01, 0x03,
+	0x00, 0x01, 0x01, 0x02, 0x08, 0x01, 0x01, 0x02, 0x02, 0x02, 0x07, 0x02, 0x01, 0x02, 0x02, 0x02,
+	0x07, 0x01, 0x01, 0x02, 0x02, 0x02, 0x06, 0x01, 0x01, 0x02, 0x02, 0x02, 0x05, 0x02, 0x01, 0x03,
+	0x02, 0x02, 0x05, 0x01, 0x05, 0x02, 0x01, 0x03, 0x02, 0x02, 0x04, 0x02, 0x04, 0x03, 0x01, 0x03,
+	0x02, 0x02, 0x04, 0x01, 0x04, 0x04, 0x01, 0x04, 0x02, 0x02, 0x03, 0x02, 0x04, 0x01, 0x01, 0x02,
+	0x01, 0x03, 0x07, 0x01, 0x04, 0x01, 0x02, 0x02, 0x01, 0x03, 0x06, 0x02, 0x03, 0x02, 0x02, 0x02,
+	0x01, 0x03, 0x05, 0x02, 0x03, 0x02, 0x03, 0x02, 0x01, 0x02, 0x05, 0x01, 0x04, 0x09, 0x01, 0x02,
+	0x04, 0x02, 0x09, 0x02, 0x01, 0x02, 0x04, 0x01, 0x0A, 0x02, 0x01, 0x02, 0x03, 0x02, 0x0A, 0x02,
+	0x07, 0x00,
+	// @7724 0xBD (18 pixels wide)
+	0x05, 0x00, 0x01, 0x02, 0x02, 0x02, 0x08, 0x02, 0x01, 0x02, 0x00, 0x04, 0x08, 0x01, 0x01, 0x03,
+	0x00, 0x01, 0x01, 0x02, 0x07, 0x02, 0x01, 0x02, 0x02, 0x02, 0x07, 0x01, 0x01, 0x02, 0x02, 0x02,
+	0x06, 0x02, 0x01, 0x02, 0x02, 0x02, 0x05, 0x02, 0x01, 0x02, 0x02, 0x02, 0x05, 0x01, 0x01, 0x03,
+	0x02, 0x02, 0x04, 0x02, 0x03, 0x03, 0x01, 0x03, 0x02, 0x02, 0x04, 0x01, 0x02, 0x06, 0x01, 0x03,
+	0x02, 0x02, 0x03, 0x02, 0x07, 0x02, 0x01, 0x03, 0x02, 0x02, 0x03, 0x01, 0x08, 0x02, 0x01, 0x02,
+	0x06, 0x02, 0x08, 0x02, 0x01, 0x02, 0x05, 0x02, 0x08, 0x02, 0x01, 0x02, 0x05, 0x01, 0x09, 0x02,
+	0x01, 0x02, 0x04, 0x02, 0x08, 0x02, 0x01, 0x02, 0x04, 0x01, 0x07, 0x03, 0x01, 0x02, 0x03, 0x02,
+	0x06, 0x03, 0x01, 0x02, 0x03, 0x01, 0x07, 0x07, 0x07, 0x00,
+	// @7846 0xBE (19 pixels wide)
+	0x05, 0x00, 0x01, 0x02, 0x01, 0x04, 0x09, 0x01, 0x01, 0x02, 0x01, 0x05, 0x07, 0x02, 0x01, 0x02,
+	0x05, 0x02, 0x06, 0x01, 0x01, 0x02, 0x05, 0x02, 0x05, 0x02, 0x01, 0x02, 0x03, 0x03, 0x06, 0x01,
+	0x01, 0x02, 0x02, 0x04, 0x05, 0x01, 0x01, 0x02, 0x05, 0x02, 0x03, 0x02, 0x01, 0x03, 0x05, 0x02,
+	0x03, 0x01, 0x04, 0x02, 0x01, 0x03, 0x05, 0x02, 0x02, 0x02, 0x03, 0x03, 0x01, 0x04, 0x00, 0x02,
+	0x01, 0x04, 0x02, 0x01, 0x04, 0x03, 0x01, 0x03, 0x00, 0x05, 0x03, 0x02, 0x03, 0x04, 0x01, 0x03,
+	0x08, 0x01, 0x03, 0x02, 0x01, 0x02, 0x01, 0x03, 0x07, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x03,
+	0x06, 0x02, 0x03, 0x01, 0x03, 0x02, 0x01, 0x02, 0x06, 0x01, 0x03, 0x09, 0x01, 0x02, 0x05, 0x02,
+	0x08, 0x02, 0x01, 0x02, 0x05, 0x01, 0x09, 0x02, 0x01, 0x02, 0x04, 0x02, 0x09, 0x02, 0x07, 0x00,
+	// @7974 0xBF (9 pixels wide)
+	0x0A, 0x00, 0x03, 0x01, 0x04, 0x03, 0x02, 0x00, 0x04, 0x01, 0x04, 0x02, 0x01, 0x01, 0x03, 0x03,
+	0x01, 0x01, 0x02, 0x03, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x01, 0x03, 0x01, 0x01, 0x01, 0x02,
+	0x01, 0x01, 0x00, 0x03, 0x01, 0x01, 0x01, 0x02, 0x01, 0x02, 0x01, 0x03, 0x03, 0x01, 0x01, 0x01,
+	0x02, 0x07, 0x01, 0x01, 0x04, 0x03, 0x01, 0x00,
+	// @8030 0xC0 (15 pixels wide)
+	0x05, 0x00, 0x01, 0x01, 0x06, 0x03, 0x01, 0x01, 0x05, 0x04, 0x01, 0x01, 0x05, 0x05, 0x01, 0x02,
+	0x05, 0x02, 0x01, 0x02, 0x01, 0x02, 0x04, 0x02, 0x02, 0x02, 0x01, 0x02, 0x04, 0x02, 0x02, 0x03,
+	0x01, 0x02, 0x04, 0x02, 0x03, 0x02, 0x01, 0x02, 0x03, 0x02, 0x04, 0x02, 0x01, 0x02, 0x03, 0x02,
+	0x04, 0x03, 0x01, 0x02, 0x03, 0x02, 0x05, 0x02, 0x01, 0x01, 0x02, 0x0A, 0x01, 0x01, 0x02, 0x0B,
+	0x01, 0x02, 0x02, 0x02, 0x07, 0x02, 0x01, 0x02, 0x01, 0x03, 0x07, 0x02, 0x01, 0x02, 0x01, 0x02,
+	0x08, 0x03, 0x01, 0x02, 0x01, 0x02, 0x09, 0x02, 0x01, 0x02, 0x00, 0x03, 0x09, 0x02, 0x01, 0x02,
+	0x00, 0x02, 0x0A, 0x03, 0x07, 0x00,
+	// @8132 0xC1 (12 pixels wide)
+	0x05, 0x00, 0x02, 0x01, 0x00, 0x0A, 0x05, 0x01, 0x00, 0x02, 0x01, 0x01, 0x00, 0x09, 0x01, 0x02,
+	0x00, 0x02, 0x04, 0x04, 0x01, 0x02, 0x00, 0x02, 0x06, 0x03, 0x01, 0x02, 0x00, 0x02, 0x07, 0x02,
+	0x03, 0x02, 0x00, 0x02, 0x07, 0x03, 0x01, 0x02, 0x00, 0x02, 0x07, 0x02, 0x01, 0x02, 0x00, 0x02,
+	0x06, 0x03, 0x01, 0x01, 0x00, 0x0A, 0x01, 0x01, 0x00, 0x08, 0x07, 0x00,
+	// @8192 0xC2 (12 pixels wide)
+	0x05, 0x00, 0x01, 0x01, 0x00, 0x09, 0x01, 0x02, 0x00, 0x04, 0x01, 0x05, 0x04, 0x02, 0x00, 0x02,
+	0x06, 0x03, 0x01, 0x02, 0x00, 0x02, 0x06, 0x02, 0x01, 0x02, 0x00, 0x02, 0x03, 0x04, 0x01, 0x01,
+	0x00, 0x08, 0x01, 0x02, 0x00, 0x02, 0x04, 0x04, 0x01, 0x02, 0x00, 0x02, 0x06, 0x03, 0x01, 0x02,
+	0x00, 0x02, 0x07, 0x02, 0x01, 0x02, 0x00, 0x02, 0x07, 0x03, 0x02, 0x02, 0x00, 0x02, 0x07, 0x02,
+	0x01, 0x02, 0x00, 0x02, 0x06, 0x03, 0x01, 0x01, 0x00, 0x0A, 0x01, 0x01, 0x00, 0x08, 0x07, 0x00,
+	// @8272 0xC3 (10 pixels wide)
+	0x05, 0x00, 0x02, 0x01, 0x00, 0x0A, 0x10, 0x01, 0x00, 0x02, 0x07, 0x00,
+	// @8284 0xC4 (16 pixels wide)
+	0x05, 0x00, 0x02, 0x01, 0x04, 0x0B, 0x04, 0x02, 0x04, 0x03, 0x05, 0x03, 0x06, 0x02, 0x04, 0x02,
+	0x06, 0x03, 0x01, 0x02, 0x03, 0x03, 0x06, 0x03, 0x01, 0x02, 0x03, 0x02, 0x07, 0x03, 0x01, 0x02,
+	0x02, 0x03, 0x07, 0x03, 0x01, 0x02, 0x02, 0x02, 0x08, 0x03, 0x02, 0x01, 0x00, 0x10, 0x04, 0x02,
+	0x00, 0x02, 0x0C, 0x02, 0x03, 0x00,
+	// @8338 0xC5 (10 pixels wide)
+	0x05, 0x00, 0x02, 0x01, 0x00, 0x0A, 0x06, 0x01, 0x00, 0x02, 0x01, 0x01, 0x00, 0x09, 0x07, 0x01,
+	0x00, 0x02, 0x02, 0x01, 0x00, 0x0A, 0x07, 0x00,
+	// @8362 0xC6 (20 pixels wide)
+	0x05, 0x00, 0x01, 0x03, 0x00, 0x03, 0x06, 0x02, 0x06, 0x03, 0x01, 0x03, 0x01, 0x03, 0x05, 0x02,
+	0x05, 0x03, 0x01, 0x03, 0x02, 0x02, 0x05, 0x02, 0x04, 0x03, 0x01, 0x03, 0x02, 0x03, 0x04, 0x02,
+	0x04, 0x02, 0x01, 0x03, 0x03, 0x03, 0x03, 0x02, 0x03, 0x02, 0x01, 0x03, 0x04, 0x02, 0x03, 0x02,
+	0x02, 0x03, 0x01, 0x03, 0x05, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x03, 0x05, 0x03, 0x01, 0x02,
+	0x01, 0x02, 0x01, 0x01, 0x05, 0x0A, 0x01, 0x01, 0x03, 0x0E, 0x01, 0x03, 0x02, 0x03, 0x04, 0x02,
+	0x04, 0x02, 0x01, 0x03, 0x02, 0x02, 0x05, 0x02, 0x04, 0x03, 0x01, 0x03, 0x01, 0x03, 0x05, 0x02,
+	0x05, 0x02, 0x01, 0x03, 0x01, 0x02, 0x06, 0x02, 0x05, 0x03, 0x01, 0x03, 0x01, 0x02, 0x06, 0x02,
+	0x06, 0x02, 0x01, 0x03, 0x00, 0x03, 0x06, 0x02, 0x06, 0x02, 0x01, 0x03, 0x00, 0x02, 0x07, 0x02,
+	0x06, 0x03, 0x01, 0x03, 0x00, 0x02, 0x07, 0x02, 0x07, 0x02, 0x07, 0x00,
+	// @8502 0xC7 (11 pixels wide)
+	0x05, 0x00, 0x01, 0x01, 0x01, 0x08, 0x01, 0x02, 0x01, 0x03, 0x02, 0x04, 0x01, 0x01, 0x07, 0x03,
+	0x03, 0x01, 0x08, 0x02, 0x01, 0x01, 0x07, 0x03, 0x01, 0x01, 0x05, 0x04, 0x01, 0x01, 0x03, 0x04,
+	0x01, 0x01, 0x05, 0x05, 0x01, 0x01, 0x08, 0x02, 0x01, 0x01, 0x08, 0x03, 0x02, 0x01, 0x09, 0x02,
+	0x01, 0x01, 0x08, 0x03, 0x01, 0x02, 0x00, 0x01, 0x07, 0x03, 0x01, 0x01, 0x00, 0x0A, 0x01, 0x01,
+	0x01, 0x07, 0x07, 0x00,
+	// @8570 0xC8 (14 pixels wide)
+	0x05, 0x00, 0x01, 0x02, 0x00, 0x02, 0x09, 0x03, 0x02, 0x02, 0x00, 0x02, 0x08, 0x04, 0x01, 0x03,
+	0x00, 0x02, 0x07, 0x02, 0x01, 0x02, 0x01, 0x03, 0x00, 0x02, 0x06, 0x03, 0x01, 0x02, 0x01, 0x03,
+	0x00, 0x02, 0x06, 0x02, 0x02, 0x02, 0x01, 0x03, 0x00, 0x02, 0x05, 0x03, 0x02, 0x02, 0x01, 0x03,
+	0x00, 0x02, 0x05, 0x02, 0x03, 0x02, 0x01, 0x03, 0x00, 0x02, 0x04, 0x03, 0x03, 0x02, 0x01, 0x03,
+	0x00, 0x02, 0x03, 0x03, 0x04, 0x02, 0x01, 0x03, 0x00, 0x02, 0x03, 0x02, 0x04, 0x03, 0x01, 0x03,
+	0x00, 0x02, 0x02, 0x03, 0x04, 0x03, 0x01, 0x03, 0x00, 0x02, 0x02, 0x02, 0x05, 0x03, 0x01, 0x03,
+	0x00, 0x02, 0x01, 0x02, 0x06, 0x03, 0x01, 0x02, 0x00, 0x05, 0x06, 0x03, 0x02, 0x02, 0x00, 0x04,
+	0x07, 0x03, 0x01, 0x02, 0x00, 0x03, 0x08, 0x03, 0x07, 0x00,
+	// @8692 0xC9 (14 pixels wide)
+	0x01, 0x00, 0x01, 0x02, 0x04, 0x01, 0x03, 0x02, 0x01, 0x02, 0x04, 0x02, 0x02, 0x02, 0x01, 0x01,
+	0x05, 0x04, 0x01, 0x00, 0x01, 0x02, 0x00, 0x02, 0x09, 0x03, 0x02, 0x02, 0x00, 0x02, 0x08, 0x04,
+	0x01, 0x03, 0x00, 0x02, 0x07, 0x02, 0x01, 0x02, 0x01, 0x03, 0x00, 0x02, 0x06, 0x03, 0x01, 0x02,
+	0x01, 0x03, 0x00, 0x02, 0x06, 0x02, 0x02, 0x02, 0x01, 0x03, 0x00, 0x02, 0x05, 0x03, 0x02, 0x02,
+	0x01, 0x03, 0x00, 0x02, 0x05, 0x02, 0x03, 0x02, 0x01, 0x03, 0x00, 0x02, 0x04, 0x03, 0x03, 0x02,
+	0x01, 0x03, 0x00, 0x02, 0x03, 0x03, 0x04, 0x02, 0x01, 0x03, 0x00, 0x02, 0x03, 0x02, 0x04, 0x03,
+	0x01, 0x03, 0x00, 0x02, 0x02, 0x03, 0x04, 0x03, 0x01, 0x03, 0x00, 0x02, 0x02, 0x02, 0x05, 0x03,
+	0x01, 0x03, 0x00, 0x02, 0x01, 0x02, 0x06, 0x03, 0x01, 0x02, 0x00, 0x05, 0x06, 0x03, 0x02, 0x02,
+	0x00, 0x04, 0x07, 0x03, 0x01, 0x02, 0x00, 0x03, 0x08, 0x03, 0x07, 0x00,
+	// @8832 0xCA (12 pixels wide)
+	0x05, 0x00, 0x01, 0x02, 0x00, 0x02, 0x07, 0x03, 0x01, 0x02, 0x00, 0x02, 0x06, 0x03, 0x01, 0x02,
+	0x00, 0x02, 0x05, 0x03, 0x01, 0x02, 0x00, 0x02, 0x05, 0x02, 0x01, 0x02, 0x00, 0x02, 0x04, 0x02,
+	0x01, 0x02, 0x00, 0x02, 0x03, 0x02, 0x01, 0x02, 0x00, 0x02, 0x02, 0x03, 0x01, 0x02, 0x00, 0x02,
+	0x01, 0x03, 0x01, 0x01, 0x00, 0x07, 0x01, 0x01, 0x00, 0x08, 0x01, 0x02, 0x00, 0x02, 0x04, 0x03,
+	0x01, 0x02, 0x00, 0x02, 0x05, 0x03, 0x01, 0x02, 0x00, 0x02, 0x06, 0x02, 0x02, 0x02, 0x00, 0x02,
+	0x06, 0x03, 0x01, 0x02, 0x00, 0x02, 0x07, 0x02, 0x01, 0x02, 0x00, 0x02, 0x07, 0x03, 0x01, 0x02,
+	0x00, 0x02, 0x08, 0x02, 0x07, 0x00,
+	// @8934 0xCB (14 pixels wide)
+	0x05, 0x00, 0x02, 0x01, 0x03, 0x0B, 0x09, 0x02, 0x03, 0x03, 0x06, 0x02, 0x03, 0x02, 0x03, 0x02,
+	0x07, 0x02, 0x01, 0x02, 0x02, 0x03, 0x07, 0x02, 0x01, 0x02, 0x02, 0x02, 0x08, 0x02, 0x01, 0x02,
+	0x00, 0x04, 0x08, 0x02, 0x01, 0x02, 0x00, 0x03, 0x09, 0x02, 0x07, 0x00,
+	// @8978 0xCC (18 pixels wide)
+	0x05, 0x00, 0x01, 0x02, 0x01, 0x03, 0x0A, 0x03, 0x01, 0x02, 0x01, 0x03, 0x09, 0x04, 0x02, 0x02,
+	0x01, 0x04, 0x08, 0x04, 0x01, 0x03, 0x01, 0x04, 0x07, 0x02, 0x01, 0x02, 0x01, 0x04, 0x00, 0x03,
+	0x01, 0x02, 0x06, 0x02, 0x01, 0x02, 0x01, 0x04, 0x00, 0x02, 0x02, 0x02, 0x06, 0x02, 0x01, 0x02,
+	0x01, 0x04, 0x00, 0x02, 0x02, 0x03, 0x04, 0x02, 0x02, 0x02, 0x01, 0x04, 0x00, 0x02, 0x03, 0x02,
+	0x04, 0x02, 0x02, 0x03, 0x01, 0x04, 0x00, 0x02, 0x03, 0x02, 0x03, 0x03, 0x02, 0x03, 0x01, 0x04,
+	0x00, 0x02, 0x03, 0x03, 0x02, 0x02, 0x03, 0x03, 0x01, 0x04, 0x00, 0x02, 0x04, 0x02, 0x02, 0x02,
+	0x03, 0x03, 0x02, 0x04, 0x00, 0x02, 0x04, 0x02, 0x01, 0x02, 0x05, 0x02, 0x01, 0x03, 0x00, 0x02,
+	0x05, 0x04, 0x05, 0x02, 0x02, 0x03, 0x00, 0x02, 0x05, 0x03, 0x06, 0x02, 0x01, 0x03, 0x00, 0x02,
+	0x06, 0x02, 0x06, 0x02, 0x07, 0x00,
+	// @9112 0xCD (14 pixels wide)
+	0x05, 0x00, 0x07, 0x02, 0x00, 0x02, 0x09, 0x03, 0x02, 0x01, 0x00, 0x0E, 0x09, 0x02, 0x00, 0x02,
+	0x09, 0x03, 0x07, 0x00,
+	// @9132 0xCE (17 pixels wide)
+	0x05, 0x00, 0x01, 0x01, 0x04, 0x08, 0x01, 0x02, 0x03, 0x04, 0x02, 0x05, 0x01, 0x02, 0x02, 0x03,
+	0x07, 0x03, 0x01, 0x02, 0x01, 0x03, 0x08, 0x03, 0x01, 0x02, 0x01, 0x02, 0x0A, 0x03, 0x02, 0x02,
+	0x00, 0x03, 0x0B, 0x02, 0x01, 0x02, 0x00, 0x03, 0x0B, 0x03, 0x02, 0x02, 0x00, 0x02, 0x0C, 0x03,
+	0x03, 0x02, 0x00, 0x03, 0x0B, 0x02, 0x01, 0x02, 0x01, 0x03, 0x09, 0x03, 0x01, 0x02, 0x01, 0x03,
+	0x08, 0x03, 0x01, 0x02, 0x02, 0x03, 0x06, 0x03, 0x01, 0x01, 0x03, 0x0A, 0x01, 0x01, 0x05, 0x07,
+	0x07, 0x00,
+	// @9214 0xCF (13 pixels wide)
+	0x05, 0x00, 0x02, 0x01, 0x00, 0x0D, 0x10, 0x02, 0x00, 0x02, 0x09, 0x02, 0x07, 0x00,
+	// @9228 0xD0 (11 pixels wide)
+	0x05, 0x00, 0x01, 0x01, 0x00, 0x09, 0x01, 0x01, 0x00, 0x0A, 0x01, 0x02, 0x00, 0x02, 0x06, 0x03,
+	0x04, 0x02, 0x00, 0x02, 0x07, 0x02, 0x01, 0x02, 0x00, 0x02, 0x06, 0x03, 0x01, 0x02, 0x00, 0x02,
+	0x05, 0x03, 0x01, 0x01, 0x00, 0x09, 0x01, 0x01, 0x00, 0x07, 0x07, 0x01, 0x00, 0x02, 0x07, 0x00,
+	// @9276 0xD1 (14 pixels wide)
+	0x05, 0x00, 0x01, 0x01, 0x05, 0x09, 0x01, 0x01, 0x03, 0x0A, 0x01, 0x01, 0x02, 0x04, 0x01, 0x01,
+	0x02, 0x02, 0x01, 0x01, 0x01, 0x03, 0x01, 0x01, 0x01, 0x02, 0x02, 0x01, 0x00, 0x03, 0x02, 0x01,
+	0x00, 0x02, 0x03, 0x01, 0x00, 0x03, 0x02, 0x01, 0x01, 0x03, 0x01, 0x01, 0x02, 0x04, 0x01, 0x01,
+	0x03, 0x0B, 0x01, 0x01, 0x05, 0x09, 0x07, 0x00,
+	// @9332 0xD2 (13 pixels wide)
+	0x05, 0x00, 0x02, 0x01, 0x00, 0x0D, 0x10, 0x01, 0x06, 0x02, 0x07, 0x00,
+	// @9344 0xD3 (14 pixels wide)
+	0x05, 0x00, 0x01, 0x02, 0x00, 0x03, 0x08, 0x03, 0x02, 0x02, 0x01, 0x03, 0x07, 0x02, 0x01, 0x02,
+	0x02, 0x02, 0x06, 0x03, 0x01, 0x02, 0x02, 0x03, 0x05, 0x02, 0x01, 0x02, 0x03, 0x02, 0x05, 0x02,
+	0x01, 0x02, 0x03, 0x03, 0x03, 0x02, 0x01, 0x02, 0x04, 0x02, 0x03, 0x02, 0x01, 0x02, 0x04, 0x03,
+	0x02, 0x02, 0x01, 0x02, 0x05, 0x02, 0x01, 0x02, 0x01, 0x01, 0x05, 0x05, 0x02, 0x01, 0x06, 0x03,
+	0x01, 0x01, 0x06, 0x02, 0x01, 0x01, 0x05, 0x03, 0x01, 0x01, 0x05, 0x02, 0x01, 0x01, 0x02, 0x05,
+	0x01, 0x01, 0x02, 0x03, 0x07, 0x00,
+	// @9430 0xD4 (18 pixels wide)
+	0x04, 0x00, 0x02, 0x01, 0x08, 0x02, 0x01, 0x01, 0x04, 0x09, 0x01, 0x03, 0x03, 0x04, 0x01, 0x02,
+	0x01, 0x04, 0x01, 0x03, 0x02, 0x03, 0x03, 0x02, 0x03, 0x03, 0x01, 0x03, 0x01, 0x03, 0x04, 0x02,
+	0x04, 0x03, 0x01, 0x03, 0x01, 0x02, 0x05, 0x02, 0x05, 0x02, 0x01, 0x03, 0x00, 0x03, 0x05, 0x02,
+	0x05, 0x02, 0x03, 0x03, 0x00, 0x02, 0x06, 0x02, 0x05, 0x03, 0x01, 0x03, 0x00, 0x03, 0x05, 0x02,
+	0x05, 0x03, 0x01, 0x03, 0x00, 0x03, 0x05, 0x02, 0x05, 0x02, 0x01, 0x03, 0x01, 0x02, 0x05, 0x02,
+	0x04, 0x03, 0x01, 0x03, 0x01, 0x03, 0x04, 0x02, 0x04, 0x02, 0x01, 0x03, 0x02, 0x03, 0x03, 0x02,
+	0x03, 0x03, 0x01, 0x01, 0x03, 0x0C, 0x01, 0x01, 0x05, 0x08, 0x02, 0x01, 0x08, 0x02, 0x06, 0x00,
+	// @9542 0xD5 (13 pixels wide)
+	0x05, 0x00, 0x01, 0x02, 0x00, 0x03, 0x07, 0x03, 0x01, 0x02, 0x01, 0x03, 0x06, 0x03, 0x01, 0x02,
+	0x01, 0x03, 0x05, 0x03, 0x01, 0x02, 0x02, 0x03, 0x04, 0x02, 0x01, 0x02, 0x03, 0x02, 0x03, 0x03,
+	0x01, 0x02, 0x03, 0x03, 0x02, 0x02, 0x01, 0x02, 0x04, 0x02, 0x01, 0x02, 0x01, 0x01, 0x04, 0x05,
+	0x01, 0x01, 0x05, 0x03, 0x01, 0x01, 0x05, 0x04, 0x01, 0x02, 0x04, 0x02, 0x01, 0x02, 0x01, 0x02,
+	0x04, 0x02, 0x01, 0x03, 0x01, 0x02, 0x03, 0x02, 0x03, 0x02, 0x01, 0x02, 0x02, 0x03, 0x03, 0x03,
+	0x01, 0x02, 0x02, 0x02, 0x05, 0x03, 0x01, 0x02, 0x01, 0x03, 0x06, 0x02, 0x01, 0x02, 0x01, 0x02,
+	0x07, 0x03, 0x01, 0x02, 0x00, 0x03, 0x08, 0x02, 0x07, 0x00,
+	// @9648 0xD6 (15 pixels wide)
+	0x05, 0x00, 0x10, 0x02, 0x00, 0x02, 0x09, 0x02, 0x02, 0x01, 0x00, 0x0F, 0x04, 0x01, 0x0D, 0x02,
+	0x03, 0x00,
+	// @9666 0xD7 (12 pixels wide)
+	0x05, 0x00, 0x07, 0x02, 0x00, 0x02, 0x08, 0x02, 0x02, 0x02, 0x00, 0x03, 0x07, 0x02, 0x01, 0x02,
+	0x01, 0x04, 0x02, 0x05, 0x01, 0x02, 0x02, 0x07, 0x01, 0x02, 0x07, 0x01, 0x0A, 0x02, 0x07, 0x00,
+	// @9698 0xD8 (19 pixels wide)
+	0x05, 0x00, 0x10, 0x03, 0x00, 0x02, 0x06, 0x03, 0x06, 0x02, 0x02, 0x01, 0x00, 0x13, 0x07, 0x00,
+	// @9714 0xD9 (20 pixels wide)
+	0x05, 0x00, 0x10, 0x03, 0x00, 0x02, 0x06, 0x03, 0x06, 0x02, 0x02, 0x01, 0x00, 0x14, 0x04, 0x01,
+	0x12, 0x02, 0x03, 0x00,
+	// @9734 0xDA (16 pixels wide)
+	0x05, 0x00, 0x02, 0x01, 0x00, 0x07, 0x04, 0x01, 0x05, 0x02, 0x01, 0x02, 0x05, 0x02, 0x01, 0x02,
+	0x01, 0x01, 0x05, 0x08, 0x01, 0x02, 0x05, 0x02, 0x03, 0x05, 0x01, 0x02, 0x05, 0x02, 0x05, 0x03,
+	0x02, 0x02, 0x05, 0x02, 0x06, 0x03, 0x01, 0x02, 0x05, 0x02, 0x07, 0x02, 0x02, 0x02, 0x05, 0x02,
+	0x06, 0x03, 0x01, 0x02, 0x05, 0x02, 0x05, 0x03, 0x01, 0x01, 0x05, 0x09, 0x01, 0x01, 0x05, 0x07,
+	0x07, 0x00,
+	// @9800 0xDB (16 pixels wide)
+	0x05, 0x00, 0x06, 0x02, 0x00, 0x02, 0x0C, 0x02, 0x01, 0x03, 0x00, 0x02, 0x02, 0x01, 0x09, 0x02,
+	0x01, 0x02, 0x00, 0x09, 0x05, 0x02, 0x01, 0x03, 0x00, 0x02, 0x04, 0x04, 0x04, 0x02, 0x01, 0x03,
+	0x00, 0x02, 0x06, 0x03, 0x03, 0x02, 0x01, 0x03, 0x00, 0x02, 0x07, 0x02, 0x03, 0x02, 0x02, 0x03,
+	0x00, 0x02, 0x07, 0x03, 0x02, 0x02, 0x01, 0x03, 0x00, 0x02, 0x07, 0x02, 0x03, 0x02, 0x01, 0x03,
+	0x00, 0x02, 0x06, 0x03, 0x03, 0x02, 0x01, 0x03, 0x00, 0x02, 0x05, 0x04, 0x03, 0x02, 0x01, 0x02,
+	0x00, 0x0A, 0x04, 0x02, 0x01, 0x02, 0x00, 0x08, 0x06, 0x02, 0x07, 0x00,
+	// @9892 0xDC (12 pixels wide)
+	0x05, 0x00, 0x06, 0x01, 0x00, 0x02, 0x01, 0x02, 0x00, 0x02, 0x01, 0x02, 0x01, 0x01, 0x00, 0x09,
+	0x01, 0x02, 0x00, 0x02, 0x04, 0x04, 0x01, 0x02, 0x00, 0x02, 0x06, 0x03, 0x01, 0x02, 0x00, 0x02,
+	0x07, 0x02, 0x03, 0x02, 0x00, 0x02, 0x07, 0x03, 0x01, 0x02, 0x00, 0x02, 0x07, 0x02, 0x01, 0x02,
+	0x00, 0x02, 0x06, 0x03, 0x01, 0x01, 0x00, 0x0A, 0x01, 0x01, 0x00, 0x08, 0x07, 0x00,
+	// @9954 0xDD (13 pixels wide)
+	0x05, 0x00, 0x01, 0x01, 0x00, 0x09, 0x01, 0x02, 0x00, 0x04, 0x01, 0x05, 0x01, 0x01, 0x08, 0x03,
+	0x01, 0x01, 0x09, 0x03, 0x02, 0x01, 0x0A, 0x03, 0x02, 0x01, 0x0B, 0x02, 0x02, 0x01, 0x02, 0x0B,
+	0x02, 0x01, 0x0B, 0x02, 0x01, 0x01, 0x0A, 0x03, 0x01, 0x01, 0x0A, 0x02, 0x01, 0x01, 0x09, 0x03,
+	0x01, 0x01, 0x08, 0x03, 0x01, 0x01, 0x00, 0x0A, 0x01, 0x01, 0x00, 0x08, 0x07, 0x00,
+	// @10016 0xDE (20 pixels wide)
+	0x05, 0x00, 0x01, 0x02, 0x00, 0x02, 0x07, 0x08, 0x01, 0x03, 0x00, 0x02, 0x06, 0x04, 0x02, 0x04,
+	0x01, 0x03, 0x00, 0x02, 0x05, 0x03, 0x06, 0x03, 0x01, 0x03, 0x00, 0x02, 0x04, 0x03, 0x08, 0x02,
+	0x01, 0x03, 0x00, 0x02, 0x04, 0x02, 0x09, 0x03, 0x02, 0x03, 0x00, 0x02, 0x03, 0x03, 0x0A, 0x02,
+	0x01, 0x03, 0x00, 0x02, 0x03, 0x02, 0x0B, 0x02, 0x02, 0x02, 0x00, 0x07, 0x0B, 0x02, 0x01, 0x03,
+	0x00, 0x02, 0x03, 0x02, 0x0B, 0x02, 0x01, 0x03, 0x00, 0x02, 0x03, 0x03, 0x0A, 0x02, 0x01, 0x03,
+	0x00, 0x02, 0x03, 0x03, 0x09, 0x03, 0x01, 0x03, 0x00, 0x02, 0x04, 0x02, 0x09, 0x03, 0x01, 0x03,
+	0x00, 0x02, 0x04, 0x03, 0x07, 0x03, 0x01, 0x03, 0x00, 0x02, 0x05, 0x03, 0x05, 0x03, 0x01, 0x02,
+	0x00, 0x02, 0x06, 0x0A, 0x01, 0x02, 0x00, 0x02, 0x07, 0x07, 0x07, 0x00,
+	// @10140 0xDF (12 pixels wide)
+	0x05, 0x00, 0x01, 0x01, 0x03, 0x09, 0x01, 0x01, 0x02, 0x0A, 0x01, 0x02, 0x01, 0x03, 0x05, 0x03,
+	0x01, 0x02, 0x01, 0x02, 0x06, 0x03, 0x02, 0x02, 0x00, 0x03, 0x06, 0x03, 0x01, 0x02, 0x01, 0x02,
+	0x06, 0x03, 0x01, 0x02, 0x01, 0x03, 0x05, 0x03, 0x01, 0x01, 0x02, 0x0A, 0x01, 0x01, 0x04, 0x08,
+	0x01, 0x02, 0x03, 0x03, 0x03, 0x03, 0x01, 0x02, 0x02, 0x03, 0x04, 0x03, 0x02, 0x02, 0x01, 0x03,
+	0x05, 0x03, 0x01, 0x02, 0x01, 0x02, 0x06, 0x03, 0x02, 0x02, 0x00, 0x03, 0x06, 0x03, 0x01, 0x02,
+	0x00, 0x02, 0x07, 0x03, 0x07, 0x00,
+	// @10226 0xE0 (10 pixels wide)
+	0x0A, 0x00, 0x01, 0x01, 0x01, 0x07, 0x01, 0x02, 0x01, 0x03, 0x02, 0x03, 0x01, 0x01, 0x07, 0x03,
+	0x02, 0x01, 0x08, 0x02, 0x01, 0x01, 0x03, 0x07, 0x01, 0x02, 0x01, 0x04, 0x03, 0x02, 0x01, 0x02,
+	0x00, 0x03, 0x05, 0x02, 0x02, 0x02, 0x00, 0x02, 0x06, 0x02, 0x01, 0x02, 0x00, 0x03, 0x04, 0x03,
+	0x01, 0x02, 0x00, 0x04, 0x01, 0x05, 0x01, 0x02, 0x01, 0x06, 0x01, 0x02, 0x07, 0x00,
+	// @10288 0xE1 (12 pixels wide)
+	0x04, 0x00, 0x01, 0x01, 0x06, 0x05, 0x01, 0x01, 0x04, 0x07, 0x01, 0x01, 0x03, 0x03, 0x01, 0x01,
+	0x02, 0x02, 0x02, 0x01, 0x01, 0x02, 0x01, 0x02, 0x01, 0x01, 0x02, 0x05, 0x01, 0x02, 0x00, 0x02,
+	0x01, 0x08, 0x01, 0x02, 0x00, 0x04, 0x04, 0x03, 0x01, 0x02, 0x00, 0x03, 0x06, 0x03, 0x04, 0x02,
+	0x00, 0x03, 0x07, 0x02, 0x01, 0x02, 0x01, 0x02, 0x07, 0x02, 0x01, 0x02, 0x01, 0x02, 0x06, 0x03,
+	0x01, 0x02, 0x01, 0x03, 0x05, 0x02, 0x01, 0x02, 0x02, 0x04, 0x01, 0x04, 0x01, 0x01, 0x03, 0x06,
+	0x07, 0x00,
+	// @10370 0xE2 (10 pixels wide)
+	0x0A, 0x00, 0x01, 0x01, 0x00, 0x08, 0x01, 0x02, 0x00, 0x02, 0x03, 0x04, 0x01, 0x02, 0x00, 0x02,
+	0x05, 0x03, 0x01, 0x02, 0x00, 0x02, 0x06, 0x02, 0x01, 0x02, 0x00, 0x02, 0x05, 0x02, 0x02, 0x01,
+	0x00, 0x09, 0x01, 0x02, 0x00, 0x02, 0x05, 0x03, 0x03, 0x02, 0x00, 0x02, 0x06, 0x02, 0x01, 0x02,
+	0x00, 0x03, 0x02, 0x05, 0x01, 0x01, 0x00, 0x08, 0x07, 0x00,
+	// @10428 0xE3 (8 pixels wide)
+	0x0A, 0x00, 0x02, 0x01, 0x00, 0x08, 0x0B, 0x01, 0x00, 0x02, 0x07, 0x00,
+	// @10440 0xE4 (13 pixels wide)
+	0x0A, 0x00, 0x02, 0x01, 0x03, 0x09, 0x07, 0x02, 0x03, 0x02, 0x05, 0x02, 0x01, 0x02, 0x02, 0x03,
+	0x05, 0x02, 0x01, 0x02, 0x02, 0x02, 0x06, 0x02, 0x02, 0x01, 0x00, 0x0D, 0x04, 0x02, 0x00, 0x02,
+	0x09, 0x02, 0x03, 0x00,
+	// @10476 0xE5 (12 pixels wide)
+	0x0A, 0x00, 0x01, 0x01, 0x03, 0x06, 0x01, 0x02, 0x02, 0x03, 0x02, 0x03, 0x01, 0x02, 0x01, 0x02,
+	0x05, 0x03, 0x01, 0x02, 0x01, 0x02, 0x06, 0x02, 0x01, 0x02, 0x00, 0x02, 0x07, 0x02, 0x02, 0x01,
+	0x00, 0x0C, 0x01, 0x01, 0x00, 0x02, 0x01, 0x01, 0x00, 0x03, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01,
+	0x01, 0x03, 0x01, 0x01, 0x02, 0x09, 0x01, 0x01, 0x03, 0x08, 0x07, 0x00,
+	// @10536 0xE6 (18 pixels wide)
+	0x0A, 0x00, 0x01, 0x03, 0x01, 0x03, 0x04, 0x02, 0x05, 0x02, 0x01, 0x03, 0x02, 0x02, 0x04, 0x02,
+	0x04, 0x02, 0x01, 0x03, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x01, 0x03, 0x03, 0x03, 0x02, 0x02,
+	0x02, 0x03, 0x01, 0x03, 0x04, 0x03, 0x01, 0x02, 0x01, 0x03, 0x01, 0x03, 0x05, 0x02, 0x01, 0x02,
+	0x01, 0x02, 0x01, 0x01, 0x04, 0x0A, 0x01, 0x03, 0x03, 0x03, 0x02, 0x02, 0x02, 0x03, 0x01, 0x03,
+	0x02, 0x03, 0x03, 0x02, 0x03, 0x03, 0x01, 0x03, 0x02, 0x02, 0x04, 0x02, 0x04, 0x02, 0x01, 0x03,
+	0x01, 0x03, 0x04, 0x02, 0x04, 0x03, 0x01, 0x03, 0x01, 0x02, 0x05, 0x02, 0x05, 0x02, 0x01, 0x03,
+	0x00, 0x03, 0x05, 0x02, 0x05, 0x03, 0x07, 0x00,
+	// @10640 0xE7 (10 pixels wide)
+	0x0A, 0x00, 0x01, 0x01, 0x01, 0x07, 0x01, 0x02, 0x01, 0x02, 0x02, 0x04, 0x01, 0x01, 0x06, 0x03,
+	0x01, 0x01, 0x07, 0x02, 0x01, 0x01, 0x06, 0x03, 0x02, 0x01, 0x02, 0x06, 0x01, 0x01, 0x06, 0x03,
+	0x02, 0x01, 0x07, 0x03, 0x01, 0x01, 0x07, 0x02, 0x01, 0x02, 0x00, 0x03, 0x01, 0x05, 0x01, 0x01,
+	0x00, 0x08, 0x07, 0x00,
+	// @10692 0xE8 (11 pixels wide)
+	0x0A, 0x00, 0x01, 0x02, 0x00, 0x02, 0x06, 0x03, 0x02, 0x02, 0x00, 0x02, 0x05, 0x04, 0x02, 0x03,
+	0x00, 0x02, 0x04, 0x02, 0x01, 0x02, 0x01, 0x03, 0x00, 0x02, 0x03, 0x02, 0x02, 0x02, 0x01, 0x03,
+	0x00, 0x02, 0x02, 0x03, 0x02, 0x02, 0x01, 0x03, 0x00, 0x02, 0x02, 0x02, 0x03, 0x02, 0x02, 0x03,
+	0x00, 0x02, 0x01, 0x02, 0x04, 0x02, 0x02, 0x02, 0x00, 0x04, 0x05, 0x02, 0x01, 0x02, 0x00, 0x03,
+	0x06, 0x02, 0x07, 0x00,
+	// @10760 0xE9 (11 pixels wide)
+	0x05, 0x00, 0x01, 0x02, 0x02, 0x02, 0x03, 0x02, 0x01, 0x02, 0x02, 0x03, 0x01, 0x02, 0x01, 0x01,
+	0x03, 0x04, 0x02, 0x00, 0x01, 0x02, 0x00, 0x02, 0x06, 0x03, 0x02, 0x02, 0x00, 0x02, 0x05, 0x04,
+	0x02, 0x03, 0x00, 0x02, 0x04, 0x02, 0x01, 0x02, 0x01, 0x03, 0x00, 0x02, 0x03, 0x02, 0x02, 0x02,
+	0x01, 0x03, 0x00, 0x02, 0x02, 0x03, 0x02, 0x02, 0x01, 0x03, 0x00, 0x02, 0x02, 0x02, 0x03, 0x02,
+	0x02, 0x03, 0x00, 0x02, 0x01, 0x02, 0x04, 0x02, 0x02, 0x02, 0x00, 0x04, 0x05, 0x02, 0x01, 0x02,
+	0x00, 0x03, 0x06, 0x02, 0x07, 0x00,
+	// @10846 0xEA (11 pixels wide)
+	0x0A, 0x00, 0x01, 0x02, 0x00, 0x02, 0x05, 0x03, 0x01, 0x02, 0x00, 0x02, 0x04, 0x03, 0x01, 0x02,
+	0x00, 0x02, 0x04, 0x02, 0x01, 0x02, 0x00, 0x02, 0x03, 0x02, 0x01, 0x02, 0x00, 0x02, 0x02, 0x02,
+	0x01, 0x02, 0x00, 0x02, 0x01, 0x02, 0x01, 0x01, 0x00, 0x07, 0x01, 0x02, 0x00, 0x02, 0x02, 0x04,
+	0x01, 0x02, 0x00, 0x02, 0x04, 0x03, 0x01, 0x02, 0x00, 0x02, 0x05, 0x02, 0x01, 0x02, 0x00, 0x02,
+	0x05, 0x03, 0x01, 0x02, 0x00, 0x02, 0x06, 0x02, 0x01, 0x02, 0x00, 0x02, 0x06, 0x03, 0x07, 0x00,
+	// @10926 0xEB (12 pixels wide)
+	0x0A, 0x00, 0x02, 0x01, 0x03, 0x09, 0x07, 0x02, 0x03, 0x02, 0x04, 0x03, 0x01, 0x02, 0x02, 0x03,
+	0x04, 0x03, 0x01, 0x02, 0x02, 0x02, 0x05, 0x03, 0x01, 0x02, 0x00, 0x04, 0x05, 0x03, 0x01, 0x02,
+	0x00, 0x03, 0x06, 0x03, 0x07, 0x00,
+	// @10964 0xEC (15 pixels wide)
+	0x0A, 0x00, 0x01, 0x02, 0x01, 0x03, 0x07, 0x03, 0x01, 0x02, 0x01, 0x04, 0x06, 0x03, 0x02, 0x02,
+	0x01, 0x04, 0x05, 0x04, 0x01, 0x04, 0x01, 0x02, 0x01, 0x02, 0x04, 0x01, 0x01, 0x03, 0x02, 0x04,
+	0x01, 0x02, 0x01, 0x02, 0x03, 0x02, 0x02, 0x02, 0x01, 0x04, 0x01, 0x02, 0x02, 0x02, 0x02, 0x01,
+	0x03, 0x02, 0x02, 0x04, 0x00, 0x03, 0x02, 0x02, 0x01, 0x02, 0x03, 0x02, 0x02, 0x03, 0x00, 0x02,
+	0x04, 0x03, 0x04, 0x02, 0x01, 0x03, 0x00, 0x02, 0x04, 0x02, 0x05, 0x02, 0x07, 0x00,
+	// @11042 0xED (11 pixels wide)
+	0x0A, 0x00, 0x05, 0x02, 0x00, 0x02, 0x06, 0x03, 0x02, 0x01, 0x00, 0x0B, 0x06, 0x02, 0x00, 0x02,
+	0x06, 0x03, 0x07, 0x00,
+	// @11062 0xEE (13 pixels wide)
+	0x0A, 0x00, 0x01, 0x01, 0x03, 0x07, 0x01, 0x02, 0x02, 0x04, 0x01, 0x04, 0x01, 0x02, 0x01, 0x03,
+	0x05, 0x03, 0x01, 0x02, 0x01, 0x02, 0x07, 0x02, 0x02, 0x02, 0x00, 0x03, 0x07, 0x03, 0x01, 0x02,
+	0x00, 0x02, 0x08, 0x03, 0x02, 0x02, 0x00, 0x03, 0x07, 0x03, 0x01, 0x02, 0x01, 0x02, 0x07, 0x02,
+	0x01, 0x02, 0x01, 0x03, 0x05, 0x03, 0x01, 0x02, 0x02, 0x04, 0x01, 0x04, 0x01, 0x01, 0x03, 0x07,
+	0x07, 0x00,
+	// @11128 0xEF (11 pixels wide)
+	0x0A, 0x00, 0x02, 0x01, 0x00, 0x0B, 0x0B, 0x02, 0x00, 0x02, 0x06, 0x03, 0x07, 0x00,
+	// @11142 0xF0 (12 pixels wide)
+	0x0A, 0x00, 0x01, 0x02, 0x00, 0x02, 0x02, 0x06, 0x01, 0x02, 0x00, 0x02, 0x01, 0x08, 0x01, 0x02,
+	0x00, 0x04, 0x05, 0x02, 0x01, 0x02, 0x00, 0x03, 0x06, 0x03, 0x05, 0x02, 0x00, 0x02, 0x08, 0x02,
+	0x01, 0x02, 0x00, 0x03, 0x06, 0x03, 0x01, 0x02, 0x00, 0x04, 0x04, 0x03, 0x01, 0x02, 0x00, 0x02,
+	0x01, 0x08, 0x01, 0x02, 0x00, 0x02, 0x02, 0x05, 0x05, 0x01, 0x00, 0x02, 0x02, 0x00,
+	// @11204 0xF1 (10 pixels wide)
+	0x0A, 0x00, 0x01, 0x01, 0x03, 0x07, 0x01, 0x01, 0x02, 0x08, 0x01, 0x01, 0x01, 0x03, 0x01, 0x01,
+	0x01, 0x02, 0x01, 0x01, 0x00, 0x03, 0x02, 0x01, 0x00, 0x02, 0x02, 0x01, 0x00, 0x03, 0x01, 0x01,
+	0x01, 0x02, 0x01, 0x01, 0x01, 0x03, 0x01, 0x01, 0x02, 0x08, 0x01, 0x01, 0x03, 0x07, 0x07, 0x00,
+	// @11252 0xF2 (11 pixels wide)
+	0x0A, 0x00, 0x02, 0x01, 0x00, 0x0B, 0x0B, 0x01, 0x04, 0x03, 0x07, 0x00,
+	// @11264 0xF3 (12 pixels wide)
+	0x0A, 0x00, 0x01, 0x02, 0x00, 0x03, 0x07, 0x02, 0x01, 0x02, 0x01, 0x02, 0x06, 0x03, 0x01, 0x02,
+	0x01, 0x03, 0x05, 0x03, 0x01, 0x02, 0x02, 0x02, 0x05, 0x02, 0x01, 0x02, 0x02, 0x03, 0x03, 0x03,
+	0x01, 0x02, 0x02, 0x03, 0x03, 0x02, 0x01, 0x02, 0x03, 0x02, 0x03, 0x02, 0x01, 0x02, 0x03, 0x03,
+	0x01, 0x03, 0x02, 0x02, 0x04, 0x02, 0x01, 0x02, 0x01, 0x01, 0x04, 0x04, 0x02, 0x01, 0x05, 0x03,
+	0x01, 0x01, 0x05, 0x02, 0x01, 0x01, 0x04, 0x03, 0x01, 0x01, 0x03, 0x03, 0x01, 0x01, 0x02, 0x03,
+	0x01, 0x01, 0x01, 0x03, 0x01, 0x01, 0x01, 0x02, 0x01, 0x00,
+	// @11354 0xF4 (15 pixels wide)
+	0x04, 0x00, 0x06, 0x01, 0x07, 0x02, 0x01, 0x01, 0x04, 0x08, 0x01, 0x03, 0x02, 0x04, 0x01, 0x02,
+	0x01, 0x03, 0x01, 0x03, 0x01, 0x03, 0x03, 0x02, 0x02, 0x03, 0x01, 0x03, 0x01, 0x02, 0x04, 0x02,
+	0x03, 0x03, 0x01, 0x03, 0x00, 0x03, 0x04, 0x02, 0x04, 0x02, 0x03, 0x03, 0x00, 0x02, 0x05, 0x02,
+	0x04, 0x02, 0x01, 0x03, 0x00, 0x03, 0x04, 0x02, 0x04, 0x02, 0x01, 0x03, 0x01, 0x02, 0x04, 0x02,
+	0x03, 0x03, 0x01, 0x03, 0x01, 0x03, 0x03, 0x02, 0x02, 0x03, 0x01, 0x02, 0x02, 0x04, 0x01, 0x06,
+	0x01, 0x01, 0x04, 0x08, 0x05, 0x01, 0x07, 0x02, 0x02, 0x00,
+	// @11444 0xF5 (11 pixels wide)
+	0x0A, 0x00, 0x01, 0x02, 0x00, 0x02, 0x06, 0x03, 0x01, 0x02, 0x01, 0x02, 0x04, 0x03, 0x01, 0x02,
+	0x01, 0x03, 0x03, 0x02, 0x01, 0x02, 0x02, 0x02, 0x02, 0x03, 0x01, 0x02, 0x03, 0x02, 0x01, 0x02,
+	0x01, 0x01, 0x03, 0x04, 0x01, 0x01, 0x04, 0x03, 0x01, 0x01, 0x03, 0x04, 0x01, 0x02, 0x02, 0x03,
+	0x01, 0x02, 0x01, 0x02, 0x02, 0x02, 0x02, 0x03, 0x01, 0x02, 0x01, 0x02, 0x04, 0x02, 0x01, 0x02,
+	0x00, 0x03, 0x04, 0x03, 0x01, 0x02, 0x00, 0x02, 0x06, 0x03, 0x07, 0x00,
+	// @11520 0xF6 (12 pixels wide)
+	0x0A, 0x00, 0x0B, 0x02, 0x00, 0x02, 0x06, 0x03, 0x02, 0x01, 0x00, 0x0C, 0x04, 0x01, 0x0A, 0x02,
+	0x03, 0x00,
+	// @11538 0xF7 (10 pixels wide)
+	0x0A, 0x00, 0x06, 0x02, 0x00, 0x02, 0x06, 0x02, 0x01, 0x02, 0x00, 0x03, 0x04, 0x03, 0x01, 0x01,
+	0x01, 0x09, 0x01, 0x02, 0x02, 0x04, 0x02, 0x02, 0x04, 0x01, 0x08, 0x02, 0x07, 0x00,
+	// @11568 0xF8 (16 pixels wide)
+	0x0A, 0x00, 0x0B, 0x03, 0x00, 0x02, 0x05, 0x02, 0x05, 0x02, 0x02, 0x01, 0x00, 0x10, 0x07, 0x00,
+	// @11584 0xF9 (17 pixels wide)
+	0x0A, 0x00, 0x0B, 0x03, 0x00, 0x02, 0x05, 0x02, 0x05, 0x02, 0x02, 0x01, 0x00, 0x11, 0x04, 0x01,
+	0x0F, 0x02, 0x03, 0x00,
+	// @11604 0xFA (15 pixels wide)
+	0x0A, 0x00, 0x02, 0x01, 0x00, 0x07, 0x02, 0x01, 0x04, 0x03, 0x01, 0x01, 0x04, 0x07, 0x01, 0x01,
+	0x04, 0x09, 0x01, 0x02, 0x04, 0x03, 0x04, 0x03, 0x03, 0x02, 0x04, 0x03, 0x05, 0x03, 0x01, 0x02,
+	0x04, 0x03, 0x05, 0x02, 0x01, 0x01, 0x04, 0x09, 0x01, 0x01, 0x04, 0x08, 0x07, 0x00,
+	// @11650 0xFB (14 pixels wide)
+	0x0A, 0x00, 0x04, 0x02, 0x00, 0x02, 0x0A, 0x02, 0x01, 0x02, 0x00, 0x07, 0x05, 0x02, 0x01, 0x02,
+	0x00, 0x09, 0x03, 0x02, 0x02, 0x03, 0x00, 0x02, 0x05, 0x03, 0x02, 0x02, 0x02, 0x03, 0x00, 0x02,
+	0x06, 0x02, 0x02, 0x02, 0x01, 0x03, 0x00, 0x02, 0x05, 0x03, 0x02, 0x02, 0x01, 0x02, 0x00, 0x09,
+	0x03, 0x02, 0x01, 0x02, 0x00, 0x07, 0x05, 0x02, 0x07, 0x00,
+	// @11708 0xFC (10 pixels wide)
+	0x0A, 0x00, 0x04, 0x01, 0x00, 0x02, 0x01, 0x01, 0x00, 0x07, 0x01, 0x01, 0x00, 0x09, 0x01, 0x02,
+	0x00, 0x02, 0x05, 0x03, 0x03, 0x02, 0x00, 0x02, 0x06, 0x02, 0x01, 0x02, 0x00, 0x02, 0x05, 0x03,
+	0x01, 0x01, 0x00, 0x09, 0x01, 0x01, 0x00, 0x08, 0x07, 0x00,
+	// @11750 0xFD (10 pixels wide)
+	0x0A, 0x00, 0x01, 0x01, 0x00, 0x07, 0x01, 0x02, 0x00, 0x03, 0x01, 0x05, 0x01, 0x01, 0x07, 0x02,
+	0x01, 0x01, 0x07, 0x03, 0x02, 0x01, 0x08, 0x02, 0x01, 0x01, 0x02, 0x08, 0x02, 0x01, 0x08, 0x02,
+	0x01, 0x01, 0x07, 0x03, 0x01, 0x01, 0x06, 0x03, 0x01, 0x01, 0x00, 0x09, 0x01, 0x01, 0x00, 0x07,
+	0x07, 0x00,
+	// @11800 0xFE (16 pixels wide)
+	0x0A, 0x00, 0x01, 0x02, 0x00, 0x02, 0x05, 0x06, 0x01, 0x03, 0x00, 0x02, 0x04, 0x03, 0x02, 0x03,
+	0x01, 0x03, 0x00, 0x02, 0x03, 0x03, 0x04, 0x03, 0x02, 0x03, 0x00, 0x02, 0x03, 0x02, 0x06, 0x03,
+	0x02, 0x02, 0x00, 0x07, 0x07, 0x02, 0x01, 0x03, 0x00, 0x02, 0x02, 0x03, 0x07, 0x02, 0x01, 0x03,
+	0x00, 0x02, 0x03, 0x02, 0x06, 0x03, 0x01, 0x03, 0x00, 0x02, 0x03, 0x02, 0x06, 0x02, 0x01, 0x03,
+	0x00, 0x02, 0x03, 0x03, 0x04, 0x03, 0x01, 0x03, 0x00, 0x02, 0x04, 0x04, 0x01, 0x03, 0x01, 0x02,
+	0x00, 0x02, 0x05, 0x06, 0x07, 0x00,
+	// @11886 0xFF (12 pixels wide)
+	0x09, 0x00, 0x01, 0x01, 0x03, 0x09, 0x01, 0x01, 0x02, 0x0A, 0x01, 0x02, 0x01, 0x03, 0x06, 0x02,
+	0x03, 0x02, 0x01, 0x02, 0x07, 0x02, 0x01, 0x02, 0x01, 0x03, 0x06, 0x02, 0x01, 0x01, 0x02, 0x0A,
+	0x01, 0x01, 0x04, 0x08, 0x01, 0x02, 0x03, 0x02, 0x05, 0x02, 0x01, 0x02, 0x02, 0x02, 0x06, 0x02,
+	0x01, 0x02, 0x01, 0x03, 0x06, 0x02, 0x01, 0x02, 0x01, 0x02, 0x07, 0x02, 0x01, 0x02, 0x00, 0x02,
+	0x08, 0x02, 0x07, 0x00,
+};
+
+const struct FONT_CHAR_INFO RIAD_20ptRLEDescriptors[] = 
+{
+	{2, 0}, 		// 0x20
+	{3, 2}, 		// 0x21
+	{7, 24}, 		// 0x22
+	{11, 52}, 		// 0x23
+	{10, 118}, 		// 0x24
+	{20, 184}, 		// 0x25
+	{15, 334}, 		// 0x26
+	{3, 450}, 		// 0x27
+	{5, 466}, 		// 0x28
+	{5, 498}, 		// 0x29
+	{9, 530}, 		// 0x2A
+	{14, 588}, 		// 0x2B
+	{3, 604}, 		// 0x2C
+	{6, 620}, 		// 0x2D
+	{4, 628}, 		// 0x2E
+	{9, 644}, 		// 0x2F
+	{12, 692}, 		// 0x30
+	{6, 760}, 		// 0x31
+	{11, 786}, 		// 0x32
+	{11, 854}, 		// 0x33
+	{13, 920}, 		// 0x34
+	{11, 992}, 		// 0x35
+	{12, 1044}, 		// 0x36
+	{11, 1132}, 		// 0x37
+	{12, 1192}, 		// 0x38
+	{12, 1276}, 		// 0x39
+	{4, 1358}, 		// 0x3A
+	{2, 1392}, 		// 0x3B
+	{12, 1414}, 		// 0x3C
+	{14, 1474}, 		// 0x3D
+	{12, 1488}, 		// 0x3E
+	{9, 1548}, 		// 0x3F
+	{18, 1604}, 		// 0x40
+	{15, 1736}, 		// 0x41
+	{12, 1838}, 		// 0x42
+	{14, 1918}, 		// 0x43
+	{15, 1974}, 		// 0x44
+	{10, 2054}, 		// 0x45
+	{10, 2078}, 		// 0x46
+	{15, 2098}, 		// 0x47
+	{14, 2168}, 		// 0x48
+	{2, 2188}, 		// 0x49
+	{8, 2196}, 		// 0x4A
+	{13, 2216}, 		// 0x4B
+	{10, 2308}, 		// 0x4C
+	{18, 2320}, 		// 0x4D
+	{14, 2454}, 		// 0x4E
+	{17, 2570}, 		// 0x4F
+	{11, 2652}, 		// 0x50
+	{17, 2700}, 		// 0x51
+	{12, 2794}, 		// 0x52
+	{11, 2868}, 		// 0x53
+	{13, 2930}, 		// 0x54
+	{13, 2942}, 		// 0x55
+	{15, 2978}, 		// 0x56
+	{21, 3056}, 		// 0x57
+	{13, 3178}, 		// 0x58
+	{13, 3284}, 		// 0x59
+	{13, 3348}, 		// 0x5A
+	{5, 3416}, 		// 0x5B
+	{9, 3432}, 		// 0x5C
+	{4, 3476}, 		// 0x5D
+	{12, 3492}, 		// 0x5E
+	{14, 3552}, 		// 0x5F
+	{4, 3560}, 		// 0x60
+	{10, 3580}, 		// 0x61
+	{12, 3642}, 		// 0x62
+	{10, 3704}, 		// 0x63
+	{12, 3752}, 		// 0x64
+	{12, 3822}, 		// 0x65
+	{9, 3882}, 		// 0x66
+	{12, 3912}, 		// 0x67
+	{11, 4008}, 		// 0x68
+	{3, 4040}, 		// 0x69
+	{6, 4062}, 		// 0x6A
+	{11, 4096}, 		// 0x6B
+	{2, 4180}, 		// 0x6C
+	{19, 4188}, 		// 0x6D
+	{11, 4228}, 		// 0x6E
+	{13, 4256}, 		// 0x6F
+	{12, 4322}, 		// 0x70
+	{12, 4384}, 		// 0x71
+	{6, 4454}, 		// 0x72
+	{9, 4476}, 		// 0x73
+	{8, 4530}, 		// 0x74
+	{11, 4562}, 		// 0x75
+	{11, 4602}, 		// 0x76
+	{18, 4652}, 		// 0x77
+	{11, 4764}, 		// 0x78
+	{12, 4840}, 		// 0x79
+	{11, 4930}, 		// 0x7A
+	{6, 4982}, 		// 0x7B
+	{2, 5034}, 		// 0x7C
+	{6, 5040}, 		// 0x7D
+	{14, 5072}, 		// 0x7E
+	{2, 5102}, 		// 0x7F
+	{2, 5104}, 		// 0x80
+	{2, 5106}, 		// 0x81
+	{4, 5108}, 		// 0x82
+	{13, 5136}, 		// 0x83
+	{9, 5212}, 		// 0x84
+	{2, 5252}, 		// 0x85
+	{10, 5254}, 		// 0x86
+	{10, 5292}, 		// 0x87
+	{9, 5358}, 		// 0x88
+	{22, 5374}, 		// 0x89
+	{12, 5568}, 		// 0x8A
+	{6, 5680}, 		// 0x8B
+	{26, 5728}, 		// 0x8C
+	{2, 5848}, 		// 0x8D
+	{2, 5850}, 		// 0x8E
+	{2, 5852}, 		// 0x8F
+	{2, 5854}, 		// 0x90
+	{4, 5856}, 		// 0x91
+	{4, 5884}, 		// 0x92
+	{10, 5912}, 		// 0x93
+	{10, 5958}, 		// 0x94
+	{2, 6004}, 		// 0x95
+	{9, 6006}, 		// 0x96
+	{26, 6014}, 		// 0x97
+	{8, 6022}, 		// 0x98
+	{25, 6046}, 		// 0x99
+	{9, 6172}, 		// 0x9A
+	{6, 6262}, 		// 0x9B
+	{16, 6306}, 		// 0x9C
+	{2, 6420}, 		// 0x9D
+	{2, 6422}, 		// 0x9E
+	{18, 6424}, 		// 0x9F
+	{2, 6520}, 		// 0xA0
+	{3, 6522}, 		// 0xA1
+	{10, 6544}, 		// 0xA2
+	{12, 6596}, 		// 0xA3
+	{12, 6646}, 		// 0xA4
+	{13, 6702}, 		// 0xA5
+	{2, 6774}, 		// 0xA6
+	{10, 6788}, 		// 0xA7
+	{8, 6878}, 		// 0xA8
+	{16, 6894}, 		// 0xA9
+	{7, 6990}, 		// 0xAA
+	{9, 7036}, 		// 0xAB
+	{14, 7100}, 		// 0xAC
+	{2, 7112}, 		// 0xAD
+	{9, 7114}, 		// 0xAE
+	{6, 7180}, 		// 0xAF
+	{7, 7188}, 		// 0xB0
+	{14, 7222}, 		// 0xB1
+	{8, 7244}, 		// 0xB2
+	{8, 7278}, 		// 0xB3
+	{5, 7322}, 		// 0xB4
+	{12, 7342}, 		// 0xB5
+	{11, 7382}, 		// 0xB6
+	{3, 7432}, 		// 0xB7
+	{4, 7448}, 		// 0xB8
+	{4, 7464}, 		// 0xB9
+	{9, 7482}, 		// 0xBA
+	{9, 7536}, 		// 0xBB
+	{19, 7594}, 		// 0xBC
+	{18, 7724}, 		// 0xBD
+	{19, 7846}, 		// 0xBE
+	{9, 7974}, 		// 0xBF
+	{15, 8030}, 		// 0xC0
+	{12, 8132}, 		// 0xC1
+	{12, 8192}, 		// 0xC2
+	{10, 8272}, 		// 0xC3
+	{16, 8284}, 		// 0xC4
+	{10, 8338}, 		// 0xC5
+	{20, 8362}, 		// 0xC6
+	{11, 8502}, 		// 0xC7
+	{14, 8570}, 		// 0xC8
+	{14, 8692}, 		// 0xC9
+	{12, 8832}, 		// 0xCA
+	{14, 8934}, 		// 0xCB
+	{18, 8978}, 		// 0xCC
+	{14, 9112}, 		// 0xCD
+	{17, 9132}, 		// 0xCE
+	{13, 9214}, 		// 0xCF
+	{11, 9228}, 		// 0xD0
+	{14, 9276}, 		// 0xD1
+	{13, 9332}, 		// 0xD2
+	{14, 9344}, 		// 0xD3
+	{18, 9430}, 		// 0xD4
+	{13, 9542}, 		// 0xD5
+	{15, 9648}, 		// 0xD6
+	{12, 9666}, 		// 0xD7
+	{19, 9698}, 		// 0xD8
+	{20, 9714}, 		// 0xD9
+	{16, 9734}, 		// 0xDA
+	{16, 9800}, 		// 0xDB
+	{12, 9892}, 		// 0xDC
+	{13, 9954}, 		// 0xDD
+	{20, 10016}, 		// 0xDE
+	{12, 10140}, 		// 0xDF
+	{10, 10226}, 		// 0xE0
+	{12, 10288}, 		// 0xE1
+	{10, 10370}, 		// 0xE2
+	{8, 10428}, 		// 0xE3
+	{13, 10440}, 		// 0xE4
+	{12, 10476}, 		// 0xE5
+	{18, 10536}, 		// 0xE6
+	{10, 10640}, 		// 0xE7
+	{11, 10692}, 		// 0xE8
+	{11, 10760}, 		// 0xE9
+	{11, 10846}, 		// 0xEA
+	{12, 10926}, 		// 0xEB
+	{15, 10964}, 		// 0xEC
+	{11, 11042}, 		// 0xED
+	{13, 11062}, 		// 0xEE
+	{11, 11128}, 		// 0xEF
+	{12, 11142}, 		// 0xF0
+	{10, 11204}, 		// 0xF1
+	{11, 11252}, 		// 0xF2
+	{12, 11264}, 		// 0xF3
+	{15, 11354}, 		// 0xF4
+	{11, 11444}, 		// 0xF5
+	{12, 11520}, 		// 0xF6
+	{10, 11538}, 		// 0xF7
+	{16, 11568}, 		// 0xF8
+	{17, 11584}, 		// 0xF9
+	{15, 11604}, 		// 0xFA
+	{14, 11650}, 		// 0xFB
+	{10, 11708}, 		// 0xFC
+	{10, 11750}, 		// 0xFD
+	{16, 11800}, 		// 0xFE
+	{12, 11886}, 		// 0xFF
+};
+
+sFONT RIAD_20pt = {
+  0,
+  RIAD_20ptRLEDescriptors,
+  30, /* Height */
+  RIAD_20ptRLE,
+};
+#endif
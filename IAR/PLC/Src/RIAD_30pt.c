@@ -2,6 +2,8 @@
 // 
 #include "variables.h"
 #include "fonts.h"
+
+#if RIAD_30pt_FROM == FONT_FULL
 // Character bitmaps for GOST type B 16pt
 const uint8_t RIAD_30ptBitmaps[] = 
 {
@@ -10547,4 +10549,5 @@ sFONT RIAD_30pt = {
   RIAD_30ptDescriptors,
 //  0, //variable width
   44, /* Height */
-};
\ No newline at end of file
+};
+#endif
@@ -0,0 +1,1619 @@
+// 
+//  RIAD_30pt, run coded by Tools/font_rle.py from RIAD_30pt.c, don't edit
+// 
+#include "variables.h"
+#include "fonts.h"
+
+#if RIAD_30pt_FROM == FONT_RLE
+const uint8_t RIAD_30ptRLE[] = 
+{
+	// @0 0x20 (2 pixels wide)
+	0x2C, 0x00,
+	// @2 0x21 (5 pixels wide)
+	0x07, 0x00, 0x01, 0x01, 0x01, 0x04, 0x12, 0x01, 0x01, 0x03, 0x03, 0x00, 0x01, 0x01, 0x02, 0x01,
+	0x01, 0x01, 0x01, 0x04, 0x02, 0x01, 0x00, 0x05, 0x01, 0x01, 0x01, 0x04, 0x0A, 0x00,
+	// @32 0x22 (9 pixels wide)
+	0x06, 0x00, 0x07, 0x02, 0x00, 0x03, 0x03, 0x03, 0x01, 0x02, 0x01, 0x02, 0x03, 0x03, 0x02, 0x02,
+	0x01, 0x02, 0x04, 0x02, 0x1C, 0x00,
+	// @54 0x23 (17 pixels wide)
+	0x08, 0x00, 0x01, 0x02, 0x06, 0x03, 0x04, 0x02, 0x01, 0x02, 0x06, 0x02, 0x05, 0x02, 0x03, 0x02,
+	0x06, 0x02, 0x04, 0x03, 0x01, 0x02, 0x06, 0x02, 0x04, 0x02, 0x02, 0x02, 0x05, 0x03, 0x04, 0x02,
+	0x02, 0x01, 0x01, 0x10, 0x02, 0x02, 0x05, 0x02, 0x04, 0x03, 0x01, 0x02, 0x05, 0x02, 0x04, 0x02,
+	0x03, 0x02, 0x04, 0x03, 0x04, 0x02, 0x02, 0x01, 0x00, 0x11, 0x02, 0x02, 0x04, 0x02, 0x04, 0x03,
+	0x01, 0x02, 0x04, 0x02, 0x04, 0x02, 0x02, 0x02, 0x03, 0x03, 0x04, 0x02, 0x01, 0x02, 0x03, 0x02,
+	0x05, 0x02, 0x02, 0x02, 0x03, 0x02, 0x04, 0x03, 0x0A, 0x00,
+	// @144 0x24 (15 pixels wide)
+	0x05, 0x00, 0x03, 0x01, 0x06, 0x02, 0x01, 0x01, 0x06, 0x03, 0x01, 0x01, 0x03, 0x0A, 0x01, 0x01,
+	0x02, 0x0B, 0x01, 0x02, 0x01, 0x04, 0x05, 0x03, 0x02, 0x01, 0x00, 0x04, 0x01, 0x01, 0x00, 0x03,
+	0x02, 0x01, 0x00, 0x04, 0x01, 0x01, 0x00, 0x05, 0x01, 0x01, 0x01, 0x06, 0x01, 0x01, 0x02, 0x07,
+	0x01, 0x01, 0x03, 0x08, 0x01, 0x01, 0x05, 0x07, 0x01, 0x01, 0x08, 0x05, 0x01, 0x01, 0x09, 0x05,
+	0x01, 0x01, 0x0A, 0x04, 0x02, 0x01, 0x0B, 0x04, 0x02, 0x01, 0x0B, 0x03, 0x01, 0x02, 0x00, 0x01,
+	0x09, 0x04, 0x01, 0x02, 0x00, 0x04, 0x04, 0x05, 0x01, 0x01, 0x00, 0x0C, 0x01, 0x01, 0x01, 0x0A,
+	0x04, 0x01, 0x06, 0x02, 0x07, 0x00,
+	// @246 0x25 (29 pixels wide)
+	0x08, 0x00, 0x01, 0x02, 0x03, 0x07, 0x0B, 0x02, 0x01, 0x02, 0x02, 0x09, 0x09, 0x02, 0x01, 0x03,
+	0x01, 0x03, 0x04, 0x03, 0x09, 0x02, 0x01, 0x03, 0x01, 0x03, 0x05, 0x03, 0x07, 0x02, 0x01, 0x03,
+	0x01, 0x02, 0x06, 0x03, 0x06, 0x03, 0x01, 0x03, 0x00, 0x03, 0x07, 0x02, 0x06, 0x02, 0x01, 0x03,
+	0x00, 0x03, 0x07, 0x02, 0x05, 0x03, 0x01, 0x03, 0x00, 0x03, 0x07, 0x02, 0x05, 0x02, 0x02, 0x03,
+	0x00, 0x03, 0x07, 0x02, 0x04, 0x02, 0x01, 0x04, 0x01, 0x02, 0x06, 0x03, 0x03, 0x02, 0x05, 0x03,
+	0x01, 0x04, 0x01, 0x03, 0x05, 0x03, 0x03, 0x02, 0x03, 0x07, 0x01, 0x05, 0x01, 0x03, 0x04, 0x03,
+	0x03, 0x02, 0x03, 0x04, 0x01, 0x04, 0x01, 0x04, 0x02, 0x09, 0x02, 0x03, 0x02, 0x03, 0x05, 0x03,
+	0x01, 0x04, 0x03, 0x06, 0x04, 0x02, 0x03, 0x03, 0x05, 0x03, 0x01, 0x03, 0x0C, 0x02, 0x03, 0x03,
+	0x06, 0x03, 0x01, 0x03, 0x0C, 0x02, 0x03, 0x03, 0x07, 0x02, 0x02, 0x03, 0x0B, 0x02, 0x04, 0x03,
+	0x07, 0x02, 0x01, 0x03, 0x0A, 0x02, 0x05, 0x03, 0x07, 0x02, 0x01, 0x03, 0x09, 0x03, 0x05, 0x03,
+	0x07, 0x02, 0x01, 0x03, 0x09, 0x02, 0x07, 0x02, 0x06, 0x03, 0x01, 0x03, 0x08, 0x02, 0x08, 0x03,
+	0x05, 0x03, 0x01, 0x03, 0x08, 0x02, 0x08, 0x04, 0x03, 0x03, 0x01, 0x02, 0x07, 0x02, 0x0A, 0x08,
+	0x01, 0x02, 0x07, 0x02, 0x0B, 0x06, 0x0A, 0x00,
+	// @446 0x26 (23 pixels wide)
+	0x07, 0x00, 0x01, 0x01, 0x06, 0x08, 0x01, 0x01, 0x05, 0x0A, 0x01, 0x02, 0x04, 0x04, 0x04, 0x03,
+	0x01, 0x02, 0x04, 0x03, 0x06, 0x03, 0x01, 0x02, 0x03, 0x04, 0x06, 0x03, 0x01, 0x02, 0x03, 0x03,
+	0x07, 0x03, 0x01, 0x02, 0x03, 0x04, 0x06, 0x03, 0x01, 0x02, 0x03, 0x04, 0x05, 0x04, 0x01, 0x02,
+	0x04, 0x03, 0x05, 0x03, 0x01, 0x02, 0x04, 0x04, 0x03, 0x03, 0x01, 0x02, 0x05, 0x03, 0x01, 0x04,
+	0x01, 0x01, 0x05, 0x07, 0x01, 0x02, 0x05, 0x05, 0x09, 0x03, 0x01, 0x02, 0x03, 0x08, 0x08, 0x03,
+	0x01, 0x03, 0x02, 0x04, 0x02, 0x04, 0x07, 0x03, 0x01, 0x03, 0x01, 0x04, 0x04, 0x04, 0x06, 0x03,
+	0x01, 0x03, 0x01, 0x03, 0x05, 0x05, 0x04, 0x04, 0x01, 0x03, 0x01, 0x03, 0x06, 0x04, 0x04, 0x03,
+	0x01, 0x03, 0x00, 0x04, 0x07, 0x04, 0x03, 0x03, 0x01, 0x03, 0x00, 0x04, 0x08, 0x04, 0x01, 0x03,
+	0x01, 0x02, 0x00, 0x04, 0x09, 0x07, 0x01, 0x02, 0x00, 0x04, 0x0A, 0x05, 0x01, 0x02, 0x01, 0x04,
+	0x0A, 0x04, 0x01, 0x02, 0x01, 0x04, 0x08, 0x07, 0x01, 0x02, 0x02, 0x05, 0x04, 0x0A, 0x01, 0x02,
+	0x03, 0x0C, 0x02, 0x05, 0x01, 0x02, 0x04, 0x09, 0x05, 0x05, 0x0A, 0x00,
+	// @618 0x27 (3 pixels wide)
+	0x06, 0x00, 0x07, 0x01, 0x00, 0x03, 0x03, 0x01, 0x01, 0x02, 0x1C, 0x00,
+	// @630 0x28 (7 pixels wide)
+	0x06, 0x00, 0x01, 0x01, 0x05, 0x02, 0x01, 0x01, 0x04, 0x03, 0x02, 0x01, 0x03, 0x03, 0x02, 0x01,
+	0x02, 0x03, 0x03, 0x01, 0x01, 0x03, 0x0F, 0x01, 0x00, 0x03, 0x03, 0x01, 0x01, 0x03, 0x02, 0x01,
+	0x02, 0x03, 0x02, 0x01, 0x03, 0x03, 0x01, 0x01, 0x04, 0x03, 0x01, 0x01, 0x05, 0x02, 0x05, 0x00,
+	// @678 0x29 (8 pixels wide)
+	0x06, 0x00, 0x01, 0x01, 0x00, 0x03, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x03, 0x02, 0x01,
+	0x02, 0x03, 0x03, 0x01, 0x03, 0x03, 0x04, 0x01, 0x04, 0x03, 0x09, 0x01, 0x05, 0x03, 0x04, 0x01,
+	0x04, 0x03, 0x03, 0x01, 0x03, 0x03, 0x02, 0x01, 0x02, 0x03, 0x01, 0x01, 0x01, 0x03, 0x01, 0x01,
+	0x01, 0x02, 0x01, 0x01, 0x00, 0x03, 0x05, 0x00,
+	// @734 0x2A (14 pixels wide)
+	0x07, 0x00, 0x01, 0x02, 0x03, 0x02, 0x04, 0x02, 0x01, 0x02, 0x03, 0x03, 0x03, 0x03, 0x01, 0x02,
+	0x03, 0x03, 0x03, 0x02, 0x01, 0x02, 0x04, 0x02, 0x02, 0x02, 0x01, 0x02, 0x05, 0x02, 0x01, 0x01,
+	0x01, 0x03, 0x00, 0x02, 0x04, 0x03, 0x03, 0x02, 0x01, 0x01, 0x00, 0x0E, 0x01, 0x03, 0x00, 0x04,
+	0x02, 0x03, 0x02, 0x03, 0x01, 0x01, 0x05, 0x04, 0x01, 0x02, 0x04, 0x02, 0x02, 0x02, 0x01, 0x02,
+	0x04, 0x02, 0x02, 0x03, 0x01, 0x02, 0x03, 0x03, 0x03, 0x03, 0x01, 0x02, 0x03, 0x02, 0x04, 0x03,
+	0x01, 0x01, 0x04, 0x01, 0x17, 0x00,
+	// @820 0x2B (20 pixels wide)
+	0x0D, 0x00, 0x09, 0x01, 0x09, 0x02, 0x03, 0x01, 0x00, 0x14, 0x09, 0x01, 0x09, 0x02, 0x0A, 0x00,
+	// @836 0x2C (6 pixels wide)
+	0x1D, 0x00, 0x02, 0x01, 0x02, 0x04, 0x01, 0x01, 0x02, 0x03, 0x02, 0x01, 0x01, 0x04, 0x02, 0x01,
+	0x01, 0x03, 0x02, 0x01, 0x00, 0x03, 0x01, 0x01, 0x00, 0x02, 0x05, 0x00,
+	// @864 0x2D (10 pixels wide)
+	0x16, 0x00, 0x02, 0x01, 0x00, 0x0A, 0x14, 0x00,
+	// @872 0x2E (5 pixels wide)
+	0x1D, 0x00, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x00, 0x04, 0x02, 0x01, 0x00, 0x05, 0x01, 0x01,
+	0x01, 0x03, 0x0A, 0x00,
+	// @892 0x2F (13 pixels wide)
+	0x07, 0x00, 0x01, 0x01, 0x0B, 0x02, 0x02, 0x01, 0x0A, 0x03, 0x01, 0x01, 0x0A, 0x02, 0x02, 0x01,
+	0x09, 0x03, 0x02, 0x01, 0x08, 0x03, 0x01, 0x01, 0x08, 0x02, 0x02, 0x01, 0x07, 0x03, 0x01, 0x01,
+	0x07, 0x02, 0x01, 0x01, 0x06, 0x03, 0x01, 0x01, 0x06, 0x02, 0x02, 0x01, 0x05, 0x03, 0x01, 0x01,
+	0x05, 0x02, 0x02, 0x01, 0x04, 0x03, 0x02, 0x01, 0x03, 0x03, 0x01, 0x01, 0x03, 0x02, 0x02, 0x01,
+	0x02, 0x03, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x01, 0x03, 0x01, 0x01, 0x01, 0x02, 0x02, 0x01,
+	0x00, 0x03, 0x08, 0x00,
+	// @976 0x30 (18 pixels wide)
+	0x08, 0x00, 0x01, 0x01, 0x06, 0x07, 0x01, 0x01, 0x04, 0x0B, 0x01, 0x02, 0x03, 0x05, 0x03, 0x04,
+	0x01, 0x02, 0x03, 0x04, 0x05, 0x04, 0x01, 0x02, 0x02, 0x04, 0x07, 0x04, 0x01, 0x02, 0x02, 0x03,
+	0x08, 0x04, 0x01, 0x02, 0x01, 0x04, 0x09, 0x03, 0x01, 0x02, 0x01, 0x04, 0x09, 0x04, 0x03, 0x02,
+	0x01, 0x03, 0x0A, 0x04, 0x04, 0x02, 0x00, 0x04, 0x0B, 0x03, 0x03, 0x02, 0x01, 0x03, 0x0A, 0x04,
+	0x01, 0x02, 0x01, 0x04, 0x09, 0x04, 0x01, 0x02, 0x01, 0x04, 0x09, 0x03, 0x01, 0x02, 0x02, 0x03,
+	0x08, 0x04, 0x01, 0x02, 0x02, 0x04, 0x07, 0x04, 0x01, 0x02, 0x03, 0x03, 0x06, 0x04, 0x01, 0x02,
+	0x03, 0x05, 0x03, 0x04, 0x01, 0x01, 0x04, 0x0A, 0x01, 0x01, 0x05, 0x08, 0x0A, 0x00,
+	// @1086 0x31 (9 pixels wide)
+	0x08, 0x00, 0x01, 0x01, 0x05, 0x04, 0x01, 0x01, 0x03, 0x06, 0x01, 0x01, 0x01, 0x08, 0x01, 0x01,
+	0x00, 0x09, 0x01, 0x02, 0x01, 0x02, 0x02, 0x04, 0x15, 0x01, 0x05, 0x04, 0x0A, 0x00,
+	// @1116 0x32 (16 pixels wide)
+	0x08, 0x00, 0x01, 0x01, 0x03, 0x09, 0x01, 0x01, 0x01, 0x0C, 0x01, 0x02, 0x01, 0x06, 0x01, 0x06,
+	0x01, 0x02, 0x01, 0x02, 0x08, 0x04, 0x01, 0x01, 0x0C, 0x03, 0x04, 0x01, 0x0C, 0x04, 0x02, 0x01,
+	0x0C, 0x03, 0x01, 0x01, 0x0B, 0x04, 0x01, 0x01, 0x0B, 0x03, 0x01, 0x01, 0x0A, 0x04, 0x01, 0x01,
+	0x09, 0x04, 0x01, 0x01, 0x08, 0x04, 0x01, 0x01, 0x07, 0x04, 0x01, 0x01, 0x06, 0x04, 0x01, 0x01,
+	0x05, 0x04, 0x01, 0x01, 0x04, 0x04, 0x01, 0x01, 0x03, 0x04, 0x01, 0x01, 0x02, 0x04, 0x01, 0x01,
+	0x01, 0x04, 0x03, 0x01, 0x00, 0x10, 0x0A, 0x00,
+	// @1204 0x33 (16 pixels wide)
+	0x08, 0x00, 0x01, 0x01, 0x03, 0x09, 0x01, 0x01, 0x01, 0x0C, 0x01, 0x02, 0x01, 0x05, 0x02, 0x06,
+	0x01, 0x02, 0x01, 0x02, 0x07, 0x05, 0x04, 0x01, 0x0B, 0x04, 0x01, 0x01, 0x0B, 0x03, 0x01, 0x01,
+	0x0A, 0x04, 0x01, 0x01, 0x07, 0x06, 0x01, 0x01, 0x04, 0x07, 0x01, 0x01, 0x04, 0x08, 0x01, 0x01,
+	0x07, 0x06, 0x01, 0x01, 0x0A, 0x04, 0x01, 0x01, 0x0B, 0x04, 0x05, 0x01, 0x0C, 0x04, 0x01, 0x01,
+	0x0B, 0x04, 0x01, 0x02, 0x00, 0x02, 0x08, 0x05, 0x01, 0x02, 0x00, 0x05, 0x03, 0x06, 0x01, 0x01,
+	0x00, 0x0D, 0x01, 0x01, 0x01, 0x0A, 0x0A, 0x00,
+	// @1292 0x34 (19 pixels wide)
+	0x08, 0x00, 0x01, 0x01, 0x0B, 0x04, 0x01, 0x01, 0x0A, 0x05, 0x02, 0x01, 0x09, 0x06, 0x01, 0x02,
+	0x08, 0x03, 0x01, 0x03, 0x01, 0x02, 0x07, 0x04, 0x01, 0x03, 0x01, 0x02, 0x07, 0x03, 0x02, 0x03,
+	0x01, 0x02, 0x06, 0x03, 0x03, 0x03, 0x01, 0x02, 0x05, 0x04, 0x03, 0x03, 0x01, 0x02, 0x05, 0x03,
+	0x04, 0x03, 0x01, 0x02, 0x04, 0x03, 0x05, 0x03, 0x01, 0x02, 0x03, 0x03, 0x06, 0x03, 0x01, 0x02,
+	0x02, 0x04, 0x06, 0x03, 0x01, 0x02, 0x02, 0x03, 0x07, 0x03, 0x01, 0x02, 0x01, 0x03, 0x08, 0x03,
+	0x01, 0x02, 0x00, 0x04, 0x08, 0x03, 0x03, 0x01, 0x00, 0x13, 0x07, 0x01, 0x0C, 0x03, 0x0A, 0x00,
+	// @1388 0x35 (16 pixels wide)
+	0x08, 0x00, 0x03, 0x01, 0x03, 0x0C, 0x06, 0x01, 0x02, 0x03, 0x01, 0x02, 0x02, 0x02, 0x02, 0x01,
+	0x01, 0x01, 0x01, 0x0A, 0x01, 0x01, 0x01, 0x0C, 0x01, 0x01, 0x08, 0x06, 0x01, 0x01, 0x0A, 0x05,
+	0x01, 0x01, 0x0B, 0x04, 0x05, 0x01, 0x0C, 0x04, 0x01, 0x01, 0x0C, 0x03, 0x01, 0x01, 0x0B, 0x04,
+	0x01, 0x02, 0x00, 0x01, 0x09, 0x04, 0x01, 0x02, 0x00, 0x05, 0x02, 0x07, 0x01, 0x01, 0x00, 0x0C,
+	0x01, 0x01, 0x01, 0x0A, 0x0A, 0x00,
+	// @1458 0x36 (18 pixels wide)
+	0x08, 0x00, 0x01, 0x01, 0x0A, 0x06, 0x01, 0x01, 0x08, 0x08, 0x01, 0x01, 0x06, 0x08, 0x01, 0x01,
+	0x05, 0x05, 0x01, 0x01, 0x04, 0x04, 0x01, 0x01, 0x03, 0x04, 0x01, 0x01, 0x03, 0x03, 0x02, 0x01,
+	0x02, 0x03, 0x01, 0x02, 0x01, 0x04, 0x02, 0x07, 0x01, 0x02, 0x01, 0x03, 0x01, 0x0A, 0x01, 0x01,
+	0x01, 0x0F, 0x01, 0x02, 0x01, 0x05, 0x07, 0x04, 0x01, 0x02, 0x00, 0x05, 0x09, 0x04, 0x02, 0x02,
+	0x00, 0x04, 0x0A, 0x04, 0x02, 0x02, 0x00, 0x04, 0x0B, 0x03, 0x01, 0x02, 0x01, 0x03, 0x0B, 0x03,
+	0x01, 0x02, 0x01, 0x03, 0x0A, 0x04, 0x01, 0x02, 0x01, 0x04, 0x09, 0x04, 0x01, 0x02, 0x02, 0x03,
+	0x09, 0x03, 0x01, 0x02, 0x02, 0x04, 0x07, 0x04, 0x01, 0x02, 0x03, 0x05, 0x03, 0x05, 0x01, 0x01,
+	0x04, 0x0B, 0x01, 0x01, 0x05, 0x09, 0x0A, 0x00,
+	// @1578 0x37 (17 pixels wide)
+	0x08, 0x00, 0x03, 0x01, 0x00, 0x11, 0x01, 0x01, 0x0D, 0x03, 0x01, 0x01, 0x0C, 0x04, 0x01, 0x01,
+	0x0C, 0x03, 0x01, 0x01, 0x0B, 0x04, 0x01, 0x01, 0x0B, 0x03, 0x01, 0x01, 0x0A, 0x04, 0x01, 0x01,
+	0x0A, 0x03, 0x01, 0x01, 0x09, 0x04, 0x01, 0x01, 0x09, 0x03, 0x01, 0x01, 0x08, 0x04, 0x01, 0x01,
+	0x08, 0x03, 0x01, 0x01, 0x07, 0x04, 0x01, 0x01, 0x07, 0x03, 0x01, 0x01, 0x06, 0x04, 0x01, 0x01,
+	0x06, 0x03, 0x01, 0x01, 0x05, 0x04, 0x01, 0x01, 0x05, 0x03, 0x02, 0x01, 0x04, 0x04, 0x02, 0x01,
+	0x03, 0x04, 0x02, 0x01, 0x02, 0x04, 0x0A, 0x00,
+	// @1666 0x38 (18 pixels wide)
+	0x08, 0x00, 0x01, 0x01, 0x05, 0x09, 0x01, 0x01, 0x04, 0x0B, 0x01, 0x02, 0x03, 0x04, 0x04, 0x05,
+	0x01, 0x02, 0x02, 0x04, 0x07, 0x04, 0x01, 0x02, 0x02, 0x03, 0x08, 0x04, 0x01, 0x02, 0x02, 0x03,
+	0x09, 0x03, 0x01, 0x02, 0x01, 0x04, 0x09, 0x03, 0x01, 0x02, 0x02, 0x03, 0x09, 0x03, 0x01, 0x02,
+	0x02, 0x03, 0x08, 0x04, 0x01, 0x02, 0x02, 0x04, 0x06, 0x04, 0x01, 0x02, 0x03, 0x05, 0x03, 0x04,
+	0x01, 0x01, 0x04, 0x0A, 0x01, 0x01, 0x05, 0x09, 0x01, 0x01, 0x04, 0x0B, 0x01, 0x02, 0x02, 0x05,
+	0x04, 0x05, 0x01, 0x02, 0x02, 0x03, 0x08, 0x04, 0x01, 0x02, 0x01, 0x04, 0x09, 0x04, 0x02, 0x02,
+	0x01, 0x03, 0x0A, 0x04, 0x01, 0x02, 0x00, 0x04, 0x0A, 0x04, 0x01, 0x02, 0x01, 0x03, 0x0A, 0x04,
+	0x01, 0x02, 0x01, 0x04, 0x09, 0x04, 0x01, 0x02, 0x01, 0x05, 0x07, 0x04, 0x01, 0x02, 0x02, 0x05,
+	0x05, 0x04, 0x01, 0x01, 0x03, 0x0C, 0x01, 0x01, 0x05, 0x09, 0x0A, 0x00,
+	// @1806 0x39 (17 pixels wide)
+	0x08, 0x00, 0x01, 0x01, 0x04, 0x08, 0x01, 0x01, 0x03, 0x0B, 0x01, 0x02, 0x02, 0x05, 0x03, 0x05,
+	0x01, 0x02, 0x01, 0x04, 0x07, 0x03, 0x01, 0x02, 0x01, 0x03, 0x08, 0x04, 0x01, 0x02, 0x00, 0x04,
+	0x09, 0x03, 0x02, 0x02, 0x00, 0x03, 0x0A, 0x04, 0x03, 0x02, 0x00, 0x03, 0x0B, 0x03, 0x01, 0x02,
+	0x00, 0x04, 0x09, 0x04, 0x01, 0x02, 0x00, 0x04, 0x08, 0x05, 0x01, 0x02, 0x01, 0x05, 0x05, 0x06,
+	0x01, 0x01, 0x02, 0x0F, 0x01, 0x02, 0x03, 0x09, 0x01, 0x04, 0x01, 0x02, 0x05, 0x05, 0x03, 0x03,
+	0x01, 0x01, 0x0D, 0x03, 0x01, 0x01, 0x0C, 0x04, 0x01, 0x01, 0x0B, 0x04, 0x01, 0x01, 0x0B, 0x03,
+	0x01, 0x01, 0x09, 0x05, 0x01, 0x01, 0x08, 0x05, 0x01, 0x01, 0x03, 0x09, 0x01, 0x01, 0x02, 0x08,
+	0x01, 0x01, 0x02, 0x06, 0x0A, 0x00,
+	// @1924 0x3A (5 pixels wide)
+	0x0F, 0x00, 0x01, 0x01, 0x02, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x01, 0x03, 0x09, 0x00,
+	0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 0x03, 0x02, 0x01, 0x00, 0x05, 0x01, 0x01, 0x01, 0x03,
+	0x0A, 0x00,
+	// @1958 0x3B (4 pixels wide)
+	0x0D, 0x00, 0x04, 0x01, 0x00, 0x04, 0x0D, 0x00, 0x04, 0x01, 0x00, 0x04, 0x03, 0x01, 0x02, 0x02,
+	0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x00, 0x03, 0x01, 0x01, 0x00, 0x02, 0x04, 0x00,
+	// @1988 0x3C (18 pixels wide)
+	0x0D, 0x00, 0x01, 0x01, 0x11, 0x01, 0x01, 0x01, 0x0F, 0x03, 0x01, 0x01, 0x0D, 0x05, 0x01, 0x01,
+	0x0B, 0x05, 0x01, 0x01, 0x09, 0x05, 0x01, 0x01, 0x07, 0x05, 0x01, 0x01, 0x05, 0x05, 0x01, 0x01,
+	0x03, 0x05, 0x01, 0x01, 0x01, 0x05, 0x01, 0x01, 0x00, 0x04, 0x01, 0x01, 0x00, 0x03, 0x01, 0x01,
+	0x00, 0x05, 0x01, 0x01, 0x02, 0x05, 0x01, 0x01, 0x04, 0x05, 0x01, 0x01, 0x06, 0x05, 0x01, 0x01,
+	0x08, 0x05, 0x01, 0x01, 0x09, 0x06, 0x01, 0x01, 0x0B, 0x06, 0x01, 0x01, 0x0D, 0x05, 0x01, 0x01,
+	0x0F, 0x03, 0x01, 0x01, 0x11, 0x01, 0x0A, 0x00,
+	// @2076 0x3D (20 pixels wide)
+	0x12, 0x00, 0x03, 0x01, 0x00, 0x14, 0x05, 0x00, 0x02, 0x01, 0x00, 0x14, 0x10, 0x00,
+	// @2090 0x3E (18 pixels wide)
+	0x0D, 0x00, 0x01, 0x01, 0x00, 0x01, 0x01, 0x01, 0x00, 0x03, 0x01, 0x01, 0x00, 0x05, 0x01, 0x01,
+	0x02, 0x05, 0x01, 0x01, 0x04, 0x05, 0x01, 0x01, 0x06, 0x05, 0x01, 0x01, 0x08, 0x05, 0x01, 0x01,
+	0x0A, 0x05, 0x01, 0x01, 0x0C, 0x05, 0x01, 0x01, 0x0E, 0x04, 0x01, 0x01, 0x0F, 0x03, 0x01, 0x01,
+	0x0D, 0x05, 0x01, 0x01, 0x0B, 0x05, 0x01, 0x01, 0x09, 0x05, 0x01, 0x01, 0x07, 0x05, 0x01, 0x01,
+	0x05, 0x05, 0x01, 0x01, 0x03, 0x05, 0x01, 0x01, 0x01, 0x05, 0x01, 0x01, 0x00, 0x05, 0x01, 0x01,
+	0x00, 0x03, 0x01, 0x01, 0x00, 0x01, 0x0A, 0x00,
+	// @2178 0x3F (12 pixels wide)
+	0x07, 0x00, 0x01, 0x01, 0x01, 0x09, 0x01, 0x01, 0x00, 0x0B, 0x01, 0x02, 0x01, 0x03, 0x02, 0x06,
+	0x01, 0x01, 0x08, 0x04, 0x04, 0x01, 0x09, 0x03, 0x01, 0x01, 0x08, 0x04, 0x01, 0x01, 0x07, 0x04,
+	0x01, 0x01, 0x07, 0x03, 0x01, 0x01, 0x06, 0x04, 0x01, 0x01, 0x05, 0x04, 0x01, 0x01, 0x05, 0x03,
+	0x01, 0x01, 0x04, 0x04, 0x04, 0x01, 0x04, 0x03, 0x03, 0x00, 0x01, 0x01, 0x05, 0x01, 0x04, 0x01,
+	0x03, 0x04, 0x0A, 0x00,
+	// @2246 0x40 (26 pixels wide)
+	0x0A, 0x00, 0x01, 0x01, 0x0C, 0x05, 0x01, 0x01, 0x08, 0x0C, 0x01, 0x02, 0x07, 0x04, 0x06, 0x04,
+	0x01, 0x02, 0x05, 0x03, 0x0B, 0x04, 0x01, 0x02, 0x04, 0x03, 0x0E, 0x03, 0x01, 0x02, 0x03, 0x03,
+	0x10, 0x02, 0x01, 0x02, 0x02, 0x03, 0x11, 0x03, 0x01, 0x03, 0x02, 0x02, 0x08, 0x07, 0x04, 0x02,
+	0x01, 0x03, 0x01, 0x03, 0x06, 0x09, 0x04, 0x03, 0x01, 0x04, 0x01, 0x02, 0x06, 0x03, 0x05, 0x02,
+	0x04, 0x03, 0x01, 0x04, 0x00, 0x03, 0x05, 0x03, 0x06, 0x02, 0x05, 0x02, 0x01, 0x04, 0x00, 0x02,
+	0x05, 0x03, 0x06, 0x03, 0x05, 0x02, 0x01, 0x04, 0x00, 0x02, 0x05, 0x02, 0x07, 0x03, 0x05, 0x02,
+	0x01, 0x04, 0x00, 0x02, 0x04, 0x03, 0x07, 0x02, 0x06, 0x02, 0x01, 0x04, 0x00, 0x02, 0x04, 0x03,
+	0x07, 0x02, 0x05, 0x03, 0x02, 0x04, 0x00, 0x02, 0x04, 0x02, 0x07, 0x03, 0x05, 0x02, 0x01, 0x04,
+	0x00, 0x02, 0x04, 0x03, 0x05, 0x04, 0x04, 0x03, 0x01, 0x05, 0x00, 0x02, 0x04, 0x03, 0x04, 0x02,
+	0x01, 0x02, 0x04, 0x02, 0x01, 0x03, 0x00, 0x03, 0x04, 0x08, 0x01, 0x07, 0x01, 0x03, 0x01, 0x02,
+	0x04, 0x06, 0x04, 0x05, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x03, 0x01, 0x01, 0x02, 0x03,
+	0x01, 0x01, 0x03, 0x03, 0x01, 0x02, 0x04, 0x04, 0x09, 0x02, 0x01, 0x01, 0x05, 0x0E, 0x01, 0x01,
+	0x08, 0x09, 0x06, 0x00,
+	// @2442 0x41 (22 pixels wide)
+	0x07, 0x00, 0x02, 0x01, 0x09, 0x05, 0x01, 0x01, 0x08, 0x06, 0x01, 0x01, 0x08, 0x07, 0x01, 0x02,
+	0x08, 0x03, 0x01, 0x03, 0x01, 0x02, 0x07, 0x03, 0x02, 0x03, 0x02, 0x02, 0x07, 0x03, 0x02, 0x04,
+	0x01, 0x02, 0x06, 0x04, 0x03, 0x03, 0x02, 0x02, 0x06, 0x03, 0x04, 0x04, 0x01, 0x02, 0x05, 0x04,
+	0x05, 0x03, 0x02, 0x02, 0x05, 0x03, 0x06, 0x04, 0x01, 0x02, 0x04, 0x04, 0x07, 0x03, 0x01, 0x02,
+	0x04, 0x03, 0x08, 0x04, 0x01, 0x01, 0x04, 0x0F, 0x01, 0x01, 0x03, 0x10, 0x01, 0x01, 0x03, 0x11,
+	0x01, 0x02, 0x03, 0x03, 0x0A, 0x04, 0x01, 0x02, 0x02, 0x04, 0x0B, 0x03, 0x02, 0x02, 0x02, 0x03,
+	0x0C, 0x04, 0x01, 0x02, 0x01, 0x04, 0x0D, 0x03, 0x02, 0x02, 0x01, 0x03, 0x0E, 0x04, 0x01, 0x02,
+	0x00, 0x04, 0x0F, 0x03, 0x0A, 0x00,
+	// @2560 0x42 (17 pixels wide)
+	0x07, 0x00, 0x01, 0x01, 0x00, 0x0B, 0x01, 0x01, 0x00, 0x0D, 0x01, 0x01, 0x00, 0x0F, 0x01, 0x02,
+	0x00, 0x04, 0x07, 0x04, 0x05, 0x02, 0x00, 0x04, 0x08, 0x04, 0x01, 0x02, 0x00, 0x04, 0x08, 0x03,
+	0x01, 0x02, 0x00, 0x04, 0x07, 0x04, 0x01, 0x01, 0x00, 0x0D, 0x01, 0x01, 0x00, 0x0B, 0x01, 0x01,
+	0x00, 0x0E, 0x01, 0x02, 0x00, 0x04, 0x06, 0x05, 0x01, 0x02, 0x00, 0x04, 0x08, 0x04, 0x01, 0x02,
+	0x00, 0x04, 0x09, 0x03, 0x05, 0x02, 0x00, 0x04, 0x09, 0x04, 0x01, 0x02, 0x00, 0x04, 0x08, 0x04,
+	0x01, 0x02, 0x00, 0x04, 0x07, 0x05, 0x01, 0x02, 0x00, 0x05, 0x02, 0x08, 0x01, 0x01, 0x00, 0x0E,
+	0x01, 0x01, 0x00, 0x0B, 0x0A, 0x00,
+	// @2662 0x43 (21 pixels wide)
+	0x07, 0x00, 0x01, 0x01, 0x09, 0x0B, 0x01, 0x01, 0x07, 0x0E, 0x01, 0x01, 0x06, 0x0E, 0x01, 0x01,
+	0x04, 0x06, 0x01, 0x01, 0x03, 0x05, 0x01, 0x01, 0x03, 0x04, 0x02, 0x01, 0x02, 0x04, 0x02, 0x01,
+	0x01, 0x04, 0x02, 0x01, 0x01, 0x03, 0x03, 0x01, 0x00, 0x04, 0x02, 0x01, 0x01, 0x03, 0x03, 0x01,
+	0x01, 0x04, 0x01, 0x01, 0x02, 0x04, 0x01, 0x01, 0x02, 0x05, 0x01, 0x01, 0x03, 0x05, 0x01, 0x01,
+	0x04, 0x06, 0x01, 0x01, 0x05, 0x0F, 0x01, 0x01, 0x06, 0x0F, 0x01, 0x01, 0x08, 0x0C, 0x0A, 0x00,
+	// @2742 0x44 (22 pixels wide)
+	0x07, 0x00, 0x01, 0x01, 0x00, 0x0D, 0x01, 0x01, 0x00, 0x10, 0x01, 0x01, 0x00, 0x12, 0x01, 0x02,
+	0x00, 0x04, 0x09, 0x06, 0x01, 0x02, 0x00, 0x04, 0x0B, 0x05, 0x01, 0x02, 0x00, 0x04, 0x0C, 0x04,
+	0x02, 0x02, 0x00, 0x04, 0x0D, 0x04, 0x04, 0x02, 0x00, 0x04, 0x0E, 0x04, 0x02, 0x02, 0x00, 0x04,
+	0x0F, 0x03, 0x04, 0x02, 0x00, 0x04, 0x0E, 0x04, 0x01, 0x02, 0x00, 0x04, 0x0E, 0x03, 0x01, 0x02,
+	0x00, 0x04, 0x0D, 0x04, 0x02, 0x02, 0x00, 0x04, 0x0C, 0x04, 0x01, 0x02, 0x00, 0x04, 0x0A, 0x05,
+	0x01, 0x02, 0x00, 0x04, 0x08, 0x06, 0x01, 0x01, 0x00, 0x11, 0x01, 0x01, 0x00, 0x0F, 0x01, 0x01,
+	0x00, 0x0D, 0x0A, 0x00,
+	// @2842 0x45 (15 pixels wide)
+	0x07, 0x00, 0x03, 0x01, 0x00, 0x0F, 0x08, 0x01, 0x00, 0x04, 0x03, 0x01, 0x00, 0x0E, 0x0A, 0x01,
+	0x00, 0x04, 0x03, 0x01, 0x00, 0x0F, 0x0A, 0x00,
+	// @2866 0x46 (15 pixels wide)
+	0x07, 0x00, 0x03, 0x01, 0x00, 0x0F, 0x09, 0x01, 0x00, 0x04, 0x03, 0x01, 0x00, 0x0E, 0x0C, 0x01,
+	0x00, 0x04, 0x0A, 0x00,
+	// @2886 0x47 (23 pixels wide)
+	0x07, 0x00, 0x01, 0x01, 0x0A, 0x0A, 0x01, 0x01, 0x07, 0x0F, 0x01, 0x01, 0x06, 0x0F, 0x01, 0x02,
+	0x05, 0x05, 0x0A, 0x01, 0x01, 0x01, 0x04, 0x04, 0x01, 0x01, 0x03, 0x04, 0x02, 0x01, 0x02, 0x04,
+	0x02, 0x01, 0x01, 0x04, 0x02, 0x01, 0x01, 0x03, 0x01, 0x01, 0x00, 0x04, 0x02, 0x02, 0x00, 0x04,
+	0x0A, 0x09, 0x01, 0x02, 0x01, 0x03, 0x0A, 0x09, 0x01, 0x02, 0x01, 0x03, 0x0F, 0x04, 0x03, 0x02,
+	0x01, 0x04, 0x0E, 0x04, 0x01, 0x02, 0x02, 0x04, 0x0D, 0x04, 0x01, 0x02, 0x02, 0x05, 0x0C, 0x04,
+	0x01, 0x02, 0x03, 0x05, 0x0B, 0x04, 0x01, 0x02, 0x04, 0x06, 0x09, 0x04, 0x01, 0x01, 0x05, 0x12,
+	0x01, 0x01, 0x07, 0x10, 0x01, 0x01, 0x09, 0x0B, 0x0A, 0x00,
+	// @2992 0x48 (20 pixels wide)
+	0x07, 0x00, 0x0B, 0x02, 0x00, 0x04, 0x0D, 0x03, 0x03, 0x01, 0x00, 0x14, 0x0D, 0x02, 0x00, 0x04,
+	0x0D, 0x03, 0x0A, 0x00,
+	// @3012 0x49 (4 pixels wide)
+	0x07, 0x00, 0x1B, 0x01, 0x00, 0x04, 0x0A, 0x00,
+	// @3020 0x4A (12 pixels wide)
+	0x07, 0x00, 0x13, 0x01, 0x09, 0x03, 0x03, 0x01, 0x08, 0x04, 0x01, 0x01, 0x08, 0x03, 0x01, 0x01,
+	0x07, 0x04, 0x01, 0x01, 0x01, 0x09, 0x01, 0x01, 0x00, 0x0A, 0x01, 0x01, 0x00, 0x08, 0x0A, 0x00,
+	// @3052 0x4B (19 pixels wide)
+	0x07, 0x00, 0x01, 0x02, 0x00, 0x04, 0x0A, 0x04, 0x01, 0x02, 0x00, 0x04, 0x09, 0x04, 0x01, 0x02,
+	0x00, 0x04, 0x08, 0x04, 0x01, 0x02, 0x00, 0x04, 0x07, 0x04, 0x01, 0x02, 0x00, 0x04, 0x06, 0x05,
+	0x01, 0x02, 0x00, 0x04, 0x06, 0x04, 0x01, 0x02, 0x00, 0x04, 0x05, 0x04, 0x01, 0x02, 0x00, 0x04,
+	0x04, 0x04, 0x01, 0x02, 0x00, 0x04, 0x03, 0x04, 0x01, 0x02, 0x00, 0x04, 0x02, 0x04, 0x02, 0x02,
+	0x00, 0x04, 0x01, 0x04, 0x01, 0x01, 0x00, 0x09, 0x01, 0x01, 0x00, 0x0A, 0x02, 0x02, 0x00, 0x05,
+	0x02, 0x04, 0x01, 0x02, 0x00, 0x04, 0x04, 0x04, 0x02, 0x02, 0x00, 0x04, 0x05, 0x04, 0x01, 0x02,
+	0x00, 0x04, 0x06, 0x04, 0x02, 0x02, 0x00, 0x04, 0x07, 0x04, 0x01, 0x02, 0x00, 0x04, 0x08, 0x04,
+	0x02, 0x02, 0x00, 0x04, 0x09, 0x04, 0x01, 0x02, 0x00, 0x04, 0x0A, 0x04, 0x01, 0x02, 0x00, 0x04,
+	0x0B, 0x04, 0x0A, 0x00,
+	// @3184 0x4C (15 pixels wide)
+	0x07, 0x00, 0x18, 0x01, 0x00, 0x04, 0x03, 0x01, 0x00, 0x0F, 0x0A, 0x00,
+	// @3196 0x4D (28 pixels wide)
+	0x07, 0x00, 0x01, 0x02, 0x02, 0x05, 0x0F, 0x04, 0x01, 0x02, 0x02, 0x05, 0x0E, 0x05, 0x01, 0x02,
+	0x02, 0x06, 0x0D, 0x05, 0x02, 0x02, 0x02, 0x06, 0x0C, 0x06, 0x01, 0x02, 0x02, 0x07, 0x0B, 0x07,
+	0x02, 0x04, 0x02, 0x03, 0x01, 0x03, 0x0A, 0x03, 0x01, 0x04, 0x01, 0x04, 0x02, 0x03, 0x01, 0x04,
+	0x09, 0x03, 0x01, 0x04, 0x01, 0x04, 0x02, 0x03, 0x02, 0x03, 0x08, 0x03, 0x02, 0x04, 0x01, 0x04,
+	0x01, 0x04, 0x02, 0x03, 0x08, 0x03, 0x02, 0x04, 0x01, 0x04, 0x01, 0x04, 0x02, 0x04, 0x07, 0x03,
+	0x03, 0x03, 0x01, 0x04, 0x01, 0x04, 0x03, 0x03, 0x06, 0x03, 0x04, 0x03, 0x01, 0x04, 0x01, 0x03,
+	0x04, 0x03, 0x06, 0x03, 0x04, 0x03, 0x01, 0x04, 0x01, 0x03, 0x04, 0x04, 0x04, 0x04, 0x04, 0x03,
+	0x02, 0x04, 0x01, 0x03, 0x05, 0x03, 0x04, 0x03, 0x05, 0x03, 0x01, 0x04, 0x01, 0x03, 0x05, 0x04,
+	0x02, 0x03, 0x06, 0x03, 0x02, 0x04, 0x01, 0x03, 0x06, 0x03, 0x02, 0x03, 0x06, 0x03, 0x01, 0x04,
+	0x01, 0x03, 0x06, 0x04, 0x01, 0x02, 0x07, 0x03, 0x02, 0x03, 0x01, 0x03, 0x07, 0x06, 0x07, 0x04,
+	0x01, 0x03, 0x01, 0x03, 0x07, 0x05, 0x08, 0x04, 0x01, 0x03, 0x01, 0x03, 0x08, 0x04, 0x08, 0x04,
+	0x01, 0x03, 0x00, 0x04, 0x08, 0x04, 0x08, 0x04, 0x01, 0x03, 0x00, 0x04, 0x08, 0x03, 0x09, 0x04,
+	0x0A, 0x00,
+	// @3390 0x4E (20 pixels wide)
+	0x07, 0x00, 0x01, 0x02, 0x00, 0x04, 0x0D, 0x03, 0x02, 0x02, 0x00, 0x05, 0x0C, 0x03, 0x01, 0x02,
+	0x00, 0x06, 0x0B, 0x03, 0x01, 0x02, 0x00, 0x07, 0x0A, 0x03, 0x01, 0x03, 0x00, 0x03, 0x01, 0x03,
+	0x0A, 0x03, 0x01, 0x03, 0x00, 0x03, 0x01, 0x04, 0x09, 0x03, 0x02, 0x03, 0x00, 0x03, 0x02, 0x04,
+	0x08, 0x03, 0x02, 0x03, 0x00, 0x03, 0x03, 0x04, 0x07, 0x03, 0x01, 0x03, 0x00, 0x03, 0x04, 0x04,
+	0x06, 0x03, 0x02, 0x03, 0x00, 0x03, 0x05, 0x04, 0x05, 0x03, 0x01, 0x03, 0x00, 0x03, 0x06, 0x04,
+	0x04, 0x03, 0x02, 0x03, 0x00, 0x03, 0x07, 0x04, 0x03, 0x03, 0x02, 0x03, 0x00, 0x03, 0x08, 0x04,
+	0x02, 0x03, 0x01, 0x03, 0x00, 0x03, 0x09, 0x04, 0x01, 0x03, 0x01, 0x03, 0x00, 0x03, 0x0A, 0x03,
+	0x01, 0x03, 0x01, 0x02, 0x00, 0x03, 0x0A, 0x07, 0x01, 0x02, 0x00, 0x03, 0x0B, 0x06, 0x02, 0x02,
+	0x00, 0x03, 0x0C, 0x05, 0x02, 0x02, 0x00, 0x03, 0x0D, 0x04, 0x0A, 0x00,
+	// @3530 0x4F (25 pixels wide)
+	0x07, 0x00, 0x01, 0x01, 0x08, 0x0A, 0x01, 0x01, 0x06, 0x0E, 0x01, 0x02, 0x05, 0x07, 0x02, 0x07,
+	0x01, 0x02, 0x04, 0x05, 0x08, 0x05, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x05, 0x01, 0x02, 0x02, 0x05,
+	0x0C, 0x04, 0x01, 0x02, 0x02, 0x04, 0x0E, 0x04, 0x01, 0x02, 0x02, 0x03, 0x0F, 0x04, 0x01, 0x02,
+	0x01, 0x04, 0x10, 0x03, 0x01, 0x02, 0x01, 0x04, 0x10, 0x04, 0x02, 0x02, 0x01, 0x03, 0x11, 0x04,
+	0x03, 0x02, 0x00, 0x04, 0x11, 0x04, 0x02, 0x02, 0x01, 0x03, 0x11, 0x04, 0x01, 0x02, 0x01, 0x04,
+	0x10, 0x04, 0x01, 0x02, 0x01, 0x04, 0x10, 0x03, 0x01, 0x02, 0x01, 0x04, 0x0F, 0x04, 0x01, 0x02,
+	0x02, 0x04, 0x0E, 0x04, 0x01, 0x02, 0x02, 0x05, 0x0C, 0x04, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x04,
+	0x01, 0x02, 0x04, 0x05, 0x08, 0x05, 0x01, 0x02, 0x05, 0x06, 0x03, 0x07, 0x01, 0x01, 0x06, 0x0D,
+	0x01, 0x01, 0x08, 0x0A, 0x0A, 0x00,
+	// @3664 0x50 (17 pixels wide)
+	0x07, 0x00, 0x01, 0x01, 0x00, 0x0B, 0x01, 0x01, 0x00, 0x0E, 0x01, 0x01, 0x00, 0x0F, 0x01, 0x02,
+	0x00, 0x04, 0x07, 0x05, 0x01, 0x02, 0x00, 0x04, 0x08, 0x04, 0x01, 0x02, 0x00, 0x04, 0x09, 0x03,
+	0x04, 0x02, 0x00, 0x04, 0x09, 0x04, 0x01, 0x02, 0x00, 0x04, 0x09, 0x03, 0x01, 0x02, 0x00, 0x04,
+	0x08, 0x04, 0x01, 0x02, 0x00, 0x04, 0x07, 0x04, 0x01, 0x02, 0x00, 0x05, 0x03, 0x07, 0x01, 0x01,
+	0x00, 0x0D, 0x01, 0x01, 0x00, 0x0C, 0x0B, 0x01, 0x00, 0x04, 0x0A, 0x00,
+	// @3740 0x51 (25 pixels wide)
+	0x07, 0x00, 0x01, 0x01, 0x08, 0x0A, 0x01, 0x01, 0x06, 0x0E, 0x01, 0x02, 0x05, 0x07, 0x02, 0x07,
+	0x01, 0x02, 0x04, 0x05, 0x08, 0x05, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x05, 0x01, 0x02, 0x02, 0x05,
+	0x0C, 0x04, 0x01, 0x02, 0x02, 0x04, 0x0E, 0x04, 0x01, 0x02, 0x02, 0x03, 0x0F, 0x04, 0x01, 0x02,
+	0x01, 0x04, 0x10, 0x03, 0x01, 0x02, 0x01, 0x04, 0x10, 0x04, 0x02, 0x02, 0x01, 0x03, 0x11, 0x04,
+	0x03, 0x02, 0x00, 0x04, 0x11, 0x04, 0x02, 0x02, 0x01, 0x03, 0x11, 0x04, 0x01, 0x02, 0x01, 0x04,
+	0x10, 0x04, 0x01, 0x02, 0x01, 0x04, 0x10, 0x03, 0x01, 0x02, 0x01, 0x04, 0x0F, 0x04, 0x01, 0x02,
+	0x02, 0x04, 0x0E, 0x04, 0x01, 0x02, 0x02, 0x05, 0x0C, 0x04, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x04,
+	0x01, 0x02, 0x04, 0x05, 0x08, 0x05, 0x01, 0x02, 0x05, 0x06, 0x03, 0x06, 0x01, 0x01, 0x06, 0x0D,
+	0x01, 0x01, 0x08, 0x0A, 0x01, 0x01, 0x0D, 0x0A, 0x01, 0x01, 0x10, 0x09, 0x01, 0x01, 0x13, 0x06,
+	0x01, 0x01, 0x17, 0x01, 0x06, 0x00,
+	// @3890 0x52 (17 pixels wide)
+	0x07, 0x00, 0x01, 0x01, 0x00, 0x0C, 0x01, 0x01, 0x00, 0x0E, 0x01, 0x01, 0x00, 0x0F, 0x01, 0x02,
+	0x00, 0x04, 0x07, 0x05, 0x01, 0x02, 0x00, 0x04, 0x08, 0x04, 0x04, 0x02, 0x00, 0x04, 0x09, 0x04,
+	0x01, 0x02, 0x00, 0x04, 0x09, 0x03, 0x01, 0x02, 0x00, 0x04, 0x08, 0x04, 0x01, 0x02, 0x00, 0x04,
+	0x07, 0x04, 0x01, 0x02, 0x00, 0x04, 0x05, 0x05, 0x01, 0x01, 0x00, 0x0D, 0x01, 0x01, 0x00, 0x0C,
+	0x01, 0x02, 0x00, 0x04, 0x04, 0x06, 0x01, 0x02, 0x00, 0x04, 0x06, 0x04, 0x01, 0x02, 0x00, 0x04,
+	0x07, 0x04, 0x01, 0x02, 0x00, 0x04, 0x08, 0x03, 0x03, 0x02, 0x00, 0x04, 0x08, 0x04, 0x01, 0x02,
+	0x00, 0x04, 0x09, 0x03, 0x03, 0x02, 0x00, 0x04, 0x09, 0x04, 0x01, 0x02, 0x00, 0x04, 0x0A, 0x03,
+	0x0A, 0x00,
+	// @4004 0x53 (16 pixels wide)
+	0x07, 0x00, 0x01, 0x01, 0x05, 0x09, 0x01, 0x01, 0x03, 0x0C, 0x01, 0x01, 0x02, 0x0C, 0x01, 0x02,
+	0x01, 0x04, 0x08, 0x01, 0x01, 0x01, 0x01, 0x03, 0x04, 0x01, 0x00, 0x04, 0x01, 0x01, 0x01, 0x04,
+	0x01, 0x01, 0x01, 0x05, 0x01, 0x01, 0x02, 0x07, 0x01, 0x01, 0x03, 0x08, 0x01, 0x01, 0x05, 0x08,
+	0x01, 0x01, 0x07, 0x07, 0x01, 0x01, 0x09, 0x06, 0x01, 0x01, 0x0B, 0x04, 0x05, 0x01, 0x0C, 0x04,
+	0x01, 0x01, 0x0C, 0x03, 0x01, 0x02, 0x00, 0x02, 0x09, 0x04, 0x01, 0x01, 0x00, 0x0E, 0x01, 0x01,
+	0x00, 0x0D, 0x01, 0x01, 0x01, 0x0A, 0x0A, 0x00,
+	// @4092 0x54 (20 pixels wide)
+	0x07, 0x00, 0x03, 0x01, 0x00, 0x14, 0x18, 0x01, 0x08, 0x04, 0x0A, 0x00,
+	// @4104 0x55 (20 pixels wide)
+	0x07, 0x00, 0x14, 0x02, 0x00, 0x04, 0x0C, 0x04, 0x01, 0x02, 0x01, 0x03, 0x0C, 0x03, 0x02, 0x02,
+	0x01, 0x04, 0x0A, 0x04, 0x01, 0x02, 0x02, 0x04, 0x08, 0x04, 0x01, 0x02, 0x02, 0x07, 0x02, 0x06,
+	0x01, 0x01, 0x03, 0x0D, 0x01, 0x01, 0x05, 0x09, 0x0A, 0x00,
+	// @4146 0x56 (22 pixels wide)
+	0x07, 0x00, 0x01, 0x02, 0x00, 0x04, 0x0F, 0x03, 0x01, 0x02, 0x01, 0x03, 0x0E, 0x04, 0x01, 0x02,
+	0x01, 0x04, 0x0D, 0x04, 0x01, 0x02, 0x01, 0x04, 0x0D, 0x03, 0x01, 0x02, 0x02, 0x03, 0x0C, 0x04,
+	0x02, 0x02, 0x02, 0x04, 0x0B, 0x03, 0x01, 0x02, 0x03, 0x03, 0x0A, 0x04, 0x01, 0x02, 0x03, 0x04,
+	0x09, 0x03, 0x01, 0x02, 0x03, 0x04, 0x08, 0x04, 0x01, 0x02, 0x04, 0x03, 0x08, 0x04, 0x01, 0x02,
+	0x04, 0x04, 0x07, 0x03, 0x01, 0x02, 0x04, 0x04, 0x06, 0x04, 0x01, 0x02, 0x05, 0x03, 0x06, 0x04,
+	0x01, 0x02, 0x05, 0x03, 0x06, 0x03, 0x01, 0x02, 0x05, 0x04, 0x04, 0x04, 0x01, 0x02, 0x06, 0x03,
+	0x04, 0x04, 0x01, 0x02, 0x06, 0x03, 0x04, 0x03, 0x01, 0x02, 0x06, 0x04, 0x02, 0x04, 0x02, 0x02,
+	0x07, 0x03, 0x02, 0x03, 0x01, 0x02, 0x07, 0x04, 0x01, 0x03, 0x01, 0x01, 0x07, 0x07, 0x02, 0x01,
+	0x08, 0x06, 0x01, 0x01, 0x08, 0x05, 0x01, 0x01, 0x09, 0x04, 0x0A, 0x00,
+	// @4286 0x57 (32 pixels wide)
+	0x07, 0x00, 0x01, 0x03, 0x00, 0x03, 0x0B, 0x04, 0x0B, 0x03, 0x01, 0x03, 0x00, 0x04, 0x0A, 0x04,
+	0x0B, 0x03, 0x01, 0x03, 0x00, 0x04, 0x0A, 0x05, 0x09, 0x04, 0x01, 0x03, 0x00, 0x04, 0x09, 0x06,
+	0x09, 0x04, 0x01, 0x03, 0x01, 0x03, 0x09, 0x06, 0x09, 0x03, 0x01, 0x03, 0x01, 0x04, 0x08, 0x06,
+	0x09, 0x03, 0x01, 0x03, 0x01, 0x04, 0x08, 0x07, 0x07, 0x04, 0x01, 0x04, 0x01, 0x04, 0x07, 0x03,
+	0x02, 0x03, 0x07, 0x03, 0x01, 0x04, 0x02, 0x03, 0x07, 0x03, 0x02, 0x03, 0x07, 0x03, 0x01, 0x04,
+	0x02, 0x04, 0x06, 0x03, 0x02, 0x03, 0x06, 0x04, 0x01, 0x04, 0x02, 0x04, 0x06, 0x03, 0x02, 0x04,
+	0x05, 0x04, 0x01, 0x04, 0x03, 0x03, 0x05, 0x03, 0x03, 0x04, 0x05, 0x03, 0x01, 0x04, 0x03, 0x03,
+	0x05, 0x03, 0x04, 0x03, 0x05, 0x03, 0x01, 0x04, 0x03, 0x03, 0x05, 0x03, 0x04, 0x03, 0x04, 0x04,
+	0x01, 0x04, 0x03, 0x04, 0x04, 0x02, 0x05, 0x03, 0x04, 0x03, 0x01, 0x04, 0x04, 0x03, 0x03, 0x03,
+	0x05, 0x04, 0x03, 0x03, 0x01, 0x04, 0x04, 0x03, 0x03, 0x03, 0x06, 0x03, 0x03, 0x03, 0x01, 0x04,
+	0x04, 0x03, 0x03, 0x03, 0x06, 0x03, 0x02, 0x04, 0x01, 0x04, 0x04, 0x04, 0x02, 0x02, 0x07, 0x03,
+	0x02, 0x03, 0x01, 0x04, 0x05, 0x03, 0x01, 0x03, 0x07, 0x04, 0x01, 0x03, 0x01, 0x04, 0x05, 0x03,
+	0x01, 0x03, 0x08, 0x03, 0x01, 0x03, 0x01, 0x04, 0x05, 0x03, 0x01, 0x03, 0x08, 0x03, 0x01, 0x02,
+	0x01, 0x03, 0x05, 0x03, 0x01, 0x02, 0x09, 0x06, 0x01, 0x02, 0x06, 0x05, 0x09, 0x06, 0x01, 0x02,
+	0x06, 0x05, 0x0A, 0x05, 0x02, 0x02, 0x06, 0x04, 0x0B, 0x04, 0x0A, 0x00,
+	// @4522 0x58 (21 pixels wide)
+	0x07, 0x00, 0x02, 0x02, 0x01, 0x04, 0x0B, 0x04, 0x01, 0x02, 0x02, 0x04, 0x09, 0x04, 0x01, 0x02,
+	0x02, 0x04, 0x09, 0x03, 0x01, 0x02, 0x03, 0x04, 0x07, 0x04, 0x01, 0x02, 0x04, 0x03, 0x06, 0x04,
+	0x01, 0x02, 0x04, 0x04, 0x05, 0x04, 0x01, 0x02, 0x05, 0x04, 0x03, 0x04, 0x01, 0x02, 0x05, 0x04,
+	0x03, 0x03, 0x01, 0x02, 0x06, 0x04, 0x01, 0x04, 0x01, 0x02, 0x07, 0x03, 0x01, 0x03, 0x01, 0x01,
+	0x07, 0x06, 0x03, 0x01, 0x08, 0x05, 0x01, 0x01, 0x07, 0x07, 0x01, 0x02, 0x06, 0x04, 0x01, 0x03,
+	0x01, 0x02, 0x06, 0x03, 0x02, 0x04, 0x01, 0x02, 0x05, 0x04, 0x03, 0x04, 0x01, 0x02, 0x05, 0x03,
+	0x04, 0x04, 0x01, 0x02, 0x04, 0x04, 0x05, 0x04, 0x01, 0x02, 0x03, 0x04, 0x07, 0x04, 0x01, 0x02,
+	0x03, 0x03, 0x08, 0x04, 0x01, 0x02, 0x02, 0x04, 0x09, 0x04, 0x01, 0x02, 0x02, 0x03, 0x0A, 0x04,
+	0x01, 0x02, 0x01, 0x04, 0x0B, 0x04, 0x01, 0x02, 0x00, 0x04, 0x0D, 0x04, 0x0A, 0x00,
+	// @4664 0x59 (20 pixels wide)
+	0x07, 0x00, 0x02, 0x02, 0x00, 0x04, 0x0C, 0x04, 0x02, 0x02, 0x01, 0x04, 0x0A, 0x04, 0x01, 0x02,
+	0x02, 0x04, 0x08, 0x04, 0x01, 0x02, 0x02, 0x04, 0x08, 0x03, 0x01, 0x02, 0x03, 0x04, 0x06, 0x04,
+	0x01, 0x02, 0x04, 0x03, 0x06, 0x03, 0x01, 0x02, 0x04, 0x04, 0x04, 0x04, 0x01, 0x02, 0x05, 0x03,
+	0x04, 0x03, 0x01, 0x02, 0x05, 0x04, 0x02, 0x03, 0x01, 0x02, 0x06, 0x03, 0x02, 0x03, 0x01, 0x01,
+	0x06, 0x07, 0x01, 0x01, 0x07, 0x06, 0x01, 0x01, 0x07, 0x05, 0x0C, 0x01, 0x08, 0x04, 0x0A, 0x00,
+	// @4744 0x5A (20 pixels wide)
+	0x07, 0x00, 0x02, 0x01, 0x01, 0x13, 0x01, 0x01, 0x01, 0x12, 0x01, 0x01, 0x0F, 0x04, 0x01, 0x01,
+	0x0E, 0x04, 0x01, 0x01, 0x0E, 0x03, 0x01, 0x01, 0x0D, 0x04, 0x01, 0x01, 0x0C, 0x04, 0x02, 0x01,
+	0x0B, 0x04, 0x01, 0x01, 0x0A, 0x04, 0x02, 0x01, 0x09, 0x04, 0x01, 0x01, 0x08, 0x04, 0x02, 0x01,
+	0x07, 0x04, 0x01, 0x01, 0x06, 0x04, 0x02, 0x01, 0x05, 0x04, 0x01, 0x01, 0x04, 0x04, 0x01, 0x01,
+	0x03, 0x04, 0x01, 0x01, 0x03, 0x03, 0x01, 0x01, 0x02, 0x04, 0x01, 0x01, 0x01, 0x04, 0x01, 0x01,
+	0x01, 0x13, 0x02, 0x01, 0x00, 0x14, 0x0A, 0x00,
+	// @4832 0x5B (8 pixels wide)
+	0x07, 0x00, 0x02, 0x01, 0x00, 0x08, 0x1B, 0x01, 0x00, 0x03, 0x02, 0x01, 0x00, 0x08, 0x06, 0x00,
+	// @4848 0x5C (14 pixels wide)
+	0x07, 0x00, 0x01, 0x01, 0x00, 0x03, 0x02, 0x01, 0x01, 0x03, 0x01, 0x01, 0x02, 0x02, 0x02, 0x01,
+	0x02, 0x03, 0x01, 0x01, 0x03, 0x02, 0x02, 0x01, 0x03, 0x03, 0x02, 0x01, 0x04, 0x03, 0x01, 0x01,
+	0x05, 0x02, 0x02, 0x01, 0x05, 0x03, 0x01, 0x01, 0x06, 0x02, 0x02, 0x01, 0x06, 0x03, 0x02, 0x01,
+	0x07, 0x03, 0x01, 0x01, 0x08, 0x02, 0x02, 0x01, 0x08, 0x03, 0x01, 0x01, 0x09, 0x02, 0x02, 0x01,
+	0x09, 0x03, 0x02, 0x01, 0x0A, 0x03, 0x01, 0x01, 0x0B, 0x02, 0x01, 0x01, 0x0B, 0x03, 0x08, 0x00,
+	// @4928 0x5D (7 pixels wide)
+	0x07, 0x00, 0x02, 0x01, 0x00, 0x07, 0x1B, 0x01, 0x04, 0x03, 0x02, 0x01, 0x00, 0x07, 0x06, 0x00,
+	// @4944 0x5E (18 pixels wide)
+	0x08, 0x00, 0x01, 0x01, 0x07, 0x03, 0x02, 0x01, 0x07, 0x04, 0x01, 0x01, 0x06, 0x06, 0x01, 0x02,
+	0x06, 0x02, 0x02, 0x02, 0x01, 0x02, 0x05, 0x03, 0x02, 0x03, 0x01, 0x02, 0x05, 0x02, 0x04, 0x02,
+	0x01, 0x02, 0x04, 0x03, 0x04, 0x03, 0x01, 0x02, 0x04, 0x02, 0x05, 0x03, 0x01, 0x02, 0x03, 0x03,
+	0x06, 0x02, 0x01, 0x02, 0x03, 0x03, 0x06, 0x03, 0x01, 0x02, 0x03, 0x02, 0x08, 0x02, 0x01, 0x02,
+	0x02, 0x03, 0x08, 0x03, 0x01, 0x02, 0x02, 0x02, 0x0A, 0x02, 0x01, 0x02, 0x01, 0x03, 0x0A, 0x03,
+	0x01, 0x02, 0x01, 0x02, 0x0B, 0x03, 0x02, 0x02, 0x00, 0x03, 0x0C, 0x03, 0x12, 0x00,
+	// @5038 0x5F (20 pixels wide)
+	0x25, 0x00, 0x02, 0x01, 0x00, 0x14, 0x05, 0x00,
+	// @5046 0x60 (7 pixels wide)
+	0x06, 0x00, 0x01, 0x01, 0x00, 0x04, 0x01, 0x01, 0x01, 0x03, 0x01, 0x01, 0x02, 0x03, 0x02, 0x01,
+	0x03, 0x03, 0x01, 0x01, 0x04, 0x03, 0x20, 0x00,
+	// @5070 0x61 (16 pixels wide)
+	0x0E, 0x00, 0x01, 0x01, 0x05, 0x06, 0x01, 0x01, 0x02, 0x0B, 0x01, 0x01, 0x02, 0x0C, 0x01, 0x02,
+	0x02, 0x02, 0x06, 0x05, 0x01, 0x01, 0x0B, 0x04, 0x02, 0x01, 0x0C, 0x03, 0x01, 0x01, 0x0C, 0x04,
+	0x01, 0x01, 0x06, 0x0A, 0x01, 0x01, 0x03, 0x0D, 0x01, 0x02, 0x02, 0x06, 0x04, 0x04, 0x01, 0x02,
+	0x01, 0x04, 0x07, 0x04, 0x02, 0x02, 0x01, 0x03, 0x08, 0x04, 0x02, 0x02, 0x00, 0x04, 0x08, 0x04,
+	0x01, 0x02, 0x01, 0x03, 0x07, 0x05, 0x01, 0x02, 0x01, 0x05, 0x03, 0x07, 0x01, 0x02, 0x02, 0x09,
+	0x01, 0x04, 0x01, 0x02, 0x03, 0x07, 0x03, 0x03, 0x0A, 0x00,
+	// @5160 0x62 (18 pixels wide)
+	0x06, 0x00, 0x08, 0x01, 0x00, 0x03, 0x01, 0x02, 0x00, 0x03, 0x05, 0x04, 0x01, 0x02, 0x00, 0x03,
+	0x02, 0x09, 0x01, 0x02, 0x00, 0x03, 0x01, 0x0C, 0x01, 0x03, 0x00, 0x03, 0x01, 0x03, 0x04, 0x05,
+	0x01, 0x02, 0x00, 0x05, 0x08, 0x04, 0x03, 0x02, 0x00, 0x04, 0x0A, 0x04, 0x05, 0x02, 0x00, 0x03,
+	0x0C, 0x03, 0x02, 0x02, 0x00, 0x04, 0x0A, 0x04, 0x01, 0x02, 0x00, 0x05, 0x08, 0x04, 0x01, 0x02,
+	0x00, 0x06, 0x06, 0x05, 0x01, 0x03, 0x00, 0x03, 0x01, 0x04, 0x02, 0x06, 0x01, 0x02, 0x00, 0x03,
+	0x01, 0x0B, 0x01, 0x02, 0x00, 0x03, 0x03, 0x07, 0x0A, 0x00,
+	// @5250 0x63 (15 pixels wide)
+	0x0E, 0x00, 0x01, 0x01, 0x07, 0x06, 0x01, 0x01, 0x04, 0x0B, 0x01, 0x01, 0x03, 0x0B, 0x01, 0x02,
+	0x02, 0x05, 0x06, 0x01, 0x01, 0x01, 0x01, 0x05, 0x01, 0x01, 0x01, 0x04, 0x02, 0x01, 0x00, 0x04,
+	0x05, 0x01, 0x00, 0x03, 0x02, 0x01, 0x00, 0x04, 0x01, 0x01, 0x01, 0x04, 0x01, 0x01, 0x01, 0x05,
+	0x01, 0x02, 0x02, 0x07, 0x02, 0x03, 0x01, 0x01, 0x03, 0x0C, 0x01, 0x01, 0x05, 0x09, 0x0A, 0x00,
+	// @5314 0x64 (18 pixels wide)
+	0x06, 0x00, 0x08, 0x01, 0x0E, 0x04, 0x01, 0x02, 0x06, 0x05, 0x03, 0x04, 0x01, 0x02, 0x04, 0x09,
+	0x01, 0x04, 0x01, 0x01, 0x03, 0x0F, 0x01, 0x02, 0x02, 0x04, 0x05, 0x07, 0x01, 0x02, 0x01, 0x04,
+	0x08, 0x05, 0x01, 0x02, 0x00, 0x04, 0x09, 0x05, 0x01, 0x02, 0x00, 0x04, 0x0A, 0x04, 0x06, 0x02,
+	0x00, 0x03, 0x0B, 0x04, 0x02, 0x02, 0x00, 0x04, 0x0A, 0x04, 0x01, 0x02, 0x01, 0x04, 0x08, 0x05,
+	0x01, 0x02, 0x01, 0x04, 0x07, 0x06, 0x01, 0x03, 0x02, 0x06, 0x02, 0x04, 0x01, 0x03, 0x01, 0x02,
+	0x03, 0x0A, 0x02, 0x03, 0x01, 0x02, 0x04, 0x08, 0x03, 0x03, 0x0A, 0x00,
+	// @5406 0x65 (17 pixels wide)
+	0x0E, 0x00, 0x01, 0x01, 0x06, 0x05, 0x01, 0x01, 0x04, 0x09, 0x01, 0x01, 0x03, 0x0B, 0x01, 0x02,
+	0x02, 0x04, 0x05, 0x04, 0x01, 0x02, 0x01, 0x04, 0x07, 0x04, 0x01, 0x02, 0x01, 0x03, 0x09, 0x03,
+	0x02, 0x02, 0x00, 0x03, 0x0A, 0x03, 0x03, 0x01, 0x00, 0x11, 0x03, 0x01, 0x00, 0x03, 0x01, 0x01,
+	0x00, 0x04, 0x01, 0x01, 0x01, 0x03, 0x01, 0x01, 0x01, 0x04, 0x01, 0x02, 0x02, 0x06, 0x04, 0x03,
+	0x01, 0x01, 0x03, 0x0C, 0x01, 0x01, 0x05, 0x0A, 0x0A, 0x00,
+	// @5480 0x66 (12 pixels wide)
+	0x05, 0x00, 0x01, 0x01, 0x07, 0x05, 0x01, 0x01, 0x05, 0x07, 0x01, 0x01, 0x04, 0x08, 0x01, 0x01,
+	0x03, 0x05, 0x01, 0x01, 0x03, 0x04, 0x01, 0x01, 0x03, 0x03, 0x04, 0x01, 0x02, 0x04, 0x02, 0x01,
+	0x00, 0x0A, 0x11, 0x01, 0x02, 0x04, 0x0A, 0x00,
+	// @5520 0x67 (18 pixels wide)
+	0x0E, 0x00, 0x01, 0x01, 0x06, 0x05, 0x01, 0x02, 0x04, 0x09, 0x01, 0x04, 0x01, 0x01, 0x03, 0x0F,
+	0x01, 0x02, 0x02, 0x04, 0x05, 0x06, 0x01, 0x02, 0x01, 0x04, 0x08, 0x04, 0x01, 0x02, 0x00, 0x04,
+	0x09, 0x04, 0x01, 0x02, 0x00, 0x04, 0x0A, 0x03, 0x06, 0x02, 0x00, 0x03, 0x0B, 0x03, 0x01, 0x02,
+	0x00, 0x04, 0x0A, 0x03, 0x01, 0x02, 0x00, 0x04, 0x09, 0x04, 0x01, 0x02, 0x01, 0x04, 0x08, 0x04,
+	0x01, 0x02, 0x01, 0x05, 0x05, 0x06, 0x01, 0x02, 0x02, 0x0B, 0x01, 0x03, 0x01, 0x02, 0x03, 0x09,
+	0x02, 0x03, 0x01, 0x02, 0x05, 0x06, 0x03, 0x03, 0x02, 0x01, 0x0E, 0x03, 0x01, 0x01, 0x0D, 0x04,
+	0x01, 0x01, 0x0D, 0x03, 0x01, 0x02, 0x02, 0x01, 0x09, 0x04, 0x01, 0x02, 0x02, 0x04, 0x03, 0x06,
+	0x01, 0x01, 0x01, 0x0D, 0x01, 0x01, 0x03, 0x09, 0x02, 0x00,
+	// @5642 0x68 (16 pixels wide)
+	0x06, 0x00, 0x08, 0x01, 0x00, 0x03, 0x01, 0x02, 0x00, 0x03, 0x05, 0x04, 0x01, 0x02, 0x00, 0x03,
+	0x03, 0x08, 0x01, 0x02, 0x00, 0x03, 0x01, 0x0B, 0x01, 0x03, 0x00, 0x03, 0x01, 0x03, 0x03, 0x05,
+	0x01, 0x02, 0x00, 0x05, 0x07, 0x04, 0x01, 0x02, 0x00, 0x04, 0x08, 0x04, 0x01, 0x02, 0x00, 0x04,
+	0x09, 0x03, 0x0D, 0x02, 0x00, 0x03, 0x0A, 0x03, 0x0A, 0x00,
+	// @5700 0x69 (4 pixels wide)
+	0x07, 0x00, 0x01, 0x01, 0x00, 0x03, 0x02, 0x01, 0x00, 0x04, 0x01, 0x01, 0x00, 0x03, 0x04, 0x00,
+	0x13, 0x01, 0x00, 0x03, 0x0A, 0x00,
+	// @5722 0x6A (9 pixels wide)
+	0x07, 0x00, 0x01, 0x01, 0x06, 0x03, 0x03, 0x01, 0x05, 0x04, 0x04, 0x00, 0x15, 0x01, 0x05, 0x04,
+	0x01, 0x01, 0x05, 0x03, 0x02, 0x01, 0x04, 0x04, 0x01, 0x01, 0x01, 0x06, 0x01, 0x01, 0x00, 0x06,
+	0x01, 0x01, 0x00, 0x05, 0x02, 0x00,
+	// @5760 0x6B (16 pixels wide)
+	0x06, 0x00, 0x09, 0x01, 0x00, 0x03, 0x01, 0x02, 0x00, 0x03, 0x07, 0x04, 0x01, 0x02, 0x00, 0x03,
+	0x06, 0x04, 0x01, 0x02, 0x00, 0x03, 0x05, 0x04, 0x01, 0x02, 0x00, 0x03, 0x05, 0x03, 0x01, 0x02,
+	0x00, 0x03, 0x04, 0x04, 0x01, 0x02, 0x00, 0x03, 0x03, 0x04, 0x01, 0x02, 0x00, 0x03, 0x02, 0x04,
+	0x02, 0x02, 0x00, 0x03, 0x01, 0x04, 0x01, 0x01, 0x00, 0x09, 0x01, 0x02, 0x00, 0x05, 0x01, 0x04,
+	0x01, 0x02, 0x00, 0x04, 0x03, 0x04, 0x01, 0x02, 0x00, 0x03, 0x04, 0x04, 0x01, 0x02, 0x00, 0x03,
+	0x05, 0x04, 0x01, 0x02, 0x00, 0x03, 0x06, 0x04, 0x01, 0x02, 0x00, 0x03, 0x06, 0x05, 0x01, 0x02,
+	0x00, 0x03, 0x07, 0x04, 0x01, 0x02, 0x00, 0x03, 0x08, 0x04, 0x01, 0x02, 0x00, 0x03, 0x09, 0x04,
+	0x0A, 0x00,
+	// @5874 0x6C (3 pixels wide)
+	0x06, 0x00, 0x1C, 0x01, 0x00, 0x03, 0x0A, 0x00,
+	// @5882 0x6D (28 pixels wide)
+	0x0E, 0x00, 0x01, 0x02, 0x07, 0x04, 0x08, 0x04, 0x01, 0x03, 0x00, 0x03, 0x02, 0x08, 0x04, 0x08,
+	0x01, 0x03, 0x00, 0x03, 0x01, 0x0A, 0x02, 0x0A, 0x01, 0x04, 0x00, 0x06, 0x04, 0x04, 0x01, 0x03,
+	0x04, 0x05, 0x01, 0x03, 0x00, 0x05, 0x06, 0x06, 0x06, 0x04, 0x02, 0x03, 0x00, 0x04, 0x08, 0x04,
+	0x08, 0x03, 0x01, 0x03, 0x00, 0x03, 0x09, 0x04, 0x08, 0x04, 0x0C, 0x03, 0x00, 0x03, 0x09, 0x03,
+	0x09, 0x04, 0x0A, 0x00,
+	// @5950 0x6E (16 pixels wide)
+	0x0E, 0x00, 0x01, 0x01, 0x07, 0x05, 0x01, 0x02, 0x00, 0x03, 0x02, 0x09, 0x01, 0x02, 0x00, 0x03,
+	0x01, 0x0B, 0x01, 0x02, 0x00, 0x06, 0x04, 0x05, 0x01, 0x02, 0x00, 0x05, 0x07, 0x04, 0x01, 0x02,
+	0x00, 0x04, 0x08, 0x04, 0x02, 0x02, 0x00, 0x04, 0x09, 0x03, 0x0C, 0x02, 0x00, 0x03, 0x0A, 0x03,
+	0x0A, 0x00,
+	// @6000 0x6F (18 pixels wide)
+	0x0E, 0x00, 0x01, 0x01, 0x06, 0x06, 0x01, 0x01, 0x04, 0x0A, 0x01, 0x01, 0x03, 0x0C, 0x01, 0x02,
+	0x02, 0x04, 0x06, 0x04, 0x01, 0x02, 0x01, 0x04, 0x08, 0x04, 0x01, 0x02, 0x01, 0x03, 0x0A, 0x04,
+	0x01, 0x02, 0x00, 0x04, 0x0A, 0x04, 0x01, 0x02, 0x00, 0x03, 0x0B, 0x04, 0x05, 0x02, 0x00, 0x03,
+	0x0C, 0x03, 0x02, 0x02, 0x00, 0x04, 0x0A, 0x04, 0x01, 0x02, 0x01, 0x04, 0x08, 0x04, 0x01, 0x02,
+	0x01, 0x05, 0x06, 0x05, 0x01, 0x02, 0x02, 0x05, 0x04, 0x05, 0x01, 0x01, 0x03, 0x0C, 0x01, 0x01,
+	0x05, 0x08, 0x0A, 0x00,
+	// @6084 0x70 (18 pixels wide)
+	0x0E, 0x00, 0x01, 0x01, 0x08, 0x04, 0x01, 0x02, 0x00, 0x03, 0x02, 0x09, 0x01, 0x02, 0x00, 0x03,
+	0x01, 0x0C, 0x01, 0x02, 0x00, 0x07, 0x04, 0x05, 0x01, 0x02, 0x00, 0x05, 0x08, 0x04, 0x01, 0x02,
+	0x00, 0x04, 0x09, 0x04, 0x02, 0x02, 0x00, 0x04, 0x0A, 0x04, 0x05, 0x02, 0x00, 0x03, 0x0C, 0x03,
+	0x02, 0x02, 0x00, 0x04, 0x0A, 0x04, 0x01, 0x02, 0x00, 0x04, 0x09, 0x04, 0x01, 0x02, 0x00, 0x05,
+	0x07, 0x05, 0x01, 0x03, 0x00, 0x03, 0x01, 0x03, 0x03, 0x06, 0x01, 0x02, 0x00, 0x03, 0x01, 0x0B,
+	0x01, 0x02, 0x00, 0x03, 0x03, 0x07, 0x08, 0x01, 0x00, 0x03, 0x02, 0x00,
+	// @6176 0x71 (18 pixels wide)
+	0x0E, 0x00, 0x01, 0x01, 0x06, 0x05, 0x01, 0x02, 0x04, 0x09, 0x01, 0x04, 0x01, 0x01, 0x03, 0x0F,
+	0x01, 0x02, 0x02, 0x05, 0x04, 0x07, 0x01, 0x02, 0x01, 0x04, 0x08, 0x05, 0x01, 0x02, 0x00, 0x04,
+	0x09, 0x05, 0x01, 0x02, 0x00, 0x04, 0x0A, 0x04, 0x06, 0x02, 0x00, 0x03, 0x0B, 0x04, 0x02, 0x02,
+	0x00, 0x04, 0x0A, 0x04, 0x01, 0x02, 0x00, 0x04, 0x09, 0x05, 0x01, 0x02, 0x01, 0x04, 0x07, 0x06,
+	0x01, 0x02, 0x02, 0x05, 0x03, 0x08, 0x01, 0x02, 0x03, 0x0A, 0x01, 0x04, 0x01, 0x02, 0x04, 0x08,
+	0x02, 0x04, 0x08, 0x01, 0x0E, 0x04, 0x02, 0x00,
+	// @6264 0x72 (9 pixels wide)
+	0x0E, 0x00, 0x01, 0x01, 0x07, 0x02, 0x01, 0x02, 0x00, 0x03, 0x02, 0x04, 0x02, 0x02, 0x00, 0x03,
+	0x01, 0x05, 0x02, 0x01, 0x00, 0x05, 0x03, 0x01, 0x00, 0x04, 0x0B, 0x01, 0x00, 0x03, 0x0A, 0x00,
+	// @6296 0x73 (12 pixels wide)
+	0x0E, 0x00, 0x01, 0x01, 0x04, 0x05, 0x01, 0x01, 0x02, 0x09, 0x01, 0x01, 0x01, 0x0A, 0x01, 0x02,
+	0x01, 0x03, 0x06, 0x01, 0x03, 0x01, 0x00, 0x04, 0x01, 0x01, 0x00, 0x05, 0x01, 0x01, 0x01, 0x06,
+	0x01, 0x01, 0x02, 0x07, 0x01, 0x01, 0x03, 0x07, 0x01, 0x01, 0x06, 0x05, 0x01, 0x01, 0x08, 0x04,
+	0x03, 0x01, 0x09, 0x03, 0x01, 0x02, 0x00, 0x01, 0x07, 0x04, 0x01, 0x02, 0x00, 0x03, 0x04, 0x04,
+	0x01, 0x01, 0x00, 0x0B, 0x01, 0x01, 0x00, 0x09, 0x0A, 0x00,
+	// @6370 0x74 (11 pixels wide)
+	0x0A, 0x00, 0x01, 0x01, 0x05, 0x01, 0x04, 0x01, 0x03, 0x03, 0x02, 0x01, 0x00, 0x0B, 0x0D, 0x01,
+	0x03, 0x03, 0x01, 0x01, 0x03, 0x04, 0x01, 0x01, 0x03, 0x08, 0x01, 0x01, 0x04, 0x07, 0x01, 0x01,
+	0x05, 0x06, 0x0A, 0x00,
+	// @6406 0x75 (16 pixels wide)
+	0x0F, 0x00, 0x0D, 0x02, 0x00, 0x03, 0x0A, 0x03, 0x02, 0x02, 0x00, 0x04, 0x08, 0x04, 0x01, 0x02,
+	0x01, 0x04, 0x06, 0x05, 0x01, 0x03, 0x01, 0x06, 0x01, 0x04, 0x01, 0x03, 0x01, 0x02, 0x02, 0x0A,
+	0x01, 0x03, 0x01, 0x02, 0x03, 0x07, 0x03, 0x03, 0x0A, 0x00,
+	// @6448 0x76 (18 pixels wide)
+	0x0F, 0x00, 0x01, 0x02, 0x00, 0x04, 0x0A, 0x04, 0x01, 0x02, 0x00, 0x04, 0x0A, 0x03, 0x01, 0x02,
+	0x01, 0x03, 0x09, 0x04, 0x01, 0x02, 0x01, 0x04, 0x08, 0x03, 0x01, 0x02, 0x01, 0x04, 0x07, 0x04,
+	0x01, 0x02, 0x02, 0x03, 0x07, 0x04, 0x01, 0x02, 0x02, 0x04, 0x06, 0x03, 0x01, 0x02, 0x03, 0x03,
+	0x05, 0x04, 0x01, 0x02, 0x03, 0x03, 0x05, 0x03, 0x01, 0x02, 0x03, 0x04, 0x04, 0x03, 0x01, 0x02,
+	0x04, 0x03, 0x03, 0x04, 0x01, 0x02, 0x04, 0x03, 0x03, 0x03, 0x01, 0x02, 0x04, 0x04, 0x02, 0x03,
+	0x02, 0x02, 0x05, 0x03, 0x01, 0x03, 0x01, 0x01, 0x06, 0x06, 0x02, 0x01, 0x06, 0x05, 0x01, 0x01,
+	0x07, 0x03, 0x0A, 0x00,
+	// @6548 0x77 (28 pixels wide)
+	0x0F, 0x00, 0x01, 0x03, 0x00, 0x04, 0x08, 0x04, 0x08, 0x04, 0x01, 0x03, 0x00, 0x04, 0x08, 0x04,
+	0x08, 0x03, 0x01, 0x03, 0x01, 0x03, 0x07, 0x05, 0x08, 0x03, 0x01, 0x03, 0x01, 0x03, 0x07, 0x05,
+	0x07, 0x04, 0x01, 0x04, 0x01, 0x04, 0x06, 0x02, 0x01, 0x03, 0x06, 0x03, 0x01, 0x04, 0x01, 0x04,
+	0x05, 0x03, 0x01, 0x03, 0x06, 0x03, 0x01, 0x04, 0x02, 0x03, 0x05, 0x03, 0x02, 0x02, 0x05, 0x04,
+	0x01, 0x04, 0x02, 0x03, 0x05, 0x03, 0x02, 0x03, 0x04, 0x03, 0x01, 0x04, 0x02, 0x04, 0x03, 0x03,
+	0x03, 0x03, 0x04, 0x03, 0x01, 0x04, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x04, 0x03, 0x01, 0x04,
+	0x03, 0x03, 0x03, 0x03, 0x04, 0x03, 0x02, 0x03, 0x01, 0x04, 0x03, 0x03, 0x03, 0x02, 0x05, 0x03,
+	0x02, 0x03, 0x01, 0x04, 0x04, 0x03, 0x01, 0x03, 0x05, 0x03, 0x02, 0x03, 0x01, 0x04, 0x04, 0x03,
+	0x01, 0x03, 0x06, 0x02, 0x02, 0x02, 0x01, 0x03, 0x04, 0x03, 0x01, 0x02, 0x07, 0x06, 0x01, 0x02,
+	0x05, 0x05, 0x07, 0x06, 0x01, 0x02, 0x05, 0x05, 0x08, 0x04, 0x02, 0x02, 0x05, 0x04, 0x09, 0x04,
+	0x0A, 0x00,
+	// @6710 0x78 (17 pixels wide)
+	0x0F, 0x00, 0x01, 0x02, 0x00, 0x04, 0x08, 0x04, 0x01, 0x02, 0x01, 0x04, 0x07, 0x04, 0x01, 0x02,
+	0x02, 0x03, 0x06, 0x04, 0x01, 0x02, 0x02, 0x04, 0x05, 0x03, 0x01, 0x02, 0x03, 0x04, 0x03, 0x03,
+	0x01, 0x02, 0x04, 0x03, 0x02, 0x04, 0x01, 0x02, 0x04, 0x04, 0x01, 0x03, 0x01, 0x01, 0x05, 0x06,
+	0x02, 0x01, 0x06, 0x05, 0x01, 0x01, 0x05, 0x06, 0x01, 0x01, 0x05, 0x07, 0x01, 0x02, 0x04, 0x03,
+	0x02, 0x04, 0x01, 0x02, 0x03, 0x04, 0x02, 0x04, 0x01, 0x02, 0x02, 0x04, 0x04, 0x04, 0x01, 0x02,
+	0x02, 0x03, 0x06, 0x04, 0x01, 0x02, 0x01, 0x04, 0x06, 0x04, 0x01, 0x02, 0x00, 0x04, 0x08, 0x04,
+	0x01, 0x02, 0x00, 0x04, 0x09, 0x04, 0x0A, 0x00,
+	// @6814 0x79 (17 pixels wide)
+	0x0F, 0x00, 0x01, 0x02, 0x00, 0x04, 0x0A, 0x03, 0x01, 0x02, 0x00, 0x04, 0x09, 0x04, 0x01, 0x02,
+	0x01, 0x03, 0x09, 0x03, 0x01, 0x02, 0x01, 0x04, 0x08, 0x03, 0x01, 0x02, 0x01, 0x04, 0x07, 0x04,
+	0x01, 0x02, 0x02, 0x03, 0x07, 0x03, 0x01, 0x02, 0x02, 0x04, 0x06, 0x03, 0x01, 0x02, 0x03, 0x03,
+	0x05, 0x04, 0x01, 0x02, 0x03, 0x03, 0x05, 0x03, 0x01, 0x02, 0x03, 0x04, 0x04, 0x03, 0x01, 0x02,
+	0x04, 0x03, 0x03, 0x03, 0x02, 0x02, 0x04, 0x04, 0x02, 0x03, 0x01, 0x02, 0x05, 0x03, 0x01, 0x03,
+	0x01, 0x01, 0x05, 0x07, 0x03, 0x01, 0x06, 0x05, 0x01, 0x01, 0x07, 0x03, 0x01, 0x01, 0x06, 0x04,
+	0x01, 0x01, 0x06, 0x03, 0x01, 0x01, 0x05, 0x04, 0x01, 0x01, 0x04, 0x04, 0x01, 0x01, 0x03, 0x04,
+	0x01, 0x01, 0x01, 0x06, 0x01, 0x01, 0x01, 0x05, 0x01, 0x01, 0x01, 0x03, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x00,
+	// @6944 0x7A (15 pixels wide)
+	0x0F, 0x00, 0x02, 0x01, 0x01, 0x0E, 0x01, 0x01, 0x0B, 0x04, 0x01, 0x01, 0x0A, 0x04, 0x01, 0x01,
+	0x09, 0x04, 0x01, 0x01, 0x09, 0x03, 0x01, 0x01, 0x08, 0x04, 0x01, 0x01, 0x07, 0x04, 0x01, 0x01,
+	0x06, 0x04, 0x02, 0x01, 0x05, 0x04, 0x01, 0x01, 0x04, 0x04, 0x01, 0x01, 0x03, 0x04, 0x02, 0x01,
+	0x02, 0x04, 0x01, 0x01, 0x01, 0x04, 0x03, 0x01, 0x00, 0x0F, 0x0A, 0x00,
+	// @7004 0x7B (9 pixels wide)
+	0x07, 0x00, 0x01, 0x01, 0x05, 0x04, 0x01, 0x01, 0x04, 0x05, 0x03, 0x01, 0x03, 0x03, 0x01, 0x01,
+	0x03, 0x02, 0x08, 0x01, 0x03, 0x03, 0x01, 0x01, 0x00, 0x05, 0x01, 0x01, 0x00, 0x03, 0x01, 0x01,
+	0x01, 0x04, 0x08, 0x01, 0x03, 0x03, 0x01, 0x01, 0x03, 0x02, 0x03, 0x01, 0x03, 0x03, 0x01, 0x01,
+	0x04, 0x05, 0x01, 0x01, 0x05, 0x04, 0x06, 0x00,
+	// @7060 0x7C (3 pixels wide)
+	0x04, 0x00, 0x28, 0x01, 0x00, 0x03,
+	// @7066 0x7D (9 pixels wide)
+	0x07, 0x00, 0x01, 0x01, 0x00, 0x05, 0x01, 0x01, 0x00, 0x06, 0x01, 0x01, 0x03, 0x03, 0x04, 0x01,
+	0x04, 0x03, 0x02, 0x01, 0x04, 0x02, 0x04, 0x01, 0x03, 0x03, 0x01, 0x01, 0x04, 0x03, 0x01, 0x01,
+	0x04, 0x05, 0x01, 0x01, 0x06, 0x03, 0x01, 0x01, 0x04, 0x05, 0x01, 0x01, 0x04, 0x03, 0x04, 0x01,
+	0x03, 0x03, 0x02, 0x01, 0x04, 0x02, 0x04, 0x01, 0x04, 0x03, 0x01, 0x01, 0x03, 0x03, 0x01, 0x01,
+	0x00, 0x06, 0x01, 0x01, 0x00, 0x05, 0x06, 0x00,
+	// @7138 0x7E (20 pixels wide)
+	0x14, 0x00, 0x01, 0x02, 0x02, 0x06, 0x09, 0x03, 0x01, 0x02, 0x01, 0x0A, 0x06, 0x03, 0x01, 0x03,
+	0x00, 0x04, 0x02, 0x07, 0x04, 0x03, 0x01, 0x02, 0x00, 0x03, 0x06, 0x0A, 0x01, 0x02, 0x00, 0x02,
+	0x09, 0x07, 0x01, 0x02, 0x00, 0x02, 0x0C, 0x03, 0x12, 0x00,
+	// @7180 0x7F (2 pixels wide)
+	0x2C, 0x00,
+	// @7182 0x80 (2 pixels wide)
+	0x2C, 0x00,
+	// @7184 0x81 (2 pixels wide)
+	0x2C, 0x00,
+	// @7186 0x82 (6 pixels wide)
+	0x20, 0x00, 0x01, 0x01, 0x01, 0x04, 0x01, 0x01, 0x00, 0x05, 0x02, 0x01, 0x00, 0x06, 0x01, 0x02,
+	0x02, 0x01, 0x01, 0x02, 0x02, 0x01, 0x04, 0x02, 0x01, 0x01, 0x03, 0x02, 0x01, 0x01, 0x03, 0x01,
+	0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00,
+	// @7228 0x83 (20 pixels wide)
+	0x04, 0x00, 0x01, 0x01, 0x0F, 0x03, 0x01, 0x02, 0x0D, 0x02, 0x02, 0x02, 0x01, 0x02, 0x0D, 0x01,
+	0x03, 0x03, 0x01, 0x02, 0x0C, 0x02, 0x03, 0x03, 0x01, 0x02, 0x0B, 0x02, 0x04, 0x03, 0x02, 0x01,
+	0x0B, 0x02, 0x03, 0x01, 0x0A, 0x03, 0x01, 0x01, 0x0A, 0x02, 0x02, 0x01, 0x09, 0x03, 0x01, 0x01,
+	0x04, 0x0D, 0x04, 0x01, 0x09, 0x03, 0x01, 0x01, 0x08, 0x04, 0x07, 0x01, 0x08, 0x03, 0x01, 0x01,
+	0x08, 0x02, 0x05, 0x01, 0x07, 0x03, 0x02, 0x01, 0x07, 0x02, 0x01, 0x02, 0x00, 0x03, 0x04, 0x02,
+	0x02, 0x02, 0x00, 0x03, 0x03, 0x02, 0x01, 0x02, 0x01, 0x01, 0x03, 0x02, 0x01, 0x01, 0x02, 0x03,
+	0x01, 0x00,
+	// @7326 0x84 (14 pixels wide)
+	0x1F, 0x00, 0x01, 0x02, 0x01, 0x03, 0x05, 0x04, 0x01, 0x02, 0x00, 0x05, 0x03, 0x05, 0x01, 0x02,
+	0x00, 0x05, 0x03, 0x06, 0x01, 0x02, 0x00, 0x06, 0x03, 0x05, 0x01, 0x04, 0x02, 0x01, 0x01, 0x02,
+	0x04, 0x01, 0x01, 0x02, 0x01, 0x02, 0x04, 0x02, 0x07, 0x01, 0x02, 0x02, 0x04, 0x01, 0x07, 0x01,
+	0x01, 0x02, 0x03, 0x01, 0x07, 0x01, 0x01, 0x02, 0x02, 0x01, 0x08, 0x01, 0x01, 0x02, 0x01, 0x01,
+	0x07, 0x02, 0x02, 0x00,
+	// @7394 0x85 (2 pixels wide)
+	0x2C, 0x00,
+	// @7396 0x86 (16 pixels wide)
+	0x03, 0x00, 0x01, 0x01, 0x08, 0x01, 0x04, 0x01, 0x07, 0x03, 0x04, 0x01, 0x08, 0x01, 0x01, 0x03,
+	0x01, 0x02, 0x05, 0x01, 0x04, 0x03, 0x01, 0x03, 0x00, 0x06, 0x02, 0x01, 0x02, 0x05, 0x01, 0x01,
+	0x00, 0x10, 0x01, 0x03, 0x01, 0x02, 0x05, 0x01, 0x04, 0x03, 0x05, 0x01, 0x08, 0x01, 0x02, 0x01,
+	0x07, 0x03, 0x01, 0x01, 0x06, 0x04, 0x02, 0x01, 0x07, 0x03, 0x01, 0x01, 0x07, 0x02, 0x0F, 0x01,
+	0x08, 0x01, 0x02, 0x00,
+	// @7464 0x87 (16 pixels wide)
+	0x03, 0x00, 0x01, 0x01, 0x08, 0x01, 0x04, 0x01, 0x07, 0x03, 0x04, 0x01, 0x08, 0x01, 0x01, 0x03,
+	0x01, 0x02, 0x05, 0x01, 0x04, 0x03, 0x01, 0x03, 0x00, 0x06, 0x02, 0x01, 0x02, 0x05, 0x01, 0x01,
+	0x00, 0x10, 0x01, 0x03, 0x01, 0x02, 0x05, 0x01, 0x04, 0x03, 0x05, 0x01, 0x08, 0x01, 0x01, 0x01,
+	0x07, 0x02, 0x02, 0x01, 0x07, 0x03, 0x01, 0x01, 0x07, 0x02, 0x04, 0x01, 0x08, 0x01, 0x01, 0x01,
+	0x07, 0x01, 0x01, 0x03, 0x01, 0x03, 0x03, 0x01, 0x04, 0x04, 0x01, 0x01, 0x00, 0x10, 0x01, 0x03,
+	0x00, 0x04, 0x04, 0x01, 0x03, 0x04, 0x04, 0x01, 0x08, 0x01, 0x01, 0x01, 0x07, 0x02, 0x03, 0x01,
+	0x07, 0x03, 0x01, 0x01, 0x07, 0x02, 0x02, 0x00,
+	// @7568 0x88 (14 pixels wide)
+	0x01, 0x01, 0x04, 0x06, 0x01, 0x01, 0x03, 0x08, 0x01, 0x02, 0x02, 0x03, 0x04, 0x03, 0x01, 0x02,
+	0x00, 0x03, 0x08, 0x03, 0x28, 0x00,
+	// @7590 0x89 (34 pixels wide)
+	0x04, 0x00, 0x01, 0x01, 0x11, 0x01, 0x01, 0x02, 0x05, 0x05, 0x06, 0x02, 0x01, 0x03, 0x04, 0x02,
+	0x02, 0x03, 0x04, 0x02, 0x01, 0x03, 0x03, 0x03, 0x03, 0x06, 0x01, 0x01, 0x01, 0x03, 0x02, 0x03,
+	0x05, 0x01, 0x04, 0x02, 0x01, 0x03, 0x02, 0x02, 0x06, 0x01, 0x04, 0x01, 0x01, 0x03, 0x01, 0x03,
+	0x06, 0x01, 0x03, 0x02, 0x01, 0x03, 0x01, 0x03, 0x06, 0x01, 0x03, 0x01, 0x01, 0x03, 0x01, 0x02,
+	0x07, 0x01, 0x03, 0x01, 0x01, 0x03, 0x01, 0x02, 0x07, 0x01, 0x02, 0x02, 0x01, 0x03, 0x00, 0x03,
+	0x06, 0x01, 0x03, 0x01, 0x01, 0x03, 0x00, 0x03, 0x06, 0x01, 0x02, 0x02, 0x01, 0x03, 0x00, 0x03,
+	0x06, 0x01, 0x02, 0x01, 0x01, 0x03, 0x00, 0x03, 0x05, 0x01, 0x03, 0x01, 0x01, 0x03, 0x01, 0x02,
+	0x05, 0x01, 0x02, 0x02, 0x01, 0x05, 0x01, 0x02, 0x04, 0x01, 0x03, 0x01, 0x04, 0x04, 0x09, 0x02,
+	0x01, 0x06, 0x01, 0x03, 0x02, 0x02, 0x03, 0x01, 0x03, 0x03, 0x01, 0x02, 0x06, 0x06, 0x01, 0x06,
+	0x02, 0x05, 0x03, 0x02, 0x02, 0x02, 0x04, 0x01, 0x05, 0x03, 0x03, 0x01, 0x01, 0x05, 0x0A, 0x01,
+	0x02, 0x03, 0x04, 0x01, 0x04, 0x03, 0x04, 0x01, 0x01, 0x05, 0x09, 0x02, 0x02, 0x02, 0x05, 0x02,
+	0x03, 0x02, 0x05, 0x01, 0x01, 0x05, 0x09, 0x01, 0x02, 0x03, 0x05, 0x02, 0x02, 0x03, 0x05, 0x02,
+	0x01, 0x05, 0x09, 0x01, 0x02, 0x02, 0x06, 0x02, 0x02, 0x02, 0x06, 0x01, 0x01, 0x05, 0x08, 0x02,
+	0x01, 0x03, 0x06, 0x01, 0x02, 0x03, 0x06, 0x01, 0x01, 0x05, 0x08, 0x01, 0x02, 0x03, 0x06, 0x01,
+	0x02, 0x03, 0x06, 0x01, 0x01, 0x05, 0x07, 0x02, 0x02, 0x03, 0x06, 0x01, 0x02, 0x02, 0x07, 0x01,
+	0x01, 0x05, 0x07, 0x01, 0x03, 0x02, 0x07, 0x01, 0x02, 0x02, 0x07, 0x01, 0x01, 0x05, 0x07, 0x01,
+	0x03, 0x02, 0x06, 0x02, 0x02, 0x02, 0x06, 0x02, 0x01, 0x05, 0x06, 0x02, 0x03, 0x02, 0x06, 0x01,
+	0x03, 0x02, 0x06, 0x01, 0x01, 0x05, 0x06, 0x01, 0x04, 0x02, 0x06, 0x01, 0x03, 0x02, 0x06, 0x01,
+	0x01, 0x05, 0x05, 0x02, 0x04, 0x02, 0x05, 0x01, 0x04, 0x02, 0x05, 0x01, 0x01, 0x05, 0x05, 0x01,
+	0x06, 0x02, 0x03, 0x01, 0x06, 0x02, 0x03, 0x02, 0x01, 0x03, 0x05, 0x01, 0x06, 0x06, 0x06, 0x06,
+	0x01, 0x03, 0x04, 0x02, 0x08, 0x01, 0x0B, 0x02, 0x07, 0x00,
+	// @7920 0x8A (19 pixels wide)
+	0x01, 0x02, 0x03, 0x04, 0x06, 0x03, 0x01, 0x02, 0x05, 0x03, 0x03, 0x03, 0x01, 0x01, 0x06, 0x07,
+	0x01, 0x01, 0x08, 0x04, 0x02, 0x00, 0x01, 0x02, 0x05, 0x08, 0x03, 0x01, 0x01, 0x02, 0x04, 0x03,
+	0x05, 0x05, 0x01, 0x02, 0x03, 0x02, 0x08, 0x04, 0x01, 0x02, 0x02, 0x03, 0x09, 0x03, 0x01, 0x02,
+	0x02, 0x02, 0x0B, 0x02, 0x03, 0x02, 0x02, 0x02, 0x0C, 0x02, 0x01, 0x02, 0x02, 0x03, 0x0C, 0x01,
+	0x01, 0x01, 0x02, 0x03, 0x01, 0x01, 0x02, 0x04, 0x01, 0x01, 0x03, 0x04, 0x01, 0x01, 0x03, 0x06,
+	0x01, 0x01, 0x04, 0x06, 0x01, 0x01, 0x05, 0x07, 0x01, 0x01, 0x07, 0x06, 0x01, 0x01, 0x08, 0x06,
+	0x01, 0x01, 0x0A, 0x06, 0x01, 0x01, 0x0B, 0x06, 0x01, 0x01, 0x0C, 0x05, 0x01, 0x01, 0x0D, 0x05,
+	0x01, 0x01, 0x0E, 0x04, 0x01, 0x01, 0x0F, 0x04, 0x01, 0x02, 0x00, 0x02, 0x0D, 0x04, 0x02, 0x02,
+	0x01, 0x01, 0x0E, 0x03, 0x01, 0x02, 0x01, 0x02, 0x0D, 0x03, 0x01, 0x02, 0x01, 0x02, 0x0C, 0x03,
+	0x01, 0x02, 0x01, 0x03, 0x0B, 0x03, 0x01, 0x02, 0x01, 0x04, 0x09, 0x03, 0x01, 0x02, 0x01, 0x06,
+	0x06, 0x03, 0x01, 0x02, 0x01, 0x02, 0x03, 0x09, 0x01, 0x01, 0x0A, 0x01, 0x05, 0x00,
+	// @8094 0x8B (9 pixels wide)
+	0x11, 0x00, 0x01, 0x01, 0x08, 0x01, 0x01, 0x01, 0x07, 0x01, 0x01, 0x01, 0x06, 0x02, 0x01, 0x01,
+	0x05, 0x02, 0x01, 0x01, 0x04, 0x03, 0x01, 0x01, 0x04, 0x02, 0x01, 0x01, 0x03, 0x02, 0x01, 0x01,
+	0x02, 0x03, 0x01, 0x01, 0x01, 0x03, 0x01, 0x01, 0x00, 0x04, 0x01, 0x01, 0x02, 0x03, 0x01, 0x01,
+	0x03, 0x03, 0x01, 0x01, 0x04, 0x02, 0x01, 0x01, 0x05, 0x02, 0x01, 0x01, 0x06, 0x02, 0x01, 0x01,
+	0x07, 0x01, 0x02, 0x01, 0x08, 0x01, 0x09, 0x00,
+	// @8166 0x8C (40 pixels wide)
+	0x05, 0x00, 0x01, 0x01, 0x0A, 0x05, 0x01, 0x01, 0x07, 0x1E, 0x01, 0x03, 0x05, 0x03, 0x09, 0x05,
+	0x0A, 0x05, 0x01, 0x03, 0x04, 0x02, 0x0C, 0x04, 0x0D, 0x02, 0x01, 0x03, 0x03, 0x02, 0x0E, 0x03,
+	0x0E, 0x01, 0x01, 0x03, 0x03, 0x01, 0x10, 0x02, 0x0E, 0x01, 0x01, 0x03, 0x02, 0x02, 0x10, 0x02,
+	0x0E, 0x01, 0x01, 0x02, 0x01, 0x03, 0x10, 0x02, 0x02, 0x02, 0x01, 0x02, 0x11, 0x02, 0x01, 0x02,
+	0x00, 0x03, 0x11, 0x02, 0x02, 0x03, 0x00, 0x03, 0x11, 0x02, 0x0C, 0x01, 0x01, 0x03, 0x00, 0x03,
+	0x11, 0x02, 0x0B, 0x02, 0x01, 0x03, 0x00, 0x03, 0x11, 0x02, 0x0A, 0x03, 0x02, 0x02, 0x00, 0x03,
+	0x11, 0x0F, 0x01, 0x03, 0x00, 0x03, 0x11, 0x02, 0x0B, 0x02, 0x03, 0x03, 0x00, 0x03, 0x11, 0x02,
+	0x0C, 0x01, 0x02, 0x02, 0x00, 0x03, 0x11, 0x02, 0x01, 0x02, 0x00, 0x04, 0x10, 0x02, 0x01, 0x02,
+	0x01, 0x03, 0x10, 0x02, 0x01, 0x03, 0x01, 0x03, 0x10, 0x02, 0x10, 0x02, 0x01, 0x03, 0x02, 0x03,
+	0x0F, 0x02, 0x10, 0x01, 0x01, 0x03, 0x02, 0x04, 0x0E, 0x02, 0x0F, 0x02, 0x01, 0x03, 0x03, 0x03,
+	0x0E, 0x02, 0x0F, 0x02, 0x01, 0x03, 0x04, 0x03, 0x0C, 0x04, 0x0D, 0x02, 0x01, 0x03, 0x05, 0x04,
+	0x09, 0x06, 0x0A, 0x04, 0x01, 0x02, 0x06, 0x07, 0x01, 0x18, 0x01, 0x01, 0x08, 0x1E, 0x06, 0x00,
+	// @8358 0x8D (2 pixels wide)
+	0x2C, 0x00,
+	// @8360 0x8E (2 pixels wide)
+	0x2C, 0x00,
+	// @8362 0x8F (2 pixels wide)
+	0x2C, 0x00,
+	// @8364 0x90 (2 pixels wide)
+	0x2C, 0x00,
+	// @8366 0x91 (6 pixels wide)
+	0x04, 0x00, 0x01, 0x01, 0x04, 0x01, 0x01, 0x01, 0x03, 0x01, 0x01, 0x01, 0x02, 0x01, 0x04, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x00, 0x05, 0x03, 0x01, 0x01, 0x05, 0x01, 0x01, 0x02, 0x03, 0x1C, 0x00,
+	// @8398 0x92 (6 pixels wide)
+	0x04, 0x00, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x01, 0x04, 0x01, 0x01, 0x01, 0x05, 0x01, 0x01,
+	0x00, 0x06, 0x01, 0x01, 0x01, 0x05, 0x02, 0x01, 0x05, 0x01, 0x02, 0x01, 0x04, 0x01, 0x01, 0x01,
+	0x03, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x1C, 0x00,
+	// @8442 0x93 (16 pixels wide)
+	0x04, 0x00, 0x01, 0x02, 0x04, 0x01, 0x09, 0x01, 0x01, 0x02, 0x03, 0x01, 0x09, 0x01, 0x01, 0x02,
+	0x02, 0x01, 0x09, 0x01, 0x03, 0x02, 0x01, 0x01, 0x09, 0x01, 0x01, 0x02, 0x01, 0x01, 0x08, 0x02,
+	0x01, 0x02, 0x00, 0x05, 0x05, 0x05, 0x03, 0x02, 0x01, 0x05, 0x05, 0x05, 0x01, 0x02, 0x02, 0x03,
+	0x07, 0x03, 0x1C, 0x00,
+	// @8494 0x94 (16 pixels wide)
+	0x04, 0x00, 0x01, 0x02, 0x02, 0x02, 0x07, 0x03, 0x01, 0x02, 0x01, 0x04, 0x06, 0x04, 0x01, 0x02,
+	0x01, 0x05, 0x04, 0x05, 0x01, 0x02, 0x00, 0x06, 0x04, 0x06, 0x01, 0x02, 0x01, 0x05, 0x05, 0x05,
+	0x02, 0x02, 0x05, 0x01, 0x09, 0x01, 0x02, 0x02, 0x04, 0x01, 0x09, 0x01, 0x01, 0x02, 0x03, 0x01,
+	0x09, 0x01, 0x01, 0x02, 0x02, 0x01, 0x09, 0x01, 0x01, 0x02, 0x01, 0x01, 0x09, 0x01, 0x1C, 0x00,
+	// @8558 0x95 (2 pixels wide)
+	0x2C, 0x00,
+	// @8560 0x96 (14 pixels wide)
+	0x14, 0x00, 0x01, 0x01, 0x00, 0x0E, 0x17, 0x00,
+	// @8568 0x97 (39 pixels wide)
+	0x14, 0x00, 0x02, 0x01, 0x00, 0x27, 0x16, 0x00,
+	// @8576 0x98 (13 pixels wide)
+	0x01, 0x00, 0x01, 0x02, 0x02, 0x03, 0x06, 0x01, 0x01, 0x02, 0x01, 0x06, 0x04, 0x02, 0x01, 0x02,
+	0x00, 0x02, 0x04, 0x06, 0x01, 0x02, 0x00, 0x01, 0x06, 0x04, 0x27, 0x00,
+	// @8604 0x99 (39 pixels wide)
+	0x05, 0x00, 0x01, 0x03, 0x00, 0x0E, 0x03, 0x04, 0x0D, 0x05, 0x01, 0x05, 0x00, 0x02, 0x04, 0x02,
+	0x04, 0x02, 0x05, 0x03, 0x0B, 0x04, 0x02, 0x05, 0x00, 0x01, 0x05, 0x02, 0x05, 0x01, 0x05, 0x03,
+	0x0B, 0x03, 0x02, 0x05, 0x06, 0x02, 0x0B, 0x01, 0x01, 0x02, 0x09, 0x01, 0x01, 0x02, 0x02, 0x05,
+	0x06, 0x02, 0x0B, 0x01, 0x02, 0x02, 0x07, 0x01, 0x02, 0x02, 0x01, 0x05, 0x06, 0x02, 0x0B, 0x01,
+	0x03, 0x02, 0x05, 0x02, 0x02, 0x02, 0x01, 0x05, 0x06, 0x02, 0x0B, 0x01, 0x03, 0x02, 0x05, 0x01,
+	0x03, 0x02, 0x01, 0x05, 0x06, 0x02, 0x0B, 0x01, 0x03, 0x03, 0x04, 0x01, 0x03, 0x02, 0x02, 0x05,
+	0x06, 0x02, 0x0B, 0x01, 0x04, 0x02, 0x03, 0x01, 0x04, 0x02, 0x01, 0x05, 0x06, 0x02, 0x0B, 0x01,
+	0x05, 0x02, 0x01, 0x02, 0x04, 0x02, 0x01, 0x05, 0x06, 0x02, 0x0B, 0x01, 0x05, 0x02, 0x01, 0x01,
+	0x05, 0x02, 0x01, 0x04, 0x06, 0x02, 0x0B, 0x01, 0x05, 0x04, 0x05, 0x02, 0x01, 0x04, 0x06, 0x02,
+	0x0B, 0x01, 0x06, 0x02, 0x06, 0x02, 0x01, 0x04, 0x06, 0x03, 0x0A, 0x02, 0x05, 0x02, 0x06, 0x02,
+	0x01, 0x04, 0x04, 0x07, 0x06, 0x05, 0x04, 0x01, 0x05, 0x06, 0x14, 0x00,
+	// @8776 0x9A (14 pixels wide)
+	0x09, 0x00, 0x01, 0x02, 0x00, 0x03, 0x08, 0x03, 0x01, 0x02, 0x02, 0x03, 0x04, 0x03, 0x01, 0x01,
+	0x03, 0x08, 0x01, 0x01, 0x04, 0x06, 0x03, 0x00, 0x01, 0x01, 0x04, 0x05, 0x01, 0x02, 0x03, 0x02,
+	0x04, 0x03, 0x01, 0x02, 0x02, 0x01, 0x07, 0x02, 0x01, 0x02, 0x01, 0x02, 0x07, 0x02, 0x03, 0x02,
+	0x01, 0x02, 0x08, 0x01, 0x01, 0x01, 0x01, 0x03, 0x01, 0x01, 0x02, 0x03, 0x01, 0x01, 0x02, 0x05,
+	0x01, 0x01, 0x04, 0x04, 0x01, 0x01, 0x05, 0x05, 0x01, 0x01, 0x06, 0x05, 0x01, 0x01, 0x08, 0x04,
+	0x01, 0x01, 0x09, 0x04, 0x01, 0x02, 0x01, 0x01, 0x08, 0x03, 0x02, 0x02, 0x01, 0x01, 0x09, 0x02,
+	0x01, 0x02, 0x01, 0x02, 0x08, 0x02, 0x01, 0x02, 0x01, 0x02, 0x08, 0x01, 0x01, 0x02, 0x01, 0x03,
+	0x06, 0x02, 0x01, 0x02, 0x01, 0x01, 0x01, 0x08, 0x01, 0x01, 0x07, 0x01, 0x05, 0x00,
+	// @8902 0x9B (9 pixels wide)
+	0x11, 0x00, 0x01, 0x01, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01,
+	0x02, 0x02, 0x01, 0x01, 0x03, 0x02, 0x01, 0x01, 0x03, 0x03, 0x01, 0x01, 0x04, 0x03, 0x01, 0x01,
+	0x05, 0x03, 0x01, 0x01, 0x05, 0x04, 0x01, 0x01, 0x05, 0x03, 0x01, 0x01, 0x04, 0x03, 0x01, 0x01,
+	0x04, 0x02, 0x01, 0x01, 0x03, 0x02, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01,
+	0x01, 0x02, 0x01, 0x01, 0x00, 0x02, 0x01, 0x01, 0x00, 0x01, 0x09, 0x00,
+	// @8978 0x9C (24 pixels wide)
+	0x0E, 0x00, 0x01, 0x02, 0x05, 0x04, 0x08, 0x03, 0x01, 0x03, 0x03, 0x03, 0x02, 0x03, 0x04, 0x07,
+	0x01, 0x04, 0x03, 0x02, 0x04, 0x02, 0x03, 0x03, 0x03, 0x02, 0x01, 0x04, 0x02, 0x02, 0x06, 0x02,
+	0x02, 0x02, 0x05, 0x02, 0x01, 0x04, 0x01, 0x03, 0x06, 0x02, 0x01, 0x02, 0x06, 0x02, 0x01, 0x03,
+	0x01, 0x02, 0x08, 0x04, 0x06, 0x02, 0x01, 0x03, 0x01, 0x02, 0x08, 0x04, 0x07, 0x02, 0x01, 0x02,
+	0x01, 0x02, 0x08, 0x0D, 0x01, 0x02, 0x00, 0x03, 0x08, 0x0D, 0x05, 0x02, 0x00, 0x02, 0x09, 0x03,
+	0x03, 0x03, 0x01, 0x02, 0x08, 0x04, 0x08, 0x01, 0x01, 0x04, 0x01, 0x02, 0x07, 0x02, 0x01, 0x03,
+	0x06, 0x01, 0x01, 0x04, 0x02, 0x02, 0x06, 0x02, 0x01, 0x03, 0x05, 0x02, 0x01, 0x04, 0x02, 0x02,
+	0x06, 0x01, 0x03, 0x03, 0x03, 0x03, 0x01, 0x03, 0x03, 0x02, 0x04, 0x02, 0x03, 0x08, 0x01, 0x02,
+	0x04, 0x06, 0x05, 0x06, 0x01, 0x02, 0x06, 0x02, 0x09, 0x02, 0x07, 0x00,
+	// @9118 0x9D (2 pixels wide)
+	0x2C, 0x00,
+	// @9120 0x9E (2 pixels wide)
+	0x2C, 0x00,
+	// @9122 0x9F (28 pixels wide)
+	0x02, 0x02, 0x07, 0x04, 0x07, 0x04, 0x01, 0x02, 0x07, 0x03, 0x08, 0x03, 0x02, 0x00, 0x01, 0x02,
+	0x00, 0x0C, 0x08, 0x08, 0x01, 0x02, 0x03, 0x06, 0x0D, 0x04, 0x01, 0x02, 0x04, 0x04, 0x0E, 0x03,
+	0x01, 0x02, 0x05, 0x03, 0x0E, 0x02, 0x01, 0x02, 0x06, 0x03, 0x0D, 0x02, 0x01, 0x02, 0x06, 0x03,
+	0x0C, 0x02, 0x01, 0x02, 0x07, 0x03, 0x0B, 0x01, 0x01, 0x02, 0x07, 0x04, 0x09, 0x02, 0x01, 0x02,
+	0x08, 0x03, 0x08, 0x02, 0x01, 0x02, 0x09, 0x03, 0x07, 0x02, 0x01, 0x02, 0x09, 0x03, 0x06, 0x02,
+	0x01, 0x02, 0x0A, 0x03, 0x05, 0x01, 0x01, 0x02, 0x0A, 0x04, 0x03, 0x02, 0x01, 0x02, 0x0B, 0x03,
+	0x02, 0x02, 0x01, 0x02, 0x0C, 0x03, 0x01, 0x02, 0x01, 0x01, 0x0C, 0x05, 0x0D, 0x01, 0x0D, 0x03,
+	0x01, 0x01, 0x0C, 0x05, 0x01, 0x01, 0x0A, 0x09, 0x01, 0x01, 0x08, 0x0D, 0x07, 0x00,
+	// @9248 0xA0 (2 pixels wide)
+	0x2C, 0x00,
+	// @9250 0xA1 (5 pixels wide)
+	0x0E, 0x00, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 0x04, 0x02, 0x01, 0x00, 0x05, 0x01, 0x01,
+	0x01, 0x04, 0x04, 0x00, 0x12, 0x01, 0x01, 0x03, 0x01, 0x01, 0x01, 0x04, 0x02, 0x00,
+	// @9280 0xA2 (14 pixels wide)
+	0x07, 0x00, 0x04, 0x01, 0x08, 0x02, 0x01, 0x01, 0x06, 0x07, 0x01, 0x01, 0x04, 0x0A, 0x01, 0x01,
+	0x03, 0x0B, 0x01, 0x02, 0x02, 0x04, 0x07, 0x01, 0x01, 0x01, 0x01, 0x04, 0x01, 0x01, 0x01, 0x03,
+	0x01, 0x01, 0x00, 0x04, 0x05, 0x01, 0x00, 0x03, 0x02, 0x01, 0x00, 0x04, 0x01, 0x01, 0x01, 0x04,
+	0x01, 0x01, 0x01, 0x05, 0x01, 0x02, 0x02, 0x05, 0x05, 0x02, 0x01, 0x01, 0x03, 0x0B, 0x01, 0x01,
+	0x04, 0x0A, 0x01, 0x01, 0x08, 0x03, 0x04, 0x01, 0x08, 0x02, 0x09, 0x00,
+	// @9356 0xA3 (17 pixels wide)
+	0x08, 0x00, 0x01, 0x01, 0x07, 0x09, 0x01, 0x01, 0x06, 0x0A, 0x01, 0x02, 0x05, 0x05, 0x03, 0x02,
+	0x01, 0x01, 0x05, 0x03, 0x01, 0x01, 0x04, 0x04, 0x07, 0x01, 0x04, 0x03, 0x02, 0x01, 0x00, 0x0D,
+	0x05, 0x01, 0x05, 0x03, 0x02, 0x01, 0x04, 0x03, 0x01, 0x01, 0x03, 0x03, 0x01, 0x01, 0x02, 0x03,
+	0x01, 0x01, 0x01, 0x10, 0x02, 0x01, 0x00, 0x11, 0x0A, 0x00,
+	// @9414 0xA4 (18 pixels wide)
+	0x0B, 0x00, 0x01, 0x01, 0x10, 0x01, 0x01, 0x02, 0x01, 0x02, 0x0D, 0x02, 0x01, 0x03, 0x01, 0x03,
+	0x02, 0x07, 0x02, 0x03, 0x01, 0x01, 0x02, 0x0F, 0x01, 0x02, 0x03, 0x04, 0x04, 0x05, 0x01, 0x02,
+	0x03, 0x03, 0x06, 0x04, 0x01, 0x02, 0x02, 0x03, 0x08, 0x03, 0x02, 0x02, 0x02, 0x03, 0x09, 0x03,
+	0x02, 0x02, 0x02, 0x02, 0x0A, 0x03, 0x01, 0x02, 0x02, 0x03, 0x09, 0x03, 0x01, 0x02, 0x02, 0x03,
+	0x08, 0x03, 0x01, 0x02, 0x02, 0x04, 0x07, 0x03, 0x01, 0x02, 0x03, 0x04, 0x05, 0x03, 0x01, 0x01,
+	0x02, 0x0E, 0x01, 0x03, 0x01, 0x03, 0x01, 0x08, 0x01, 0x03, 0x01, 0x03, 0x00, 0x04, 0x03, 0x05,
+	0x03, 0x03, 0x01, 0x02, 0x01, 0x02, 0x0D, 0x01, 0x0E, 0x00,
+	// @9520 0xA5 (19 pixels wide)
+	0x08, 0x00, 0x01, 0x02, 0x00, 0x04, 0x0B, 0x04, 0x01, 0x02, 0x00, 0x04, 0x0A, 0x04, 0x01, 0x02,
+	0x01, 0x04, 0x09, 0x03, 0x01, 0x02, 0x02, 0x03, 0x08, 0x04, 0x01, 0x02, 0x02, 0x04, 0x07, 0x03,
+	0x01, 0x02, 0x03, 0x03, 0x06, 0x04, 0x01, 0x02, 0x03, 0x04, 0x05, 0x03, 0x01, 0x02, 0x04, 0x03,
+	0x04, 0x03, 0x01, 0x02, 0x04, 0x04, 0x03, 0x03, 0x01, 0x02, 0x05, 0x03, 0x02, 0x03, 0x01, 0x02,
+	0x06, 0x03, 0x01, 0x03, 0x01, 0x01, 0x06, 0x06, 0x02, 0x01, 0x01, 0x10, 0x03, 0x01, 0x07, 0x04,
+	0x02, 0x01, 0x01, 0x10, 0x07, 0x01, 0x07, 0x04, 0x0A, 0x00,
+	// @9610 0xA6 (3 pixels wide)
+	0x07, 0x00, 0x0E, 0x01, 0x00, 0x03, 0x06, 0x00, 0x0E, 0x01, 0x00, 0x03, 0x03, 0x00,
+	// @9624 0xA7 (16 pixels wide)
+	0x07, 0x00, 0x01, 0x01, 0x05, 0x09, 0x01, 0x01, 0x04, 0x0B, 0x01, 0x02, 0x03, 0x04, 0x05, 0x02,
+	0x04, 0x01, 0x02, 0x03, 0x01, 0x01, 0x02, 0x05, 0x01, 0x01, 0x03, 0x06, 0x01, 0x01, 0x02, 0x0A,
+	0x01, 0x02, 0x01, 0x03, 0x02, 0x08, 0x01, 0x02, 0x01, 0x03, 0x05, 0x06, 0x01, 0x02, 0x00, 0x03,
+	0x08, 0x05, 0x01, 0x02, 0x00, 0x03, 0x0A, 0x03, 0x01, 0x02, 0x00, 0x04, 0x09, 0x03, 0x01, 0x02,
+	0x01, 0x04, 0x09, 0x02, 0x01, 0x02, 0x01, 0x06, 0x06, 0x03, 0x01, 0x02, 0x03, 0x06, 0x04, 0x03,
+	0x01, 0x01, 0x04, 0x0B, 0x01, 0x01, 0x07, 0x07, 0x01, 0x01, 0x09, 0x05, 0x01, 0x01, 0x0B, 0x04,
+	0x04, 0x01, 0x0C, 0x03, 0x01, 0x02, 0x02, 0x02, 0x07, 0x04, 0x01, 0x01, 0x02, 0x0C, 0x01, 0x01,
+	0x03, 0x09, 0x08, 0x00,
+	// @9740 0xA8 (12 pixels wide)
+	0x07, 0x00, 0x01, 0x02, 0x01, 0x02, 0x06, 0x02, 0x02, 0x02, 0x00, 0x04, 0x04, 0x04, 0x01, 0x02,
+	0x01, 0x03, 0x04, 0x03, 0x21, 0x00,
+	// @9762 0xA9 (25 pixels wide)
+	0x08, 0x00, 0x01, 0x01, 0x09, 0x07, 0x01, 0x01, 0x07, 0x0B, 0x01, 0x02, 0x05, 0x04, 0x08, 0x03,
+	0x01, 0x02, 0x04, 0x03, 0x0B, 0x03, 0x01, 0x02, 0x03, 0x03, 0x0D, 0x03, 0x01, 0x03, 0x02, 0x03,
+	0x06, 0x05, 0x04, 0x03, 0x01, 0x03, 0x02, 0x02, 0x05, 0x09, 0x03, 0x02, 0x01, 0x04, 0x01, 0x03,
+	0x04, 0x03, 0x06, 0x01, 0x04, 0x02, 0x02, 0x03, 0x01, 0x02, 0x04, 0x02, 0x0D, 0x02, 0x01, 0x03,
+	0x01, 0x02, 0x03, 0x02, 0x0F, 0x02, 0x03, 0x03, 0x00, 0x02, 0x04, 0x02, 0x0F, 0x02, 0x01, 0x03,
+	0x01, 0x02, 0x03, 0x02, 0x0E, 0x02, 0x01, 0x03, 0x01, 0x02, 0x03, 0x03, 0x0D, 0x02, 0x01, 0x03,
+	0x01, 0x02, 0x04, 0x02, 0x0D, 0x02, 0x01, 0x04, 0x01, 0x03, 0x04, 0x03, 0x06, 0x01, 0x04, 0x02,
+	0x01, 0x03, 0x02, 0x02, 0x05, 0x09, 0x03, 0x02, 0x01, 0x03, 0x03, 0x02, 0x06, 0x05, 0x04, 0x03,
+	0x01, 0x02, 0x03, 0x03, 0x0D, 0x03, 0x01, 0x02, 0x04, 0x03, 0x0B, 0x03, 0x01, 0x02, 0x05, 0x04,
+	0x07, 0x04, 0x01, 0x01, 0x07, 0x0B, 0x01, 0x01, 0x0A, 0x05, 0x0B, 0x00,
+	// @9918 0xAA (11 pixels wide)
+	0x0A, 0x00, 0x01, 0x01, 0x04, 0x03, 0x01, 0x01, 0x02, 0x07, 0x01, 0x02, 0x02, 0x02, 0x03, 0x03,
+	0x02, 0x01, 0x08, 0x03, 0x01, 0x01, 0x05, 0x06, 0x01, 0x01, 0x02, 0x09, 0x01, 0x02, 0x01, 0x03,
+	0x04, 0x03, 0x01, 0x02, 0x01, 0x02, 0x05, 0x03, 0x02, 0x02, 0x00, 0x03, 0x05, 0x03, 0x01, 0x02,
+	0x01, 0x04, 0x01, 0x05, 0x01, 0x02, 0x02, 0x06, 0x01, 0x02, 0x01, 0x01, 0x04, 0x01, 0x14, 0x00,
+	// @9982 0xAB (14 pixels wide)
+	0x11, 0x00, 0x01, 0x02, 0x05, 0x03, 0x03, 0x03, 0x01, 0x02, 0x04, 0x03, 0x04, 0x02, 0x01, 0x02,
+	0x03, 0x03, 0x04, 0x03, 0x01, 0x02, 0x03, 0x02, 0x04, 0x03, 0x01, 0x02, 0x02, 0x03, 0x03, 0x03,
+	0x01, 0x02, 0x01, 0x03, 0x04, 0x03, 0x01, 0x02, 0x00, 0x03, 0x04, 0x03, 0x01, 0x02, 0x01, 0x02,
+	0x04, 0x03, 0x01, 0x02, 0x01, 0x03, 0x04, 0x03, 0x01, 0x02, 0x02, 0x03, 0x04, 0x02, 0x01, 0x02,
+	0x03, 0x03, 0x03, 0x03, 0x01, 0x02, 0x03, 0x03, 0x04, 0x03, 0x01, 0x02, 0x04, 0x03, 0x04, 0x03,
+	0x01, 0x02, 0x05, 0x03, 0x03, 0x03, 0x0D, 0x00,
+	// @10070 0xAC (20 pixels wide)
+	0x12, 0x00, 0x02, 0x01, 0x00, 0x14, 0x09, 0x01, 0x12, 0x02, 0x0F, 0x00,
+	// @10082 0xAD (2 pixels wide)
+	0x2C, 0x00,
+	// @10084 0xAE (13 pixels wide)
+	0x07, 0x00, 0x01, 0x01, 0x03, 0x07, 0x01, 0x02, 0x02, 0x02, 0x05, 0x02, 0x01, 0x02, 0x01, 0x02,
+	0x07, 0x02, 0x01, 0x03, 0x00, 0x02, 0x02, 0x05, 0x02, 0x02, 0x01, 0x04, 0x00, 0x02, 0x02, 0x01,
+	0x03, 0x01, 0x02, 0x02, 0x01, 0x04, 0x00, 0x01, 0x03, 0x01, 0x03, 0x01, 0x02, 0x02, 0x01, 0x03,
+	0x00, 0x01, 0x03, 0x04, 0x03, 0x02, 0x01, 0x04, 0x00, 0x01, 0x03, 0x01, 0x02, 0x02, 0x02, 0x02,
+	0x01, 0x04, 0x00, 0x02, 0x02, 0x01, 0x03, 0x01, 0x02, 0x02, 0x01, 0x03, 0x00, 0x02, 0x02, 0x01,
+	0x03, 0x04, 0x01, 0x02, 0x01, 0x02, 0x06, 0x03, 0x01, 0x01, 0x02, 0x09, 0x01, 0x01, 0x04, 0x05,
+	0x18, 0x00,
+	// @10182 0xAF (9 pixels wide)
+	0x08, 0x00, 0x03, 0x01, 0x00, 0x09, 0x21, 0x00,
+	// @10190 0xB0 (11 pixels wide)
+	0x07, 0x00, 0x01, 0x01, 0x02, 0x07, 0x01, 0x02, 0x01, 0x04, 0x01, 0x04, 0x01, 0x02, 0x01, 0x02,
+	0x05, 0x02, 0x01, 0x02, 0x00, 0x03, 0x05, 0x03, 0x02, 0x02, 0x00, 0x02, 0x07, 0x02, 0x01, 0x02,
+	0x00, 0x03, 0x05, 0x03, 0x01, 0x02, 0x01, 0x02, 0x04, 0x03, 0x01, 0x01, 0x02, 0x07, 0x01, 0x01,
+	0x03, 0x05, 0x1B, 0x00,
+	// @10242 0xB1 (20 pixels wide)
+	0x0B, 0x00, 0x08, 0x01, 0x09, 0x02, 0x02, 0x01, 0x00, 0x14, 0x08, 0x01, 0x09, 0x02, 0x03, 0x00,
+	0x02, 0x01, 0x00, 0x14, 0x0A, 0x00,
+	// @10264 0xB2 (11 pixels wide)
+	0x01, 0x01, 0x05, 0x01, 0x01, 0x01, 0x02, 0x07, 0x01, 0x01, 0x01, 0x09, 0x01, 0x02, 0x01, 0x01,
+	0x05, 0x04, 0x03, 0x01, 0x08, 0x03, 0x02, 0x01, 0x07, 0x03, 0x01, 0x01, 0x06, 0x03, 0x01, 0x01,
+	0x05, 0x03, 0x01, 0x01, 0x04, 0x03, 0x01, 0x01, 0x03, 0x03, 0x01, 0x01, 0x02, 0x03, 0x01, 0x01,
+	0x01, 0x0A, 0x01, 0x01, 0x00, 0x0B, 0x1C, 0x00,
+	// @10320 0xB3 (10 pixels wide)
+	0x01, 0x01, 0x04, 0x01, 0x01, 0x01, 0x00, 0x08, 0x01, 0x01, 0x00, 0x09, 0x01, 0x01, 0x06, 0x04,
+	0x01, 0x01, 0x07, 0x03, 0x01, 0x01, 0x06, 0x03, 0x01, 0x01, 0x05, 0x04, 0x01, 0x01, 0x02, 0x05,
+	0x01, 0x01, 0x02, 0x06, 0x01, 0x01, 0x06, 0x03, 0x03, 0x01, 0x07, 0x03, 0x01, 0x01, 0x06, 0x04,
+	0x01, 0x01, 0x00, 0x09, 0x01, 0x01, 0x00, 0x08, 0x1C, 0x00,
+	// @10378 0xB4 (7 pixels wide)
+	0x06, 0x00, 0x01, 0x01, 0x03, 0x04, 0x01, 0x01, 0x03, 0x03, 0x01, 0x01, 0x02, 0x04, 0x01, 0x01,
+	0x02, 0x03, 0x01, 0x01, 0x01, 0x03, 0x01, 0x01, 0x00, 0x03, 0x20, 0x00,
+	// @10406 0xB5 (18 pixels wide)
+	0x0F, 0x00, 0x0C, 0x02, 0x00, 0x03, 0x0A, 0x03, 0x01, 0x02, 0x00, 0x04, 0x09, 0x03, 0x02, 0x02,
+	0x00, 0x04, 0x08, 0x04, 0x01, 0x02, 0x00, 0x05, 0x06, 0x05, 0x01, 0x02, 0x00, 0x07, 0x01, 0x09,
+	0x01, 0x02, 0x00, 0x0C, 0x02, 0x04, 0x01, 0x03, 0x00, 0x03, 0x01, 0x07, 0x03, 0x04, 0x07, 0x01,
+	0x00, 0x03, 0x01, 0x01, 0x00, 0x04, 0x02, 0x00,
+	// @10462 0xB6 (16 pixels wide)
+	0x07, 0x00, 0x01, 0x01, 0x07, 0x09, 0x01, 0x01, 0x04, 0x0C, 0x01, 0x02, 0x03, 0x08, 0x03, 0x02,
+	0x01, 0x02, 0x02, 0x09, 0x03, 0x02, 0x03, 0x02, 0x01, 0x0A, 0x03, 0x02, 0x03, 0x02, 0x00, 0x0B,
+	0x03, 0x02, 0x03, 0x02, 0x01, 0x0A, 0x03, 0x02, 0x01, 0x02, 0x02, 0x09, 0x03, 0x02, 0x01, 0x02,
+	0x03, 0x08, 0x03, 0x02, 0x01, 0x02, 0x04, 0x07, 0x03, 0x02, 0x0D, 0x02, 0x08, 0x03, 0x03, 0x02,
+	0x08, 0x00,
+	// @10528 0xB7 (5 pixels wide)
+	0x15, 0x00, 0x01, 0x01, 0x01, 0x03, 0x01, 0x01, 0x00, 0x04, 0x01, 0x01, 0x00, 0x05, 0x01, 0x01,
+	0x00, 0x04, 0x01, 0x01, 0x01, 0x03, 0x12, 0x00,
+	// @10552 0xB8 (7 pixels wide)
+	0x22, 0x00, 0x01, 0x01, 0x03, 0x02, 0x01, 0x01, 0x02, 0x03, 0x01, 0x01, 0x02, 0x04, 0x01, 0x01,
+	0x03, 0x04, 0x02, 0x01, 0x05, 0x02, 0x01, 0x01, 0x00, 0x07, 0x01, 0x01, 0x01, 0x05, 0x02, 0x00,
+	// @10584 0xB9 (6 pixels wide)
+	0x01, 0x00, 0x01, 0x01, 0x02, 0x04, 0x01, 0x01, 0x00, 0x06, 0x01, 0x02, 0x00, 0x02, 0x01, 0x03,
+	0x0C, 0x01, 0x03, 0x03, 0x1C, 0x00,
+	// @10606 0xBA (12 pixels wide)
+	0x0A, 0x00, 0x01, 0x01, 0x05, 0x03, 0x01, 0x01, 0x02, 0x08, 0x01, 0x02, 0x01, 0x04, 0x02, 0x04,
+	0x01, 0x02, 0x01, 0x03, 0x05, 0x03, 0x01, 0x02, 0x00, 0x03, 0x06, 0x03, 0x01, 0x02, 0x00, 0x03,
+	0x07, 0x02, 0x02, 0x02, 0x00, 0x02, 0x08, 0x02, 0x01, 0x02, 0x00, 0x03, 0x07, 0x02, 0x01, 0x02,
+	0x00, 0x03, 0x06, 0x03, 0x01, 0x02, 0x01, 0x03, 0x05, 0x03, 0x01, 0x01, 0x01, 0x0A, 0x01, 0x01,
+	0x02, 0x08, 0x01, 0x01, 0x06, 0x01, 0x14, 0x00,
+	// @10678 0xBB (13 pixels wide)
+	0x11, 0x00, 0x01, 0x02, 0x00, 0x02, 0x04, 0x03, 0x01, 0x02, 0x00, 0x03, 0x04, 0x03, 0x01, 0x02,
+	0x01, 0x03, 0x04, 0x02, 0x01, 0x02, 0x02, 0x03, 0x03, 0x03, 0x01, 0x02, 0x03, 0x02, 0x04, 0x03,
+	0x01, 0x02, 0x03, 0x03, 0x04, 0x03, 0x02, 0x02, 0x04, 0x03, 0x03, 0x03, 0x01, 0x02, 0x03, 0x03,
+	0x04, 0x02, 0x01, 0x02, 0x02, 0x03, 0x04, 0x03, 0x01, 0x02, 0x02, 0x02, 0x04, 0x03, 0x01, 0x02,
+	0x01, 0x03, 0x03, 0x03, 0x01, 0x02, 0x00, 0x03, 0x04, 0x03, 0x01, 0x02, 0x00, 0x02, 0x04, 0x03,
+	0x0D, 0x00,
+	// @10760 0xBC (27 pixels wide)
+	0x08, 0x00, 0x01, 0x02, 0x02, 0x04, 0x0C, 0x02, 0x01, 0x02, 0x00, 0x06, 0x0C, 0x02, 0x01, 0x03,
+	0x00, 0x02, 0x01, 0x03, 0x0B, 0x02, 0x01, 0x02, 0x03, 0x03, 0x0A, 0x03, 0x01, 0x02, 0x03, 0x03,
+	0x0A, 0x02, 0x01, 0x02, 0x03, 0x03, 0x09, 0x03, 0x01, 0x02, 0x03, 0x03, 0x09, 0x02, 0x02, 0x02,
+	0x03, 0x03, 0x08, 0x02, 0x01, 0x02, 0x03, 0x03, 0x07, 0x02, 0x01, 0x03, 0x03, 0x03, 0x07, 0x02,
+	0x06, 0x04, 0x01, 0x03, 0x03, 0x03, 0x06, 0x02, 0x07, 0x04, 0x01, 0x03, 0x03, 0x03, 0x05, 0x03,
+	0x06, 0x05, 0x01, 0x04, 0x03, 0x03, 0x05, 0x02, 0x06, 0x02, 0x01, 0x03, 0x01, 0x04, 0x03, 0x03,
+	0x04, 0x03, 0x05, 0x03, 0x01, 0x03, 0x01, 0x03, 0x0A, 0x02, 0x06, 0x02, 0x02, 0x03, 0x01, 0x03,
+	0x09, 0x02, 0x06, 0x02, 0x03, 0x03, 0x01, 0x03, 0x09, 0x02, 0x05, 0x03, 0x03, 0x03, 0x01, 0x03,
+	0x08, 0x02, 0x05, 0x03, 0x04, 0x03, 0x01, 0x03, 0x07, 0x03, 0x04, 0x03, 0x05, 0x03, 0x01, 0x02,
+	0x07, 0x02, 0x05, 0x0D, 0x01, 0x02, 0x06, 0x03, 0x05, 0x0D, 0x01, 0x02, 0x06, 0x02, 0x0E, 0x03,
+	0x02, 0x02, 0x05, 0x02, 0x0F, 0x03, 0x01, 0x02, 0x04, 0x02, 0x10, 0x03, 0x0A, 0x00,
+	// @10934 0xBD (27 pixels wide)
+	0x08, 0x00, 0x01, 0x02, 0x02, 0x04, 0x0C, 0x03, 0x01, 0x02, 0x00, 0x06, 0x0C, 0x02, 0x01, 0x03,
+	0x00, 0x03, 0x01, 0x02, 0x0B, 0x03, 0x01, 0x02, 0x04, 0x02, 0x0B, 0x02, 0x02, 0x02, 0x04, 0x02,
+	0x0A, 0x02, 0x01, 0x02, 0x04, 0x02, 0x09, 0x02, 0x01, 0x02, 0x04, 0x02, 0x08, 0x03, 0x01, 0x02,
+	0x04, 0x02, 0x08, 0x02, 0x01, 0x02, 0x04, 0x02, 0x07, 0x03, 0x01, 0x03, 0x04, 0x02, 0x07, 0x02,
+	0x05, 0x04, 0x01, 0x03, 0x04, 0x02, 0x06, 0x02, 0x03, 0x09, 0x01, 0x04, 0x04, 0x02, 0x06, 0x02,
+	0x03, 0x03, 0x02, 0x05, 0x01, 0x03, 0x04, 0x02, 0x05, 0x02, 0x0B, 0x03, 0x01, 0x03, 0x04, 0x02,
+	0x04, 0x03, 0x0B, 0x03, 0x01, 0x02, 0x0A, 0x02, 0x0C, 0x03, 0x01, 0x02, 0x09, 0x03, 0x0C, 0x03,
+	0x01, 0x02, 0x09, 0x02, 0x0C, 0x03, 0x01, 0x02, 0x08, 0x02, 0x0D, 0x03, 0x01, 0x02, 0x08, 0x02,
+	0x0C, 0x03, 0x01, 0x02, 0x07, 0x02, 0x0C, 0x03, 0x01, 0x02, 0x07, 0x02, 0x0B, 0x03, 0x01, 0x02,
+	0x06, 0x02, 0x0B, 0x03, 0x01, 0x02, 0x05, 0x03, 0x0A, 0x03, 0x01, 0x02, 0x05, 0x02, 0x0A, 0x0A,
+	0x01, 0x02, 0x04, 0x03, 0x0A, 0x0A, 0x0A, 0x00,
+	// @11102 0xBE (28 pixels wide)
+	0x08, 0x00, 0x01, 0x02, 0x02, 0x07, 0x0C, 0x02, 0x01, 0x02, 0x01, 0x09, 0x0A, 0x02, 0x01, 0x02,
+	0x07, 0x03, 0x0A, 0x02, 0x01, 0x02, 0x08, 0x02, 0x09, 0x02, 0x01, 0x02, 0x07, 0x03, 0x08, 0x03,
+	0x01, 0x02, 0x06, 0x04, 0x08, 0x02, 0x01, 0x02, 0x03, 0x05, 0x09, 0x03, 0x01, 0x02, 0x03, 0x06,
+	0x08, 0x02, 0x01, 0x02, 0x07, 0x03, 0x06, 0x02, 0x01, 0x02, 0x08, 0x03, 0x05, 0x02, 0x01, 0x03,
+	0x08, 0x03, 0x04, 0x02, 0x06, 0x03, 0x01, 0x03, 0x08, 0x03, 0x03, 0x03, 0x05, 0x04, 0x01, 0x03,
+	0x07, 0x04, 0x03, 0x02, 0x05, 0x05, 0x01, 0x03, 0x01, 0x09, 0x03, 0x03, 0x05, 0x05, 0x01, 0x04,
+	0x00, 0x09, 0x04, 0x02, 0x05, 0x02, 0x01, 0x03, 0x01, 0x04, 0x04, 0x01, 0x07, 0x02, 0x05, 0x03,
+	0x01, 0x03, 0x01, 0x03, 0x0C, 0x02, 0x04, 0x03, 0x02, 0x03, 0x01, 0x03, 0x0B, 0x02, 0x04, 0x03,
+	0x03, 0x03, 0x01, 0x03, 0x0A, 0x03, 0x04, 0x02, 0x04, 0x03, 0x01, 0x03, 0x0A, 0x02, 0x04, 0x02,
+	0x05, 0x03, 0x01, 0x02, 0x09, 0x03, 0x03, 0x0D, 0x01, 0x02, 0x09, 0x02, 0x04, 0x0D, 0x01, 0x02,
+	0x08, 0x03, 0x0C, 0x03, 0x01, 0x02, 0x08, 0x02, 0x0D, 0x03, 0x02, 0x02, 0x07, 0x02, 0x0E, 0x03,
+	0x0A, 0x00,
+	// @11280 0xBF (13 pixels wide)
+	0x0E, 0x00, 0x01, 0x01, 0x07, 0x01, 0x01, 0x01, 0x06, 0x03, 0x02, 0x01, 0x05, 0x05, 0x01, 0x01,
+	0x06, 0x03, 0x04, 0x00, 0x03, 0x01, 0x06, 0x03, 0x01, 0x01, 0x05, 0x04, 0x01, 0x01, 0x05, 0x03,
+	0x01, 0x01, 0x04, 0x04, 0x01, 0x01, 0x04, 0x03, 0x01, 0x01, 0x03, 0x04, 0x01, 0x01, 0x02, 0x04,
+	0x02, 0x01, 0x01, 0x04, 0x01, 0x01, 0x01, 0x03, 0x03, 0x01, 0x00, 0x04, 0x01, 0x02, 0x01, 0x04,
+	0x06, 0x01, 0x01, 0x01, 0x01, 0x0B, 0x01, 0x01, 0x02, 0x0B, 0x01, 0x01, 0x03, 0x08, 0x02, 0x00,
+	// @11360 0xC0 (22 pixels wide)
+	0x07, 0x00, 0x02, 0x01, 0x09, 0x05, 0x01, 0x01, 0x08, 0x06, 0x01, 0x01, 0x08, 0x07, 0x01, 0x02,
+	0x08, 0x03, 0x01, 0x03, 0x01, 0x02, 0x07, 0x03, 0x02, 0x03, 0x02, 0x02, 0x07, 0x03, 0x02, 0x04,
+	0x01, 0x02, 0x06, 0x04, 0x03, 0x03, 0x02, 0x02, 0x06, 0x03, 0x04, 0x04, 0x01, 0x02, 0x05, 0x04,
+	0x05, 0x03, 0x02, 0x02, 0x05, 0x03, 0x06, 0x04, 0x01, 0x02, 0x04, 0x04, 0x07, 0x03, 0x01, 0x02,
+	0x04, 0x03, 0x08, 0x04, 0x01, 0x01, 0x04, 0x0F, 0x01, 0x01, 0x03, 0x10, 0x01, 0x01, 0x03, 0x11,
+	0x01, 0x02, 0x03, 0x03, 0x0A, 0x04, 0x01, 0x02, 0x02, 0x04, 0x0B, 0x03, 0x02, 0x02, 0x02, 0x03,
+	0x0C, 0x04, 0x01, 0x02, 0x01, 0x04, 0x0D, 0x03, 0x02, 0x02, 0x01, 0x03, 0x0E, 0x04, 0x01, 0x02,
+	0x00, 0x04, 0x0F, 0x03, 0x0A, 0x00,
+	// @11478 0xC1 (17 pixels wide)
+	0x07, 0x00, 0x03, 0x01, 0x00, 0x0F, 0x07, 0x01, 0x00, 0x04, 0x01, 0x01, 0x00, 0x0B, 0x01, 0x01,
+	0x00, 0x0D, 0x01, 0x01, 0x00, 0x0F, 0x01, 0x02, 0x00, 0x04, 0x06, 0x06, 0x01, 0x02, 0x00, 0x04,
+	0x08, 0x04, 0x02, 0x02, 0x00, 0x04, 0x09, 0x04, 0x03, 0x02, 0x00, 0x04, 0x0A, 0x03, 0x02, 0x02,
+	0x00, 0x04, 0x09, 0x04, 0x01, 0x02, 0x00, 0x04, 0x08, 0x04, 0x01, 0x02, 0x00, 0x04, 0x07, 0x05,
+	0x01, 0x02, 0x00, 0x05, 0x02, 0x08, 0x01, 0x01, 0x00, 0x0D, 0x01, 0x01, 0x00, 0x0B, 0x0A, 0x00,
+	// @11558 0xC2 (17 pixels wide)
+	0x07, 0x00, 0x01, 0x01, 0x00, 0x0B, 0x01, 0x01, 0x00, 0x0D, 0x01, 0x01, 0x00, 0x0F, 0x01, 0x02,
+	0x00, 0x04, 0x07, 0x04, 0x05, 0x02, 0x00, 0x04, 0x08, 0x04, 0x01, 0x02, 0x00, 0x04, 0x08, 0x03,
+	0x01, 0x02, 0x00, 0x04, 0x07, 0x04, 0x01, 0x01, 0x00, 0x0D, 0x01, 0x01, 0x00, 0x0B, 0x01, 0x01,
+	0x00, 0x0E, 0x01, 0x02, 0x00, 0x04, 0x06, 0x05, 0x01, 0x02, 0x00, 0x04, 0x08, 0x04, 0x01, 0x02,
+	0x00, 0x04, 0x09, 0x03, 0x05, 0x02, 0x00, 0x04, 0x09, 0x04, 0x01, 0x02, 0x00, 0x04, 0x08, 0x04,
+	0x01, 0x02, 0x00, 0x04, 0x07, 0x05, 0x01, 0x02, 0x00, 0x05, 0x02, 0x08, 0x01, 0x01, 0x00, 0x0E,
+	0x01, 0x01, 0x00, 0x0B, 0x0A, 0x00,
+	// @11660 0xC3 (14 pixels wide)
+	0x07, 0x00, 0x03, 0x01, 0x00, 0x0E, 0x18, 0x01, 0x00, 0x04, 0x0A, 0x00,
+	// @11672 0xC4 (24 pixels wide)
+	0x07, 0x00, 0x03, 0x01, 0x06, 0x0F, 0x09, 0x02, 0x06, 0x04, 0x08, 0x03, 0x05, 0x02, 0x06, 0x03,
+	0x09, 0x03, 0x01, 0x02, 0x05, 0x04, 0x09, 0x03, 0x02, 0x02, 0x05, 0x03, 0x0A, 0x03, 0x01, 0x02,
+	0x04, 0x04, 0x0A, 0x03, 0x01, 0x02, 0x04, 0x03, 0x0B, 0x03, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x03,
+	0x01, 0x02, 0x03, 0x03, 0x0C, 0x03, 0x02, 0x01, 0x00, 0x18, 0x01, 0x01, 0x01, 0x17, 0x04, 0x02,
+	0x01, 0x03, 0x11, 0x03, 0x02, 0x02, 0x01, 0x02, 0x12, 0x03, 0x04, 0x00,
+	// @11748 0xC5 (15 pixels wide)
+	0x07, 0x00, 0x03, 0x01, 0x00, 0x0F, 0x08, 0x01, 0x00, 0x04, 0x03, 0x01, 0x00, 0x0E, 0x0A, 0x01,
+	0x00, 0x04, 0x03, 0x01, 0x00, 0x0F, 0x0A, 0x00,
+	// @11772 0xC6 (30 pixels wide)
+	0x07, 0x00, 0x01, 0x03, 0x00, 0x04, 0x09, 0x04, 0x09, 0x04, 0x01, 0x03, 0x01, 0x04, 0x08, 0x04,
+	0x08, 0x04, 0x01, 0x03, 0x02, 0x04, 0x07, 0x04, 0x07, 0x04, 0x01, 0x03, 0x03, 0x03, 0x07, 0x04,
+	0x07, 0x04, 0x01, 0x03, 0x03, 0x04, 0x06, 0x04, 0x06, 0x04, 0x01, 0x03, 0x04, 0x04, 0x05, 0x04,
+	0x05, 0x04, 0x01, 0x03, 0x05, 0x03, 0x05, 0x04, 0x05, 0x03, 0x01, 0x03, 0x06, 0x03, 0x04, 0x04,
+	0x04, 0x03, 0x01, 0x03, 0x06, 0x04, 0x03, 0x04, 0x03, 0x04, 0x01, 0x03, 0x07, 0x04, 0x02, 0x04,
+	0x03, 0x03, 0x01, 0x03, 0x08, 0x03, 0x02, 0x04, 0x02, 0x03, 0x01, 0x03, 0x09, 0x03, 0x01, 0x04,
+	0x01, 0x03, 0x01, 0x01, 0x09, 0x0C, 0x01, 0x01, 0x06, 0x12, 0x01, 0x01, 0x05, 0x14, 0x01, 0x03,
+	0x04, 0x05, 0x04, 0x04, 0x05, 0x04, 0x02, 0x03, 0x03, 0x04, 0x06, 0x04, 0x06, 0x04, 0x01, 0x03,
+	0x03, 0x03, 0x07, 0x04, 0x07, 0x04, 0x01, 0x03, 0x02, 0x04, 0x07, 0x04, 0x07, 0x04, 0x01, 0x03,
+	0x02, 0x03, 0x08, 0x04, 0x08, 0x03, 0x02, 0x03, 0x01, 0x04, 0x08, 0x04, 0x08, 0x04, 0x01, 0x03,
+	0x01, 0x03, 0x09, 0x04, 0x09, 0x03, 0x02, 0x03, 0x00, 0x04, 0x09, 0x04, 0x09, 0x04, 0x01, 0x03,
+	0x00, 0x03, 0x0A, 0x04, 0x0A, 0x03, 0x0A, 0x00,
+	// @11956 0xC7 (17 pixels wide)
+	0x07, 0x00, 0x01, 0x01, 0x03, 0x0A, 0x01, 0x01, 0x01, 0x0D, 0x01, 0x02, 0x01, 0x06, 0x01, 0x07,
+	0x01, 0x02, 0x02, 0x01, 0x08, 0x05, 0x05, 0x01, 0x0C, 0x04, 0x01, 0x01, 0x0B, 0x04, 0x01, 0x01,
+	0x0A, 0x04, 0x01, 0x01, 0x08, 0x05, 0x01, 0x01, 0x04, 0x07, 0x01, 0x01, 0x04, 0x09, 0x01, 0x01,
+	0x08, 0x07, 0x01, 0x01, 0x0B, 0x05, 0x01, 0x01, 0x0C, 0x04, 0x05, 0x01, 0x0D, 0x04, 0x01, 0x01,
+	0x0C, 0x05, 0x01, 0x02, 0x01, 0x01, 0x09, 0x05, 0x01, 0x02, 0x01, 0x05, 0x03, 0x06, 0x01, 0x01,
+	0x00, 0x0E, 0x01, 0x01, 0x02, 0x0A, 0x0A, 0x00,
+	// @12044 0xC8 (20 pixels wide)
+	0x07, 0x00, 0x01, 0x02, 0x00, 0x03, 0x0E, 0x03, 0x01, 0x02, 0x00, 0x03, 0x0D, 0x04, 0x02, 0x02,
+	0x00, 0x03, 0x0C, 0x05, 0x01, 0x02, 0x00, 0x03, 0x0B, 0x06, 0x01, 0x02, 0x00, 0x03, 0x0A, 0x07,
+	0x01, 0x03, 0x00, 0x03, 0x0A, 0x03, 0x01, 0x03, 0x01, 0x03, 0x00, 0x03, 0x09, 0x04, 0x01, 0x03,
+	0x02, 0x03, 0x00, 0x03, 0x08, 0x04, 0x02, 0x03, 0x01, 0x03, 0x00, 0x03, 0x07, 0x04, 0x03, 0x03,
+	0x01, 0x03, 0x00, 0x03, 0x07, 0x03, 0x04, 0x03, 0x01, 0x03, 0x00, 0x03, 0x06, 0x04, 0x04, 0x03,
+	0x02, 0x03, 0x00, 0x03, 0x05, 0x04, 0x05, 0x03, 0x01, 0x03, 0x00, 0x03, 0x04, 0x04, 0x06, 0x03,
+	0x01, 0x03, 0x00, 0x03, 0x04, 0x03, 0x07, 0x03, 0x01, 0x03, 0x00, 0x03, 0x03, 0x04, 0x07, 0x03,
+	0x01, 0x03, 0x00, 0x03, 0x02, 0x04, 0x08, 0x03, 0x01, 0x03, 0x00, 0x03, 0x02, 0x03, 0x09, 0x03,
+	0x01, 0x03, 0x00, 0x03, 0x01, 0x04, 0x09, 0x03, 0x01, 0x03, 0x00, 0x03, 0x01, 0x03, 0x0A, 0x03,
+	0x01, 0x02, 0x00, 0x07, 0x0A, 0x03, 0x01, 0x02, 0x00, 0x06, 0x0B, 0x03, 0x02, 0x02, 0x00, 0x05,
+	0x0C, 0x03, 0x01, 0x02, 0x00, 0x04, 0x0D, 0x03, 0x0A, 0x00,
+	// @12214 0xC9 (20 pixels wide)
+	0x01, 0x00, 0x01, 0x02, 0x05, 0x03, 0x05, 0x02, 0x01, 0x02, 0x05, 0x03, 0x04, 0x03, 0x01, 0x02,
+	0x06, 0x03, 0x03, 0x03, 0x01, 0x01, 0x06, 0x08, 0x01, 0x01, 0x08, 0x04, 0x01, 0x00, 0x01, 0x02,
+	0x00, 0x03, 0x0E, 0x03, 0x01, 0x02, 0x00, 0x03, 0x0D, 0x04, 0x02, 0x02, 0x00, 0x03, 0x0C, 0x05,
+	0x01, 0x02, 0x00, 0x03, 0x0B, 0x06, 0x01, 0x02, 0x00, 0x03, 0x0A, 0x07, 0x01, 0x03, 0x00, 0x03,
+	0x0A, 0x03, 0x01, 0x03, 0x01, 0x03, 0x00, 0x03, 0x09, 0x04, 0x01, 0x03, 0x02, 0x03, 0x00, 0x03,
+	0x08, 0x04, 0x02, 0x03, 0x01, 0x03, 0x00, 0x03, 0x07, 0x04, 0x03, 0x03, 0x01, 0x03, 0x00, 0x03,
+	0x07, 0x03, 0x04, 0x03, 0x01, 0x03, 0x00, 0x03, 0x06, 0x04, 0x04, 0x03, 0x02, 0x03, 0x00, 0x03,
+	0x05, 0x04, 0x05, 0x03, 0x01, 0x03, 0x00, 0x03, 0x04, 0x04, 0x06, 0x03, 0x01, 0x03, 0x00, 0x03,
+	0x04, 0x03, 0x07, 0x03, 0x01, 0x03, 0x00, 0x03, 0x03, 0x04, 0x07, 0x03, 0x01, 0x03, 0x00, 0x03,
+	0x02, 0x04, 0x08, 0x03, 0x01, 0x03, 0x00, 0x03, 0x02, 0x03, 0x09, 0x03, 0x01, 0x03, 0x00, 0x03,
+	0x01, 0x04, 0x09, 0x03, 0x01, 0x03, 0x00, 0x03, 0x01, 0x03, 0x0A, 0x03, 0x01, 0x02, 0x00, 0x07,
+	0x0A, 0x03, 0x01, 0x02, 0x00, 0x06, 0x0B, 0x03, 0x02, 0x02, 0x00, 0x05, 0x0C, 0x03, 0x01, 0x02,
+	0x00, 0x04, 0x0D, 0x03, 0x0A, 0x00,
+	// @12412 0xCA (18 pixels wide)
+	0x07, 0x00, 0x01, 0x02, 0x00, 0x04, 0x09, 0x05, 0x01, 0x02, 0x00, 0x04, 0x09, 0x04, 0x01, 0x02,
+	0x00, 0x04, 0x08, 0x04, 0x01, 0x02, 0x00, 0x04, 0x07, 0x04, 0x01, 0x02, 0x00, 0x04, 0x06, 0x04,
+	0x01, 0x02, 0x00, 0x04, 0x06, 0x03, 0x01, 0x02, 0x00, 0x04, 0x05, 0x04, 0x01, 0x02, 0x00, 0x04,
+	0x04, 0x04, 0x01, 0x02, 0x00, 0x04, 0x03, 0x04, 0x01, 0x02, 0x00, 0x04, 0x03, 0x03, 0x01, 0x02,
+	0x00, 0x04, 0x02, 0x03, 0x01, 0x02, 0x00, 0x04, 0x01, 0x04, 0x01, 0x01, 0x00, 0x08, 0x01, 0x01,
+	0x00, 0x0B, 0x01, 0x01, 0x00, 0x0D, 0x01, 0x02, 0x00, 0x04, 0x05, 0x04, 0x01, 0x02, 0x00, 0x04,
+	0x06, 0x04, 0x02, 0x02, 0x00, 0x04, 0x07, 0x04, 0x01, 0x02, 0x00, 0x04, 0x08, 0x03, 0x02, 0x02,
+	0x00, 0x04, 0x08, 0x04, 0x03, 0x02, 0x00, 0x04, 0x09, 0x04, 0x02, 0x02, 0x00, 0x04, 0x0A, 0x04,
+	0x0A, 0x00,
+	// @12542 0xCB (21 pixels wide)
+	0x07, 0x00, 0x03, 0x01, 0x05, 0x10, 0x0F, 0x02, 0x05, 0x03, 0x09, 0x04, 0x03, 0x02, 0x04, 0x04,
+	0x09, 0x04, 0x01, 0x02, 0x04, 0x03, 0x0A, 0x04, 0x01, 0x02, 0x03, 0x04, 0x0A, 0x04, 0x01, 0x02,
+	0x02, 0x05, 0x0A, 0x04, 0x01, 0x02, 0x00, 0x06, 0x0B, 0x04, 0x01, 0x02, 0x00, 0x05, 0x0C, 0x04,
+	0x01, 0x02, 0x00, 0x04, 0x0D, 0x04, 0x0A, 0x00,
+	// @12598 0xCC (28 pixels wide)
+	0x07, 0x00, 0x01, 0x02, 0x02, 0x05, 0x0F, 0x04, 0x01, 0x02, 0x02, 0x05, 0x0E, 0x05, 0x01, 0x02,
+	0x02, 0x06, 0x0D, 0x05, 0x02, 0x02, 0x02, 0x06, 0x0C, 0x06, 0x01, 0x02, 0x02, 0x07, 0x0B, 0x07,
+	0x02, 0x04, 0x02, 0x03, 0x01, 0x03, 0x0A, 0x03, 0x01, 0x04, 0x01, 0x04, 0x02, 0x03, 0x01, 0x04,
+	0x09, 0x03, 0x01, 0x04, 0x01, 0x04, 0x02, 0x03, 0x02, 0x03, 0x08, 0x03, 0x02, 0x04, 0x01, 0x04,
+	0x01, 0x04, 0x02, 0x03, 0x08, 0x03, 0x02, 0x04, 0x01, 0x04, 0x01, 0x04, 0x02, 0x04, 0x07, 0x03,
+	0x03, 0x03, 0x01, 0x04, 0x01, 0x04, 0x03, 0x03, 0x06, 0x03, 0x04, 0x03, 0x01, 0x04, 0x01, 0x03,
+	0x04, 0x03, 0x06, 0x03, 0x04, 0x03, 0x01, 0x04, 0x01, 0x03, 0x04, 0x04, 0x04, 0x04, 0x04, 0x03,
+	0x02, 0x04, 0x01, 0x03, 0x05, 0x03, 0x04, 0x03, 0x05, 0x03, 0x01, 0x04, 0x01, 0x03, 0x05, 0x04,
+	0x02, 0x03, 0x06, 0x03, 0x02, 0x04, 0x01, 0x03, 0x06, 0x03, 0x02, 0x03, 0x06, 0x03, 0x01, 0x04,
+	0x01, 0x03, 0x06, 0x04, 0x01, 0x02, 0x07, 0x03, 0x02, 0x03, 0x01, 0x03, 0x07, 0x06, 0x07, 0x04,
+	0x01, 0x03, 0x01, 0x03, 0x07, 0x05, 0x08, 0x04, 0x01, 0x03, 0x01, 0x03, 0x08, 0x04, 0x08, 0x04,
+	0x01, 0x03, 0x00, 0x04, 0x08, 0x04, 0x08, 0x04, 0x01, 0x03, 0x00, 0x04, 0x08, 0x03, 0x09, 0x04,
+	0x0A, 0x00,
+	// @12792 0xCD (20 pixels wide)
+	0x07, 0x00, 0x0B, 0x02, 0x00, 0x04, 0x0D, 0x03, 0x03, 0x01, 0x00, 0x14, 0x0D, 0x02, 0x00, 0x04,
+	0x0D, 0x03, 0x0A, 0x00,
+	// @12812 0xCE (25 pixels wide)
+	0x07, 0x00, 0x01, 0x01, 0x08, 0x0A, 0x01, 0x01, 0x06, 0x0E, 0x01, 0x02, 0x05, 0x07, 0x02, 0x07,
+	0x01, 0x02, 0x04, 0x05, 0x08, 0x05, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x05, 0x01, 0x02, 0x02, 0x05,
+	0x0C, 0x04, 0x01, 0x02, 0x02, 0x04, 0x0E, 0x04, 0x01, 0x02, 0x02, 0x03, 0x0F, 0x04, 0x01, 0x02,
+	0x01, 0x04, 0x10, 0x03, 0x01, 0x02, 0x01, 0x04, 0x10, 0x04, 0x02, 0x02, 0x01, 0x03, 0x11, 0x04,
+	0x03, 0x02, 0x00, 0x04, 0x11, 0x04, 0x02, 0x02, 0x01, 0x03, 0x11, 0x04, 0x01, 0x02, 0x01, 0x04,
+	0x10, 0x04, 0x01, 0x02, 0x01, 0x04, 0x10, 0x03, 0x01, 0x02, 0x01, 0x04, 0x0F, 0x04, 0x01, 0x02,
+	0x02, 0x04, 0x0E, 0x04, 0x01, 0x02, 0x02, 0x05, 0x0C, 0x04, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x04,
+	0x01, 0x02, 0x04, 0x05, 0x08, 0x05, 0x01, 0x02, 0x05, 0x06, 0x03, 0x07, 0x01, 0x01, 0x06, 0x0D,
+	0x01, 0x01, 0x08, 0x0A, 0x0A, 0x00,
+	// @12946 0xCF (20 pixels wide)
+	0x07, 0x00, 0x03, 0x01, 0x00, 0x14, 0x18, 0x02, 0x00, 0x04, 0x0C, 0x04, 0x0A, 0x00,
+	// @12960 0xD0 (17 pixels wide)
+	0x07, 0x00, 0x01, 0x01, 0x00, 0x0B, 0x01, 0x01, 0x00, 0x0E, 0x01, 0x01, 0x00, 0x0F, 0x01, 0x02,
+	0x00, 0x04, 0x07, 0x05, 0x01, 0x02, 0x00, 0x04, 0x08, 0x04, 0x01, 0x02, 0x00, 0x04, 0x09, 0x03,
+	0x04, 0x02, 0x00, 0x04, 0x09, 0x04, 0x01, 0x02, 0x00, 0x04, 0x09, 0x03, 0x01, 0x02, 0x00, 0x04,
+	0x08, 0x04, 0x01, 0x02, 0x00, 0x04, 0x07, 0x04, 0x01, 0x02, 0x00, 0x05, 0x03, 0x07, 0x01, 0x01,
+	0x00, 0x0D, 0x01, 0x01, 0x00, 0x0C, 0x0B, 0x01, 0x00, 0x04, 0x0A, 0x00,
+	// @13036 0xD1 (21 pixels wide)
+	0x07, 0x00, 0x01, 0x01, 0x09, 0x0B, 0x01, 0x01, 0x07, 0x0E, 0x01, 0x01, 0x06, 0x0E, 0x01, 0x01,
+	0x04, 0x06, 0x01, 0x01, 0x03, 0x05, 0x01, 0x01, 0x03, 0x04, 0x02, 0x01, 0x02, 0x04, 0x02, 0x01,
+	0x01, 0x04, 0x02, 0x01, 0x01, 0x03, 0x03, 0x01, 0x00, 0x04, 0x02, 0x01, 0x01, 0x03, 0x03, 0x01,
+	0x01, 0x04, 0x01, 0x01, 0x02, 0x04, 0x01, 0x01, 0x02, 0x05, 0x01, 0x01, 0x03, 0x05, 0x01, 0x01,
+	0x04, 0x06, 0x01, 0x01, 0x05, 0x0F, 0x01, 0x01, 0x06, 0x0F, 0x01, 0x01, 0x08, 0x0C, 0x0A, 0x00,
+	// @13116 0xD2 (20 pixels wide)
+	0x07, 0x00, 0x03, 0x01, 0x00, 0x14, 0x18, 0x01, 0x08, 0x04, 0x0A, 0x00,
+	// @13128 0xD3 (21 pixels wide)
+	0x07, 0x00, 0x01, 0x02, 0x00, 0x04, 0x0D, 0x04, 0x01, 0x02, 0x01, 0x04, 0x0C, 0x03, 0x01, 0x02,
+	0x01, 0x04, 0x0B, 0x04, 0x01, 0x02, 0x02, 0x04, 0x0A, 0x04, 0x01, 0x02, 0x02, 0x04, 0x0A, 0x03,
+	0x01, 0x02, 0x03, 0x04, 0x08, 0x04, 0x01, 0x02, 0x03, 0x04, 0x08, 0x03, 0x01, 0x02, 0x04, 0x04,
+	0x07, 0x03, 0x01, 0x02, 0x04, 0x04, 0x06, 0x04, 0x01, 0x02, 0x05, 0x03, 0x06, 0x03, 0x01, 0x02,
+	0x05, 0x04, 0x04, 0x04, 0x01, 0x02, 0x06, 0x03, 0x04, 0x03, 0x01, 0x02, 0x06, 0x04, 0x03, 0x03,
+	0x01, 0x02, 0x07, 0x03, 0x02, 0x04, 0x01, 0x02, 0x07, 0x04, 0x01, 0x03, 0x01, 0x02, 0x08, 0x03,
+	0x01, 0x03, 0x01, 0x01, 0x08, 0x06, 0x01, 0x01, 0x09, 0x05, 0x02, 0x01, 0x09, 0x04, 0x01, 0x01,
+	0x09, 0x03, 0x01, 0x01, 0x08, 0x04, 0x01, 0x01, 0x08, 0x03, 0x01, 0x01, 0x07, 0x04, 0x01, 0x01,
+	0x04, 0x06, 0x01, 0x01, 0x02, 0x07, 0x01, 0x01, 0x02, 0x06, 0x0A, 0x00,
+	// @13268 0xD4 (27 pixels wide)
+	0x06, 0x00, 0x02, 0x01, 0x0C, 0x03, 0x01, 0x01, 0x0B, 0x06, 0x01, 0x01, 0x07, 0x0D, 0x01, 0x01,
+	0x05, 0x11, 0x01, 0x03, 0x04, 0x05, 0x03, 0x03, 0x03, 0x05, 0x01, 0x03, 0x03, 0x04, 0x05, 0x03,
+	0x05, 0x04, 0x01, 0x03, 0x02, 0x04, 0x06, 0x03, 0x06, 0x04, 0x01, 0x03, 0x02, 0x04, 0x06, 0x03,
+	0x07, 0x03, 0x02, 0x03, 0x01, 0x04, 0x07, 0x03, 0x07, 0x04, 0x02, 0x03, 0x01, 0x03, 0x08, 0x03,
+	0x08, 0x03, 0x03, 0x03, 0x00, 0x04, 0x08, 0x03, 0x08, 0x04, 0x02, 0x03, 0x01, 0x03, 0x08, 0x03,
+	0x08, 0x03, 0x02, 0x03, 0x01, 0x04, 0x07, 0x03, 0x07, 0x04, 0x02, 0x03, 0x02, 0x04, 0x06, 0x03,
+	0x06, 0x04, 0x01, 0x03, 0x03, 0x05, 0x04, 0x03, 0x05, 0x04, 0x01, 0x03, 0x04, 0x05, 0x03, 0x03,
+	0x03, 0x05, 0x01, 0x01, 0x05, 0x11, 0x01, 0x01, 0x07, 0x0D, 0x01, 0x01, 0x0B, 0x05, 0x02, 0x01,
+	0x0C, 0x03, 0x09, 0x00,
+	// @13400 0xD5 (21 pixels wide)
+	0x07, 0x00, 0x02, 0x02, 0x01, 0x04, 0x0B, 0x04, 0x01, 0x02, 0x02, 0x04, 0x09, 0x04, 0x01, 0x02,
+	0x02, 0x04, 0x09, 0x03, 0x01, 0x02, 0x03, 0x04, 0x07, 0x04, 0x01, 0x02, 0x04, 0x03, 0x06, 0x04,
+	0x01, 0x02, 0x04, 0x04, 0x05, 0x04, 0x01, 0x02, 0x05, 0x04, 0x03, 0x04, 0x01, 0x02, 0x05, 0x04,
+	0x03, 0x03, 0x01, 0x02, 0x06, 0x04, 0x01, 0x04, 0x01, 0x02, 0x07, 0x03, 0x01, 0x03, 0x01, 0x01,
+	0x07, 0x06, 0x03, 0x01, 0x08, 0x05, 0x01, 0x01, 0x07, 0x07, 0x01, 0x02, 0x06, 0x04, 0x01, 0x03,
+	0x01, 0x02, 0x06, 0x03, 0x02, 0x04, 0x01, 0x02, 0x05, 0x04, 0x03, 0x04, 0x01, 0x02, 0x05, 0x03,
+	0x04, 0x04, 0x01, 0x02, 0x04, 0x04, 0x05, 0x04, 0x01, 0x02, 0x03, 0x04, 0x07, 0x04, 0x01, 0x02,
+	0x03, 0x03, 0x08, 0x04, 0x01, 0x02, 0x02, 0x04, 0x09, 0x04, 0x01, 0x02, 0x02, 0x03, 0x0A, 0x04,
+	0x01, 0x02, 0x01, 0x04, 0x0B, 0x04, 0x01, 0x02, 0x00, 0x04, 0x0D, 0x04, 0x0A, 0x00,
+	// @13542 0xD6 (22 pixels wide)
+	0x07, 0x00, 0x18, 0x02, 0x00, 0x04, 0x0C, 0x03, 0x03, 0x01, 0x00, 0x16, 0x06, 0x01, 0x13, 0x03,
+	0x04, 0x00,
+	// @13560 0xD7 (18 pixels wide)
+	0x07, 0x00, 0x0B, 0x02, 0x00, 0x03, 0x0B, 0x04, 0x02, 0x02, 0x00, 0x04, 0x0A, 0x04, 0x01, 0x02,
+	0x01, 0x04, 0x08, 0x05, 0x01, 0x01, 0x01, 0x11, 0x01, 0x01, 0x02, 0x10, 0x01, 0x02, 0x04, 0x08,
+	0x02, 0x04, 0x0A, 0x01, 0x0E, 0x04, 0x0A, 0x00,
+	// @13600 0xD8 (28 pixels wide)
+	0x07, 0x00, 0x18, 0x03, 0x00, 0x03, 0x09, 0x04, 0x08, 0x04, 0x03, 0x01, 0x00, 0x1C, 0x0A, 0x00,
+	// @13616 0xD9 (30 pixels wide)
+	0x07, 0x00, 0x18, 0x03, 0x00, 0x03, 0x09, 0x04, 0x08, 0x04, 0x03, 0x01, 0x00, 0x1E, 0x06, 0x01,
+	0x1B, 0x03, 0x04, 0x00,
+	// @13636 0xDA (24 pixels wide)
+	0x07, 0x00, 0x03, 0x01, 0x00, 0x0A, 0x07, 0x01, 0x07, 0x03, 0x01, 0x01, 0x07, 0x0B, 0x01, 0x01,
+	0x07, 0x0D, 0x01, 0x01, 0x07, 0x0E, 0x01, 0x02, 0x07, 0x03, 0x07, 0x05, 0x01, 0x02, 0x07, 0x03,
+	0x08, 0x05, 0x01, 0x02, 0x07, 0x03, 0x09, 0x04, 0x01, 0x02, 0x07, 0x03, 0x0A, 0x03, 0x03, 0x02,
+	0x07, 0x03, 0x0A, 0x04, 0x01, 0x02, 0x07, 0x03, 0x0A, 0x03, 0x02, 0x02, 0x07, 0x03, 0x09, 0x04,
+	0x01, 0x02, 0x07, 0x03, 0x07, 0x05, 0x01, 0x02, 0x07, 0x05, 0x02, 0x07, 0x01, 0x01, 0x07, 0x0D,
+	0x01, 0x01, 0x07, 0x0B, 0x0A, 0x00,
+	// @13722 0xDB (24 pixels wide)
+	0x07, 0x00, 0x0A, 0x02, 0x00, 0x04, 0x10, 0x04, 0x01, 0x02, 0x00, 0x0B, 0x09, 0x04, 0x01, 0x02,
+	0x00, 0x0D, 0x07, 0x04, 0x01, 0x02, 0x00, 0x0F, 0x05, 0x04, 0x01, 0x03, 0x00, 0x04, 0x06, 0x06,
+	0x04, 0x04, 0x01, 0x03, 0x00, 0x04, 0x08, 0x04, 0x04, 0x04, 0x07, 0x03, 0x00, 0x04, 0x09, 0x04,
+	0x03, 0x04, 0x01, 0x03, 0x00, 0x04, 0x08, 0x04, 0x04, 0x04, 0x01, 0x03, 0x00, 0x04, 0x07, 0x05,
+	0x04, 0x04, 0x01, 0x03, 0x00, 0x05, 0x02, 0x08, 0x05, 0x04, 0x01, 0x02, 0x00, 0x0D, 0x07, 0x04,
+	0x01, 0x02, 0x00, 0x0B, 0x09, 0x04, 0x0A, 0x00,
+	// @13810 0xDC (17 pixels wide)
+	0x07, 0x00, 0x0A, 0x01, 0x00, 0x04, 0x01, 0x01, 0x00, 0x0B, 0x01, 0x01, 0x00, 0x0E, 0x01, 0x01,
+	0x00, 0x0F, 0x01, 0x02, 0x00, 0x04, 0x06, 0x06, 0x01, 0x02, 0x00, 0x04, 0x08, 0x04, 0x02, 0x02,
+	0x00, 0x04, 0x09, 0x04, 0x03, 0x02, 0x00, 0x04, 0x0A, 0x03, 0x02, 0x02, 0x00, 0x04, 0x09, 0x04,
+	0x01, 0x02, 0x00, 0x04, 0x08, 0x04, 0x01, 0x02, 0x00, 0x04, 0x07, 0x05, 0x01, 0x02, 0x00, 0x05,
+	0x02, 0x08, 0x01, 0x01, 0x00, 0x0D, 0x01, 0x01, 0x00, 0x0B, 0x0A, 0x00,
+	// @13886 0xDD (20 pixels wide)
+	0x07, 0x00, 0x01, 0x01, 0x02, 0x0B, 0x01, 0x01, 0x01, 0x0E, 0x01, 0x02, 0x01, 0x06, 0x01, 0x08,
+	0x01, 0x02, 0x01, 0x01, 0x0A, 0x05, 0x01, 0x01, 0x0D, 0x05, 0x01, 0x01, 0x0E, 0x04, 0x02, 0x01,
+	0x0F, 0x04, 0x04, 0x01, 0x10, 0x04, 0x03, 0x01, 0x04, 0x10, 0x04, 0x01, 0x10, 0x04, 0x02, 0x01,
+	0x0F, 0x04, 0x01, 0x01, 0x0E, 0x04, 0x01, 0x01, 0x0D, 0x05, 0x01, 0x01, 0x0B, 0x06, 0x01, 0x02,
+	0x01, 0x05, 0x01, 0x09, 0x01, 0x01, 0x00, 0x0E, 0x01, 0x01, 0x01, 0x0B, 0x0A, 0x00,
+	// @13964 0xDE (30 pixels wide)
+	0x07, 0x00, 0x01, 0x02, 0x00, 0x04, 0x0A, 0x0A, 0x01, 0x02, 0x00, 0x04, 0x09, 0x0C, 0x01, 0x03,
+	0x00, 0x04, 0x07, 0x07, 0x02, 0x06, 0x01, 0x03, 0x00, 0x04, 0x07, 0x04, 0x08, 0x04, 0x01, 0x03,
+	0x00, 0x04, 0x06, 0x04, 0x0A, 0x04, 0x01, 0x03, 0x00, 0x04, 0x05, 0x04, 0x0C, 0x04, 0x01, 0x03,
+	0x00, 0x04, 0x05, 0x03, 0x0D, 0x04, 0x01, 0x03, 0x00, 0x04, 0x04, 0x04, 0x0E, 0x03, 0x01, 0x03,
+	0x00, 0x04, 0x04, 0x04, 0x0E, 0x04, 0x02, 0x03, 0x00, 0x04, 0x04, 0x03, 0x0F, 0x04, 0x01, 0x03,
+	0x00, 0x04, 0x04, 0x03, 0x10, 0x03, 0x03, 0x02, 0x00, 0x0B, 0x10, 0x03, 0x01, 0x03, 0x00, 0x04,
+	0x03, 0x04, 0x10, 0x03, 0x02, 0x03, 0x00, 0x04, 0x04, 0x03, 0x0F, 0x04, 0x01, 0x03, 0x00, 0x04,
+	0x04, 0x04, 0x0E, 0x04, 0x01, 0x03, 0x00, 0x04, 0x04, 0x04, 0x0E, 0x03, 0x01, 0x03, 0x00, 0x04,
+	0x05, 0x03, 0x0D, 0x04, 0x01, 0x03, 0x00, 0x04, 0x05, 0x04, 0x0C, 0x03, 0x01, 0x03, 0x00, 0x04,
+	0x06, 0x04, 0x0A, 0x04, 0x01, 0x03, 0x00, 0x04, 0x06, 0x05, 0x08, 0x04, 0x01, 0x03, 0x00, 0x04,
+	0x07, 0x06, 0x03, 0x06, 0x01, 0x02, 0x00, 0x04, 0x08, 0x0D, 0x01, 0x02, 0x00, 0x04, 0x0A, 0x09,
+	0x0A, 0x00,
+	// @14142 0xDF (18 pixels wide)
+	0x07, 0x00, 0x01, 0x01, 0x06, 0x0C, 0x01, 0x01, 0x04, 0x0E, 0x01, 0x01, 0x03, 0x0F, 0x01, 0x02,
+	0x02, 0x05, 0x07, 0x04, 0x01, 0x02, 0x02, 0x03, 0x09, 0x04, 0x05, 0x02, 0x01, 0x04, 0x09, 0x04,
+	0x01, 0x02, 0x02, 0x04, 0x08, 0x04, 0x01, 0x02, 0x02, 0x05, 0x07, 0x04, 0x01, 0x02, 0x03, 0x06,
+	0x05, 0x04, 0x01, 0x01, 0x05, 0x0D, 0x01, 0x01, 0x06, 0x0C, 0x01, 0x02, 0x05, 0x05, 0x04, 0x04,
+	0x01, 0x02, 0x04, 0x04, 0x06, 0x04, 0x01, 0x02, 0x03, 0x04, 0x07, 0x04, 0x01, 0x02, 0x03, 0x03,
+	0x08, 0x04, 0x02, 0x02, 0x02, 0x04, 0x08, 0x04, 0x01, 0x02, 0x02, 0x03, 0x09, 0x04, 0x02, 0x02,
+	0x01, 0x04, 0x09, 0x04, 0x01, 0x02, 0x01, 0x03, 0x0A, 0x04, 0x02, 0x02, 0x00, 0x04, 0x0A, 0x04,
+	0x0A, 0x00,
+	// @14256 0xE0 (16 pixels wide)
+	0x0E, 0x00, 0x01, 0x01, 0x05, 0x06, 0x01, 0x01, 0x02, 0x0B, 0x01, 0x01, 0x02, 0x0C, 0x01, 0x02,
+	0x02, 0x02, 0x06, 0x05, 0x01, 0x01, 0x0B, 0x04, 0x02, 0x01, 0x0C, 0x03, 0x01, 0x01, 0x0C, 0x04,
+	0x01, 0x01, 0x06, 0x0A, 0x01, 0x01, 0x03, 0x0D, 0x01, 0x02, 0x02, 0x06, 0x04, 0x04, 0x01, 0x02,
+	0x01, 0x04, 0x07, 0x04, 0x02, 0x02, 0x01, 0x03, 0x08, 0x04, 0x02, 0x02, 0x00, 0x04, 0x08, 0x04,
+	0x01, 0x02, 0x01, 0x03, 0x07, 0x05, 0x01, 0x02, 0x01, 0x05, 0x03, 0x07, 0x01, 0x02, 0x02, 0x09,
+	0x01, 0x04, 0x01, 0x02, 0x03, 0x07, 0x03, 0x03, 0x0A, 0x00,
+	// @14346 0xE1 (18 pixels wide)
+	0x05, 0x00, 0x01, 0x01, 0x0E, 0x02, 0x01, 0x01, 0x09, 0x07, 0x01, 0x01, 0x07, 0x09, 0x01, 0x01,
+	0x05, 0x09, 0x01, 0x01, 0x04, 0x05, 0x01, 0x01, 0x03, 0x04, 0x01, 0x01, 0x02, 0x04, 0x01, 0x01,
+	0x01, 0x04, 0x02, 0x01, 0x01, 0x03, 0x01, 0x02, 0x00, 0x03, 0x03, 0x07, 0x01, 0x02, 0x00, 0x03,
+	0x01, 0x0B, 0x01, 0x02, 0x00, 0x07, 0x03, 0x06, 0x01, 0x02, 0x00, 0x05, 0x07, 0x04, 0x02, 0x02,
+	0x00, 0x04, 0x09, 0x04, 0x01, 0x02, 0x00, 0x04, 0x0A, 0x03, 0x04, 0x02, 0x00, 0x03, 0x0B, 0x04,
+	0x02, 0x02, 0x00, 0x04, 0x0A, 0x03, 0x01, 0x02, 0x01, 0x03, 0x09, 0x04, 0x01, 0x02, 0x01, 0x04,
+	0x08, 0x04, 0x01, 0x02, 0x02, 0x04, 0x06, 0x04, 0x01, 0x02, 0x02, 0x05, 0x03, 0x05, 0x01, 0x01,
+	0x03, 0x0B, 0x01, 0x01, 0x05, 0x08, 0x0A, 0x00,
+	// @14466 0xE2 (15 pixels wide)
+	0x0E, 0x00, 0x01, 0x01, 0x03, 0x05, 0x01, 0x01, 0x00, 0x0C, 0x01, 0x01, 0x00, 0x0E, 0x01, 0x02,
+	0x00, 0x03, 0x07, 0x04, 0x02, 0x02, 0x00, 0x03, 0x08, 0x04, 0x01, 0x02, 0x00, 0x03, 0x08, 0x03,
+	0x01, 0x02, 0x00, 0x03, 0x07, 0x04, 0x01, 0x02, 0x00, 0x03, 0x05, 0x05, 0x01, 0x01, 0x00, 0x0B,
+	0x01, 0x01, 0x00, 0x0D, 0x01, 0x02, 0x00, 0x03, 0x06, 0x05, 0x01, 0x02, 0x00, 0x03, 0x08, 0x04,
+	0x03, 0x02, 0x00, 0x03, 0x09, 0x03, 0x01, 0x02, 0x00, 0x03, 0x08, 0x04, 0x01, 0x02, 0x00, 0x03,
+	0x06, 0x05, 0x01, 0x01, 0x00, 0x0D, 0x01, 0x01, 0x00, 0x0B, 0x0A, 0x00,
+	// @14558 0xE3 (12 pixels wide)
+	0x0F, 0x00, 0x02, 0x01, 0x00, 0x0C, 0x11, 0x01, 0x00, 0x03, 0x0A, 0x00,
+	// @14570 0xE4 (20 pixels wide)
+	0x0F, 0x00, 0x02, 0x01, 0x05, 0x0D, 0x08, 0x02, 0x05, 0x03, 0x06, 0x04, 0x01, 0x02, 0x04, 0x04,
+	0x06, 0x04, 0x02, 0x02, 0x04, 0x03, 0x07, 0x04, 0x01, 0x02, 0x03, 0x04, 0x07, 0x04, 0x01, 0x02,
+	0x03, 0x03, 0x08, 0x04, 0x01, 0x02, 0x02, 0x04, 0x08, 0x04, 0x03, 0x01, 0x00, 0x14, 0x06, 0x02,
+	0x00, 0x03, 0x0E, 0x03, 0x04, 0x00,
+	// @14624 0xE5 (17 pixels wide)
+	0x0E, 0x00, 0x01, 0x01, 0x06, 0x05, 0x01, 0x01, 0x04, 0x09, 0x01, 0x01, 0x03, 0x0B, 0x01, 0x02,
+	0x02, 0x04, 0x05, 0x04, 0x01, 0x02, 0x01, 0x04, 0x07, 0x04, 0x01, 0x02, 0x01, 0x03, 0x09, 0x03,
+	0x02, 0x02, 0x00, 0x03, 0x0A, 0x03, 0x03, 0x01, 0x00, 0x11, 0x03, 0x01, 0x00, 0x03, 0x01, 0x01,
+	0x00, 0x04, 0x01, 0x01, 0x01, 0x03, 0x01, 0x01, 0x01, 0x04, 0x01, 0x02, 0x02, 0x06, 0x04, 0x03,
+	0x01, 0x01, 0x03, 0x0C, 0x01, 0x01, 0x05, 0x0A, 0x0A, 0x00,
+	// @14698 0xE6 (26 pixels wide)
+	0x0F, 0x00, 0x01, 0x03, 0x01, 0x04, 0x07, 0x03, 0x06, 0x04, 0x01, 0x03, 0x02, 0x04, 0x06, 0x03,
+	0x06, 0x04, 0x01, 0x03, 0x03, 0x04, 0x05, 0x03, 0x05, 0x04, 0x01, 0x03, 0x04, 0x03, 0x05, 0x03,
+	0x04, 0x04, 0x01, 0x03, 0x05, 0x03, 0x04, 0x03, 0x03, 0x04, 0x01, 0x03, 0x06, 0x03, 0x03, 0x03,
+	0x03, 0x03, 0x01, 0x03, 0x07, 0x03, 0x02, 0x03, 0x02, 0x03, 0x01, 0x03, 0x07, 0x04, 0x01, 0x03,
+	0x01, 0x03, 0x01, 0x01, 0x08, 0x0B, 0x01, 0x01, 0x05, 0x10, 0x01, 0x03, 0x04, 0x06, 0x02, 0x03,
+	0x02, 0x06, 0x01, 0x03, 0x03, 0x04, 0x05, 0x03, 0x04, 0x04, 0x01, 0x03, 0x03, 0x04, 0x05, 0x03,
+	0x05, 0x04, 0x01, 0x03, 0x02, 0x04, 0x06, 0x03, 0x06, 0x03, 0x01, 0x03, 0x02, 0x04, 0x06, 0x03,
+	0x06, 0x04, 0x01, 0x03, 0x02, 0x03, 0x07, 0x03, 0x06, 0x04, 0x01, 0x03, 0x01, 0x04, 0x07, 0x03,
+	0x07, 0x03, 0x01, 0x03, 0x01, 0x03, 0x08, 0x03, 0x07, 0x04, 0x01, 0x03, 0x00, 0x04, 0x08, 0x03,
+	0x08, 0x03, 0x0A, 0x00,
+	// @14846 0xE7 (15 pixels wide)
+	0x0E, 0x00, 0x01, 0x01, 0x05, 0x05, 0x01, 0x01, 0x02, 0x0A, 0x01, 0x01, 0x01, 0x0C, 0x01, 0x02,
+	0x01, 0x02, 0x06, 0x05, 0x03, 0x01, 0x0A, 0x04, 0x01, 0x01, 0x09, 0x04, 0x01, 0x01, 0x07, 0x05,
+	0x01, 0x01, 0x04, 0x06, 0x01, 0x01, 0x04, 0x08, 0x01, 0x01, 0x08, 0x05, 0x01, 0x01, 0x0A, 0x04,
+	0x03, 0x01, 0x0B, 0x04, 0x01, 0x01, 0x0A, 0x04, 0x01, 0x02, 0x01, 0x03, 0x04, 0x06, 0x01, 0x01,
+	0x00, 0x0D, 0x01, 0x01, 0x01, 0x0A, 0x0A, 0x00,
+	// @14918 0xE8 (16 pixels wide)
+	0x0F, 0x00, 0x01, 0x02, 0x00, 0x03, 0x09, 0x04, 0x02, 0x02, 0x00, 0x03, 0x08, 0x05, 0x01, 0x02,
+	0x00, 0x03, 0x07, 0x06, 0x02, 0x03, 0x00, 0x03, 0x06, 0x03, 0x01, 0x03, 0x01, 0x03, 0x00, 0x03,
+	0x05, 0x03, 0x02, 0x03, 0x01, 0x03, 0x00, 0x03, 0x04, 0x04, 0x02, 0x03, 0x01, 0x03, 0x00, 0x03,
+	0x04, 0x03, 0x03, 0x03, 0x01, 0x03, 0x00, 0x03, 0x03, 0x04, 0x03, 0x03, 0x01, 0x03, 0x00, 0x03,
+	0x03, 0x03, 0x04, 0x03, 0x02, 0x03, 0x00, 0x03, 0x02, 0x03, 0x05, 0x03, 0x02, 0x03, 0x00, 0x03,
+	0x01, 0x03, 0x06, 0x03, 0x01, 0x02, 0x00, 0x06, 0x07, 0x03, 0x02, 0x02, 0x00, 0x05, 0x08, 0x03,
+	0x01, 0x02, 0x00, 0x04, 0x09, 0x03, 0x0A, 0x00,
+	// @15022 0xE9 (16 pixels wide)
+	0x07, 0x00, 0x01, 0x02, 0x03, 0x03, 0x05, 0x02, 0x01, 0x02, 0x03, 0x03, 0x04, 0x03, 0x01, 0x02,
+	0x04, 0x03, 0x02, 0x04, 0x01, 0x01, 0x04, 0x08, 0x01, 0x01, 0x06, 0x04, 0x03, 0x00, 0x01, 0x02,
+	0x00, 0x03, 0x09, 0x04, 0x02, 0x02, 0x00, 0x03, 0x08, 0x05, 0x01, 0x02, 0x00, 0x03, 0x07, 0x06,
+	0x02, 0x03, 0x00, 0x03, 0x06, 0x03, 0x01, 0x03, 0x01, 0x03, 0x00, 0x03, 0x05, 0x03, 0x02, 0x03,
+	0x01, 0x03, 0x00, 0x03, 0x04, 0x04, 0x02, 0x03, 0x01, 0x03, 0x00, 0x03, 0x04, 0x03, 0x03, 0x03,
+	0x01, 0x03, 0x00, 0x03, 0x03, 0x04, 0x03, 0x03, 0x01, 0x03, 0x00, 0x03, 0x03, 0x03, 0x04, 0x03,
+	0x02, 0x03, 0x00, 0x03, 0x02, 0x03, 0x05, 0x03, 0x02, 0x03, 0x00, 0x03, 0x01, 0x03, 0x06, 0x03,
+	0x01, 0x02, 0x00, 0x06, 0x07, 0x03, 0x02, 0x02, 0x00, 0x05, 0x08, 0x03, 0x01, 0x02, 0x00, 0x04,
+	0x09, 0x03, 0x0A, 0x00,
+	// @15154 0xEA (16 pixels wide)
+	0x0F, 0x00, 0x01, 0x02, 0x00, 0x03, 0x08, 0x04, 0x01, 0x02, 0x00, 0x03, 0x07, 0x04, 0x01, 0x02,
+	0x00, 0x03, 0x06, 0x04, 0x01, 0x02, 0x00, 0x03, 0x05, 0x04, 0x01, 0x02, 0x00, 0x03, 0x04, 0x04,
+	0x01, 0x02, 0x00, 0x03, 0x03, 0x04, 0x01, 0x02, 0x00, 0x03, 0x03, 0x03, 0x01, 0x02, 0x00, 0x03,
+	0x02, 0x03, 0x01, 0x01, 0x00, 0x08, 0x01, 0x01, 0x00, 0x0A, 0x01, 0x02, 0x00, 0x03, 0x02, 0x07,
+	0x01, 0x02, 0x00, 0x03, 0x05, 0x04, 0x01, 0x02, 0x00, 0x03, 0x06, 0x04, 0x02, 0x02, 0x00, 0x03,
+	0x07, 0x04, 0x01, 0x02, 0x00, 0x03, 0x08, 0x03, 0x01, 0x02, 0x00, 0x03, 0x08, 0x04, 0x01, 0x02,
+	0x00, 0x03, 0x09, 0x03, 0x01, 0x02, 0x00, 0x03, 0x09, 0x04, 0x0A, 0x00,
+	// @15262 0xEB (17 pixels wide)
+	0x0F, 0x00, 0x02, 0x01, 0x04, 0x0D, 0x0B, 0x02, 0x04, 0x03, 0x07, 0x03, 0x02, 0x02, 0x03, 0x04,
+	0x07, 0x03, 0x01, 0x02, 0x02, 0x04, 0x08, 0x03, 0x01, 0x02, 0x00, 0x06, 0x08, 0x03, 0x01, 0x02,
+	0x00, 0x05, 0x09, 0x03, 0x01, 0x02, 0x00, 0x04, 0x0A, 0x03, 0x0A, 0x00,
+	// @15306 0xEC (22 pixels wide)
+	0x0F, 0x00, 0x02, 0x02, 0x01, 0x05, 0x0A, 0x05, 0x01, 0x02, 0x01, 0x06, 0x08, 0x06, 0x01, 0x03,
+	0x01, 0x06, 0x08, 0x02, 0x01, 0x03, 0x01, 0x03, 0x01, 0x06, 0x07, 0x03, 0x01, 0x03, 0x01, 0x04,
+	0x01, 0x03, 0x01, 0x03, 0x06, 0x03, 0x01, 0x03, 0x01, 0x04, 0x01, 0x03, 0x01, 0x03, 0x06, 0x02,
+	0x02, 0x03, 0x01, 0x04, 0x01, 0x03, 0x01, 0x03, 0x05, 0x03, 0x02, 0x03, 0x01, 0x04, 0x00, 0x04,
+	0x02, 0x03, 0x04, 0x03, 0x02, 0x03, 0x01, 0x04, 0x00, 0x03, 0x03, 0x03, 0x04, 0x02, 0x03, 0x03,
+	0x01, 0x04, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x01, 0x04, 0x00, 0x03, 0x04, 0x03,
+	0x02, 0x03, 0x03, 0x03, 0x01, 0x04, 0x00, 0x03, 0x04, 0x03, 0x02, 0x02, 0x04, 0x03, 0x01, 0x04,
+	0x00, 0x03, 0x04, 0x03, 0x01, 0x03, 0x04, 0x04, 0x03, 0x03, 0x00, 0x03, 0x05, 0x05, 0x05, 0x04,
+	0x01, 0x03, 0x00, 0x03, 0x06, 0x03, 0x06, 0x04, 0x01, 0x03, 0x00, 0x03, 0x06, 0x03, 0x07, 0x03,
+	0x0A, 0x00,
+	// @15452 0xED (16 pixels wide)
+	0x0F, 0x00, 0x07, 0x02, 0x00, 0x03, 0x09, 0x04, 0x03, 0x01, 0x00, 0x10, 0x09, 0x02, 0x00, 0x03,
+	0x09, 0x04, 0x0A, 0x00,
+	// @15472 0xEE (18 pixels wide)
+	0x0E, 0x00, 0x01, 0x01, 0x06, 0x06, 0x01, 0x01, 0x04, 0x0A, 0x01, 0x01, 0x03, 0x0C, 0x01, 0x02,
+	0x02, 0x04, 0x06, 0x04, 0x01, 0x02, 0x01, 0x04, 0x08, 0x04, 0x01, 0x02, 0x01, 0x03, 0x0A, 0x04,
+	0x01, 0x02, 0x00, 0x04, 0x0A, 0x04, 0x01, 0x02, 0x00, 0x03, 0x0B, 0x04, 0x05, 0x02, 0x00, 0x03,
+	0x0C, 0x03, 0x02, 0x02, 0x00, 0x04, 0x0A, 0x04, 0x01, 0x02, 0x01, 0x04, 0x08, 0x04, 0x01, 0x02,
+	0x01, 0x05, 0x06, 0x05, 0x01, 0x02, 0x02, 0x05, 0x04, 0x05, 0x01, 0x01, 0x03, 0x0C, 0x01, 0x01,
+	0x05, 0x08, 0x0A, 0x00,
+	// @15556 0xEF (16 pixels wide)
+	0x0F, 0x00, 0x02, 0x01, 0x00, 0x10, 0x11, 0x02, 0x00, 0x03, 0x09, 0x04, 0x0A, 0x00,
+	// @15570 0xF0 (18 pixels wide)
+	0x0E, 0x00, 0x01, 0x01, 0x08, 0x04, 0x01, 0x02, 0x00, 0x03, 0x02, 0x09, 0x01, 0x02, 0x00, 0x03,
+	0x01, 0x0C, 0x01, 0x02, 0x00, 0x07, 0x04, 0x05, 0x01, 0x02, 0x00, 0x05, 0x08, 0x04, 0x01, 0x02,
+	0x00, 0x04, 0x09, 0x04, 0x02, 0x02, 0x00, 0x04, 0x0A, 0x04, 0x05, 0x02, 0x00, 0x03, 0x0C, 0x03,
+	0x02, 0x02, 0x00, 0x04, 0x0A, 0x04, 0x01, 0x02, 0x00, 0x04, 0x09, 0x04, 0x01, 0x02, 0x00, 0x05,
+	0x07, 0x05, 0x01, 0x03, 0x00, 0x03, 0x01, 0x03, 0x03, 0x06, 0x01, 0x02, 0x00, 0x03, 0x01, 0x0B,
+	0x01, 0x02, 0x00, 0x03, 0x03, 0x07, 0x08, 0x01, 0x00, 0x03, 0x02, 0x00,
+	// @15662 0xF1 (15 pixels wide)
+	0x0E, 0x00, 0x01, 0x01, 0x07, 0x06, 0x01, 0x01, 0x04, 0x0B, 0x01, 0x01, 0x03, 0x0B, 0x01, 0x02,
+	0x02, 0x05, 0x06, 0x01, 0x01, 0x01, 0x01, 0x05, 0x01, 0x01, 0x01, 0x04, 0x02, 0x01, 0x00, 0x04,
+	0x05, 0x01, 0x00, 0x03, 0x02, 0x01, 0x00, 0x04, 0x01, 0x01, 0x01, 0x04, 0x01, 0x01, 0x01, 0x05,
+	0x01, 0x02, 0x02, 0x07, 0x02, 0x03, 0x01, 0x01, 0x03, 0x0C, 0x01, 0x01, 0x05, 0x09, 0x0A, 0x00,
+	// @15726 0xF2 (16 pixels wide)
+	0x0F, 0x00, 0x02, 0x01, 0x00, 0x10, 0x11, 0x01, 0x06, 0x04, 0x0A, 0x00,
+	// @15738 0xF3 (17 pixels wide)
+	0x0F, 0x00, 0x01, 0x02, 0x00, 0x04, 0x0A, 0x03, 0x01, 0x02, 0x00, 0x04, 0x09, 0x04, 0x01, 0x02,
+	0x01, 0x03, 0x09, 0x03, 0x01, 0x02, 0x01, 0x04, 0x08, 0x03, 0x01, 0x02, 0x01, 0x04, 0x07, 0x04,
+	0x01, 0x02, 0x02, 0x03, 0x07, 0x03, 0x01, 0x02, 0x02, 0x04, 0x06, 0x03, 0x01, 0x02, 0x03, 0x03,
+	0x05, 0x04, 0x01, 0x02, 0x03, 0x03, 0x05, 0x03, 0x01, 0x02, 0x03, 0x04, 0x04, 0x03, 0x01, 0x02,
+	0x04, 0x03, 0x03, 0x03, 0x02, 0x02, 0x04, 0x04, 0x02, 0x03, 0x01, 0x02, 0x05, 0x03, 0x01, 0x03,
+	0x01, 0x01, 0x05, 0x07, 0x03, 0x01, 0x06, 0x05, 0x01, 0x01, 0x07, 0x03, 0x01, 0x01, 0x06, 0x04,
+	0x01, 0x01, 0x06, 0x03, 0x01, 0x01, 0x05, 0x04, 0x01, 0x01, 0x04, 0x04, 0x01, 0x01, 0x03, 0x04,
+	0x01, 0x01, 0x01, 0x06, 0x01, 0x01, 0x01, 0x05, 0x01, 0x01, 0x01, 0x03, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x00,
+	// @15868 0xF4 (22 pixels wide)
+	0x06, 0x00, 0x08, 0x01, 0x09, 0x03, 0x01, 0x01, 0x08, 0x06, 0x01, 0x01, 0x05, 0x0C, 0x01, 0x01,
+	0x03, 0x10, 0x01, 0x03, 0x02, 0x05, 0x02, 0x03, 0x03, 0x05, 0x01, 0x03, 0x01, 0x04, 0x04, 0x03,
+	0x04, 0x05, 0x01, 0x03, 0x01, 0x03, 0x05, 0x03, 0x05, 0x04, 0x01, 0x03, 0x00, 0x04, 0x05, 0x03,
+	0x06, 0x04, 0x01, 0x03, 0x00, 0x03, 0x06, 0x03, 0x06, 0x04, 0x04, 0x03, 0x00, 0x03, 0x06, 0x03,
+	0x07, 0x03, 0x01, 0x03, 0x00, 0x03, 0x06, 0x03, 0x06, 0x04, 0x01, 0x03, 0x00, 0x04, 0x05, 0x03,
+	0x06, 0x04, 0x01, 0x03, 0x00, 0x04, 0x05, 0x03, 0x06, 0x03, 0x01, 0x03, 0x01, 0x04, 0x04, 0x03,
+	0x05, 0x04, 0x01, 0x03, 0x01, 0x05, 0x03, 0x03, 0x04, 0x04, 0x01, 0x03, 0x02, 0x05, 0x02, 0x03,
+	0x02, 0x05, 0x01, 0x01, 0x03, 0x0F, 0x01, 0x01, 0x05, 0x0B, 0x08, 0x01, 0x09, 0x03, 0x02, 0x00,
+	// @15996 0xF5 (17 pixels wide)
+	0x0F, 0x00, 0x01, 0x02, 0x00, 0x04, 0x08, 0x04, 0x01, 0x02, 0x01, 0x04, 0x07, 0x04, 0x01, 0x02,
+	0x02, 0x03, 0x06, 0x04, 0x01, 0x02, 0x02, 0x04, 0x05, 0x03, 0x01, 0x02, 0x03, 0x04, 0x03, 0x03,
+	0x01, 0x02, 0x04, 0x03, 0x02, 0x04, 0x01, 0x02, 0x04, 0x04, 0x01, 0x03, 0x01, 0x01, 0x05, 0x06,
+	0x02, 0x01, 0x06, 0x05, 0x01, 0x01, 0x05, 0x06, 0x01, 0x01, 0x05, 0x07, 0x01, 0x02, 0x04, 0x03,
+	0x02, 0x04, 0x01, 0x02, 0x03, 0x04, 0x02, 0x04, 0x01, 0x02, 0x02, 0x04, 0x04, 0x04, 0x01, 0x02,
+	0x02, 0x03, 0x06, 0x04, 0x01, 0x02, 0x01, 0x04, 0x06, 0x04, 0x01, 0x02, 0x00, 0x04, 0x08, 0x04,
+	0x01, 0x02, 0x00, 0x04, 0x09, 0x04, 0x0A, 0x00,
+	// @16100 0xF6 (18 pixels wide)
+	0x0F, 0x00, 0x10, 0x02, 0x00, 0x03, 0x09, 0x04, 0x03, 0x01, 0x00, 0x12, 0x06, 0x01, 0x0F, 0x03,
+	0x04, 0x00,
+	// @16118 0xF7 (15 pixels wide)
+	0x0F, 0x00, 0x08, 0x02, 0x00, 0x03, 0x08, 0x04, 0x01, 0x02, 0x00, 0x04, 0x07, 0x04, 0x01, 0x02,
+	0x00, 0x04, 0x06, 0x05, 0x01, 0x01, 0x01, 0x0E, 0x01, 0x01, 0x02, 0x0D, 0x01, 0x02, 0x03, 0x06,
+	0x02, 0x04, 0x06, 0x01, 0x0B, 0x04, 0x0A, 0x00,
+	// @16158 0xF8 (24 pixels wide)
+	0x0F, 0x00, 0x10, 0x03, 0x00, 0x03, 0x07, 0x04, 0x06, 0x04, 0x03, 0x01, 0x00, 0x18, 0x0A, 0x00,
+	// @16174 0xF9 (26 pixels wide)
+	0x0F, 0x00, 0x10, 0x03, 0x00, 0x03, 0x07, 0x04, 0x06, 0x04, 0x03, 0x01, 0x00, 0x1A, 0x05, 0x01,
+	0x17, 0x03, 0x01, 0x01, 0x17, 0x02, 0x04, 0x00,
+	// @16198 0xFA (21 pixels wide)
+	0x0F, 0x00, 0x02, 0x01, 0x00, 0x09, 0x04, 0x01, 0x05, 0x04, 0x01, 0x01, 0x05, 0x0B, 0x01, 0x01,
+	0x05, 0x0D, 0x01, 0x02, 0x05, 0x05, 0x02, 0x07, 0x01, 0x02, 0x05, 0x04, 0x07, 0x04, 0x01, 0x02,
+	0x05, 0x04, 0x08, 0x03, 0x03, 0x02, 0x05, 0x04, 0x08, 0x04, 0x01, 0x02, 0x05, 0x04, 0x08, 0x03,
+	0x01, 0x02, 0x05, 0x04, 0x07, 0x04, 0x01, 0x02, 0x05, 0x04, 0x04, 0x06, 0x01, 0x01, 0x05, 0x0D,
+	0x01, 0x01, 0x05, 0x0B, 0x0A, 0x00,
+	// @16268 0xFB (21 pixels wide)
+	0x0F, 0x00, 0x06, 0x02, 0x00, 0x03, 0x0E, 0x04, 0x01, 0x02, 0x00, 0x0A, 0x07, 0x04, 0x01, 0x02,
+	0x00, 0x0C, 0x05, 0x04, 0x01, 0x03, 0x00, 0x05, 0x02, 0x06, 0x04, 0x04, 0x01, 0x03, 0x00, 0x03,
+	0x07, 0x04, 0x03, 0x04, 0x05, 0x03, 0x00, 0x03, 0x08, 0x04, 0x02, 0x04, 0x01, 0x03, 0x00, 0x03,
+	0x07, 0x04, 0x03, 0x04, 0x01, 0x03, 0x00, 0x03, 0x05, 0x05, 0x04, 0x04, 0x01, 0x02, 0x00, 0x0C,
+	0x05, 0x04, 0x01, 0x02, 0x00, 0x0A, 0x07, 0x04, 0x0A, 0x00,
+	// @16342 0xFC (15 pixels wide)
+	0x0F, 0x00, 0x06, 0x01, 0x00, 0x03, 0x01, 0x01, 0x00, 0x0B, 0x01, 0x01, 0x00, 0x0D, 0x01, 0x02,
+	0x00, 0x05, 0x02, 0x07, 0x01, 0x02, 0x00, 0x03, 0x07, 0x05, 0x01, 0x02, 0x00, 0x03, 0x08, 0x04,
+	0x03, 0x02, 0x00, 0x03, 0x09, 0x03, 0x01, 0x02, 0x00, 0x03, 0x08, 0x04, 0x01, 0x02, 0x00, 0x03,
+	0x07, 0x05, 0x01, 0x02, 0x00, 0x03, 0x05, 0x06, 0x01, 0x01, 0x00, 0x0D, 0x01, 0x01, 0x00, 0x0A,
+	0x0A, 0x00,
+	// @16408 0xFD (16 pixels wide)
+	0x0E, 0x00, 0x01, 0x01, 0x04, 0x05, 0x01, 0x01, 0x01, 0x0B, 0x01, 0x01, 0x01, 0x0C, 0x01, 0x02,
+	0x01, 0x01, 0x07, 0x05, 0x01, 0x01, 0x0A, 0x05, 0x01, 0x01, 0x0B, 0x04, 0x01, 0x01, 0x0C, 0x03,
+	0x02, 0x01, 0x0C, 0x04, 0x02, 0x01, 0x03, 0x0D, 0x03, 0x01, 0x0C, 0x04, 0x01, 0x01, 0x0C, 0x03,
+	0x01, 0x01, 0x0B, 0x04, 0x01, 0x01, 0x0A, 0x04, 0x01, 0x02, 0x01, 0x03, 0x03, 0x06, 0x01, 0x01,
+	0x00, 0x0C, 0x01, 0x01, 0x01, 0x0A, 0x0A, 0x00,
+	// @16480 0xFE (24 pixels wide)
+	0x0E, 0x00, 0x01, 0x01, 0x0D, 0x05, 0x01, 0x02, 0x00, 0x03, 0x08, 0x09, 0x01, 0x02, 0x00, 0x03,
+	0x06, 0x0C, 0x01, 0x03, 0x00, 0x03, 0x06, 0x04, 0x04, 0x05, 0x01, 0x03, 0x00, 0x03, 0x05, 0x04,
+	0x06, 0x04, 0x01, 0x03, 0x00, 0x03, 0x04, 0x04, 0x08, 0x04, 0x01, 0x03, 0x00, 0x03, 0x04, 0x04,
+	0x09, 0x03, 0x01, 0x03, 0x00, 0x03, 0x04, 0x03, 0x0A, 0x03, 0x01, 0x03, 0x00, 0x03, 0x04, 0x03,
+	0x0A, 0x04, 0x02, 0x02, 0x00, 0x0A, 0x0A, 0x04, 0x02, 0x03, 0x00, 0x03, 0x04, 0x03, 0x0A, 0x04,
+	0x01, 0x03, 0x00, 0x03, 0x04, 0x03, 0x0A, 0x03, 0x02, 0x03, 0x00, 0x03, 0x04, 0x04, 0x08, 0x04,
+	0x01, 0x03, 0x00, 0x03, 0x05, 0x04, 0x06, 0x04, 0x01, 0x03, 0x00, 0x03, 0x06, 0x04, 0x04, 0x04,
+	0x01, 0x02, 0x00, 0x03, 0x07, 0x0A, 0x01, 0x02, 0x00, 0x03, 0x08, 0x08, 0x0A, 0x00,
+	// @16606 0xFF (18 pixels wide)
+	0x0D, 0x00, 0x01, 0x01, 0x05, 0x0D, 0x01, 0x01, 0x03, 0x0F, 0x01, 0x01, 0x02, 0x10, 0x01, 0x02,
+	0x02, 0x04, 0x08, 0x04, 0x04, 0x02, 0x01, 0x04, 0x09, 0x04, 0x01, 0x02, 0x01, 0x05, 0x08, 0x04,
+	0x01, 0x02, 0x02, 0x05, 0x07, 0x04, 0x01, 0x01, 0x02, 0x10, 0x01, 0x01, 0x04, 0x0E, 0x01, 0x01,
+	0x06, 0x0C, 0x01, 0x02, 0x05, 0x04, 0x05, 0x04, 0x01, 0x02, 0x04, 0x04, 0x06, 0x04, 0x01, 0x02,
+	0x03, 0x04, 0x07, 0x04, 0x01, 0x02, 0x02, 0x05, 0x07, 0x04, 0x01, 0x02, 0x02, 0x04, 0x08, 0x04,
+	0x01, 0x02, 0x01, 0x05, 0x08, 0x04, 0x01, 0x02, 0x01, 0x04, 0x09, 0x04, 0x01, 0x02, 0x00, 0x05,
+	0x09, 0x04, 0x0A, 0x00,
+};
+
+const struct FONT_CHAR_INFO RIAD_30ptRLEDescriptors[] = 
+{
+	{2, 0}, 		// 0x20
+	{5, 2}, 		// 0x21
+	{9, 32}, 		// 0x22
+	{17, 54}, 		// 0x23
+	{15, 144}, 		// 0x24
+	{29, 246}, 		// 0x25
+	{23, 446}, 		// 0x26
+	{3, 618}, 		// 0x27
+	{7, 630}, 		// 0x28
+	{8, 678}, 		// 0x29
+	{14, 734}, 		// 0x2A
+	{20, 820}, 		// 0x2B
+	{6, 836}, 		// 0x2C
+	{10, 864}, 		// 0x2D
+	{5, 872}, 		// 0x2E
+	{13, 892}, 		// 0x2F
+	{18, 976}, 		// 0x30
+	{9, 1086}, 		// 0x31
+	{16, 1116}, 		// 0x32
+	{16, 1204}, 		// 0x33
+	{19, 1292}, 		// 0x34
+	{16, 1388}, 		// 0x35
+	{18, 1458}, 		// 0x36
+	{17, 1578}, 		// 0x37
+	{18, 1666}, 		// 0x38
+	{17, 1806}, 		// 0x39
+	{5, 1924}, 		// 0x3A
+	{4, 1958}, 		// 0x3B
+	{18, 1988}, 		// 0x3C
+	{20, 2076}, 		// 0x3D
+	{18, 2090}, 		// 0x3E
+	{12, 2178}, 		// 0x3F
+	{26, 2246}, 		// 0x40
+	{22, 2442}, 		// 0x41
+	{17, 2560}, 		// 0x42
+	{21, 2662}, 		// 0x43
+	{22, 2742}, 		// 0x44
+	{15, 2842}, 		// 0x45
+	{15, 2866}, 		// 0x46
+	{23, 2886}, 		// 0x47
+	{20, 2992}, 		// 0x48
+	{4, 3012}, 		// 0x49
+	{12, 3020}, 		// 0x4A
+	{19, 3052}, 		// 0x4B
+	{15, 3184}, 		// 0x4C
+	{28, 3196}, 		// 0x4D
+	{20, 3390}, 		// 0x4E
+	{25, 3530}, 		// 0x4F
+	{17, 3664}, 		// 0x50
+	{25, 3740}, 		// 0x51
+	{17, 3890}, 		// 0x52
+	{16, 4004}, 		// 0x53
+	{20, 4092}, 		// 0x54
+	{20, 4104}, 		// 0x55
+	{22, 4146}, 		// 0x56
+	{32, 4286}, 		// 0x57
+	{21, 4522}, 		// 0x58
+	{20, 4664}, 		// 0x59
+	{20, 4744}, 		// 0x5A
+	{8, 4832}, 		// 0x5B
+	{14, 4848}, 		// 0x5C
+	{7, 4928}, 		// 0x5D
+	{18, 4944}, 		// 0x5E
+	{20, 5038}, 		// 0x5F
+	{7, 5046}, 		// 0x60
+	{16, 5070}, 		// 0x61
+	{18, 5160}, 		// 0x62
+	{15, 5250}, 		// 0x63
+	{18, 5314}, 		// 0x64
+	{17, 5406}, 		// 0x65
+	{12, 5480}, 		// 0x66
+	{18, 5520}, 		// 0x67
+	{16, 5642}, 		// 0x68
+	{4, 5700}, 		// 0x69
+	{9, 5722}, 		// 0x6A
+	{16, 5760}, 		// 0x6B
+	{3, 5874}, 		// 0x6C
+	{28, 5882}, 		// 0x6D
+	{16, 5950}, 		// 0x6E
+	{18, 6000}, 		// 0x6F
+	{18, 6084}, 		// 0x70
+	{18, 6176}, 		// 0x71
+	{9, 6264}, 		// 0x72
+	{12, 6296}, 		// 0x73
+	{11, 6370}, 		// 0x74
+	{16, 6406}, 		// 0x75
+	{18, 6448}, 		// 0x76
+	{28, 6548}, 		// 0x77
+	{17, 6710}, 		// 0x78
+	{17, 6814}, 		// 0x79
+	{15, 6944}, 		// 0x7A
+	{9, 7004}, 		// 0x7B
+	{3, 7060}, 		// 0x7C
+	{9, 7066}, 		// 0x7D
+	{20, 7138}, 		// 0x7E
+	{2, 7180}, 		// 0x7F
+	{2, 7182}, 		// 0x80
+	{2, 7184}, 		// 0x81
+	{6, 7186}, 		// 0x82
+	{20, 7228}, 		// 0x83
+	{14, 7326}, 		// 0x84
+	{2, 7394}, 		// 0x85
+	{16, 7396}, 		// 0x86
+	{16, 7464}, 		// 0x87
+	{14, 7568}, 		// 0x88
+	{34, 7590}, 		// 0x89
+	{19, 7920}, 		// 0x8A
+	{9, 8094}, 		// 0x8B
+	{40, 8166}, 		// 0x8C
+	{2, 8358}, 		// 0x8D
+	{2, 8360}, 		// 0x8E
+	{2, 8362}, 		// 0x8F
+	{2, 8364}, 		// 0x90
+	{6, 8366}, 		// 0x91
+	{6, 8398}, 		// 0x92
+	{16, 8442}, 		// 0x93
+	{16, 8494}, 		// 0x94
+	{2, 8558}, 		// 0x95
+	{14, 8560}, 		// 0x96
+	{39, 8568}, 		// 0x97
+	{13, 8576}, 		// 0x98
+	{39, 8604}, 		// 0x99
+	{14, 8776}, 		// 0x9A
+	{9, 8902}, 		// 0x9B
+	{24, 8978}, 		// 0x9C
+	{2, 9118}, 		// 0x9D
+	{2, 9120}, 		// 0x9E
+	{28, 9122}, 		// 0x9F
+	{2, 9248}, 		// 0xA0
+	{5, 9250}, 		// 0xA1
+	{14, 9280}, 		// 0xA2
+	{17, 9356}, 		// 0xA3
+	{18, 9414}, 		// 0xA4
+	{19, 9520}, 		// 0xA5
+	{3, 9610}, 		// 0xA6
+	{16, 9624}, 		// 0xA7
+	{12, 9740}, 		// 0xA8
+	{25, 9762}, 		// 0xA9
+	{11, 9918}, 		// 0xAA
+	{14, 9982}, 		// 0xAB
+	{20, 10070}, 		// 0xAC
+	{2, 10082}, 		// 0xAD
+	{13, 10084}, 		// 0xAE
+	{9, 10182}, 		// 0xAF
+	{11, 10190}, 		// 0xB0
+	{20, 10242}, 		// 0xB1
+	{11, 10264}, 		// 0xB2
+	{10, 10320}, 		// 0xB3
+	{7, 10378}, 		// 0xB4
+	{18, 10406}, 		// 0xB5
+	{16, 10462}, 		// 0xB6
+	{5, 10528}, 		// 0xB7
+	{7, 10552}, 		// 0xB8
+	{6, 10584}, 		// 0xB9
+	{12, 10606}, 		// 0xBA
+	{13, 10678}, 		// 0xBB
+	{27, 10760}, 		// 0xBC
+	{27, 10934}, 		// 0xBD
+	{28, 11102}, 		// 0xBE
+	{13, 11280}, 		// 0xBF
+	{22, 11360}, 		// 0xC0
+	{17, 11478}, 		// 0xC1
+	{17, 11558}, 		// 0xC2
+	{14, 11660}, 		// 0xC3
+	{24, 11672}, 		// 0xC4
+	{15, 11748}, 		// 0xC5
+	{30, 11772}, 		// 0xC6
+	{17, 11956}, 		// 0xC7
+	{20, 12044}, 		// 0xC8
+	{20, 12214}, 		// 0xC9
+	{18, 12412}, 		// 0xCA
+	{21, 12542}, 		// 0xCB
+	{28, 12598}, 		// 0xCC
+	{20, 12792}, 		// 0xCD
+	{25, 12812}, 		// 0xCE
+	{20, 12946}, 		// 0xCF
+	{17, 12960}, 		// 0xD0
+	{21, 13036}, 		// 0xD1
+	{20, 13116}, 		// 0xD2
+	{21, 13128}, 		// 0xD3
+	{27, 13268}, 		// 0xD4
+	{21, 13400}, 		// 0xD5
+	{22, 13542}, 		// 0xD6
+	{18, 13560}, 		// 0xD7
+	{28, 13600}, 		// 0xD8
+	{30, 13616}, 		// 0xD9
+	{24, 13636}, 		// 0xDA
+	{24, 13722}, 		// 0xDB
+	{17, 13810}, 		// 0xDC
+	{20, 13886}, 		// 0xDD
+	{30, 13964}, 		// 0xDE
+	{18, 14142}, 		// 0xDF
+	{16, 14256}, 		// 0xE0
+	{18, 14346}, 		// 0xE1
+	{15, 14466}, 		// 0xE2
+	{12, 14558}, 		// 0xE3
+	{20, 14570}, 		// 0xE4
+	{17, 14624}, 		// 0xE5
+	{26, 14698}, 		// 0xE6
+	{15, 14846}, 		// 0xE7
+	{16, 14918}, 		// 0xE8
+	{16, 15022}, 		// 0xE9
+	{16, 15154}, 		// 0xEA
+	{17, 15262}, 		// 0xEB
+	{22, 15306}, 		// 0xEC
+	{16, 15452}, 		// 0xED
+	{18, 15472}, 		// 0xEE
+	{16, 15556}, 		// 0xEF
+	{18, 15570}, 		// 0xF0
+	{15, 15662}, 		// 0xF1
+	{16, 15726}, 		// 0xF2
+	{17, 15738}, 		// 0xF3
+	{22, 15868}, 		// 0xF4
+	{17, 15996}, 		// 0xF5
+	{18, 16100}, 		// 0xF6
+	{15, 16118}, 		// 0xF7
+	{24, 16158}, 		// 0xF8
+	{26, 16174}, 		// 0xF9
+	{21, 16198}, 		// 0xFA
+	{21, 16268}, 		// 0xFB
+	{15, 16342}, 		// 0xFC
+	{16, 16408}, 		// 0xFD
+	{24, 16480}, 		// 0xFE
+	{18, 16606}, 		// 0xFF
+};
+
+sFONT RIAD_30pt = {
+  0,
+  RIAD_30ptRLEDescriptors,
+  44, /* Height */
+  RIAD_30ptRLE,
+};
+#endif
@@ -0,0 +1,145 @@
+// 
+//  RIAD_30pt, 14 signs of RIAD_30pt.c run coded, made by Tools/font_subset.py, don't edit
+// 
+#include "variables.h"
+#include "fonts.h"
+
+#if RIAD_30pt_FROM == FONT_SUBSET
+static const uint8_t Signs[] = 
+{
+	// @0 0x20 (2 pixels wide)
+	0x2C, 0x00,
+	// @2 0x2D (10 pixels wide)
+	0x16, 0x00, 0x02, 0x01, 0x00, 0x0A, 0x14, 0x00,
+	// @10 0x2E (5 pixels wide)
+	0x1D, 0x00, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x00, 0x04, 0x02, 0x01, 0x00, 0x05, 0x01, 0x01,
+	0x01, 0x03, 0x0A, 0x00,
+	// @30 0x30 (18 pixels wide)
+	0x08, 0x00, 0x01, 0x01, 0x06, 0x07, 0x01, 0x01, 0x04, 0x0B, 0x01, 0x02, 0x03, 0x05, 0x03, 0x04,
+	0x01, 0x02, 0x03, 0x04, 0x05, 0x04, 0x01, 0x02, 0x02, 0x04, 0x07, 0x04, 0x01, 0x02, 0x02, 0x03,
+	0x08, 0x04, 0x01, 0x02, 0x01, 0x04, 0x09, 0x03, 0x01, 0x02, 0x01, 0x04, 0x09, 0x04, 0x03, 0x02,
+	0x01, 0x03, 0x0A, 0x04, 0x04, 0x02, 0x00, 0x04, 0x0B, 0x03, 0x03, 0x02, 0x01, 0x03, 0x0A, 0x04,
+	0x01, 0x02, 0x01, 0x04, 0x09, 0x04, 0x01, 0x02, 0x01, 0x04, 0x09, 0x03, 0x01, 0x02, 0x02, 0x03,
+	0x08, 0x04, 0x01, 0x02, 0x02, 0x04, 0x07, 0x04, 0x01, 0x02, 0x03, 0x03, 0x06, 0x04, 0x01, 0x02,
+	0x03, 0x05, 0x03, 0x04, 0x01, 0x01, 0x04, 0x0A, 0x01, 0x01, 0x05, 0x08, 0x0A, 0x00,
+	// @140 0x31 (9 pixels wide)
+	0x08, 0x00, 0x01, 0x01, 0x05, 0x04, 0x01, 0x01, 0x03, 0x06, 0x01, 0x01, 0x01, 0x08, 0x01, 0x01,
+	0x00, 0x09, 0x01, 0x02, 0x01, 0x02, 0x02, 0x04, 0x15, 0x01, 0x05, 0x04, 0x0A, 0x00,
+	// @170 0x32 (16 pixels wide)
+	0x08, 0x00, 0x01, 0x01, 0x03, 0x09, 0x01, 0x01, 0x01, 0x0C, 0x01, 0x02, 0x01, 0x06, 0x01, 0x06,
+	0x01, 0x02, 0x01, 0x02, 0x08, 0x04, 0x01, 0x01, 0x0C, 0x03, 0x04, 0x01, 0x0C, 0x04, 0x02, 0x01,
+	0x0C, 0x03, 0x01, 0x01, 0x0B, 0x04, 0x01, 0x01, 0x0B, 0x03, 0x01, 0x01, 0x0A, 0x04, 0x01, 0x01,
+	0x09, 0x04, 0x01, 0x01, 0x08, 0x04, 0x01, 0x01, 0x07, 0x04, 0x01, 0x01, 0x06, 0x04, 0x01, 0x01,
+	0x05, 0x04, 0x01, 0x01, 0x04, 0x04, 0x01, 0x01, 0x03, 0x04, 0x01, 0x01, 0x02, 0x04, 0x01, 0x01,
+	0x01, 0x04, 0x03, 0x01, 0x00, 0x10, 0x0A, 0x00,
+	// @258 0x33 (16 pixels wide)
+	0x08, 0x00, 0x01, 0x01, 0x03, 0x09, 0x01, 0x01, 0x01, 0x0C, 0x01, 0x02, 0x01, 0x05, 0x02, 0x06,
+	0x01, 0x02, 0x01, 0x02, 0x07, 0x05, 0x04, 0x01, 0x0B, 0x04, 0x01, 0x01, 0x0B, 0x03, 0x01, 0x01,
+	0x0A, 0x04, 0x01, 0x01, 0x07, 0x06, 0x01, 0x01, 0x04, 0x07, 0x01, 0x01, 0x04, 0x08, 0x01, 0x01,
+	0x07, 0x06, 0x01, 0x01, 0x0A, 0x04, 0x01, 0x01, 0x0B, 0x04, 0x05, 0x01, 0x0C, 0x04, 0x01, 0x01,
+	0x0B, 0x04, 0x01, 0x02, 0x00, 0x02, 0x08, 0x05, 0x01, 0x02, 0x00, 0x05, 0x03, 0x06, 0x01, 0x01,
+	0x00, 0x0D, 0x01, 0x01, 0x01, 0x0A, 0x0A, 0x00,
+	// @346 0x34 (19 pixels wide)
+	0x08, 0x00, 0x01, 0x01, 0x0B, 0x04, 0x01, 0x01, 0x0A, 0x05, 0x02, 0x01, 0x09, 0x06, 0x01, 0x02,
+	0x08, 0x03, 0x01, 0x03, 0x01, 0x02, 0x07, 0x04, 0x01, 0x03, 0x01, 0x02, 0x07, 0x03, 0x02, 0x03,
+	0x01, 0x02, 0x06, 0x03, 0x03, 0x03, 0x01, 0x02, 0x05, 0x04, 0x03, 0x03, 0x01, 0x02, 0x05, 0x03,
+	0x04, 0x03, 0x01, 0x02, 0x04, 0x03, 0x05, 0x03, 0x01, 0x02, 0x03, 0x03, 0x06, 0x03, 0x01, 0x02,
+	0x02, 0x04, 0x06, 0x03, 0x01, 0x02, 0x02, 0x03, 0x07, 0x03, 0x01, 0x02, 0x01, 0x03, 0x08, 0x03,
+	0x01, 0x02, 0x00, 0x04, 0x08, 0x03, 0x03, 0x01, 0x00, 0x13, 0x07, 0x01, 0x0C, 0x03, 0x0A, 0x00,
+	// @442 0x35 (16 pixels wide)
+	0x08, 0x00, 0x03, 0x01, 0x03, 0x0C, 0x06, 0x01, 0x02, 0x03, 0x01, 0x02, 0x02, 0x02, 0x02, 0x01,
+	0x01, 0x01, 0x01, 0x0A, 0x01, 0x01, 0x01, 0x0C, 0x01, 0x01, 0x08, 0x06, 0x01, 0x01, 0x0A, 0x05,
+	0x01, 0x01, 0x0B, 0x04, 0x05, 0x01, 0x0C, 0x04, 0x01, 0x01, 0x0C, 0x03, 0x01, 0x01, 0x0B, 0x04,
+	0x01, 0x02, 0x00, 0x01, 0x09, 0x04, 0x01, 0x02, 0x00, 0x05, 0x02, 0x07, 0x01, 0x01, 0x00, 0x0C,
+	0x01, 0x01, 0x01, 0x0A, 0x0A, 0x00,
+	// @512 0x36 (18 pixels wide)
+	0x08, 0x00, 0x01, 0x01, 0x0A, 0x06, 0x01, 0x01, 0x08, 0x08, 0x01, 0x01, 0x06, 0x08, 0x01, 0x01,
+	0x05, 0x05, 0x01, 0x01, 0x04, 0x04, 0x01, 0x01, 0x03, 0x04, 0x01, 0x01, 0x03, 0x03, 0x02, 0x01,
+	0x02, 0x03, 0x01, 0x02, 0x01, 0x04, 0x02, 0x07, 0x01, 0x02, 0x01, 0x03, 0x01, 0x0A, 0x01, 0x01,
+	0x01, 0x0F, 0x01, 0x02, 0x01, 0x05, 0x07, 0x04, 0x01, 0x02, 0x00, 0x05, 0x09, 0x04, 0x02, 0x02,
+	0x00, 0x04, 0x0A, 0x04, 0x02, 0x02, 0x00, 0x04, 0x0B, 0x03, 0x01, 0x02, 0x01, 0x03, 0x0B, 0x03,
+	0x01, 0x02, 0x01, 0x03, 0x0A, 0x04, 0x01, 0x02, 0x01, 0x04, 0x09, 0x04, 0x01, 0x02, 0x02, 0x03,
+	0x09, 0x03, 0x01, 0x02, 0x02, 0x04, 0x07, 0x04, 0x01, 0x02, 0x03, 0x05, 0x03, 0x05, 0x01, 0x01,
+	0x04, 0x0B, 0x01, 0x01, 0x05, 0x09, 0x0A, 0x00,
+	// @632 0x37 (17 pixels wide)
+	0x08, 0x00, 0x03, 0x01, 0x00, 0x11, 0x01, 0x01, 0x0D, 0x03, 0x01, 0x01, 0x0C, 0x04, 0x01, 0x01,
+	0x0C, 0x03, 0x01, 0x01, 0x0B, 0x04, 0x01, 0x01, 0x0B, 0x03, 0x01, 0x01, 0x0A, 0x04, 0x01, 0x01,
+	0x0A, 0x03, 0x01, 0x01, 0x09, 0x04, 0x01, 0x01, 0x09, 0x03, 0x01, 0x01, 0x08, 0x04, 0x01, 0x01,
+	0x08, 0x03, 0x01, 0x01, 0x07, 0x04, 0x01, 0x01, 0x07, 0x03, 0x01, 0x01, 0x06, 0x04, 0x01, 0x01,
+	0x06, 0x03, 0x01, 0x01, 0x05, 0x04, 0x01, 0x01, 0x05, 0x03, 0x02, 0x01, 0x04, 0x04, 0x02, 0x01,
+	0x03, 0x04, 0x02, 0x01, 0x02, 0x04, 0x0A, 0x00,
+	// @720 0x38 (18 pixels wide)
+	0x08, 0x00, 0x01, 0x01, 0x05, 0x09, 0x01, 0x01, 0x04, 0x0B, 0x01, 0x02, 0x03, 0x04, 0x04, 0x05,
+	0x01, 0x02, 0x02, 0x04, 0x07, 0x04, 0x01, 0x02, 0x02, 0x03, 0x08, 0x04, 0x01, 0x02, 0x02, 0x03,
+	0x09, 0x03, 0x01, 0x02, 0x01, 0x04, 0x09, 0x03, 0x01, 0x02, 0x02, 0x03, 0x09, 0x03, 0x01, 0x02,
+	0x02, 0x03, 0x08, 0x04, 0x01, 0x02, 0x02, 0x04, 0x06, 0x04, 0x01, 0x02, 0x03, 0x05, 0x03, 0x04,
+	0x01, 0x01, 0x04, 0x0A, 0x01, 0x01, 0x05, 0x09, 0x01, 0x01, 0x04, 0x0B, 0x01, 0x02, 0x02, 0x05,
+	0x04, 0x05, 0x01, 0x02, 0x02, 0x03, 0x08, 0x04, 0x01, 0x02, 0x01, 0x04, 0x09, 0x04, 0x02, 0x02,
+	0x01, 0x03, 0x0A, 0x04, 0x01, 0x02, 0x00, 0x04, 0x0A, 0x04, 0x01, 0x02, 0x01, 0x03, 0x0A, 0x04,
+	0x01, 0x02, 0x01, 0x04, 0x09, 0x04, 0x01, 0x02, 0x01, 0x05, 0x07, 0x04, 0x01, 0x02, 0x02, 0x05,
+	0x05, 0x04, 0x01, 0x01, 0x03, 0x0C, 0x01, 0x01, 0x05, 0x09, 0x0A, 0x00,
+	// @860 0x39 (17 pixels wide)
+	0x08, 0x00, 0x01, 0x01, 0x04, 0x08, 0x01, 0x01, 0x03, 0x0B, 0x01, 0x02, 0x02, 0x05, 0x03, 0x05,
+	0x01, 0x02, 0x01, 0x04, 0x07, 0x03, 0x01, 0x02, 0x01, 0x03, 0x08, 0x04, 0x01, 0x02, 0x00, 0x04,
+	0x09, 0x03, 0x02, 0x02, 0x00, 0x03, 0x0A, 0x04, 0x03, 0x02, 0x00, 0x03, 0x0B, 0x03, 0x01, 0x02,
+	0x00, 0x04, 0x09, 0x04, 0x01, 0x02, 0x00, 0x04, 0x08, 0x05, 0x01, 0x02, 0x01, 0x05, 0x05, 0x06,
+	0x01, 0x01, 0x02, 0x0F, 0x01, 0x02, 0x03, 0x09, 0x01, 0x04, 0x01, 0x02, 0x05, 0x05, 0x03, 0x03,
+	0x01, 0x01, 0x0D, 0x03, 0x01, 0x01, 0x0C, 0x04, 0x01, 0x01, 0x0B, 0x04, 0x01, 0x01, 0x0B, 0x03,
+	0x01, 0x01, 0x09, 0x05, 0x01, 0x01, 0x08, 0x05, 0x01, 0x01, 0x03, 0x09, 0x01, 0x01, 0x02, 0x08,
+	0x01, 0x01, 0x02, 0x06, 0x0A, 0x00,
+	// @978 0x3F (12 pixels wide)
+	0x07, 0x00, 0x01, 0x01, 0x01, 0x09, 0x01, 0x01, 0x00, 0x0B, 0x01, 0x02, 0x01, 0x03, 0x02, 0x06,
+	0x01, 0x01, 0x08, 0x04, 0x04, 0x01, 0x09, 0x03, 0x01, 0x01, 0x08, 0x04, 0x01, 0x01, 0x07, 0x04,
+	0x01, 0x01, 0x07, 0x03, 0x01, 0x01, 0x06, 0x04, 0x01, 0x01, 0x05, 0x04, 0x01, 0x01, 0x05, 0x03,
+	0x01, 0x01, 0x04, 0x04, 0x04, 0x01, 0x04, 0x03, 0x03, 0x00, 0x01, 0x01, 0x05, 0x01, 0x04, 0x01,
+	0x03, 0x04, 0x0A, 0x00,
+};
+
+static const struct FONT_CHAR_INFO Descriptors[] = 
+{
+	{2, 0}, 		// 0x20
+	{10, 2}, 		// 0x2D
+	{5, 10}, 		// 0x2E
+	{18, 30}, 		// 0x30
+	{9, 140}, 		// 0x31
+	{16, 170}, 		// 0x32
+	{16, 258}, 		// 0x33
+	{19, 346}, 		// 0x34
+	{16, 442}, 		// 0x35
+	{18, 512}, 		// 0x36
+	{17, 632}, 		// 0x37
+	{18, 720}, 		// 0x38
+	{17, 860}, 		// 0x39
+	{12, 978}, 		// 0x3F
+};
+
+// the sign of every code, 0x3F for the codes which are not here
+static const uint8_t Map[256] = 
+{
+	 13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,
+	 13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,
+	  0,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,   1,   2,  13,
+	  3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  13,  13,  13,  13,  13,
+	 13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,
+	 13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,
+	 13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,
+	 13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,
+	 13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,
+	 13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,
+	 13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,
+	 13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,
+	 13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,
+	 13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,
+	 13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,
+	 13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,
+};
+
+sFONT RIAD_30pt = {
+  0,
+  Descriptors,
+  44, /* Height */
+  Signs,
+  1, /* Bpp */
+  Map,
+};
+#endif
@@ -2,6 +2,8 @@
 // 
 #include "variables.h"
 #include "fonts.h"
+
+#if RIAD_40pt_FROM == FONT_FULL
 // Character bitmaps for GOST type B 16pt
 const uint8_t RIAD_40ptBitmaps[] = 
 {
@@ -13459,4 +13461,5 @@ sFONT RIAD_40pt = {
   RIAD_40ptDescriptors,
 //  0, //variable width
   44, /* Height */
-};
\ No newline at end of file
+};
+#endif
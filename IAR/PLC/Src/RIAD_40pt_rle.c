@@ -0,0 +1,1840 @@
+// 
+//  RIAD_40pt, run coded by Tools/font_rle.py from RIAD_40pt.c, don't edit
+// 
+#include "variables.h"
+#include "fonts.h"
+
+#if RIAD_40pt_FROM == FONT_RLE
+const uint8_t RIAD_40ptRLE[] = 
+{
+	// @0 0x20 (2 pixels wide)
+	0x2C, 0x00,
+	// @2 0x21 (6 pixels wide)
+	0x08, 0x00, 0x05, 0x01, 0x01, 0x05, 0x15, 0x01, 0x01, 0x04, 0x04, 0x00, 0x01, 0x01, 0x01, 0x04,
+	0x04, 0x01, 0x00, 0x06, 0x01, 0x01, 0x01, 0x05,
+	// @26 0x22 (12 pixels wide)
+	0x07, 0x00, 0x0A, 0x02, 0x00, 0x04, 0x04, 0x04, 0x02, 0x02, 0x00, 0x04, 0x04, 0x03, 0x01, 0x02,
+	0x01, 0x02, 0x05, 0x03, 0x18, 0x00,
+	// @48 0x23 (22 pixels wide)
+	0x0A, 0x00, 0x01, 0x02, 0x08, 0x03, 0x05, 0x03, 0x01, 0x02, 0x07, 0x04, 0x05, 0x03, 0x04, 0x02,
+	0x07, 0x03, 0x06, 0x03, 0x02, 0x02, 0x07, 0x03, 0x05, 0x03, 0x01, 0x02, 0x06, 0x04, 0x05, 0x03,
+	0x01, 0x02, 0x06, 0x03, 0x06, 0x03, 0x03, 0x01, 0x01, 0x15, 0x01, 0x02, 0x06, 0x03, 0x05, 0x04,
+	0x01, 0x02, 0x06, 0x03, 0x05, 0x03, 0x01, 0x02, 0x05, 0x04, 0x05, 0x03, 0x04, 0x02, 0x05, 0x03,
+	0x06, 0x03, 0x04, 0x01, 0x00, 0x15, 0x03, 0x02, 0x04, 0x03, 0x06, 0x03, 0x02, 0x02, 0x04, 0x03,
+	0x05, 0x04, 0x01, 0x02, 0x04, 0x03, 0x05, 0x03, 0x01, 0x02, 0x03, 0x04, 0x05, 0x03, 0x03, 0x02,
+	0x03, 0x03, 0x06, 0x03,
+	// @148 0x24 (19 pixels wide)
+	0x05, 0x00, 0x05, 0x01, 0x08, 0x03, 0x01, 0x01, 0x07, 0x07, 0x01, 0x01, 0x04, 0x0D, 0x01, 0x01,
+	0x03, 0x0F, 0x01, 0x01, 0x02, 0x10, 0x01, 0x02, 0x01, 0x06, 0x08, 0x02, 0x01, 0x01, 0x01, 0x04,
+	0x02, 0x01, 0x00, 0x05, 0x01, 0x01, 0x00, 0x04, 0x02, 0x01, 0x00, 0x05, 0x01, 0x01, 0x00, 0x06,
+	0x01, 0x01, 0x01, 0x06, 0x01, 0x01, 0x01, 0x08, 0x01, 0x01, 0x02, 0x09, 0x01, 0x01, 0x04, 0x0A,
+	0x01, 0x01, 0x05, 0x0A, 0x01, 0x01, 0x07, 0x09, 0x01, 0x01, 0x0A, 0x07, 0x01, 0x01, 0x0B, 0x07,
+	0x01, 0x01, 0x0D, 0x06, 0x02, 0x01, 0x0E, 0x05, 0x03, 0x01, 0x0F, 0x04, 0x02, 0x01, 0x0E, 0x05,
+	0x01, 0x02, 0x00, 0x03, 0x09, 0x06, 0x01, 0x02, 0x00, 0x07, 0x03, 0x07, 0x01, 0x01, 0x00, 0x10,
+	0x01, 0x01, 0x00, 0x0F, 0x01, 0x01, 0x03, 0x0A, 0x01, 0x01, 0x08, 0x03,
+	// @272 0x25 (38 pixels wide)
+	0x09, 0x00, 0x01, 0x02, 0x05, 0x06, 0x10, 0x03, 0x01, 0x02, 0x03, 0x0A, 0x0E, 0x03, 0x01, 0x02,
+	0x02, 0x0C, 0x0C, 0x03, 0x01, 0x03, 0x01, 0x05, 0x04, 0x04, 0x0C, 0x02, 0x01, 0x03, 0x01, 0x04,
+	0x06, 0x04, 0x0A, 0x03, 0x01, 0x03, 0x00, 0x04, 0x07, 0x04, 0x09, 0x03, 0x01, 0x03, 0x00, 0x04,
+	0x08, 0x03, 0x09, 0x03, 0x01, 0x03, 0x00, 0x04, 0x08, 0x04, 0x07, 0x03, 0x01, 0x03, 0x00, 0x03,
+	0x09, 0x04, 0x07, 0x03, 0x02, 0x03, 0x00, 0x03, 0x09, 0x04, 0x06, 0x03, 0x01, 0x03, 0x00, 0x03,
+	0x09, 0x04, 0x05, 0x03, 0x02, 0x03, 0x00, 0x03, 0x09, 0x04, 0x04, 0x03, 0x01, 0x04, 0x00, 0x04,
+	0x08, 0x03, 0x04, 0x03, 0x06, 0x05, 0x01, 0x04, 0x00, 0x04, 0x07, 0x04, 0x04, 0x03, 0x04, 0x09,
+	0x01, 0x04, 0x01, 0x04, 0x06, 0x04, 0x03, 0x03, 0x04, 0x0B, 0x01, 0x05, 0x01, 0x05, 0x04, 0x04,
+	0x04, 0x03, 0x03, 0x04, 0x04, 0x05, 0x01, 0x04, 0x02, 0x0B, 0x04, 0x03, 0x03, 0x04, 0x06, 0x04,
+	0x01, 0x04, 0x03, 0x09, 0x04, 0x03, 0x04, 0x04, 0x07, 0x04, 0x01, 0x04, 0x05, 0x06, 0x05, 0x03,
+	0x04, 0x03, 0x08, 0x04, 0x01, 0x03, 0x0F, 0x03, 0x04, 0x04, 0x08, 0x04, 0x01, 0x03, 0x0F, 0x03,
+	0x04, 0x04, 0x09, 0x03, 0x02, 0x03, 0x0E, 0x03, 0x05, 0x04, 0x09, 0x03, 0x01, 0x03, 0x0D, 0x03,
+	0x06, 0x04, 0x09, 0x03, 0x01, 0x03, 0x0C, 0x03, 0x07, 0x04, 0x09, 0x03, 0x01, 0x03, 0x0C, 0x03,
+	0x07, 0x04, 0x08, 0x04, 0x01, 0x03, 0x0B, 0x03, 0x08, 0x04, 0x08, 0x04, 0x01, 0x03, 0x0B, 0x03,
+	0x09, 0x03, 0x08, 0x04, 0x01, 0x03, 0x0A, 0x03, 0x0A, 0x04, 0x07, 0x03, 0x01, 0x03, 0x0A, 0x03,
+	0x0B, 0x04, 0x05, 0x04, 0x01, 0x03, 0x09, 0x03, 0x0C, 0x06, 0x01, 0x05, 0x01, 0x02, 0x08, 0x03,
+	0x0E, 0x0A, 0x01, 0x02, 0x08, 0x03, 0x10, 0x07,
+	// @536 0x26 (29 pixels wide)
+	0x08, 0x00, 0x01, 0x01, 0x09, 0x08, 0x01, 0x01, 0x07, 0x0B, 0x01, 0x01, 0x06, 0x0D, 0x01, 0x02,
+	0x05, 0x05, 0x05, 0x05, 0x01, 0x02, 0x05, 0x04, 0x07, 0x04, 0x01, 0x02, 0x04, 0x04, 0x08, 0x04,
+	0x01, 0x02, 0x04, 0x04, 0x08, 0x05, 0x01, 0x02, 0x04, 0x04, 0x09, 0x04, 0x01, 0x02, 0x04, 0x04,
+	0x08, 0x05, 0x02, 0x02, 0x04, 0x04, 0x08, 0x04, 0x01, 0x02, 0x04, 0x05, 0x06, 0x04, 0x01, 0x02,
+	0x05, 0x04, 0x05, 0x05, 0x01, 0x02, 0x05, 0x05, 0x02, 0x06, 0x01, 0x01, 0x06, 0x0B, 0x01, 0x01,
+	0x06, 0x09, 0x01, 0x02, 0x06, 0x07, 0x0C, 0x04, 0x01, 0x02, 0x04, 0x09, 0x0C, 0x04, 0x01, 0x02,
+	0x03, 0x0B, 0x0B, 0x04, 0x01, 0x03, 0x02, 0x05, 0x03, 0x05, 0x09, 0x05, 0x01, 0x03, 0x01, 0x05,
+	0x04, 0x06, 0x08, 0x04, 0x01, 0x03, 0x01, 0x05, 0x05, 0x06, 0x07, 0x04, 0x01, 0x03, 0x00, 0x05,
+	0x07, 0x06, 0x06, 0x04, 0x01, 0x03, 0x00, 0x05, 0x08, 0x05, 0x05, 0x04, 0x01, 0x03, 0x00, 0x04,
+	0x0A, 0x05, 0x04, 0x04, 0x01, 0x03, 0x00, 0x04, 0x0B, 0x05, 0x02, 0x05, 0x01, 0x03, 0x00, 0x04,
+	0x0C, 0x05, 0x01, 0x04, 0x01, 0x02, 0x00, 0x04, 0x0D, 0x09, 0x01, 0x02, 0x00, 0x05, 0x0D, 0x07,
+	0x01, 0x02, 0x00, 0x05, 0x0D, 0x06, 0x01, 0x02, 0x00, 0x06, 0x0C, 0x07, 0x01, 0x02, 0x01, 0x06,
+	0x0A, 0x09, 0x01, 0x02, 0x02, 0x06, 0x07, 0x0C, 0x01, 0x02, 0x02, 0x12, 0x02, 0x06, 0x01, 0x02,
+	0x04, 0x0E, 0x05, 0x06, 0x01, 0x02, 0x05, 0x0B, 0x08, 0x05,
+	// @754 0x27 (4 pixels wide)
+	0x07, 0x00, 0x0C, 0x01, 0x00, 0x04, 0x01, 0x01, 0x01, 0x02, 0x18, 0x00,
+	// @766 0x28 (11 pixels wide)
+	0x07, 0x00, 0x01, 0x01, 0x07, 0x04, 0x01, 0x01, 0x06, 0x04, 0x01, 0x01, 0x06, 0x03, 0x01, 0x01,
+	0x05, 0x04, 0x01, 0x01, 0x05, 0x03, 0x01, 0x01, 0x04, 0x04, 0x01, 0x01, 0x04, 0x03, 0x02, 0x01,
+	0x03, 0x04, 0x03, 0x01, 0x02, 0x04, 0x01, 0x01, 0x02, 0x03, 0x05, 0x01, 0x01, 0x04, 0x01, 0x01,
+	0x01, 0x03, 0x06, 0x01, 0x00, 0x04, 0x01, 0x01, 0x01, 0x03, 0x05, 0x01, 0x01, 0x04, 0x01, 0x01,
+	0x02, 0x03, 0x03, 0x01, 0x02, 0x04, 0x02, 0x01, 0x03, 0x04,
+	// @840 0x29 (11 pixels wide)
+	0x07, 0x00, 0x01, 0x01, 0x00, 0x04, 0x01, 0x01, 0x01, 0x04, 0x01, 0x01, 0x02, 0x03, 0x01, 0x01,
+	0x02, 0x04, 0x01, 0x01, 0x03, 0x03, 0x01, 0x01, 0x03, 0x04, 0x01, 0x01, 0x04, 0x03, 0x02, 0x01,
+	0x04, 0x04, 0x03, 0x01, 0x05, 0x04, 0x06, 0x01, 0x06, 0x04, 0x01, 0x01, 0x07, 0x03, 0x06, 0x01,
+	0x07, 0x04, 0x01, 0x01, 0x07, 0x03, 0x05, 0x01, 0x06, 0x04, 0x01, 0x01, 0x06, 0x03, 0x02, 0x01,
+	0x05, 0x04, 0x01, 0x01, 0x05, 0x03, 0x02, 0x01, 0x04, 0x04,
+	// @914 0x2A (18 pixels wide)
+	0x08, 0x00, 0x01, 0x02, 0x04, 0x02, 0x06, 0x02, 0x01, 0x02, 0x03, 0x03, 0x05, 0x04, 0x01, 0x02,
+	0x03, 0x04, 0x04, 0x04, 0x01, 0x02, 0x04, 0x03, 0x04, 0x03, 0x01, 0x02, 0x05, 0x03, 0x02, 0x03,
+	0x01, 0x02, 0x05, 0x03, 0x02, 0x02, 0x01, 0x01, 0x06, 0x06, 0x01, 0x03, 0x00, 0x02, 0x05, 0x04,
+	0x05, 0x02, 0x02, 0x01, 0x00, 0x12, 0x01, 0x03, 0x00, 0x02, 0x05, 0x04, 0x05, 0x02, 0x01, 0x02,
+	0x06, 0x02, 0x01, 0x03, 0x01, 0x02, 0x05, 0x03, 0x02, 0x02, 0x01, 0x02, 0x05, 0x03, 0x02, 0x03,
+	0x01, 0x02, 0x04, 0x03, 0x04, 0x03, 0x01, 0x02, 0x03, 0x04, 0x04, 0x04, 0x01, 0x02, 0x03, 0x03,
+	0x05, 0x04, 0x01, 0x02, 0x04, 0x02, 0x06, 0x01, 0x12, 0x00,
+	// @1020 0x2B (27 pixels wide)
+	0x10, 0x00, 0x0C, 0x01, 0x0C, 0x04, 0x03, 0x01, 0x00, 0x1B, 0x0D, 0x01, 0x0C, 0x04,
+	// @1034 0x2C (8 pixels wide)
+	0x25, 0x00, 0x01, 0x01, 0x06, 0x02, 0x02, 0x01, 0x03, 0x05, 0x01, 0x01, 0x03, 0x04, 0x02, 0x01,
+	0x02, 0x05, 0x01, 0x01, 0x02, 0x04,
+	// @1056 0x2D (13 pixels wide)
+	0x1C, 0x00, 0x03, 0x01, 0x00, 0x0D, 0x0D, 0x00,
+	// @1064 0x2E (6 pixels wide)
+	0x26, 0x00, 0x01, 0x01, 0x01, 0x04, 0x04, 0x01, 0x00, 0x06, 0x01, 0x01, 0x01, 0x04,
+	// @1078 0x2F (18 pixels wide)
+	0x08, 0x00, 0x02, 0x01, 0x0E, 0x04, 0x01, 0x01, 0x0E, 0x03, 0x01, 0x01, 0x0D, 0x04, 0x01, 0x01,
+	0x0D, 0x03, 0x02, 0x01, 0x0C, 0x04, 0x01, 0x01, 0x0C, 0x03, 0x02, 0x01, 0x0B, 0x04, 0x01, 0x01,
+	0x0B, 0x03, 0x01, 0x01, 0x0A, 0x04, 0x01, 0x01, 0x0A, 0x03, 0x02, 0x01, 0x09, 0x04, 0x01, 0x01,
+	0x09, 0x03, 0x01, 0x01, 0x08, 0x04, 0x01, 0x01, 0x08, 0x03, 0x02, 0x01, 0x07, 0x04, 0x01, 0x01,
+	0x07, 0x03, 0x02, 0x01, 0x06, 0x04, 0x01, 0x01, 0x06, 0x03, 0x01, 0x01, 0x05, 0x04, 0x01, 0x01,
+	0x05, 0x03, 0x02, 0x01, 0x04, 0x04, 0x01, 0x01, 0x04, 0x03, 0x01, 0x01, 0x03, 0x04, 0x01, 0x01,
+	0x03, 0x03, 0x02, 0x01, 0x02, 0x04, 0x01, 0x01, 0x02, 0x03, 0x02, 0x01, 0x01, 0x04,
+	// @1188 0x30 (23 pixels wide)
+	0x09, 0x00, 0x01, 0x01, 0x08, 0x07, 0x01, 0x01, 0x06, 0x0B, 0x01, 0x01, 0x05, 0x0E, 0x01, 0x01,
+	0x04, 0x10, 0x01, 0x02, 0x03, 0x06, 0x06, 0x05, 0x01, 0x02, 0x03, 0x05, 0x08, 0x05, 0x01, 0x02,
+	0x02, 0x05, 0x0A, 0x04, 0x01, 0x02, 0x02, 0x04, 0x0B, 0x05, 0x01, 0x02, 0x01, 0x05, 0x0B, 0x05,
+	0x01, 0x02, 0x01, 0x05, 0x0C, 0x04, 0x01, 0x02, 0x01, 0x04, 0x0D, 0x05, 0x03, 0x02, 0x00, 0x05,
+	0x0D, 0x05, 0x07, 0x02, 0x00, 0x05, 0x0E, 0x04, 0x03, 0x02, 0x00, 0x05, 0x0D, 0x05, 0x01, 0x02,
+	0x01, 0x04, 0x0D, 0x05, 0x01, 0x02, 0x01, 0x04, 0x0D, 0x04, 0x01, 0x02, 0x01, 0x05, 0x0C, 0x04,
+	0x01, 0x02, 0x01, 0x05, 0x0B, 0x05, 0x01, 0x02, 0x02, 0x05, 0x0A, 0x04, 0x01, 0x02, 0x02, 0x05,
+	0x09, 0x05, 0x01, 0x02, 0x03, 0x05, 0x07, 0x05, 0x01, 0x02, 0x03, 0x06, 0x05, 0x06, 0x01, 0x01,
+	0x04, 0x0F, 0x01, 0x01, 0x05, 0x0D, 0x01, 0x01, 0x07, 0x09,
+	// @1326 0x31 (11 pixels wide)
+	0x0A, 0x00, 0x01, 0x01, 0x05, 0x06, 0x01, 0x01, 0x03, 0x08, 0x01, 0x01, 0x02, 0x09, 0x01, 0x01,
+	0x00, 0x0B, 0x01, 0x02, 0x00, 0x05, 0x01, 0x05, 0x01, 0x02, 0x00, 0x03, 0x03, 0x05, 0x01, 0x02,
+	0x00, 0x02, 0x04, 0x05, 0x1B, 0x01, 0x06, 0x05,
+	// @1366 0x32 (22 pixels wide)
+	0x09, 0x00, 0x01, 0x01, 0x07, 0x08, 0x01, 0x01, 0x04, 0x0D, 0x01, 0x01, 0x03, 0x0F, 0x01, 0x01,
+	0x01, 0x12, 0x01, 0x02, 0x02, 0x05, 0x07, 0x06, 0x01, 0x02, 0x02, 0x03, 0x0A, 0x06, 0x02, 0x01,
+	0x10, 0x05, 0x01, 0x01, 0x11, 0x04, 0x02, 0x01, 0x11, 0x05, 0x02, 0x01, 0x11, 0x04, 0x02, 0x01,
+	0x10, 0x05, 0x01, 0x01, 0x10, 0x04, 0x01, 0x01, 0x0F, 0x05, 0x02, 0x01, 0x0E, 0x05, 0x01, 0x01,
+	0x0D, 0x05, 0x01, 0x01, 0x0C, 0x05, 0x01, 0x01, 0x0B, 0x05, 0x01, 0x01, 0x0A, 0x05, 0x01, 0x01,
+	0x09, 0x06, 0x01, 0x01, 0x08, 0x06, 0x01, 0x01, 0x07, 0x06, 0x01, 0x01, 0x06, 0x06, 0x01, 0x01,
+	0x05, 0x06, 0x01, 0x01, 0x04, 0x06, 0x01, 0x01, 0x03, 0x06, 0x01, 0x01, 0x02, 0x06, 0x01, 0x01,
+	0x01, 0x15, 0x03, 0x01, 0x00, 0x16,
+	// @1484 0x33 (22 pixels wide)
+	0x09, 0x00, 0x01, 0x01, 0x06, 0x09, 0x01, 0x01, 0x03, 0x0E, 0x01, 0x01, 0x02, 0x10, 0x01, 0x01,
+	0x02, 0x11, 0x01, 0x02, 0x02, 0x04, 0x07, 0x07, 0x01, 0x02, 0x03, 0x01, 0x0A, 0x06, 0x01, 0x01,
+	0x0F, 0x05, 0x03, 0x01, 0x10, 0x04, 0x02, 0x01, 0x0F, 0x05, 0x01, 0x01, 0x0E, 0x05, 0x01, 0x01,
+	0x0D, 0x06, 0x01, 0x01, 0x0A, 0x07, 0x01, 0x01, 0x05, 0x0B, 0x01, 0x01, 0x05, 0x09, 0x01, 0x01,
+	0x05, 0x0C, 0x01, 0x01, 0x0B, 0x08, 0x01, 0x01, 0x0E, 0x06, 0x01, 0x01, 0x0F, 0x05, 0x02, 0x01,
+	0x10, 0x05, 0x05, 0x01, 0x11, 0x05, 0x01, 0x01, 0x10, 0x05, 0x01, 0x01, 0x0F, 0x06, 0x01, 0x02,
+	0x01, 0x02, 0x0B, 0x06, 0x01, 0x02, 0x01, 0x05, 0x06, 0x08, 0x01, 0x01, 0x00, 0x13, 0x01, 0x01,
+	0x01, 0x10, 0x01, 0x01, 0x03, 0x0C,
+	// @1602 0x34 (25 pixels wide)
+	0x0A, 0x00, 0x01, 0x01, 0x0F, 0x05, 0x01, 0x01, 0x0E, 0x06, 0x01, 0x01, 0x0D, 0x07, 0x02, 0x01,
+	0x0C, 0x08, 0x01, 0x02, 0x0B, 0x04, 0x01, 0x04, 0x02, 0x02, 0x0A, 0x04, 0x02, 0x04, 0x01, 0x02,
+	0x09, 0x04, 0x03, 0x04, 0x01, 0x02, 0x08, 0x05, 0x03, 0x04, 0x01, 0x02, 0x08, 0x04, 0x04, 0x04,
+	0x01, 0x02, 0x07, 0x04, 0x05, 0x04, 0x01, 0x02, 0x06, 0x05, 0x05, 0x04, 0x01, 0x02, 0x05, 0x05,
+	0x06, 0x04, 0x01, 0x02, 0x05, 0x04, 0x07, 0x04, 0x01, 0x02, 0x04, 0x04, 0x08, 0x04, 0x01, 0x02,
+	0x03, 0x05, 0x08, 0x04, 0x01, 0x02, 0x03, 0x04, 0x09, 0x04, 0x01, 0x02, 0x02, 0x04, 0x0A, 0x04,
+	0x02, 0x02, 0x01, 0x04, 0x0B, 0x04, 0x04, 0x01, 0x00, 0x19, 0x09, 0x01, 0x10, 0x04,
+	// @1712 0x35 (22 pixels wide)
+	0x0A, 0x00, 0x03, 0x01, 0x04, 0x11, 0x03, 0x01, 0x04, 0x04, 0x01, 0x01, 0x04, 0x03, 0x05, 0x01,
+	0x03, 0x04, 0x01, 0x01, 0x03, 0x0A, 0x01, 0x01, 0x03, 0x0D, 0x01, 0x01, 0x02, 0x10, 0x01, 0x01,
+	0x02, 0x11, 0x01, 0x01, 0x0C, 0x08, 0x01, 0x01, 0x0E, 0x06, 0x01, 0x01, 0x0F, 0x06, 0x02, 0x01,
+	0x10, 0x05, 0x04, 0x01, 0x11, 0x05, 0x01, 0x01, 0x11, 0x04, 0x02, 0x01, 0x10, 0x05, 0x01, 0x01,
+	0x0F, 0x05, 0x01, 0x02, 0x01, 0x02, 0x0B, 0x06, 0x01, 0x02, 0x01, 0x05, 0x05, 0x08, 0x01, 0x01,
+	0x01, 0x11, 0x01, 0x01, 0x00, 0x10, 0x01, 0x01, 0x02, 0x0D,
+	// @1802 0x36 (23 pixels wide)
+	0x09, 0x00, 0x01, 0x01, 0x0F, 0x05, 0x01, 0x01, 0x0C, 0x08, 0x01, 0x01, 0x0A, 0x0A, 0x01, 0x01,
+	0x08, 0x0C, 0x01, 0x01, 0x07, 0x08, 0x01, 0x01, 0x06, 0x06, 0x01, 0x01, 0x05, 0x05, 0x01, 0x01,
+	0x04, 0x05, 0x01, 0x01, 0x03, 0x05, 0x02, 0x01, 0x02, 0x05, 0x01, 0x01, 0x02, 0x04, 0x01, 0x02,
+	0x01, 0x05, 0x05, 0x05, 0x01, 0x02, 0x01, 0x04, 0x03, 0x0A, 0x01, 0x02, 0x01, 0x04, 0x01, 0x0E,
+	0x01, 0x01, 0x00, 0x15, 0x01, 0x02, 0x00, 0x09, 0x06, 0x06, 0x01, 0x02, 0x00, 0x07, 0x09, 0x06,
+	0x01, 0x02, 0x00, 0x06, 0x0B, 0x06, 0x02, 0x02, 0x00, 0x05, 0x0D, 0x05, 0x03, 0x02, 0x00, 0x04,
+	0x0F, 0x04, 0x02, 0x02, 0x00, 0x05, 0x0E, 0x04, 0x02, 0x02, 0x01, 0x04, 0x0D, 0x05, 0x01, 0x02,
+	0x01, 0x05, 0x0C, 0x04, 0x01, 0x02, 0x02, 0x05, 0x0A, 0x05, 0x01, 0x02, 0x02, 0x06, 0x08, 0x05,
+	0x01, 0x02, 0x03, 0x06, 0x06, 0x06, 0x01, 0x01, 0x04, 0x10, 0x01, 0x01, 0x05, 0x0E, 0x01, 0x01,
+	0x07, 0x0A,
+	// @1948 0x37 (22 pixels wide)
+	0x0A, 0x00, 0x03, 0x01, 0x00, 0x16, 0x01, 0x01, 0x11, 0x04, 0x01, 0x01, 0x10, 0x05, 0x01, 0x01,
+	0x10, 0x04, 0x01, 0x01, 0x0F, 0x05, 0x01, 0x01, 0x0F, 0x04, 0x01, 0x01, 0x0E, 0x05, 0x01, 0x01,
+	0x0E, 0x04, 0x02, 0x01, 0x0D, 0x05, 0x02, 0x01, 0x0C, 0x05, 0x01, 0x01, 0x0C, 0x04, 0x01, 0x01,
+	0x0B, 0x05, 0x01, 0x01, 0x0B, 0x04, 0x01, 0x01, 0x0A, 0x05, 0x01, 0x01, 0x0A, 0x04, 0x01, 0x01,
+	0x09, 0x05, 0x01, 0x01, 0x09, 0x04, 0x01, 0x01, 0x08, 0x05, 0x01, 0x01, 0x08, 0x04, 0x01, 0x01,
+	0x07, 0x05, 0x01, 0x01, 0x07, 0x04, 0x01, 0x01, 0x06, 0x05, 0x01, 0x01, 0x06, 0x04, 0x01, 0x01,
+	0x05, 0x05, 0x01, 0x01, 0x05, 0x04, 0x01, 0x01, 0x04, 0x05, 0x01, 0x01, 0x04, 0x04, 0x01, 0x01,
+	0x03, 0x05, 0x01, 0x01, 0x03, 0x04, 0x01, 0x01, 0x02, 0x05,
+	// @2070 0x38 (23 pixels wide)
+	0x09, 0x00, 0x01, 0x01, 0x08, 0x08, 0x01, 0x01, 0x06, 0x0C, 0x01, 0x01, 0x04, 0x0F, 0x01, 0x02,
+	0x03, 0x07, 0x04, 0x06, 0x01, 0x02, 0x03, 0x05, 0x08, 0x05, 0x01, 0x02, 0x02, 0x05, 0x0A, 0x04,
+	0x01, 0x02, 0x02, 0x04, 0x0B, 0x05, 0x01, 0x02, 0x01, 0x05, 0x0B, 0x05, 0x01, 0x02, 0x01, 0x05,
+	0x0C, 0x04, 0x02, 0x02, 0x01, 0x05, 0x0B, 0x05, 0x01, 0x02, 0x02, 0x04, 0x0B, 0x04, 0x01, 0x02,
+	0x02, 0x05, 0x09, 0x05, 0x01, 0x02, 0x03, 0x05, 0x07, 0x05, 0x01, 0x02, 0x03, 0x07, 0x04, 0x05,
+	0x01, 0x01, 0x04, 0x0E, 0x01, 0x01, 0x06, 0x0A, 0x01, 0x01, 0x06, 0x0C, 0x01, 0x01, 0x04, 0x10,
+	0x01, 0x02, 0x03, 0x05, 0x06, 0x07, 0x01, 0x02, 0x02, 0x05, 0x08, 0x07, 0x01, 0x02, 0x01, 0x05,
+	0x0B, 0x05, 0x01, 0x02, 0x01, 0x04, 0x0C, 0x06, 0x03, 0x02, 0x00, 0x05, 0x0D, 0x05, 0x01, 0x02,
+	0x00, 0x05, 0x0E, 0x04, 0x02, 0x02, 0x00, 0x05, 0x0D, 0x05, 0x01, 0x02, 0x01, 0x05, 0x0B, 0x05,
+	0x01, 0x02, 0x01, 0x06, 0x0A, 0x05, 0x01, 0x02, 0x02, 0x06, 0x07, 0x06, 0x01, 0x01, 0x03, 0x11,
+	0x01, 0x01, 0x04, 0x0F, 0x01, 0x01, 0x06, 0x0B,
+	// @2238 0x39 (23 pixels wide)
+	0x09, 0x00, 0x01, 0x01, 0x08, 0x08, 0x01, 0x01, 0x06, 0x0C, 0x01, 0x01, 0x05, 0x0E, 0x01, 0x01,
+	0x04, 0x10, 0x01, 0x02, 0x03, 0x05, 0x07, 0x06, 0x01, 0x02, 0x02, 0x05, 0x09, 0x05, 0x02, 0x02,
+	0x01, 0x05, 0x0B, 0x05, 0x01, 0x02, 0x01, 0x04, 0x0D, 0x05, 0x02, 0x02, 0x00, 0x05, 0x0D, 0x05,
+	0x04, 0x02, 0x00, 0x05, 0x0E, 0x04, 0x01, 0x02, 0x01, 0x04, 0x0D, 0x05, 0x01, 0x02, 0x01, 0x05,
+	0x0C, 0x05, 0x01, 0x02, 0x01, 0x06, 0x0A, 0x06, 0x01, 0x02, 0x02, 0x06, 0x07, 0x08, 0x01, 0x02,
+	0x03, 0x0F, 0x01, 0x04, 0x01, 0x02, 0x04, 0x0D, 0x01, 0x05, 0x01, 0x02, 0x05, 0x0B, 0x02, 0x05,
+	0x01, 0x02, 0x08, 0x05, 0x05, 0x04, 0x02, 0x01, 0x11, 0x05, 0x02, 0x01, 0x10, 0x05, 0x01, 0x01,
+	0x0F, 0x05, 0x01, 0x01, 0x0E, 0x05, 0x01, 0x01, 0x0C, 0x06, 0x01, 0x01, 0x0B, 0x07, 0x01, 0x01,
+	0x07, 0x09, 0x01, 0x01, 0x03, 0x0C, 0x01, 0x01, 0x03, 0x0A, 0x01, 0x01, 0x03, 0x08,
+	// @2380 0x3A (6 pixels wide)
+	0x13, 0x00, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x00, 0x05, 0x04, 0x01, 0x00, 0x06, 0x01, 0x01,
+	0x01, 0x04, 0x0C, 0x00, 0x01, 0x01, 0x01, 0x04, 0x04, 0x01, 0x00, 0x06, 0x01, 0x01, 0x01, 0x04,
+	// @2412 0x3B (5 pixels wide)
+	0x11, 0x00, 0x05, 0x01, 0x00, 0x05, 0x11, 0x00, 0x05, 0x01, 0x00, 0x05,
+	// @2424 0x3C (25 pixels wide)
+	0x10, 0x00, 0x01, 0x01, 0x18, 0x01, 0x01, 0x01, 0x16, 0x03, 0x01, 0x01, 0x14, 0x05, 0x01, 0x01,
+	0x12, 0x07, 0x01, 0x01, 0x10, 0x07, 0x01, 0x01, 0x0E, 0x07, 0x01, 0x01, 0x0C, 0x07, 0x01, 0x01,
+	0x0A, 0x07, 0x01, 0x01, 0x08, 0x07, 0x01, 0x01, 0x06, 0x07, 0x01, 0x01, 0x04, 0x07, 0x01, 0x01,
+	0x02, 0x07, 0x01, 0x01, 0x00, 0x07, 0x02, 0x01, 0x00, 0x05, 0x01, 0x01, 0x01, 0x06, 0x01, 0x01,
+	0x03, 0x06, 0x01, 0x01, 0x05, 0x06, 0x01, 0x01, 0x07, 0x06, 0x01, 0x01, 0x09, 0x06, 0x01, 0x01,
+	0x0B, 0x06, 0x01, 0x01, 0x0C, 0x07, 0x01, 0x01, 0x0E, 0x07, 0x01, 0x01, 0x10, 0x07, 0x01, 0x01,
+	0x12, 0x07, 0x01, 0x01, 0x14, 0x05, 0x01, 0x01, 0x16, 0x03, 0x01, 0x01, 0x18, 0x01,
+	// @2534 0x3D (27 pixels wide)
+	0x17, 0x00, 0x03, 0x01, 0x00, 0x1B, 0x07, 0x00, 0x04, 0x01, 0x00, 0x1B, 0x07, 0x00,
+	// @2548 0x3E (25 pixels wide)
+	0x10, 0x00, 0x01, 0x01, 0x00, 0x02, 0x01, 0x01, 0x00, 0x04, 0x01, 0x01, 0x00, 0x06, 0x01, 0x01,
+	0x01, 0x07, 0x01, 0x01, 0x03, 0x07, 0x01, 0x01, 0x05, 0x07, 0x01, 0x01, 0x07, 0x07, 0x01, 0x01,
+	0x09, 0x07, 0x01, 0x01, 0x0B, 0x07, 0x01, 0x01, 0x0D, 0x06, 0x01, 0x01, 0x0F, 0x06, 0x01, 0x01,
+	0x11, 0x06, 0x01, 0x01, 0x13, 0x06, 0x01, 0x01, 0x15, 0x04, 0x01, 0x01, 0x14, 0x05, 0x01, 0x01,
+	0x12, 0x07, 0x01, 0x01, 0x10, 0x07, 0x01, 0x01, 0x0E, 0x07, 0x01, 0x01, 0x0C, 0x07, 0x01, 0x01,
+	0x0A, 0x07, 0x01, 0x01, 0x08, 0x07, 0x01, 0x01, 0x06, 0x07, 0x01, 0x01, 0x04, 0x07, 0x01, 0x01,
+	0x02, 0x07, 0x01, 0x01, 0x00, 0x07, 0x01, 0x01, 0x00, 0x05, 0x01, 0x01, 0x00, 0x03, 0x01, 0x01,
+	0x00, 0x01,
+	// @2662 0x3F (16 pixels wide)
+	0x08, 0x00, 0x01, 0x01, 0x02, 0x0A, 0x01, 0x01, 0x00, 0x0D, 0x01, 0x01, 0x00, 0x0E, 0x01, 0x01,
+	0x00, 0x0F, 0x01, 0x02, 0x01, 0x01, 0x08, 0x06, 0x06, 0x01, 0x0B, 0x05, 0x02, 0x01, 0x0A, 0x05,
+	0x01, 0x01, 0x09, 0x05, 0x02, 0x01, 0x08, 0x05, 0x01, 0x01, 0x07, 0x05, 0x01, 0x01, 0x06, 0x05,
+	0x01, 0x01, 0x06, 0x04, 0x01, 0x01, 0x05, 0x05, 0x01, 0x01, 0x05, 0x04, 0x05, 0x01, 0x04, 0x05,
+	0x04, 0x00, 0x01, 0x01, 0x05, 0x03, 0x01, 0x01, 0x04, 0x05, 0x02, 0x01, 0x03, 0x07, 0x02, 0x01,
+	0x04, 0x05,
+	// @2744 0x40 (35 pixels wide)
+	0x0D, 0x00, 0x01, 0x01, 0x0E, 0x0B, 0x01, 0x01, 0x0B, 0x11, 0x01, 0x02, 0x09, 0x06, 0x08, 0x06,
+	0x01, 0x02, 0x08, 0x05, 0x0D, 0x04, 0x01, 0x02, 0x07, 0x04, 0x10, 0x04, 0x01, 0x02, 0x06, 0x03,
+	0x13, 0x04, 0x01, 0x02, 0x05, 0x03, 0x15, 0x04, 0x01, 0x02, 0x04, 0x03, 0x17, 0x03, 0x01, 0x03,
+	0x03, 0x04, 0x0B, 0x06, 0x07, 0x03, 0x01, 0x03, 0x03, 0x03, 0x09, 0x0C, 0x04, 0x03, 0x01, 0x03,
+	0x02, 0x03, 0x09, 0x0C, 0x05, 0x03, 0x01, 0x04, 0x02, 0x03, 0x07, 0x06, 0x05, 0x03, 0x06, 0x03,
+	0x01, 0x04, 0x01, 0x03, 0x07, 0x05, 0x07, 0x03, 0x06, 0x03, 0x01, 0x04, 0x01, 0x03, 0x07, 0x04,
+	0x08, 0x03, 0x06, 0x03, 0x01, 0x04, 0x01, 0x03, 0x06, 0x04, 0x08, 0x04, 0x06, 0x03, 0x02, 0x04,
+	0x01, 0x03, 0x05, 0x04, 0x09, 0x03, 0x07, 0x03, 0x01, 0x04, 0x00, 0x03, 0x06, 0x03, 0x0A, 0x03,
+	0x07, 0x03, 0x01, 0x04, 0x00, 0x03, 0x05, 0x04, 0x0A, 0x03, 0x07, 0x03, 0x01, 0x04, 0x00, 0x03,
+	0x05, 0x04, 0x09, 0x04, 0x07, 0x02, 0x01, 0x04, 0x00, 0x03, 0x05, 0x04, 0x09, 0x04, 0x06, 0x03,
+	0x01, 0x04, 0x00, 0x03, 0x05, 0x04, 0x08, 0x04, 0x07, 0x03, 0x01, 0x04, 0x00, 0x04, 0x04, 0x04,
+	0x07, 0x05, 0x06, 0x03, 0x01, 0x05, 0x01, 0x03, 0x05, 0x03, 0x06, 0x03, 0x01, 0x03, 0x04, 0x04,
+	0x01, 0x05, 0x01, 0x03, 0x05, 0x05, 0x03, 0x03, 0x02, 0x03, 0x03, 0x04, 0x01, 0x03, 0x01, 0x03,
+	0x06, 0x09, 0x03, 0x09, 0x01, 0x03, 0x01, 0x04, 0x06, 0x07, 0x05, 0x07, 0x01, 0x03, 0x02, 0x03,
+	0x08, 0x02, 0x0A, 0x02, 0x01, 0x01, 0x02, 0x04, 0x01, 0x01, 0x03, 0x04, 0x01, 0x01, 0x04, 0x04,
+	// @2984 0x41 (30 pixels wide)
+	0x08, 0x00, 0x02, 0x01, 0x0C, 0x06, 0x01, 0x01, 0x0C, 0x07, 0x02, 0x01, 0x0B, 0x08, 0x01, 0x01,
+	0x0B, 0x09, 0x02, 0x02, 0x0A, 0x04, 0x02, 0x04, 0x01, 0x02, 0x0A, 0x04, 0x02, 0x05, 0x01, 0x02,
+	0x09, 0x05, 0x03, 0x04, 0x02, 0x02, 0x09, 0x04, 0x04, 0x05, 0x01, 0x02, 0x08, 0x05, 0x05, 0x04,
+	0x02, 0x02, 0x08, 0x04, 0x06, 0x05, 0x01, 0x02, 0x07, 0x05, 0x07, 0x04, 0x02, 0x02, 0x07, 0x04,
+	0x08, 0x05, 0x01, 0x02, 0x06, 0x05, 0x09, 0x04, 0x02, 0x02, 0x06, 0x04, 0x0A, 0x05, 0x01, 0x01,
+	0x05, 0x14, 0x02, 0x01, 0x05, 0x15, 0x01, 0x01, 0x04, 0x16, 0x01, 0x02, 0x04, 0x05, 0x0D, 0x05,
+	0x01, 0x02, 0x04, 0x04, 0x0E, 0x05, 0x01, 0x02, 0x03, 0x05, 0x0E, 0x05, 0x01, 0x02, 0x03, 0x05,
+	0x0F, 0x05, 0x01, 0x02, 0x03, 0x04, 0x10, 0x05, 0x01, 0x02, 0x02, 0x05, 0x10, 0x05, 0x01, 0x02,
+	0x02, 0x05, 0x11, 0x05, 0x01, 0x02, 0x02, 0x04, 0x12, 0x05, 0x01, 0x02, 0x01, 0x05, 0x12, 0x05,
+	0x01, 0x02, 0x01, 0x05, 0x13, 0x05, 0x01, 0x02, 0x00, 0x05, 0x14, 0x05,
+	// @3140 0x42 (23 pixels wide)
+	0x08, 0x00, 0x01, 0x01, 0x01, 0x0D, 0x01, 0x01, 0x00, 0x10, 0x01, 0x01, 0x00, 0x12, 0x01, 0x01,
+	0x00, 0x13, 0x01, 0x02, 0x00, 0x05, 0x09, 0x06, 0x01, 0x02, 0x00, 0x05, 0x0A, 0x06, 0x03, 0x02,
+	0x00, 0x05, 0x0B, 0x05, 0x01, 0x02, 0x00, 0x05, 0x0C, 0x04, 0x02, 0x02, 0x00, 0x05, 0x0B, 0x05,
+	0x01, 0x02, 0x00, 0x05, 0x0B, 0x04, 0x01, 0x02, 0x00, 0x05, 0x0A, 0x05, 0x01, 0x02, 0x00, 0x05,
+	0x08, 0x06, 0x01, 0x01, 0x00, 0x12, 0x01, 0x01, 0x00, 0x10, 0x01, 0x01, 0x00, 0x11, 0x01, 0x01,
+	0x00, 0x13, 0x01, 0x02, 0x00, 0x05, 0x08, 0x07, 0x01, 0x02, 0x00, 0x05, 0x0A, 0x06, 0x01, 0x02,
+	0x00, 0x05, 0x0B, 0x05, 0x02, 0x02, 0x00, 0x05, 0x0C, 0x05, 0x01, 0x02, 0x00, 0x05, 0x0D, 0x04,
+	0x02, 0x02, 0x00, 0x05, 0x0D, 0x05, 0x01, 0x02, 0x00, 0x05, 0x0D, 0x04, 0x02, 0x02, 0x00, 0x05,
+	0x0C, 0x05, 0x01, 0x02, 0x00, 0x05, 0x0B, 0x05, 0x01, 0x02, 0x00, 0x05, 0x09, 0x07, 0x01, 0x02,
+	0x00, 0x05, 0x06, 0x09, 0x01, 0x01, 0x00, 0x13, 0x01, 0x01, 0x00, 0x11, 0x01, 0x01, 0x00, 0x0F,
+	// @3300 0x43 (27 pixels wide)
+	0x08, 0x00, 0x01, 0x01, 0x0D, 0x0C, 0x01, 0x01, 0x0A, 0x11, 0x01, 0x01, 0x08, 0x13, 0x01, 0x01,
+	0x07, 0x13, 0x01, 0x02, 0x06, 0x07, 0x0B, 0x02, 0x01, 0x01, 0x05, 0x06, 0x01, 0x01, 0x04, 0x06,
+	0x01, 0x01, 0x03, 0x06, 0x01, 0x01, 0x02, 0x06, 0x01, 0x01, 0x02, 0x05, 0x03, 0x01, 0x01, 0x05,
+	0x0B, 0x01, 0x00, 0x05, 0x02, 0x01, 0x01, 0x05, 0x01, 0x01, 0x01, 0x06, 0x01, 0x01, 0x02, 0x05,
+	0x01, 0x01, 0x02, 0x06, 0x01, 0x01, 0x03, 0x06, 0x01, 0x01, 0x04, 0x06, 0x01, 0x02, 0x05, 0x07,
+	0x0D, 0x01, 0x01, 0x02, 0x06, 0x0A, 0x05, 0x05, 0x01, 0x01, 0x07, 0x14, 0x01, 0x01, 0x09, 0x12,
+	0x01, 0x01, 0x0B, 0x0E,
+	// @3400 0x44 (29 pixels wide)
+	0x08, 0x00, 0x01, 0x01, 0x02, 0x0E, 0x01, 0x01, 0x00, 0x13, 0x01, 0x01, 0x00, 0x16, 0x01, 0x01,
+	0x00, 0x17, 0x01, 0x02, 0x00, 0x05, 0x0B, 0x08, 0x01, 0x02, 0x00, 0x05, 0x0D, 0x07, 0x01, 0x02,
+	0x00, 0x05, 0x0F, 0x06, 0x01, 0x02, 0x00, 0x05, 0x10, 0x06, 0x01, 0x02, 0x00, 0x05, 0x11, 0x05,
+	0x02, 0x02, 0x00, 0x05, 0x12, 0x05, 0x05, 0x02, 0x00, 0x05, 0x13, 0x05, 0x02, 0x02, 0x00, 0x05,
+	0x14, 0x04, 0x06, 0x02, 0x00, 0x05, 0x13, 0x05, 0x02, 0x02, 0x00, 0x05, 0x12, 0x05, 0x01, 0x02,
+	0x00, 0x05, 0x11, 0x06, 0x01, 0x02, 0x00, 0x05, 0x11, 0x05, 0x01, 0x02, 0x00, 0x05, 0x10, 0x05,
+	0x01, 0x02, 0x00, 0x05, 0x0F, 0x06, 0x01, 0x02, 0x00, 0x05, 0x0D, 0x07, 0x01, 0x02, 0x00, 0x05,
+	0x0B, 0x08, 0x01, 0x02, 0x00, 0x05, 0x07, 0x0B, 0x01, 0x01, 0x00, 0x15, 0x01, 0x01, 0x00, 0x13,
+	0x01, 0x01, 0x00, 0x10,
+	// @3532 0x45 (20 pixels wide)
+	0x08, 0x00, 0x04, 0x01, 0x00, 0x13, 0x0B, 0x01, 0x00, 0x05, 0x04, 0x01, 0x00, 0x12, 0x0D, 0x01,
+	0x00, 0x05, 0x04, 0x01, 0x00, 0x14,
+	// @3554 0x46 (19 pixels wide)
+	0x08, 0x00, 0x04, 0x01, 0x00, 0x13, 0x0C, 0x01, 0x00, 0x05, 0x04, 0x01, 0x00, 0x12, 0x10, 0x01,
+	0x00, 0x05,
+	// @3572 0x47 (29 pixels wide)
+	0x08, 0x00, 0x01, 0x01, 0x0E, 0x0B, 0x01, 0x01, 0x0B, 0x11, 0x01, 0x01, 0x09, 0x13, 0x01, 0x01,
+	0x07, 0x15, 0x01, 0x02, 0x06, 0x08, 0x0B, 0x02, 0x01, 0x01, 0x05, 0x07, 0x01, 0x01, 0x04, 0x06,
+	0x01, 0x01, 0x03, 0x06, 0x01, 0x01, 0x02, 0x06, 0x01, 0x01, 0x02, 0x05, 0x01, 0x01, 0x01, 0x06,
+	0x02, 0x01, 0x01, 0x05, 0x04, 0x01, 0x00, 0x05, 0x04, 0x02, 0x00, 0x05, 0x0D, 0x0B, 0x02, 0x02,
+	0x00, 0x05, 0x14, 0x04, 0x01, 0x02, 0x00, 0x06, 0x13, 0x04, 0x02, 0x02, 0x01, 0x05, 0x13, 0x04,
+	0x01, 0x02, 0x01, 0x06, 0x12, 0x04, 0x01, 0x02, 0x02, 0x05, 0x12, 0x04, 0x01, 0x02, 0x02, 0x06,
+	0x11, 0x04, 0x01, 0x02, 0x03, 0x06, 0x10, 0x04, 0x01, 0x02, 0x04, 0x07, 0x0E, 0x04, 0x01, 0x02,
+	0x05, 0x08, 0x0C, 0x04, 0x01, 0x02, 0x06, 0x0B, 0x04, 0x08, 0x01, 0x01, 0x07, 0x16, 0x01, 0x01,
+	0x09, 0x14, 0x01, 0x01, 0x0C, 0x0E,
+	// @3706 0x48 (27 pixels wide)
+	0x08, 0x00, 0x0F, 0x02, 0x00, 0x05, 0x11, 0x05, 0x04, 0x01, 0x00, 0x1B, 0x11, 0x02, 0x00, 0x05,
+	0x11, 0x05,
+	// @3724 0x49 (5 pixels wide)
+	0x08, 0x00, 0x24, 0x01, 0x00, 0x05,
+	// @3730 0x4A (16 pixels wide)
+	0x08, 0x00, 0x1D, 0x01, 0x0B, 0x05, 0x02, 0x01, 0x0A, 0x05, 0x01, 0x01, 0x09, 0x06, 0x01, 0x02,
+	0x01, 0x02, 0x04, 0x07, 0x01, 0x01, 0x01, 0x0C, 0x01, 0x01, 0x00, 0x0C, 0x01, 0x01, 0x00, 0x0B,
+	// @3762 0x4B (25 pixels wide)
+	0x08, 0x00, 0x01, 0x02, 0x00, 0x05, 0x0D, 0x06, 0x01, 0x02, 0x00, 0x05, 0x0D, 0x05, 0x01, 0x02,
+	0x00, 0x05, 0x0C, 0x05, 0x01, 0x02, 0x00, 0x05, 0x0B, 0x06, 0x01, 0x02, 0x00, 0x05, 0x0A, 0x06,
+	0x01, 0x02, 0x00, 0x05, 0x09, 0x06, 0x01, 0x02, 0x00, 0x05, 0x08, 0x06, 0x01, 0x02, 0x00, 0x05,
+	0x08, 0x05, 0x01, 0x02, 0x00, 0x05, 0x07, 0x05, 0x01, 0x02, 0x00, 0x05, 0x06, 0x05, 0x01, 0x02,
+	0x00, 0x05, 0x05, 0x06, 0x01, 0x02, 0x00, 0x05, 0x04, 0x06, 0x01, 0x02, 0x00, 0x05, 0x04, 0x05,
+	0x01, 0x02, 0x00, 0x05, 0x03, 0x05, 0x01, 0x02, 0x00, 0x05, 0x02, 0x05, 0x01, 0x02, 0x00, 0x05,
+	0x01, 0x05, 0x01, 0x01, 0x00, 0x0C, 0x02, 0x01, 0x00, 0x0D, 0x01, 0x02, 0x00, 0x07, 0x02, 0x05,
+	0x01, 0x02, 0x00, 0x06, 0x03, 0x06, 0x01, 0x02, 0x00, 0x05, 0x05, 0x05, 0x01, 0x02, 0x00, 0x05,
+	0x06, 0x05, 0x01, 0x02, 0x00, 0x05, 0x06, 0x06, 0x01, 0x02, 0x00, 0x05, 0x07, 0x05, 0x01, 0x02,
+	0x00, 0x05, 0x08, 0x05, 0x01, 0x02, 0x00, 0x05, 0x08, 0x06, 0x01, 0x02, 0x00, 0x05, 0x09, 0x05,
+	0x01, 0x02, 0x00, 0x05, 0x0A, 0x05, 0x01, 0x02, 0x00, 0x05, 0x0A, 0x06, 0x01, 0x02, 0x00, 0x05,
+	0x0B, 0x06, 0x01, 0x02, 0x00, 0x05, 0x0C, 0x05, 0x01, 0x02, 0x00, 0x05, 0x0C, 0x06, 0x01, 0x02,
+	0x00, 0x05, 0x0D, 0x06, 0x01, 0x02, 0x00, 0x05, 0x0E, 0x05, 0x01, 0x02, 0x00, 0x05, 0x0E, 0x06,
+	// @3970 0x4C (20 pixels wide)
+	0x08, 0x00, 0x20, 0x01, 0x00, 0x05, 0x04, 0x01, 0x00, 0x14,
+	// @3980 0x4D (37 pixels wide)
+	0x08, 0x00, 0x01, 0x02, 0x03, 0x06, 0x13, 0x06, 0x02, 0x02, 0x02, 0x07, 0x13, 0x06, 0x02, 0x02,
+	0x02, 0x08, 0x11, 0x08, 0x01, 0x03, 0x02, 0x08, 0x11, 0x03, 0x01, 0x04, 0x02, 0x04, 0x02, 0x04,
+	0x01, 0x04, 0x0F, 0x04, 0x01, 0x04, 0x01, 0x04, 0x02, 0x04, 0x01, 0x04, 0x0E, 0x04, 0x02, 0x04,
+	0x01, 0x04, 0x02, 0x04, 0x01, 0x05, 0x0D, 0x04, 0x02, 0x04, 0x01, 0x04, 0x02, 0x04, 0x02, 0x04,
+	0x0D, 0x04, 0x02, 0x04, 0x01, 0x04, 0x02, 0x04, 0x02, 0x04, 0x0C, 0x04, 0x03, 0x04, 0x01, 0x04,
+	0x02, 0x04, 0x02, 0x05, 0x0B, 0x04, 0x03, 0x04, 0x01, 0x04, 0x02, 0x04, 0x03, 0x04, 0x0B, 0x04,
+	0x03, 0x04, 0x01, 0x04, 0x02, 0x04, 0x03, 0x04, 0x0A, 0x04, 0x04, 0x04, 0x01, 0x04, 0x02, 0x04,
+	0x03, 0x05, 0x09, 0x04, 0x04, 0x04, 0x01, 0x04, 0x01, 0x05, 0x04, 0x04, 0x08, 0x05, 0x04, 0x04,
+	0x02, 0x04, 0x01, 0x05, 0x04, 0x05, 0x07, 0x04, 0x05, 0x04, 0x01, 0x04, 0x01, 0x05, 0x05, 0x04,
+	0x06, 0x05, 0x05, 0x05, 0x02, 0x04, 0x01, 0x04, 0x06, 0x05, 0x05, 0x04, 0x06, 0x05, 0x02, 0x04,
+	0x01, 0x04, 0x07, 0x04, 0x04, 0x04, 0x07, 0x05, 0x01, 0x04, 0x01, 0x04, 0x07, 0x05, 0x03, 0x04,
+	0x07, 0x05, 0x02, 0x04, 0x01, 0x04, 0x08, 0x04, 0x02, 0x04, 0x08, 0x05, 0x01, 0x04, 0x01, 0x04,
+	0x08, 0x05, 0x01, 0x04, 0x09, 0x04, 0x01, 0x04, 0x01, 0x04, 0x09, 0x04, 0x01, 0x03, 0x0A, 0x04,
+	0x01, 0x03, 0x01, 0x04, 0x09, 0x08, 0x0A, 0x04, 0x01, 0x03, 0x00, 0x05, 0x09, 0x08, 0x0A, 0x04,
+	0x02, 0x03, 0x00, 0x05, 0x0A, 0x06, 0x0B, 0x04, 0x01, 0x03, 0x00, 0x05, 0x0A, 0x05, 0x0C, 0x04,
+	0x01, 0x03, 0x00, 0x05, 0x0B, 0x04, 0x0C, 0x04, 0x01, 0x03, 0x00, 0x05, 0x0B, 0x04, 0x0C, 0x05,
+	// @4236 0x4E (27 pixels wide)
+	0x08, 0x00, 0x01, 0x02, 0x00, 0x05, 0x11, 0x05, 0x01, 0x02, 0x00, 0x06, 0x10, 0x05, 0x02, 0x02,
+	0x00, 0x07, 0x0F, 0x05, 0x02, 0x02, 0x00, 0x08, 0x0E, 0x05, 0x01, 0x02, 0x00, 0x09, 0x0D, 0x05,
+	0x02, 0x03, 0x00, 0x04, 0x01, 0x05, 0x0C, 0x05, 0x01, 0x03, 0x00, 0x04, 0x02, 0x05, 0x0B, 0x05,
+	0x01, 0x03, 0x00, 0x04, 0x02, 0x06, 0x0A, 0x05, 0x01, 0x03, 0x00, 0x04, 0x03, 0x05, 0x0A, 0x05,
+	0x02, 0x03, 0x00, 0x04, 0x04, 0x05, 0x09, 0x05, 0x01, 0x03, 0x00, 0x04, 0x05, 0x05, 0x08, 0x05,
+	0x01, 0x03, 0x00, 0x04, 0x05, 0x06, 0x08, 0x04, 0x01, 0x03, 0x00, 0x04, 0x06, 0x05, 0x08, 0x04,
+	0x01, 0x03, 0x00, 0x04, 0x07, 0x05, 0x07, 0x04, 0x01, 0x03, 0x00, 0x04, 0x07, 0x06, 0x06, 0x04,
+	0x01, 0x03, 0x00, 0x04, 0x08, 0x05, 0x06, 0x04, 0x01, 0x03, 0x00, 0x04, 0x08, 0x06, 0x05, 0x04,
+	0x01, 0x03, 0x00, 0x04, 0x09, 0x05, 0x05, 0x04, 0x01, 0x03, 0x00, 0x04, 0x0A, 0x05, 0x04, 0x04,
+	0x01, 0x03, 0x00, 0x04, 0x0A, 0x06, 0x03, 0x04, 0x01, 0x03, 0x00, 0x04, 0x0B, 0x05, 0x03, 0x04,
+	0x02, 0x03, 0x00, 0x04, 0x0C, 0x05, 0x02, 0x04, 0x02, 0x03, 0x00, 0x04, 0x0D, 0x05, 0x01, 0x04,
+	0x01, 0x02, 0x00, 0x04, 0x0E, 0x09, 0x02, 0x02, 0x00, 0x04, 0x0F, 0x08, 0x01, 0x02, 0x00, 0x04,
+	0x10, 0x07, 0x02, 0x02, 0x00, 0x04, 0x11, 0x06, 0x01, 0x02, 0x00, 0x04, 0x12, 0x05,
+	// @4442 0x4F (33 pixels wide)
+	0x08, 0x00, 0x01, 0x01, 0x0B, 0x0B, 0x01, 0x01, 0x09, 0x0F, 0x01, 0x01, 0x07, 0x13, 0x01, 0x02,
+	0x06, 0x09, 0x02, 0x0A, 0x01, 0x02, 0x05, 0x07, 0x09, 0x07, 0x01, 0x02, 0x04, 0x06, 0x0D, 0x06,
+	0x01, 0x02, 0x03, 0x06, 0x0F, 0x05, 0x01, 0x02, 0x03, 0x05, 0x10, 0x06, 0x01, 0x02, 0x02, 0x05,
+	0x12, 0x06, 0x01, 0x02, 0x02, 0x05, 0x13, 0x05, 0x01, 0x02, 0x01, 0x05, 0x14, 0x05, 0x02, 0x02,
+	0x01, 0x05, 0x15, 0x05, 0x02, 0x02, 0x00, 0x05, 0x16, 0x05, 0x01, 0x02, 0x00, 0x05, 0x17, 0x04,
+	0x03, 0x02, 0x00, 0x05, 0x17, 0x05, 0x02, 0x02, 0x00, 0x05, 0x17, 0x04, 0x03, 0x02, 0x00, 0x05,
+	0x16, 0x05, 0x01, 0x02, 0x01, 0x05, 0x15, 0x05, 0x01, 0x02, 0x01, 0x05, 0x14, 0x05, 0x01, 0x02,
+	0x01, 0x06, 0x13, 0x05, 0x01, 0x02, 0x02, 0x05, 0x12, 0x06, 0x01, 0x02, 0x02, 0x06, 0x11, 0x05,
+	0x01, 0x02, 0x03, 0x06, 0x0F, 0x05, 0x01, 0x02, 0x04, 0x06, 0x0D, 0x06, 0x01, 0x02, 0x04, 0x07,
+	0x0A, 0x07, 0x01, 0x02, 0x05, 0x09, 0x05, 0x08, 0x01, 0x01, 0x06, 0x14, 0x01, 0x01, 0x08, 0x10,
+	0x01, 0x01, 0x0A, 0x0C,
+	// @4606 0x50 (22 pixels wide)
+	0x08, 0x00, 0x01, 0x01, 0x01, 0x0D, 0x01, 0x01, 0x00, 0x11, 0x01, 0x01, 0x00, 0x12, 0x01, 0x01,
+	0x00, 0x13, 0x01, 0x02, 0x00, 0x05, 0x09, 0x06, 0x01, 0x02, 0x00, 0x05, 0x0A, 0x06, 0x01, 0x02,
+	0x00, 0x05, 0x0B, 0x05, 0x07, 0x02, 0x00, 0x05, 0x0C, 0x05, 0x01, 0x02, 0x00, 0x05, 0x0C, 0x04,
+	0x01, 0x02, 0x00, 0x05, 0x0B, 0x05, 0x01, 0x02, 0x00, 0x05, 0x0A, 0x06, 0x01, 0x02, 0x00, 0x05,
+	0x08, 0x07, 0x01, 0x01, 0x00, 0x13, 0x01, 0x01, 0x00, 0x12, 0x01, 0x01, 0x00, 0x10, 0x01, 0x01,
+	0x00, 0x0D, 0x0E, 0x01, 0x00, 0x05,
+	// @4692 0x51 (33 pixels wide)
+	0x08, 0x00, 0x01, 0x01, 0x0B, 0x0B, 0x01, 0x01, 0x09, 0x0F, 0x01, 0x01, 0x07, 0x13, 0x01, 0x02,
+	0x06, 0x0A, 0x01, 0x0A, 0x01, 0x02, 0x05, 0x07, 0x09, 0x07, 0x01, 0x02, 0x04, 0x06, 0x0D, 0x06,
+	0x01, 0x02, 0x03, 0x06, 0x0F, 0x05, 0x01, 0x02, 0x03, 0x05, 0x11, 0x05, 0x01, 0x02, 0x02, 0x05,
+	0x12, 0x06, 0x01, 0x02, 0x02, 0x05, 0x13, 0x05, 0x01, 0x02, 0x01, 0x05, 0x14, 0x05, 0x02, 0x02,
+	0x01, 0x05, 0x15, 0x05, 0x02, 0x02, 0x00, 0x05, 0x16, 0x05, 0x01, 0x02, 0x00, 0x05, 0x17, 0x04,
+	0x03, 0x02, 0x00, 0x05, 0x17, 0x05, 0x02, 0x02, 0x00, 0x05, 0x17, 0x04, 0x03, 0x02, 0x00, 0x05,
+	0x16, 0x05, 0x01, 0x02, 0x01, 0x05, 0x15, 0x05, 0x01, 0x02, 0x01, 0x05, 0x14, 0x05, 0x01, 0x02,
+	0x01, 0x06, 0x13, 0x05, 0x01, 0x02, 0x02, 0x05, 0x12, 0x06, 0x01, 0x02, 0x02, 0x06, 0x11, 0x05,
+	0x01, 0x02, 0x03, 0x06, 0x0F, 0x05, 0x01, 0x02, 0x04, 0x06, 0x0D, 0x06, 0x01, 0x02, 0x04, 0x07,
+	0x0A, 0x07, 0x01, 0x02, 0x05, 0x09, 0x05, 0x08, 0x01, 0x01, 0x07, 0x12, 0x01, 0x01, 0x08, 0x0F,
+	0x01, 0x01, 0x0A, 0x0E,
+	// @4856 0x52 (23 pixels wide)
+	0x08, 0x00, 0x01, 0x01, 0x02, 0x0C, 0x01, 0x01, 0x00, 0x11, 0x01, 0x01, 0x00, 0x13, 0x01, 0x01,
+	0x00, 0x14, 0x01, 0x02, 0x00, 0x05, 0x09, 0x07, 0x01, 0x02, 0x00, 0x05, 0x0B, 0x05, 0x01, 0x02,
+	0x00, 0x05, 0x0B, 0x06, 0x06, 0x02, 0x00, 0x05, 0x0C, 0x05, 0x01, 0x02, 0x00, 0x05, 0x0C, 0x04,
+	0x01, 0x02, 0x00, 0x05, 0x0B, 0x05, 0x01, 0x02, 0x00, 0x05, 0x0A, 0x05, 0x01, 0x02, 0x00, 0x05,
+	0x08, 0x06, 0x01, 0x01, 0x00, 0x12, 0x02, 0x01, 0x00, 0x10, 0x01, 0x01, 0x00, 0x12, 0x01, 0x02,
+	0x00, 0x05, 0x08, 0x06, 0x01, 0x02, 0x00, 0x05, 0x09, 0x05, 0x02, 0x02, 0x00, 0x05, 0x0A, 0x05,
+	0x01, 0x02, 0x00, 0x05, 0x0B, 0x04, 0x03, 0x02, 0x00, 0x05, 0x0B, 0x05, 0x01, 0x02, 0x00, 0x05,
+	0x0C, 0x04, 0x03, 0x02, 0x00, 0x05, 0x0C, 0x05, 0x01, 0x02, 0x00, 0x05, 0x0D, 0x04, 0x02, 0x02,
+	0x00, 0x05, 0x0D, 0x05,
+	// @4988 0x53 (22 pixels wide)
+	0x08, 0x00, 0x01, 0x01, 0x08, 0x0A, 0x01, 0x01, 0x06, 0x0E, 0x01, 0x01, 0x04, 0x10, 0x01, 0x01,
+	0x03, 0x11, 0x01, 0x02, 0x02, 0x06, 0x0A, 0x01, 0x01, 0x01, 0x02, 0x05, 0x06, 0x01, 0x01, 0x05,
+	0x01, 0x01, 0x02, 0x05, 0x01, 0x01, 0x02, 0x06, 0x01, 0x01, 0x03, 0x07, 0x01, 0x01, 0x03, 0x09,
+	0x01, 0x01, 0x05, 0x09, 0x01, 0x01, 0x06, 0x0A, 0x01, 0x01, 0x08, 0x0A, 0x01, 0x01, 0x0A, 0x09,
+	0x01, 0x01, 0x0D, 0x07, 0x01, 0x01, 0x0E, 0x07, 0x02, 0x01, 0x10, 0x05, 0x05, 0x01, 0x11, 0x05,
+	0x01, 0x01, 0x10, 0x05, 0x01, 0x02, 0x01, 0x01, 0x0E, 0x05, 0x01, 0x02, 0x01, 0x03, 0x0A, 0x06,
+	0x01, 0x02, 0x01, 0x06, 0x05, 0x08, 0x01, 0x01, 0x00, 0x13, 0x01, 0x01, 0x01, 0x10, 0x01, 0x01,
+	0x03, 0x0C,
+	// @5102 0x54 (26 pixels wide)
+	0x08, 0x00, 0x04, 0x01, 0x00, 0x1A, 0x20, 0x01, 0x0B, 0x04,
+	// @5112 0x55 (26 pixels wide)
+	0x08, 0x00, 0x18, 0x02, 0x00, 0x05, 0x11, 0x04, 0x03, 0x02, 0x00, 0x05, 0x10, 0x05, 0x01, 0x02,
+	0x01, 0x05, 0x0F, 0x05, 0x01, 0x02, 0x01, 0x05, 0x0E, 0x05, 0x01, 0x02, 0x01, 0x06, 0x0D, 0x05,
+	0x01, 0x02, 0x02, 0x05, 0x0C, 0x05, 0x01, 0x02, 0x02, 0x06, 0x0A, 0x06, 0x01, 0x02, 0x03, 0x08,
+	0x05, 0x07, 0x01, 0x01, 0x04, 0x12, 0x01, 0x01, 0x05, 0x10, 0x01, 0x01, 0x07, 0x0C,
+	// @5174 0x56 (30 pixels wide)
+	0x08, 0x00, 0x01, 0x02, 0x00, 0x05, 0x14, 0x05, 0x03, 0x02, 0x01, 0x05, 0x12, 0x05, 0x03, 0x02,
+	0x02, 0x05, 0x10, 0x05, 0x01, 0x02, 0x03, 0x04, 0x0F, 0x05, 0x01, 0x02, 0x03, 0x05, 0x0E, 0x05,
+	0x01, 0x02, 0x03, 0x05, 0x0E, 0x04, 0x01, 0x02, 0x04, 0x04, 0x0D, 0x05, 0x01, 0x02, 0x04, 0x05,
+	0x0C, 0x05, 0x01, 0x02, 0x04, 0x05, 0x0C, 0x04, 0x01, 0x02, 0x04, 0x05, 0x0B, 0x05, 0x01, 0x02,
+	0x05, 0x05, 0x0A, 0x05, 0x01, 0x02, 0x05, 0x05, 0x0A, 0x04, 0x01, 0x02, 0x05, 0x05, 0x09, 0x05,
+	0x01, 0x02, 0x06, 0x05, 0x08, 0x05, 0x01, 0x02, 0x06, 0x05, 0x08, 0x04, 0x01, 0x02, 0x06, 0x05,
+	0x07, 0x05, 0x02, 0x02, 0x07, 0x05, 0x06, 0x04, 0x01, 0x02, 0x07, 0x05, 0x05, 0x05, 0x01, 0x02,
+	0x08, 0x04, 0x05, 0x04, 0x01, 0x02, 0x08, 0x05, 0x04, 0x04, 0x01, 0x02, 0x08, 0x05, 0x03, 0x05,
+	0x01, 0x02, 0x09, 0x04, 0x03, 0x04, 0x01, 0x02, 0x09, 0x05, 0x02, 0x04, 0x01, 0x02, 0x09, 0x05,
+	0x01, 0x05, 0x02, 0x02, 0x0A, 0x04, 0x01, 0x04, 0x01, 0x01, 0x0A, 0x09, 0x02, 0x01, 0x0B, 0x07,
+	0x01, 0x01, 0x0B, 0x06, 0x01, 0x01, 0x0C, 0x05,
+	// @5342 0x57 (43 pixels wide)
+	0x08, 0x00, 0x01, 0x03, 0x00, 0x05, 0x0E, 0x05, 0x0F, 0x04, 0x01, 0x03, 0x00, 0x05, 0x0E, 0x05,
+	0x0E, 0x05, 0x01, 0x03, 0x00, 0x05, 0x0E, 0x06, 0x0D, 0x05, 0x01, 0x03, 0x01, 0x04, 0x0D, 0x07,
+	0x0D, 0x04, 0x01, 0x03, 0x01, 0x05, 0x0C, 0x07, 0x0D, 0x04, 0x01, 0x03, 0x01, 0x05, 0x0C, 0x07,
+	0x0C, 0x05, 0x01, 0x04, 0x01, 0x05, 0x0C, 0x03, 0x01, 0x04, 0x0B, 0x05, 0x01, 0x04, 0x02, 0x04,
+	0x0B, 0x04, 0x01, 0x04, 0x0B, 0x04, 0x01, 0x04, 0x02, 0x05, 0x0A, 0x04, 0x01, 0x04, 0x0B, 0x04,
+	0x01, 0x04, 0x02, 0x05, 0x0A, 0x04, 0x01, 0x04, 0x0A, 0x05, 0x01, 0x04, 0x02, 0x05, 0x0A, 0x04,
+	0x01, 0x05, 0x09, 0x05, 0x01, 0x04, 0x03, 0x04, 0x09, 0x04, 0x03, 0x04, 0x09, 0x04, 0x01, 0x04,
+	0x03, 0x05, 0x08, 0x04, 0x03, 0x04, 0x09, 0x04, 0x01, 0x04, 0x03, 0x05, 0x08, 0x04, 0x03, 0x04,
+	0x08, 0x05, 0x01, 0x04, 0x03, 0x05, 0x08, 0x04, 0x03, 0x05, 0x07, 0x04, 0x01, 0x04, 0x04, 0x04,
+	0x07, 0x04, 0x05, 0x04, 0x07, 0x04, 0x01, 0x04, 0x04, 0x04, 0x07, 0x04, 0x05, 0x04, 0x06, 0x05,
+	0x01, 0x04, 0x04, 0x05, 0x06, 0x04, 0x05, 0x04, 0x06, 0x05, 0x01, 0x04, 0x04, 0x05, 0x06, 0x03,
+	0x06, 0x05, 0x05, 0x04, 0x01, 0x04, 0x05, 0x04, 0x05, 0x04, 0x06, 0x05, 0x05, 0x04, 0x01, 0x04,
+	0x05, 0x04, 0x05, 0x04, 0x07, 0x04, 0x04, 0x05, 0x01, 0x04, 0x05, 0x05, 0x04, 0x04, 0x07, 0x04,
+	0x04, 0x04, 0x01, 0x04, 0x05, 0x05, 0x04, 0x03, 0x08, 0x04, 0x04, 0x04, 0x01, 0x04, 0x06, 0x04,
+	0x03, 0x04, 0x08, 0x05, 0x03, 0x04, 0x01, 0x04, 0x06, 0x04, 0x03, 0x04, 0x09, 0x04, 0x02, 0x05,
+	0x01, 0x04, 0x06, 0x05, 0x02, 0x04, 0x09, 0x04, 0x02, 0x04, 0x01, 0x04, 0x06, 0x05, 0x02, 0x03,
+	0x0A, 0x04, 0x02, 0x04, 0x01, 0x04, 0x07, 0x04, 0x01, 0x04, 0x0A, 0x04, 0x02, 0x04, 0x01, 0x04,
+	0x07, 0x04, 0x01, 0x04, 0x0B, 0x04, 0x01, 0x03, 0x01, 0x03, 0x07, 0x04, 0x01, 0x03, 0x0C, 0x08,
+	0x01, 0x02, 0x07, 0x08, 0x0C, 0x08, 0x01, 0x02, 0x08, 0x07, 0x0C, 0x08, 0x01, 0x02, 0x08, 0x07,
+	0x0D, 0x06, 0x02, 0x02, 0x08, 0x06, 0x0E, 0x06, 0x01, 0x02, 0x09, 0x05, 0x0E, 0x05,
+	// @5660 0x58 (27 pixels wide)
+	0x08, 0x00, 0x01, 0x02, 0x00, 0x05, 0x10, 0x06, 0x01, 0x02, 0x00, 0x06, 0x0F, 0x05, 0x01, 0x02,
+	0x01, 0x05, 0x0E, 0x05, 0x01, 0x02, 0x02, 0x05, 0x0C, 0x06, 0x01, 0x02, 0x02, 0x05, 0x0C, 0x05,
+	0x01, 0x02, 0x03, 0x05, 0x0A, 0x05, 0x01, 0x02, 0x03, 0x06, 0x09, 0x05, 0x01, 0x02, 0x04, 0x05,
+	0x08, 0x05, 0x01, 0x02, 0x05, 0x05, 0x07, 0x05, 0x01, 0x02, 0x05, 0x05, 0x06, 0x05, 0x02, 0x02,
+	0x06, 0x05, 0x04, 0x05, 0x01, 0x02, 0x07, 0x05, 0x02, 0x05, 0x01, 0x02, 0x08, 0x04, 0x02, 0x04,
+	0x01, 0x01, 0x08, 0x0A, 0x02, 0x01, 0x09, 0x08, 0x02, 0x01, 0x0A, 0x06, 0x01, 0x01, 0x09, 0x08,
+	0x01, 0x01, 0x09, 0x09, 0x01, 0x01, 0x08, 0x0A, 0x02, 0x02, 0x07, 0x05, 0x02, 0x05, 0x01, 0x02,
+	0x06, 0x05, 0x04, 0x05, 0x01, 0x02, 0x06, 0x04, 0x05, 0x06, 0x01, 0x02, 0x05, 0x05, 0x06, 0x05,
+	0x02, 0x02, 0x04, 0x05, 0x08, 0x05, 0x01, 0x02, 0x03, 0x05, 0x0A, 0x05, 0x01, 0x02, 0x03, 0x05,
+	0x0A, 0x06, 0x01, 0x02, 0x02, 0x05, 0x0C, 0x05, 0x01, 0x02, 0x01, 0x06, 0x0D, 0x05, 0x01, 0x02,
+	0x01, 0x05, 0x0E, 0x05, 0x01, 0x02, 0x00, 0x05, 0x10, 0x05, 0x01, 0x02, 0x00, 0x05, 0x10, 0x06,
+	// @5836 0x59 (27 pixels wide)
+	0x08, 0x00, 0x01, 0x02, 0x00, 0x05, 0x11, 0x05, 0x01, 0x02, 0x00, 0x06, 0x10, 0x05, 0x01, 0x02,
+	0x01, 0x05, 0x0F, 0x05, 0x01, 0x02, 0x01, 0x06, 0x0E, 0x05, 0x01, 0x02, 0x02, 0x05, 0x0D, 0x05,
+	0x01, 0x02, 0x03, 0x05, 0x0C, 0x05, 0x01, 0x02, 0x03, 0x05, 0x0B, 0x05, 0x01, 0x02, 0x04, 0x05,
+	0x0A, 0x04, 0x01, 0x02, 0x04, 0x05, 0x09, 0x05, 0x01, 0x02, 0x05, 0x05, 0x08, 0x04, 0x01, 0x02,
+	0x05, 0x05, 0x07, 0x05, 0x01, 0x02, 0x06, 0x05, 0x06, 0x04, 0x01, 0x02, 0x06, 0x05, 0x05, 0x04,
+	0x01, 0x02, 0x07, 0x05, 0x04, 0x04, 0x01, 0x02, 0x07, 0x05, 0x03, 0x04, 0x01, 0x02, 0x08, 0x05,
+	0x02, 0x04, 0x01, 0x02, 0x09, 0x04, 0x01, 0x04, 0x01, 0x01, 0x09, 0x09, 0x01, 0x01, 0x0A, 0x07,
+	0x01, 0x01, 0x0A, 0x06, 0x10, 0x01, 0x0B, 0x05,
+	// @5956 0x5A (26 pixels wide)
+	0x08, 0x00, 0x04, 0x01, 0x01, 0x18, 0x02, 0x01, 0x13, 0x05, 0x01, 0x01, 0x12, 0x05, 0x02, 0x01,
+	0x11, 0x05, 0x01, 0x01, 0x10, 0x05, 0x01, 0x01, 0x0F, 0x05, 0x01, 0x01, 0x0E, 0x06, 0x01, 0x01,
+	0x0E, 0x05, 0x01, 0x01, 0x0D, 0x05, 0x01, 0x01, 0x0C, 0x06, 0x01, 0x01, 0x0C, 0x05, 0x01, 0x01,
+	0x0B, 0x05, 0x01, 0x01, 0x0A, 0x06, 0x01, 0x01, 0x0A, 0x05, 0x01, 0x01, 0x09, 0x05, 0x01, 0x01,
+	0x08, 0x06, 0x01, 0x01, 0x08, 0x05, 0x01, 0x01, 0x07, 0x05, 0x02, 0x01, 0x06, 0x05, 0x01, 0x01,
+	0x05, 0x05, 0x02, 0x01, 0x04, 0x05, 0x01, 0x01, 0x03, 0x05, 0x02, 0x01, 0x02, 0x05, 0x01, 0x01,
+	0x01, 0x05, 0x04, 0x01, 0x00, 0x1A,
+	// @6058 0x5B (10 pixels wide)
+	0x08, 0x00, 0x03, 0x01, 0x00, 0x0A, 0x21, 0x01, 0x00, 0x04,
+	// @6068 0x5C (18 pixels wide)
+	0x08, 0x00, 0x01, 0x01, 0x00, 0x04, 0x01, 0x01, 0x01, 0x03, 0x01, 0x01, 0x01, 0x04, 0x01, 0x01,
+	0x02, 0x03, 0x02, 0x01, 0x02, 0x04, 0x01, 0x01, 0x03, 0x03, 0x02, 0x01, 0x03, 0x04, 0x01, 0x01,
+	0x04, 0x03, 0x01, 0x01, 0x04, 0x04, 0x01, 0x01, 0x05, 0x03, 0x02, 0x01, 0x05, 0x04, 0x01, 0x01,
+	0x06, 0x03, 0x02, 0x01, 0x06, 0x04, 0x01, 0x01, 0x07, 0x03, 0x01, 0x01, 0x07, 0x04, 0x01, 0x01,
+	0x08, 0x03, 0x02, 0x01, 0x08, 0x04, 0x01, 0x01, 0x09, 0x03, 0x02, 0x01, 0x09, 0x04, 0x01, 0x01,
+	0x0A, 0x03, 0x01, 0x01, 0x0A, 0x04, 0x01, 0x01, 0x0B, 0x03, 0x02, 0x01, 0x0B, 0x04, 0x01, 0x01,
+	0x0C, 0x03, 0x02, 0x01, 0x0C, 0x04, 0x01, 0x01, 0x0D, 0x03, 0x01, 0x01, 0x0D, 0x04, 0x01, 0x01,
+	0x0E, 0x03,
+	// @6182 0x5D (10 pixels wide)
+	0x08, 0x00, 0x03, 0x01, 0x00, 0x0A, 0x21, 0x01, 0x06, 0x04,
+	// @6192 0x5E (25 pixels wide)
+	0x0A, 0x00, 0x01, 0x01, 0x0B, 0x04, 0x01, 0x01, 0x0A, 0x05, 0x01, 0x01, 0x0A, 0x06, 0x01, 0x01,
+	0x09, 0x07, 0x01, 0x02, 0x09, 0x03, 0x01, 0x04, 0x01, 0x02, 0x09, 0x03, 0x02, 0x03, 0x01, 0x02,
+	0x08, 0x03, 0x03, 0x04, 0x01, 0x02, 0x08, 0x03, 0x04, 0x03, 0x01, 0x02, 0x07, 0x04, 0x04, 0x03,
+	0x01, 0x02, 0x07, 0x03, 0x05, 0x04, 0x01, 0x02, 0x06, 0x04, 0x06, 0x03, 0x01, 0x02, 0x06, 0x03,
+	0x07, 0x04, 0x01, 0x02, 0x05, 0x04, 0x08, 0x03, 0x01, 0x02, 0x05, 0x03, 0x09, 0x04, 0x01, 0x02,
+	0x04, 0x04, 0x0A, 0x03, 0x01, 0x02, 0x04, 0x04, 0x0A, 0x04, 0x01, 0x02, 0x04, 0x03, 0x0B, 0x04,
+	0x01, 0x02, 0x03, 0x04, 0x0C, 0x04, 0x01, 0x02, 0x03, 0x03, 0x0D, 0x04, 0x01, 0x02, 0x02, 0x04,
+	0x0E, 0x03, 0x01, 0x02, 0x02, 0x03, 0x0F, 0x04, 0x01, 0x02, 0x01, 0x04, 0x10, 0x03, 0x01, 0x02,
+	0x01, 0x04, 0x10, 0x04, 0x01, 0x02, 0x00, 0x04, 0x11, 0x04, 0x0A, 0x00,
+	// @6332 0x5F (27 pixels wide)
+	0x2C, 0x00,
+	// @6334 0x60 (10 pixels wide)
+	0x07, 0x00, 0x01, 0x01, 0x00, 0x05, 0x01, 0x01, 0x01, 0x05, 0x01, 0x01, 0x02, 0x05, 0x01, 0x01,
+	0x03, 0x04, 0x01, 0x01, 0x04, 0x04, 0x01, 0x01, 0x05, 0x03, 0x01, 0x01, 0x05, 0x04, 0x01, 0x01,
+	0x06, 0x04, 0x1D, 0x00,
+	// @6370 0x61 (20 pixels wide)
+	0x12, 0x00, 0x01, 0x01, 0x05, 0x0A, 0x01, 0x01, 0x03, 0x0D, 0x01, 0x01, 0x02, 0x10, 0x01, 0x02,
+	0x02, 0x05, 0x05, 0x06, 0x01, 0x02, 0x02, 0x02, 0x0A, 0x05, 0x01, 0x01, 0x0E, 0x05, 0x04, 0x01,
+	0x0F, 0x05, 0x01, 0x01, 0x08, 0x0C, 0x01, 0x01, 0x05, 0x0F, 0x01, 0x01, 0x03, 0x11, 0x01, 0x02,
+	0x02, 0x07, 0x06, 0x05, 0x01, 0x02, 0x01, 0x06, 0x08, 0x05, 0x01, 0x02, 0x01, 0x05, 0x09, 0x05,
+	0x04, 0x02, 0x00, 0x05, 0x0A, 0x05, 0x01, 0x02, 0x00, 0x05, 0x09, 0x06, 0x01, 0x02, 0x00, 0x05,
+	0x08, 0x07, 0x01, 0x02, 0x01, 0x05, 0x06, 0x08, 0x01, 0x02, 0x01, 0x0E, 0x01, 0x04, 0x01, 0x02,
+	0x02, 0x0C, 0x02, 0x04, 0x01, 0x02, 0x03, 0x0A, 0x03, 0x04,
+	// @6476 0x62 (24 pixels wide)
+	0x06, 0x00, 0x0C, 0x01, 0x00, 0x05, 0x01, 0x02, 0x00, 0x05, 0x04, 0x08, 0x01, 0x02, 0x00, 0x05,
+	0x02, 0x0C, 0x01, 0x02, 0x00, 0x05, 0x01, 0x0E, 0x01, 0x02, 0x00, 0x0B, 0x02, 0x08, 0x01, 0x02,
+	0x00, 0x08, 0x08, 0x06, 0x01, 0x02, 0x00, 0x07, 0x0A, 0x06, 0x01, 0x02, 0x00, 0x06, 0x0C, 0x05,
+	0x01, 0x02, 0x00, 0x05, 0x0D, 0x05, 0x0A, 0x02, 0x00, 0x05, 0x0E, 0x05, 0x01, 0x02, 0x00, 0x05,
+	0x0D, 0x05, 0x01, 0x02, 0x00, 0x06, 0x0C, 0x05, 0x01, 0x02, 0x00, 0x06, 0x0B, 0x05, 0x01, 0x02,
+	0x00, 0x07, 0x09, 0x06, 0x01, 0x03, 0x00, 0x04, 0x01, 0x04, 0x05, 0x07, 0x01, 0x02, 0x00, 0x04,
+	0x01, 0x0F, 0x01, 0x02, 0x00, 0x04, 0x02, 0x0D, 0x01, 0x02, 0x00, 0x04, 0x04, 0x09,
+	// @6586 0x63 (20 pixels wide)
+	0x12, 0x00, 0x01, 0x01, 0x09, 0x0A, 0x01, 0x01, 0x07, 0x0D, 0x01, 0x01, 0x05, 0x0F, 0x01, 0x02,
+	0x04, 0x09, 0x01, 0x06, 0x01, 0x01, 0x03, 0x06, 0x01, 0x01, 0x02, 0x06, 0x01, 0x01, 0x02, 0x05,
+	0x02, 0x01, 0x01, 0x05, 0x08, 0x01, 0x00, 0x05, 0x01, 0x01, 0x00, 0x06, 0x01, 0x01, 0x01, 0x05,
+	0x01, 0x01, 0x01, 0x06, 0x01, 0x01, 0x02, 0x06, 0x01, 0x01, 0x02, 0x07, 0x01, 0x02, 0x03, 0x08,
+	0x05, 0x04, 0x01, 0x01, 0x04, 0x10, 0x01, 0x01, 0x05, 0x0F, 0x01, 0x01, 0x07, 0x0C,
+	// @6664 0x64 (24 pixels wide)
+	0x06, 0x00, 0x0C, 0x01, 0x13, 0x05, 0x01, 0x02, 0x07, 0x09, 0x03, 0x05, 0x01, 0x02, 0x06, 0x0B,
+	0x02, 0x05, 0x01, 0x02, 0x04, 0x0E, 0x01, 0x05, 0x01, 0x02, 0x03, 0x08, 0x02, 0x0B, 0x01, 0x02,
+	0x03, 0x06, 0x07, 0x08, 0x01, 0x02, 0x02, 0x05, 0x0A, 0x07, 0x01, 0x02, 0x01, 0x06, 0x0B, 0x06,
+	0x02, 0x02, 0x01, 0x05, 0x0D, 0x05, 0x09, 0x02, 0x00, 0x05, 0x0E, 0x05, 0x01, 0x02, 0x01, 0x05,
+	0x0D, 0x05, 0x01, 0x02, 0x01, 0x05, 0x0C, 0x06, 0x01, 0x02, 0x02, 0x05, 0x0A, 0x07, 0x01, 0x02,
+	0x02, 0x06, 0x08, 0x08, 0x01, 0x03, 0x03, 0x07, 0x04, 0x05, 0x01, 0x04, 0x01, 0x02, 0x04, 0x0E,
+	0x02, 0x04, 0x01, 0x02, 0x05, 0x0C, 0x03, 0x04, 0x01, 0x02, 0x06, 0x0A, 0x04, 0x04,
+	// @6774 0x65 (23 pixels wide)
+	0x12, 0x00, 0x01, 0x01, 0x08, 0x08, 0x01, 0x01, 0x06, 0x0C, 0x01, 0x01, 0x04, 0x0F, 0x01, 0x02,
+	0x03, 0x06, 0x05, 0x06, 0x01, 0x02, 0x03, 0x05, 0x08, 0x05, 0x01, 0x02, 0x02, 0x05, 0x0A, 0x04,
+	0x01, 0x02, 0x01, 0x05, 0x0B, 0x05, 0x02, 0x02, 0x01, 0x04, 0x0D, 0x04, 0x01, 0x02, 0x00, 0x05,
+	0x0D, 0x04, 0x01, 0x02, 0x00, 0x05, 0x0D, 0x05, 0x03, 0x01, 0x00, 0x17, 0x04, 0x01, 0x00, 0x05,
+	0x01, 0x01, 0x01, 0x04, 0x01, 0x01, 0x01, 0x05, 0x01, 0x01, 0x02, 0x05, 0x01, 0x01, 0x02, 0x06,
+	0x01, 0x02, 0x03, 0x07, 0x07, 0x04, 0x01, 0x01, 0x04, 0x11, 0x01, 0x01, 0x05, 0x10, 0x01, 0x01,
+	0x07, 0x0D,
+	// @6872 0x66 (16 pixels wide)
+	0x06, 0x00, 0x01, 0x01, 0x09, 0x07, 0x01, 0x01, 0x07, 0x09, 0x01, 0x01, 0x06, 0x0A, 0x01, 0x01,
+	0x05, 0x0B, 0x01, 0x01, 0x05, 0x05, 0x02, 0x01, 0x04, 0x05, 0x01, 0x01, 0x04, 0x04, 0x04, 0x01,
+	0x03, 0x05, 0x04, 0x01, 0x00, 0x0E, 0x16, 0x01, 0x03, 0x05,
+	// @6914 0x67 (24 pixels wide)
+	0x12, 0x00, 0x01, 0x02, 0x08, 0x08, 0x04, 0x04, 0x01, 0x02, 0x06, 0x0B, 0x03, 0x04, 0x01, 0x02,
+	0x04, 0x0E, 0x02, 0x04, 0x01, 0x03, 0x03, 0x08, 0x03, 0x05, 0x01, 0x04, 0x01, 0x02, 0x03, 0x05,
+	0x08, 0x08, 0x01, 0x02, 0x02, 0x05, 0x0A, 0x07, 0x01, 0x02, 0x01, 0x06, 0x0B, 0x06, 0x01, 0x02,
+	0x01, 0x05, 0x0D, 0x05, 0x01, 0x02, 0x01, 0x04, 0x0E, 0x05, 0x08, 0x02, 0x00, 0x05, 0x0E, 0x05,
+	0x01, 0x02, 0x01, 0x04, 0x0E, 0x05, 0x01, 0x02, 0x01, 0x05, 0x0C, 0x06, 0x01, 0x02, 0x01, 0x06,
+	0x0B, 0x06, 0x01, 0x02, 0x02, 0x05, 0x0A, 0x07, 0x01, 0x02, 0x02, 0x07, 0x07, 0x08, 0x01, 0x02,
+	0x03, 0x0F, 0x01, 0x05, 0x01, 0x02, 0x04, 0x0E, 0x01, 0x05, 0x01, 0x02, 0x06, 0x0A, 0x03, 0x05,
+	0x01, 0x02, 0x08, 0x06, 0x05, 0x05,
+	// @7032 0x68 (22 pixels wide)
+	0x06, 0x00, 0x0C, 0x01, 0x00, 0x05, 0x01, 0x02, 0x00, 0x05, 0x04, 0x07, 0x01, 0x02, 0x00, 0x05,
+	0x02, 0x0B, 0x01, 0x02, 0x00, 0x05, 0x01, 0x0D, 0x01, 0x01, 0x00, 0x14, 0x01, 0x02, 0x00, 0x08,
+	0x06, 0x06, 0x01, 0x02, 0x00, 0x07, 0x09, 0x05, 0x01, 0x02, 0x00, 0x06, 0x0A, 0x05, 0x01, 0x02,
+	0x00, 0x05, 0x0C, 0x04, 0x12, 0x02, 0x00, 0x05, 0x0C, 0x05,
+	// @7090 0x69 (6 pixels wide)
+	0x08, 0x00, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x01, 0x05, 0x02, 0x01, 0x00, 0x06, 0x01, 0x01,
+	0x01, 0x05, 0x01, 0x01, 0x01, 0x04, 0x04, 0x00, 0x1A, 0x01, 0x01, 0x05,
+	// @7118 0x6A (12 pixels wide)
+	0x08, 0x00, 0x01, 0x01, 0x07, 0x03, 0x01, 0x01, 0x06, 0x05, 0x02, 0x01, 0x06, 0x06, 0x01, 0x01,
+	0x06, 0x05, 0x01, 0x01, 0x07, 0x03, 0x04, 0x00, 0x1A, 0x01, 0x06, 0x05,
+	// @7146 0x6B (21 pixels wide)
+	0x06, 0x00, 0x0C, 0x01, 0x00, 0x05, 0x01, 0x02, 0x00, 0x05, 0x09, 0x06, 0x01, 0x02, 0x00, 0x05,
+	0x08, 0x06, 0x01, 0x02, 0x00, 0x05, 0x08, 0x05, 0x01, 0x02, 0x00, 0x05, 0x07, 0x05, 0x01, 0x02,
+	0x00, 0x05, 0x06, 0x05, 0x01, 0x02, 0x00, 0x05, 0x05, 0x05, 0x01, 0x02, 0x00, 0x05, 0x04, 0x05,
+	0x01, 0x02, 0x00, 0x05, 0x03, 0x05, 0x01, 0x02, 0x00, 0x05, 0x02, 0x05, 0x01, 0x02, 0x00, 0x05,
+	0x02, 0x04, 0x01, 0x02, 0x00, 0x05, 0x01, 0x04, 0x02, 0x01, 0x00, 0x0B, 0x01, 0x01, 0x00, 0x0C,
+	0x01, 0x02, 0x00, 0x06, 0x01, 0x06, 0x01, 0x02, 0x00, 0x05, 0x03, 0x06, 0x01, 0x02, 0x00, 0x05,
+	0x04, 0x05, 0x01, 0x02, 0x00, 0x05, 0x05, 0x05, 0x01, 0x02, 0x00, 0x05, 0x05, 0x06, 0x01, 0x02,
+	0x00, 0x05, 0x06, 0x06, 0x01, 0x02, 0x00, 0x05, 0x07, 0x05, 0x01, 0x02, 0x00, 0x05, 0x07, 0x06,
+	0x01, 0x02, 0x00, 0x05, 0x08, 0x06, 0x01, 0x02, 0x00, 0x05, 0x09, 0x06, 0x01, 0x02, 0x00, 0x05,
+	0x0A, 0x05, 0x01, 0x02, 0x00, 0x05, 0x0A, 0x06,
+	// @7298 0x6C (5 pixels wide)
+	0x06, 0x00, 0x26, 0x01, 0x00, 0x05,
+	// @7304 0x6D (37 pixels wide)
+	0x12, 0x00, 0x01, 0x03, 0x00, 0x04, 0x04, 0x08, 0x08, 0x08, 0x01, 0x03, 0x00, 0x04, 0x03, 0x0A,
+	0x06, 0x0A, 0x01, 0x03, 0x00, 0x04, 0x02, 0x0C, 0x03, 0x0D, 0x01, 0x03, 0x00, 0x04, 0x01, 0x0E,
+	0x01, 0x0F, 0x01, 0x04, 0x00, 0x08, 0x06, 0x05, 0x01, 0x03, 0x07, 0x05, 0x01, 0x03, 0x00, 0x06,
+	0x09, 0x07, 0x09, 0x05, 0x01, 0x03, 0x00, 0x06, 0x09, 0x06, 0x0A, 0x05, 0x02, 0x03, 0x00, 0x05,
+	0x0B, 0x05, 0x0B, 0x04, 0x01, 0x03, 0x00, 0x04, 0x0C, 0x05, 0x0B, 0x05, 0x10, 0x03, 0x00, 0x04,
+	0x0C, 0x04, 0x0C, 0x05,
+	// @7388 0x6E (22 pixels wide)
+	0x12, 0x00, 0x01, 0x02, 0x00, 0x04, 0x05, 0x07, 0x01, 0x02, 0x00, 0x04, 0x03, 0x0B, 0x01, 0x02,
+	0x00, 0x04, 0x02, 0x0D, 0x01, 0x02, 0x00, 0x04, 0x01, 0x0F, 0x01, 0x02, 0x00, 0x08, 0x06, 0x06,
+	0x01, 0x02, 0x00, 0x07, 0x09, 0x05, 0x01, 0x02, 0x00, 0x06, 0x0A, 0x05, 0x01, 0x02, 0x00, 0x05,
+	0x0C, 0x04, 0x12, 0x02, 0x00, 0x05, 0x0C, 0x05,
+	// @7444 0x6F (25 pixels wide)
+	0x12, 0x00, 0x01, 0x01, 0x08, 0x09, 0x01, 0x01, 0x06, 0x0D, 0x01, 0x01, 0x05, 0x10, 0x01, 0x02,
+	0x04, 0x07, 0x04, 0x07, 0x01, 0x02, 0x03, 0x05, 0x09, 0x06, 0x01, 0x02, 0x02, 0x05, 0x0B, 0x05,
+	0x01, 0x02, 0x01, 0x06, 0x0C, 0x05, 0x01, 0x02, 0x01, 0x05, 0x0D, 0x05, 0x01, 0x02, 0x01, 0x05,
+	0x0E, 0x05, 0x08, 0x02, 0x00, 0x05, 0x0F, 0x05, 0x01, 0x02, 0x01, 0x04, 0x0F, 0x05, 0x02, 0x02,
+	0x01, 0x05, 0x0D, 0x05, 0x01, 0x02, 0x02, 0x05, 0x0B, 0x05, 0x01, 0x02, 0x02, 0x06, 0x09, 0x06,
+	0x01, 0x02, 0x03, 0x07, 0x05, 0x07, 0x01, 0x01, 0x04, 0x11, 0x01, 0x01, 0x05, 0x0F, 0x01, 0x01,
+	0x07, 0x0B,
+	// @7542 0x70 (24 pixels wide)
+	0x12, 0x00, 0x01, 0x02, 0x00, 0x04, 0x05, 0x08, 0x01, 0x02, 0x00, 0x04, 0x03, 0x0C, 0x01, 0x02,
+	0x00, 0x04, 0x02, 0x0E, 0x01, 0x03, 0x00, 0x04, 0x01, 0x06, 0x01, 0x09, 0x01, 0x02, 0x00, 0x08,
+	0x08, 0x06, 0x01, 0x02, 0x00, 0x07, 0x0A, 0x06, 0x01, 0x02, 0x00, 0x06, 0x0C, 0x05, 0x01, 0x02,
+	0x00, 0x05, 0x0D, 0x05, 0x0A, 0x02, 0x00, 0x05, 0x0E, 0x05, 0x01, 0x02, 0x00, 0x05, 0x0D, 0x05,
+	0x01, 0x02, 0x00, 0x06, 0x0C, 0x05, 0x01, 0x02, 0x00, 0x06, 0x0B, 0x06, 0x01, 0x02, 0x00, 0x07,
+	0x09, 0x06, 0x01, 0x02, 0x00, 0x09, 0x05, 0x07, 0x01, 0x01, 0x00, 0x14, 0x01, 0x02, 0x00, 0x05,
+	0x01, 0x0D, 0x01, 0x02, 0x00, 0x05, 0x03, 0x09,
+	// @7646 0x71 (24 pixels wide)
+	0x12, 0x00, 0x01, 0x02, 0x08, 0x08, 0x04, 0x04, 0x01, 0x02, 0x06, 0x0B, 0x03, 0x04, 0x01, 0x02,
+	0x04, 0x0E, 0x02, 0x04, 0x01, 0x03, 0x03, 0x09, 0x01, 0x06, 0x01, 0x04, 0x01, 0x02, 0x03, 0x06,
+	0x07, 0x08, 0x01, 0x02, 0x02, 0x05, 0x0A, 0x07, 0x01, 0x02, 0x01, 0x06, 0x0B, 0x06, 0x02, 0x02,
+	0x01, 0x05, 0x0D, 0x05, 0x09, 0x02, 0x00, 0x05, 0x0E, 0x05, 0x01, 0x02, 0x01, 0x05, 0x0D, 0x05,
+	0x01, 0x02, 0x01, 0x05, 0x0C, 0x06, 0x01, 0x02, 0x02, 0x05, 0x0B, 0x06, 0x01, 0x02, 0x02, 0x06,
+	0x08, 0x08, 0x01, 0x02, 0x03, 0x07, 0x05, 0x09, 0x01, 0x02, 0x04, 0x0E, 0x01, 0x05, 0x01, 0x02,
+	0x05, 0x0C, 0x02, 0x05, 0x01, 0x02, 0x06, 0x0A, 0x03, 0x05,
+	// @7752 0x72 (13 pixels wide)
+	0x12, 0x00, 0x01, 0x02, 0x00, 0x04, 0x04, 0x05, 0x01, 0x02, 0x00, 0x04, 0x03, 0x06, 0x01, 0x02,
+	0x00, 0x04, 0x02, 0x07, 0x01, 0x02, 0x00, 0x04, 0x01, 0x08, 0x01, 0x01, 0x00, 0x09, 0x01, 0x01,
+	0x00, 0x07, 0x02, 0x01, 0x00, 0x06, 0x12, 0x01, 0x00, 0x05,
+	// @7794 0x73 (17 pixels wide)
+	0x12, 0x00, 0x01, 0x01, 0x06, 0x08, 0x01, 0x01, 0x04, 0x0C, 0x01, 0x01, 0x03, 0x0D, 0x01, 0x02,
+	0x02, 0x06, 0x04, 0x03, 0x01, 0x02, 0x01, 0x05, 0x08, 0x01, 0x01, 0x01, 0x01, 0x05, 0x02, 0x01,
+	0x01, 0x04, 0x01, 0x01, 0x01, 0x05, 0x01, 0x01, 0x01, 0x06, 0x01, 0x01, 0x02, 0x07, 0x01, 0x01,
+	0x03, 0x08, 0x01, 0x01, 0x04, 0x09, 0x01, 0x01, 0x05, 0x09, 0x01, 0x01, 0x07, 0x08, 0x01, 0x01,
+	0x0A, 0x06, 0x01, 0x01, 0x0B, 0x05, 0x04, 0x01, 0x0C, 0x05, 0x01, 0x02, 0x01, 0x01, 0x0A, 0x04,
+	0x01, 0x02, 0x01, 0x03, 0x06, 0x06, 0x01, 0x01, 0x01, 0x0E, 0x01, 0x01, 0x00, 0x0E, 0x01, 0x01,
+	0x02, 0x0B,
+	// @7892 0x74 (15 pixels wide)
+	0x0C, 0x00, 0x01, 0x01, 0x08, 0x01, 0x05, 0x01, 0x04, 0x05, 0x04, 0x01, 0x00, 0x0F, 0x12, 0x01,
+	0x04, 0x05, 0x01, 0x02, 0x05, 0x06, 0x03, 0x01, 0x01, 0x01, 0x05, 0x0A, 0x01, 0x01, 0x06, 0x09,
+	0x01, 0x01, 0x07, 0x08,
+	// @7928 0x75 (22 pixels wide)
+	0x12, 0x00, 0x11, 0x02, 0x00, 0x04, 0x0D, 0x04, 0x01, 0x02, 0x00, 0x05, 0x0C, 0x04, 0x02, 0x02,
+	0x00, 0x05, 0x0B, 0x05, 0x01, 0x02, 0x00, 0x06, 0x09, 0x06, 0x01, 0x02, 0x01, 0x06, 0x07, 0x07,
+	0x01, 0x02, 0x01, 0x07, 0x04, 0x09, 0x01, 0x02, 0x02, 0x0E, 0x01, 0x04, 0x01, 0x02, 0x03, 0x0C,
+	0x02, 0x04, 0x01, 0x02, 0x04, 0x09, 0x04, 0x05,
+	// @7984 0x76 (24 pixels wide)
+	0x12, 0x00, 0x02, 0x02, 0x00, 0x05, 0x0E, 0x05, 0x01, 0x02, 0x01, 0x04, 0x0D, 0x05, 0x01, 0x02,
+	0x01, 0x05, 0x0C, 0x05, 0x01, 0x02, 0x01, 0x05, 0x0C, 0x04, 0x01, 0x02, 0x02, 0x04, 0x0B, 0x05,
+	0x01, 0x02, 0x02, 0x05, 0x0A, 0x05, 0x01, 0x02, 0x02, 0x05, 0x0A, 0x04, 0x01, 0x02, 0x03, 0x05,
+	0x08, 0x05, 0x01, 0x02, 0x03, 0x05, 0x08, 0x04, 0x01, 0x02, 0x04, 0x04, 0x08, 0x04, 0x01, 0x02,
+	0x04, 0x05, 0x06, 0x05, 0x01, 0x02, 0x04, 0x05, 0x06, 0x04, 0x01, 0x02, 0x05, 0x04, 0x06, 0x04,
+	0x02, 0x02, 0x05, 0x05, 0x04, 0x04, 0x01, 0x02, 0x06, 0x04, 0x03, 0x05, 0x01, 0x02, 0x06, 0x05,
+	0x02, 0x04, 0x01, 0x02, 0x07, 0x04, 0x02, 0x04, 0x01, 0x02, 0x07, 0x04, 0x01, 0x04, 0x01, 0x01,
+	0x07, 0x09, 0x01, 0x01, 0x08, 0x08, 0x02, 0x01, 0x08, 0x07, 0x02, 0x01, 0x09, 0x05,
+	// @8110 0x77 (37 pixels wide)
+	0x12, 0x00, 0x01, 0x03, 0x00, 0x05, 0x0C, 0x04, 0x0C, 0x04, 0x01, 0x03, 0x00, 0x05, 0x0B, 0x05,
+	0x0B, 0x05, 0x01, 0x03, 0x01, 0x04, 0x0B, 0x05, 0x0B, 0x05, 0x01, 0x03, 0x01, 0x05, 0x0A, 0x06,
+	0x0A, 0x04, 0x01, 0x03, 0x01, 0x05, 0x09, 0x07, 0x09, 0x05, 0x01, 0x04, 0x02, 0x04, 0x09, 0x03,
+	0x01, 0x03, 0x09, 0x05, 0x01, 0x04, 0x02, 0x04, 0x09, 0x03, 0x01, 0x03, 0x09, 0x04, 0x01, 0x04,
+	0x02, 0x05, 0x07, 0x04, 0x01, 0x04, 0x08, 0x04, 0x01, 0x04, 0x02, 0x05, 0x07, 0x04, 0x01, 0x04,
+	0x07, 0x05, 0x01, 0x04, 0x03, 0x04, 0x07, 0x03, 0x03, 0x03, 0x07, 0x04, 0x01, 0x04, 0x03, 0x04,
+	0x06, 0x04, 0x03, 0x04, 0x06, 0x04, 0x01, 0x04, 0x03, 0x05, 0x05, 0x04, 0x03, 0x04, 0x05, 0x05,
+	0x01, 0x04, 0x04, 0x04, 0x05, 0x03, 0x04, 0x04, 0x05, 0x04, 0x02, 0x04, 0x04, 0x04, 0x04, 0x04,
+	0x05, 0x04, 0x04, 0x04, 0x01, 0x04, 0x05, 0x04, 0x03, 0x03, 0x06, 0x04, 0x03, 0x04, 0x01, 0x04,
+	0x05, 0x04, 0x03, 0x03, 0x07, 0x04, 0x02, 0x04, 0x01, 0x04, 0x05, 0x04, 0x02, 0x04, 0x07, 0x04,
+	0x02, 0x04, 0x01, 0x04, 0x05, 0x04, 0x02, 0x03, 0x08, 0x04, 0x02, 0x03, 0x01, 0x04, 0x06, 0x04,
+	0x01, 0x03, 0x09, 0x03, 0x01, 0x04, 0x01, 0x02, 0x06, 0x08, 0x09, 0x08, 0x01, 0x02, 0x06, 0x07,
+	0x0A, 0x07, 0x02, 0x02, 0x07, 0x06, 0x0B, 0x06, 0x01, 0x02, 0x07, 0x05, 0x0C, 0x05, 0x01, 0x02,
+	0x08, 0x04, 0x0D, 0x04,
+	// @8322 0x78 (23 pixels wide)
+	0x12, 0x00, 0x01, 0x02, 0x00, 0x05, 0x0D, 0x05, 0x01, 0x02, 0x01, 0x05, 0x0B, 0x05, 0x01, 0x02,
+	0x01, 0x05, 0x0A, 0x05, 0x01, 0x02, 0x02, 0x05, 0x09, 0x04, 0x01, 0x02, 0x03, 0x05, 0x07, 0x05,
+	0x01, 0x02, 0x03, 0x05, 0x06, 0x05, 0x01, 0x02, 0x04, 0x05, 0x05, 0x04, 0x01, 0x02, 0x05, 0x05,
+	0x03, 0x05, 0x01, 0x02, 0x05, 0x05, 0x02, 0x05, 0x01, 0x02, 0x06, 0x05, 0x01, 0x04, 0x01, 0x01,
+	0x07, 0x09, 0x01, 0x01, 0x08, 0x07, 0x02, 0x01, 0x08, 0x06, 0x01, 0x01, 0x07, 0x08, 0x01, 0x01,
+	0x07, 0x09, 0x01, 0x02, 0x06, 0x05, 0x01, 0x04, 0x01, 0x02, 0x05, 0x05, 0x02, 0x05, 0x01, 0x02,
+	0x05, 0x04, 0x04, 0x05, 0x01, 0x02, 0x04, 0x05, 0x04, 0x06, 0x01, 0x02, 0x03, 0x05, 0x06, 0x05,
+	0x01, 0x02, 0x03, 0x04, 0x08, 0x05, 0x01, 0x02, 0x02, 0x05, 0x08, 0x06, 0x01, 0x02, 0x01, 0x05,
+	0x0A, 0x05, 0x01, 0x02, 0x00, 0x06, 0x0B, 0x05, 0x01, 0x02, 0x00, 0x05, 0x0C, 0x06,
+	// @8464 0x79 (24 pixels wide)
+	0x12, 0x00, 0x01, 0x02, 0x00, 0x05, 0x0E, 0x05, 0x02, 0x02, 0x00, 0x05, 0x0D, 0x05, 0x01, 0x02,
+	0x01, 0x05, 0x0C, 0x04, 0x01, 0x02, 0x01, 0x05, 0x0B, 0x05, 0x01, 0x02, 0x02, 0x04, 0x0B, 0x05,
+	0x01, 0x02, 0x02, 0x05, 0x0A, 0x04, 0x01, 0x02, 0x02, 0x05, 0x09, 0x05, 0x02, 0x02, 0x03, 0x05,
+	0x08, 0x04, 0x01, 0x02, 0x04, 0x04, 0x07, 0x05, 0x02, 0x02, 0x04, 0x05, 0x06, 0x04, 0x01, 0x02,
+	0x05, 0x04, 0x05, 0x05, 0x01, 0x02, 0x05, 0x05, 0x04, 0x04, 0x01, 0x02, 0x06, 0x04, 0x04, 0x04,
+	0x01, 0x02, 0x06, 0x04, 0x03, 0x04, 0x01, 0x02, 0x06, 0x05, 0x02, 0x04, 0x01, 0x02, 0x07, 0x04,
+	0x02, 0x04, 0x01, 0x02, 0x07, 0x04, 0x01, 0x04, 0x01, 0x01, 0x08, 0x08, 0x02, 0x01, 0x08, 0x07,
+	0x01, 0x01, 0x09, 0x06, 0x02, 0x01, 0x09, 0x05,
+	// @8584 0x7A (21 pixels wide)
+	0x12, 0x00, 0x03, 0x01, 0x01, 0x14, 0x01, 0x01, 0x01, 0x13, 0x01, 0x01, 0x0F, 0x05, 0x01, 0x01,
+	0x0E, 0x05, 0x01, 0x01, 0x0D, 0x05, 0x01, 0x01, 0x0C, 0x05, 0x01, 0x01, 0x0B, 0x06, 0x01, 0x01,
+	0x0B, 0x05, 0x01, 0x01, 0x0A, 0x05, 0x01, 0x01, 0x09, 0x05, 0x01, 0x01, 0x08, 0x05, 0x01, 0x01,
+	0x07, 0x06, 0x01, 0x01, 0x07, 0x05, 0x01, 0x01, 0x06, 0x05, 0x01, 0x01, 0x05, 0x05, 0x01, 0x01,
+	0x04, 0x06, 0x01, 0x01, 0x04, 0x05, 0x01, 0x01, 0x03, 0x05, 0x01, 0x01, 0x02, 0x05, 0x01, 0x01,
+	0x01, 0x05, 0x01, 0x01, 0x01, 0x14, 0x03, 0x01, 0x00, 0x15,
+	// @8674 0x7B (13 pixels wide)
+	0x08, 0x00, 0x01, 0x01, 0x07, 0x06, 0x01, 0x01, 0x06, 0x07, 0x01, 0x01, 0x05, 0x08, 0x01, 0x01,
+	0x04, 0x05, 0x08, 0x01, 0x04, 0x04, 0x05, 0x01, 0x05, 0x03, 0x02, 0x01, 0x04, 0x04, 0x01, 0x01,
+	0x00, 0x07, 0x01, 0x01, 0x00, 0x05, 0x01, 0x01, 0x00, 0x06, 0x01, 0x01, 0x03, 0x04, 0x01, 0x01,
+	0x04, 0x04, 0x05, 0x01, 0x05, 0x03, 0x07, 0x01, 0x04, 0x04,
+	// @8732 0x7C (3 pixels wide)
+	0x04, 0x00, 0x28, 0x01, 0x00, 0x03,
+	// @8738 0x7D (13 pixels wide)
+	0x08, 0x00, 0x01, 0x01, 0x00, 0x06, 0x01, 0x01, 0x00, 0x07, 0x01, 0x01, 0x00, 0x08, 0x01, 0x01,
+	0x04, 0x05, 0x08, 0x01, 0x05, 0x04, 0x05, 0x01, 0x05, 0x03, 0x02, 0x01, 0x05, 0x04, 0x01, 0x01,
+	0x06, 0x07, 0x01, 0x01, 0x08, 0x05, 0x01, 0x01, 0x07, 0x06, 0x01, 0x01, 0x06, 0x04, 0x01, 0x01,
+	0x05, 0x04, 0x05, 0x01, 0x05, 0x03, 0x07, 0x01, 0x05, 0x04,
+	// @8796 0x7E (26 pixels wide)
+	0x19, 0x00, 0x01, 0x02, 0x03, 0x06, 0x0E, 0x03, 0x01, 0x02, 0x02, 0x0A, 0x0B, 0x03, 0x01, 0x02,
+	0x01, 0x0D, 0x09, 0x03, 0x01, 0x03, 0x00, 0x05, 0x02, 0x09, 0x06, 0x04, 0x01, 0x02, 0x00, 0x04,
+	0x06, 0x0F, 0x01, 0x02, 0x00, 0x03, 0x09, 0x0D, 0x01, 0x02, 0x00, 0x03, 0x0B, 0x0A, 0x01, 0x02,
+	0x00, 0x03, 0x0E, 0x06, 0x0B, 0x00,
+	// @8850 0x7F (2 pixels wide)
+	0x2C, 0x00,
+	// @8852 0x80 (2 pixels wide)
+	0x2C, 0x00,
+	// @8854 0x81 (2 pixels wide)
+	0x2C, 0x00,
+	// @8856 0x82 (7 pixels wide)
+	0x29, 0x00, 0x01, 0x01, 0x01, 0x04, 0x01, 0x01, 0x00, 0x06, 0x01, 0x01, 0x00, 0x07,
+	// @8870 0x83 (27 pixels wide)
+	0x05, 0x00, 0x01, 0x01, 0x13, 0x06, 0x01, 0x02, 0x12, 0x02, 0x03, 0x03, 0x01, 0x02, 0x11, 0x02,
+	0x04, 0x03, 0x01, 0x02, 0x10, 0x03, 0x04, 0x04, 0x01, 0x02, 0x10, 0x02, 0x05, 0x04, 0x01, 0x02,
+	0x0F, 0x03, 0x05, 0x03, 0x01, 0x01, 0x0F, 0x03, 0x01, 0x01, 0x0E, 0x04, 0x03, 0x01, 0x0E, 0x03,
+	0x05, 0x01, 0x0D, 0x04, 0x01, 0x01, 0x0D, 0x03, 0x01, 0x01, 0x06, 0x11, 0x06, 0x01, 0x0C, 0x04,
+	0x08, 0x01, 0x0B, 0x04, 0x06, 0x01, 0x0A, 0x04, 0x01, 0x01, 0x0A, 0x03,
+	// @8946 0x84 (18 pixels wide)
+	0x28, 0x00, 0x01, 0x02, 0x01, 0x05, 0x06, 0x04, 0x01, 0x02, 0x01, 0x05, 0x05, 0x06, 0x02, 0x02,
+	0x00, 0x07, 0x04, 0x07,
+	// @8966 0x85 (2 pixels wide)
+	0x2C, 0x00,
+	// @8968 0x86 (21 pixels wide)
+	0x04, 0x00, 0x01, 0x01, 0x09, 0x03, 0x02, 0x01, 0x08, 0x05, 0x01, 0x01, 0x09, 0x04, 0x02, 0x01,
+	0x09, 0x03, 0x01, 0x01, 0x0A, 0x02, 0x04, 0x01, 0x0A, 0x01, 0x01, 0x03, 0x01, 0x03, 0x06, 0x01,
+	0x07, 0x02, 0x01, 0x03, 0x00, 0x06, 0x04, 0x01, 0x04, 0x06, 0x01, 0x01, 0x00, 0x15, 0x01, 0x03,
+	0x00, 0x07, 0x03, 0x01, 0x04, 0x06, 0x01, 0x03, 0x01, 0x03, 0x06, 0x01, 0x06, 0x03, 0x05, 0x01,
+	0x0A, 0x01, 0x01, 0x01, 0x0A, 0x02, 0x02, 0x01, 0x09, 0x03, 0x01, 0x01, 0x09, 0x04, 0x02, 0x01,
+	0x08, 0x05, 0x01, 0x01, 0x09, 0x04, 0x03, 0x01, 0x09, 0x03, 0x02, 0x01, 0x0A, 0x02, 0x07, 0x01,
+	0x0A, 0x01,
+	// @9066 0x87 (21 pixels wide)
+	0x04, 0x00, 0x01, 0x01, 0x09, 0x03, 0x02, 0x01, 0x08, 0x05, 0x01, 0x01, 0x09, 0x04, 0x02, 0x01,
+	0x09, 0x03, 0x01, 0x01, 0x0A, 0x02, 0x04, 0x01, 0x0A, 0x01, 0x01, 0x03, 0x01, 0x03, 0x06, 0x01,
+	0x07, 0x02, 0x01, 0x03, 0x00, 0x06, 0x04, 0x01, 0x04, 0x06, 0x01, 0x01, 0x00, 0x15, 0x01, 0x03,
+	0x00, 0x07, 0x03, 0x01, 0x04, 0x06, 0x01, 0x03, 0x01, 0x03, 0x06, 0x01, 0x06, 0x03, 0x06, 0x01,
+	0x0A, 0x01, 0x02, 0x01, 0x09, 0x03, 0x01, 0x01, 0x09, 0x04, 0x01, 0x01, 0x08, 0x05, 0x02, 0x01,
+	0x09, 0x03, 0x06, 0x01, 0x0A, 0x01, 0x01, 0x03, 0x01, 0x02, 0x07, 0x01, 0x07, 0x02, 0x01, 0x03,
+	0x00, 0x06, 0x04, 0x01, 0x05, 0x05, 0x01, 0x01, 0x00, 0x15, 0x01, 0x03, 0x00, 0x07, 0x03, 0x01,
+	0x04, 0x06, 0x01, 0x03, 0x01, 0x04, 0x05, 0x01, 0x06, 0x04, 0x01, 0x01, 0x0A, 0x01,
+	// @9192 0x88 (17 pixels wide)
+	0x01, 0x01, 0x04, 0x09, 0x01, 0x02, 0x03, 0x05, 0x01, 0x05, 0x01, 0x02, 0x02, 0x04, 0x05, 0x04,
+	0x01, 0x02, 0x00, 0x04, 0x09, 0x04, 0x28, 0x00,
+	// @9216 0x89 (44 pixels wide)
+	0x05, 0x00, 0x01, 0x02, 0x08, 0x03, 0x0B, 0x02, 0x01, 0x02, 0x06, 0x07, 0x08, 0x02, 0x01, 0x03,
+	0x05, 0x04, 0x02, 0x03, 0x06, 0x03, 0x01, 0x02, 0x04, 0x04, 0x03, 0x0C, 0x01, 0x04, 0x04, 0x03,
+	0x06, 0x01, 0x01, 0x03, 0x02, 0x02, 0x01, 0x03, 0x03, 0x03, 0x07, 0x01, 0x06, 0x02, 0x01, 0x03,
+	0x03, 0x03, 0x07, 0x01, 0x06, 0x01, 0x01, 0x03, 0x02, 0x04, 0x07, 0x01, 0x05, 0x02, 0x01, 0x03,
+	0x02, 0x03, 0x08, 0x01, 0x05, 0x02, 0x01, 0x03, 0x01, 0x04, 0x08, 0x01, 0x04, 0x02, 0x02, 0x03,
+	0x01, 0x03, 0x09, 0x01, 0x04, 0x02, 0x01, 0x03, 0x01, 0x03, 0x09, 0x01, 0x03, 0x02, 0x01, 0x03,
+	0x01, 0x03, 0x08, 0x02, 0x03, 0x02, 0x01, 0x03, 0x00, 0x04, 0x08, 0x01, 0x04, 0x01, 0x01, 0x03,
+	0x00, 0x03, 0x09, 0x01, 0x03, 0x02, 0x01, 0x03, 0x00, 0x03, 0x08, 0x02, 0x03, 0x02, 0x01, 0x03,
+	0x01, 0x02, 0x08, 0x01, 0x03, 0x02, 0x01, 0x03, 0x01, 0x02, 0x07, 0x02, 0x03, 0x02, 0x01, 0x04,
+	0x01, 0x03, 0x06, 0x01, 0x04, 0x01, 0x07, 0x02, 0x01, 0x05, 0x01, 0x03, 0x05, 0x02, 0x03, 0x02,
+	0x04, 0x07, 0x0A, 0x05, 0x01, 0x07, 0x02, 0x04, 0x01, 0x03, 0x04, 0x02, 0x03, 0x04, 0x03, 0x02,
+	0x07, 0x04, 0x02, 0x02, 0x01, 0x06, 0x03, 0x06, 0x04, 0x02, 0x03, 0x04, 0x04, 0x02, 0x06, 0x04,
+	0x04, 0x02, 0x01, 0x06, 0x04, 0x03, 0x06, 0x02, 0x03, 0x03, 0x06, 0x01, 0x06, 0x03, 0x05, 0x02,
+	0x01, 0x05, 0x0D, 0x01, 0x03, 0x03, 0x07, 0x01, 0x05, 0x03, 0x07, 0x01, 0x01, 0x05, 0x0C, 0x02,
+	0x03, 0x03, 0x07, 0x01, 0x04, 0x04, 0x07, 0x01, 0x01, 0x05, 0x0C, 0x02, 0x02, 0x03, 0x08, 0x01,
+	0x04, 0x03, 0x08, 0x01, 0x01, 0x05, 0x0B, 0x02, 0x03, 0x03, 0x08, 0x01, 0x03, 0x04, 0x08, 0x01,
+	0x01, 0x05, 0x0B, 0x02, 0x02, 0x04, 0x08, 0x01, 0x03, 0x03, 0x09, 0x01, 0x01, 0x05, 0x0B, 0x01,
+	0x03, 0x03, 0x09, 0x01, 0x03, 0x03, 0x09, 0x01, 0x01, 0x05, 0x0A, 0x02, 0x03, 0x03, 0x09, 0x01,
+	0x02, 0x04, 0x08, 0x02, 0x01, 0x05, 0x0A, 0x02, 0x03, 0x03, 0x08, 0x02, 0x02, 0x04, 0x08, 0x02,
+	0x01, 0x05, 0x09, 0x02, 0x03, 0x04, 0x08, 0x02, 0x02, 0x03, 0x09, 0x01, 0x01, 0x05, 0x09, 0x02,
+	0x03, 0x03, 0x09, 0x01, 0x03, 0x03, 0x09, 0x01, 0x01, 0x05, 0x09, 0x02, 0x03, 0x03, 0x09, 0x01,
+	0x03, 0x03, 0x08, 0x02, 0x01, 0x05, 0x08, 0x02, 0x04, 0x03, 0x08, 0x02, 0x03, 0x03, 0x08, 0x01,
+	0x01, 0x05, 0x08, 0x02, 0x05, 0x02, 0x08, 0x01, 0x04, 0x03, 0x08, 0x01, 0x01, 0x05, 0x08, 0x01,
+	0x06, 0x02, 0x07, 0x02, 0x04, 0x03, 0x07, 0x02, 0x01, 0x05, 0x07, 0x02, 0x06, 0x03, 0x06, 0x01,
+	0x06, 0x02, 0x06, 0x02,
+	// @9604 0x8A (24 pixels wide)
+	0x01, 0x02, 0x05, 0x04, 0x06, 0x04, 0x01, 0x02, 0x06, 0x05, 0x02, 0x05, 0x01, 0x01, 0x08, 0x08,
+	0x01, 0x01, 0x09, 0x06, 0x03, 0x00, 0x01, 0x02, 0x07, 0x08, 0x05, 0x02, 0x01, 0x03, 0x05, 0x04,
+	0x05, 0x04, 0x02, 0x02, 0x01, 0x02, 0x04, 0x03, 0x09, 0x06, 0x01, 0x02, 0x03, 0x03, 0x0B, 0x05,
+	0x01, 0x02, 0x03, 0x02, 0x0D, 0x04, 0x02, 0x02, 0x02, 0x03, 0x0E, 0x03, 0x01, 0x02, 0x02, 0x03,
+	0x0F, 0x02, 0x01, 0x02, 0x01, 0x04, 0x0F, 0x03, 0x02, 0x02, 0x01, 0x04, 0x10, 0x02, 0x01, 0x02,
+	0x01, 0x05, 0x0F, 0x02, 0x01, 0x01, 0x02, 0x04, 0x01, 0x01, 0x02, 0x05, 0x01, 0x01, 0x02, 0x06,
+	0x01, 0x01, 0x03, 0x06, 0x01, 0x01, 0x04, 0x07, 0x01, 0x01, 0x04, 0x08, 0x01, 0x01, 0x06, 0x08,
+	0x01, 0x01, 0x07, 0x08, 0x01, 0x01, 0x08, 0x08, 0x01, 0x01, 0x0A, 0x08, 0x01, 0x01, 0x0B, 0x08,
+	0x01, 0x01, 0x0D, 0x07, 0x01, 0x01, 0x0E, 0x07, 0x01, 0x01, 0x0F, 0x07, 0x01, 0x01, 0x10, 0x07,
+	0x01, 0x01, 0x11, 0x06, 0x01, 0x01, 0x12, 0x06, 0x01, 0x01, 0x13, 0x05, 0x01, 0x02, 0x00, 0x01,
+	0x13, 0x04, 0x03, 0x02, 0x00, 0x02, 0x12, 0x04, 0x02, 0x02, 0x00, 0x03, 0x11, 0x04, 0x01, 0x02,
+	0x01, 0x03, 0x10, 0x03,
+	// @9784 0x8B (12 pixels wide)
+	0x15, 0x00, 0x02, 0x01, 0x0B, 0x01, 0x01, 0x01, 0x0A, 0x01, 0x01, 0x01, 0x09, 0x02, 0x01, 0x01,
+	0x08, 0x02, 0x01, 0x01, 0x07, 0x02, 0x01, 0x01, 0x06, 0x03, 0x01, 0x01, 0x05, 0x03, 0x01, 0x01,
+	0x04, 0x03, 0x01, 0x01, 0x03, 0x04, 0x01, 0x01, 0x02, 0x04, 0x01, 0x01, 0x01, 0x04, 0x01, 0x01,
+	0x00, 0x05, 0x01, 0x01, 0x02, 0x04, 0x01, 0x01, 0x03, 0x03, 0x01, 0x01, 0x04, 0x03, 0x01, 0x01,
+	0x05, 0x03, 0x01, 0x01, 0x06, 0x02, 0x01, 0x01, 0x07, 0x02, 0x01, 0x01, 0x07, 0x03, 0x01, 0x01,
+	0x08, 0x02, 0x01, 0x01, 0x09, 0x02, 0x01, 0x01, 0x0A, 0x02,
+	// @9874 0x8C (52 pixels wide)
+	0x06, 0x00, 0x01, 0x01, 0x0D, 0x07, 0x01, 0x01, 0x0A, 0x27, 0x01, 0x02, 0x08, 0x05, 0x08, 0x1C,
+	0x01, 0x03, 0x07, 0x03, 0x0D, 0x06, 0x10, 0x04, 0x01, 0x03, 0x05, 0x03, 0x10, 0x05, 0x12, 0x02,
+	0x01, 0x03, 0x05, 0x02, 0x12, 0x04, 0x12, 0x02, 0x01, 0x03, 0x04, 0x02, 0x14, 0x03, 0x13, 0x01,
+	0x01, 0x03, 0x03, 0x03, 0x14, 0x03, 0x13, 0x01, 0x01, 0x03, 0x03, 0x02, 0x15, 0x03, 0x13, 0x01,
+	0x01, 0x03, 0x02, 0x03, 0x15, 0x03, 0x13, 0x01, 0x01, 0x02, 0x02, 0x03, 0x15, 0x03, 0x03, 0x02,
+	0x01, 0x03, 0x16, 0x03, 0x02, 0x03, 0x00, 0x04, 0x16, 0x03, 0x10, 0x01, 0x02, 0x03, 0x00, 0x04,
+	0x16, 0x03, 0x0F, 0x02, 0x01, 0x03, 0x00, 0x04, 0x16, 0x03, 0x0E, 0x03, 0x01, 0x03, 0x00, 0x04,
+	0x16, 0x06, 0x08, 0x06, 0x02, 0x02, 0x00, 0x04, 0x16, 0x14, 0x01, 0x03, 0x00, 0x04, 0x16, 0x03,
+	0x0E, 0x03, 0x02, 0x03, 0x00, 0x04, 0x16, 0x03, 0x0F, 0x02, 0x03, 0x03, 0x00, 0x04, 0x16, 0x03,
+	0x10, 0x01, 0x02, 0x02, 0x00, 0x04, 0x16, 0x03, 0x03, 0x02, 0x01, 0x04, 0x15, 0x03, 0x01, 0x03,
+	0x01, 0x05, 0x14, 0x03, 0x16, 0x01, 0x01, 0x03, 0x02, 0x04, 0x14, 0x03, 0x15, 0x02, 0x01, 0x03,
+	0x02, 0x05, 0x13, 0x03, 0x15, 0x01, 0x01, 0x03, 0x03, 0x05, 0x12, 0x03, 0x14, 0x02, 0x01, 0x03,
+	0x04, 0x05, 0x11, 0x03, 0x13, 0x03,
+	// @10072 0x8D (2 pixels wide)
+	0x2C, 0x00,
+	// @10074 0x8E (2 pixels wide)
+	0x2C, 0x00,
+	// @10076 0x8F (2 pixels wide)
+	0x2C, 0x00,
+	// @10078 0x90 (2 pixels wide)
+	0x2C, 0x00,
+	// @10080 0x91 (7 pixels wide)
+	0x05, 0x00, 0x01, 0x01, 0x05, 0x01, 0x01, 0x01, 0x04, 0x01, 0x01, 0x01, 0x03, 0x01, 0x01, 0x01,
+	0x02, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x02, 0x01, 0x01, 0x00, 0x01, 0x01, 0x01,
+	0x00, 0x02, 0x01, 0x01, 0x00, 0x06, 0x02, 0x01, 0x00, 0x07, 0x02, 0x01, 0x01, 0x06, 0x01, 0x01,
+	0x02, 0x04, 0x18, 0x00,
+	// @10132 0x92 (7 pixels wide)
+	0x05, 0x00, 0x01, 0x01, 0x01, 0x04, 0x01, 0x01, 0x00, 0x06, 0x03, 0x01, 0x00, 0x07, 0x01, 0x01,
+	0x01, 0x06, 0x01, 0x01, 0x05, 0x02, 0x01, 0x01, 0x06, 0x01, 0x01, 0x01, 0x05, 0x02, 0x02, 0x01,
+	0x05, 0x01, 0x01, 0x01, 0x04, 0x01, 0x01, 0x01, 0x03, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x18, 0x00,
+	// @10184 0x93 (20 pixels wide)
+	0x05, 0x00, 0x01, 0x02, 0x05, 0x01, 0x0C, 0x01, 0x01, 0x02, 0x04, 0x01, 0x0C, 0x01, 0x01, 0x02,
+	0x03, 0x01, 0x0C, 0x01, 0x01, 0x02, 0x02, 0x01, 0x0C, 0x01, 0x02, 0x02, 0x01, 0x01, 0x0C, 0x01,
+	0x01, 0x02, 0x00, 0x02, 0x0B, 0x02, 0x01, 0x02, 0x00, 0x01, 0x0C, 0x02, 0x01, 0x02, 0x00, 0x02,
+	0x0B, 0x02, 0x01, 0x02, 0x00, 0x06, 0x07, 0x07, 0x02, 0x02, 0x00, 0x07, 0x06, 0x07, 0x02, 0x02,
+	0x01, 0x06, 0x07, 0x06, 0x01, 0x02, 0x02, 0x04, 0x09, 0x04, 0x18, 0x00,
+	// @10260 0x94 (20 pixels wide)
+	0x05, 0x00, 0x01, 0x02, 0x01, 0x04, 0x09, 0x04, 0x01, 0x02, 0x00, 0x06, 0x07, 0x06, 0x03, 0x02,
+	0x00, 0x07, 0x06, 0x07, 0x01, 0x02, 0x01, 0x06, 0x07, 0x06, 0x01, 0x02, 0x05, 0x02, 0x0C, 0x01,
+	0x01, 0x02, 0x06, 0x01, 0x0C, 0x01, 0x01, 0x02, 0x05, 0x02, 0x0C, 0x01, 0x02, 0x02, 0x05, 0x01,
+	0x0C, 0x01, 0x01, 0x02, 0x04, 0x01, 0x0C, 0x01, 0x01, 0x02, 0x03, 0x01, 0x0C, 0x01, 0x01, 0x02,
+	0x02, 0x01, 0x0C, 0x01, 0x01, 0x02, 0x01, 0x01, 0x0C, 0x01, 0x18, 0x00,
+	// @10336 0x95 (2 pixels wide)
+	0x2C, 0x00,
+	// @10338 0x96 (18 pixels wide)
+	0x19, 0x00, 0x02, 0x01, 0x00, 0x12, 0x11, 0x00,
+	// @10346 0x97 (52 pixels wide)
+	0x19, 0x00, 0x03, 0x01, 0x00, 0x34, 0x10, 0x00,
+	// @10354 0x98 (16 pixels wide)
+	0x01, 0x02, 0x03, 0x02, 0x09, 0x01, 0x01, 0x02, 0x01, 0x06, 0x07, 0x01, 0x01, 0x02, 0x01, 0x08,
+	0x04, 0x03, 0x01, 0x02, 0x00, 0x02, 0x04, 0x09, 0x01, 0x02, 0x00, 0x01, 0x07, 0x06, 0x01, 0x02,
+	0x00, 0x01, 0x09, 0x03, 0x26, 0x00,
+	// @10392 0x99 (50 pixels wide)
+	0x06, 0x00, 0x01, 0x03, 0x00, 0x12, 0x03, 0x06, 0x11, 0x06, 0x01, 0x05, 0x00, 0x02, 0x06, 0x02,
+	0x05, 0x03, 0x06, 0x04, 0x10, 0x04, 0x01, 0x05, 0x00, 0x01, 0x07, 0x02, 0x06, 0x02, 0x06, 0x04,
+	0x0F, 0x04, 0x01, 0x05, 0x00, 0x01, 0x07, 0x02, 0x07, 0x01, 0x06, 0x05, 0x0E, 0x04, 0x01, 0x05,
+	0x00, 0x01, 0x07, 0x02, 0x07, 0x01, 0x06, 0x05, 0x0D, 0x05, 0x01, 0x05, 0x08, 0x02, 0x0E, 0x02,
+	0x01, 0x02, 0x0D, 0x01, 0x01, 0x03, 0x01, 0x05, 0x08, 0x02, 0x0E, 0x02, 0x01, 0x03, 0x0B, 0x02,
+	0x01, 0x03, 0x01, 0x05, 0x08, 0x02, 0x0E, 0x02, 0x02, 0x02, 0x0B, 0x01, 0x02, 0x03, 0x01, 0x05,
+	0x08, 0x02, 0x0E, 0x02, 0x02, 0x03, 0x0A, 0x01, 0x02, 0x03, 0x01, 0x05, 0x08, 0x02, 0x0E, 0x02,
+	0x02, 0x03, 0x09, 0x02, 0x02, 0x03, 0x01, 0x05, 0x08, 0x02, 0x0E, 0x02, 0x03, 0x03, 0x08, 0x01,
+	0x03, 0x03, 0x01, 0x05, 0x08, 0x02, 0x0E, 0x02, 0x03, 0x03, 0x07, 0x02, 0x03, 0x03, 0x01, 0x05,
+	0x08, 0x02, 0x0E, 0x02, 0x04, 0x02, 0x07, 0x01, 0x04, 0x03, 0x02, 0x05, 0x08, 0x02, 0x0E, 0x02,
+	0x04, 0x03, 0x05, 0x02, 0x04, 0x03, 0x01, 0x05, 0x08, 0x02, 0x0E, 0x02, 0x05, 0x03, 0x04, 0x01,
+	0x05, 0x03, 0x01, 0x05, 0x08, 0x02, 0x0E, 0x02, 0x05, 0x03, 0x03, 0x02, 0x05, 0x03, 0x01, 0x05,
+	0x08, 0x02, 0x0E, 0x02, 0x06, 0x03, 0x02, 0x01, 0x06, 0x03, 0x01, 0x05, 0x08, 0x02, 0x0E, 0x02,
+	0x06, 0x03, 0x01, 0x02, 0x06, 0x03, 0x03, 0x04, 0x08, 0x02, 0x0E, 0x02, 0x07, 0x04, 0x07, 0x03,
+	0x01, 0x04, 0x08, 0x02, 0x0E, 0x02, 0x08, 0x02, 0x08, 0x03, 0x01, 0x04, 0x07, 0x04, 0x0C, 0x04,
+	0x07, 0x02, 0x07, 0x05, 0x01, 0x04, 0x05, 0x08, 0x09, 0x07, 0x05, 0x01, 0x06, 0x09, 0x0D, 0x00,
+	// @10648 0x9A (17 pixels wide)
+	0x0B, 0x00, 0x01, 0x02, 0x00, 0x03, 0x0B, 0x03, 0x01, 0x02, 0x01, 0x04, 0x07, 0x04, 0x01, 0x02,
+	0x02, 0x05, 0x03, 0x05, 0x01, 0x02, 0x04, 0x04, 0x01, 0x04, 0x01, 0x01, 0x05, 0x07, 0x01, 0x01,
+	0x06, 0x05, 0x03, 0x00, 0x01, 0x01, 0x07, 0x02, 0x01, 0x02, 0x04, 0x08, 0x01, 0x02, 0x01, 0x02,
+	0x03, 0x02, 0x06, 0x04, 0x01, 0x02, 0x02, 0x02, 0x08, 0x03, 0x03, 0x02, 0x01, 0x02, 0x0A, 0x02,
+	0x01, 0x02, 0x01, 0x02, 0x0B, 0x01, 0x01, 0x02, 0x00, 0x03, 0x0B, 0x01, 0x01, 0x01, 0x01, 0x03,
+	0x01, 0x01, 0x01, 0x04, 0x01, 0x01, 0x01, 0x05, 0x01, 0x01, 0x02, 0x06, 0x01, 0x01, 0x03, 0x06,
+	0x01, 0x01, 0x05, 0x06, 0x01, 0x01, 0x06, 0x06, 0x01, 0x01, 0x07, 0x07, 0x01, 0x01, 0x09, 0x06,
+	0x01, 0x01, 0x0A, 0x06, 0x01, 0x01, 0x0C, 0x04, 0x01, 0x02, 0x00, 0x01, 0x0C, 0x04, 0x01, 0x02,
+	0x01, 0x01, 0x0B, 0x04, 0x02, 0x02, 0x01, 0x01, 0x0C, 0x03,
+	// @10786 0x9B (12 pixels wide)
+	0x15, 0x00, 0x01, 0x01, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01,
+	0x02, 0x02, 0x01, 0x01, 0x03, 0x02, 0x01, 0x01, 0x03, 0x03, 0x01, 0x01, 0x04, 0x02, 0x01, 0x01,
+	0x04, 0x03, 0x01, 0x01, 0x05, 0x03, 0x01, 0x01, 0x06, 0x03, 0x01, 0x01, 0x07, 0x03, 0x01, 0x01,
+	0x07, 0x04, 0x01, 0x01, 0x07, 0x05, 0x01, 0x01, 0x07, 0x04, 0x01, 0x01, 0x06, 0x04, 0x01, 0x01,
+	0x05, 0x04, 0x01, 0x01, 0x05, 0x03, 0x01, 0x01, 0x04, 0x03, 0x01, 0x01, 0x03, 0x03, 0x01, 0x01,
+	0x03, 0x02, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01,
+	// @10880 0x9C (32 pixels wide)
+	0x11, 0x00, 0x01, 0x01, 0x09, 0x01, 0x01, 0x02, 0x06, 0x07, 0x09, 0x05, 0x01, 0x03, 0x05, 0x03,
+	0x03, 0x03, 0x06, 0x08, 0x01, 0x04, 0x04, 0x03, 0x05, 0x03, 0x04, 0x03, 0x04, 0x03, 0x01, 0x04,
+	0x03, 0x03, 0x07, 0x02, 0x04, 0x02, 0x06, 0x03, 0x01, 0x04, 0x02, 0x03, 0x08, 0x03, 0x02, 0x03,
+	0x06, 0x03, 0x01, 0x04, 0x02, 0x03, 0x09, 0x02, 0x02, 0x02, 0x08, 0x02, 0x01, 0x03, 0x02, 0x02,
+	0x0A, 0x06, 0x08, 0x03, 0x01, 0x03, 0x01, 0x03, 0x0A, 0x06, 0x08, 0x03, 0x01, 0x03, 0x01, 0x03,
+	0x0B, 0x04, 0x09, 0x03, 0x01, 0x02, 0x01, 0x03, 0x0B, 0x10, 0x01, 0x02, 0x01, 0x02, 0x0C, 0x10,
+	0x06, 0x02, 0x00, 0x03, 0x0C, 0x04, 0x02, 0x02, 0x01, 0x02, 0x0C, 0x04, 0x01, 0x03, 0x01, 0x03,
+	0x0B, 0x04, 0x0C, 0x01, 0x02, 0x03, 0x01, 0x03, 0x0A, 0x06, 0x0A, 0x01, 0x01, 0x04, 0x02, 0x02,
+	0x0A, 0x02, 0x01, 0x04, 0x08, 0x02, 0x01, 0x04, 0x02, 0x03, 0x09, 0x02, 0x01, 0x04, 0x08, 0x02,
+	0x01, 0x04, 0x02, 0x03, 0x08, 0x03, 0x02, 0x04, 0x06, 0x02, 0x01, 0x04, 0x03, 0x03, 0x06, 0x03,
+	0x03, 0x05, 0x03, 0x04,
+	// @11044 0x9D (2 pixels wide)
+	0x2C, 0x00,
+	// @11046 0x9E (2 pixels wide)
+	0x2C, 0x00,
+	// @11048 0x9F (37 pixels wide)
+	0x02, 0x02, 0x08, 0x06, 0x09, 0x05, 0x01, 0x02, 0x09, 0x04, 0x0B, 0x03, 0x03, 0x00, 0x01, 0x02,
+	0x00, 0x0F, 0x0A, 0x0C, 0x01, 0x02, 0x03, 0x09, 0x10, 0x06, 0x01, 0x02, 0x04, 0x06, 0x13, 0x04,
+	0x01, 0x02, 0x05, 0x05, 0x13, 0x03, 0x01, 0x02, 0x06, 0x04, 0x13, 0x02, 0x01, 0x02, 0x07, 0x04,
+	0x11, 0x03, 0x01, 0x02, 0x07, 0x04, 0x10, 0x03, 0x01, 0x02, 0x08, 0x04, 0x0F, 0x02, 0x01, 0x02,
+	0x08, 0x05, 0x0D, 0x03, 0x01, 0x02, 0x09, 0x04, 0x0D, 0x02, 0x01, 0x02, 0x0A, 0x04, 0x0B, 0x03,
+	0x01, 0x02, 0x0A, 0x05, 0x0A, 0x02, 0x01, 0x02, 0x0B, 0x04, 0x09, 0x02, 0x01, 0x02, 0x0B, 0x05,
+	0x07, 0x03, 0x01, 0x02, 0x0C, 0x04, 0x07, 0x02, 0x01, 0x02, 0x0D, 0x04, 0x05, 0x03, 0x01, 0x02,
+	0x0D, 0x05, 0x04, 0x02, 0x01, 0x02, 0x0E, 0x04, 0x03, 0x02, 0x01, 0x02, 0x0E, 0x05, 0x01, 0x03,
+	0x01, 0x02, 0x0F, 0x04, 0x01, 0x02, 0x01, 0x01, 0x0F, 0x06, 0x01, 0x01, 0x10, 0x05, 0x0E, 0x01,
+	0x11, 0x03, 0x01, 0x01, 0x10, 0x04, 0x01, 0x01, 0x10, 0x05,
+	// @11202 0xA0 (2 pixels wide)
+	0x2C, 0x00,
+	// @11204 0xA1 (6 pixels wide)
+	0x12, 0x00, 0x01, 0x01, 0x02, 0x03, 0x01, 0x01, 0x01, 0x05, 0x03, 0x01, 0x00, 0x06, 0x01, 0x01,
+	0x01, 0x05, 0x01, 0x01, 0x02, 0x02, 0x04, 0x00, 0x0F, 0x01, 0x01, 0x04,
+	// @11232 0xA2 (19 pixels wide)
+	0x08, 0x00, 0x06, 0x01, 0x0A, 0x04, 0x01, 0x01, 0x07, 0x0C, 0x01, 0x01, 0x05, 0x0E, 0x01, 0x01,
+	0x04, 0x0F, 0x01, 0x02, 0x03, 0x07, 0x06, 0x03, 0x01, 0x01, 0x02, 0x06, 0x01, 0x01, 0x01, 0x06,
+	0x01, 0x01, 0x01, 0x05, 0x03, 0x01, 0x00, 0x05, 0x05, 0x01, 0x00, 0x04, 0x03, 0x01, 0x00, 0x05,
+	0x01, 0x01, 0x01, 0x05, 0x01, 0x01, 0x01, 0x06, 0x01, 0x01, 0x02, 0x06, 0x01, 0x02, 0x02, 0x08,
+	0x06, 0x03, 0x01, 0x01, 0x03, 0x10, 0x01, 0x01, 0x05, 0x0E, 0x01, 0x01, 0x07, 0x0B, 0x05, 0x01,
+	0x0A, 0x04,
+	// @11314 0xA3 (22 pixels wide)
+	0x09, 0x00, 0x01, 0x01, 0x0B, 0x08, 0x01, 0x01, 0x09, 0x0C, 0x01, 0x01, 0x08, 0x0C, 0x01, 0x01,
+	0x07, 0x0D, 0x01, 0x02, 0x06, 0x06, 0x07, 0x01, 0x01, 0x01, 0x06, 0x04, 0x01, 0x01, 0x05, 0x05,
+	0x08, 0x01, 0x05, 0x04, 0x01, 0x01, 0x05, 0x05, 0x03, 0x01, 0x00, 0x11, 0x07, 0x01, 0x06, 0x04,
+	0x02, 0x01, 0x05, 0x04, 0x02, 0x01, 0x04, 0x04, 0x01, 0x01, 0x03, 0x04, 0x01, 0x01, 0x01, 0x15,
+	0x03, 0x01, 0x00, 0x16,
+	// @11382 0xA4 (24 pixels wide)
+	0x0E, 0x00, 0x01, 0x02, 0x01, 0x01, 0x13, 0x01, 0x01, 0x02, 0x00, 0x03, 0x11, 0x03, 0x01, 0x03,
+	0x00, 0x04, 0x04, 0x08, 0x03, 0x05, 0x01, 0x03, 0x01, 0x04, 0x01, 0x0B, 0x01, 0x05, 0x01, 0x01,
+	0x02, 0x13, 0x01, 0x02, 0x03, 0x06, 0x05, 0x06, 0x01, 0x02, 0x03, 0x05, 0x07, 0x05, 0x01, 0x02,
+	0x03, 0x04, 0x09, 0x05, 0x02, 0x02, 0x02, 0x04, 0x0B, 0x04, 0x01, 0x02, 0x02, 0x03, 0x0D, 0x03,
+	0x02, 0x02, 0x01, 0x04, 0x0D, 0x04, 0x01, 0x02, 0x01, 0x04, 0x0D, 0x03, 0x01, 0x02, 0x02, 0x03,
+	0x0D, 0x03, 0x02, 0x02, 0x02, 0x04, 0x0B, 0x04, 0x01, 0x02, 0x03, 0x04, 0x09, 0x04, 0x01, 0x02,
+	0x03, 0x05, 0x07, 0x05, 0x01, 0x02, 0x03, 0x06, 0x05, 0x06, 0x01, 0x01, 0x02, 0x13, 0x01, 0x03,
+	0x01, 0x04, 0x01, 0x0B, 0x01, 0x04, 0x01, 0x03, 0x00, 0x04, 0x04, 0x07, 0x04, 0x04, 0x01, 0x02,
+	0x00, 0x03, 0x11, 0x03, 0x01, 0x02, 0x01, 0x01, 0x13, 0x01, 0x05, 0x00,
+	// @11522 0xA5 (25 pixels wide)
+	0x0A, 0x00, 0x01, 0x02, 0x00, 0x05, 0x0F, 0x05, 0x02, 0x02, 0x01, 0x05, 0x0D, 0x05, 0x01, 0x02,
+	0x02, 0x05, 0x0B, 0x05, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x04, 0x01, 0x02, 0x03, 0x05, 0x09, 0x05,
+	0x01, 0x02, 0x04, 0x04, 0x09, 0x04, 0x01, 0x02, 0x04, 0x05, 0x07, 0x05, 0x01, 0x02, 0x05, 0x04,
+	0x07, 0x04, 0x01, 0x02, 0x05, 0x05, 0x05, 0x04, 0x01, 0x02, 0x06, 0x04, 0x05, 0x04, 0x02, 0x02,
+	0x07, 0x04, 0x03, 0x04, 0x01, 0x02, 0x08, 0x04, 0x01, 0x04, 0x01, 0x02, 0x08, 0x04, 0x01, 0x03,
+	0x01, 0x01, 0x09, 0x07, 0x02, 0x01, 0x02, 0x15, 0x04, 0x01, 0x0A, 0x04, 0x03, 0x01, 0x02, 0x15,
+	0x09, 0x01, 0x0A, 0x04,
+	// @11622 0xA6 (3 pixels wide)
+	0x08, 0x00, 0x13, 0x01, 0x00, 0x03, 0x08, 0x00, 0x09, 0x01, 0x00, 0x03,
+	// @11634 0xA7 (21 pixels wide)
+	0x08, 0x00, 0x01, 0x01, 0x07, 0x0A, 0x01, 0x01, 0x05, 0x0E, 0x01, 0x01, 0x04, 0x0F, 0x01, 0x02,
+	0x03, 0x06, 0x07, 0x02, 0x01, 0x01, 0x03, 0x04, 0x03, 0x01, 0x02, 0x04, 0x01, 0x01, 0x02, 0x05,
+	0x01, 0x01, 0x02, 0x06, 0x01, 0x01, 0x03, 0x06, 0x01, 0x01, 0x04, 0x08, 0x01, 0x01, 0x03, 0x0C,
+	0x01, 0x02, 0x02, 0x04, 0x01, 0x0A, 0x01, 0x02, 0x01, 0x04, 0x04, 0x09, 0x01, 0x02, 0x01, 0x03,
+	0x08, 0x08, 0x01, 0x02, 0x00, 0x04, 0x0A, 0x06, 0x01, 0x02, 0x00, 0x04, 0x0C, 0x05, 0x01, 0x02,
+	0x00, 0x04, 0x0D, 0x04, 0x01, 0x02, 0x00, 0x05, 0x0C, 0x04, 0x01, 0x02, 0x01, 0x05, 0x0C, 0x03,
+	0x01, 0x02, 0x01, 0x06, 0x0B, 0x03, 0x01, 0x02, 0x02, 0x08, 0x07, 0x04, 0x01, 0x02, 0x03, 0x09,
+	0x05, 0x04, 0x01, 0x02, 0x05, 0x0A, 0x01, 0x04, 0x01, 0x01, 0x07, 0x0C, 0x01, 0x01, 0x0A, 0x08,
+	0x01, 0x01, 0x0C, 0x07, 0x01, 0x01, 0x0E, 0x05, 0x01, 0x01, 0x0F, 0x05, 0x03, 0x01, 0x10, 0x04,
+	0x01, 0x01, 0x0F, 0x05, 0x01, 0x02, 0x03, 0x01, 0x0B, 0x04, 0x01, 0x02, 0x02, 0x04, 0x07, 0x06,
+	// @11794 0xA8 (15 pixels wide)
+	0x08, 0x00, 0x01, 0x02, 0x02, 0x02, 0x08, 0x02, 0x01, 0x02, 0x01, 0x04, 0x06, 0x04, 0x02, 0x02,
+	0x00, 0x06, 0x04, 0x05, 0x01, 0x02, 0x01, 0x04, 0x06, 0x04, 0x01, 0x02, 0x02, 0x02, 0x08, 0x02,
+	0x1E, 0x00,
+	// @11828 0xA9 (32 pixels wide)
+	0x0A, 0x00, 0x01, 0x01, 0x0B, 0x0A, 0x01, 0x01, 0x08, 0x10, 0x01, 0x02, 0x07, 0x05, 0x08, 0x05,
+	0x01, 0x02, 0x06, 0x03, 0x0D, 0x04, 0x01, 0x02, 0x05, 0x03, 0x10, 0x03, 0x01, 0x02, 0x04, 0x03,
+	0x12, 0x03, 0x01, 0x03, 0x03, 0x03, 0x0A, 0x03, 0x07, 0x03, 0x01, 0x03, 0x02, 0x03, 0x08, 0x0A,
+	0x04, 0x03, 0x01, 0x03, 0x02, 0x03, 0x06, 0x0C, 0x04, 0x03, 0x01, 0x04, 0x01, 0x03, 0x06, 0x04,
+	0x08, 0x01, 0x05, 0x03, 0x01, 0x03, 0x01, 0x03, 0x05, 0x03, 0x10, 0x03, 0x01, 0x03, 0x00, 0x03,
+	0x05, 0x03, 0x12, 0x02, 0x01, 0x03, 0x00, 0x03, 0x05, 0x03, 0x12, 0x03, 0x01, 0x03, 0x00, 0x03,
+	0x05, 0x02, 0x13, 0x03, 0x05, 0x03, 0x00, 0x03, 0x04, 0x03, 0x13, 0x03, 0x01, 0x03, 0x00, 0x03,
+	0x05, 0x03, 0x12, 0x03, 0x01, 0x03, 0x00, 0x03, 0x05, 0x03, 0x12, 0x02, 0x01, 0x03, 0x01, 0x02,
+	0x05, 0x04, 0x10, 0x03, 0x01, 0x04, 0x01, 0x03, 0x05, 0x04, 0x09, 0x01, 0x05, 0x03, 0x01, 0x04,
+	0x02, 0x02, 0x06, 0x06, 0x03, 0x04, 0x04, 0x03, 0x01, 0x03, 0x02, 0x03, 0x06, 0x0C, 0x04, 0x03,
+	0x01, 0x03, 0x03, 0x03, 0x08, 0x06, 0x06, 0x03, 0x01, 0x02, 0x04, 0x03, 0x12, 0x03, 0x01, 0x02,
+	0x04, 0x04, 0x10, 0x03, 0x01, 0x02, 0x06, 0x03, 0x0E, 0x03, 0x01, 0x02, 0x07, 0x04, 0x0A, 0x04,
+	0x01, 0x01, 0x08, 0x10, 0x01, 0x01, 0x0B, 0x0A, 0x02, 0x00,
+	// @12030 0xAA (14 pixels wide)
+	0x0D, 0x00, 0x01, 0x01, 0x03, 0x08, 0x01, 0x01, 0x01, 0x0B, 0x01, 0x02, 0x01, 0x03, 0x04, 0x05,
+	0x01, 0x01, 0x0A, 0x03, 0x02, 0x01, 0x0A, 0x04, 0x01, 0x01, 0x05, 0x09, 0x01, 0x01, 0x03, 0x0B,
+	0x01, 0x02, 0x01, 0x07, 0x02, 0x04, 0x01, 0x02, 0x00, 0x05, 0x05, 0x04, 0x01, 0x02, 0x00, 0x04,
+	0x06, 0x04, 0x02, 0x02, 0x00, 0x03, 0x07, 0x04, 0x01, 0x02, 0x00, 0x04, 0x05, 0x05, 0x01, 0x02,
+	0x00, 0x06, 0x01, 0x07, 0x01, 0x02, 0x01, 0x09, 0x01, 0x03, 0x01, 0x02, 0x02, 0x06, 0x03, 0x03,
+	0x0E, 0x00,
+	// @12112 0xAB (19 pixels wide)
+	0x15, 0x00, 0x01, 0x02, 0x06, 0x04, 0x05, 0x04, 0x01, 0x02, 0x05, 0x04, 0x05, 0x04, 0x01, 0x02,
+	0x05, 0x03, 0x05, 0x04, 0x01, 0x02, 0x04, 0x04, 0x05, 0x03, 0x01, 0x02, 0x03, 0x04, 0x05, 0x04,
+	0x01, 0x02, 0x03, 0x03, 0x05, 0x04, 0x01, 0x02, 0x02, 0x04, 0x04, 0x04, 0x01, 0x02, 0x01, 0x04,
+	0x05, 0x03, 0x01, 0x02, 0x00, 0x04, 0x05, 0x04, 0x01, 0x02, 0x00, 0x03, 0x05, 0x04, 0x01, 0x02,
+	0x00, 0x04, 0x05, 0x04, 0x01, 0x02, 0x01, 0x04, 0x05, 0x03, 0x01, 0x02, 0x02, 0x03, 0x05, 0x04,
+	0x01, 0x02, 0x02, 0x04, 0x05, 0x04, 0x01, 0x02, 0x03, 0x04, 0x05, 0x03, 0x01, 0x02, 0x04, 0x04,
+	0x04, 0x04, 0x01, 0x02, 0x04, 0x04, 0x05, 0x04, 0x01, 0x02, 0x05, 0x04, 0x05, 0x04, 0x01, 0x02,
+	0x06, 0x04, 0x05, 0x03, 0x04, 0x00,
+	// @12230 0xAC (27 pixels wide)
+	0x17, 0x00, 0x03, 0x01, 0x00, 0x1B, 0x0C, 0x01, 0x18, 0x03, 0x06, 0x00,
+	// @12242 0xAD (2 pixels wide)
+	0x2C, 0x00,
+	// @12244 0xAE (18 pixels wide)
+	0x08, 0x00, 0x01, 0x01, 0x05, 0x08, 0x01, 0x01, 0x04, 0x0B, 0x01, 0x02, 0x03, 0x03, 0x07, 0x03,
+	0x01, 0x02, 0x02, 0x02, 0x0A, 0x02, 0x01, 0x03, 0x01, 0x03, 0x02, 0x06, 0x03, 0x02, 0x01, 0x03,
+	0x01, 0x02, 0x03, 0x07, 0x02, 0x03, 0x01, 0x04, 0x00, 0x03, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02,
+	0x01, 0x04, 0x00, 0x02, 0x04, 0x02, 0x03, 0x02, 0x03, 0x02, 0x02, 0x03, 0x00, 0x02, 0x04, 0x06,
+	0x04, 0x02, 0x01, 0x04, 0x00, 0x03, 0x03, 0x02, 0x02, 0x03, 0x03, 0x02, 0x01, 0x04, 0x01, 0x02,
+	0x03, 0x02, 0x03, 0x02, 0x02, 0x03, 0x01, 0x04, 0x01, 0x03, 0x02, 0x02, 0x03, 0x02, 0x02, 0x02,
+	0x01, 0x02, 0x02, 0x02, 0x0A, 0x02, 0x01, 0x02, 0x03, 0x03, 0x07, 0x03, 0x01, 0x01, 0x04, 0x0B,
+	0x01, 0x01, 0x05, 0x08, 0x13, 0x00,
+	// @12362 0xAF (12 pixels wide)
+	0x0A, 0x00, 0x03, 0x01, 0x00, 0x0C, 0x1F, 0x00,
+	// @12370 0xB0 (14 pixels wide)
+	0x08, 0x00, 0x01, 0x01, 0x03, 0x07, 0x01, 0x01, 0x02, 0x09, 0x01, 0x02, 0x01, 0x04, 0x03, 0x04,
+	0x01, 0x02, 0x00, 0x04, 0x06, 0x03, 0x01, 0x02, 0x00, 0x03, 0x07, 0x03, 0x01, 0x02, 0x00, 0x03,
+	0x08, 0x03, 0x02, 0x02, 0x00, 0x02, 0x09, 0x03, 0x02, 0x02, 0x00, 0x03, 0x07, 0x03, 0x01, 0x02,
+	0x01, 0x03, 0x05, 0x03, 0x01, 0x01, 0x01, 0x0B, 0x01, 0x01, 0x03, 0x07, 0x01, 0x01, 0x05, 0x03,
+	0x16, 0x00,
+	// @12436 0xB1 (27 pixels wide)
+	0x0E, 0x00, 0x0A, 0x01, 0x0C, 0x04, 0x03, 0x01, 0x00, 0x1B, 0x0B, 0x01, 0x0C, 0x04, 0x03, 0x00,
+	0x03, 0x01, 0x00, 0x1B,
+	// @12456 0xB2 (14 pixels wide)
+	0x01, 0x01, 0x02, 0x09, 0x01, 0x01, 0x00, 0x0C, 0x01, 0x01, 0x00, 0x0D, 0x01, 0x02, 0x01, 0x01,
+	0x07, 0x04, 0x01, 0x01, 0x09, 0x04, 0x01, 0x01, 0x0A, 0x04, 0x01, 0x01, 0x0A, 0x03, 0x02, 0x01,
+	0x09, 0x04, 0x01, 0x01, 0x09, 0x03, 0x01, 0x01, 0x08, 0x04, 0x01, 0x01, 0x07, 0x04, 0x01, 0x01,
+	0x06, 0x04, 0x01, 0x01, 0x05, 0x04, 0x01, 0x01, 0x04, 0x04, 0x01, 0x01, 0x03, 0x04, 0x01, 0x01,
+	0x02, 0x04, 0x01, 0x01, 0x01, 0x04, 0x02, 0x01, 0x00, 0x0E, 0x18, 0x00,
+	// @12532 0xB3 (14 pixels wide)
+	0x01, 0x01, 0x02, 0x09, 0x01, 0x01, 0x01, 0x0B, 0x01, 0x02, 0x01, 0x03, 0x03, 0x06, 0x01, 0x02,
+	0x01, 0x01, 0x07, 0x04, 0x03, 0x01, 0x09, 0x04, 0x01, 0x01, 0x08, 0x04, 0x01, 0x01, 0x03, 0x08,
+	0x01, 0x01, 0x03, 0x06, 0x01, 0x01, 0x03, 0x09, 0x01, 0x01, 0x08, 0x05, 0x01, 0x01, 0x09, 0x04,
+	0x03, 0x01, 0x0A, 0x04, 0x01, 0x01, 0x09, 0x05, 0x01, 0x02, 0x00, 0x02, 0x06, 0x05, 0x01, 0x01,
+	0x00, 0x0C, 0x01, 0x01, 0x00, 0x0B, 0x01, 0x01, 0x03, 0x05, 0x17, 0x00,
+	// @12608 0xB4 (9 pixels wide)
+	0x07, 0x00, 0x01, 0x01, 0x04, 0x05, 0x01, 0x01, 0x03, 0x05, 0x01, 0x01, 0x03, 0x04, 0x01, 0x01,
+	0x02, 0x04, 0x01, 0x01, 0x01, 0x05, 0x01, 0x01, 0x01, 0x04, 0x01, 0x01, 0x00, 0x04, 0x01, 0x01,
+	0x00, 0x03, 0x1D, 0x00,
+	// @12644 0xB5 (24 pixels wide)
+	0x12, 0x00, 0x12, 0x02, 0x00, 0x05, 0x0C, 0x04, 0x02, 0x02, 0x00, 0x05, 0x0B, 0x05, 0x01, 0x02,
+	0x00, 0x06, 0x09, 0x07, 0x01, 0x02, 0x00, 0x07, 0x07, 0x08, 0x01, 0x02, 0x00, 0x08, 0x04, 0x0A,
+	0x01, 0x02, 0x00, 0x10, 0x02, 0x06, 0x01, 0x03, 0x00, 0x04, 0x01, 0x0A, 0x03, 0x06, 0x01, 0x03,
+	0x00, 0x04, 0x02, 0x08, 0x05, 0x05,
+	// @12698 0xB6 (21 pixels wide)
+	0x08, 0x00, 0x01, 0x01, 0x0A, 0x0A, 0x01, 0x01, 0x06, 0x0F, 0x01, 0x01, 0x05, 0x10, 0x01, 0x02,
+	0x03, 0x0B, 0x03, 0x04, 0x01, 0x02, 0x02, 0x0C, 0x03, 0x04, 0x02, 0x02, 0x01, 0x0D, 0x03, 0x04,
+	0x09, 0x02, 0x00, 0x0E, 0x03, 0x04, 0x02, 0x02, 0x01, 0x0D, 0x03, 0x04, 0x01, 0x02, 0x02, 0x0C,
+	0x03, 0x04, 0x01, 0x02, 0x03, 0x0B, 0x03, 0x04, 0x01, 0x02, 0x05, 0x09, 0x03, 0x04, 0x01, 0x02,
+	0x07, 0x07, 0x03, 0x04, 0x0E, 0x02, 0x0A, 0x04, 0x03, 0x04,
+	// @12772 0xB7 (7 pixels wide)
+	0x1B, 0x00, 0x02, 0x01, 0x01, 0x05, 0x02, 0x01, 0x00, 0x07, 0x02, 0x01, 0x01, 0x05, 0x0B, 0x00,
+	// @12788 0xB8 (9 pixels wide)
+	0x2C, 0x00,
+	// @12790 0xB9 (8 pixels wide)
+	0x01, 0x01, 0x04, 0x04, 0x01, 0x01, 0x02, 0x06, 0x01, 0x01, 0x00, 0x08, 0x01, 0x02, 0x00, 0x04,
+	0x01, 0x03, 0x01, 0x02, 0x01, 0x01, 0x03, 0x03, 0x0F, 0x01, 0x05, 0x03, 0x18, 0x00,
+	// @12820 0xBA (17 pixels wide)
+	0x0D, 0x00, 0x01, 0x01, 0x05, 0x07, 0x01, 0x01, 0x03, 0x0B, 0x01, 0x02, 0x02, 0x05, 0x03, 0x05,
+	0x01, 0x02, 0x01, 0x04, 0x06, 0x05, 0x01, 0x02, 0x01, 0x04, 0x07, 0x04, 0x06, 0x02, 0x00, 0x04,
+	0x09, 0x04, 0x01, 0x02, 0x00, 0x04, 0x09, 0x03, 0x01, 0x02, 0x01, 0x04, 0x07, 0x04, 0x01, 0x02,
+	0x01, 0x05, 0x05, 0x04, 0x01, 0x01, 0x02, 0x0D, 0x01, 0x01, 0x03, 0x0B, 0x01, 0x01, 0x05, 0x07,
+	0x0E, 0x00,
+	// @12886 0xBB (19 pixels wide)
+	0x15, 0x00, 0x01, 0x02, 0x00, 0x03, 0x05, 0x04, 0x01, 0x02, 0x00, 0x04, 0x05, 0x04, 0x01, 0x02,
+	0x01, 0x04, 0x05, 0x03, 0x01, 0x02, 0x02, 0x04, 0x04, 0x04, 0x01, 0x02, 0x03, 0x03, 0x05, 0x04,
+	0x01, 0x02, 0x03, 0x04, 0x05, 0x04, 0x01, 0x02, 0x04, 0x04, 0x05, 0x03, 0x01, 0x02, 0x05, 0x03,
+	0x05, 0x04, 0x01, 0x02, 0x05, 0x04, 0x05, 0x04, 0x01, 0x02, 0x06, 0x04, 0x05, 0x04, 0x01, 0x02,
+	0x06, 0x03, 0x05, 0x04, 0x01, 0x02, 0x05, 0x04, 0x05, 0x03, 0x01, 0x02, 0x04, 0x04, 0x05, 0x04,
+	0x01, 0x02, 0x04, 0x03, 0x05, 0x04, 0x01, 0x02, 0x03, 0x04, 0x04, 0x04, 0x01, 0x02, 0x02, 0x04,
+	0x05, 0x03, 0x01, 0x02, 0x01, 0x04, 0x05, 0x04, 0x01, 0x02, 0x01, 0x03, 0x05, 0x04, 0x01, 0x02,
+	0x00, 0x04, 0x05, 0x03, 0x04, 0x00,
+	// @13004 0xBC (36 pixels wide)
+	0x09, 0x00, 0x01, 0x02, 0x05, 0x04, 0x10, 0x03, 0x01, 0x02, 0x03, 0x06, 0x10, 0x03, 0x01, 0x02,
+	0x00, 0x09, 0x0F, 0x03, 0x01, 0x02, 0x00, 0x09, 0x0E, 0x03, 0x01, 0x03, 0x01, 0x02, 0x02, 0x04,
+	0x0E, 0x03, 0x02, 0x02, 0x05, 0x04, 0x0D, 0x03, 0x02, 0x02, 0x05, 0x04, 0x0C, 0x03, 0x01, 0x02,
+	0x05, 0x04, 0x0B, 0x03, 0x02, 0x02, 0x05, 0x04, 0x0A, 0x03, 0x02, 0x02, 0x05, 0x04, 0x09, 0x03,
+	0x01, 0x03, 0x05, 0x04, 0x08, 0x03, 0x09, 0x04, 0x01, 0x03, 0x05, 0x04, 0x08, 0x03, 0x08, 0x05,
+	0x02, 0x03, 0x05, 0x04, 0x07, 0x03, 0x08, 0x06, 0x01, 0x04, 0x05, 0x04, 0x06, 0x03, 0x08, 0x03,
+	0x01, 0x03, 0x01, 0x04, 0x05, 0x04, 0x05, 0x03, 0x08, 0x03, 0x02, 0x03, 0x01, 0x04, 0x05, 0x04,
+	0x05, 0x03, 0x07, 0x04, 0x02, 0x03, 0x01, 0x03, 0x0D, 0x03, 0x08, 0x03, 0x03, 0x03, 0x01, 0x03,
+	0x0D, 0x03, 0x07, 0x03, 0x04, 0x03, 0x01, 0x03, 0x0C, 0x03, 0x07, 0x03, 0x05, 0x03, 0x01, 0x03,
+	0x0C, 0x03, 0x06, 0x04, 0x05, 0x03, 0x01, 0x03, 0x0B, 0x03, 0x07, 0x03, 0x06, 0x03, 0x01, 0x03,
+	0x0A, 0x03, 0x07, 0x03, 0x07, 0x03, 0x01, 0x02, 0x0A, 0x03, 0x06, 0x11, 0x02, 0x02, 0x09, 0x03,
+	0x07, 0x11, 0x02, 0x02, 0x08, 0x03, 0x13, 0x03, 0x02, 0x02, 0x07, 0x03, 0x14, 0x03, 0x01, 0x02,
+	0x06, 0x03, 0x15, 0x03,
+	// @13200 0xBD (36 pixels wide)
+	0x09, 0x00, 0x01, 0x02, 0x04, 0x04, 0x10, 0x03, 0x01, 0x02, 0x02, 0x06, 0x10, 0x03, 0x01, 0x02,
+	0x00, 0x08, 0x0F, 0x03, 0x01, 0x02, 0x00, 0x08, 0x0E, 0x03, 0x01, 0x03, 0x00, 0x02, 0x02, 0x04,
+	0x0E, 0x03, 0x02, 0x02, 0x04, 0x04, 0x0D, 0x03, 0x02, 0x02, 0x04, 0x04, 0x0C, 0x03, 0x01, 0x02,
+	0x04, 0x04, 0x0B, 0x03, 0x02, 0x02, 0x04, 0x04, 0x0A, 0x03, 0x02, 0x02, 0x04, 0x04, 0x09, 0x03,
+	0x01, 0x03, 0x04, 0x04, 0x08, 0x03, 0x06, 0x06, 0x01, 0x03, 0x04, 0x04, 0x08, 0x03, 0x04, 0x0A,
+	0x01, 0x03, 0x04, 0x04, 0x07, 0x03, 0x04, 0x0C, 0x01, 0x04, 0x04, 0x04, 0x07, 0x02, 0x05, 0x03,
+	0x05, 0x05, 0x01, 0x03, 0x04, 0x04, 0x06, 0x03, 0x0E, 0x04, 0x02, 0x03, 0x04, 0x04, 0x05, 0x03,
+	0x0F, 0x04, 0x02, 0x02, 0x0C, 0x03, 0x10, 0x04, 0x01, 0x02, 0x0B, 0x03, 0x11, 0x03, 0x01, 0x02,
+	0x0B, 0x03, 0x10, 0x04, 0x01, 0x02, 0x0A, 0x03, 0x10, 0x04, 0x01, 0x02, 0x09, 0x03, 0x10, 0x04,
+	0x01, 0x02, 0x09, 0x03, 0x0F, 0x04, 0x01, 0x02, 0x08, 0x03, 0x0F, 0x04, 0x01, 0x02, 0x08, 0x03,
+	0x0E, 0x04, 0x01, 0x02, 0x07, 0x03, 0x0E, 0x04, 0x01, 0x02, 0x07, 0x03, 0x0D, 0x04, 0x01, 0x02,
+	0x06, 0x03, 0x0D, 0x0E, 0x02, 0x02, 0x05, 0x03, 0x0D, 0x0F,
+	// @13386 0xBE (37 pixels wide)
+	0x09, 0x00, 0x01, 0x02, 0x03, 0x07, 0x11, 0x03, 0x01, 0x02, 0x01, 0x0B, 0x0F, 0x03, 0x01, 0x02,
+	0x01, 0x0B, 0x0E, 0x03, 0x01, 0x03, 0x01, 0x02, 0x05, 0x05, 0x0C, 0x03, 0x01, 0x02, 0x09, 0x04,
+	0x0C, 0x03, 0x02, 0x02, 0x09, 0x04, 0x0B, 0x03, 0x01, 0x02, 0x08, 0x04, 0x0B, 0x03, 0x01, 0x02,
+	0x06, 0x05, 0x0C, 0x03, 0x01, 0x02, 0x03, 0x07, 0x0C, 0x03, 0x01, 0x02, 0x03, 0x08, 0x0A, 0x03,
+	0x01, 0x02, 0x07, 0x06, 0x08, 0x03, 0x01, 0x02, 0x09, 0x04, 0x07, 0x03, 0x01, 0x02, 0x0A, 0x04,
+	0x06, 0x03, 0x01, 0x03, 0x0A, 0x04, 0x05, 0x03, 0x08, 0x04, 0x01, 0x03, 0x0A, 0x04, 0x05, 0x03,
+	0x07, 0x05, 0x01, 0x03, 0x0A, 0x04, 0x04, 0x03, 0x07, 0x06, 0x01, 0x04, 0x00, 0x01, 0x08, 0x04,
+	0x04, 0x03, 0x07, 0x07, 0x01, 0x03, 0x00, 0x0D, 0x04, 0x03, 0x06, 0x08, 0x01, 0x04, 0x00, 0x0C,
+	0x04, 0x03, 0x07, 0x03, 0x01, 0x04, 0x01, 0x04, 0x01, 0x09, 0x06, 0x03, 0x06, 0x03, 0x02, 0x04,
+	0x01, 0x03, 0x0F, 0x03, 0x06, 0x04, 0x02, 0x04, 0x01, 0x03, 0x0F, 0x03, 0x05, 0x04, 0x03, 0x04,
+	0x01, 0x03, 0x0E, 0x03, 0x06, 0x03, 0x04, 0x04, 0x01, 0x03, 0x0E, 0x03, 0x05, 0x03, 0x05, 0x04,
+	0x01, 0x03, 0x0D, 0x03, 0x05, 0x03, 0x06, 0x04, 0x01, 0x03, 0x0C, 0x03, 0x05, 0x04, 0x06, 0x04,
+	0x01, 0x02, 0x0C, 0x03, 0x05, 0x11, 0x02, 0x02, 0x0B, 0x03, 0x06, 0x11, 0x02, 0x02, 0x0A, 0x03,
+	0x11, 0x04, 0x01, 0x02, 0x09, 0x03, 0x12, 0x04, 0x02, 0x02, 0x08, 0x03, 0x13, 0x04,
+	// @13608 0xBF (16 pixels wide)
+	0x12, 0x00, 0x01, 0x01, 0x08, 0x03, 0x01, 0x01, 0x07, 0x05, 0x01, 0x01, 0x07, 0x06, 0x01, 0x01,
+	0x06, 0x07, 0x01, 0x01, 0x07, 0x06, 0x01, 0x01, 0x07, 0x05, 0x01, 0x01, 0x08, 0x03, 0x04, 0x00,
+	0x01, 0x01, 0x07, 0x05, 0x01, 0x01, 0x08, 0x04, 0x02, 0x01, 0x07, 0x05, 0x02, 0x01, 0x07, 0x04,
+	0x01, 0x01, 0x06, 0x05, 0x01, 0x01, 0x06, 0x04, 0x01, 0x01, 0x05, 0x05, 0x01, 0x01, 0x04, 0x05,
+	0x02, 0x01, 0x03, 0x05, 0x01, 0x01, 0x02, 0x05, 0x02, 0x01, 0x01, 0x05,
+	// @13684 0xC0 (30 pixels wide)
+	0x08, 0x00, 0x02, 0x01, 0x0C, 0x06, 0x01, 0x01, 0x0C, 0x07, 0x02, 0x01, 0x0B, 0x08, 0x01, 0x01,
+	0x0B, 0x09, 0x02, 0x02, 0x0A, 0x04, 0x02, 0x04, 0x01, 0x02, 0x0A, 0x04, 0x02, 0x05, 0x01, 0x02,
+	0x09, 0x05, 0x03, 0x04, 0x02, 0x02, 0x09, 0x04, 0x04, 0x05, 0x01, 0x02, 0x08, 0x05, 0x05, 0x04,
+	0x02, 0x02, 0x08, 0x04, 0x06, 0x05, 0x01, 0x02, 0x07, 0x05, 0x07, 0x04, 0x02, 0x02, 0x07, 0x04,
+	0x08, 0x05, 0x01, 0x02, 0x06, 0x05, 0x09, 0x04, 0x02, 0x02, 0x06, 0x04, 0x0A, 0x05, 0x01, 0x01,
+	0x05, 0x14, 0x02, 0x01, 0x05, 0x15, 0x01, 0x01, 0x04, 0x16, 0x01, 0x02, 0x04, 0x05, 0x0D, 0x05,
+	0x01, 0x02, 0x04, 0x04, 0x0E, 0x05, 0x01, 0x02, 0x03, 0x05, 0x0E, 0x05, 0x01, 0x02, 0x03, 0x05,
+	0x0F, 0x05, 0x01, 0x02, 0x03, 0x04, 0x10, 0x05, 0x01, 0x02, 0x02, 0x05, 0x10, 0x05, 0x01, 0x02,
+	0x02, 0x05, 0x11, 0x05, 0x01, 0x02, 0x02, 0x04, 0x12, 0x05, 0x01, 0x02, 0x01, 0x05, 0x12, 0x05,
+	0x01, 0x02, 0x01, 0x05, 0x13, 0x05, 0x01, 0x02, 0x00, 0x05, 0x14, 0x05,
+	// @13840 0xC1 (23 pixels wide)
+	0x08, 0x00, 0x04, 0x01, 0x00, 0x14, 0x09, 0x01, 0x00, 0x05, 0x01, 0x02, 0x00, 0x05, 0x03, 0x02,
+	0x01, 0x01, 0x00, 0x10, 0x01, 0x01, 0x00, 0x12, 0x01, 0x01, 0x00, 0x13, 0x01, 0x02, 0x00, 0x05,
+	0x07, 0x08, 0x01, 0x02, 0x00, 0x05, 0x09, 0x07, 0x01, 0x02, 0x00, 0x05, 0x0B, 0x06, 0x02, 0x02,
+	0x00, 0x05, 0x0C, 0x05, 0x05, 0x02, 0x00, 0x05, 0x0D, 0x05, 0x01, 0x02, 0x00, 0x05, 0x0D, 0x04,
+	0x01, 0x02, 0x00, 0x05, 0x0C, 0x05, 0x01, 0x02, 0x00, 0x05, 0x0B, 0x06, 0x01, 0x02, 0x00, 0x05,
+	0x0A, 0x06, 0x01, 0x02, 0x00, 0x05, 0x09, 0x07, 0x01, 0x02, 0x00, 0x05, 0x06, 0x09, 0x01, 0x01,
+	0x00, 0x12, 0x01, 0x01, 0x00, 0x11, 0x01, 0x01, 0x00, 0x0E,
+	// @13946 0xC2 (23 pixels wide)
+	0x08, 0x00, 0x01, 0x01, 0x01, 0x0D, 0x01, 0x01, 0x00, 0x10, 0x01, 0x01, 0x00, 0x12, 0x01, 0x01,
+	0x00, 0x13, 0x01, 0x02, 0x00, 0x05, 0x09, 0x06, 0x01, 0x02, 0x00, 0x05, 0x0A, 0x06, 0x03, 0x02,
+	0x00, 0x05, 0x0B, 0x05, 0x01, 0x02, 0x00, 0x05, 0x0C, 0x04, 0x02, 0x02, 0x00, 0x05, 0x0B, 0x05,
+	0x01, 0x02, 0x00, 0x05, 0x0B, 0x04, 0x01, 0x02, 0x00, 0x05, 0x0A, 0x05, 0x01, 0x02, 0x00, 0x05,
+	0x08, 0x06, 0x01, 0x01, 0x00, 0x12, 0x01, 0x01, 0x00, 0x10, 0x01, 0x01, 0x00, 0x11, 0x01, 0x01,
+	0x00, 0x13, 0x01, 0x02, 0x00, 0x05, 0x08, 0x07, 0x01, 0x02, 0x00, 0x05, 0x0A, 0x06, 0x01, 0x02,
+	0x00, 0x05, 0x0B, 0x05, 0x02, 0x02, 0x00, 0x05, 0x0C, 0x05, 0x01, 0x02, 0x00, 0x05, 0x0D, 0x04,
+	0x02, 0x02, 0x00, 0x05, 0x0D, 0x05, 0x01, 0x02, 0x00, 0x05, 0x0D, 0x04, 0x02, 0x02, 0x00, 0x05,
+	0x0C, 0x05, 0x01, 0x02, 0x00, 0x05, 0x0B, 0x05, 0x01, 0x02, 0x00, 0x05, 0x09, 0x07, 0x01, 0x02,
+	0x00, 0x05, 0x06, 0x09, 0x01, 0x01, 0x00, 0x13, 0x01, 0x01, 0x00, 0x11, 0x01, 0x01, 0x00, 0x0F,
+	// @14106 0xC3 (19 pixels wide)
+	0x08, 0x00, 0x04, 0x01, 0x00, 0x13, 0x20, 0x01, 0x00, 0x05,
+	// @14116 0xC4 (31 pixels wide)
+	0x08, 0x00, 0x04, 0x01, 0x07, 0x14, 0x0D, 0x02, 0x07, 0x05, 0x0B, 0x04, 0x04, 0x02, 0x07, 0x04,
+	0x0C, 0x04, 0x02, 0x02, 0x06, 0x05, 0x0C, 0x04, 0x02, 0x02, 0x06, 0x04, 0x0D, 0x04, 0x02, 0x02,
+	0x05, 0x05, 0x0D, 0x04, 0x01, 0x02, 0x05, 0x04, 0x0E, 0x04, 0x01, 0x02, 0x04, 0x05, 0x0E, 0x04,
+	0x01, 0x02, 0x04, 0x04, 0x0F, 0x04, 0x01, 0x02, 0x03, 0x05, 0x0F, 0x04, 0x01, 0x02, 0x03, 0x04,
+	0x10, 0x04, 0x04, 0x01, 0x00, 0x1F,
+	// @14186 0xC5 (20 pixels wide)
+	0x08, 0x00, 0x04, 0x01, 0x00, 0x13, 0x0B, 0x01, 0x00, 0x05, 0x04, 0x01, 0x00, 0x12, 0x0D, 0x01,
+	0x00, 0x05, 0x04, 0x01, 0x00, 0x14,
+	// @14208 0xC6 (41 pixels wide)
+	0x08, 0x00, 0x01, 0x03, 0x00, 0x06, 0x0C, 0x04, 0x0D, 0x05, 0x01, 0x03, 0x01, 0x05, 0x0C, 0x04,
+	0x0C, 0x05, 0x01, 0x03, 0x02, 0x05, 0x0B, 0x04, 0x0B, 0x06, 0x01, 0x03, 0x03, 0x05, 0x0A, 0x04,
+	0x0B, 0x05, 0x01, 0x03, 0x03, 0x05, 0x0A, 0x04, 0x0A, 0x05, 0x01, 0x03, 0x04, 0x05, 0x09, 0x04,
+	0x09, 0x05, 0x01, 0x03, 0x05, 0x05, 0x08, 0x04, 0x09, 0x05, 0x01, 0x03, 0x06, 0x05, 0x07, 0x04,
+	0x08, 0x05, 0x01, 0x03, 0x06, 0x05, 0x07, 0x04, 0x07, 0x05, 0x01, 0x03, 0x07, 0x05, 0x06, 0x04,
+	0x07, 0x04, 0x01, 0x03, 0x08, 0x05, 0x05, 0x04, 0x06, 0x04, 0x01, 0x03, 0x09, 0x04, 0x05, 0x04,
+	0x05, 0x05, 0x01, 0x03, 0x0A, 0x04, 0x04, 0x04, 0x04, 0x05, 0x01, 0x03, 0x0A, 0x05, 0x03, 0x04,
+	0x04, 0x04, 0x01, 0x03, 0x0B, 0x04, 0x03, 0x04, 0x03, 0x04, 0x01, 0x03, 0x0C, 0x04, 0x02, 0x04,
+	0x02, 0x05, 0x01, 0x01, 0x0D, 0x0F, 0x01, 0x01, 0x0A, 0x15, 0x01, 0x01, 0x08, 0x19, 0x01, 0x01,
+	0x07, 0x1B, 0x01, 0x03, 0x06, 0x06, 0x06, 0x04, 0x06, 0x07, 0x01, 0x03, 0x05, 0x06, 0x07, 0x04,
+	0x08, 0x05, 0x01, 0x03, 0x05, 0x05, 0x08, 0x04, 0x09, 0x05, 0x01, 0x03, 0x04, 0x05, 0x09, 0x04,
+	0x09, 0x05, 0x01, 0x03, 0x04, 0x04, 0x0A, 0x04, 0x0A, 0x05, 0x01, 0x03, 0x03, 0x05, 0x0A, 0x04,
+	0x0A, 0x05, 0x01, 0x03, 0x03, 0x05, 0x0A, 0x04, 0x0B, 0x05, 0x01, 0x03, 0x03, 0x04, 0x0B, 0x04,
+	0x0B, 0x05, 0x01, 0x03, 0x02, 0x05, 0x0B, 0x04, 0x0C, 0x04, 0x01, 0x03, 0x02, 0x05, 0x0B, 0x04,
+	0x0C, 0x05, 0x01, 0x03, 0x02, 0x04, 0x0C, 0x04, 0x0C, 0x05, 0x01, 0x03, 0x01, 0x05, 0x0C, 0x04,
+	0x0C, 0x05, 0x01, 0x03, 0x01, 0x05, 0x0C, 0x04, 0x0D, 0x05, 0x01, 0x03, 0x01, 0x04, 0x0D, 0x04,
+	0x0D, 0x05, 0x01, 0x03, 0x00, 0x05, 0x0D, 0x04, 0x0D, 0x05, 0x01, 0x03, 0x00, 0x05, 0x0D, 0x04,
+	0x0E, 0x05,
+	// @14482 0xC7 (22 pixels wide)
+	0x08, 0x00, 0x01, 0x01, 0x05, 0x0A, 0x01, 0x01, 0x02, 0x0F, 0x01, 0x01, 0x01, 0x11, 0x01, 0x02,
+	0x01, 0x07, 0x02, 0x09, 0x01, 0x02, 0x01, 0x03, 0x09, 0x07, 0x02, 0x01, 0x0F, 0x05, 0x03, 0x01,
+	0x10, 0x05, 0x01, 0x01, 0x10, 0x04, 0x02, 0x01, 0x0F, 0x05, 0x01, 0x01, 0x0E, 0x05, 0x01, 0x01,
+	0x0C, 0x06, 0x01, 0x01, 0x09, 0x08, 0x02, 0x01, 0x05, 0x0A, 0x01, 0x01, 0x05, 0x0C, 0x01, 0x01,
+	0x0B, 0x08, 0x01, 0x01, 0x0E, 0x06, 0x01, 0x01, 0x0F, 0x06, 0x01, 0x01, 0x10, 0x05, 0x06, 0x01,
+	0x11, 0x05, 0x01, 0x01, 0x10, 0x05, 0x01, 0x01, 0x0F, 0x06, 0x01, 0x02, 0x01, 0x02, 0x0B, 0x07,
+	0x01, 0x02, 0x00, 0x06, 0x06, 0x08, 0x01, 0x01, 0x00, 0x13, 0x01, 0x01, 0x00, 0x11, 0x01, 0x01,
+	0x02, 0x0D,
+	// @14596 0xC8 (27 pixels wide)
+	0x08, 0x00, 0x01, 0x02, 0x00, 0x04, 0x12, 0x05, 0x02, 0x02, 0x00, 0x04, 0x11, 0x06, 0x02, 0x02,
+	0x00, 0x04, 0x10, 0x07, 0x01, 0x02, 0x00, 0x04, 0x0F, 0x08, 0x01, 0x02, 0x00, 0x04, 0x0E, 0x09,
+	0x01, 0x03, 0x00, 0x04, 0x0E, 0x04, 0x01, 0x04, 0x01, 0x03, 0x00, 0x04, 0x0D, 0x05, 0x01, 0x04,
+	0x02, 0x03, 0x00, 0x04, 0x0C, 0x05, 0x02, 0x04, 0x02, 0x03, 0x00, 0x04, 0x0B, 0x05, 0x03, 0x04,
+	0x01, 0x03, 0x00, 0x04, 0x0A, 0x05, 0x04, 0x04, 0x02, 0x03, 0x00, 0x04, 0x09, 0x05, 0x05, 0x04,
+	0x01, 0x03, 0x00, 0x04, 0x08, 0x05, 0x06, 0x04, 0x01, 0x03, 0x00, 0x04, 0x07, 0x06, 0x06, 0x04,
+	0x01, 0x03, 0x00, 0x04, 0x07, 0x05, 0x07, 0x04, 0x02, 0x03, 0x00, 0x04, 0x06, 0x05, 0x08, 0x04,
+	0x01, 0x03, 0x00, 0x04, 0x05, 0x05, 0x08, 0x05, 0x02, 0x03, 0x00, 0x04, 0x04, 0x05, 0x09, 0x05,
+	0x02, 0x03, 0x00, 0x04, 0x03, 0x05, 0x0A, 0x05, 0x01, 0x03, 0x00, 0x04, 0x02, 0x05, 0x0B, 0x05,
+	0x01, 0x03, 0x00, 0x04, 0x02, 0x04, 0x0C, 0x05, 0x01, 0x03, 0x00, 0x04, 0x01, 0x05, 0x0C, 0x05,
+	0x01, 0x03, 0x00, 0x04, 0x01, 0x04, 0x0D, 0x05, 0x02, 0x02, 0x00, 0x08, 0x0E, 0x05, 0x02, 0x02,
+	0x00, 0x07, 0x0F, 0x05, 0x01, 0x02, 0x00, 0x06, 0x10, 0x05, 0x01, 0x02, 0x00, 0x05, 0x11, 0x05,
+	// @14788 0xC9 (27 pixels wide)
+	0x01, 0x00, 0x01, 0x02, 0x07, 0x03, 0x07, 0x03, 0x01, 0x02, 0x07, 0x04, 0x05, 0x04, 0x01, 0x02,
+	0x07, 0x05, 0x03, 0x05, 0x01, 0x01, 0x08, 0x0B, 0x01, 0x01, 0x09, 0x09, 0x02, 0x00, 0x01, 0x02,
+	0x00, 0x04, 0x12, 0x05, 0x02, 0x02, 0x00, 0x04, 0x11, 0x06, 0x02, 0x02, 0x00, 0x04, 0x10, 0x07,
+	0x01, 0x02, 0x00, 0x04, 0x0F, 0x08, 0x01, 0x02, 0x00, 0x04, 0x0E, 0x09, 0x01, 0x03, 0x00, 0x04,
+	0x0E, 0x04, 0x01, 0x04, 0x01, 0x03, 0x00, 0x04, 0x0D, 0x05, 0x01, 0x04, 0x02, 0x03, 0x00, 0x04,
+	0x0C, 0x05, 0x02, 0x04, 0x02, 0x03, 0x00, 0x04, 0x0B, 0x05, 0x03, 0x04, 0x01, 0x03, 0x00, 0x04,
+	0x0A, 0x05, 0x04, 0x04, 0x02, 0x03, 0x00, 0x04, 0x09, 0x05, 0x05, 0x04, 0x01, 0x03, 0x00, 0x04,
+	0x08, 0x05, 0x06, 0x04, 0x01, 0x03, 0x00, 0x04, 0x07, 0x06, 0x06, 0x04, 0x01, 0x03, 0x00, 0x04,
+	0x07, 0x05, 0x07, 0x04, 0x02, 0x03, 0x00, 0x04, 0x06, 0x05, 0x08, 0x04, 0x01, 0x03, 0x00, 0x04,
+	0x05, 0x05, 0x08, 0x05, 0x02, 0x03, 0x00, 0x04, 0x04, 0x05, 0x09, 0x05, 0x02, 0x03, 0x00, 0x04,
+	0x03, 0x05, 0x0A, 0x05, 0x01, 0x03, 0x00, 0x04, 0x02, 0x05, 0x0B, 0x05, 0x01, 0x03, 0x00, 0x04,
+	0x02, 0x04, 0x0C, 0x05, 0x01, 0x03, 0x00, 0x04, 0x01, 0x05, 0x0C, 0x05, 0x01, 0x03, 0x00, 0x04,
+	0x01, 0x04, 0x0D, 0x05, 0x02, 0x02, 0x00, 0x08, 0x0E, 0x05, 0x02, 0x02, 0x00, 0x07, 0x0F, 0x05,
+	0x01, 0x02, 0x00, 0x06, 0x10, 0x05, 0x01, 0x02, 0x00, 0x05, 0x11, 0x05,
+	// @15008 0xCA (24 pixels wide)
+	0x08, 0x00, 0x01, 0x02, 0x00, 0x05, 0x0D, 0x06, 0x01, 0x02, 0x00, 0x05, 0x0C, 0x06, 0x01, 0x02,
+	0x00, 0x05, 0x0C, 0x05, 0x01, 0x02, 0x00, 0x05, 0x0B, 0x05, 0x01, 0x02, 0x00, 0x05, 0x0A, 0x05,
+	0x01, 0x02, 0x00, 0x05, 0x09, 0x06, 0x01, 0x02, 0x00, 0x05, 0x09, 0x05, 0x01, 0x02, 0x00, 0x05,
+	0x08, 0x05, 0x01, 0x02, 0x00, 0x05, 0x07, 0x05, 0x01, 0x02, 0x00, 0x05, 0x06, 0x05, 0x02, 0x02,
+	0x00, 0x05, 0x05, 0x05, 0x01, 0x02, 0x00, 0x05, 0x04, 0x05, 0x01, 0x02, 0x00, 0x05, 0x03, 0x05,
+	0x01, 0x02, 0x00, 0x05, 0x02, 0x05, 0x01, 0x02, 0x00, 0x05, 0x02, 0x04, 0x01, 0x01, 0x00, 0x0A,
+	0x01, 0x01, 0x00, 0x0E, 0x01, 0x01, 0x00, 0x0F, 0x01, 0x01, 0x00, 0x11, 0x01, 0x02, 0x00, 0x05,
+	0x06, 0x07, 0x01, 0x02, 0x00, 0x05, 0x07, 0x06, 0x01, 0x02, 0x00, 0x05, 0x08, 0x06, 0x01, 0x02,
+	0x00, 0x05, 0x09, 0x05, 0x02, 0x02, 0x00, 0x05, 0x0A, 0x05, 0x03, 0x02, 0x00, 0x05, 0x0B, 0x05,
+	0x03, 0x02, 0x00, 0x05, 0x0C, 0x05, 0x02, 0x02, 0x00, 0x05, 0x0D, 0x05, 0x02, 0x02, 0x00, 0x05,
+	0x0E, 0x05,
+	// @15170 0xCB (28 pixels wide)
+	0x08, 0x00, 0x04, 0x01, 0x07, 0x15, 0x0D, 0x02, 0x07, 0x04, 0x0C, 0x05, 0x08, 0x02, 0x06, 0x05,
+	0x0C, 0x05, 0x02, 0x02, 0x06, 0x04, 0x0D, 0x05, 0x02, 0x02, 0x05, 0x05, 0x0D, 0x05, 0x02, 0x02,
+	0x04, 0x05, 0x0E, 0x05, 0x01, 0x02, 0x03, 0x06, 0x0E, 0x05, 0x01, 0x02, 0x01, 0x07, 0x0F, 0x05,
+	0x01, 0x02, 0x00, 0x07, 0x10, 0x05, 0x01, 0x02, 0x00, 0x06, 0x11, 0x05, 0x01, 0x02, 0x00, 0x04,
+	0x13, 0x05,
+	// @15236 0xCC (37 pixels wide)
+	0x08, 0x00, 0x01, 0x02, 0x03, 0x06, 0x13, 0x06, 0x02, 0x02, 0x02, 0x07, 0x13, 0x06, 0x02, 0x02,
+	0x02, 0x08, 0x11, 0x08, 0x01, 0x03, 0x02, 0x08, 0x11, 0x03, 0x01, 0x04, 0x02, 0x04, 0x02, 0x04,
+	0x01, 0x04, 0x0F, 0x04, 0x01, 0x04, 0x01, 0x04, 0x02, 0x04, 0x01, 0x04, 0x0E, 0x04, 0x02, 0x04,
+	0x01, 0x04, 0x02, 0x04, 0x01, 0x05, 0x0D, 0x04, 0x02, 0x04, 0x01, 0x04, 0x02, 0x04, 0x02, 0x04,
+	0x0D, 0x04, 0x02, 0x04, 0x01, 0x04, 0x02, 0x04, 0x02, 0x04, 0x0C, 0x04, 0x03, 0x04, 0x01, 0x04,
+	0x02, 0x04, 0x02, 0x05, 0x0B, 0x04, 0x03, 0x04, 0x01, 0x04, 0x02, 0x04, 0x03, 0x04, 0x0B, 0x04,
+	0x03, 0x04, 0x01, 0x04, 0x02, 0x04, 0x03, 0x04, 0x0A, 0x04, 0x04, 0x04, 0x01, 0x04, 0x02, 0x04,
+	0x03, 0x05, 0x09, 0x04, 0x04, 0x04, 0x01, 0x04, 0x01, 0x05, 0x04, 0x04, 0x08, 0x05, 0x04, 0x04,
+	0x02, 0x04, 0x01, 0x05, 0x04, 0x05, 0x07, 0x04, 0x05, 0x04, 0x01, 0x04, 0x01, 0x05, 0x05, 0x04,
+	0x06, 0x05, 0x05, 0x05, 0x02, 0x04, 0x01, 0x04, 0x06, 0x05, 0x05, 0x04, 0x06, 0x05, 0x02, 0x04,
+	0x01, 0x04, 0x07, 0x04, 0x04, 0x04, 0x07, 0x05, 0x01, 0x04, 0x01, 0x04, 0x07, 0x05, 0x03, 0x04,
+	0x07, 0x05, 0x02, 0x04, 0x01, 0x04, 0x08, 0x04, 0x02, 0x04, 0x08, 0x05, 0x01, 0x04, 0x01, 0x04,
+	0x08, 0x05, 0x01, 0x04, 0x09, 0x04, 0x01, 0x04, 0x01, 0x04, 0x09, 0x04, 0x01, 0x03, 0x0A, 0x04,
+	0x01, 0x03, 0x01, 0x04, 0x09, 0x08, 0x0A, 0x04, 0x01, 0x03, 0x00, 0x05, 0x09, 0x08, 0x0A, 0x04,
+	0x02, 0x03, 0x00, 0x05, 0x0A, 0x06, 0x0B, 0x04, 0x01, 0x03, 0x00, 0x05, 0x0A, 0x05, 0x0C, 0x04,
+	0x01, 0x03, 0x00, 0x05, 0x0B, 0x04, 0x0C, 0x04, 0x01, 0x03, 0x00, 0x05, 0x0B, 0x04, 0x0C, 0x05,
+	// @15492 0xCD (27 pixels wide)
+	0x08, 0x00, 0x0F, 0x02, 0x00, 0x05, 0x11, 0x05, 0x04, 0x01, 0x00, 0x1B, 0x11, 0x02, 0x00, 0x05,
+	0x11, 0x05,
+	// @15510 0xCE (33 pixels wide)
+	0x08, 0x00, 0x01, 0x01, 0x0B, 0x0B, 0x01, 0x01, 0x09, 0x0F, 0x01, 0x01, 0x07, 0x13, 0x01, 0x02,
+	0x06, 0x09, 0x02, 0x0A, 0x01, 0x02, 0x05, 0x07, 0x09, 0x07, 0x01, 0x02, 0x04, 0x06, 0x0D, 0x06,
+	0x01, 0x02, 0x03, 0x06, 0x0F, 0x05, 0x01, 0x02, 0x03, 0x05, 0x10, 0x06, 0x01, 0x02, 0x02, 0x05,
+	0x12, 0x06, 0x01, 0x02, 0x02, 0x05, 0x13, 0x05, 0x01, 0x02, 0x01, 0x05, 0x14, 0x05, 0x02, 0x02,
+	0x01, 0x05, 0x15, 0x05, 0x02, 0x02, 0x00, 0x05, 0x16, 0x05, 0x01, 0x02, 0x00, 0x05, 0x17, 0x04,
+	0x03, 0x02, 0x00, 0x05, 0x17, 0x05, 0x02, 0x02, 0x00, 0x05, 0x17, 0x04, 0x03, 0x02, 0x00, 0x05,
+	0x16, 0x05, 0x01, 0x02, 0x01, 0x05, 0x15, 0x05, 0x01, 0x02, 0x01, 0x05, 0x14, 0x05, 0x01, 0x02,
+	0x01, 0x06, 0x13, 0x05, 0x01, 0x02, 0x02, 0x05, 0x12, 0x06, 0x01, 0x02, 0x02, 0x06, 0x11, 0x05,
+	0x01, 0x02, 0x03, 0x06, 0x0F, 0x05, 0x01, 0x02, 0x04, 0x06, 0x0D, 0x06, 0x01, 0x02, 0x04, 0x07,
+	0x0A, 0x07, 0x01, 0x02, 0x05, 0x09, 0x05, 0x08, 0x01, 0x01, 0x06, 0x14, 0x01, 0x01, 0x08, 0x10,
+	0x01, 0x01, 0x0A, 0x0C,
+	// @15674 0xCF (26 pixels wide)
+	0x08, 0x00, 0x04, 0x01, 0x00, 0x1A, 0x20, 0x02, 0x00, 0x05, 0x10, 0x05,
+	// @15686 0xD0 (22 pixels wide)
+	0x08, 0x00, 0x01, 0x01, 0x01, 0x0D, 0x01, 0x01, 0x00, 0x11, 0x01, 0x01, 0x00, 0x12, 0x01, 0x01,
+	0x00, 0x13, 0x01, 0x02, 0x00, 0x05, 0x09, 0x06, 0x01, 0x02, 0x00, 0x05, 0x0A, 0x06, 0x01, 0x02,
+	0x00, 0x05, 0x0B, 0x05, 0x07, 0x02, 0x00, 0x05, 0x0C, 0x05, 0x01, 0x02, 0x00, 0x05, 0x0C, 0x04,
+	0x01, 0x02, 0x00, 0x05, 0x0B, 0x05, 0x01, 0x02, 0x00, 0x05, 0x0A, 0x06, 0x01, 0x02, 0x00, 0x05,
+	0x08, 0x07, 0x01, 0x01, 0x00, 0x13, 0x01, 0x01, 0x00, 0x12, 0x01, 0x01, 0x00, 0x10, 0x01, 0x01,
+	0x00, 0x0D, 0x0E, 0x01, 0x00, 0x05,
+	// @15772 0xD1 (27 pixels wide)
+	0x08, 0x00, 0x01, 0x01, 0x0D, 0x0C, 0x01, 0x01, 0x0A, 0x11, 0x01, 0x01, 0x08, 0x13, 0x01, 0x01,
+	0x07, 0x13, 0x01, 0x02, 0x06, 0x07, 0x0B, 0x02, 0x01, 0x01, 0x05, 0x06, 0x01, 0x01, 0x04, 0x06,
+	0x01, 0x01, 0x03, 0x06, 0x01, 0x01, 0x02, 0x06, 0x01, 0x01, 0x02, 0x05, 0x03, 0x01, 0x01, 0x05,
+	0x0B, 0x01, 0x00, 0x05, 0x02, 0x01, 0x01, 0x05, 0x01, 0x01, 0x01, 0x06, 0x01, 0x01, 0x02, 0x05,
+	0x01, 0x01, 0x02, 0x06, 0x01, 0x01, 0x03, 0x06, 0x01, 0x01, 0x04, 0x06, 0x01, 0x02, 0x05, 0x07,
+	0x0D, 0x01, 0x01, 0x02, 0x06, 0x0A, 0x05, 0x05, 0x01, 0x01, 0x07, 0x14, 0x01, 0x01, 0x09, 0x12,
+	0x01, 0x01, 0x0B, 0x0E,
+	// @15872 0xD2 (26 pixels wide)
+	0x08, 0x00, 0x04, 0x01, 0x00, 0x1A, 0x20, 0x01, 0x0B, 0x04,
+	// @15882 0xD3 (28 pixels wide)
+	0x08, 0x00, 0x01, 0x02, 0x00, 0x06, 0x11, 0x05, 0x01, 0x02, 0x01, 0x05, 0x11, 0x04, 0x01, 0x02,
+	0x01, 0x05, 0x10, 0x05, 0x01, 0x02, 0x02, 0x05, 0x0F, 0x05, 0x01, 0x02, 0x02, 0x05, 0x0E, 0x05,
+	0x01, 0x02, 0x03, 0x05, 0x0D, 0x05, 0x01, 0x02, 0x03, 0x05, 0x0D, 0x04, 0x01, 0x02, 0x04, 0x05,
+	0x0B, 0x05, 0x01, 0x02, 0x04, 0x05, 0x0B, 0x04, 0x01, 0x02, 0x05, 0x05, 0x0A, 0x04, 0x01, 0x02,
+	0x05, 0x05, 0x09, 0x05, 0x01, 0x02, 0x06, 0x05, 0x08, 0x04, 0x01, 0x02, 0x06, 0x05, 0x07, 0x05,
+	0x01, 0x02, 0x07, 0x04, 0x07, 0x04, 0x01, 0x02, 0x07, 0x05, 0x06, 0x04, 0x01, 0x02, 0x08, 0x04,
+	0x05, 0x05, 0x01, 0x02, 0x08, 0x05, 0x04, 0x04, 0x01, 0x02, 0x09, 0x04, 0x04, 0x04, 0x01, 0x02,
+	0x09, 0x05, 0x02, 0x04, 0x01, 0x02, 0x0A, 0x04, 0x02, 0x04, 0x01, 0x02, 0x0A, 0x05, 0x01, 0x04,
+	0x02, 0x01, 0x0B, 0x08, 0x02, 0x01, 0x0C, 0x06, 0x02, 0x01, 0x0C, 0x05, 0x01, 0x01, 0x0C, 0x04,
+	0x01, 0x01, 0x0B, 0x05, 0x01, 0x01, 0x0B, 0x04, 0x01, 0x01, 0x0A, 0x05, 0x01, 0x01, 0x09, 0x05,
+	0x01, 0x01, 0x07, 0x06, 0x01, 0x01, 0x03, 0x0A, 0x01, 0x01, 0x03, 0x08, 0x01, 0x01, 0x03, 0x07,
+	// @16058 0xD4 (35 pixels wide)
+	0x07, 0x00, 0x03, 0x01, 0x0F, 0x05, 0x01, 0x01, 0x0C, 0x0B, 0x01, 0x01, 0x09, 0x11, 0x01, 0x01,
+	0x07, 0x15, 0x01, 0x03, 0x05, 0x09, 0x01, 0x04, 0x02, 0x08, 0x01, 0x03, 0x04, 0x07, 0x04, 0x04,
+	0x05, 0x06, 0x01, 0x03, 0x03, 0x06, 0x06, 0x04, 0x07, 0x05, 0x01, 0x03, 0x03, 0x05, 0x07, 0x04,
+	0x08, 0x05, 0x01, 0x03, 0x02, 0x05, 0x08, 0x04, 0x08, 0x06, 0x01, 0x03, 0x01, 0x05, 0x09, 0x04,
+	0x09, 0x05, 0x01, 0x03, 0x01, 0x05, 0x09, 0x04, 0x0A, 0x04, 0x01, 0x03, 0x01, 0x05, 0x09, 0x04,
+	0x0A, 0x05, 0x02, 0x03, 0x00, 0x05, 0x0A, 0x04, 0x0A, 0x05, 0x02, 0x03, 0x00, 0x05, 0x0A, 0x04,
+	0x0B, 0x04, 0x02, 0x03, 0x00, 0x05, 0x0A, 0x04, 0x0B, 0x05, 0x02, 0x03, 0x00, 0x05, 0x0A, 0x04,
+	0x0B, 0x04, 0x02, 0x03, 0x00, 0x05, 0x0A, 0x04, 0x0A, 0x05, 0x01, 0x03, 0x01, 0x04, 0x0A, 0x04,
+	0x0A, 0x05, 0x01, 0x03, 0x01, 0x05, 0x09, 0x04, 0x0A, 0x05, 0x01, 0x03, 0x01, 0x05, 0x09, 0x04,
+	0x09, 0x05, 0x01, 0x03, 0x02, 0x05, 0x08, 0x04, 0x08, 0x06, 0x01, 0x03, 0x02, 0x06, 0x07, 0x04,
+	0x08, 0x05, 0x01, 0x03, 0x03, 0x06, 0x06, 0x04, 0x07, 0x05, 0x01, 0x03, 0x04, 0x07, 0x04, 0x04,
+	0x05, 0x07, 0x01, 0x03, 0x05, 0x08, 0x02, 0x04, 0x02, 0x08, 0x01, 0x01, 0x06, 0x16, 0x01, 0x01,
+	0x08, 0x12, 0x01, 0x01, 0x0B, 0x0D, 0x02, 0x01, 0x0F, 0x04,
+	// @16260 0xD5 (27 pixels wide)
+	0x08, 0x00, 0x01, 0x02, 0x00, 0x05, 0x10, 0x06, 0x01, 0x02, 0x00, 0x06, 0x0F, 0x05, 0x01, 0x02,
+	0x01, 0x05, 0x0E, 0x05, 0x01, 0x02, 0x02, 0x05, 0x0C, 0x06, 0x01, 0x02, 0x02, 0x05, 0x0C, 0x05,
+	0x01, 0x02, 0x03, 0x05, 0x0A, 0x05, 0x01, 0x02, 0x03, 0x06, 0x09, 0x05, 0x01, 0x02, 0x04, 0x05,
+	0x08, 0x05, 0x01, 0x02, 0x05, 0x05, 0x07, 0x05, 0x01, 0x02, 0x05, 0x05, 0x06, 0x05, 0x02, 0x02,
+	0x06, 0x05, 0x04, 0x05, 0x01, 0x02, 0x07, 0x05, 0x02, 0x05, 0x01, 0x02, 0x08, 0x04, 0x02, 0x04,
+	0x01, 0x01, 0x08, 0x0A, 0x02, 0x01, 0x09, 0x08, 0x02, 0x01, 0x0A, 0x06, 0x01, 0x01, 0x09, 0x08,
+	0x01, 0x01, 0x09, 0x09, 0x01, 0x01, 0x08, 0x0A, 0x02, 0x02, 0x07, 0x05, 0x02, 0x05, 0x01, 0x02,
+	0x06, 0x05, 0x04, 0x05, 0x01, 0x02, 0x06, 0x04, 0x05, 0x06, 0x01, 0x02, 0x05, 0x05, 0x06, 0x05,
+	0x02, 0x02, 0x04, 0x05, 0x08, 0x05, 0x01, 0x02, 0x03, 0x05, 0x0A, 0x05, 0x01, 0x02, 0x03, 0x05,
+	0x0A, 0x06, 0x01, 0x02, 0x02, 0x05, 0x0C, 0x05, 0x01, 0x02, 0x01, 0x06, 0x0D, 0x05, 0x01, 0x02,
+	0x01, 0x05, 0x0E, 0x05, 0x01, 0x02, 0x00, 0x05, 0x10, 0x05, 0x01, 0x02, 0x00, 0x05, 0x10, 0x06,
+	// @16436 0xD6 (29 pixels wide)
+	0x08, 0x00, 0x20, 0x02, 0x00, 0x05, 0x10, 0x05, 0x04, 0x01, 0x00, 0x1D,
+	// @16448 0xD7 (24 pixels wide)
+	0x08, 0x00, 0x0D, 0x02, 0x00, 0x04, 0x0F, 0x05, 0x03, 0x02, 0x00, 0x05, 0x0E, 0x05, 0x01, 0x02,
+	0x00, 0x06, 0x0D, 0x05, 0x01, 0x02, 0x01, 0x05, 0x0D, 0x05, 0x01, 0x02, 0x01, 0x07, 0x09, 0x07,
+	0x01, 0x01, 0x02, 0x16, 0x01, 0x01, 0x03, 0x15, 0x01, 0x02, 0x04, 0x0E, 0x01, 0x05, 0x01, 0x02,
+	0x06, 0x09, 0x04, 0x05, 0x0D, 0x01, 0x13, 0x05,
+	// @16504 0xD8 (37 pixels wide)
+	0x08, 0x00, 0x20, 0x03, 0x00, 0x05, 0x0B, 0x05, 0x0B, 0x05, 0x04, 0x01, 0x00, 0x25,
+	// @16518 0xD9 (40 pixels wide)
+	0x08, 0x00, 0x20, 0x03, 0x00, 0x05, 0x0B, 0x05, 0x0B, 0x05, 0x04, 0x01, 0x00, 0x28,
+	// @16532 0xDA (31 pixels wide)
+	0x08, 0x00, 0x04, 0x01, 0x00, 0x0E, 0x09, 0x01, 0x09, 0x05, 0x01, 0x02, 0x09, 0x05, 0x01, 0x05,
+	0x01, 0x01, 0x09, 0x0F, 0x01, 0x01, 0x09, 0x11, 0x01, 0x01, 0x09, 0x13, 0x01, 0x02, 0x09, 0x05,
+	0x07, 0x08, 0x01, 0x02, 0x09, 0x05, 0x09, 0x07, 0x01, 0x02, 0x09, 0x05, 0x0B, 0x05, 0x01, 0x02,
+	0x09, 0x05, 0x0B, 0x06, 0x03, 0x02, 0x09, 0x05, 0x0C, 0x05, 0x02, 0x02, 0x09, 0x05, 0x0D, 0x04,
+	0x03, 0x02, 0x09, 0x05, 0x0C, 0x05, 0x01, 0x02, 0x09, 0x05, 0x0B, 0x05, 0x01, 0x02, 0x09, 0x05,
+	0x0A, 0x06, 0x01, 0x02, 0x09, 0x05, 0x09, 0x06, 0x01, 0x02, 0x09, 0x05, 0x06, 0x08, 0x01, 0x01,
+	0x09, 0x12, 0x01, 0x01, 0x09, 0x10, 0x01, 0x01, 0x09, 0x0E,
+	// @16638 0xDB (31 pixels wide)
+	0x08, 0x00, 0x0D, 0x02, 0x00, 0x05, 0x16, 0x04, 0x01, 0x03, 0x00, 0x05, 0x01, 0x05, 0x10, 0x04,
+	0x01, 0x02, 0x00, 0x10, 0x0B, 0x04, 0x01, 0x02, 0x00, 0x12, 0x09, 0x04, 0x01, 0x02, 0x00, 0x13,
+	0x08, 0x04, 0x01, 0x03, 0x00, 0x05, 0x07, 0x08, 0x07, 0x04, 0x01, 0x03, 0x00, 0x05, 0x09, 0x07,
+	0x06, 0x04, 0x01, 0x03, 0x00, 0x05, 0x0B, 0x06, 0x05, 0x04, 0x02, 0x03, 0x00, 0x05, 0x0C, 0x05,
+	0x05, 0x04, 0x05, 0x03, 0x00, 0x05, 0x0D, 0x05, 0x04, 0x04, 0x02, 0x03, 0x00, 0x05, 0x0C, 0x05,
+	0x05, 0x04, 0x01, 0x03, 0x00, 0x05, 0x0B, 0x06, 0x05, 0x04, 0x01, 0x03, 0x00, 0x05, 0x0A, 0x06,
+	0x06, 0x04, 0x01, 0x03, 0x00, 0x05, 0x09, 0x06, 0x07, 0x04, 0x01, 0x03, 0x00, 0x05, 0x06, 0x09,
+	0x07, 0x04, 0x01, 0x02, 0x00, 0x12, 0x09, 0x04, 0x01, 0x02, 0x00, 0x11, 0x0A, 0x04, 0x01, 0x02,
+	0x00, 0x0E, 0x0D, 0x04,
+	// @16770 0xDC (23 pixels wide)
+	0x08, 0x00, 0x0D, 0x01, 0x00, 0x05, 0x01, 0x02, 0x00, 0x05, 0x01, 0x06, 0x01, 0x01, 0x00, 0x10,
+	0x01, 0x01, 0x00, 0x12, 0x01, 0x01, 0x00, 0x13, 0x01, 0x02, 0x00, 0x05, 0x07, 0x08, 0x01, 0x02,
+	0x00, 0x05, 0x0A, 0x06, 0x01, 0x02, 0x00, 0x05, 0x0B, 0x06, 0x02, 0x02, 0x00, 0x05, 0x0C, 0x05,
+	0x05, 0x02, 0x00, 0x05, 0x0D, 0x05, 0x01, 0x02, 0x00, 0x05, 0x0D, 0x04, 0x01, 0x02, 0x00, 0x05,
+	0x0C, 0x05, 0x01, 0x02, 0x00, 0x05, 0x0B, 0x06, 0x01, 0x02, 0x00, 0x05, 0x0B, 0x05, 0x01, 0x02,
+	0x00, 0x05, 0x09, 0x07, 0x01, 0x02, 0x00, 0x05, 0x06, 0x09, 0x01, 0x01, 0x00, 0x12, 0x01, 0x01,
+	0x00, 0x11, 0x01, 0x01, 0x00, 0x0E,
+	// @16872 0xDD (26 pixels wide)
+	0x08, 0x00, 0x01, 0x01, 0x04, 0x0B, 0x01, 0x01, 0x01, 0x10, 0x01, 0x01, 0x00, 0x13, 0x01, 0x01,
+	0x01, 0x13, 0x01, 0x02, 0x01, 0x02, 0x0B, 0x07, 0x01, 0x01, 0x10, 0x06, 0x01, 0x01, 0x11, 0x06,
+	0x01, 0x01, 0x12, 0x06, 0x01, 0x01, 0x13, 0x05, 0x01, 0x01, 0x13, 0x06, 0x02, 0x01, 0x14, 0x05,
+	0x04, 0x01, 0x15, 0x05, 0x04, 0x01, 0x05, 0x15, 0x04, 0x01, 0x15, 0x05, 0x02, 0x01, 0x14, 0x05,
+	0x01, 0x01, 0x13, 0x06, 0x01, 0x01, 0x13, 0x05, 0x01, 0x01, 0x12, 0x06, 0x01, 0x01, 0x11, 0x06,
+	0x01, 0x01, 0x10, 0x06, 0x01, 0x02, 0x00, 0x02, 0x0C, 0x07, 0x01, 0x02, 0x00, 0x05, 0x06, 0x09,
+	0x01, 0x01, 0x00, 0x13, 0x01, 0x01, 0x00, 0x12, 0x01, 0x01, 0x01, 0x0E,
+	// @16980 0xDE (40 pixels wide)
+	0x08, 0x00, 0x01, 0x02, 0x00, 0x05, 0x0F, 0x0A, 0x01, 0x02, 0x00, 0x05, 0x0D, 0x0E, 0x01, 0x02,
+	0x00, 0x05, 0x0B, 0x12, 0x01, 0x03, 0x00, 0x05, 0x0A, 0x08, 0x03, 0x09, 0x01, 0x03, 0x00, 0x05,
+	0x09, 0x06, 0x09, 0x07, 0x01, 0x03, 0x00, 0x05, 0x08, 0x06, 0x0C, 0x06, 0x01, 0x03, 0x00, 0x05,
+	0x08, 0x05, 0x0E, 0x05, 0x01, 0x03, 0x00, 0x05, 0x07, 0x05, 0x0F, 0x06, 0x01, 0x03, 0x00, 0x05,
+	0x07, 0x05, 0x10, 0x05, 0x02, 0x03, 0x00, 0x05, 0x06, 0x05, 0x12, 0x05, 0x01, 0x03, 0x00, 0x05,
+	0x06, 0x04, 0x13, 0x05, 0x04, 0x03, 0x00, 0x05, 0x05, 0x05, 0x14, 0x05, 0x04, 0x02, 0x00, 0x0E,
+	0x15, 0x05, 0x04, 0x03, 0x00, 0x05, 0x05, 0x05, 0x14, 0x05, 0x01, 0x03, 0x00, 0x05, 0x05, 0x05,
+	0x13, 0x05, 0x02, 0x03, 0x00, 0x05, 0x06, 0x05, 0x12, 0x05, 0x01, 0x03, 0x00, 0x05, 0x06, 0x06,
+	0x10, 0x05, 0x01, 0x03, 0x00, 0x05, 0x07, 0x05, 0x10, 0x05, 0x01, 0x03, 0x00, 0x05, 0x07, 0x06,
+	0x0E, 0x05, 0x01, 0x03, 0x00, 0x05, 0x08, 0x06, 0x0C, 0x06, 0x01, 0x03, 0x00, 0x05, 0x09, 0x06,
+	0x0A, 0x06, 0x01, 0x03, 0x00, 0x05, 0x0A, 0x07, 0x06, 0x07, 0x01, 0x02, 0x00, 0x05, 0x0B, 0x12,
+	0x01, 0x02, 0x00, 0x05, 0x0C, 0x0F, 0x01, 0x02, 0x00, 0x05, 0x0E, 0x0B,
+	// @17168 0xDF (24 pixels wide)
+	0x08, 0x00, 0x01, 0x01, 0x0A, 0x0C, 0x01, 0x01, 0x07, 0x11, 0x01, 0x01, 0x05, 0x13, 0x01, 0x01,
+	0x04, 0x14, 0x01, 0x02, 0x03, 0x07, 0x09, 0x05, 0x01, 0x02, 0x03, 0x05, 0x0B, 0x05, 0x03, 0x02,
+	0x02, 0x05, 0x0C, 0x05, 0x03, 0x02, 0x02, 0x04, 0x0D, 0x05, 0x02, 0x02, 0x02, 0x05, 0x0C, 0x05,
+	0x01, 0x02, 0x03, 0x05, 0x0B, 0x05, 0x01, 0x02, 0x04, 0x05, 0x0A, 0x05, 0x01, 0x02, 0x05, 0x06,
+	0x08, 0x05, 0x01, 0x01, 0x06, 0x12, 0x02, 0x01, 0x08, 0x10, 0x01, 0x01, 0x07, 0x11, 0x01, 0x02,
+	0x06, 0x06, 0x07, 0x05, 0x02, 0x02, 0x05, 0x05, 0x09, 0x05, 0x02, 0x02, 0x04, 0x05, 0x0A, 0x05,
+	0x02, 0x02, 0x03, 0x05, 0x0B, 0x05, 0x01, 0x02, 0x03, 0x04, 0x0C, 0x05, 0x03, 0x02, 0x02, 0x05,
+	0x0C, 0x05, 0x02, 0x02, 0x01, 0x05, 0x0D, 0x05, 0x01, 0x02, 0x01, 0x04, 0x0E, 0x05, 0x01, 0x02,
+	0x00, 0x05, 0x0E, 0x05,
+	// @17300 0xE0 (20 pixels wide)
+	0x12, 0x00, 0x01, 0x01, 0x05, 0x0A, 0x01, 0x01, 0x03, 0x0D, 0x01, 0x01, 0x02, 0x10, 0x01, 0x02,
+	0x02, 0x05, 0x05, 0x06, 0x01, 0x02, 0x02, 0x02, 0x0A, 0x05, 0x01, 0x01, 0x0E, 0x05, 0x04, 0x01,
+	0x0F, 0x05, 0x01, 0x01, 0x08, 0x0C, 0x01, 0x01, 0x05, 0x0F, 0x01, 0x01, 0x03, 0x11, 0x01, 0x02,
+	0x02, 0x07, 0x06, 0x05, 0x01, 0x02, 0x01, 0x06, 0x08, 0x05, 0x01, 0x02, 0x01, 0x05, 0x09, 0x05,
+	0x04, 0x02, 0x00, 0x05, 0x0A, 0x05, 0x01, 0x02, 0x00, 0x05, 0x09, 0x06, 0x01, 0x02, 0x00, 0x05,
+	0x08, 0x07, 0x01, 0x02, 0x01, 0x05, 0x06, 0x08, 0x01, 0x02, 0x01, 0x0E, 0x01, 0x04, 0x01, 0x02,
+	0x02, 0x0C, 0x02, 0x04, 0x01, 0x02, 0x03, 0x0A, 0x03, 0x04,
+	// @17406 0xE1 (24 pixels wide)
+	0x06, 0x00, 0x01, 0x01, 0x13, 0x02, 0x01, 0x01, 0x0D, 0x08, 0x01, 0x01, 0x0A, 0x0B, 0x01, 0x01,
+	0x08, 0x0D, 0x01, 0x01, 0x07, 0x0B, 0x01, 0x01, 0x05, 0x08, 0x01, 0x01, 0x05, 0x05, 0x01, 0x01,
+	0x04, 0x05, 0x01, 0x01, 0x03, 0x05, 0x01, 0x01, 0x03, 0x04, 0x02, 0x01, 0x02, 0x04, 0x01, 0x02,
+	0x01, 0x04, 0x06, 0x04, 0x01, 0x02, 0x01, 0x04, 0x03, 0x0A, 0x01, 0x02, 0x01, 0x04, 0x02, 0x0D,
+	0x01, 0x02, 0x01, 0x03, 0x02, 0x0F, 0x01, 0x03, 0x00, 0x04, 0x01, 0x04, 0x06, 0x07, 0x01, 0x02,
+	0x00, 0x08, 0x09, 0x05, 0x01, 0x02, 0x00, 0x07, 0x0A, 0x06, 0x02, 0x02, 0x00, 0x06, 0x0C, 0x05,
+	0x06, 0x02, 0x00, 0x05, 0x0E, 0x05, 0x02, 0x02, 0x01, 0x04, 0x0E, 0x05, 0x01, 0x02, 0x01, 0x05,
+	0x0D, 0x05, 0x01, 0x02, 0x01, 0x05, 0x0C, 0x05, 0x01, 0x02, 0x02, 0x05, 0x0B, 0x05, 0x01, 0x02,
+	0x02, 0x05, 0x0A, 0x05, 0x01, 0x02, 0x03, 0x05, 0x08, 0x06, 0x01, 0x02, 0x04, 0x06, 0x05, 0x06,
+	0x01, 0x01, 0x04, 0x10, 0x01, 0x01, 0x06, 0x0D, 0x01, 0x01, 0x07, 0x0A,
+	// @17562 0xE2 (20 pixels wide)
+	0x12, 0x00, 0x01, 0x01, 0x00, 0x0D, 0x01, 0x01, 0x00, 0x10, 0x01, 0x01, 0x00, 0x12, 0x01, 0x02,
+	0x00, 0x04, 0x07, 0x07, 0x01, 0x02, 0x00, 0x04, 0x09, 0x06, 0x01, 0x02, 0x00, 0x04, 0x0A, 0x05,
+	0x02, 0x02, 0x00, 0x04, 0x0B, 0x04, 0x01, 0x02, 0x00, 0x04, 0x0A, 0x05, 0x01, 0x02, 0x00, 0x04,
+	0x0A, 0x04, 0x01, 0x02, 0x00, 0x04, 0x08, 0x06, 0x01, 0x01, 0x00, 0x10, 0x01, 0x01, 0x00, 0x0E,
+	0x01, 0x01, 0x00, 0x12, 0x01, 0x02, 0x00, 0x04, 0x07, 0x08, 0x01, 0x02, 0x00, 0x04, 0x0A, 0x06,
+	0x01, 0x02, 0x00, 0x04, 0x0B, 0x05, 0x03, 0x02, 0x00, 0x04, 0x0C, 0x04, 0x01, 0x02, 0x00, 0x04,
+	0x0B, 0x05, 0x01, 0x02, 0x00, 0x04, 0x0A, 0x06, 0x01, 0x02, 0x00, 0x04, 0x09, 0x06, 0x01, 0x01,
+	0x00, 0x12, 0x01, 0x01, 0x00, 0x11, 0x01, 0x01, 0x00, 0x0E,
+	// @17684 0xE3 (16 pixels wide)
+	0x12, 0x00, 0x04, 0x01, 0x00, 0x10, 0x16, 0x01, 0x00, 0x04,
+	// @17694 0xE4 (26 pixels wide)
+	0x12, 0x00, 0x04, 0x01, 0x07, 0x11, 0x06, 0x02, 0x07, 0x04, 0x08, 0x05, 0x02, 0x02, 0x06, 0x05,
+	0x08, 0x05, 0x04, 0x02, 0x06, 0x04, 0x09, 0x05, 0x01, 0x02, 0x05, 0x05, 0x09, 0x05, 0x02, 0x02,
+	0x05, 0x04, 0x0A, 0x05, 0x01, 0x02, 0x04, 0x05, 0x0A, 0x05, 0x01, 0x02, 0x04, 0x04, 0x0B, 0x05,
+	0x01, 0x02, 0x03, 0x05, 0x0B, 0x05, 0x01, 0x01, 0x03, 0x15, 0x03, 0x01, 0x00, 0x1A,
+	// @17756 0xE5 (23 pixels wide)
+	0x12, 0x00, 0x01, 0x01, 0x08, 0x08, 0x01, 0x01, 0x06, 0x0C, 0x01, 0x01, 0x04, 0x0F, 0x01, 0x02,
+	0x03, 0x06, 0x05, 0x06, 0x01, 0x02, 0x03, 0x05, 0x08, 0x05, 0x01, 0x02, 0x02, 0x05, 0x0A, 0x04,
+	0x01, 0x02, 0x01, 0x05, 0x0B, 0x05, 0x02, 0x02, 0x01, 0x04, 0x0D, 0x04, 0x01, 0x02, 0x00, 0x05,
+	0x0D, 0x04, 0x01, 0x02, 0x00, 0x05, 0x0D, 0x05, 0x03, 0x01, 0x00, 0x17, 0x04, 0x01, 0x00, 0x05,
+	0x01, 0x01, 0x01, 0x04, 0x01, 0x01, 0x01, 0x05, 0x01, 0x01, 0x02, 0x05, 0x01, 0x01, 0x02, 0x06,
+	0x01, 0x02, 0x03, 0x07, 0x07, 0x04, 0x01, 0x01, 0x04, 0x11, 0x01, 0x01, 0x05, 0x10, 0x01, 0x01,
+	0x07, 0x0D,
+	// @17854 0xE6 (34 pixels wide)
+	0x12, 0x00, 0x01, 0x03, 0x00, 0x05, 0x09, 0x05, 0x09, 0x06, 0x01, 0x03, 0x01, 0x05, 0x08, 0x05,
+	0x08, 0x06, 0x01, 0x03, 0x02, 0x05, 0x07, 0x05, 0x08, 0x05, 0x01, 0x03, 0x02, 0x05, 0x07, 0x05,
+	0x07, 0x05, 0x01, 0x03, 0x03, 0x05, 0x06, 0x05, 0x06, 0x05, 0x01, 0x03, 0x04, 0x05, 0x05, 0x05,
+	0x05, 0x05, 0x01, 0x03, 0x05, 0x05, 0x04, 0x05, 0x05, 0x04, 0x01, 0x03, 0x06, 0x04, 0x04, 0x05,
+	0x04, 0x04, 0x01, 0x03, 0x07, 0x04, 0x03, 0x05, 0x03, 0x05, 0x01, 0x03, 0x08, 0x04, 0x02, 0x05,
+	0x02, 0x05, 0x01, 0x03, 0x09, 0x04, 0x01, 0x05, 0x02, 0x04, 0x01, 0x02, 0x09, 0x0A, 0x01, 0x04,
+	0x01, 0x01, 0x08, 0x12, 0x01, 0x01, 0x06, 0x16, 0x01, 0x01, 0x05, 0x18, 0x01, 0x03, 0x04, 0x06,
+	0x04, 0x05, 0x04, 0x06, 0x01, 0x03, 0x03, 0x05, 0x06, 0x05, 0x06, 0x05, 0x01, 0x03, 0x03, 0x05,
+	0x06, 0x05, 0x07, 0x05, 0x01, 0x03, 0x02, 0x05, 0x07, 0x05, 0x07, 0x05, 0x01, 0x03, 0x02, 0x05,
+	0x07, 0x05, 0x08, 0x04, 0x01, 0x03, 0x02, 0x04, 0x08, 0x05, 0x08, 0x05, 0x01, 0x03, 0x01, 0x05,
+	0x08, 0x05, 0x09, 0x04, 0x01, 0x03, 0x01, 0x04, 0x09, 0x05, 0x09, 0x05, 0x01, 0x03, 0x00, 0x05,
+	0x09, 0x05, 0x09, 0x05, 0x01, 0x03, 0x00, 0x05, 0x09, 0x05, 0x0A, 0x04, 0x01, 0x03, 0x00, 0x04,
+	0x0A, 0x05, 0x0A, 0x05,
+	// @18050 0xE7 (19 pixels wide)
+	0x12, 0x00, 0x01, 0x01, 0x04, 0x09, 0x01, 0x01, 0x02, 0x0D, 0x01, 0x01, 0x01, 0x0F, 0x01, 0x02,
+	0x01, 0x04, 0x05, 0x07, 0x01, 0x02, 0x01, 0x01, 0x0A, 0x05, 0x01, 0x01, 0x0C, 0x06, 0x02, 0x01,
+	0x0D, 0x05, 0x02, 0x01, 0x0C, 0x05, 0x01, 0x01, 0x0A, 0x06, 0x01, 0x01, 0x04, 0x0A, 0x01, 0x01,
+	0x04, 0x08, 0x01, 0x01, 0x04, 0x0B, 0x01, 0x01, 0x09, 0x08, 0x01, 0x01, 0x0C, 0x06, 0x01, 0x01,
+	0x0D, 0x05, 0x03, 0x01, 0x0E, 0x05, 0x01, 0x01, 0x0D, 0x06, 0x01, 0x01, 0x0D, 0x05, 0x01, 0x02,
+	0x00, 0x03, 0x08, 0x07, 0x01, 0x01, 0x00, 0x11, 0x01, 0x01, 0x00, 0x10, 0x01, 0x01, 0x02, 0x0C,
+	// @18146 0xE8 (22 pixels wide)
+	0x12, 0x00, 0x01, 0x02, 0x00, 0x04, 0x0C, 0x06, 0x02, 0x02, 0x00, 0x04, 0x0B, 0x07, 0x02, 0x02,
+	0x00, 0x04, 0x0A, 0x08, 0x01, 0x02, 0x00, 0x04, 0x09, 0x09, 0x02, 0x03, 0x00, 0x04, 0x08, 0x04,
+	0x01, 0x05, 0x02, 0x03, 0x00, 0x04, 0x07, 0x04, 0x02, 0x05, 0x01, 0x03, 0x00, 0x04, 0x06, 0x04,
+	0x03, 0x05, 0x01, 0x03, 0x00, 0x04, 0x05, 0x05, 0x03, 0x05, 0x01, 0x03, 0x00, 0x04, 0x05, 0x04,
+	0x04, 0x05, 0x01, 0x03, 0x00, 0x04, 0x04, 0x05, 0x04, 0x05, 0x01, 0x03, 0x00, 0x04, 0x04, 0x04,
+	0x05, 0x05, 0x02, 0x03, 0x00, 0x04, 0x03, 0x04, 0x06, 0x05, 0x02, 0x03, 0x00, 0x04, 0x02, 0x04,
+	0x07, 0x05, 0x01, 0x03, 0x00, 0x04, 0x01, 0x04, 0x08, 0x05, 0x01, 0x03, 0x00, 0x04, 0x01, 0x03,
+	0x09, 0x05, 0x01, 0x02, 0x00, 0x08, 0x09, 0x05, 0x02, 0x02, 0x00, 0x07, 0x0A, 0x05, 0x01, 0x02,
+	0x00, 0x06, 0x0B, 0x05, 0x01, 0x02, 0x00, 0x05, 0x0C, 0x05,
+	// @18284 0xE9 (22 pixels wide)
+	0x08, 0x00, 0x01, 0x02, 0x04, 0x03, 0x07, 0x04, 0x01, 0x02, 0x04, 0x03, 0x07, 0x03, 0x01, 0x02,
+	0x04, 0x04, 0x05, 0x04, 0x01, 0x02, 0x05, 0x04, 0x03, 0x05, 0x01, 0x01, 0x05, 0x0B, 0x01, 0x01,
+	0x07, 0x08, 0x04, 0x00, 0x01, 0x02, 0x00, 0x04, 0x0C, 0x06, 0x02, 0x02, 0x00, 0x04, 0x0B, 0x07,
+	0x02, 0x02, 0x00, 0x04, 0x0A, 0x08, 0x01, 0x02, 0x00, 0x04, 0x09, 0x09, 0x02, 0x03, 0x00, 0x04,
+	0x08, 0x04, 0x01, 0x05, 0x02, 0x03, 0x00, 0x04, 0x07, 0x04, 0x02, 0x05, 0x01, 0x03, 0x00, 0x04,
+	0x06, 0x04, 0x03, 0x05, 0x01, 0x03, 0x00, 0x04, 0x05, 0x05, 0x03, 0x05, 0x01, 0x03, 0x00, 0x04,
+	0x05, 0x04, 0x04, 0x05, 0x01, 0x03, 0x00, 0x04, 0x04, 0x05, 0x04, 0x05, 0x01, 0x03, 0x00, 0x04,
+	0x04, 0x04, 0x05, 0x05, 0x02, 0x03, 0x00, 0x04, 0x03, 0x04, 0x06, 0x05, 0x02, 0x03, 0x00, 0x04,
+	0x02, 0x04, 0x07, 0x05, 0x01, 0x03, 0x00, 0x04, 0x01, 0x04, 0x08, 0x05, 0x01, 0x03, 0x00, 0x04,
+	0x01, 0x03, 0x09, 0x05, 0x01, 0x02, 0x00, 0x08, 0x09, 0x05, 0x02, 0x02, 0x00, 0x07, 0x0A, 0x05,
+	0x01, 0x02, 0x00, 0x06, 0x0B, 0x05, 0x01, 0x02, 0x00, 0x05, 0x0C, 0x05,
+	// @18456 0xEA (21 pixels wide)
+	0x12, 0x00, 0x01, 0x02, 0x00, 0x05, 0x0A, 0x06, 0x01, 0x02, 0x00, 0x05, 0x09, 0x06, 0x01, 0x02,
+	0x00, 0x05, 0x08, 0x06, 0x01, 0x02, 0x00, 0x05, 0x08, 0x05, 0x01, 0x02, 0x00, 0x05, 0x07, 0x05,
+	0x01, 0x02, 0x00, 0x05, 0x06, 0x05, 0x01, 0x02, 0x00, 0x05, 0x05, 0x05, 0x01, 0x02, 0x00, 0x05,
+	0x04, 0x05, 0x01, 0x02, 0x00, 0x05, 0x03, 0x05, 0x01, 0x02, 0x00, 0x05, 0x02, 0x05, 0x01, 0x02,
+	0x00, 0x05, 0x01, 0x05, 0x01, 0x01, 0x00, 0x0A, 0x01, 0x01, 0x00, 0x0C, 0x01, 0x01, 0x00, 0x0E,
+	0x01, 0x01, 0x00, 0x0F, 0x01, 0x02, 0x00, 0x05, 0x04, 0x07, 0x01, 0x02, 0x00, 0x05, 0x06, 0x06,
+	0x01, 0x02, 0x00, 0x05, 0x07, 0x05, 0x02, 0x02, 0x00, 0x05, 0x08, 0x05, 0x02, 0x02, 0x00, 0x05,
+	0x09, 0x05, 0x03, 0x02, 0x00, 0x05, 0x0A, 0x05, 0x01, 0x02, 0x00, 0x05, 0x0B, 0x05,
+	// @18582 0xEB (23 pixels wide)
+	0x12, 0x00, 0x04, 0x01, 0x05, 0x12, 0x0C, 0x02, 0x05, 0x05, 0x08, 0x05, 0x03, 0x02, 0x05, 0x04,
+	0x09, 0x05, 0x02, 0x02, 0x04, 0x05, 0x09, 0x05, 0x01, 0x02, 0x03, 0x05, 0x0A, 0x05, 0x01, 0x02,
+	0x01, 0x07, 0x0A, 0x05, 0x01, 0x02, 0x00, 0x07, 0x0B, 0x05, 0x01, 0x02, 0x00, 0x06, 0x0C, 0x05,
+	0x01, 0x02, 0x00, 0x05, 0x0D, 0x05,
+	// @18636 0xEC (30 pixels wide)
+	0x12, 0x00, 0x02, 0x02, 0x02, 0x06, 0x0E, 0x06, 0x03, 0x02, 0x02, 0x07, 0x0C, 0x07, 0x01, 0x02,
+	0x02, 0x08, 0x0A, 0x08, 0x01, 0x03, 0x02, 0x08, 0x0A, 0x03, 0x01, 0x04, 0x01, 0x04, 0x02, 0x03,
+	0x02, 0x03, 0x0A, 0x03, 0x01, 0x04, 0x01, 0x04, 0x02, 0x03, 0x02, 0x04, 0x08, 0x04, 0x01, 0x04,
+	0x01, 0x04, 0x01, 0x04, 0x02, 0x04, 0x08, 0x03, 0x02, 0x05, 0x02, 0x04, 0x01, 0x04, 0x03, 0x04,
+	0x06, 0x04, 0x03, 0x04, 0x01, 0x04, 0x01, 0x04, 0x03, 0x04, 0x06, 0x03, 0x04, 0x04, 0x02, 0x04,
+	0x01, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x01, 0x04, 0x01, 0x04, 0x04, 0x04, 0x04, 0x03,
+	0x05, 0x04, 0x01, 0x04, 0x01, 0x04, 0x05, 0x04, 0x02, 0x04, 0x05, 0x04, 0x02, 0x04, 0x01, 0x04,
+	0x05, 0x04, 0x02, 0x03, 0x06, 0x04, 0x01, 0x03, 0x01, 0x04, 0x06, 0x08, 0x06, 0x04, 0x02, 0x03,
+	0x01, 0x04, 0x06, 0x07, 0x07, 0x04, 0x01, 0x03, 0x00, 0x05, 0x07, 0x06, 0x07, 0x04, 0x02, 0x03,
+	0x00, 0x05, 0x07, 0x05, 0x08, 0x05, 0x01, 0x03, 0x00, 0x05, 0x08, 0x03, 0x09, 0x05,
+	// @18794 0xED (21 pixels wide)
+	0x12, 0x00, 0x0B, 0x02, 0x00, 0x04, 0x0D, 0x04, 0x03, 0x01, 0x00, 0x15, 0x0C, 0x02, 0x00, 0x04,
+	0x0D, 0x04,
+	// @18812 0xEE (25 pixels wide)
+	0x12, 0x00, 0x01, 0x01, 0x08, 0x09, 0x01, 0x01, 0x06, 0x0D, 0x01, 0x01, 0x05, 0x10, 0x01, 0x02,
+	0x04, 0x07, 0x04, 0x07, 0x01, 0x02, 0x03, 0x05, 0x09, 0x06, 0x01, 0x02, 0x02, 0x05, 0x0B, 0x05,
+	0x01, 0x02, 0x01, 0x06, 0x0C, 0x05, 0x01, 0x02, 0x01, 0x05, 0x0D, 0x05, 0x01, 0x02, 0x01, 0x05,
+	0x0E, 0x05, 0x08, 0x02, 0x00, 0x05, 0x0F, 0x05, 0x01, 0x02, 0x01, 0x04, 0x0F, 0x05, 0x02, 0x02,
+	0x01, 0x05, 0x0D, 0x05, 0x01, 0x02, 0x02, 0x05, 0x0B, 0x05, 0x01, 0x02, 0x02, 0x06, 0x09, 0x06,
+	0x01, 0x02, 0x03, 0x07, 0x05, 0x07, 0x01, 0x01, 0x04, 0x11, 0x01, 0x01, 0x05, 0x0F, 0x01, 0x01,
+	0x07, 0x0B,
+	// @18910 0xEF (21 pixels wide)
+	0x12, 0x00, 0x04, 0x01, 0x00, 0x15, 0x16, 0x02, 0x00, 0x04, 0x0C, 0x05,
+	// @18922 0xF0 (24 pixels wide)
+	0x12, 0x00, 0x01, 0x02, 0x00, 0x04, 0x05, 0x08, 0x01, 0x02, 0x00, 0x04, 0x03, 0x0C, 0x01, 0x02,
+	0x00, 0x04, 0x02, 0x0E, 0x01, 0x03, 0x00, 0x04, 0x01, 0x06, 0x01, 0x09, 0x01, 0x02, 0x00, 0x08,
+	0x08, 0x06, 0x01, 0x02, 0x00, 0x07, 0x0A, 0x06, 0x01, 0x02, 0x00, 0x06, 0x0C, 0x05, 0x01, 0x02,
+	0x00, 0x05, 0x0D, 0x05, 0x0A, 0x02, 0x00, 0x05, 0x0E, 0x05, 0x01, 0x02, 0x00, 0x05, 0x0D, 0x05,
+	0x01, 0x02, 0x00, 0x06, 0x0C, 0x05, 0x01, 0x02, 0x00, 0x06, 0x0B, 0x06, 0x01, 0x02, 0x00, 0x07,
+	0x09, 0x06, 0x01, 0x02, 0x00, 0x09, 0x05, 0x07, 0x01, 0x01, 0x00, 0x14, 0x01, 0x02, 0x00, 0x05,
+	0x01, 0x0D, 0x01, 0x02, 0x00, 0x05, 0x03, 0x09,
+	// @19026 0xF1 (20 pixels wide)
+	0x12, 0x00, 0x01, 0x01, 0x09, 0x0A, 0x01, 0x01, 0x07, 0x0D, 0x01, 0x01, 0x05, 0x0F, 0x01, 0x02,
+	0x04, 0x09, 0x01, 0x06, 0x01, 0x01, 0x03, 0x06, 0x01, 0x01, 0x02, 0x06, 0x01, 0x01, 0x02, 0x05,
+	0x02, 0x01, 0x01, 0x05, 0x08, 0x01, 0x00, 0x05, 0x01, 0x01, 0x00, 0x06, 0x01, 0x01, 0x01, 0x05,
+	0x01, 0x01, 0x01, 0x06, 0x01, 0x01, 0x02, 0x06, 0x01, 0x01, 0x02, 0x07, 0x01, 0x02, 0x03, 0x08,
+	0x05, 0x04, 0x01, 0x01, 0x04, 0x10, 0x01, 0x01, 0x05, 0x0F, 0x01, 0x01, 0x07, 0x0C,
+	// @19104 0xF2 (20 pixels wide)
+	0x12, 0x00, 0x04, 0x01, 0x00, 0x14, 0x16, 0x01, 0x08, 0x04,
+	// @19114 0xF3 (24 pixels wide)
+	0x12, 0x00, 0x01, 0x02, 0x00, 0x05, 0x0E, 0x05, 0x02, 0x02, 0x00, 0x05, 0x0D, 0x05, 0x01, 0x02,
+	0x01, 0x05, 0x0C, 0x04, 0x01, 0x02, 0x01, 0x05, 0x0B, 0x05, 0x01, 0x02, 0x02, 0x04, 0x0B, 0x05,
+	0x01, 0x02, 0x02, 0x05, 0x0A, 0x04, 0x01, 0x02, 0x02, 0x05, 0x09, 0x05, 0x02, 0x02, 0x03, 0x05,
+	0x08, 0x04, 0x01, 0x02, 0x04, 0x04, 0x07, 0x05, 0x02, 0x02, 0x04, 0x05, 0x06, 0x04, 0x01, 0x02,
+	0x05, 0x04, 0x05, 0x05, 0x01, 0x02, 0x05, 0x05, 0x04, 0x04, 0x01, 0x02, 0x06, 0x04, 0x04, 0x04,
+	0x01, 0x02, 0x06, 0x04, 0x03, 0x04, 0x01, 0x02, 0x06, 0x05, 0x02, 0x04, 0x01, 0x02, 0x07, 0x04,
+	0x02, 0x04, 0x01, 0x02, 0x07, 0x04, 0x01, 0x04, 0x01, 0x01, 0x08, 0x08, 0x02, 0x01, 0x08, 0x07,
+	0x01, 0x01, 0x09, 0x06, 0x02, 0x01, 0x09, 0x05,
+	// @19234 0xF4 (30 pixels wide)
+	0x06, 0x00, 0x0C, 0x01, 0x0D, 0x04, 0x01, 0x01, 0x09, 0x0C, 0x01, 0x01, 0x07, 0x10, 0x01, 0x01,
+	0x05, 0x14, 0x01, 0x03, 0x04, 0x07, 0x02, 0x04, 0x02, 0x07, 0x01, 0x03, 0x03, 0x06, 0x04, 0x04,
+	0x04, 0x06, 0x01, 0x03, 0x02, 0x06, 0x05, 0x04, 0x05, 0x06, 0x01, 0x03, 0x02, 0x05, 0x06, 0x04,
+	0x06, 0x06, 0x01, 0x03, 0x01, 0x05, 0x07, 0x04, 0x07, 0x05, 0x01, 0x03, 0x01, 0x05, 0x07, 0x04,
+	0x08, 0x04, 0x08, 0x03, 0x00, 0x05, 0x08, 0x04, 0x08, 0x05, 0x01, 0x03, 0x01, 0x04, 0x08, 0x04,
+	0x08, 0x04, 0x02, 0x03, 0x01, 0x05, 0x07, 0x04, 0x07, 0x05, 0x01, 0x03, 0x02, 0x05, 0x06, 0x04,
+	0x06, 0x05, 0x01, 0x03, 0x03, 0x05, 0x05, 0x04, 0x05, 0x05, 0x01, 0x03, 0x03, 0x07, 0x03, 0x04,
+	0x03, 0x07, 0x01, 0x01, 0x04, 0x15, 0x01, 0x01, 0x06, 0x12, 0x01, 0x01, 0x08, 0x0E,
+	// @19360 0xF5 (23 pixels wide)
+	0x12, 0x00, 0x01, 0x02, 0x00, 0x05, 0x0D, 0x05, 0x01, 0x02, 0x01, 0x05, 0x0B, 0x05, 0x01, 0x02,
+	0x01, 0x05, 0x0A, 0x05, 0x01, 0x02, 0x02, 0x05, 0x09, 0x04, 0x01, 0x02, 0x03, 0x05, 0x07, 0x05,
+	0x01, 0x02, 0x03, 0x05, 0x06, 0x05, 0x01, 0x02, 0x04, 0x05, 0x05, 0x04, 0x01, 0x02, 0x05, 0x05,
+	0x03, 0x05, 0x01, 0x02, 0x05, 0x05, 0x02, 0x05, 0x01, 0x02, 0x06, 0x05, 0x01, 0x04, 0x01, 0x01,
+	0x07, 0x09, 0x01, 0x01, 0x08, 0x07, 0x02, 0x01, 0x08, 0x06, 0x01, 0x01, 0x07, 0x08, 0x01, 0x01,
+	0x07, 0x09, 0x01, 0x02, 0x06, 0x05, 0x01, 0x04, 0x01, 0x02, 0x05, 0x05, 0x02, 0x05, 0x01, 0x02,
+	0x05, 0x04, 0x04, 0x05, 0x01, 0x02, 0x04, 0x05, 0x04, 0x06, 0x01, 0x02, 0x03, 0x05, 0x06, 0x05,
+	0x01, 0x02, 0x03, 0x04, 0x08, 0x05, 0x01, 0x02, 0x02, 0x05, 0x08, 0x06, 0x01, 0x02, 0x01, 0x05,
+	0x0A, 0x05, 0x01, 0x02, 0x00, 0x06, 0x0B, 0x05, 0x01, 0x02, 0x00, 0x05, 0x0C, 0x06,
+	// @19502 0xF6 (23 pixels wide)
+	0x12, 0x00, 0x16, 0x02, 0x00, 0x04, 0x0C, 0x05, 0x01, 0x01, 0x00, 0x15, 0x03, 0x01, 0x00, 0x17,
+	// @19518 0xF7 (21 pixels wide)
+	0x12, 0x00, 0x0B, 0x02, 0x00, 0x05, 0x0B, 0x05, 0x01, 0x02, 0x01, 0x04, 0x0B, 0x05, 0x01, 0x02,
+	0x01, 0x05, 0x0A, 0x05, 0x01, 0x02, 0x01, 0x06, 0x08, 0x06, 0x02, 0x01, 0x02, 0x13, 0x01, 0x02,
+	0x04, 0x0B, 0x01, 0x05, 0x01, 0x02, 0x06, 0x06, 0x04, 0x05, 0x08, 0x01, 0x10, 0x05,
+	// @19564 0xF8 (31 pixels wide)
+	0x12, 0x00, 0x16, 0x03, 0x00, 0x04, 0x09, 0x05, 0x09, 0x04, 0x04, 0x01, 0x00, 0x1F,
+	// @19578 0xF9 (34 pixels wide)
+	0x12, 0x00, 0x16, 0x03, 0x00, 0x04, 0x09, 0x05, 0x09, 0x04, 0x01, 0x01, 0x00, 0x1F, 0x03, 0x01,
+	0x00, 0x22,
+	// @19596 0xFA (28 pixels wide)
+	0x12, 0x00, 0x04, 0x01, 0x00, 0x0C, 0x05, 0x01, 0x07, 0x05, 0x01, 0x01, 0x07, 0x0F, 0x01, 0x01,
+	0x07, 0x11, 0x01, 0x01, 0x07, 0x12, 0x01, 0x02, 0x07, 0x05, 0x07, 0x07, 0x01, 0x02, 0x07, 0x05,
+	0x09, 0x06, 0x01, 0x02, 0x07, 0x05, 0x0A, 0x05, 0x05, 0x02, 0x07, 0x05, 0x0B, 0x05, 0x01, 0x02,
+	0x07, 0x05, 0x0A, 0x05, 0x01, 0x02, 0x07, 0x05, 0x09, 0x06, 0x01, 0x02, 0x07, 0x05, 0x07, 0x07,
+	0x01, 0x01, 0x07, 0x12, 0x01, 0x01, 0x07, 0x10, 0x01, 0x01, 0x07, 0x0E,
+	// @19672 0xFB (28 pixels wide)
+	0x12, 0x00, 0x09, 0x02, 0x00, 0x04, 0x13, 0x05, 0x01, 0x02, 0x00, 0x0E, 0x09, 0x05, 0x01, 0x02,
+	0x00, 0x10, 0x07, 0x05, 0x01, 0x02, 0x00, 0x11, 0x06, 0x05, 0x01, 0x03, 0x00, 0x04, 0x07, 0x07,
+	0x05, 0x05, 0x01, 0x03, 0x00, 0x04, 0x09, 0x06, 0x04, 0x05, 0x01, 0x03, 0x00, 0x04, 0x0A, 0x05,
+	0x04, 0x05, 0x01, 0x03, 0x00, 0x04, 0x0B, 0x04, 0x04, 0x05, 0x03, 0x03, 0x00, 0x04, 0x0B, 0x05,
+	0x03, 0x05, 0x01, 0x03, 0x00, 0x04, 0x0B, 0x04, 0x04, 0x05, 0x01, 0x03, 0x00, 0x04, 0x0A, 0x05,
+	0x04, 0x05, 0x01, 0x03, 0x00, 0x04, 0x09, 0x06, 0x04, 0x05, 0x01, 0x03, 0x00, 0x04, 0x07, 0x07,
+	0x05, 0x05, 0x01, 0x02, 0x00, 0x11, 0x06, 0x05, 0x01, 0x02, 0x00, 0x0F, 0x08, 0x05, 0x01, 0x02,
+	0x00, 0x0D, 0x0A, 0x05,
+	// @19788 0xFC (20 pixels wide)
+	0x12, 0x00, 0x09, 0x01, 0x00, 0x04, 0x01, 0x01, 0x00, 0x0E, 0x01, 0x01, 0x00, 0x11, 0x01, 0x01,
+	0x00, 0x12, 0x01, 0x02, 0x00, 0x04, 0x07, 0x08, 0x01, 0x02, 0x00, 0x04, 0x0A, 0x06, 0x02, 0x02,
+	0x00, 0x04, 0x0B, 0x05, 0x03, 0x02, 0x00, 0x04, 0x0C, 0x04, 0x02, 0x02, 0x00, 0x04, 0x0B, 0x05,
+	0x01, 0x02, 0x00, 0x04, 0x0A, 0x05, 0x01, 0x02, 0x00, 0x04, 0x07, 0x08, 0x01, 0x01, 0x00, 0x12,
+	0x01, 0x01, 0x00, 0x10, 0x01, 0x01, 0x00, 0x0D,
+	// @19860 0xFD (21 pixels wide)
+	0x12, 0x00, 0x01, 0x01, 0x03, 0x0A, 0x01, 0x01, 0x00, 0x0F, 0x01, 0x01, 0x00, 0x10, 0x01, 0x02,
+	0x00, 0x05, 0x04, 0x08, 0x01, 0x02, 0x01, 0x01, 0x0A, 0x06, 0x01, 0x01, 0x0D, 0x06, 0x01, 0x01,
+	0x0E, 0x05, 0x02, 0x01, 0x0F, 0x05, 0x02, 0x01, 0x10, 0x04, 0x01, 0x01, 0x03, 0x11, 0x03, 0x01,
+	0x03, 0x12, 0x01, 0x01, 0x10, 0x04, 0x03, 0x01, 0x0F, 0x05, 0x01, 0x01, 0x0E, 0x05, 0x01, 0x01,
+	0x0D, 0x06, 0x01, 0x01, 0x0C, 0x06, 0x01, 0x02, 0x00, 0x03, 0x07, 0x07, 0x01, 0x01, 0x00, 0x10,
+	0x01, 0x01, 0x00, 0x0F, 0x01, 0x01, 0x01, 0x0C,
+	// @19948 0xFE (31 pixels wide)
+	0x12, 0x00, 0x01, 0x02, 0x00, 0x04, 0x0C, 0x08, 0x01, 0x02, 0x00, 0x04, 0x0A, 0x0C, 0x01, 0x02,
+	0x00, 0x04, 0x09, 0x0E, 0x01, 0x03, 0x00, 0x04, 0x08, 0x06, 0x04, 0x06, 0x01, 0x03, 0x00, 0x04,
+	0x07, 0x05, 0x07, 0x06, 0x01, 0x03, 0x00, 0x04, 0x06, 0x05, 0x09, 0x06, 0x01, 0x03, 0x00, 0x04,
+	0x06, 0x05, 0x0A, 0x05, 0x01, 0x03, 0x00, 0x04, 0x06, 0x04, 0x0C, 0x05, 0x01, 0x03, 0x00, 0x04,
+	0x05, 0x05, 0x0C, 0x05, 0x02, 0x03, 0x00, 0x04, 0x05, 0x04, 0x0D, 0x05, 0x04, 0x02, 0x00, 0x0D,
+	0x0E, 0x04, 0x01, 0x03, 0x00, 0x04, 0x05, 0x04, 0x0E, 0x04, 0x01, 0x03, 0x00, 0x04, 0x05, 0x04,
+	0x0D, 0x05, 0x02, 0x03, 0x00, 0x04, 0x05, 0x05, 0x0C, 0x05, 0x01, 0x03, 0x00, 0x04, 0x06, 0x04,
+	0x0B, 0x05, 0x01, 0x03, 0x00, 0x04, 0x06, 0x05, 0x0A, 0x05, 0x01, 0x03, 0x00, 0x04, 0x07, 0x05,
+	0x08, 0x05, 0x01, 0x03, 0x00, 0x04, 0x07, 0x06, 0x06, 0x05, 0x01, 0x02, 0x00, 0x04, 0x08, 0x0F,
+	0x01, 0x02, 0x00, 0x04, 0x09, 0x0D, 0x01, 0x02, 0x00, 0x04, 0x0B, 0x0A,
+	// @20104 0xFF (23 pixels wide)
+	0x11, 0x00, 0x01, 0x01, 0x07, 0x10, 0x01, 0x01, 0x04, 0x13, 0x01, 0x01, 0x03, 0x14, 0x01, 0x01,
+	0x02, 0x15, 0x01, 0x02, 0x02, 0x06, 0x0A, 0x05, 0x01, 0x02, 0x01, 0x06, 0x0B, 0x05, 0x04, 0x02,
+	0x01, 0x05, 0x0C, 0x05, 0x01, 0x02, 0x01, 0x06, 0x0B, 0x05, 0x01, 0x02, 0x02, 0x07, 0x09, 0x05,
+	0x01, 0x01, 0x03, 0x14, 0x01, 0x01, 0x04, 0x13, 0x01, 0x01, 0x06, 0x11, 0x01, 0x01, 0x08, 0x0F,
+	0x01, 0x02, 0x06, 0x06, 0x06, 0x05, 0x02, 0x02, 0x05, 0x05, 0x08, 0x05, 0x01, 0x02, 0x04, 0x05,
+	0x09, 0x05, 0x01, 0x02, 0x03, 0x06, 0x09, 0x05, 0x01, 0x02, 0x03, 0x05, 0x0A, 0x05, 0x01, 0x02,
+	0x02, 0x06, 0x0A, 0x05, 0x01, 0x02, 0x02, 0x05, 0x0B, 0x05, 0x01, 0x02, 0x01, 0x06, 0x0B, 0x05,
+	0x01, 0x02, 0x01, 0x05, 0x0C, 0x05, 0x01, 0x02, 0x00, 0x06, 0x0C, 0x05,
+};
+
+const struct FONT_CHAR_INFO RIAD_40ptRLEDescriptors[] = 
+{
+	{2, 0}, 		// 0x20
+	{6, 2}, 		// 0x21
+	{12, 26}, 		// 0x22
+	{22, 48}, 		// 0x23
+	{19, 148}, 		// 0x24
+	{38, 272}, 		// 0x25
+	{29, 536}, 		// 0x26
+	{4, 754}, 		// 0x27
+	{11, 766}, 		// 0x28
+	{11, 840}, 		// 0x29
+	{18, 914}, 		// 0x2A
+	{27, 1020}, 		// 0x2B
+	{8, 1034}, 		// 0x2C
+	{13, 1056}, 		// 0x2D
+	{6, 1064}, 		// 0x2E
+	{18, 1078}, 		// 0x2F
+	{23, 1188}, 		// 0x30
+	{11, 1326}, 		// 0x31
+	{22, 1366}, 		// 0x32
+	{22, 1484}, 		// 0x33
+	{25, 1602}, 		// 0x34
+	{22, 1712}, 		// 0x35
+	{23, 1802}, 		// 0x36
+	{22, 1948}, 		// 0x37
+	{23, 2070}, 		// 0x38
+	{23, 2238}, 		// 0x39
+	{6, 2380}, 		// 0x3A
+	{5, 2412}, 		// 0x3B
+	{25, 2424}, 		// 0x3C
+	{27, 2534}, 		// 0x3D
+	{25, 2548}, 		// 0x3E
+	{16, 2662}, 		// 0x3F
+	{35, 2744}, 		// 0x40
+	{30, 2984}, 		// 0x41
+	{23, 3140}, 		// 0x42
+	{27, 3300}, 		// 0x43
+	{29, 3400}, 		// 0x44
+	{20, 3532}, 		// 0x45
+	{19, 3554}, 		// 0x46
+	{29, 3572}, 		// 0x47
+	{27, 3706}, 		// 0x48
+	{5, 3724}, 		// 0x49
+	{16, 3730}, 		// 0x4A
+	{25, 3762}, 		// 0x4B
+	{20, 3970}, 		// 0x4C
+	{37, 3980}, 		// 0x4D
+	{27, 4236}, 		// 0x4E
+	{33, 4442}, 		// 0x4F
+	{22, 4606}, 		// 0x50
+	{33, 4692}, 		// 0x51
+	{23, 4856}, 		// 0x52
+	{22, 4988}, 		// 0x53
+	{26, 5102}, 		// 0x54
+	{26, 5112}, 		// 0x55
+	{30, 5174}, 		// 0x56
+	{43, 5342}, 		// 0x57
+	{27, 5660}, 		// 0x58
+	{27, 5836}, 		// 0x59
+	{26, 5956}, 		// 0x5A
+	{10, 6058}, 		// 0x5B
+	{18, 6068}, 		// 0x5C
+	{10, 6182}, 		// 0x5D
+	{25, 6192}, 		// 0x5E
+	{27, 6332}, 		// 0x5F
+	{10, 6334}, 		// 0x60
+	{20, 6370}, 		// 0x61
+	{24, 6476}, 		// 0x62
+	{20, 6586}, 		// 0x63
+	{24, 6664}, 		// 0x64
+	{23, 6774}, 		// 0x65
+	{16, 6872}, 		// 0x66
+	{24, 6914}, 		// 0x67
+	{22, 7032}, 		// 0x68
+	{6, 7090}, 		// 0x69
+	{12, 7118}, 		// 0x6A
+	{21, 7146}, 		// 0x6B
+	{5, 7298}, 		// 0x6C
+	{37, 7304}, 		// 0x6D
+	{22, 7388}, 		// 0x6E
+	{25, 7444}, 		// 0x6F
+	{24, 7542}, 		// 0x70
+	{24, 7646}, 		// 0x71
+	{13, 7752}, 		// 0x72
+	{17, 7794}, 		// 0x73
+	{15, 7892}, 		// 0x74
+	{22, 7928}, 		// 0x75
+	{24, 7984}, 		// 0x76
+	{37, 8110}, 		// 0x77
+	{23, 8322}, 		// 0x78
+	{24, 8464}, 		// 0x79
+	{21, 8584}, 		// 0x7A
+	{13, 8674}, 		// 0x7B
+	{3, 8732}, 		// 0x7C
+	{13, 8738}, 		// 0x7D
+	{26, 8796}, 		// 0x7E
+	{2, 8850}, 		// 0x7F
+	{2, 8852}, 		// 0x80
+	{2, 8854}, 		// 0x81
+	{7, 8856}, 		// 0x82
+	{27, 8870}, 		// 0x83
+	{18, 8946}, 		// 0x84
+	{2, 8966}, 		// 0x85
+	{21, 8968}, 		// 0x86
+	{21, 9066}, 		// 0x87
+	{17, 9192}, 		// 0x88
+	{44, 9216}, 		// 0x89
+	{24, 9604}, 		// 0x8A
+	{12, 9784}, 		// 0x8B
+	{52, 9874}, 		// 0x8C
+	{2, 10072}, 		// 0x8D
+	{2, 10074}, 		// 0x8E
+	{2, 10076}, 		// 0x8F
+	{2, 10078}, 		// 0x90
+	{7, 10080}, 		// 0x91
+	{7, 10132}, 		// 0x92
+	{20, 10184}, 		// 0x93
+	{20, 10260}, 		// 0x94
+	{2, 10336}, 		// 0x95
+	{18, 10338}, 		// 0x96
+	{52, 10346}, 		// 0x97
+	{16, 10354}, 		// 0x98
+	{50, 10392}, 		// 0x99
+	{17, 10648}, 		// 0x9A
+	{12, 10786}, 		// 0x9B
+	{32, 10880}, 		// 0x9C
+	{2, 11044}, 		// 0x9D
+	{2, 11046}, 		// 0x9E
+	{37, 11048}, 		// 0x9F
+	{2, 11202}, 		// 0xA0
+	{6, 11204}, 		// 0xA1
+	{19, 11232}, 		// 0xA2
+	{22, 11314}, 		// 0xA3
+	{24, 11382}, 		// 0xA4
+	{25, 11522}, 		// 0xA5
+	{3, 11622}, 		// 0xA6
+	{21, 11634}, 		// 0xA7
+	{15, 11794}, 		// 0xA8
+	{32, 11828}, 		// 0xA9
+	{14, 12030}, 		// 0xAA
+	{19, 12112}, 		// 0xAB
+	{27, 12230}, 		// 0xAC
+	{2, 12242}, 		// 0xAD
+	{18, 12244}, 		// 0xAE
+	{12, 12362}, 		// 0xAF
+	{14, 12370}, 		// 0xB0
+	{27, 12436}, 		// 0xB1
+	{14, 12456}, 		// 0xB2
+	{14, 12532}, 		// 0xB3
+	{9, 12608}, 		// 0xB4
+	{24, 12644}, 		// 0xB5
+	{21, 12698}, 		// 0xB6
+	{7, 12772}, 		// 0xB7
+	{9, 12788}, 		// 0xB8
+	{8, 12790}, 		// 0xB9
+	{17, 12820}, 		// 0xBA
+	{19, 12886}, 		// 0xBB
+	{36, 13004}, 		// 0xBC
+	{36, 13200}, 		// 0xBD
+	{37, 13386}, 		// 0xBE
+	{16, 13608}, 		// 0xBF
+	{30, 13684}, 		// 0xC0
+	{23, 13840}, 		// 0xC1
+	{23, 13946}, 		// 0xC2
+	{19, 14106}, 		// 0xC3
+	{31, 14116}, 		// 0xC4
+	{20, 14186}, 		// 0xC5
+	{41, 14208}, 		// 0xC6
+	{22, 14482}, 		// 0xC7
+	{27, 14596}, 		// 0xC8
+	{27, 14788}, 		// 0xC9
+	{24, 15008}, 		// 0xCA
+	{28, 15170}, 		// 0xCB
+	{37, 15236}, 		// 0xCC
+	{27, 15492}, 		// 0xCD
+	{33, 15510}, 		// 0xCE
+	{26, 15674}, 		// 0xCF
+	{22, 15686}, 		// 0xD0
+	{27, 15772}, 		// 0xD1
+	{26, 15872}, 		// 0xD2
+	{28, 15882}, 		// 0xD3
+	{35, 16058}, 		// 0xD4
+	{27, 16260}, 		// 0xD5
+	{29, 16436}, 		// 0xD6
+	{24, 16448}, 		// 0xD7
+	{37, 16504}, 		// 0xD8
+	{40, 16518}, 		// 0xD9
+	{31, 16532}, 		// 0xDA
+	{31, 16638}, 		// 0xDB
+	{23, 16770}, 		// 0xDC
+	{26, 16872}, 		// 0xDD
+	{40, 16980}, 		// 0xDE
+	{24, 17168}, 		// 0xDF
+	{20, 17300}, 		// 0xE0
+	{24, 17406}, 		// 0xE1
+	{20, 17562}, 		// 0xE2
+	{16, 17684}, 		// 0xE3
+	{26, 17694}, 		// 0xE4
+	{23, 17756}, 		// 0xE5
+	{34, 17854}, 		// 0xE6
+	{19, 18050}, 		// 0xE7
+	{22, 18146}, 		// 0xE8
+	{22, 18284}, 		// 0xE9
+	{21, 18456}, 		// 0xEA
+	{23, 18582}, 		// 0xEB
+	{30, 18636}, 		// 0xEC
+	{21, 18794}, 		// 0xED
+	{25, 18812}, 		// 0xEE
+	{21, 18910}, 		// 0xEF
+	{24, 18922}, 		// 0xF0
+	{20, 19026}, 		// 0xF1
+	{20, 19104}, 		// 0xF2
+	{24, 19114}, 		// 0xF3
+	{30, 19234}, 		// 0xF4
+	{23, 19360}, 		// 0xF5
+	{23, 19502}, 		// 0xF6
+	{21, 19518}, 		// 0xF7
+	{31, 19564}, 		// 0xF8
+	{34, 19578}, 		// 0xF9
+	{28, 19596}, 		// 0xFA
+	{28, 19672}, 		// 0xFB
+	{20, 19788}, 		// 0xFC
+	{21, 19860}, 		// 0xFD
+	{31, 19948}, 		// 0xFE
+	{23, 20104}, 		// 0xFF
+};
+
+sFONT RIAD_40pt = {
+  0,
+  RIAD_40ptRLEDescriptors,
+  44, /* Height */
+  RIAD_40ptRLE,
+};
+#endif
@@ -0,0 +1,161 @@
+// 
+//  RIAD_40pt, 14 signs of RIAD_40pt.c run coded, made by Tools/font_subset.py, don't edit
+// 
+#include "variables.h"
+#include "fonts.h"
+
+#if RIAD_40pt_FROM == FONT_SUBSET
+static const uint8_t Signs[] = 
+{
+	// @0 0x20 (2 pixels wide)
+	0x2C, 0x00,
+	// @2 0x2D (13 pixels wide)
+	0x1C, 0x00, 0x03, 0x01, 0x00, 0x0D, 0x0D, 0x00,
+	// @10 0x2E (6 pixels wide)
+	0x26, 0x00, 0x01, 0x01, 0x01, 0x04, 0x04, 0x01, 0x00, 0x06, 0x01, 0x01, 0x01, 0x04,
+	// @24 0x30 (23 pixels wide)
+	0x09, 0x00, 0x01, 0x01, 0x08, 0x07, 0x01, 0x01, 0x06, 0x0B, 0x01, 0x01, 0x05, 0x0E, 0x01, 0x01,
+	0x04, 0x10, 0x01, 0x02, 0x03, 0x06, 0x06, 0x05, 0x01, 0x02, 0x03, 0x05, 0x08, 0x05, 0x01, 0x02,
+	0x02, 0x05, 0x0A, 0x04, 0x01, 0x02, 0x02, 0x04, 0x0B, 0x05, 0x01, 0x02, 0x01, 0x05, 0x0B, 0x05,
+	0x01, 0x02, 0x01, 0x05, 0x0C, 0x04, 0x01, 0x02, 0x01, 0x04, 0x0D, 0x05, 0x03, 0x02, 0x00, 0x05,
+	0x0D, 0x05, 0x07, 0x02, 0x00, 0x05, 0x0E, 0x04, 0x03, 0x02, 0x00, 0x05, 0x0D, 0x05, 0x01, 0x02,
+	0x01, 0x04, 0x0D, 0x05, 0x01, 0x02, 0x01, 0x04, 0x0D, 0x04, 0x01, 0x02, 0x01, 0x05, 0x0C, 0x04,
+	0x01, 0x02, 0x01, 0x05, 0x0B, 0x05, 0x01, 0x02, 0x02, 0x05, 0x0A, 0x04, 0x01, 0x02, 0x02, 0x05,
+	0x09, 0x05, 0x01, 0x02, 0x03, 0x05, 0x07, 0x05, 0x01, 0x02, 0x03, 0x06, 0x05, 0x06, 0x01, 0x01,
+	0x04, 0x0F, 0x01, 0x01, 0x05, 0x0D, 0x01, 0x01, 0x07, 0x09,
+	// @162 0x31 (11 pixels wide)
+	0x0A, 0x00, 0x01, 0x01, 0x05, 0x06, 0x01, 0x01, 0x03, 0x08, 0x01, 0x01, 0x02, 0x09, 0x01, 0x01,
+	0x00, 0x0B, 0x01, 0x02, 0x00, 0x05, 0x01, 0x05, 0x01, 0x02, 0x00, 0x03, 0x03, 0x05, 0x01, 0x02,
+	0x00, 0x02, 0x04, 0x05, 0x1B, 0x01, 0x06, 0x05,
+	// @202 0x32 (22 pixels wide)
+	0x09, 0x00, 0x01, 0x01, 0x07, 0x08, 0x01, 0x01, 0x04, 0x0D, 0x01, 0x01, 0x03, 0x0F, 0x01, 0x01,
+	0x01, 0x12, 0x01, 0x02, 0x02, 0x05, 0x07, 0x06, 0x01, 0x02, 0x02, 0x03, 0x0A, 0x06, 0x02, 0x01,
+	0x10, 0x05, 0x01, 0x01, 0x11, 0x04, 0x02, 0x01, 0x11, 0x05, 0x02, 0x01, 0x11, 0x04, 0x02, 0x01,
+	0x10, 0x05, 0x01, 0x01, 0x10, 0x04, 0x01, 0x01, 0x0F, 0x05, 0x02, 0x01, 0x0E, 0x05, 0x01, 0x01,
+	0x0D, 0x05, 0x01, 0x01, 0x0C, 0x05, 0x01, 0x01, 0x0B, 0x05, 0x01, 0x01, 0x0A, 0x05, 0x01, 0x01,
+	0x09, 0x06, 0x01, 0x01, 0x08, 0x06, 0x01, 0x01, 0x07, 0x06, 0x01, 0x01, 0x06, 0x06, 0x01, 0x01,
+	0x05, 0x06, 0x01, 0x01, 0x04, 0x06, 0x01, 0x01, 0x03, 0x06, 0x01, 0x01, 0x02, 0x06, 0x01, 0x01,
+	0x01, 0x15, 0x03, 0x01, 0x00, 0x16,
+	// @320 0x33 (22 pixels wide)
+	0x09, 0x00, 0x01, 0x01, 0x06, 0x09, 0x01, 0x01, 0x03, 0x0E, 0x01, 0x01, 0x02, 0x10, 0x01, 0x01,
+	0x02, 0x11, 0x01, 0x02, 0x02, 0x04, 0x07, 0x07, 0x01, 0x02, 0x03, 0x01, 0x0A, 0x06, 0x01, 0x01,
+	0x0F, 0x05, 0x03, 0x01, 0x10, 0x04, 0x02, 0x01, 0x0F, 0x05, 0x01, 0x01, 0x0E, 0x05, 0x01, 0x01,
+	0x0D, 0x06, 0x01, 0x01, 0x0A, 0x07, 0x01, 0x01, 0x05, 0x0B, 0x01, 0x01, 0x05, 0x09, 0x01, 0x01,
+	0x05, 0x0C, 0x01, 0x01, 0x0B, 0x08, 0x01, 0x01, 0x0E, 0x06, 0x01, 0x01, 0x0F, 0x05, 0x02, 0x01,
+	0x10, 0x05, 0x05, 0x01, 0x11, 0x05, 0x01, 0x01, 0x10, 0x05, 0x01, 0x01, 0x0F, 0x06, 0x01, 0x02,
+	0x01, 0x02, 0x0B, 0x06, 0x01, 0x02, 0x01, 0x05, 0x06, 0x08, 0x01, 0x01, 0x00, 0x13, 0x01, 0x01,
+	0x01, 0x10, 0x01, 0x01, 0x03, 0x0C,
+	// @438 0x34 (25 pixels wide)
+	0x0A, 0x00, 0x01, 0x01, 0x0F, 0x05, 0x01, 0x01, 0x0E, 0x06, 0x01, 0x01, 0x0D, 0x07, 0x02, 0x01,
+	0x0C, 0x08, 0x01, 0x02, 0x0B, 0x04, 0x01, 0x04, 0x02, 0x02, 0x0A, 0x04, 0x02, 0x04, 0x01, 0x02,
+	0x09, 0x04, 0x03, 0x04, 0x01, 0x02, 0x08, 0x05, 0x03, 0x04, 0x01, 0x02, 0x08, 0x04, 0x04, 0x04,
+	0x01, 0x02, 0x07, 0x04, 0x05, 0x04, 0x01, 0x02, 0x06, 0x05, 0x05, 0x04, 0x01, 0x02, 0x05, 0x05,
+	0x06, 0x04, 0x01, 0x02, 0x05, 0x04, 0x07, 0x04, 0x01, 0x02, 0x04, 0x04, 0x08, 0x04, 0x01, 0x02,
+	0x03, 0x05, 0x08, 0x04, 0x01, 0x02, 0x03, 0x04, 0x09, 0x04, 0x01, 0x02, 0x02, 0x04, 0x0A, 0x04,
+	0x02, 0x02, 0x01, 0x04, 0x0B, 0x04, 0x04, 0x01, 0x00, 0x19, 0x09, 0x01, 0x10, 0x04,
+	// @548 0x35 (22 pixels wide)
+	0x0A, 0x00, 0x03, 0x01, 0x04, 0x11, 0x03, 0x01, 0x04, 0x04, 0x01, 0x01, 0x04, 0x03, 0x05, 0x01,
+	0x03, 0x04, 0x01, 0x01, 0x03, 0x0A, 0x01, 0x01, 0x03, 0x0D, 0x01, 0x01, 0x02, 0x10, 0x01, 0x01,
+	0x02, 0x11, 0x01, 0x01, 0x0C, 0x08, 0x01, 0x01, 0x0E, 0x06, 0x01, 0x01, 0x0F, 0x06, 0x02, 0x01,
+	0x10, 0x05, 0x04, 0x01, 0x11, 0x05, 0x01, 0x01, 0x11, 0x04, 0x02, 0x01, 0x10, 0x05, 0x01, 0x01,
+	0x0F, 0x05, 0x01, 0x02, 0x01, 0x02, 0x0B, 0x06, 0x01, 0x02, 0x01, 0x05, 0x05, 0x08, 0x01, 0x01,
+	0x01, 0x11, 0x01, 0x01, 0x00, 0x10, 0x01, 0x01, 0x02, 0x0D,
+	// @638 0x36 (23 pixels wide)
+	0x09, 0x00, 0x01, 0x01, 0x0F, 0x05, 0x01, 0x01, 0x0C, 0x08, 0x01, 0x01, 0x0A, 0x0A, 0x01, 0x01,
+	0x08, 0x0C, 0x01, 0x01, 0x07, 0x08, 0x01, 0x01, 0x06, 0x06, 0x01, 0x01, 0x05, 0x05, 0x01, 0x01,
+	0x04, 0x05, 0x01, 0x01, 0x03, 0x05, 0x02, 0x01, 0x02, 0x05, 0x01, 0x01, 0x02, 0x04, 0x01, 0x02,
+	0x01, 0x05, 0x05, 0x05, 0x01, 0x02, 0x01, 0x04, 0x03, 0x0A, 0x01, 0x02, 0x01, 0x04, 0x01, 0x0E,
+	0x01, 0x01, 0x00, 0x15, 0x01, 0x02, 0x00, 0x09, 0x06, 0x06, 0x01, 0x02, 0x00, 0x07, 0x09, 0x06,
+	0x01, 0x02, 0x00, 0x06, 0x0B, 0x06, 0x02, 0x02, 0x00, 0x05, 0x0D, 0x05, 0x03, 0x02, 0x00, 0x04,
+	0x0F, 0x04, 0x02, 0x02, 0x00, 0x05, 0x0E, 0x04, 0x02, 0x02, 0x01, 0x04, 0x0D, 0x05, 0x01, 0x02,
+	0x01, 0x05, 0x0C, 0x04, 0x01, 0x02, 0x02, 0x05, 0x0A, 0x05, 0x01, 0x02, 0x02, 0x06, 0x08, 0x05,
+	0x01, 0x02, 0x03, 0x06, 0x06, 0x06, 0x01, 0x01, 0x04, 0x10, 0x01, 0x01, 0x05, 0x0E, 0x01, 0x01,
+	0x07, 0x0A,
+	// @784 0x37 (22 pixels wide)
+	0x0A, 0x00, 0x03, 0x01, 0x00, 0x16, 0x01, 0x01, 0x11, 0x04, 0x01, 0x01, 0x10, 0x05, 0x01, 0x01,
+	0x10, 0x04, 0x01, 0x01, 0x0F, 0x05, 0x01, 0x01, 0x0F, 0x04, 0x01, 0x01, 0x0E, 0x05, 0x01, 0x01,
+	0x0E, 0x04, 0x02, 0x01, 0x0D, 0x05, 0x02, 0x01, 0x0C, 0x05, 0x01, 0x01, 0x0C, 0x04, 0x01, 0x01,
+	0x0B, 0x05, 0x01, 0x01, 0x0B, 0x04, 0x01, 0x01, 0x0A, 0x05, 0x01, 0x01, 0x0A, 0x04, 0x01, 0x01,
+	0x09, 0x05, 0x01, 0x01, 0x09, 0x04, 0x01, 0x01, 0x08, 0x05, 0x01, 0x01, 0x08, 0x04, 0x01, 0x01,
+	0x07, 0x05, 0x01, 0x01, 0x07, 0x04, 0x01, 0x01, 0x06, 0x05, 0x01, 0x01, 0x06, 0x04, 0x01, 0x01,
+	0x05, 0x05, 0x01, 0x01, 0x05, 0x04, 0x01, 0x01, 0x04, 0x05, 0x01, 0x01, 0x04, 0x04, 0x01, 0x01,
+	0x03, 0x05, 0x01, 0x01, 0x03, 0x04, 0x01, 0x01, 0x02, 0x05,
+	// @906 0x38 (23 pixels wide)
+	0x09, 0x00, 0x01, 0x01, 0x08, 0x08, 0x01, 0x01, 0x06, 0x0C, 0x01, 0x01, 0x04, 0x0F, 0x01, 0x02,
+	0x03, 0x07, 0x04, 0x06, 0x01, 0x02, 0x03, 0x05, 0x08, 0x05, 0x01, 0x02, 0x02, 0x05, 0x0A, 0x04,
+	0x01, 0x02, 0x02, 0x04, 0x0B, 0x05, 0x01, 0x02, 0x01, 0x05, 0x0B, 0x05, 0x01, 0x02, 0x01, 0x05,
+	0x0C, 0x04, 0x02, 0x02, 0x01, 0x05, 0x0B, 0x05, 0x01, 0x02, 0x02, 0x04, 0x0B, 0x04, 0x01, 0x02,
+	0x02, 0x05, 0x09, 0x05, 0x01, 0x02, 0x03, 0x05, 0x07, 0x05, 0x01, 0x02, 0x03, 0x07, 0x04, 0x05,
+	0x01, 0x01, 0x04, 0x0E, 0x01, 0x01, 0x06, 0x0A, 0x01, 0x01, 0x06, 0x0C, 0x01, 0x01, 0x04, 0x10,
+	0x01, 0x02, 0x03, 0x05, 0x06, 0x07, 0x01, 0x02, 0x02, 0x05, 0x08, 0x07, 0x01, 0x02, 0x01, 0x05,
+	0x0B, 0x05, 0x01, 0x02, 0x01, 0x04, 0x0C, 0x06, 0x03, 0x02, 0x00, 0x05, 0x0D, 0x05, 0x01, 0x02,
+	0x00, 0x05, 0x0E, 0x04, 0x02, 0x02, 0x00, 0x05, 0x0D, 0x05, 0x01, 0x02, 0x01, 0x05, 0x0B, 0x05,
+	0x01, 0x02, 0x01, 0x06, 0x0A, 0x05, 0x01, 0x02, 0x02, 0x06, 0x07, 0x06, 0x01, 0x01, 0x03, 0x11,
+	0x01, 0x01, 0x04, 0x0F, 0x01, 0x01, 0x06, 0x0B,
+	// @1074 0x39 (23 pixels wide)
+	0x09, 0x00, 0x01, 0x01, 0x08, 0x08, 0x01, 0x01, 0x06, 0x0C, 0x01, 0x01, 0x05, 0x0E, 0x01, 0x01,
+	0x04, 0x10, 0x01, 0x02, 0x03, 0x05, 0x07, 0x06, 0x01, 0x02, 0x02, 0x05, 0x09, 0x05, 0x02, 0x02,
+	0x01, 0x05, 0x0B, 0x05, 0x01, 0x02, 0x01, 0x04, 0x0D, 0x05, 0x02, 0x02, 0x00, 0x05, 0x0D, 0x05,
+	0x04, 0x02, 0x00, 0x05, 0x0E, 0x04, 0x01, 0x02, 0x01, 0x04, 0x0D, 0x05, 0x01, 0x02, 0x01, 0x05,
+	0x0C, 0x05, 0x01, 0x02, 0x01, 0x06, 0x0A, 0x06, 0x01, 0x02, 0x02, 0x06, 0x07, 0x08, 0x01, 0x02,
+	0x03, 0x0F, 0x01, 0x04, 0x01, 0x02, 0x04, 0x0D, 0x01, 0x05, 0x01, 0x02, 0x05, 0x0B, 0x02, 0x05,
+	0x01, 0x02, 0x08, 0x05, 0x05, 0x04, 0x02, 0x01, 0x11, 0x05, 0x02, 0x01, 0x10, 0x05, 0x01, 0x01,
+	0x0F, 0x05, 0x01, 0x01, 0x0E, 0x05, 0x01, 0x01, 0x0C, 0x06, 0x01, 0x01, 0x0B, 0x07, 0x01, 0x01,
+	0x07, 0x09, 0x01, 0x01, 0x03, 0x0C, 0x01, 0x01, 0x03, 0x0A, 0x01, 0x01, 0x03, 0x08,
+	// @1216 0x3F (16 pixels wide)
+	0x08, 0x00, 0x01, 0x01, 0x02, 0x0A, 0x01, 0x01, 0x00, 0x0D, 0x01, 0x01, 0x00, 0x0E, 0x01, 0x01,
+	0x00, 0x0F, 0x01, 0x02, 0x01, 0x01, 0x08, 0x06, 0x06, 0x01, 0x0B, 0x05, 0x02, 0x01, 0x0A, 0x05,
+	0x01, 0x01, 0x09, 0x05, 0x02, 0x01, 0x08, 0x05, 0x01, 0x01, 0x07, 0x05, 0x01, 0x01, 0x06, 0x05,
+	0x01, 0x01, 0x06, 0x04, 0x01, 0x01, 0x05, 0x05, 0x01, 0x01, 0x05, 0x04, 0x05, 0x01, 0x04, 0x05,
+	0x04, 0x00, 0x01, 0x01, 0x05, 0x03, 0x01, 0x01, 0x04, 0x05, 0x02, 0x01, 0x03, 0x07, 0x02, 0x01,
+	0x04, 0x05,
+};
+
+static const struct FONT_CHAR_INFO Descriptors[] = 
+{
+	{2, 0}, 		// 0x20
+	{13, 2}, 		// 0x2D
+	{6, 10}, 		// 0x2E
+	{23, 24}, 		// 0x30
+	{11, 162}, 		// 0x31
+	{22, 202}, 		// 0x32
+	{22, 320}, 		// 0x33
+	{25, 438}, 		// 0x34
+	{22, 548}, 		// 0x35
+	{23, 638}, 		// 0x36
+	{22, 784}, 		// 0x37
+	{23, 906}, 		// 0x38
+	{23, 1074}, 		// 0x39
+	{16, 1216}, 		// 0x3F
+};
+
+// the sign of every code, 0x3F for the codes which are not here
+static const uint8_t Map[256] = 
+{
+	 13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,
+	 13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,
+	  0,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,   1,   2,  13,
+	  3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  13,  13,  13,  13,  13,
+	 13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,
+	 13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,
+	 13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,
+	 13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,
+	 13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,
+	 13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,
+	 13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,
+	 13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,
+	 13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,
+	 13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,
+	 13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,
+	 13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,
+};
+
+sFONT RIAD_40pt = {
+  0,
+  Descriptors,
+  44, /* Height */
+  Signs,
+  1, /* Bpp */
+  Map,
+};
+#endif
@@ -2,6 +2,8 @@
 // 
 #include "variables.h"
 #include "fonts.h"
+
+#if RIAD_80pt_FROM == FONT_FULL
 // Character bitmaps for GOST type B 16pt
 const uint8_t RIAD_80ptBitmaps[] = 
 {
@@ -26899,4 +26901,5 @@ sFONT RIAD_80pt = {
   RIAD_80ptDescriptors,
 //  0, //variable width
   117, /* Height */
-};
\ No newline at end of file
+};
+#endif
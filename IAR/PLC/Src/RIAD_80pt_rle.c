@@ -0,0 +1,3201 @@
+// 
+//  RIAD_80pt, run coded by Tools/font_rle.py from RIAD_80pt.c, don't edit
+// 
+#include "variables.h"
+#include "fonts.h"
+
+#if RIAD_80pt_FROM == FONT_RLE
+const uint8_t RIAD_80ptRLE[] = 
+{
+	// @0 0x20 (2 pixels wide)
+	0x75, 0x00,
+	// @2 0x21 (13 pixels wide)
+	0x12, 0x00, 0x0C, 0x01, 0x01, 0x0A, 0x14, 0x01, 0x02, 0x09, 0x0E, 0x01, 0x02, 0x08, 0x05, 0x01,
+	0x03, 0x07, 0x09, 0x00, 0x01, 0x01, 0x04, 0x05, 0x01, 0x01, 0x02, 0x09, 0x01, 0x01, 0x01, 0x0A,
+	0x01, 0x01, 0x01, 0x0B, 0x01, 0x01, 0x00, 0x0C, 0x03, 0x01, 0x00, 0x0D, 0x01, 0x01, 0x00, 0x0C,
+	0x02, 0x01, 0x01, 0x0B, 0x01, 0x01, 0x02, 0x09, 0x01, 0x01, 0x03, 0x06, 0x1A, 0x00,
+	// @64 0x22 (26 pixels wide)
+	0x10, 0x00, 0x01, 0x02, 0x00, 0x0A, 0x06, 0x0A, 0x01, 0x02, 0x01, 0x09, 0x07, 0x09, 0x01, 0x02,
+	0x01, 0x09, 0x07, 0x08, 0x0D, 0x02, 0x01, 0x08, 0x08, 0x08, 0x01, 0x02, 0x02, 0x07, 0x08, 0x08,
+	0x01, 0x02, 0x02, 0x07, 0x09, 0x06, 0x08, 0x02, 0x02, 0x06, 0x0A, 0x06, 0x4B, 0x00,
+	// @110 0x23 (45 pixels wide)
+	0x14, 0x00, 0x03, 0x02, 0x0F, 0x07, 0x0B, 0x06, 0x01, 0x02, 0x0F, 0x06, 0x0C, 0x06, 0x02, 0x02,
+	0x0F, 0x06, 0x0B, 0x07, 0x02, 0x02, 0x0F, 0x06, 0x0B, 0x06, 0x02, 0x02, 0x0E, 0x07, 0x0B, 0x06,
+	0x01, 0x02, 0x0E, 0x06, 0x0C, 0x06, 0x03, 0x02, 0x0E, 0x06, 0x0B, 0x07, 0x01, 0x02, 0x0E, 0x06,
+	0x0B, 0x06, 0x02, 0x02, 0x0D, 0x07, 0x0B, 0x06, 0x02, 0x02, 0x0D, 0x06, 0x0C, 0x06, 0x02, 0x02,
+	0x0D, 0x06, 0x0B, 0x07, 0x06, 0x01, 0x03, 0x2A, 0x01, 0x02, 0x0C, 0x06, 0x0B, 0x07, 0x02, 0x02,
+	0x0C, 0x06, 0x0B, 0x06, 0x02, 0x02, 0x0B, 0x07, 0x0B, 0x06, 0x01, 0x02, 0x0B, 0x06, 0x0C, 0x06,
+	0x03, 0x02, 0x0B, 0x06, 0x0B, 0x07, 0x01, 0x02, 0x0B, 0x06, 0x0B, 0x06, 0x03, 0x02, 0x0A, 0x07,
+	0x0B, 0x06, 0x01, 0x02, 0x0A, 0x06, 0x0C, 0x06, 0x02, 0x02, 0x0A, 0x06, 0x0B, 0x07, 0x06, 0x01,
+	0x00, 0x2B, 0x01, 0x02, 0x09, 0x06, 0x0B, 0x07, 0x02, 0x02, 0x09, 0x06, 0x0B, 0x06, 0x02, 0x02,
+	0x08, 0x07, 0x0B, 0x06, 0x01, 0x02, 0x08, 0x06, 0x0C, 0x06, 0x03, 0x02, 0x08, 0x06, 0x0B, 0x07,
+	0x01, 0x02, 0x08, 0x06, 0x0B, 0x06, 0x03, 0x02, 0x07, 0x07, 0x0B, 0x06, 0x04, 0x02, 0x07, 0x06,
+	0x0B, 0x07, 0x01, 0x02, 0x07, 0x06, 0x0B, 0x06, 0x03, 0x02, 0x06, 0x07, 0x0B, 0x06, 0x1B, 0x00,
+	// @302 0x24 (40 pixels wide)
+	0x0B, 0x00, 0x0B, 0x01, 0x11, 0x07, 0x01, 0x01, 0x0F, 0x0F, 0x01, 0x01, 0x0C, 0x15, 0x01, 0x01,
+	0x0A, 0x1A, 0x01, 0x01, 0x08, 0x1E, 0x01, 0x01, 0x07, 0x1E, 0x01, 0x01, 0x06, 0x1F, 0x01, 0x01,
+	0x05, 0x1F, 0x01, 0x02, 0x04, 0x0D, 0x0B, 0x08, 0x01, 0x02, 0x03, 0x0B, 0x11, 0x05, 0x01, 0x02,
+	0x03, 0x0A, 0x14, 0x02, 0x01, 0x01, 0x02, 0x0A, 0x02, 0x01, 0x02, 0x09, 0x06, 0x01, 0x01, 0x09,
+	0x02, 0x01, 0x01, 0x0A, 0x01, 0x01, 0x01, 0x0B, 0x01, 0x01, 0x02, 0x0B, 0x01, 0x01, 0x02, 0x0C,
+	0x01, 0x01, 0x03, 0x0D, 0x01, 0x01, 0x03, 0x0E, 0x01, 0x01, 0x04, 0x0F, 0x01, 0x01, 0x05, 0x11,
+	0x01, 0x01, 0x06, 0x12, 0x01, 0x01, 0x07, 0x13, 0x01, 0x01, 0x08, 0x14, 0x01, 0x01, 0x0A, 0x14,
+	0x01, 0x01, 0x0B, 0x15, 0x01, 0x01, 0x0D, 0x14, 0x01, 0x01, 0x0F, 0x13, 0x01, 0x01, 0x12, 0x11,
+	0x01, 0x01, 0x14, 0x10, 0x01, 0x01, 0x16, 0x0F, 0x01, 0x01, 0x18, 0x0E, 0x01, 0x01, 0x19, 0x0D,
+	0x01, 0x01, 0x1B, 0x0C, 0x02, 0x01, 0x1C, 0x0B, 0x01, 0x01, 0x1D, 0x0B, 0x03, 0x01, 0x1E, 0x0A,
+	0x04, 0x01, 0x1F, 0x09, 0x01, 0x01, 0x1E, 0x0A, 0x01, 0x01, 0x1E, 0x09, 0x02, 0x01, 0x1D, 0x0A,
+	0x01, 0x02, 0x02, 0x02, 0x18, 0x0A, 0x01, 0x02, 0x02, 0x04, 0x15, 0x0B, 0x01, 0x02, 0x02, 0x06,
+	0x11, 0x0C, 0x01, 0x02, 0x01, 0x0B, 0x0B, 0x0D, 0x01, 0x01, 0x01, 0x23, 0x01, 0x01, 0x00, 0x23,
+	0x01, 0x01, 0x00, 0x22, 0x01, 0x01, 0x01, 0x1F, 0x01, 0x01, 0x03, 0x1C, 0x01, 0x01, 0x05, 0x18,
+	0x01, 0x01, 0x09, 0x11, 0x0B, 0x01, 0x10, 0x07, 0x12, 0x00,
+	// @536 0x25 (78 pixels wide)
+	0x13, 0x00, 0x01, 0x02, 0x0E, 0x06, 0x25, 0x05, 0x01, 0x02, 0x0B, 0x0C, 0x21, 0x06, 0x01, 0x02,
+	0x09, 0x10, 0x1E, 0x06, 0x01, 0x02, 0x08, 0x13, 0x1C, 0x06, 0x01, 0x02, 0x06, 0x16, 0x1A, 0x06,
+	0x01, 0x02, 0x05, 0x18, 0x19, 0x06, 0x01, 0x03, 0x05, 0x09, 0x06, 0x09, 0x18, 0x06, 0x01, 0x03,
+	0x04, 0x08, 0x09, 0x09, 0x17, 0x06, 0x01, 0x03, 0x03, 0x08, 0x0C, 0x07, 0x16, 0x06, 0x01, 0x03,
+	0x03, 0x08, 0x0C, 0x08, 0x14, 0x06, 0x01, 0x03, 0x02, 0x08, 0x0E, 0x07, 0x14, 0x06, 0x01, 0x03,
+	0x02, 0x07, 0x0F, 0x08, 0x12, 0x06, 0x01, 0x03, 0x02, 0x07, 0x10, 0x07, 0x12, 0x06, 0x01, 0x03,
+	0x01, 0x08, 0x10, 0x07, 0x11, 0x06, 0x01, 0x03, 0x01, 0x07, 0x11, 0x07, 0x11, 0x06, 0x01, 0x03,
+	0x01, 0x07, 0x11, 0x08, 0x0F, 0x06, 0x01, 0x03, 0x01, 0x07, 0x11, 0x08, 0x0E, 0x06, 0x01, 0x03,
+	0x00, 0x08, 0x12, 0x07, 0x0E, 0x06, 0x02, 0x03, 0x00, 0x08, 0x12, 0x07, 0x0D, 0x06, 0x02, 0x03,
+	0x00, 0x08, 0x12, 0x07, 0x0C, 0x06, 0x01, 0x03, 0x00, 0x08, 0x12, 0x07, 0x0B, 0x06, 0x02, 0x03,
+	0x00, 0x08, 0x12, 0x07, 0x0A, 0x06, 0x01, 0x03, 0x00, 0x08, 0x12, 0x07, 0x09, 0x06, 0x01, 0x03,
+	0x01, 0x07, 0x11, 0x08, 0x09, 0x06, 0x01, 0x03, 0x01, 0x07, 0x11, 0x08, 0x08, 0x06, 0x01, 0x03,
+	0x01, 0x07, 0x11, 0x07, 0x09, 0x06, 0x01, 0x04, 0x01, 0x08, 0x10, 0x07, 0x08, 0x06, 0x0C, 0x08,
+	0x01, 0x04, 0x01, 0x08, 0x10, 0x07, 0x07, 0x06, 0x0B, 0x0D, 0x01, 0x04, 0x02, 0x07, 0x0F, 0x07,
+	0x08, 0x06, 0x09, 0x11, 0x01, 0x04, 0x02, 0x08, 0x0E, 0x07, 0x07, 0x06, 0x09, 0x13, 0x01, 0x04,
+	0x02, 0x08, 0x0D, 0x08, 0x07, 0x06, 0x08, 0x15, 0x01, 0x04, 0x03, 0x08, 0x0C, 0x07, 0x07, 0x06,
+	0x08, 0x17, 0x01, 0x05, 0x04, 0x08, 0x0A, 0x08, 0x07, 0x06, 0x07, 0x09, 0x07, 0x09, 0x01, 0x05,
+	0x04, 0x0A, 0x06, 0x09, 0x07, 0x06, 0x07, 0x08, 0x0A, 0x08, 0x01, 0x04, 0x05, 0x17, 0x07, 0x06,
+	0x08, 0x07, 0x0C, 0x08, 0x01, 0x04, 0x06, 0x15, 0x08, 0x06, 0x07, 0x08, 0x0D, 0x07, 0x01, 0x04,
+	0x07, 0x13, 0x08, 0x06, 0x08, 0x07, 0x0E, 0x08, 0x01, 0x04, 0x08, 0x11, 0x09, 0x06, 0x07, 0x08,
+	0x0F, 0x07, 0x01, 0x04, 0x0A, 0x0D, 0x0A, 0x06, 0x08, 0x07, 0x10, 0x07, 0x01, 0x04, 0x0D, 0x07,
+	0x0D, 0x06, 0x08, 0x07, 0x10, 0x08, 0x01, 0x03, 0x20, 0x06, 0x08, 0x08, 0x10, 0x08, 0x01, 0x03,
+	0x20, 0x06, 0x08, 0x07, 0x12, 0x07, 0x01, 0x03, 0x1F, 0x06, 0x09, 0x07, 0x12, 0x07, 0x02, 0x03,
+	0x1E, 0x06, 0x0A, 0x07, 0x12, 0x07, 0x02, 0x03, 0x1D, 0x06, 0x0B, 0x07, 0x12, 0x07, 0x02, 0x03,
+	0x1C, 0x06, 0x0C, 0x07, 0x12, 0x07, 0x01, 0x03, 0x1B, 0x06, 0x0D, 0x07, 0x12, 0x07, 0x02, 0x03,
+	0x1A, 0x06, 0x0E, 0x07, 0x12, 0x07, 0x02, 0x03, 0x19, 0x06, 0x0F, 0x07, 0x12, 0x07, 0x01, 0x03,
+	0x18, 0x06, 0x10, 0x08, 0x10, 0x08, 0x01, 0x03, 0x18, 0x06, 0x10, 0x08, 0x10, 0x07, 0x01, 0x03,
+	0x17, 0x06, 0x12, 0x07, 0x10, 0x07, 0x01, 0x03, 0x16, 0x06, 0x13, 0x08, 0x0F, 0x07, 0x01, 0x03,
+	0x16, 0x06, 0x13, 0x08, 0x0E, 0x07, 0x01, 0x03, 0x15, 0x06, 0x15, 0x08, 0x0D, 0x07, 0x01, 0x03,
+	0x15, 0x06, 0x15, 0x09, 0x0B, 0x07, 0x01, 0x03, 0x14, 0x06, 0x17, 0x09, 0x09, 0x08, 0x01, 0x03,
+	0x14, 0x06, 0x18, 0x09, 0x06, 0x09, 0x01, 0x02, 0x13, 0x06, 0x19, 0x17, 0x01, 0x02, 0x12, 0x06,
+	0x1B, 0x15, 0x01, 0x02, 0x12, 0x06, 0x1D, 0x12, 0x01, 0x02, 0x11, 0x06, 0x1F, 0x10, 0x01, 0x02,
+	0x11, 0x06, 0x21, 0x0C, 0x01, 0x02, 0x10, 0x06, 0x25, 0x06, 0x1A, 0x00,
+	// @1060 0x26 (61 pixels wide)
+	0x11, 0x00, 0x01, 0x01, 0x15, 0x0B, 0x01, 0x01, 0x12, 0x11, 0x01, 0x01, 0x10, 0x14, 0x01, 0x01,
+	0x0F, 0x17, 0x01, 0x01, 0x0E, 0x19, 0x01, 0x01, 0x0D, 0x1B, 0x01, 0x02, 0x0C, 0x0B, 0x06, 0x0B,
+	0x01, 0x02, 0x0B, 0x0A, 0x0A, 0x0A, 0x01, 0x02, 0x0B, 0x09, 0x0C, 0x09, 0x01, 0x02, 0x0A, 0x09,
+	0x0E, 0x09, 0x01, 0x02, 0x0A, 0x08, 0x0F, 0x09, 0x02, 0x02, 0x09, 0x09, 0x10, 0x08, 0x02, 0x02,
+	0x09, 0x08, 0x11, 0x09, 0x02, 0x02, 0x08, 0x09, 0x11, 0x09, 0x03, 0x02, 0x08, 0x09, 0x11, 0x08,
+	0x01, 0x02, 0x09, 0x09, 0x0F, 0x09, 0x01, 0x02, 0x09, 0x09, 0x0F, 0x08, 0x01, 0x02, 0x09, 0x09,
+	0x0E, 0x09, 0x01, 0x02, 0x09, 0x0A, 0x0C, 0x09, 0x01, 0x02, 0x0A, 0x09, 0x0B, 0x09, 0x01, 0x02,
+	0x0A, 0x0A, 0x09, 0x0A, 0x01, 0x02, 0x0B, 0x09, 0x07, 0x0B, 0x01, 0x02, 0x0B, 0x0A, 0x05, 0x0B,
+	0x01, 0x02, 0x0C, 0x0A, 0x02, 0x0C, 0x01, 0x02, 0x0C, 0x0A, 0x01, 0x0C, 0x01, 0x01, 0x0D, 0x14,
+	0x01, 0x01, 0x0E, 0x12, 0x01, 0x01, 0x0E, 0x10, 0x01, 0x01, 0x0D, 0x0F, 0x01, 0x02, 0x0C, 0x0F,
+	0x18, 0x09, 0x01, 0x02, 0x0A, 0x12, 0x17, 0x09, 0x01, 0x02, 0x09, 0x13, 0x17, 0x08, 0x01, 0x02,
+	0x08, 0x15, 0x16, 0x08, 0x01, 0x03, 0x07, 0x0B, 0x01, 0x0B, 0x14, 0x09, 0x01, 0x03, 0x06, 0x0A,
+	0x04, 0x0B, 0x13, 0x09, 0x01, 0x03, 0x05, 0x0A, 0x06, 0x0B, 0x12, 0x09, 0x01, 0x03, 0x04, 0x0A,
+	0x08, 0x0B, 0x11, 0x08, 0x01, 0x03, 0x03, 0x0A, 0x0A, 0x0B, 0x10, 0x08, 0x01, 0x03, 0x03, 0x09,
+	0x0C, 0x0B, 0x0E, 0x09, 0x01, 0x03, 0x02, 0x0A, 0x0C, 0x0B, 0x0E, 0x08, 0x01, 0x03, 0x02, 0x09,
+	0x0E, 0x0B, 0x0D, 0x08, 0x01, 0x03, 0x02, 0x09, 0x0F, 0x0B, 0x0B, 0x09, 0x01, 0x03, 0x01, 0x09,
+	0x11, 0x0B, 0x0A, 0x08, 0x01, 0x03, 0x01, 0x09, 0x12, 0x0B, 0x09, 0x08, 0x01, 0x03, 0x01, 0x09,
+	0x13, 0x0B, 0x07, 0x09, 0x01, 0x03, 0x01, 0x09, 0x14, 0x0B, 0x06, 0x08, 0x01, 0x03, 0x00, 0x09,
+	0x16, 0x0B, 0x04, 0x09, 0x01, 0x03, 0x00, 0x09, 0x17, 0x0A, 0x04, 0x08, 0x01, 0x03, 0x00, 0x09,
+	0x17, 0x0B, 0x02, 0x09, 0x01, 0x03, 0x00, 0x0A, 0x17, 0x0B, 0x01, 0x08, 0x01, 0x02, 0x00, 0x0A,
+	0x18, 0x13, 0x01, 0x02, 0x00, 0x0A, 0x19, 0x11, 0x01, 0x02, 0x01, 0x09, 0x1A, 0x10, 0x01, 0x02,
+	0x01, 0x0A, 0x1A, 0x0E, 0x01, 0x02, 0x01, 0x0A, 0x1B, 0x0C, 0x01, 0x02, 0x01, 0x0B, 0x1B, 0x0B,
+	0x01, 0x02, 0x02, 0x0A, 0x1A, 0x0D, 0x01, 0x02, 0x02, 0x0B, 0x18, 0x0F, 0x01, 0x02, 0x03, 0x0B,
+	0x16, 0x11, 0x01, 0x02, 0x03, 0x0C, 0x13, 0x14, 0x01, 0x02, 0x04, 0x0D, 0x0F, 0x16, 0x01, 0x03,
+	0x05, 0x0F, 0x09, 0x0E, 0x01, 0x0B, 0x01, 0x02, 0x06, 0x24, 0x03, 0x0B, 0x01, 0x02, 0x06, 0x23,
+	0x05, 0x0B, 0x01, 0x02, 0x08, 0x1F, 0x08, 0x0B, 0x01, 0x02, 0x09, 0x1C, 0x0B, 0x0B, 0x01, 0x02,
+	0x0B, 0x18, 0x0E, 0x0B, 0x01, 0x02, 0x0D, 0x14, 0x11, 0x0B, 0x01, 0x01, 0x10, 0x0D, 0x1A, 0x00,
+	// @1492 0x27 (10 pixels wide)
+	0x10, 0x00, 0x01, 0x01, 0x00, 0x0A, 0x02, 0x01, 0x01, 0x09, 0x0D, 0x01, 0x01, 0x08, 0x02, 0x01,
+	0x02, 0x07, 0x08, 0x01, 0x02, 0x06, 0x4B, 0x00,
+	// @1516 0x28 (21 pixels wide)
+	0x10, 0x00, 0x01, 0x01, 0x0D, 0x08, 0x01, 0x01, 0x0D, 0x07, 0x01, 0x01, 0x0C, 0x07, 0x01, 0x01,
+	0x0B, 0x08, 0x01, 0x01, 0x0B, 0x07, 0x01, 0x01, 0x0A, 0x07, 0x01, 0x01, 0x09, 0x08, 0x01, 0x01,
+	0x09, 0x07, 0x01, 0x01, 0x08, 0x08, 0x01, 0x01, 0x08, 0x07, 0x01, 0x01, 0x07, 0x08, 0x01, 0x01,
+	0x07, 0x07, 0x01, 0x01, 0x06, 0x08, 0x01, 0x01, 0x06, 0x07, 0x02, 0x01, 0x05, 0x08, 0x01, 0x01,
+	0x05, 0x07, 0x02, 0x01, 0x04, 0x08, 0x01, 0x01, 0x04, 0x07, 0x02, 0x01, 0x03, 0x08, 0x01, 0x01,
+	0x03, 0x07, 0x03, 0x01, 0x02, 0x08, 0x01, 0x01, 0x02, 0x07, 0x05, 0x01, 0x01, 0x08, 0x01, 0x01,
+	0x01, 0x07, 0x15, 0x01, 0x00, 0x08, 0x01, 0x01, 0x01, 0x07, 0x05, 0x01, 0x01, 0x08, 0x04, 0x01,
+	0x02, 0x08, 0x01, 0x01, 0x03, 0x07, 0x02, 0x01, 0x03, 0x08, 0x01, 0x01, 0x04, 0x07, 0x02, 0x01,
+	0x04, 0x08, 0x01, 0x01, 0x05, 0x07, 0x02, 0x01, 0x05, 0x08, 0x02, 0x01, 0x06, 0x08, 0x02, 0x01,
+	0x07, 0x08, 0x01, 0x01, 0x08, 0x07, 0x01, 0x01, 0x08, 0x08, 0x01, 0x01, 0x09, 0x08, 0x01, 0x01,
+	0x0A, 0x07, 0x01, 0x01, 0x0A, 0x08, 0x01, 0x01, 0x0B, 0x07, 0x01, 0x01, 0x0B, 0x08, 0x01, 0x01,
+	0x0C, 0x07, 0x01, 0x01, 0x0D, 0x07, 0x01, 0x01, 0x0E, 0x07, 0x0E, 0x00,
+	// @1704 0x29 (21 pixels wide)
+	0x10, 0x00, 0x01, 0x01, 0x01, 0x07, 0x01, 0x01, 0x01, 0x08, 0x01, 0x01, 0x02, 0x07, 0x01, 0x01,
+	0x03, 0x07, 0x01, 0x01, 0x03, 0x08, 0x01, 0x01, 0x04, 0x07, 0x01, 0x01, 0x04, 0x08, 0x02, 0x01,
+	0x05, 0x08, 0x02, 0x01, 0x06, 0x08, 0x02, 0x01, 0x07, 0x08, 0x02, 0x01, 0x08, 0x08, 0x01, 0x01,
+	0x09, 0x07, 0x02, 0x01, 0x09, 0x08, 0x03, 0x01, 0x0A, 0x08, 0x01, 0x01, 0x0B, 0x07, 0x03, 0x01,
+	0x0B, 0x08, 0x05, 0x01, 0x0C, 0x08, 0x01, 0x01, 0x0D, 0x07, 0x19, 0x01, 0x0D, 0x08, 0x05, 0x01,
+	0x0C, 0x08, 0x01, 0x01, 0x0C, 0x07, 0x03, 0x01, 0x0B, 0x08, 0x03, 0x01, 0x0A, 0x08, 0x01, 0x01,
+	0x0A, 0x07, 0x02, 0x01, 0x09, 0x08, 0x02, 0x01, 0x08, 0x08, 0x01, 0x01, 0x08, 0x07, 0x01, 0x01,
+	0x07, 0x08, 0x01, 0x01, 0x07, 0x07, 0x01, 0x01, 0x06, 0x08, 0x01, 0x01, 0x06, 0x07, 0x01, 0x01,
+	0x05, 0x08, 0x01, 0x01, 0x05, 0x07, 0x01, 0x01, 0x04, 0x08, 0x01, 0x01, 0x04, 0x07, 0x01, 0x01,
+	0x03, 0x07, 0x01, 0x01, 0x02, 0x08, 0x01, 0x01, 0x02, 0x07, 0x01, 0x01, 0x01, 0x07, 0x01, 0x01,
+	0x00, 0x08, 0x0E, 0x00,
+	// @1868 0x2A (38 pixels wide)
+	0x11, 0x00, 0x01, 0x02, 0x0B, 0x02, 0x0C, 0x02, 0x01, 0x02, 0x09, 0x04, 0x0C, 0x04, 0x01, 0x02,
+	0x08, 0x06, 0x0B, 0x06, 0x01, 0x02, 0x06, 0x08, 0x0A, 0x08, 0x01, 0x02, 0x07, 0x08, 0x09, 0x07,
+	0x01, 0x02, 0x07, 0x08, 0x08, 0x08, 0x01, 0x02, 0x08, 0x07, 0x08, 0x07, 0x01, 0x02, 0x09, 0x07,
+	0x06, 0x07, 0x01, 0x02, 0x0A, 0x06, 0x06, 0x06, 0x01, 0x02, 0x0A, 0x07, 0x05, 0x06, 0x01, 0x02,
+	0x0B, 0x06, 0x04, 0x06, 0x01, 0x02, 0x0C, 0x06, 0x03, 0x05, 0x01, 0x02, 0x0D, 0x05, 0x02, 0x05,
+	0x01, 0x02, 0x0E, 0x05, 0x01, 0x05, 0x01, 0x01, 0x0E, 0x0A, 0x01, 0x03, 0x00, 0x06, 0x09, 0x08,
+	0x0A, 0x05, 0x01, 0x03, 0x00, 0x0D, 0x03, 0x06, 0x03, 0x0D, 0x03, 0x01, 0x00, 0x26, 0x01, 0x03,
+	0x00, 0x0C, 0x04, 0x06, 0x03, 0x0D, 0x01, 0x03, 0x00, 0x05, 0x0A, 0x08, 0x0A, 0x05, 0x01, 0x01,
+	0x0E, 0x0A, 0x01, 0x02, 0x0E, 0x04, 0x02, 0x05, 0x01, 0x02, 0x0D, 0x05, 0x02, 0x05, 0x01, 0x02,
+	0x0C, 0x05, 0x04, 0x05, 0x01, 0x02, 0x0B, 0x06, 0x04, 0x06, 0x01, 0x02, 0x0A, 0x06, 0x05, 0x07,
+	0x01, 0x02, 0x0A, 0x06, 0x06, 0x07, 0x01, 0x02, 0x09, 0x06, 0x07, 0x07, 0x01, 0x02, 0x08, 0x07,
+	0x08, 0x07, 0x01, 0x02, 0x07, 0x08, 0x08, 0x08, 0x02, 0x02, 0x06, 0x08, 0x0A, 0x08, 0x01, 0x02,
+	0x08, 0x05, 0x0B, 0x06, 0x01, 0x02, 0x09, 0x04, 0x0C, 0x03, 0x01, 0x02, 0x0B, 0x01, 0x0D, 0x02,
+	0x3F, 0x00,
+	// @2078 0x2B (56 pixels wide)
+	0x21, 0x00, 0x19, 0x01, 0x18, 0x07, 0x07, 0x01, 0x00, 0x38, 0x19, 0x01, 0x18, 0x07, 0x1B, 0x00,
+	// @2094 0x2C (16 pixels wide)
+	0x4D, 0x00, 0x01, 0x01, 0x07, 0x09, 0x02, 0x01, 0x06, 0x0A, 0x02, 0x01, 0x06, 0x09, 0x01, 0x01,
+	0x05, 0x0A, 0x03, 0x01, 0x05, 0x09, 0x01, 0x01, 0x05, 0x08, 0x02, 0x01, 0x04, 0x09, 0x02, 0x01,
+	0x04, 0x08, 0x01, 0x01, 0x03, 0x09, 0x02, 0x01, 0x03, 0x08, 0x01, 0x01, 0x03, 0x07, 0x01, 0x01,
+	0x02, 0x08, 0x02, 0x01, 0x02, 0x07, 0x01, 0x01, 0x01, 0x08, 0x01, 0x01, 0x01, 0x07, 0x01, 0x01,
+	0x01, 0x06, 0x01, 0x01, 0x00, 0x07, 0x01, 0x01, 0x00, 0x06, 0x0E, 0x00,
+	// @2170 0x2D (27 pixels wide)
+	0x3A, 0x00, 0x07, 0x01, 0x00, 0x1B, 0x34, 0x00,
+	// @2178 0x2E (12 pixels wide)
+	0x4E, 0x00, 0x01, 0x01, 0x03, 0x06, 0x01, 0x01, 0x01, 0x09, 0x01, 0x01, 0x01, 0x0A, 0x07, 0x01,
+	0x00, 0x0C, 0x01, 0x01, 0x01, 0x0A, 0x01, 0x01, 0x02, 0x08, 0x01, 0x01, 0x03, 0x06, 0x1A, 0x00,
+	// @2210 0x2F (37 pixels wide)
+	0x11, 0x00, 0x01, 0x01, 0x1D, 0x08, 0x02, 0x01, 0x1D, 0x07, 0x01, 0x01, 0x1C, 0x08, 0x01, 0x01,
+	0x1C, 0x07, 0x01, 0x01, 0x1B, 0x08, 0x02, 0x01, 0x1B, 0x07, 0x01, 0x01, 0x1A, 0x08, 0x01, 0x01,
+	0x1A, 0x07, 0x01, 0x01, 0x19, 0x08, 0x02, 0x01, 0x19, 0x07, 0x01, 0x01, 0x18, 0x08, 0x02, 0x01,
+	0x18, 0x07, 0x01, 0x01, 0x17, 0x08, 0x01, 0x01, 0x17, 0x07, 0x01, 0x01, 0x16, 0x08, 0x02, 0x01,
+	0x16, 0x07, 0x01, 0x01, 0x15, 0x08, 0x02, 0x01, 0x15, 0x07, 0x02, 0x01, 0x14, 0x07, 0x01, 0x01,
+	0x13, 0x08, 0x02, 0x01, 0x13, 0x07, 0x01, 0x01, 0x12, 0x08, 0x01, 0x01, 0x12, 0x07, 0x01, 0x01,
+	0x11, 0x08, 0x02, 0x01, 0x11, 0x07, 0x01, 0x01, 0x10, 0x08, 0x02, 0x01, 0x10, 0x07, 0x02, 0x01,
+	0x0F, 0x07, 0x01, 0x01, 0x0E, 0x08, 0x02, 0x01, 0x0E, 0x07, 0x02, 0x01, 0x0D, 0x07, 0x01, 0x01,
+	0x0C, 0x08, 0x02, 0x01, 0x0C, 0x07, 0x01, 0x01, 0x0B, 0x08, 0x02, 0x01, 0x0B, 0x07, 0x02, 0x01,
+	0x0A, 0x07, 0x01, 0x01, 0x09, 0x08, 0x02, 0x01, 0x09, 0x07, 0x02, 0x01, 0x08, 0x07, 0x01, 0x01,
+	0x07, 0x08, 0x02, 0x01, 0x07, 0x07, 0x01, 0x01, 0x06, 0x08, 0x02, 0x01, 0x06, 0x07, 0x02, 0x01,
+	0x05, 0x07, 0x01, 0x01, 0x04, 0x08, 0x02, 0x01, 0x04, 0x07, 0x02, 0x01, 0x03, 0x07, 0x01, 0x01,
+	0x02, 0x08, 0x02, 0x01, 0x02, 0x07, 0x01, 0x01, 0x01, 0x08, 0x02, 0x01, 0x01, 0x07, 0x01, 0x01,
+	0x00, 0x07, 0x17, 0x00,
+	// @2422 0x30 (47 pixels wide)
+	0x13, 0x00, 0x01, 0x01, 0x15, 0x07, 0x01, 0x01, 0x11, 0x0E, 0x01, 0x01, 0x0E, 0x14, 0x01, 0x01,
+	0x0D, 0x16, 0x01, 0x01, 0x0B, 0x1A, 0x01, 0x01, 0x0A, 0x1C, 0x01, 0x01, 0x09, 0x1E, 0x01, 0x01,
+	0x08, 0x20, 0x01, 0x02, 0x07, 0x0C, 0x09, 0x0C, 0x01, 0x02, 0x07, 0x0B, 0x0C, 0x0B, 0x01, 0x02,
+	0x06, 0x0B, 0x0E, 0x0B, 0x01, 0x02, 0x05, 0x0B, 0x10, 0x0A, 0x01, 0x02, 0x05, 0x0A, 0x12, 0x0A,
+	0x01, 0x02, 0x04, 0x0A, 0x13, 0x0A, 0x01, 0x02, 0x04, 0x0A, 0x14, 0x0A, 0x01, 0x02, 0x03, 0x0A,
+	0x15, 0x0A, 0x01, 0x02, 0x03, 0x0A, 0x16, 0x09, 0x01, 0x02, 0x03, 0x09, 0x17, 0x0A, 0x02, 0x02,
+	0x02, 0x0A, 0x18, 0x09, 0x01, 0x02, 0x02, 0x09, 0x19, 0x0A, 0x01, 0x02, 0x01, 0x0A, 0x19, 0x0A,
+	0x01, 0x02, 0x01, 0x0A, 0x1A, 0x09, 0x02, 0x02, 0x01, 0x09, 0x1B, 0x09, 0x02, 0x02, 0x01, 0x09,
+	0x1B, 0x0A, 0x04, 0x02, 0x00, 0x0A, 0x1B, 0x0A, 0x0A, 0x02, 0x00, 0x09, 0x1D, 0x09, 0x05, 0x02,
+	0x00, 0x0A, 0x1B, 0x0A, 0x03, 0x02, 0x01, 0x09, 0x1B, 0x09, 0x02, 0x02, 0x01, 0x0A, 0x19, 0x0A,
+	0x02, 0x02, 0x02, 0x09, 0x19, 0x09, 0x02, 0x02, 0x02, 0x0A, 0x17, 0x0A, 0x01, 0x02, 0x03, 0x09,
+	0x17, 0x09, 0x01, 0x02, 0x03, 0x0A, 0x15, 0x0A, 0x01, 0x02, 0x04, 0x09, 0x15, 0x0A, 0x02, 0x02,
+	0x04, 0x0A, 0x13, 0x0A, 0x01, 0x02, 0x05, 0x0A, 0x11, 0x0A, 0x01, 0x02, 0x05, 0x0B, 0x0F, 0x0B,
+	0x01, 0x02, 0x06, 0x0B, 0x0D, 0x0B, 0x01, 0x02, 0x07, 0x0B, 0x0B, 0x0B, 0x01, 0x02, 0x08, 0x0D,
+	0x05, 0x0E, 0x01, 0x01, 0x08, 0x1F, 0x01, 0x01, 0x09, 0x1D, 0x01, 0x01, 0x0A, 0x1B, 0x01, 0x01,
+	0x0B, 0x18, 0x01, 0x01, 0x0D, 0x15, 0x01, 0x01, 0x0F, 0x11, 0x01, 0x01, 0x11, 0x0C, 0x1A, 0x00,
+	// @2678 0x31 (23 pixels wide)
+	0x14, 0x00, 0x01, 0x01, 0x0F, 0x08, 0x01, 0x01, 0x0D, 0x0A, 0x01, 0x01, 0x0B, 0x0C, 0x01, 0x01,
+	0x0A, 0x0D, 0x01, 0x01, 0x08, 0x0F, 0x01, 0x01, 0x06, 0x11, 0x01, 0x01, 0x04, 0x13, 0x01, 0x01,
+	0x02, 0x15, 0x02, 0x01, 0x00, 0x17, 0x01, 0x02, 0x01, 0x0B, 0x02, 0x09, 0x01, 0x02, 0x01, 0x09,
+	0x04, 0x09, 0x01, 0x02, 0x01, 0x07, 0x06, 0x09, 0x01, 0x02, 0x01, 0x05, 0x08, 0x09, 0x01, 0x02,
+	0x02, 0x02, 0x0A, 0x09, 0x37, 0x01, 0x0E, 0x09, 0x1B, 0x00,
+	// @2752 0x32 (44 pixels wide)
+	0x13, 0x00, 0x01, 0x01, 0x11, 0x08, 0x01, 0x01, 0x0C, 0x12, 0x01, 0x01, 0x09, 0x17, 0x01, 0x01,
+	0x07, 0x1B, 0x01, 0x01, 0x06, 0x1D, 0x01, 0x01, 0x04, 0x20, 0x01, 0x01, 0x03, 0x22, 0x01, 0x01,
+	0x02, 0x24, 0x01, 0x02, 0x02, 0x0D, 0x09, 0x0F, 0x01, 0x02, 0x03, 0x09, 0x0F, 0x0D, 0x01, 0x02,
+	0x03, 0x07, 0x13, 0x0B, 0x01, 0x02, 0x04, 0x04, 0x16, 0x0B, 0x01, 0x02, 0x04, 0x03, 0x18, 0x0A,
+	0x01, 0x02, 0x04, 0x01, 0x1A, 0x0A, 0x03, 0x01, 0x20, 0x0A, 0x09, 0x01, 0x21, 0x09, 0x02, 0x01,
+	0x20, 0x0A, 0x01, 0x01, 0x20, 0x09, 0x01, 0x01, 0x1F, 0x0A, 0x02, 0x01, 0x1F, 0x09, 0x01, 0x01,
+	0x1E, 0x0A, 0x02, 0x01, 0x1D, 0x0A, 0x01, 0x01, 0x1C, 0x0A, 0x01, 0x01, 0x1C, 0x09, 0x01, 0x01,
+	0x1B, 0x0A, 0x01, 0x01, 0x1A, 0x0A, 0x01, 0x01, 0x19, 0x0A, 0x01, 0x01, 0x18, 0x0B, 0x01, 0x01,
+	0x17, 0x0B, 0x01, 0x01, 0x17, 0x0A, 0x01, 0x01, 0x16, 0x0A, 0x01, 0x01, 0x15, 0x0A, 0x01, 0x01,
+	0x14, 0x0B, 0x01, 0x01, 0x13, 0x0B, 0x01, 0x01, 0x12, 0x0B, 0x01, 0x01, 0x11, 0x0B, 0x01, 0x01,
+	0x10, 0x0B, 0x01, 0x01, 0x0F, 0x0B, 0x01, 0x01, 0x0E, 0x0B, 0x01, 0x01, 0x0D, 0x0B, 0x01, 0x01,
+	0x0C, 0x0B, 0x01, 0x01, 0x0B, 0x0B, 0x01, 0x01, 0x0A, 0x0B, 0x01, 0x01, 0x09, 0x0B, 0x01, 0x01,
+	0x08, 0x0B, 0x01, 0x01, 0x07, 0x0B, 0x01, 0x01, 0x06, 0x0B, 0x01, 0x01, 0x05, 0x0B, 0x01, 0x01,
+	0x04, 0x0B, 0x01, 0x01, 0x03, 0x0B, 0x01, 0x01, 0x02, 0x2A, 0x01, 0x01, 0x01, 0x2B, 0x06, 0x01,
+	0x00, 0x2C, 0x1B, 0x00,
+	// @2980 0x33 (43 pixels wide)
+	0x13, 0x00, 0x01, 0x01, 0x10, 0x08, 0x01, 0x01, 0x0B, 0x12, 0x01, 0x01, 0x08, 0x17, 0x01, 0x01,
+	0x06, 0x1B, 0x01, 0x01, 0x04, 0x1E, 0x01, 0x01, 0x02, 0x22, 0x01, 0x01, 0x02, 0x23, 0x01, 0x01,
+	0x03, 0x22, 0x01, 0x02, 0x03, 0x0A, 0x0A, 0x0F, 0x01, 0x02, 0x03, 0x07, 0x10, 0x0D, 0x01, 0x02,
+	0x04, 0x04, 0x13, 0x0C, 0x01, 0x02, 0x04, 0x02, 0x16, 0x0B, 0x01, 0x01, 0x1D, 0x0B, 0x03, 0x01,
+	0x1E, 0x0A, 0x05, 0x01, 0x1F, 0x09, 0x01, 0x01, 0x1E, 0x0A, 0x01, 0x01, 0x1E, 0x09, 0x02, 0x01,
+	0x1D, 0x0A, 0x01, 0x01, 0x1C, 0x0A, 0x01, 0x01, 0x1B, 0x0A, 0x01, 0x01, 0x19, 0x0C, 0x01, 0x01,
+	0x17, 0x0D, 0x01, 0x01, 0x15, 0x0D, 0x01, 0x01, 0x0A, 0x17, 0x01, 0x01, 0x0A, 0x15, 0x01, 0x01,
+	0x0A, 0x14, 0x01, 0x01, 0x0A, 0x11, 0x01, 0x01, 0x0A, 0x15, 0x01, 0x01, 0x0A, 0x17, 0x01, 0x01,
+	0x0A, 0x19, 0x01, 0x01, 0x13, 0x11, 0x01, 0x01, 0x18, 0x0D, 0x01, 0x01, 0x1A, 0x0C, 0x01, 0x01,
+	0x1C, 0x0B, 0x01, 0x01, 0x1D, 0x0B, 0x01, 0x01, 0x1E, 0x0B, 0x01, 0x01, 0x1F, 0x0A, 0x01, 0x01,
+	0x1F, 0x0B, 0x02, 0x01, 0x20, 0x0A, 0x09, 0x01, 0x21, 0x0A, 0x02, 0x01, 0x20, 0x0A, 0x01, 0x01,
+	0x1F, 0x0B, 0x01, 0x01, 0x1E, 0x0B, 0x01, 0x01, 0x1D, 0x0C, 0x01, 0x02, 0x02, 0x02, 0x18, 0x0C,
+	0x01, 0x02, 0x01, 0x06, 0x14, 0x0D, 0x01, 0x02, 0x01, 0x09, 0x0F, 0x0E, 0x01, 0x02, 0x01, 0x0E,
+	0x05, 0x12, 0x01, 0x01, 0x00, 0x25, 0x01, 0x01, 0x00, 0x24, 0x01, 0x01, 0x00, 0x23, 0x01, 0x01,
+	0x01, 0x20, 0x01, 0x01, 0x03, 0x1C, 0x01, 0x01, 0x06, 0x17, 0x01, 0x01, 0x0A, 0x0F, 0x1A, 0x00,
+	// @3220 0x34 (51 pixels wide)
+	0x14, 0x00, 0x01, 0x01, 0x1F, 0x0A, 0x01, 0x01, 0x1E, 0x0B, 0x02, 0x01, 0x1D, 0x0C, 0x01, 0x01,
+	0x1C, 0x0D, 0x01, 0x01, 0x1B, 0x0E, 0x02, 0x01, 0x1A, 0x0F, 0x01, 0x01, 0x19, 0x10, 0x01, 0x01,
+	0x18, 0x11, 0x01, 0x02, 0x18, 0x07, 0x01, 0x09, 0x01, 0x02, 0x17, 0x08, 0x01, 0x09, 0x02, 0x02,
+	0x16, 0x08, 0x02, 0x09, 0x01, 0x02, 0x15, 0x08, 0x03, 0x09, 0x01, 0x02, 0x14, 0x09, 0x03, 0x09,
+	0x02, 0x02, 0x13, 0x09, 0x04, 0x09, 0x01, 0x02, 0x12, 0x09, 0x05, 0x09, 0x02, 0x02, 0x11, 0x09,
+	0x06, 0x09, 0x01, 0x02, 0x10, 0x09, 0x07, 0x09, 0x01, 0x02, 0x0F, 0x09, 0x08, 0x09, 0x01, 0x02,
+	0x0F, 0x08, 0x09, 0x09, 0x01, 0x02, 0x0E, 0x09, 0x09, 0x09, 0x01, 0x02, 0x0D, 0x09, 0x0A, 0x09,
+	0x02, 0x02, 0x0C, 0x09, 0x0B, 0x09, 0x01, 0x02, 0x0B, 0x09, 0x0C, 0x09, 0x01, 0x02, 0x0A, 0x09,
+	0x0D, 0x09, 0x01, 0x02, 0x0A, 0x08, 0x0E, 0x09, 0x01, 0x02, 0x09, 0x09, 0x0E, 0x09, 0x01, 0x02,
+	0x08, 0x09, 0x0F, 0x09, 0x01, 0x02, 0x08, 0x08, 0x10, 0x09, 0x01, 0x02, 0x07, 0x09, 0x10, 0x09,
+	0x01, 0x02, 0x06, 0x09, 0x11, 0x09, 0x01, 0x02, 0x05, 0x09, 0x12, 0x09, 0x01, 0x02, 0x05, 0x08,
+	0x13, 0x09, 0x01, 0x02, 0x04, 0x09, 0x13, 0x09, 0x01, 0x02, 0x03, 0x09, 0x14, 0x09, 0x01, 0x02,
+	0x03, 0x08, 0x15, 0x09, 0x01, 0x02, 0x02, 0x09, 0x15, 0x09, 0x01, 0x02, 0x01, 0x09, 0x16, 0x09,
+	0x01, 0x02, 0x01, 0x08, 0x17, 0x09, 0x07, 0x01, 0x00, 0x33, 0x13, 0x01, 0x20, 0x09, 0x1B, 0x00,
+	// @3444 0x35 (43 pixels wide)
+	0x14, 0x00, 0x05, 0x01, 0x08, 0x21, 0x03, 0x01, 0x07, 0x22, 0x02, 0x01, 0x07, 0x08, 0x02, 0x01,
+	0x07, 0x07, 0x05, 0x01, 0x06, 0x08, 0x02, 0x01, 0x06, 0x07, 0x05, 0x01, 0x05, 0x08, 0x02, 0x01,
+	0x05, 0x07, 0x01, 0x01, 0x05, 0x14, 0x01, 0x01, 0x04, 0x18, 0x01, 0x01, 0x04, 0x1B, 0x01, 0x01,
+	0x04, 0x1D, 0x01, 0x01, 0x04, 0x1E, 0x01, 0x01, 0x04, 0x20, 0x01, 0x01, 0x04, 0x21, 0x01, 0x02,
+	0x04, 0x02, 0x0D, 0x13, 0x01, 0x01, 0x17, 0x10, 0x01, 0x01, 0x1A, 0x0D, 0x01, 0x01, 0x1B, 0x0D,
+	0x01, 0x01, 0x1D, 0x0C, 0x02, 0x01, 0x1E, 0x0B, 0x01, 0x01, 0x1F, 0x0B, 0x02, 0x01, 0x20, 0x0A,
+	0x01, 0x01, 0x21, 0x09, 0x07, 0x01, 0x21, 0x0A, 0x02, 0x01, 0x21, 0x09, 0x02, 0x01, 0x20, 0x0A,
+	0x01, 0x01, 0x20, 0x09, 0x01, 0x01, 0x1F, 0x0A, 0x01, 0x01, 0x1E, 0x0B, 0x01, 0x01, 0x1D, 0x0B,
+	0x01, 0x01, 0x1C, 0x0B, 0x01, 0x02, 0x02, 0x01, 0x18, 0x0C, 0x01, 0x02, 0x01, 0x05, 0x13, 0x0D,
+	0x01, 0x02, 0x01, 0x08, 0x0E, 0x0E, 0x01, 0x02, 0x01, 0x0E, 0x04, 0x11, 0x01, 0x01, 0x00, 0x23,
+	0x01, 0x01, 0x00, 0x22, 0x01, 0x01, 0x00, 0x21, 0x01, 0x01, 0x00, 0x1F, 0x01, 0x01, 0x02, 0x1B,
+	0x01, 0x01, 0x05, 0x16, 0x01, 0x01, 0x09, 0x0F, 0x1A, 0x00,
+	// @3630 0x36 (47 pixels wide)
+	0x13, 0x00, 0x01, 0x01, 0x25, 0x04, 0x01, 0x01, 0x1E, 0x0B, 0x01, 0x01, 0x1A, 0x0F, 0x01, 0x01,
+	0x17, 0x12, 0x01, 0x01, 0x15, 0x14, 0x01, 0x01, 0x13, 0x16, 0x01, 0x01, 0x11, 0x18, 0x01, 0x01,
+	0x10, 0x19, 0x01, 0x01, 0x0E, 0x14, 0x01, 0x01, 0x0D, 0x10, 0x01, 0x01, 0x0C, 0x0E, 0x01, 0x01,
+	0x0B, 0x0D, 0x01, 0x01, 0x0A, 0x0C, 0x01, 0x01, 0x09, 0x0C, 0x01, 0x01, 0x08, 0x0C, 0x01, 0x01,
+	0x08, 0x0A, 0x01, 0x01, 0x07, 0x0A, 0x01, 0x01, 0x06, 0x0A, 0x01, 0x01, 0x06, 0x09, 0x01, 0x01,
+	0x05, 0x0A, 0x01, 0x01, 0x05, 0x09, 0x02, 0x01, 0x04, 0x09, 0x02, 0x01, 0x03, 0x09, 0x01, 0x02,
+	0x02, 0x09, 0x0B, 0x09, 0x01, 0x02, 0x02, 0x09, 0x07, 0x10, 0x01, 0x02, 0x02, 0x09, 0x05, 0x15,
+	0x01, 0x02, 0x01, 0x09, 0x04, 0x18, 0x01, 0x02, 0x01, 0x09, 0x03, 0x1B, 0x01, 0x02, 0x01, 0x09,
+	0x02, 0x1D, 0x01, 0x02, 0x01, 0x09, 0x01, 0x1F, 0x01, 0x03, 0x01, 0x08, 0x01, 0x0B, 0x05, 0x11,
+	0x01, 0x02, 0x00, 0x12, 0x0C, 0x0D, 0x01, 0x02, 0x00, 0x10, 0x10, 0x0C, 0x01, 0x02, 0x00, 0x0E,
+	0x13, 0x0C, 0x01, 0x02, 0x00, 0x0D, 0x15, 0x0B, 0x01, 0x02, 0x00, 0x0C, 0x17, 0x0B, 0x01, 0x02,
+	0x00, 0x0B, 0x18, 0x0B, 0x01, 0x02, 0x00, 0x0B, 0x19, 0x0A, 0x01, 0x02, 0x00, 0x0A, 0x1A, 0x0B,
+	0x01, 0x02, 0x00, 0x0A, 0x1B, 0x0A, 0x02, 0x02, 0x00, 0x09, 0x1C, 0x0A, 0x07, 0x02, 0x00, 0x09,
+	0x1D, 0x09, 0x01, 0x02, 0x01, 0x09, 0x1C, 0x09, 0x03, 0x02, 0x01, 0x09, 0x1B, 0x0A, 0x01, 0x02,
+	0x02, 0x09, 0x1A, 0x09, 0x01, 0x02, 0x02, 0x09, 0x19, 0x0A, 0x01, 0x02, 0x02, 0x0A, 0x18, 0x0A,
+	0x01, 0x02, 0x03, 0x09, 0x17, 0x0A, 0x01, 0x02, 0x03, 0x0A, 0x16, 0x0A, 0x01, 0x02, 0x04, 0x0A,
+	0x14, 0x0A, 0x01, 0x02, 0x04, 0x0B, 0x12, 0x0B, 0x01, 0x02, 0x05, 0x0B, 0x10, 0x0B, 0x01, 0x02,
+	0x06, 0x0C, 0x0C, 0x0C, 0x01, 0x02, 0x07, 0x0E, 0x07, 0x0D, 0x01, 0x01, 0x08, 0x20, 0x01, 0x01,
+	0x09, 0x1E, 0x01, 0x01, 0x0A, 0x1C, 0x01, 0x01, 0x0B, 0x1A, 0x01, 0x01, 0x0D, 0x16, 0x01, 0x01,
+	0x0F, 0x12, 0x01, 0x01, 0x12, 0x0C, 0x1A, 0x00,
+	// @3942 0x37 (44 pixels wide)
+	0x14, 0x00, 0x08, 0x01, 0x00, 0x2C, 0x02, 0x01, 0x22, 0x09, 0x02, 0x01, 0x21, 0x09, 0x02, 0x01,
+	0x20, 0x09, 0x02, 0x01, 0x1F, 0x09, 0x02, 0x01, 0x1E, 0x09, 0x02, 0x01, 0x1D, 0x09, 0x02, 0x01,
+	0x1C, 0x09, 0x02, 0x01, 0x1B, 0x09, 0x02, 0x01, 0x1A, 0x09, 0x02, 0x01, 0x19, 0x09, 0x01, 0x01,
+	0x18, 0x0A, 0x01, 0x01, 0x18, 0x09, 0x01, 0x01, 0x17, 0x0A, 0x01, 0x01, 0x17, 0x09, 0x01, 0x01,
+	0x16, 0x0A, 0x01, 0x01, 0x16, 0x09, 0x01, 0x01, 0x15, 0x0A, 0x01, 0x01, 0x15, 0x09, 0x01, 0x01,
+	0x14, 0x0A, 0x01, 0x01, 0x14, 0x09, 0x01, 0x01, 0x13, 0x0A, 0x01, 0x01, 0x13, 0x09, 0x01, 0x01,
+	0x12, 0x0A, 0x02, 0x01, 0x12, 0x09, 0x02, 0x01, 0x11, 0x09, 0x02, 0x01, 0x10, 0x09, 0x02, 0x01,
+	0x0F, 0x09, 0x02, 0x01, 0x0E, 0x09, 0x01, 0x01, 0x0D, 0x0A, 0x01, 0x01, 0x0D, 0x09, 0x01, 0x01,
+	0x0C, 0x0A, 0x01, 0x01, 0x0C, 0x09, 0x01, 0x01, 0x0B, 0x0A, 0x01, 0x01, 0x0B, 0x09, 0x01, 0x01,
+	0x0A, 0x0A, 0x01, 0x01, 0x0A, 0x09, 0x01, 0x01, 0x09, 0x0A, 0x01, 0x01, 0x09, 0x09, 0x01, 0x01,
+	0x08, 0x0A, 0x01, 0x01, 0x08, 0x09, 0x01, 0x01, 0x07, 0x0A, 0x01, 0x01, 0x07, 0x09, 0x01, 0x01,
+	0x06, 0x0A, 0x01, 0x01, 0x06, 0x09, 0x01, 0x01, 0x05, 0x0A, 0x01, 0x01, 0x05, 0x09, 0x01, 0x01,
+	0x04, 0x0A, 0x1B, 0x00,
+	// @4138 0x38 (47 pixels wide)
+	0x13, 0x00, 0x01, 0x01, 0x14, 0x08, 0x01, 0x01, 0x10, 0x10, 0x01, 0x01, 0x0D, 0x16, 0x01, 0x01,
+	0x0B, 0x1A, 0x01, 0x01, 0x0A, 0x1C, 0x01, 0x01, 0x09, 0x1E, 0x01, 0x01, 0x07, 0x21, 0x01, 0x02,
+	0x07, 0x0D, 0x08, 0x0D, 0x01, 0x02, 0x06, 0x0B, 0x0D, 0x0C, 0x01, 0x02, 0x05, 0x0B, 0x10, 0x0B,
+	0x02, 0x02, 0x04, 0x0A, 0x13, 0x0A, 0x01, 0x02, 0x04, 0x09, 0x15, 0x0A, 0x01, 0x02, 0x03, 0x09,
+	0x16, 0x0A, 0x09, 0x02, 0x03, 0x09, 0x17, 0x09, 0x02, 0x02, 0x03, 0x0A, 0x15, 0x09, 0x01, 0x02,
+	0x04, 0x0A, 0x13, 0x09, 0x01, 0x02, 0x04, 0x0B, 0x11, 0x0A, 0x01, 0x02, 0x05, 0x0C, 0x0E, 0x0A,
+	0x01, 0x02, 0x06, 0x0C, 0x0C, 0x0A, 0x01, 0x02, 0x07, 0x0D, 0x08, 0x0B, 0x01, 0x02, 0x08, 0x0F,
+	0x03, 0x0C, 0x01, 0x01, 0x09, 0x1C, 0x01, 0x01, 0x0A, 0x19, 0x01, 0x01, 0x0C, 0x15, 0x01, 0x01,
+	0x0E, 0x14, 0x01, 0x01, 0x0C, 0x18, 0x01, 0x01, 0x0A, 0x1C, 0x01, 0x01, 0x09, 0x1F, 0x01, 0x02,
+	0x07, 0x0D, 0x05, 0x10, 0x01, 0x02, 0x06, 0x0C, 0x09, 0x0F, 0x01, 0x02, 0x05, 0x0B, 0x0D, 0x0E,
+	0x01, 0x02, 0x04, 0x0A, 0x11, 0x0D, 0x01, 0x02, 0x03, 0x0A, 0x13, 0x0C, 0x01, 0x02, 0x03, 0x09,
+	0x15, 0x0C, 0x01, 0x02, 0x02, 0x0A, 0x16, 0x0B, 0x01, 0x02, 0x02, 0x09, 0x18, 0x0B, 0x01, 0x02,
+	0x01, 0x0A, 0x19, 0x0A, 0x01, 0x02, 0x01, 0x09, 0x1A, 0x0A, 0x01, 0x02, 0x01, 0x09, 0x1B, 0x0A,
+	0x07, 0x02, 0x00, 0x0A, 0x1B, 0x0A, 0x02, 0x02, 0x00, 0x0A, 0x1B, 0x09, 0x01, 0x02, 0x01, 0x0A,
+	0x19, 0x0A, 0x01, 0x02, 0x01, 0x0B, 0x18, 0x0A, 0x01, 0x02, 0x01, 0x0B, 0x17, 0x0A, 0x01, 0x02,
+	0x02, 0x0B, 0x15, 0x0B, 0x01, 0x02, 0x03, 0x0B, 0x13, 0x0B, 0x01, 0x02, 0x03, 0x0D, 0x0F, 0x0C,
+	0x01, 0x02, 0x04, 0x0E, 0x0B, 0x0D, 0x01, 0x01, 0x05, 0x24, 0x01, 0x01, 0x06, 0x22, 0x01, 0x01,
+	0x07, 0x20, 0x01, 0x01, 0x09, 0x1D, 0x01, 0x01, 0x0B, 0x19, 0x01, 0x01, 0x0D, 0x14, 0x01, 0x01,
+	0x10, 0x0E, 0x1A, 0x00,
+	// @4430 0x39 (47 pixels wide)
+	0x13, 0x00, 0x01, 0x01, 0x15, 0x07, 0x01, 0x01, 0x10, 0x10, 0x01, 0x01, 0x0E, 0x14, 0x01, 0x01,
+	0x0C, 0x18, 0x01, 0x01, 0x0A, 0x1B, 0x01, 0x01, 0x09, 0x1D, 0x01, 0x01, 0x08, 0x1F, 0x01, 0x02,
+	0x07, 0x0F, 0x03, 0x0F, 0x01, 0x02, 0x06, 0x0C, 0x0B, 0x0C, 0x01, 0x02, 0x05, 0x0B, 0x0F, 0x0B,
+	0x01, 0x02, 0x05, 0x0A, 0x11, 0x0B, 0x01, 0x02, 0x04, 0x0A, 0x13, 0x0A, 0x02, 0x02, 0x03, 0x0A,
+	0x15, 0x0A, 0x01, 0x02, 0x02, 0x0A, 0x17, 0x0A, 0x01, 0x02, 0x02, 0x09, 0x18, 0x0A, 0x01, 0x02,
+	0x02, 0x09, 0x19, 0x09, 0x01, 0x02, 0x01, 0x0A, 0x19, 0x0A, 0x01, 0x02, 0x01, 0x09, 0x1A, 0x0A,
+	0x02, 0x02, 0x01, 0x09, 0x1B, 0x09, 0x04, 0x02, 0x00, 0x0A, 0x1B, 0x0A, 0x03, 0x02, 0x00, 0x0A,
+	0x1C, 0x09, 0x02, 0x02, 0x01, 0x09, 0x1C, 0x09, 0x02, 0x02, 0x01, 0x0A, 0x1A, 0x0A, 0x01, 0x02,
+	0x01, 0x0B, 0x18, 0x0B, 0x01, 0x02, 0x02, 0x0A, 0x18, 0x0B, 0x01, 0x02, 0x02, 0x0B, 0x16, 0x0C,
+	0x01, 0x02, 0x03, 0x0B, 0x14, 0x0D, 0x01, 0x02, 0x03, 0x0C, 0x12, 0x0E, 0x01, 0x02, 0x04, 0x0C,
+	0x0F, 0x10, 0x01, 0x02, 0x05, 0x0E, 0x09, 0x13, 0x01, 0x02, 0x05, 0x20, 0x01, 0x08, 0x01, 0x02,
+	0x06, 0x1E, 0x01, 0x09, 0x01, 0x02, 0x07, 0x1C, 0x02, 0x09, 0x01, 0x02, 0x09, 0x18, 0x04, 0x09,
+	0x01, 0x02, 0x0A, 0x16, 0x05, 0x09, 0x01, 0x02, 0x0C, 0x12, 0x06, 0x09, 0x01, 0x02, 0x0F, 0x0C,
+	0x09, 0x09, 0x01, 0x01, 0x24, 0x09, 0x02, 0x01, 0x23, 0x09, 0x01, 0x01, 0x22, 0x0A, 0x01, 0x01,
+	0x22, 0x09, 0x01, 0x01, 0x21, 0x0A, 0x01, 0x01, 0x21, 0x09, 0x01, 0x01, 0x20, 0x0A, 0x01, 0x01,
+	0x1F, 0x0A, 0x01, 0x01, 0x1E, 0x0B, 0x01, 0x01, 0x1D, 0x0B, 0x01, 0x01, 0x1C, 0x0B, 0x01, 0x01,
+	0x1B, 0x0C, 0x01, 0x01, 0x1A, 0x0C, 0x01, 0x01, 0x18, 0x0D, 0x01, 0x01, 0x16, 0x0E, 0x01, 0x01,
+	0x14, 0x0F, 0x01, 0x01, 0x11, 0x11, 0x01, 0x01, 0x06, 0x1B, 0x01, 0x01, 0x06, 0x19, 0x01, 0x01,
+	0x06, 0x18, 0x01, 0x01, 0x06, 0x16, 0x01, 0x01, 0x06, 0x14, 0x01, 0x01, 0x06, 0x12, 0x01, 0x01,
+	0x06, 0x0E, 0x01, 0x01, 0x06, 0x09, 0x1A, 0x00,
+	// @4742 0x3A (12 pixels wide)
+	0x28, 0x00, 0x01, 0x01, 0x04, 0x05, 0x01, 0x01, 0x02, 0x08, 0x01, 0x01, 0x01, 0x0A, 0x07, 0x01,
+	0x00, 0x0C, 0x02, 0x01, 0x01, 0x0A, 0x01, 0x01, 0x03, 0x06, 0x19, 0x00, 0x01, 0x01, 0x03, 0x06,
+	0x01, 0x01, 0x02, 0x08, 0x01, 0x01, 0x01, 0x0A, 0x07, 0x01, 0x00, 0x0C, 0x01, 0x01, 0x01, 0x0A,
+	0x01, 0x01, 0x02, 0x08, 0x01, 0x01, 0x03, 0x06, 0x1A, 0x00,
+	// @4800 0x3B (11 pixels wide)
+	0x23, 0x00, 0x0B, 0x01, 0x00, 0x0B, 0x21, 0x00, 0x0B, 0x01, 0x00, 0x0B, 0x05, 0x01, 0x06, 0x05,
+	0x02, 0x01, 0x05, 0x05, 0x02, 0x01, 0x04, 0x06, 0x01, 0x01, 0x02, 0x07, 0x02, 0x01, 0x00, 0x08,
+	0x01, 0x01, 0x00, 0x07, 0x01, 0x01, 0x00, 0x06, 0x01, 0x01, 0x00, 0x03, 0x0C, 0x00,
+	// @4846 0x3C (50 pixels wide)
+	0x21, 0x00, 0x01, 0x01, 0x31, 0x01, 0x01, 0x01, 0x2F, 0x03, 0x01, 0x01, 0x2D, 0x05, 0x01, 0x01,
+	0x2B, 0x07, 0x01, 0x01, 0x29, 0x09, 0x01, 0x01, 0x27, 0x0B, 0x01, 0x01, 0x25, 0x0D, 0x01, 0x01,
+	0x23, 0x0F, 0x01, 0x01, 0x21, 0x0F, 0x01, 0x01, 0x1F, 0x0F, 0x01, 0x01, 0x1D, 0x0F, 0x01, 0x01,
+	0x1B, 0x0F, 0x01, 0x01, 0x1A, 0x0E, 0x01, 0x01, 0x18, 0x0E, 0x01, 0x01, 0x16, 0x0E, 0x01, 0x01,
+	0x14, 0x0E, 0x01, 0x01, 0x12, 0x0E, 0x01, 0x01, 0x10, 0x0E, 0x01, 0x01, 0x0E, 0x0E, 0x01, 0x01,
+	0x0C, 0x0E, 0x01, 0x01, 0x0A, 0x0E, 0x01, 0x01, 0x08, 0x0E, 0x01, 0x01, 0x06, 0x0E, 0x01, 0x01,
+	0x04, 0x0E, 0x01, 0x01, 0x02, 0x0E, 0x01, 0x01, 0x00, 0x0E, 0x01, 0x01, 0x00, 0x0C, 0x01, 0x01,
+	0x00, 0x0A, 0x01, 0x01, 0x00, 0x08, 0x01, 0x01, 0x00, 0x0A, 0x01, 0x01, 0x00, 0x0C, 0x01, 0x01,
+	0x00, 0x0E, 0x01, 0x01, 0x02, 0x0E, 0x01, 0x01, 0x04, 0x0E, 0x01, 0x01, 0x06, 0x0E, 0x01, 0x01,
+	0x08, 0x0E, 0x01, 0x01, 0x0A, 0x0E, 0x01, 0x01, 0x0C, 0x0E, 0x01, 0x01, 0x0E, 0x0E, 0x01, 0x01,
+	0x10, 0x0E, 0x01, 0x01, 0x12, 0x0E, 0x01, 0x01, 0x14, 0x0D, 0x01, 0x01, 0x16, 0x0D, 0x01, 0x01,
+	0x17, 0x0E, 0x01, 0x01, 0x19, 0x0E, 0x01, 0x01, 0x1B, 0x0E, 0x01, 0x01, 0x1D, 0x0E, 0x01, 0x01,
+	0x1F, 0x0E, 0x01, 0x01, 0x21, 0x0E, 0x01, 0x01, 0x23, 0x0E, 0x01, 0x01, 0x25, 0x0D, 0x01, 0x01,
+	0x27, 0x0B, 0x01, 0x01, 0x29, 0x09, 0x01, 0x01, 0x2B, 0x07, 0x01, 0x01, 0x2D, 0x05, 0x01, 0x01,
+	0x2F, 0x03, 0x01, 0x01, 0x31, 0x01, 0x1B, 0x00,
+	// @5078 0x3D (56 pixels wide)
+	0x30, 0x00, 0x06, 0x01, 0x00, 0x38, 0x0E, 0x00, 0x07, 0x01, 0x00, 0x38, 0x2A, 0x00,
+	// @5092 0x3E (50 pixels wide)
+	0x21, 0x00, 0x01, 0x01, 0x00, 0x01, 0x01, 0x01, 0x00, 0x03, 0x01, 0x01, 0x00, 0x05, 0x01, 0x01,
+	0x00, 0x07, 0x01, 0x01, 0x00, 0x09, 0x01, 0x01, 0x00, 0x0B, 0x01, 0x01, 0x00, 0x0D, 0x01, 0x01,
+	0x00, 0x0F, 0x01, 0x01, 0x02, 0x0F, 0x01, 0x01, 0x04, 0x0F, 0x01, 0x01, 0x06, 0x0E, 0x01, 0x01,
+	0x08, 0x0E, 0x01, 0x01, 0x0A, 0x0E, 0x01, 0x01, 0x0C, 0x0E, 0x01, 0x01, 0x0E, 0x0E, 0x01, 0x01,
+	0x10, 0x0E, 0x01, 0x01, 0x12, 0x0E, 0x01, 0x01, 0x14, 0x0E, 0x01, 0x01, 0x16, 0x0E, 0x01, 0x01,
+	0x18, 0x0E, 0x01, 0x01, 0x1A, 0x0E, 0x01, 0x01, 0x1C, 0x0E, 0x01, 0x01, 0x1E, 0x0E, 0x01, 0x01,
+	0x20, 0x0E, 0x01, 0x01, 0x22, 0x0E, 0x01, 0x01, 0x24, 0x0E, 0x01, 0x01, 0x26, 0x0C, 0x01, 0x01,
+	0x28, 0x0A, 0x01, 0x01, 0x2A, 0x08, 0x01, 0x01, 0x28, 0x0A, 0x01, 0x01, 0x26, 0x0C, 0x01, 0x01,
+	0x24, 0x0E, 0x01, 0x01, 0x22, 0x0E, 0x01, 0x01, 0x20, 0x0E, 0x01, 0x01, 0x1E, 0x0E, 0x01, 0x01,
+	0x1C, 0x0E, 0x01, 0x01, 0x1A, 0x0E, 0x01, 0x01, 0x18, 0x0E, 0x01, 0x01, 0x16, 0x0E, 0x01, 0x01,
+	0x14, 0x0E, 0x01, 0x01, 0x12, 0x0E, 0x01, 0x01, 0x10, 0x0E, 0x01, 0x01, 0x0E, 0x0E, 0x01, 0x01,
+	0x0C, 0x0E, 0x01, 0x01, 0x0A, 0x0E, 0x01, 0x01, 0x08, 0x0E, 0x01, 0x01, 0x06, 0x0F, 0x01, 0x01,
+	0x04, 0x0F, 0x01, 0x01, 0x02, 0x0F, 0x01, 0x01, 0x00, 0x0F, 0x01, 0x01, 0x00, 0x0D, 0x01, 0x01,
+	0x00, 0x0B, 0x01, 0x01, 0x00, 0x09, 0x01, 0x01, 0x00, 0x07, 0x01, 0x01, 0x00, 0x05, 0x01, 0x01,
+	0x00, 0x03, 0x01, 0x01, 0x00, 0x01, 0x1B, 0x00,
+	// @5324 0x3F (33 pixels wide)
+	0x11, 0x00, 0x01, 0x01, 0x07, 0x0F, 0x01, 0x01, 0x04, 0x14, 0x01, 0x01, 0x02, 0x18, 0x01, 0x01,
+	0x00, 0x1B, 0x01, 0x01, 0x00, 0x1C, 0x01, 0x01, 0x00, 0x1D, 0x01, 0x01, 0x00, 0x1E, 0x01, 0x02,
+	0x01, 0x0A, 0x03, 0x11, 0x01, 0x02, 0x01, 0x05, 0x0D, 0x0C, 0x01, 0x02, 0x02, 0x02, 0x10, 0x0C,
+	0x01, 0x01, 0x15, 0x0B, 0x02, 0x01, 0x16, 0x0A, 0x04, 0x01, 0x17, 0x0A, 0x03, 0x01, 0x17, 0x09,
+	0x01, 0x01, 0x16, 0x0A, 0x01, 0x01, 0x16, 0x09, 0x02, 0x01, 0x15, 0x0A, 0x01, 0x01, 0x14, 0x0A,
+	0x01, 0x01, 0x14, 0x09, 0x01, 0x01, 0x13, 0x0A, 0x02, 0x01, 0x12, 0x0A, 0x01, 0x01, 0x11, 0x0A,
+	0x01, 0x01, 0x10, 0x0A, 0x02, 0x01, 0x0F, 0x0A, 0x01, 0x01, 0x0E, 0x0A, 0x01, 0x01, 0x0D, 0x0A,
+	0x01, 0x01, 0x0C, 0x0A, 0x01, 0x01, 0x0C, 0x09, 0x01, 0x01, 0x0B, 0x0A, 0x01, 0x01, 0x0B, 0x09,
+	0x01, 0x01, 0x0A, 0x0A, 0x02, 0x01, 0x0A, 0x09, 0x04, 0x01, 0x09, 0x09, 0x06, 0x01, 0x09, 0x08,
+	0x09, 0x00, 0x01, 0x01, 0x0A, 0x06, 0x01, 0x01, 0x09, 0x09, 0x01, 0x01, 0x08, 0x0A, 0x07, 0x01,
+	0x07, 0x0C, 0x01, 0x01, 0x08, 0x0A, 0x01, 0x01, 0x09, 0x09, 0x01, 0x01, 0x0A, 0x06, 0x1A, 0x00,
+	// @5500 0x40 (70 pixels wide)
+	0x1B, 0x00, 0x01, 0x01, 0x1E, 0x11, 0x01, 0x01, 0x1A, 0x18, 0x01, 0x01, 0x17, 0x1E, 0x01, 0x01,
+	0x15, 0x22, 0x01, 0x01, 0x13, 0x25, 0x01, 0x02, 0x12, 0x0C, 0x10, 0x0C, 0x01, 0x02, 0x10, 0x0B,
+	0x16, 0x0A, 0x01, 0x02, 0x0F, 0x09, 0x1B, 0x09, 0x01, 0x02, 0x0E, 0x08, 0x1F, 0x08, 0x01, 0x02,
+	0x0D, 0x08, 0x21, 0x08, 0x01, 0x02, 0x0C, 0x07, 0x24, 0x08, 0x01, 0x02, 0x0B, 0x07, 0x26, 0x08,
+	0x01, 0x02, 0x0A, 0x07, 0x28, 0x08, 0x01, 0x02, 0x09, 0x07, 0x2A, 0x07, 0x01, 0x02, 0x08, 0x07,
+	0x2C, 0x07, 0x01, 0x02, 0x07, 0x07, 0x2E, 0x06, 0x01, 0x02, 0x07, 0x06, 0x2F, 0x07, 0x01, 0x03,
+	0x06, 0x06, 0x19, 0x09, 0x0F, 0x06, 0x01, 0x03, 0x05, 0x07, 0x15, 0x11, 0x0B, 0x07, 0x01, 0x03,
+	0x05, 0x06, 0x13, 0x17, 0x09, 0x06, 0x01, 0x03, 0x04, 0x06, 0x12, 0x18, 0x0A, 0x06, 0x01, 0x03,
+	0x04, 0x06, 0x11, 0x19, 0x0A, 0x07, 0x01, 0x03, 0x03, 0x06, 0x10, 0x1B, 0x0B, 0x06, 0x01, 0x04,
+	0x03, 0x06, 0x0F, 0x0B, 0x0A, 0x07, 0x0B, 0x06, 0x01, 0x04, 0x02, 0x07, 0x0E, 0x0A, 0x0C, 0x07,
+	0x0B, 0x06, 0x01, 0x04, 0x02, 0x06, 0x0E, 0x09, 0x0E, 0x06, 0x0C, 0x06, 0x01, 0x04, 0x02, 0x06,
+	0x0D, 0x09, 0x0F, 0x06, 0x0C, 0x07, 0x01, 0x04, 0x01, 0x06, 0x0E, 0x08, 0x10, 0x06, 0x0D, 0x06,
+	0x01, 0x04, 0x01, 0x06, 0x0D, 0x08, 0x10, 0x07, 0x0D, 0x06, 0x01, 0x04, 0x01, 0x06, 0x0C, 0x08,
+	0x11, 0x07, 0x0D, 0x06, 0x01, 0x04, 0x01, 0x06, 0x0C, 0x07, 0x12, 0x07, 0x0D, 0x06, 0x01, 0x04,
+	0x00, 0x06, 0x0C, 0x08, 0x12, 0x06, 0x0E, 0x06, 0x01, 0x04, 0x00, 0x06, 0x0C, 0x07, 0x13, 0x06,
+	0x0E, 0x06, 0x01, 0x04, 0x00, 0x06, 0x0B, 0x08, 0x12, 0x07, 0x0E, 0x06, 0x01, 0x04, 0x00, 0x06,
+	0x0B, 0x07, 0x13, 0x07, 0x0E, 0x06, 0x01, 0x04, 0x00, 0x06, 0x0B, 0x07, 0x13, 0x07, 0x0D, 0x06,
+	0x01, 0x04, 0x00, 0x06, 0x0A, 0x08, 0x13, 0x06, 0x0E, 0x06, 0x01, 0x04, 0x00, 0x06, 0x0A, 0x07,
+	0x14, 0x06, 0x0E, 0x06, 0x02, 0x04, 0x00, 0x06, 0x0A, 0x07, 0x13, 0x07, 0x0E, 0x06, 0x01, 0x04,
+	0x00, 0x06, 0x0A, 0x07, 0x13, 0x07, 0x0D, 0x06, 0x01, 0x04, 0x00, 0x06, 0x0A, 0x07, 0x12, 0x08,
+	0x0D, 0x06, 0x01, 0x04, 0x00, 0x06, 0x0A, 0x07, 0x12, 0x07, 0x0E, 0x06, 0x01, 0x04, 0x00, 0x06,
+	0x0A, 0x07, 0x11, 0x08, 0x0D, 0x06, 0x01, 0x04, 0x00, 0x06, 0x0A, 0x07, 0x10, 0x09, 0x0D, 0x06,
+	0x01, 0x04, 0x00, 0x06, 0x0A, 0x07, 0x0F, 0x0A, 0x0C, 0x06, 0x01, 0x04, 0x00, 0x06, 0x0A, 0x08,
+	0x0D, 0x0B, 0x0B, 0x07, 0x01, 0x05, 0x00, 0x06, 0x0A, 0x08, 0x0C, 0x06, 0x01, 0x06, 0x0A, 0x06,
+	0x01, 0x05, 0x00, 0x07, 0x0A, 0x08, 0x0A, 0x06, 0x02, 0x06, 0x09, 0x07, 0x01, 0x05, 0x01, 0x06,
+	0x0A, 0x09, 0x07, 0x07, 0x03, 0x06, 0x07, 0x08, 0x01, 0x04, 0x01, 0x06, 0x0B, 0x16, 0x03, 0x08,
+	0x04, 0x08, 0x01, 0x03, 0x01, 0x06, 0x0B, 0x15, 0x05, 0x12, 0x01, 0x03, 0x01, 0x07, 0x0B, 0x12,
+	0x07, 0x11, 0x01, 0x03, 0x02, 0x06, 0x0C, 0x10, 0x09, 0x0E, 0x01, 0x03, 0x02, 0x07, 0x0D, 0x0C,
+	0x0C, 0x0C, 0x01, 0x03, 0x02, 0x07, 0x0F, 0x08, 0x10, 0x07, 0x02, 0x01, 0x03, 0x07, 0x01, 0x01,
+	0x04, 0x07, 0x01, 0x01, 0x05, 0x07, 0x01, 0x01, 0x05, 0x08, 0x01, 0x01, 0x06, 0x08, 0x01, 0x01,
+	0x07, 0x08, 0x01, 0x01, 0x08, 0x08, 0x01, 0x01, 0x08, 0x09, 0x01, 0x01, 0x09, 0x0A, 0x01, 0x02,
+	0x0B, 0x0A, 0x1A, 0x03, 0x01, 0x02, 0x0C, 0x0B, 0x15, 0x06, 0x01, 0x02, 0x0D, 0x0E, 0x0D, 0x0B,
+	0x01, 0x01, 0x0F, 0x24, 0x01, 0x01, 0x10, 0x22, 0x01, 0x01, 0x12, 0x1E, 0x01, 0x01, 0x15, 0x18,
+	0x01, 0x01, 0x19, 0x10, 0x10, 0x00,
+	// @6034 0x41 (60 pixels wide)
+	0x12, 0x00, 0x02, 0x01, 0x18, 0x0C, 0x01, 0x01, 0x17, 0x0D, 0x02, 0x01, 0x17, 0x0E, 0x01, 0x01,
+	0x16, 0x0F, 0x02, 0x01, 0x16, 0x10, 0x01, 0x02, 0x15, 0x08, 0x01, 0x08, 0x02, 0x02, 0x15, 0x08,
+	0x01, 0x09, 0x01, 0x02, 0x14, 0x08, 0x02, 0x09, 0x02, 0x02, 0x14, 0x08, 0x03, 0x09, 0x01, 0x02,
+	0x13, 0x09, 0x03, 0x09, 0x02, 0x02, 0x13, 0x08, 0x05, 0x09, 0x01, 0x02, 0x12, 0x09, 0x05, 0x09,
+	0x01, 0x02, 0x12, 0x09, 0x05, 0x0A, 0x01, 0x02, 0x12, 0x08, 0x07, 0x09, 0x01, 0x02, 0x11, 0x09,
+	0x07, 0x09, 0x01, 0x02, 0x11, 0x09, 0x07, 0x0A, 0x02, 0x02, 0x10, 0x09, 0x09, 0x09, 0x01, 0x02,
+	0x10, 0x09, 0x09, 0x0A, 0x02, 0x02, 0x0F, 0x09, 0x0B, 0x09, 0x01, 0x02, 0x0F, 0x09, 0x0B, 0x0A,
+	0x01, 0x02, 0x0E, 0x09, 0x0D, 0x09, 0x02, 0x02, 0x0E, 0x09, 0x0D, 0x0A, 0x01, 0x02, 0x0D, 0x09,
+	0x0F, 0x09, 0x02, 0x02, 0x0D, 0x09, 0x0F, 0x0A, 0x01, 0x02, 0x0C, 0x09, 0x11, 0x09, 0x01, 0x02,
+	0x0C, 0x09, 0x11, 0x0A, 0x01, 0x02, 0x0C, 0x09, 0x12, 0x09, 0x01, 0x02, 0x0B, 0x09, 0x13, 0x09,
+	0x01, 0x02, 0x0B, 0x09, 0x13, 0x0A, 0x01, 0x02, 0x0B, 0x09, 0x14, 0x09, 0x01, 0x02, 0x0A, 0x09,
+	0x15, 0x09, 0x01, 0x02, 0x0A, 0x09, 0x15, 0x0A, 0x01, 0x01, 0x0A, 0x28, 0x01, 0x01, 0x09, 0x29,
+	0x02, 0x01, 0x09, 0x2A, 0x01, 0x01, 0x08, 0x2B, 0x02, 0x01, 0x08, 0x2C, 0x01, 0x02, 0x07, 0x0A,
+	0x19, 0x0A, 0x02, 0x02, 0x07, 0x09, 0x1B, 0x0A, 0x01, 0x02, 0x06, 0x0A, 0x1B, 0x0A, 0x02, 0x02,
+	0x06, 0x09, 0x1D, 0x0A, 0x01, 0x02, 0x05, 0x0A, 0x1D, 0x0A, 0x02, 0x02, 0x05, 0x09, 0x1F, 0x0A,
+	0x01, 0x02, 0x04, 0x0A, 0x1F, 0x0A, 0x02, 0x02, 0x04, 0x09, 0x21, 0x0A, 0x01, 0x02, 0x03, 0x0A,
+	0x21, 0x0A, 0x02, 0x02, 0x03, 0x09, 0x23, 0x0A, 0x01, 0x02, 0x02, 0x0A, 0x24, 0x09, 0x02, 0x02,
+	0x02, 0x09, 0x25, 0x0A, 0x01, 0x02, 0x01, 0x0A, 0x26, 0x09, 0x02, 0x02, 0x01, 0x09, 0x27, 0x0A,
+	0x01, 0x02, 0x00, 0x0A, 0x28, 0x0A, 0x01, 0x02, 0x00, 0x09, 0x29, 0x0A, 0x1B, 0x00,
+	// @6336 0x42 (46 pixels wide)
+	0x11, 0x00, 0x01, 0x01, 0x0B, 0x0B, 0x01, 0x01, 0x02, 0x1A, 0x01, 0x01, 0x00, 0x1F, 0x01, 0x01,
+	0x00, 0x22, 0x01, 0x01, 0x00, 0x23, 0x01, 0x01, 0x00, 0x25, 0x01, 0x01, 0x00, 0x26, 0x01, 0x01,
+	0x00, 0x27, 0x01, 0x02, 0x00, 0x09, 0x10, 0x0F, 0x01, 0x02, 0x00, 0x09, 0x13, 0x0D, 0x01, 0x02,
+	0x00, 0x09, 0x15, 0x0B, 0x01, 0x02, 0x00, 0x09, 0x16, 0x0B, 0x02, 0x02, 0x00, 0x09, 0x17, 0x0A,
+	0x08, 0x02, 0x00, 0x09, 0x18, 0x0A, 0x02, 0x02, 0x00, 0x09, 0x18, 0x09, 0x01, 0x02, 0x00, 0x09,
+	0x17, 0x0A, 0x01, 0x02, 0x00, 0x09, 0x17, 0x09, 0x01, 0x02, 0x00, 0x09, 0x16, 0x0A, 0x01, 0x02,
+	0x00, 0x09, 0x15, 0x0A, 0x01, 0x02, 0x00, 0x09, 0x14, 0x0A, 0x01, 0x02, 0x00, 0x09, 0x12, 0x0B,
+	0x01, 0x02, 0x00, 0x09, 0x10, 0x0C, 0x01, 0x01, 0x00, 0x24, 0x01, 0x01, 0x00, 0x22, 0x01, 0x01,
+	0x00, 0x20, 0x01, 0x01, 0x00, 0x1F, 0x01, 0x01, 0x00, 0x22, 0x01, 0x01, 0x00, 0x24, 0x01, 0x01,
+	0x00, 0x26, 0x01, 0x02, 0x00, 0x09, 0x0B, 0x13, 0x01, 0x02, 0x00, 0x09, 0x10, 0x0F, 0x01, 0x02,
+	0x00, 0x09, 0x13, 0x0D, 0x01, 0x02, 0x00, 0x09, 0x15, 0x0C, 0x01, 0x02, 0x00, 0x09, 0x16, 0x0C,
+	0x01, 0x02, 0x00, 0x09, 0x17, 0x0B, 0x01, 0x02, 0x00, 0x09, 0x18, 0x0B, 0x01, 0x02, 0x00, 0x09,
+	0x19, 0x0A, 0x03, 0x02, 0x00, 0x09, 0x1A, 0x0A, 0x01, 0x02, 0x00, 0x09, 0x1B, 0x09, 0x05, 0x02,
+	0x00, 0x09, 0x1B, 0x0A, 0x03, 0x02, 0x00, 0x09, 0x1A, 0x0A, 0x01, 0x02, 0x00, 0x09, 0x19, 0x0B,
+	0x01, 0x02, 0x00, 0x09, 0x19, 0x0A, 0x01, 0x02, 0x00, 0x09, 0x18, 0x0B, 0x01, 0x02, 0x00, 0x09,
+	0x17, 0x0C, 0x01, 0x02, 0x00, 0x09, 0x16, 0x0C, 0x01, 0x02, 0x00, 0x09, 0x15, 0x0C, 0x01, 0x02,
+	0x00, 0x09, 0x13, 0x0E, 0x01, 0x02, 0x00, 0x09, 0x10, 0x10, 0x01, 0x01, 0x00, 0x28, 0x01, 0x01,
+	0x00, 0x27, 0x01, 0x01, 0x00, 0x25, 0x01, 0x01, 0x00, 0x24, 0x01, 0x01, 0x00, 0x22, 0x01, 0x01,
+	0x00, 0x1F, 0x01, 0x01, 0x00, 0x1B, 0x01, 0x01, 0x08, 0x0B, 0x1A, 0x00,
+	// @6636 0x43 (54 pixels wide)
+	0x11, 0x00, 0x01, 0x01, 0x1D, 0x11, 0x01, 0x01, 0x19, 0x1A, 0x01, 0x01, 0x16, 0x20, 0x01, 0x01,
+	0x14, 0x22, 0x01, 0x01, 0x12, 0x24, 0x01, 0x01, 0x10, 0x26, 0x01, 0x01, 0x0F, 0x27, 0x01, 0x01,
+	0x0D, 0x28, 0x01, 0x02, 0x0C, 0x12, 0x10, 0x07, 0x01, 0x02, 0x0B, 0x0F, 0x18, 0x03, 0x01, 0x01,
+	0x0A, 0x0E, 0x01, 0x01, 0x09, 0x0D, 0x01, 0x01, 0x08, 0x0D, 0x01, 0x01, 0x07, 0x0C, 0x01, 0x01,
+	0x07, 0x0B, 0x01, 0x01, 0x06, 0x0B, 0x02, 0x01, 0x05, 0x0B, 0x01, 0x01, 0x04, 0x0B, 0x01, 0x01,
+	0x04, 0x0A, 0x01, 0x01, 0x03, 0x0B, 0x01, 0x01, 0x03, 0x0A, 0x01, 0x01, 0x02, 0x0B, 0x02, 0x01,
+	0x02, 0x0A, 0x04, 0x01, 0x01, 0x0A, 0x01, 0x01, 0x01, 0x09, 0x10, 0x01, 0x00, 0x0A, 0x03, 0x01,
+	0x01, 0x0A, 0x01, 0x01, 0x01, 0x0B, 0x02, 0x01, 0x02, 0x0A, 0x01, 0x01, 0x02, 0x0B, 0x01, 0x01,
+	0x03, 0x0A, 0x01, 0x01, 0x03, 0x0B, 0x01, 0x01, 0x03, 0x0C, 0x01, 0x01, 0x04, 0x0B, 0x01, 0x01,
+	0x04, 0x0C, 0x01, 0x01, 0x05, 0x0C, 0x01, 0x01, 0x06, 0x0C, 0x01, 0x01, 0x06, 0x0D, 0x01, 0x01,
+	0x07, 0x0E, 0x01, 0x01, 0x08, 0x0E, 0x01, 0x02, 0x09, 0x0F, 0x1C, 0x01, 0x01, 0x02, 0x0A, 0x11,
+	0x16, 0x04, 0x01, 0x02, 0x0B, 0x13, 0x0F, 0x08, 0x01, 0x01, 0x0C, 0x29, 0x01, 0x01, 0x0D, 0x29,
+	0x01, 0x01, 0x0F, 0x27, 0x01, 0x01, 0x10, 0x26, 0x01, 0x01, 0x12, 0x24, 0x01, 0x01, 0x15, 0x20,
+	0x01, 0x01, 0x18, 0x1A, 0x01, 0x01, 0x1C, 0x11, 0x1A, 0x00,
+	// @6854 0x44 (59 pixels wide)
+	0x11, 0x00, 0x01, 0x01, 0x0D, 0x0C, 0x01, 0x01, 0x02, 0x1F, 0x01, 0x01, 0x00, 0x25, 0x01, 0x01,
+	0x00, 0x28, 0x01, 0x01, 0x00, 0x2A, 0x01, 0x01, 0x00, 0x2C, 0x01, 0x01, 0x00, 0x2E, 0x01, 0x01,
+	0x00, 0x2F, 0x01, 0x02, 0x00, 0x0A, 0x13, 0x13, 0x01, 0x02, 0x00, 0x09, 0x18, 0x10, 0x01, 0x02,
+	0x00, 0x09, 0x1A, 0x0F, 0x01, 0x02, 0x00, 0x09, 0x1C, 0x0E, 0x01, 0x02, 0x00, 0x09, 0x1E, 0x0D,
+	0x01, 0x02, 0x00, 0x09, 0x1F, 0x0D, 0x01, 0x02, 0x00, 0x09, 0x21, 0x0C, 0x01, 0x02, 0x00, 0x09,
+	0x22, 0x0B, 0x02, 0x02, 0x00, 0x09, 0x23, 0x0B, 0x01, 0x02, 0x00, 0x09, 0x24, 0x0B, 0x01, 0x02,
+	0x00, 0x09, 0x25, 0x0A, 0x01, 0x02, 0x00, 0x09, 0x25, 0x0B, 0x01, 0x02, 0x00, 0x09, 0x26, 0x0A,
+	0x01, 0x02, 0x00, 0x09, 0x26, 0x0B, 0x03, 0x02, 0x00, 0x09, 0x27, 0x0A, 0x07, 0x02, 0x00, 0x09,
+	0x28, 0x0A, 0x06, 0x02, 0x00, 0x09, 0x29, 0x09, 0x06, 0x02, 0x00, 0x09, 0x28, 0x0A, 0x01, 0x02,
+	0x00, 0x09, 0x28, 0x09, 0x03, 0x02, 0x00, 0x09, 0x27, 0x0A, 0x02, 0x02, 0x00, 0x09, 0x26, 0x0A,
+	0x01, 0x02, 0x00, 0x09, 0x25, 0x0B, 0x01, 0x02, 0x00, 0x09, 0x25, 0x0A, 0x01, 0x02, 0x00, 0x09,
+	0x24, 0x0B, 0x01, 0x02, 0x00, 0x09, 0x24, 0x0A, 0x01, 0x02, 0x00, 0x09, 0x23, 0x0B, 0x01, 0x02,
+	0x00, 0x09, 0x22, 0x0B, 0x01, 0x02, 0x00, 0x09, 0x21, 0x0C, 0x01, 0x02, 0x00, 0x09, 0x20, 0x0C,
+	0x01, 0x02, 0x00, 0x09, 0x1F, 0x0C, 0x01, 0x02, 0x00, 0x09, 0x1E, 0x0D, 0x01, 0x02, 0x00, 0x09,
+	0x1D, 0x0D, 0x01, 0x02, 0x00, 0x09, 0x1B, 0x0E, 0x01, 0x02, 0x00, 0x09, 0x19, 0x0F, 0x01, 0x02,
+	0x00, 0x09, 0x16, 0x11, 0x01, 0x02, 0x00, 0x09, 0x12, 0x13, 0x01, 0x01, 0x00, 0x2D, 0x01, 0x01,
+	0x00, 0x2C, 0x01, 0x01, 0x00, 0x2A, 0x01, 0x01, 0x00, 0x28, 0x01, 0x01, 0x00, 0x25, 0x01, 0x01,
+	0x00, 0x22, 0x01, 0x01, 0x00, 0x1E, 0x01, 0x01, 0x09, 0x0D, 0x1A, 0x00,
+	// @7138 0x45 (41 pixels wide)
+	0x12, 0x00, 0x08, 0x01, 0x00, 0x27, 0x16, 0x01, 0x00, 0x09, 0x08, 0x01, 0x00, 0x25, 0x1A, 0x01,
+	0x00, 0x09, 0x08, 0x01, 0x00, 0x29, 0x1B, 0x00,
+	// @7162 0x46 (39 pixels wide)
+	0x12, 0x00, 0x08, 0x01, 0x00, 0x27, 0x18, 0x01, 0x00, 0x09, 0x07, 0x01, 0x00, 0x25, 0x21, 0x01,
+	0x00, 0x09, 0x1B, 0x00,
+	// @7182 0x47 (59 pixels wide)
+	0x11, 0x00, 0x01, 0x01, 0x20, 0x0E, 0x01, 0x01, 0x1B, 0x18, 0x01, 0x01, 0x18, 0x1F, 0x01, 0x01,
+	0x15, 0x24, 0x01, 0x01, 0x13, 0x26, 0x01, 0x01, 0x11, 0x27, 0x01, 0x01, 0x0F, 0x29, 0x01, 0x01,
+	0x0E, 0x2A, 0x01, 0x02, 0x0D, 0x13, 0x0E, 0x09, 0x01, 0x02, 0x0C, 0x10, 0x17, 0x04, 0x01, 0x02,
+	0x0B, 0x0E, 0x1C, 0x02, 0x01, 0x01, 0x09, 0x0E, 0x01, 0x01, 0x09, 0x0D, 0x01, 0x01, 0x08, 0x0C,
+	0x01, 0x01, 0x07, 0x0C, 0x01, 0x01, 0x06, 0x0C, 0x01, 0x01, 0x06, 0x0B, 0x01, 0x01, 0x05, 0x0B,
+	0x01, 0x01, 0x04, 0x0B, 0x01, 0x01, 0x04, 0x0A, 0x01, 0x01, 0x03, 0x0B, 0x01, 0x01, 0x03, 0x0A,
+	0x01, 0x01, 0x02, 0x0B, 0x02, 0x01, 0x02, 0x0A, 0x04, 0x01, 0x01, 0x0A, 0x01, 0x01, 0x01, 0x09,
+	0x05, 0x01, 0x00, 0x0A, 0x08, 0x02, 0x00, 0x0A, 0x19, 0x18, 0x02, 0x02, 0x00, 0x0A, 0x28, 0x09,
+	0x04, 0x02, 0x01, 0x0A, 0x27, 0x09, 0x01, 0x02, 0x01, 0x0B, 0x26, 0x09, 0x01, 0x02, 0x02, 0x0A,
+	0x26, 0x09, 0x02, 0x02, 0x02, 0x0B, 0x25, 0x09, 0x02, 0x02, 0x03, 0x0B, 0x24, 0x09, 0x01, 0x02,
+	0x04, 0x0B, 0x23, 0x09, 0x01, 0x02, 0x04, 0x0C, 0x22, 0x09, 0x01, 0x02, 0x05, 0x0B, 0x22, 0x09,
+	0x01, 0x02, 0x05, 0x0C, 0x21, 0x09, 0x01, 0x02, 0x06, 0x0C, 0x20, 0x09, 0x01, 0x02, 0x07, 0x0D,
+	0x1E, 0x09, 0x01, 0x02, 0x07, 0x0E, 0x1D, 0x09, 0x01, 0x02, 0x08, 0x0F, 0x1B, 0x09, 0x01, 0x02,
+	0x09, 0x10, 0x19, 0x09, 0x01, 0x02, 0x0A, 0x11, 0x16, 0x0A, 0x01, 0x02, 0x0B, 0x14, 0x0E, 0x0E,
+	0x01, 0x01, 0x0D, 0x2E, 0x01, 0x01, 0x0E, 0x2D, 0x01, 0x01, 0x10, 0x2B, 0x01, 0x01, 0x11, 0x2A,
+	0x01, 0x01, 0x13, 0x26, 0x01, 0x01, 0x16, 0x20, 0x01, 0x01, 0x19, 0x18, 0x01, 0x01, 0x20, 0x0A,
+	0x1A, 0x00,
+	// @7440 0x48 (54 pixels wide)
+	0x12, 0x00, 0x1E, 0x02, 0x00, 0x09, 0x23, 0x0A, 0x08, 0x01, 0x00, 0x36, 0x22, 0x02, 0x00, 0x09,
+	0x23, 0x0A, 0x1B, 0x00,
+	// @7460 0x49 (9 pixels wide)
+	0x12, 0x00, 0x48, 0x01, 0x00, 0x09, 0x1B, 0x00,
+	// @7468 0x4A (32 pixels wide)
+	0x12, 0x00, 0x35, 0x01, 0x17, 0x09, 0x03, 0x01, 0x16, 0x0A, 0x01, 0x01, 0x16, 0x09, 0x03, 0x01,
+	0x15, 0x0A, 0x01, 0x01, 0x14, 0x0A, 0x01, 0x01, 0x13, 0x0B, 0x01, 0x01, 0x12, 0x0C, 0x01, 0x01,
+	0x11, 0x0C, 0x01, 0x02, 0x02, 0x02, 0x0B, 0x0D, 0x01, 0x01, 0x01, 0x1B, 0x01, 0x01, 0x01, 0x1A,
+	0x01, 0x01, 0x01, 0x19, 0x01, 0x01, 0x01, 0x18, 0x01, 0x01, 0x01, 0x17, 0x01, 0x01, 0x01, 0x15,
+	0x01, 0x01, 0x00, 0x14, 0x01, 0x01, 0x04, 0x0D, 0x1A, 0x00,
+	// @7542 0x4B (51 pixels wide)
+	0x12, 0x00, 0x01, 0x02, 0x00, 0x09, 0x1C, 0x0C, 0x01, 0x02, 0x00, 0x09, 0x1B, 0x0C, 0x01, 0x02,
+	0x00, 0x09, 0x1A, 0x0C, 0x01, 0x02, 0x00, 0x09, 0x1A, 0x0B, 0x01, 0x02, 0x00, 0x09, 0x19, 0x0B,
+	0x01, 0x02, 0x00, 0x09, 0x18, 0x0B, 0x01, 0x02, 0x00, 0x09, 0x17, 0x0B, 0x01, 0x02, 0x00, 0x09,
+	0x16, 0x0C, 0x01, 0x02, 0x00, 0x09, 0x15, 0x0C, 0x01, 0x02, 0x00, 0x09, 0x15, 0x0B, 0x01, 0x02,
+	0x00, 0x09, 0x14, 0x0B, 0x01, 0x02, 0x00, 0x09, 0x13, 0x0B, 0x01, 0x02, 0x00, 0x09, 0x12, 0x0B,
+	0x02, 0x02, 0x00, 0x09, 0x11, 0x0B, 0x01, 0x02, 0x00, 0x09, 0x10, 0x0B, 0x01, 0x02, 0x00, 0x09,
+	0x0F, 0x0B, 0x01, 0x02, 0x00, 0x09, 0x0E, 0x0B, 0x01, 0x02, 0x00, 0x09, 0x0D, 0x0B, 0x01, 0x02,
+	0x00, 0x09, 0x0D, 0x0A, 0x01, 0x02, 0x00, 0x09, 0x0C, 0x0A, 0x01, 0x02, 0x00, 0x09, 0x0B, 0x0B,
+	0x01, 0x02, 0x00, 0x09, 0x0A, 0x0B, 0x01, 0x02, 0x00, 0x09, 0x09, 0x0B, 0x01, 0x02, 0x00, 0x09,
+	0x08, 0x0B, 0x01, 0x02, 0x00, 0x09, 0x08, 0x0A, 0x01, 0x02, 0x00, 0x09, 0x07, 0x0A, 0x01, 0x02,
+	0x00, 0x09, 0x06, 0x0A, 0x01, 0x02, 0x00, 0x09, 0x05, 0x0B, 0x01, 0x02, 0x00, 0x09, 0x04, 0x0B,
+	0x01, 0x02, 0x00, 0x09, 0x04, 0x0A, 0x01, 0x02, 0x00, 0x09, 0x03, 0x0C, 0x01, 0x02, 0x00, 0x09,
+	0x02, 0x0D, 0x01, 0x02, 0x00, 0x09, 0x02, 0x0E, 0x01, 0x02, 0x00, 0x09, 0x01, 0x10, 0x01, 0x01,
+	0x00, 0x1A, 0x01, 0x01, 0x00, 0x1B, 0x01, 0x02, 0x00, 0x10, 0x01, 0x0B, 0x01, 0x02, 0x00, 0x0F,
+	0x03, 0x0A, 0x01, 0x02, 0x00, 0x0E, 0x04, 0x0B, 0x01, 0x02, 0x00, 0x0D, 0x06, 0x0B, 0x01, 0x02,
+	0x00, 0x0C, 0x08, 0x0A, 0x01, 0x02, 0x00, 0x0B, 0x09, 0x0B, 0x01, 0x02, 0x00, 0x0A, 0x0B, 0x0B,
+	0x01, 0x02, 0x00, 0x09, 0x0D, 0x0A, 0x01, 0x02, 0x00, 0x09, 0x0D, 0x0B, 0x01, 0x02, 0x00, 0x09,
+	0x0E, 0x0B, 0x01, 0x02, 0x00, 0x09, 0x0F, 0x0A, 0x01, 0x02, 0x00, 0x09, 0x0F, 0x0B, 0x01, 0x02,
+	0x00, 0x09, 0x10, 0x0B, 0x01, 0x02, 0x00, 0x09, 0x11, 0x0A, 0x01, 0x02, 0x00, 0x09, 0x11, 0x0B,
+	0x01, 0x02, 0x00, 0x09, 0x12, 0x0B, 0x02, 0x02, 0x00, 0x09, 0x13, 0x0B, 0x01, 0x02, 0x00, 0x09,
+	0x14, 0x0B, 0x02, 0x02, 0x00, 0x09, 0x15, 0x0B, 0x01, 0x02, 0x00, 0x09, 0x16, 0x0B, 0x02, 0x02,
+	0x00, 0x09, 0x17, 0x0B, 0x01, 0x02, 0x00, 0x09, 0x18, 0x0B, 0x02, 0x02, 0x00, 0x09, 0x19, 0x0B,
+	0x01, 0x02, 0x00, 0x09, 0x1A, 0x0B, 0x02, 0x02, 0x00, 0x09, 0x1B, 0x0B, 0x01, 0x02, 0x00, 0x09,
+	0x1C, 0x0B, 0x02, 0x02, 0x00, 0x09, 0x1D, 0x0B, 0x01, 0x02, 0x00, 0x09, 0x1E, 0x0B, 0x01, 0x02,
+	0x00, 0x09, 0x1F, 0x0B, 0x1B, 0x00,
+	// @7932 0x4C (40 pixels wide)
+	0x12, 0x00, 0x40, 0x01, 0x00, 0x09, 0x08, 0x01, 0x00, 0x28, 0x1B, 0x00,
+	// @7944 0x4D (74 pixels wide)
+	0x12, 0x00, 0x01, 0x02, 0x05, 0x0C, 0x28, 0x0C, 0x01, 0x02, 0x05, 0x0D, 0x27, 0x0C, 0x02, 0x02,
+	0x05, 0x0D, 0x26, 0x0E, 0x01, 0x02, 0x05, 0x0E, 0x25, 0x0E, 0x02, 0x02, 0x05, 0x0E, 0x24, 0x0F,
+	0x01, 0x02, 0x05, 0x0F, 0x23, 0x0F, 0x01, 0x02, 0x05, 0x0F, 0x22, 0x10, 0x01, 0x04, 0x05, 0x07,
+	0x01, 0x07, 0x22, 0x07, 0x01, 0x08, 0x01, 0x04, 0x04, 0x08, 0x01, 0x08, 0x21, 0x07, 0x01, 0x08,
+	0x01, 0x04, 0x04, 0x08, 0x01, 0x08, 0x20, 0x08, 0x01, 0x08, 0x01, 0x04, 0x04, 0x08, 0x01, 0x09,
+	0x1F, 0x07, 0x02, 0x08, 0x02, 0x04, 0x04, 0x08, 0x02, 0x08, 0x1E, 0x08, 0x02, 0x08, 0x01, 0x04,
+	0x04, 0x08, 0x02, 0x09, 0x1D, 0x08, 0x02, 0x08, 0x01, 0x04, 0x04, 0x08, 0x02, 0x09, 0x1C, 0x08,
+	0x03, 0x08, 0x01, 0x04, 0x04, 0x08, 0x03, 0x08, 0x1C, 0x08, 0x03, 0x08, 0x01, 0x04, 0x04, 0x08,
+	0x03, 0x09, 0x1B, 0x08, 0x03, 0x09, 0x01, 0x04, 0x04, 0x08, 0x03, 0x09, 0x1A, 0x08, 0x04, 0x09,
+	0x01, 0x04, 0x04, 0x08, 0x04, 0x08, 0x1A, 0x08, 0x04, 0x09, 0x01, 0x04, 0x04, 0x08, 0x04, 0x09,
+	0x18, 0x09, 0x04, 0x09, 0x02, 0x04, 0x04, 0x08, 0x04, 0x09, 0x18, 0x08, 0x05, 0x09, 0x01, 0x04,
+	0x04, 0x08, 0x05, 0x09, 0x16, 0x09, 0x05, 0x09, 0x01, 0x04, 0x03, 0x09, 0x05, 0x09, 0x16, 0x08,
+	0x06, 0x09, 0x01, 0x04, 0x03, 0x09, 0x05, 0x0A, 0x15, 0x08, 0x06, 0x09, 0x01, 0x04, 0x03, 0x09,
+	0x06, 0x09, 0x14, 0x09, 0x06, 0x09, 0x01, 0x04, 0x03, 0x09, 0x06, 0x09, 0x14, 0x08, 0x07, 0x09,
+	0x01, 0x04, 0x03, 0x09, 0x06, 0x0A, 0x13, 0x08, 0x07, 0x09, 0x01, 0x04, 0x03, 0x09, 0x07, 0x09,
+	0x12, 0x09, 0x07, 0x09, 0x01, 0x04, 0x03, 0x09, 0x07, 0x09, 0x12, 0x08, 0x08, 0x09, 0x01, 0x04,
+	0x03, 0x09, 0x07, 0x0A, 0x10, 0x09, 0x08, 0x09, 0x01, 0x04, 0x03, 0x08, 0x09, 0x09, 0x10, 0x09,
+	0x09, 0x08, 0x01, 0x04, 0x03, 0x08, 0x09, 0x09, 0x10, 0x08, 0x0A, 0x08, 0x01, 0x04, 0x03, 0x08,
+	0x09, 0x0A, 0x0E, 0x09, 0x0A, 0x09, 0x02, 0x04, 0x03, 0x08, 0x0A, 0x09, 0x0E, 0x08, 0x0B, 0x09,
+	0x01, 0x04, 0x03, 0x08, 0x0A, 0x0A, 0x0C, 0x09, 0x0B, 0x09, 0x02, 0x04, 0x02, 0x09, 0x0B, 0x09,
+	0x0C, 0x08, 0x0C, 0x09, 0x01, 0x04, 0x02, 0x09, 0x0B, 0x0A, 0x0A, 0x09, 0x0C, 0x09, 0x02, 0x04,
+	0x02, 0x09, 0x0C, 0x09, 0x0A, 0x08, 0x0D, 0x09, 0x01, 0x04, 0x02, 0x09, 0x0C, 0x0A, 0x08, 0x09,
+	0x0D, 0x09, 0x02, 0x04, 0x02, 0x09, 0x0D, 0x09, 0x08, 0x08, 0x0E, 0x09, 0x01, 0x04, 0x02, 0x09,
+	0x0D, 0x09, 0x07, 0x08, 0x0F, 0x09, 0x02, 0x04, 0x02, 0x09, 0x0E, 0x09, 0x06, 0x08, 0x0F, 0x09,
+	0x01, 0x04, 0x02, 0x08, 0x0F, 0x09, 0x05, 0x08, 0x10, 0x09, 0x02, 0x04, 0x02, 0x08, 0x10, 0x09,
+	0x04, 0x08, 0x11, 0x09, 0x01, 0x04, 0x02, 0x08, 0x10, 0x09, 0x03, 0x08, 0x12, 0x09, 0x01, 0x04,
+	0x01, 0x09, 0x11, 0x08, 0x03, 0x08, 0x12, 0x09, 0x01, 0x04, 0x01, 0x09, 0x11, 0x09, 0x02, 0x08,
+	0x12, 0x09, 0x01, 0x04, 0x01, 0x09, 0x11, 0x09, 0x02, 0x07, 0x13, 0x09, 0x01, 0x04, 0x01, 0x09,
+	0x12, 0x08, 0x01, 0x08, 0x13, 0x09, 0x02, 0x03, 0x01, 0x09, 0x12, 0x10, 0x14, 0x09, 0x01, 0x03,
+	0x01, 0x09, 0x13, 0x0F, 0x14, 0x09, 0x01, 0x03, 0x01, 0x09, 0x13, 0x0E, 0x15, 0x09, 0x02, 0x03,
+	0x01, 0x09, 0x14, 0x0D, 0x15, 0x09, 0x01, 0x03, 0x01, 0x09, 0x14, 0x0C, 0x16, 0x09, 0x01, 0x03,
+	0x01, 0x09, 0x15, 0x0B, 0x16, 0x09, 0x01, 0x03, 0x01, 0x08, 0x16, 0x0B, 0x16, 0x09, 0x01, 0x03,
+	0x01, 0x08, 0x16, 0x0A, 0x17, 0x0A, 0x01, 0x03, 0x00, 0x09, 0x17, 0x09, 0x17, 0x0A, 0x02, 0x03,
+	0x00, 0x09, 0x17, 0x08, 0x19, 0x09, 0x01, 0x03, 0x00, 0x09, 0x18, 0x07, 0x19, 0x09, 0x1B, 0x00,
+	// @8488 0x4E (54 pixels wide)
+	0x12, 0x00, 0x02, 0x02, 0x00, 0x0B, 0x22, 0x09, 0x01, 0x02, 0x00, 0x0C, 0x21, 0x09, 0x02, 0x02,
+	0x00, 0x0D, 0x20, 0x09, 0x01, 0x02, 0x00, 0x0E, 0x1F, 0x09, 0x02, 0x02, 0x00, 0x0F, 0x1E, 0x09,
+	0x02, 0x02, 0x00, 0x10, 0x1D, 0x09, 0x01, 0x02, 0x00, 0x11, 0x1C, 0x09, 0x02, 0x03, 0x00, 0x08,
+	0x01, 0x09, 0x1B, 0x09, 0x01, 0x03, 0x00, 0x08, 0x02, 0x09, 0x1A, 0x09, 0x01, 0x03, 0x00, 0x08,
+	0x02, 0x0A, 0x19, 0x09, 0x01, 0x03, 0x00, 0x08, 0x03, 0x09, 0x19, 0x09, 0x01, 0x03, 0x00, 0x09,
+	0x02, 0x0A, 0x18, 0x09, 0x02, 0x03, 0x00, 0x09, 0x03, 0x0A, 0x17, 0x09, 0x02, 0x03, 0x00, 0x09,
+	0x04, 0x0A, 0x16, 0x09, 0x01, 0x03, 0x00, 0x09, 0x05, 0x0A, 0x15, 0x09, 0x01, 0x03, 0x00, 0x09,
+	0x05, 0x0B, 0x14, 0x09, 0x01, 0x03, 0x00, 0x09, 0x06, 0x0A, 0x14, 0x09, 0x01, 0x03, 0x00, 0x09,
+	0x06, 0x0B, 0x13, 0x09, 0x01, 0x03, 0x00, 0x09, 0x07, 0x0B, 0x12, 0x09, 0x01, 0x03, 0x00, 0x09,
+	0x08, 0x0A, 0x12, 0x09, 0x01, 0x03, 0x00, 0x09, 0x08, 0x0B, 0x11, 0x09, 0x01, 0x03, 0x00, 0x09,
+	0x09, 0x0A, 0x11, 0x09, 0x01, 0x03, 0x00, 0x09, 0x09, 0x0B, 0x10, 0x09, 0x01, 0x03, 0x00, 0x09,
+	0x0A, 0x0B, 0x10, 0x08, 0x01, 0x03, 0x00, 0x09, 0x0B, 0x0A, 0x10, 0x08, 0x01, 0x03, 0x00, 0x09,
+	0x0B, 0x0B, 0x0F, 0x08, 0x02, 0x03, 0x00, 0x09, 0x0C, 0x0B, 0x0E, 0x08, 0x01, 0x03, 0x00, 0x09,
+	0x0D, 0x0B, 0x0D, 0x08, 0x02, 0x03, 0x00, 0x09, 0x0E, 0x0B, 0x0C, 0x08, 0x02, 0x03, 0x00, 0x09,
+	0x0F, 0x0B, 0x0B, 0x08, 0x01, 0x03, 0x00, 0x09, 0x10, 0x0B, 0x0A, 0x08, 0x02, 0x03, 0x00, 0x09,
+	0x11, 0x0B, 0x09, 0x08, 0x01, 0x03, 0x00, 0x09, 0x12, 0x0B, 0x08, 0x08, 0x01, 0x03, 0x00, 0x09,
+	0x13, 0x0A, 0x08, 0x08, 0x01, 0x03, 0x00, 0x09, 0x13, 0x0B, 0x07, 0x08, 0x01, 0x03, 0x00, 0x09,
+	0x14, 0x0A, 0x07, 0x08, 0x01, 0x03, 0x00, 0x09, 0x15, 0x0A, 0x06, 0x08, 0x01, 0x03, 0x00, 0x09,
+	0x15, 0x0B, 0x05, 0x08, 0x01, 0x03, 0x00, 0x09, 0x16, 0x0A, 0x05, 0x08, 0x01, 0x03, 0x00, 0x09,
+	0x16, 0x0B, 0x04, 0x08, 0x01, 0x03, 0x00, 0x09, 0x17, 0x0A, 0x04, 0x08, 0x02, 0x03, 0x00, 0x09,
+	0x18, 0x0A, 0x03, 0x08, 0x01, 0x03, 0x00, 0x09, 0x19, 0x0A, 0x02, 0x08, 0x01, 0x03, 0x00, 0x09,
+	0x1A, 0x09, 0x02, 0x08, 0x01, 0x03, 0x00, 0x09, 0x1A, 0x0A, 0x01, 0x08, 0x01, 0x03, 0x00, 0x09,
+	0x1B, 0x09, 0x01, 0x08, 0x01, 0x02, 0x00, 0x09, 0x1B, 0x12, 0x01, 0x03, 0x00, 0x09, 0x1C, 0x09,
+	0x01, 0x07, 0x02, 0x02, 0x00, 0x09, 0x1D, 0x10, 0x01, 0x02, 0x00, 0x09, 0x1E, 0x0F, 0x02, 0x02,
+	0x00, 0x09, 0x1F, 0x0E, 0x02, 0x02, 0x00, 0x09, 0x20, 0x0D, 0x01, 0x02, 0x00, 0x09, 0x21, 0x0C,
+	0x02, 0x02, 0x00, 0x09, 0x22, 0x0B, 0x01, 0x02, 0x00, 0x09, 0x23, 0x0A, 0x01, 0x02, 0x00, 0x09,
+	0x24, 0x09, 0x1B, 0x00,
+	// @8908 0x4F (66 pixels wide)
+	0x11, 0x00, 0x01, 0x01, 0x1A, 0x0F, 0x01, 0x01, 0x16, 0x17, 0x01, 0x01, 0x14, 0x1B, 0x01, 0x01,
+	0x12, 0x1F, 0x01, 0x01, 0x10, 0x23, 0x01, 0x01, 0x0E, 0x26, 0x01, 0x01, 0x0D, 0x28, 0x01, 0x02,
+	0x0C, 0x12, 0x06, 0x13, 0x01, 0x02, 0x0B, 0x0F, 0x0E, 0x10, 0x01, 0x02, 0x0A, 0x0D, 0x13, 0x0F,
+	0x01, 0x02, 0x09, 0x0C, 0x17, 0x0D, 0x01, 0x02, 0x08, 0x0C, 0x1A, 0x0C, 0x01, 0x02, 0x07, 0x0C,
+	0x1C, 0x0C, 0x01, 0x02, 0x07, 0x0B, 0x1E, 0x0C, 0x01, 0x02, 0x06, 0x0B, 0x20, 0x0B, 0x01, 0x02,
+	0x05, 0x0B, 0x21, 0x0C, 0x01, 0x02, 0x05, 0x0A, 0x23, 0x0B, 0x01, 0x02, 0x04, 0x0B, 0x24, 0x0B,
+	0x01, 0x02, 0x04, 0x0A, 0x25, 0x0B, 0x01, 0x02, 0x03, 0x0B, 0x26, 0x0B, 0x01, 0x02, 0x03, 0x0A,
+	0x28, 0x0A, 0x01, 0x02, 0x02, 0x0B, 0x28, 0x0B, 0x01, 0x02, 0x02, 0x0A, 0x29, 0x0B, 0x02, 0x02,
+	0x02, 0x0A, 0x2A, 0x0A, 0x01, 0x02, 0x01, 0x0A, 0x2B, 0x0B, 0x03, 0x02, 0x01, 0x0A, 0x2C, 0x0A,
+	0x01, 0x02, 0x00, 0x0A, 0x2D, 0x0A, 0x01, 0x02, 0x00, 0x0A, 0x2E, 0x09, 0x0B, 0x02, 0x00, 0x0A,
+	0x2E, 0x0A, 0x01, 0x02, 0x00, 0x0A, 0x2E, 0x09, 0x03, 0x02, 0x00, 0x0A, 0x2D, 0x0A, 0x02, 0x02,
+	0x01, 0x0A, 0x2C, 0x0A, 0x01, 0x02, 0x01, 0x0A, 0x2B, 0x0A, 0x01, 0x02, 0x01, 0x0B, 0x2A, 0x0A,
+	0x01, 0x02, 0x02, 0x0A, 0x2A, 0x0A, 0x01, 0x02, 0x02, 0x0A, 0x29, 0x0B, 0x01, 0x02, 0x02, 0x0B,
+	0x28, 0x0A, 0x01, 0x02, 0x03, 0x0A, 0x27, 0x0B, 0x01, 0x02, 0x03, 0x0B, 0x26, 0x0A, 0x01, 0x02,
+	0x03, 0x0B, 0x25, 0x0B, 0x01, 0x02, 0x04, 0x0B, 0x24, 0x0A, 0x01, 0x02, 0x04, 0x0C, 0x22, 0x0B,
+	0x01, 0x02, 0x05, 0x0B, 0x21, 0x0B, 0x01, 0x02, 0x05, 0x0C, 0x20, 0x0B, 0x01, 0x02, 0x06, 0x0C,
+	0x1E, 0x0B, 0x01, 0x02, 0x07, 0x0C, 0x1C, 0x0B, 0x01, 0x02, 0x08, 0x0C, 0x19, 0x0D, 0x01, 0x02,
+	0x08, 0x0E, 0x16, 0x0D, 0x01, 0x02, 0x09, 0x0E, 0x13, 0x0E, 0x01, 0x02, 0x0A, 0x10, 0x0E, 0x0F,
+	0x01, 0x02, 0x0B, 0x14, 0x04, 0x13, 0x01, 0x01, 0x0C, 0x29, 0x01, 0x01, 0x0E, 0x25, 0x01, 0x01,
+	0x0F, 0x23, 0x01, 0x01, 0x11, 0x1F, 0x01, 0x01, 0x13, 0x1B, 0x01, 0x01, 0x15, 0x17, 0x01, 0x01,
+	0x19, 0x0F, 0x1A, 0x00,
+	// @9232 0x50 (45 pixels wide)
+	0x11, 0x00, 0x01, 0x01, 0x0C, 0x0B, 0x01, 0x01, 0x02, 0x1B, 0x01, 0x01, 0x00, 0x20, 0x01, 0x01,
+	0x00, 0x22, 0x01, 0x01, 0x00, 0x24, 0x01, 0x01, 0x00, 0x25, 0x01, 0x01, 0x00, 0x26, 0x01, 0x01,
+	0x00, 0x27, 0x01, 0x02, 0x00, 0x09, 0x10, 0x0F, 0x01, 0x02, 0x00, 0x09, 0x13, 0x0D, 0x01, 0x02,
+	0x00, 0x09, 0x15, 0x0C, 0x01, 0x02, 0x00, 0x09, 0x16, 0x0B, 0x01, 0x02, 0x00, 0x09, 0x17, 0x0B,
+	0x01, 0x02, 0x00, 0x09, 0x18, 0x0A, 0x01, 0x02, 0x00, 0x09, 0x18, 0x0B, 0x02, 0x02, 0x00, 0x09,
+	0x19, 0x0A, 0x01, 0x02, 0x00, 0x09, 0x1A, 0x09, 0x07, 0x02, 0x00, 0x09, 0x1A, 0x0A, 0x02, 0x02,
+	0x00, 0x09, 0x1A, 0x09, 0x02, 0x02, 0x00, 0x09, 0x19, 0x0A, 0x02, 0x02, 0x00, 0x09, 0x18, 0x0A,
+	0x01, 0x02, 0x00, 0x09, 0x17, 0x0B, 0x01, 0x02, 0x00, 0x09, 0x16, 0x0B, 0x01, 0x02, 0x00, 0x09,
+	0x15, 0x0C, 0x01, 0x02, 0x00, 0x09, 0x14, 0x0C, 0x01, 0x02, 0x00, 0x09, 0x12, 0x0D, 0x01, 0x02,
+	0x00, 0x0A, 0x0D, 0x10, 0x01, 0x01, 0x00, 0x26, 0x01, 0x01, 0x00, 0x25, 0x01, 0x01, 0x00, 0x24,
+	0x01, 0x01, 0x00, 0x22, 0x01, 0x01, 0x00, 0x20, 0x01, 0x01, 0x00, 0x1E, 0x01, 0x01, 0x00, 0x1B,
+	0x01, 0x02, 0x00, 0x09, 0x04, 0x07, 0x1C, 0x01, 0x00, 0x09, 0x1B, 0x00,
+	// @9420 0x51 (66 pixels wide)
+	0x11, 0x00, 0x01, 0x01, 0x1A, 0x0F, 0x01, 0x01, 0x16, 0x17, 0x01, 0x01, 0x13, 0x1C, 0x01, 0x01,
+	0x11, 0x20, 0x01, 0x01, 0x10, 0x23, 0x01, 0x01, 0x0E, 0x26, 0x01, 0x01, 0x0D, 0x28, 0x01, 0x02,
+	0x0C, 0x12, 0x06, 0x13, 0x01, 0x02, 0x0B, 0x0F, 0x0E, 0x10, 0x01, 0x02, 0x0A, 0x0D, 0x14, 0x0E,
+	0x01, 0x02, 0x09, 0x0D, 0x16, 0x0D, 0x01, 0x02, 0x08, 0x0C, 0x1A, 0x0C, 0x01, 0x02, 0x07, 0x0C,
+	0x1C, 0x0C, 0x01, 0x02, 0x07, 0x0B, 0x1E, 0x0C, 0x01, 0x02, 0x06, 0x0B, 0x20, 0x0B, 0x02, 0x02,
+	0x05, 0x0B, 0x22, 0x0B, 0x01, 0x02, 0x04, 0x0B, 0x24, 0x0B, 0x01, 0x02, 0x04, 0x0A, 0x26, 0x0A,
+	0x01, 0x02, 0x03, 0x0B, 0x26, 0x0B, 0x01, 0x02, 0x03, 0x0A, 0x28, 0x0A, 0x01, 0x02, 0x02, 0x0B,
+	0x28, 0x0B, 0x01, 0x02, 0x02, 0x0A, 0x29, 0x0B, 0x01, 0x02, 0x02, 0x0A, 0x2A, 0x0A, 0x01, 0x02,
+	0x01, 0x0B, 0x2A, 0x0A, 0x01, 0x02, 0x01, 0x0A, 0x2B, 0x0B, 0x03, 0x02, 0x01, 0x0A, 0x2C, 0x0A,
+	0x01, 0x02, 0x00, 0x0A, 0x2D, 0x0A, 0x01, 0x02, 0x00, 0x0A, 0x2E, 0x09, 0x0B, 0x02, 0x00, 0x0A,
+	0x2E, 0x0A, 0x01, 0x02, 0x00, 0x0A, 0x2E, 0x09, 0x03, 0x02, 0x00, 0x0A, 0x2D, 0x0A, 0x02, 0x02,
+	0x01, 0x0A, 0x2C, 0x0A, 0x02, 0x02, 0x01, 0x0A, 0x2B, 0x0A, 0x01, 0x02, 0x02, 0x0A, 0x2A, 0x0A,
+	0x01, 0x02, 0x02, 0x0A, 0x29, 0x0A, 0x01, 0x02, 0x02, 0x0B, 0x28, 0x0A, 0x01, 0x02, 0x03, 0x0A,
+	0x27, 0x0B, 0x01, 0x02, 0x03, 0x0B, 0x26, 0x0A, 0x01, 0x02, 0x03, 0x0B, 0x25, 0x0B, 0x01, 0x02,
+	0x04, 0x0B, 0x24, 0x0A, 0x01, 0x02, 0x04, 0x0C, 0x22, 0x0B, 0x01, 0x02, 0x05, 0x0B, 0x21, 0x0B,
+	0x01, 0x02, 0x05, 0x0C, 0x20, 0x0B, 0x01, 0x02, 0x06, 0x0C, 0x1E, 0x0B, 0x01, 0x02, 0x07, 0x0C,
+	0x1C, 0x0B, 0x01, 0x02, 0x08, 0x0C, 0x19, 0x0C, 0x01, 0x02, 0x08, 0x0E, 0x16, 0x0C, 0x01, 0x02,
+	0x09, 0x0E, 0x13, 0x0D, 0x01, 0x02, 0x0A, 0x10, 0x0E, 0x0E, 0x01, 0x02, 0x0B, 0x14, 0x04, 0x12,
+	0x01, 0x01, 0x0D, 0x27, 0x01, 0x01, 0x0E, 0x24, 0x01, 0x01, 0x0F, 0x21, 0x01, 0x01, 0x11, 0x1D,
+	0x01, 0x01, 0x13, 0x1C, 0x01, 0x01, 0x16, 0x1D, 0x01, 0x01, 0x1A, 0x1D, 0x01, 0x01, 0x21, 0x1B,
+	0x01, 0x01, 0x25, 0x1C, 0x01, 0x01, 0x28, 0x1A, 0x01, 0x01, 0x2B, 0x17, 0x01, 0x01, 0x2E, 0x13,
+	0x01, 0x01, 0x31, 0x10, 0x01, 0x01, 0x35, 0x0C, 0x01, 0x01, 0x38, 0x08, 0x01, 0x01, 0x3C, 0x04,
+	0x11, 0x00,
+	// @9774 0x52 (47 pixels wide)
+	0x11, 0x00, 0x01, 0x01, 0x0C, 0x0B, 0x01, 0x01, 0x03, 0x1A, 0x01, 0x01, 0x00, 0x20, 0x01, 0x01,
+	0x00, 0x23, 0x01, 0x01, 0x00, 0x25, 0x01, 0x01, 0x00, 0x26, 0x01, 0x01, 0x00, 0x27, 0x01, 0x01,
+	0x00, 0x28, 0x01, 0x02, 0x00, 0x09, 0x11, 0x0F, 0x01, 0x02, 0x00, 0x09, 0x14, 0x0D, 0x01, 0x02,
+	0x00, 0x09, 0x15, 0x0C, 0x01, 0x02, 0x00, 0x09, 0x17, 0x0B, 0x01, 0x02, 0x00, 0x09, 0x18, 0x0A,
+	0x01, 0x02, 0x00, 0x09, 0x18, 0x0B, 0x02, 0x02, 0x00, 0x09, 0x19, 0x0A, 0x01, 0x02, 0x00, 0x09,
+	0x1A, 0x09, 0x06, 0x02, 0x00, 0x09, 0x1A, 0x0A, 0x03, 0x02, 0x00, 0x09, 0x1A, 0x09, 0x01, 0x02,
+	0x00, 0x09, 0x19, 0x0A, 0x01, 0x02, 0x00, 0x09, 0x19, 0x09, 0x01, 0x02, 0x00, 0x09, 0x18, 0x0A,
+	0x01, 0x02, 0x00, 0x09, 0x17, 0x0A, 0x01, 0x02, 0x00, 0x09, 0x16, 0x0B, 0x01, 0x02, 0x00, 0x09,
+	0x15, 0x0B, 0x01, 0x02, 0x00, 0x09, 0x14, 0x0B, 0x01, 0x02, 0x00, 0x09, 0x11, 0x0D, 0x01, 0x02,
+	0x00, 0x09, 0x0D, 0x10, 0x01, 0x01, 0x00, 0x25, 0x01, 0x01, 0x00, 0x23, 0x01, 0x01, 0x00, 0x21,
+	0x01, 0x01, 0x00, 0x1F, 0x01, 0x01, 0x00, 0x21, 0x01, 0x01, 0x00, 0x22, 0x01, 0x01, 0x00, 0x24,
+	0x01, 0x02, 0x00, 0x09, 0x0E, 0x0E, 0x01, 0x02, 0x00, 0x09, 0x11, 0x0B, 0x01, 0x02, 0x00, 0x09,
+	0x12, 0x0B, 0x01, 0x02, 0x00, 0x09, 0x13, 0x0B, 0x01, 0x02, 0x00, 0x09, 0x14, 0x0A, 0x02, 0x02,
+	0x00, 0x09, 0x15, 0x0A, 0x02, 0x02, 0x00, 0x09, 0x16, 0x0A, 0x02, 0x02, 0x00, 0x09, 0x17, 0x09,
+	0x02, 0x02, 0x00, 0x09, 0x17, 0x0A, 0x02, 0x02, 0x00, 0x09, 0x18, 0x09, 0x02, 0x02, 0x00, 0x09,
+	0x18, 0x0A, 0x02, 0x02, 0x00, 0x09, 0x19, 0x09, 0x02, 0x02, 0x00, 0x09, 0x19, 0x0A, 0x02, 0x02,
+	0x00, 0x09, 0x1A, 0x09, 0x02, 0x02, 0x00, 0x09, 0x1A, 0x0A, 0x01, 0x02, 0x00, 0x09, 0x1B, 0x09,
+	0x03, 0x02, 0x00, 0x09, 0x1B, 0x0A, 0x01, 0x02, 0x00, 0x09, 0x1C, 0x09, 0x01, 0x02, 0x00, 0x09,
+	0x1C, 0x0A, 0x1B, 0x00,
+	// @10066 0x53 (43 pixels wide)
+	0x11, 0x00, 0x01, 0x01, 0x11, 0x0F, 0x01, 0x01, 0x0E, 0x16, 0x01, 0x01, 0x0C, 0x1B, 0x01, 0x01,
+	0x0A, 0x1E, 0x01, 0x01, 0x09, 0x1F, 0x01, 0x01, 0x07, 0x20, 0x01, 0x01, 0x06, 0x21, 0x01, 0x01,
+	0x05, 0x22, 0x01, 0x02, 0x04, 0x0E, 0x0E, 0x06, 0x01, 0x02, 0x04, 0x0C, 0x13, 0x03, 0x01, 0x02,
+	0x03, 0x0B, 0x17, 0x01, 0x01, 0x01, 0x03, 0x0A, 0x02, 0x01, 0x02, 0x0A, 0x01, 0x01, 0x02, 0x09,
+	0x02, 0x01, 0x01, 0x0A, 0x03, 0x01, 0x01, 0x09, 0x03, 0x01, 0x01, 0x0A, 0x02, 0x01, 0x02, 0x0A,
+	0x01, 0x01, 0x02, 0x0B, 0x01, 0x01, 0x03, 0x0B, 0x01, 0x01, 0x03, 0x0C, 0x01, 0x01, 0x04, 0x0D,
+	0x01, 0x01, 0x04, 0x0F, 0x01, 0x01, 0x05, 0x10, 0x01, 0x01, 0x06, 0x11, 0x01, 0x01, 0x07, 0x13,
+	0x01, 0x01, 0x08, 0x14, 0x01, 0x01, 0x09, 0x15, 0x01, 0x01, 0x0B, 0x15, 0x01, 0x01, 0x0D, 0x15,
+	0x01, 0x01, 0x0F, 0x14, 0x01, 0x01, 0x11, 0x13, 0x01, 0x01, 0x13, 0x12, 0x01, 0x01, 0x16, 0x10,
+	0x01, 0x01, 0x18, 0x0F, 0x01, 0x01, 0x1A, 0x0E, 0x01, 0x01, 0x1C, 0x0D, 0x01, 0x01, 0x1D, 0x0C,
+	0x01, 0x01, 0x1E, 0x0C, 0x01, 0x01, 0x1F, 0x0B, 0x01, 0x01, 0x20, 0x0A, 0x01, 0x01, 0x20, 0x0B,
+	0x03, 0x01, 0x21, 0x0A, 0x04, 0x01, 0x22, 0x09, 0x02, 0x01, 0x21, 0x0A, 0x01, 0x01, 0x21, 0x09,
+	0x02, 0x01, 0x20, 0x0A, 0x01, 0x01, 0x1F, 0x0A, 0x01, 0x02, 0x02, 0x01, 0x1B, 0x0B, 0x01, 0x02,
+	0x01, 0x04, 0x18, 0x0B, 0x01, 0x02, 0x01, 0x07, 0x13, 0x0D, 0x01, 0x02, 0x01, 0x0A, 0x0E, 0x0E,
+	0x01, 0x01, 0x00, 0x26, 0x01, 0x01, 0x00, 0x25, 0x01, 0x01, 0x00, 0x24, 0x01, 0x01, 0x00, 0x23,
+	0x01, 0x01, 0x01, 0x20, 0x01, 0x01, 0x04, 0x1B, 0x01, 0x01, 0x06, 0x17, 0x01, 0x01, 0x0B, 0x0E,
+	0x1A, 0x00,
+	// @10324 0x54 (53 pixels wide)
+	0x12, 0x00, 0x08, 0x01, 0x00, 0x35, 0x40, 0x01, 0x16, 0x09, 0x1B, 0x00,
+	// @10336 0x55 (53 pixels wide)
+	0x12, 0x00, 0x2D, 0x02, 0x00, 0x09, 0x23, 0x09, 0x03, 0x02, 0x00, 0x0A, 0x22, 0x09, 0x02, 0x02,
+	0x00, 0x0A, 0x21, 0x0A, 0x01, 0x02, 0x01, 0x09, 0x21, 0x0A, 0x01, 0x02, 0x01, 0x09, 0x21, 0x09,
+	0x01, 0x02, 0x01, 0x0A, 0x20, 0x09, 0x02, 0x02, 0x01, 0x0A, 0x1F, 0x0A, 0x01, 0x02, 0x02, 0x0A,
+	0x1E, 0x09, 0x02, 0x02, 0x02, 0x0A, 0x1D, 0x0A, 0x01, 0x02, 0x03, 0x0A, 0x1B, 0x0A, 0x01, 0x02,
+	0x03, 0x0B, 0x1A, 0x0A, 0x01, 0x02, 0x04, 0x0B, 0x18, 0x0A, 0x01, 0x02, 0x04, 0x0B, 0x17, 0x0B,
+	0x01, 0x02, 0x05, 0x0C, 0x14, 0x0B, 0x01, 0x02, 0x05, 0x0D, 0x11, 0x0C, 0x01, 0x02, 0x06, 0x0E,
+	0x0D, 0x0E, 0x01, 0x02, 0x07, 0x11, 0x04, 0x12, 0x01, 0x01, 0x08, 0x25, 0x01, 0x01, 0x09, 0x23,
+	0x01, 0x01, 0x0A, 0x20, 0x01, 0x01, 0x0B, 0x1E, 0x01, 0x01, 0x0D, 0x1A, 0x01, 0x01, 0x0F, 0x16,
+	0x01, 0x01, 0x13, 0x0E, 0x1A, 0x00,
+	// @10470 0x56 (59 pixels wide)
+	0x12, 0x00, 0x01, 0x02, 0x00, 0x0A, 0x27, 0x0A, 0x01, 0x02, 0x00, 0x0A, 0x27, 0x09, 0x01, 0x02,
+	0x00, 0x0A, 0x26, 0x0A, 0x01, 0x02, 0x00, 0x0B, 0x25, 0x0A, 0x02, 0x02, 0x01, 0x0A, 0x24, 0x0A,
+	0x01, 0x02, 0x01, 0x0B, 0x23, 0x0A, 0x02, 0x02, 0x02, 0x0A, 0x22, 0x0A, 0x01, 0x02, 0x02, 0x0B,
+	0x21, 0x0A, 0x03, 0x02, 0x03, 0x0A, 0x20, 0x0A, 0x02, 0x02, 0x04, 0x0A, 0x1E, 0x0A, 0x01, 0x02,
+	0x04, 0x0A, 0x1E, 0x09, 0x02, 0x02, 0x05, 0x0A, 0x1C, 0x0A, 0x01, 0x02, 0x05, 0x0A, 0x1C, 0x09,
+	0x02, 0x02, 0x06, 0x0A, 0x1A, 0x0A, 0x01, 0x02, 0x06, 0x0A, 0x1A, 0x09, 0x02, 0x02, 0x07, 0x0A,
+	0x18, 0x0A, 0x01, 0x02, 0x07, 0x0A, 0x18, 0x09, 0x02, 0x02, 0x08, 0x0A, 0x16, 0x0A, 0x01, 0x02,
+	0x08, 0x0A, 0x16, 0x09, 0x01, 0x02, 0x09, 0x0A, 0x14, 0x0A, 0x02, 0x02, 0x09, 0x0A, 0x14, 0x09,
+	0x01, 0x02, 0x0A, 0x09, 0x13, 0x0A, 0x02, 0x02, 0x0A, 0x0A, 0x12, 0x09, 0x01, 0x02, 0x0B, 0x09,
+	0x11, 0x0A, 0x02, 0x02, 0x0B, 0x0A, 0x10, 0x09, 0x01, 0x02, 0x0C, 0x09, 0x0F, 0x0A, 0x01, 0x02,
+	0x0C, 0x0A, 0x0E, 0x09, 0x01, 0x02, 0x0C, 0x0A, 0x0D, 0x0A, 0x01, 0x02, 0x0D, 0x09, 0x0D, 0x09,
+	0x01, 0x02, 0x0D, 0x0A, 0x0C, 0x09, 0x01, 0x02, 0x0D, 0x0A, 0x0B, 0x0A, 0x02, 0x02, 0x0E, 0x09,
+	0x0B, 0x09, 0x01, 0x02, 0x0E, 0x0A, 0x09, 0x0A, 0x02, 0x02, 0x0F, 0x09, 0x09, 0x09, 0x01, 0x02,
+	0x0F, 0x0A, 0x08, 0x09, 0x02, 0x02, 0x10, 0x09, 0x07, 0x09, 0x01, 0x02, 0x10, 0x0A, 0x06, 0x09,
+	0x02, 0x02, 0x11, 0x09, 0x05, 0x09, 0x01, 0x02, 0x11, 0x09, 0x05, 0x08, 0x02, 0x02, 0x12, 0x09,
+	0x03, 0x09, 0x01, 0x02, 0x12, 0x09, 0x03, 0x08, 0x01, 0x02, 0x13, 0x08, 0x03, 0x08, 0x01, 0x02,
+	0x13, 0x09, 0x01, 0x09, 0x01, 0x02, 0x13, 0x09, 0x01, 0x08, 0x01, 0x02, 0x14, 0x08, 0x01, 0x08,
+	0x01, 0x01, 0x14, 0x11, 0x01, 0x01, 0x14, 0x10, 0x02, 0x01, 0x15, 0x0F, 0x01, 0x01, 0x15, 0x0E,
+	0x01, 0x01, 0x16, 0x0D, 0x03, 0x01, 0x16, 0x0C, 0x01, 0x01, 0x17, 0x0A, 0x1B, 0x00,
+	// @10772 0x57 (87 pixels wide)
+	0x12, 0x00, 0x02, 0x03, 0x00, 0x0A, 0x1D, 0x0A, 0x1D, 0x09, 0x01, 0x03, 0x00, 0x0A, 0x1C, 0x0B,
+	0x1C, 0x0A, 0x01, 0x03, 0x01, 0x09, 0x1C, 0x0C, 0x1B, 0x0A, 0x02, 0x03, 0x01, 0x0A, 0x1B, 0x0C,
+	0x1B, 0x09, 0x01, 0x03, 0x01, 0x0A, 0x1A, 0x0D, 0x1A, 0x0A, 0x01, 0x03, 0x02, 0x09, 0x1A, 0x0E,
+	0x19, 0x0A, 0x01, 0x03, 0x02, 0x09, 0x1A, 0x0E, 0x19, 0x09, 0x01, 0x03, 0x02, 0x0A, 0x19, 0x0E,
+	0x19, 0x09, 0x01, 0x03, 0x02, 0x0A, 0x18, 0x0F, 0x18, 0x0A, 0x02, 0x04, 0x03, 0x09, 0x18, 0x07,
+	0x01, 0x08, 0x17, 0x09, 0x01, 0x04, 0x03, 0x0A, 0x16, 0x08, 0x01, 0x08, 0x17, 0x09, 0x01, 0x04,
+	0x03, 0x0A, 0x16, 0x08, 0x01, 0x08, 0x16, 0x0A, 0x01, 0x04, 0x04, 0x09, 0x16, 0x08, 0x01, 0x09,
+	0x15, 0x09, 0x01, 0x04, 0x04, 0x09, 0x16, 0x07, 0x03, 0x08, 0x15, 0x09, 0x01, 0x04, 0x04, 0x0A,
+	0x14, 0x08, 0x03, 0x08, 0x15, 0x09, 0x01, 0x04, 0x04, 0x0A, 0x14, 0x08, 0x03, 0x08, 0x14, 0x09,
+	0x02, 0x04, 0x05, 0x09, 0x14, 0x08, 0x03, 0x09, 0x13, 0x09, 0x01, 0x04, 0x05, 0x0A, 0x12, 0x08,
+	0x05, 0x08, 0x12, 0x0A, 0x01, 0x04, 0x05, 0x0A, 0x12, 0x08, 0x05, 0x08, 0x12, 0x09, 0x01, 0x04,
+	0x06, 0x09, 0x12, 0x08, 0x05, 0x08, 0x12, 0x09, 0x01, 0x04, 0x06, 0x09, 0x12, 0x08, 0x05, 0x09,
+	0x11, 0x09, 0x01, 0x04, 0x06, 0x09, 0x11, 0x08, 0x06, 0x09, 0x10, 0x09, 0x01, 0x04, 0x06, 0x0A,
+	0x10, 0x08, 0x07, 0x08, 0x10, 0x09, 0x01, 0x04, 0x07, 0x09, 0x10, 0x08, 0x07, 0x08, 0x10, 0x09,
+	0x01, 0x04, 0x07, 0x09, 0x10, 0x08, 0x07, 0x09, 0x0F, 0x09, 0x01, 0x04, 0x07, 0x09, 0x0F, 0x08,
+	0x08, 0x09, 0x0E, 0x09, 0x01, 0x04, 0x07, 0x0A, 0x0E, 0x08, 0x08, 0x09, 0x0E, 0x09, 0x01, 0x04,
+	0x08, 0x09, 0x0E, 0x08, 0x09, 0x08, 0x0E, 0x09, 0x01, 0x04, 0x08, 0x09, 0x0D, 0x08, 0x0A, 0x09,
+	0x0D, 0x08, 0x01, 0x04, 0x08, 0x09, 0x0D, 0x08, 0x0A, 0x09, 0x0C, 0x09, 0x01, 0x04, 0x08, 0x0A,
+	0x0C, 0x08, 0x0A, 0x09, 0x0C, 0x09, 0x01, 0x04, 0x09, 0x09, 0x0C, 0x08, 0x0B, 0x08, 0x0C, 0x09,
+	0x01, 0x04, 0x09, 0x09, 0x0B, 0x08, 0x0C, 0x09, 0x0B, 0x08, 0x01, 0x04, 0x09, 0x09, 0x0B, 0x08,
+	0x0C, 0x09, 0x0A, 0x09, 0x01, 0x04, 0x09, 0x0A, 0x0A, 0x08, 0x0C, 0x09, 0x0A, 0x09, 0x01, 0x04,
+	0x0A, 0x09, 0x0A, 0x08, 0x0D, 0x08, 0x0A, 0x08, 0x01, 0x04, 0x0A, 0x09, 0x09, 0x08, 0x0E, 0x09,
+	0x09, 0x08, 0x02, 0x04, 0x0A, 0x09, 0x09, 0x08, 0x0E, 0x09, 0x08, 0x09, 0x01, 0x04, 0x0B, 0x09,
+	0x08, 0x07, 0x10, 0x08, 0x08, 0x08, 0x01, 0x04, 0x0B, 0x09, 0x07, 0x08, 0x10, 0x08, 0x08, 0x08,
+	0x01, 0x04, 0x0B, 0x09, 0x07, 0x08, 0x10, 0x09, 0x06, 0x09, 0x01, 0x04, 0x0B, 0x09, 0x07, 0x08,
+	0x10, 0x09, 0x06, 0x08, 0x01, 0x04, 0x0C, 0x09, 0x06, 0x07, 0x12, 0x08, 0x06, 0x08, 0x01, 0x04,
+	0x0C, 0x09, 0x05, 0x08, 0x12, 0x08, 0x06, 0x08, 0x01, 0x04, 0x0C, 0x09, 0x05, 0x08, 0x12, 0x09,
+	0x04, 0x09, 0x01, 0x04, 0x0C, 0x09, 0x05, 0x08, 0x12, 0x09, 0x04, 0x08, 0x01, 0x04, 0x0D, 0x08,
+	0x05, 0x07, 0x14, 0x08, 0x04, 0x08, 0x01, 0x04, 0x0D, 0x09, 0x03, 0x08, 0x14, 0x08, 0x04, 0x08,
+	0x01, 0x04, 0x0D, 0x09, 0x03, 0x08, 0x14, 0x08, 0x03, 0x08, 0x01, 0x04, 0x0D, 0x09, 0x03, 0x07,
+	0x15, 0x09, 0x02, 0x08, 0x01, 0x04, 0x0E, 0x08, 0x03, 0x07, 0x16, 0x08, 0x02, 0x08, 0x01, 0x04,
+	0x0E, 0x08, 0x02, 0x08, 0x16, 0x08, 0x02, 0x08, 0x01, 0x04, 0x0E, 0x09, 0x01, 0x08, 0x16, 0x08,
+	0x02, 0x07, 0x01, 0x04, 0x0E, 0x09, 0x01, 0x07, 0x17, 0x08, 0x01, 0x08, 0x01, 0x04, 0x0F, 0x08,
+	0x01, 0x07, 0x17, 0x08, 0x01, 0x08, 0x01, 0x03, 0x0F, 0x08, 0x01, 0x07, 0x18, 0x0F, 0x01, 0x02,
+	0x0F, 0x10, 0x18, 0x0F, 0x01, 0x02, 0x0F, 0x0F, 0x19, 0x0F, 0x01, 0x02, 0x10, 0x0E, 0x19, 0x0F,
+	0x01, 0x02, 0x10, 0x0E, 0x1A, 0x0D, 0x01, 0x02, 0x10, 0x0D, 0x1B, 0x0D, 0x01, 0x02, 0x11, 0x0C,
+	0x1B, 0x0D, 0x01, 0x02, 0x11, 0x0C, 0x1B, 0x0C, 0x01, 0x02, 0x11, 0x0C, 0x1C, 0x0B, 0x01, 0x02,
+	0x11, 0x0B, 0x1D, 0x0B, 0x01, 0x02, 0x12, 0x0A, 0x1D, 0x0B, 0x01, 0x02, 0x12, 0x0A, 0x1D, 0x0A,
+	0x1B, 0x00,
+	// @11382 0x58 (55 pixels wide)
+	0x12, 0x00, 0x01, 0x02, 0x01, 0x0B, 0x20, 0x0B, 0x01, 0x02, 0x01, 0x0B, 0x1F, 0x0B, 0x01, 0x02,
+	0x02, 0x0B, 0x1E, 0x0A, 0x01, 0x02, 0x03, 0x0A, 0x1D, 0x0B, 0x01, 0x02, 0x03, 0x0B, 0x1B, 0x0B,
+	0x01, 0x02, 0x04, 0x0A, 0x1B, 0x0A, 0x01, 0x02, 0x04, 0x0B, 0x19, 0x0B, 0x01, 0x02, 0x05, 0x0B,
+	0x18, 0x0A, 0x01, 0x02, 0x06, 0x0A, 0x17, 0x0B, 0x01, 0x02, 0x06, 0x0B, 0x16, 0x0A, 0x01, 0x02,
+	0x07, 0x0A, 0x15, 0x0A, 0x01, 0x02, 0x07, 0x0B, 0x13, 0x0B, 0x01, 0x02, 0x08, 0x0A, 0x13, 0x0A,
+	0x01, 0x02, 0x09, 0x0A, 0x11, 0x0A, 0x01, 0x02, 0x09, 0x0B, 0x10, 0x0A, 0x01, 0x02, 0x0A, 0x0A,
+	0x0F, 0x0A, 0x01, 0x02, 0x0A, 0x0B, 0x0E, 0x0A, 0x01, 0x02, 0x0B, 0x0A, 0x0D, 0x0A, 0x02, 0x02,
+	0x0C, 0x0A, 0x0B, 0x0A, 0x01, 0x02, 0x0D, 0x0A, 0x09, 0x0A, 0x01, 0x02, 0x0D, 0x0B, 0x08, 0x09,
+	0x01, 0x02, 0x0E, 0x0A, 0x07, 0x0A, 0x01, 0x02, 0x0F, 0x0A, 0x06, 0x09, 0x01, 0x02, 0x0F, 0x0A,
+	0x05, 0x09, 0x01, 0x02, 0x10, 0x0A, 0x04, 0x09, 0x01, 0x02, 0x10, 0x0A, 0x03, 0x09, 0x01, 0x02,
+	0x11, 0x0A, 0x02, 0x09, 0x01, 0x02, 0x12, 0x09, 0x01, 0x09, 0x01, 0x01, 0x12, 0x12, 0x01, 0x01,
+	0x13, 0x11, 0x01, 0x01, 0x13, 0x10, 0x01, 0x01, 0x14, 0x0E, 0x01, 0x01, 0x15, 0x0D, 0x01, 0x01,
+	0x15, 0x0C, 0x01, 0x01, 0x16, 0x0B, 0x02, 0x01, 0x15, 0x0D, 0x01, 0x01, 0x14, 0x0F, 0x02, 0x01,
+	0x13, 0x11, 0x01, 0x01, 0x12, 0x13, 0x01, 0x02, 0x12, 0x08, 0x01, 0x0B, 0x01, 0x02, 0x11, 0x09,
+	0x02, 0x0A, 0x02, 0x02, 0x10, 0x09, 0x04, 0x0A, 0x01, 0x02, 0x0F, 0x09, 0x06, 0x0A, 0x01, 0x02,
+	0x0E, 0x0A, 0x06, 0x0B, 0x01, 0x02, 0x0E, 0x09, 0x08, 0x0A, 0x01, 0x02, 0x0D, 0x0A, 0x08, 0x0B,
+	0x01, 0x02, 0x0D, 0x09, 0x0A, 0x0A, 0x01, 0x02, 0x0C, 0x0A, 0x0B, 0x0A, 0x01, 0x02, 0x0B, 0x0A,
+	0x0C, 0x0B, 0x01, 0x02, 0x0B, 0x0A, 0x0D, 0x0A, 0x01, 0x02, 0x0A, 0x0A, 0x0E, 0x0B, 0x01, 0x02,
+	0x0A, 0x09, 0x10, 0x0A, 0x01, 0x02, 0x09, 0x0A, 0x11, 0x0A, 0x01, 0x02, 0x08, 0x0A, 0x12, 0x0B,
+	0x01, 0x02, 0x08, 0x0A, 0x13, 0x0A, 0x01, 0x02, 0x07, 0x0A, 0x14, 0x0B, 0x01, 0x02, 0x07, 0x0A,
+	0x15, 0x0A, 0x01, 0x02, 0x06, 0x0A, 0x16, 0x0B, 0x01, 0x02, 0x05, 0x0B, 0x17, 0x0B, 0x01, 0x02,
+	0x05, 0x0A, 0x19, 0x0A, 0x01, 0x02, 0x04, 0x0A, 0x1A, 0x0B, 0x01, 0x02, 0x04, 0x0A, 0x1B, 0x0A,
+	0x01, 0x02, 0x03, 0x0A, 0x1C, 0x0B, 0x01, 0x02, 0x02, 0x0B, 0x1D, 0x0B, 0x01, 0x02, 0x02, 0x0A,
+	0x1F, 0x0A, 0x01, 0x02, 0x01, 0x0B, 0x1F, 0x0B, 0x01, 0x02, 0x01, 0x0A, 0x21, 0x0A, 0x01, 0x02,
+	0x00, 0x0B, 0x21, 0x0B, 0x1B, 0x00,
+	// @11772 0x59 (55 pixels wide)
+	0x12, 0x00, 0x01, 0x02, 0x00, 0x0A, 0x23, 0x0A, 0x01, 0x02, 0x00, 0x0B, 0x21, 0x0B, 0x01, 0x02,
+	0x01, 0x0A, 0x21, 0x0A, 0x01, 0x02, 0x01, 0x0B, 0x1F, 0x0B, 0x01, 0x02, 0x02, 0x0A, 0x1F, 0x0A,
+	0x01, 0x02, 0x02, 0x0B, 0x1D, 0x0A, 0x01, 0x02, 0x03, 0x0A, 0x1D, 0x0A, 0x01, 0x02, 0x03, 0x0B,
+	0x1B, 0x0A, 0x01, 0x02, 0x04, 0x0A, 0x1B, 0x0A, 0x02, 0x02, 0x05, 0x0A, 0x19, 0x0A, 0x01, 0x02,
+	0x06, 0x0A, 0x17, 0x0A, 0x01, 0x02, 0x06, 0x0A, 0x17, 0x09, 0x01, 0x02, 0x07, 0x0A, 0x15, 0x0A,
+	0x01, 0x02, 0x07, 0x0A, 0x15, 0x09, 0x01, 0x02, 0x08, 0x0A, 0x13, 0x0A, 0x01, 0x02, 0x08, 0x0A,
+	0x13, 0x09, 0x01, 0x02, 0x09, 0x0A, 0x11, 0x09, 0x01, 0x02, 0x0A, 0x09, 0x11, 0x09, 0x01, 0x02,
+	0x0A, 0x0A, 0x0F, 0x09, 0x01, 0x02, 0x0B, 0x09, 0x0E, 0x0A, 0x01, 0x02, 0x0B, 0x0A, 0x0D, 0x09,
+	0x01, 0x02, 0x0C, 0x09, 0x0C, 0x0A, 0x01, 0x02, 0x0C, 0x0A, 0x0B, 0x09, 0x01, 0x02, 0x0D, 0x09,
+	0x0A, 0x09, 0x01, 0x02, 0x0D, 0x0A, 0x09, 0x09, 0x01, 0x02, 0x0E, 0x09, 0x08, 0x09, 0x01, 0x02,
+	0x0F, 0x09, 0x07, 0x09, 0x01, 0x02, 0x0F, 0x09, 0x06, 0x09, 0x01, 0x02, 0x10, 0x09, 0x05, 0x08,
+	0x01, 0x02, 0x10, 0x09, 0x04, 0x09, 0x01, 0x02, 0x11, 0x09, 0x03, 0x08, 0x01, 0x02, 0x11, 0x09,
+	0x02, 0x09, 0x02, 0x02, 0x12, 0x09, 0x01, 0x08, 0x01, 0x01, 0x13, 0x10, 0x01, 0x01, 0x13, 0x0F,
+	0x01, 0x01, 0x14, 0x0E, 0x02, 0x01, 0x15, 0x0C, 0x20, 0x01, 0x16, 0x0A, 0x1B, 0x00,
+	// @11994 0x5A (53 pixels wide)
+	0x12, 0x00, 0x07, 0x01, 0x04, 0x30, 0x01, 0x01, 0x04, 0x2F, 0x01, 0x01, 0x28, 0x0A, 0x01, 0x01,
+	0x27, 0x0B, 0x01, 0x01, 0x26, 0x0B, 0x01, 0x01, 0x26, 0x0A, 0x01, 0x01, 0x25, 0x0B, 0x01, 0x01,
+	0x24, 0x0B, 0x01, 0x01, 0x24, 0x0A, 0x01, 0x01, 0x23, 0x0B, 0x01, 0x01, 0x22, 0x0B, 0x01, 0x01,
+	0x22, 0x0A, 0x01, 0x01, 0x21, 0x0A, 0x01, 0x01, 0x20, 0x0B, 0x01, 0x01, 0x20, 0x0A, 0x01, 0x01,
+	0x1F, 0x0A, 0x01, 0x01, 0x1E, 0x0B, 0x01, 0x01, 0x1E, 0x0A, 0x01, 0x01, 0x1D, 0x0A, 0x01, 0x01,
+	0x1C, 0x0B, 0x01, 0x01, 0x1C, 0x0A, 0x01, 0x01, 0x1B, 0x0A, 0x01, 0x01, 0x1A, 0x0B, 0x01, 0x01,
+	0x1A, 0x0A, 0x01, 0x01, 0x19, 0x0A, 0x01, 0x01, 0x18, 0x0B, 0x01, 0x01, 0x17, 0x0B, 0x01, 0x01,
+	0x17, 0x0A, 0x01, 0x01, 0x16, 0x0B, 0x01, 0x01, 0x15, 0x0B, 0x01, 0x01, 0x15, 0x0A, 0x01, 0x01,
+	0x14, 0x0B, 0x01, 0x01, 0x13, 0x0B, 0x01, 0x01, 0x13, 0x0A, 0x01, 0x01, 0x12, 0x0A, 0x01, 0x01,
+	0x11, 0x0B, 0x01, 0x01, 0x11, 0x0A, 0x01, 0x01, 0x10, 0x0A, 0x01, 0x01, 0x0F, 0x0B, 0x01, 0x01,
+	0x0F, 0x0A, 0x01, 0x01, 0x0E, 0x0A, 0x01, 0x01, 0x0D, 0x0B, 0x01, 0x01, 0x0D, 0x0A, 0x01, 0x01,
+	0x0C, 0x0A, 0x01, 0x01, 0x0B, 0x0B, 0x01, 0x01, 0x0A, 0x0B, 0x01, 0x01, 0x0A, 0x0A, 0x01, 0x01,
+	0x09, 0x0B, 0x01, 0x01, 0x08, 0x0B, 0x01, 0x01, 0x08, 0x0A, 0x01, 0x01, 0x07, 0x0B, 0x01, 0x01,
+	0x06, 0x0B, 0x01, 0x01, 0x06, 0x0A, 0x01, 0x01, 0x05, 0x0A, 0x01, 0x01, 0x04, 0x0B, 0x01, 0x01,
+	0x04, 0x0A, 0x01, 0x01, 0x03, 0x0A, 0x01, 0x01, 0x02, 0x0B, 0x01, 0x01, 0x02, 0x33, 0x01, 0x01,
+	0x01, 0x34, 0x06, 0x01, 0x00, 0x35, 0x1B, 0x00,
+	// @12242 0x5B (19 pixels wide)
+	0x11, 0x00, 0x06, 0x01, 0x00, 0x13, 0x49, 0x01, 0x00, 0x07, 0x06, 0x01, 0x00, 0x13, 0x0F, 0x00,
+	// @12258 0x5C (35 pixels wide)
+	0x11, 0x00, 0x02, 0x01, 0x00, 0x07, 0x01, 0x01, 0x00, 0x08, 0x02, 0x01, 0x01, 0x07, 0x01, 0x01,
+	0x01, 0x08, 0x02, 0x01, 0x02, 0x07, 0x02, 0x01, 0x03, 0x07, 0x01, 0x01, 0x03, 0x08, 0x02, 0x01,
+	0x04, 0x07, 0x01, 0x01, 0x04, 0x08, 0x02, 0x01, 0x05, 0x07, 0x02, 0x01, 0x06, 0x07, 0x01, 0x01,
+	0x06, 0x08, 0x02, 0x01, 0x07, 0x07, 0x01, 0x01, 0x07, 0x08, 0x02, 0x01, 0x08, 0x07, 0x02, 0x01,
+	0x09, 0x07, 0x01, 0x01, 0x09, 0x08, 0x02, 0x01, 0x0A, 0x07, 0x01, 0x01, 0x0A, 0x08, 0x02, 0x01,
+	0x0B, 0x07, 0x02, 0x01, 0x0C, 0x07, 0x01, 0x01, 0x0C, 0x08, 0x02, 0x01, 0x0D, 0x07, 0x01, 0x01,
+	0x0D, 0x08, 0x02, 0x01, 0x0E, 0x07, 0x02, 0x01, 0x0F, 0x07, 0x01, 0x01, 0x0F, 0x08, 0x02, 0x01,
+	0x10, 0x07, 0x01, 0x01, 0x10, 0x08, 0x02, 0x01, 0x11, 0x07, 0x02, 0x01, 0x12, 0x07, 0x01, 0x01,
+	0x12, 0x08, 0x02, 0x01, 0x13, 0x07, 0x01, 0x01, 0x13, 0x08, 0x02, 0x01, 0x14, 0x07, 0x02, 0x01,
+	0x15, 0x07, 0x01, 0x01, 0x15, 0x08, 0x02, 0x01, 0x16, 0x07, 0x01, 0x01, 0x16, 0x08, 0x02, 0x01,
+	0x17, 0x07, 0x02, 0x01, 0x18, 0x07, 0x01, 0x01, 0x18, 0x08, 0x02, 0x01, 0x19, 0x07, 0x01, 0x01,
+	0x19, 0x08, 0x02, 0x01, 0x1A, 0x07, 0x02, 0x01, 0x1B, 0x07, 0x01, 0x01, 0x1B, 0x08, 0x02, 0x01,
+	0x1C, 0x07, 0x17, 0x00,
+	// @12454 0x5D (20 pixels wide)
+	0x11, 0x00, 0x06, 0x01, 0x00, 0x14, 0x49, 0x01, 0x0C, 0x08, 0x06, 0x01, 0x00, 0x14, 0x0F, 0x00,
+	// @12470 0x5E (50 pixels wide)
+	0x14, 0x00, 0x01, 0x01, 0x16, 0x06, 0x02, 0x01, 0x15, 0x08, 0x02, 0x01, 0x14, 0x0A, 0x02, 0x01,
+	0x13, 0x0C, 0x01, 0x01, 0x12, 0x0D, 0x01, 0x01, 0x12, 0x0E, 0x01, 0x02, 0x12, 0x06, 0x02, 0x06,
+	0x01, 0x02, 0x11, 0x07, 0x02, 0x07, 0x01, 0x02, 0x11, 0x06, 0x03, 0x07, 0x02, 0x02, 0x10, 0x07,
+	0x04, 0x07, 0x02, 0x02, 0x0F, 0x07, 0x06, 0x07, 0x01, 0x02, 0x0E, 0x07, 0x08, 0x06, 0x01, 0x02,
+	0x0E, 0x07, 0x08, 0x07, 0x01, 0x02, 0x0E, 0x06, 0x09, 0x07, 0x01, 0x02, 0x0D, 0x07, 0x0A, 0x07,
+	0x01, 0x02, 0x0D, 0x06, 0x0B, 0x07, 0x02, 0x02, 0x0C, 0x07, 0x0C, 0x07, 0x02, 0x02, 0x0B, 0x07,
+	0x0E, 0x07, 0x01, 0x02, 0x0A, 0x07, 0x0F, 0x08, 0x01, 0x02, 0x0A, 0x07, 0x10, 0x07, 0x01, 0x02,
+	0x09, 0x07, 0x11, 0x07, 0x02, 0x02, 0x09, 0x07, 0x12, 0x07, 0x02, 0x02, 0x08, 0x07, 0x14, 0x07,
+	0x01, 0x02, 0x07, 0x07, 0x15, 0x08, 0x01, 0x02, 0x07, 0x07, 0x16, 0x07, 0x01, 0x02, 0x06, 0x07,
+	0x17, 0x08, 0x01, 0x02, 0x06, 0x07, 0x18, 0x07, 0x01, 0x02, 0x05, 0x08, 0x18, 0x07, 0x02, 0x02,
+	0x05, 0x07, 0x1A, 0x07, 0x01, 0x02, 0x04, 0x07, 0x1B, 0x08, 0x01, 0x02, 0x04, 0x07, 0x1C, 0x07,
+	0x01, 0x02, 0x03, 0x07, 0x1D, 0x08, 0x01, 0x02, 0x03, 0x07, 0x1E, 0x07, 0x01, 0x02, 0x02, 0x08,
+	0x1E, 0x08, 0x01, 0x02, 0x02, 0x07, 0x20, 0x07, 0x01, 0x02, 0x01, 0x08, 0x20, 0x07, 0x01, 0x02,
+	0x01, 0x07, 0x21, 0x08, 0x01, 0x02, 0x01, 0x07, 0x22, 0x07, 0x01, 0x02, 0x00, 0x07, 0x23, 0x08,
+	0x01, 0x02, 0x00, 0x07, 0x24, 0x07, 0x2F, 0x00,
+	// @12702 0x5F (54 pixels wide)
+	0x62, 0x00, 0x05, 0x01, 0x00, 0x36, 0x0E, 0x00,
+	// @12710 0x60 (19 pixels wide)
+	0x10, 0x00, 0x01, 0x01, 0x00, 0x0A, 0x01, 0x01, 0x01, 0x0A, 0x01, 0x01, 0x02, 0x09, 0x01, 0x01,
+	0x02, 0x0A, 0x01, 0x01, 0x03, 0x09, 0x01, 0x01, 0x04, 0x09, 0x01, 0x01, 0x05, 0x09, 0x01, 0x01,
+	0x06, 0x08, 0x01, 0x01, 0x07, 0x08, 0x02, 0x01, 0x08, 0x08, 0x01, 0x01, 0x09, 0x08, 0x01, 0x01,
+	0x0A, 0x07, 0x01, 0x01, 0x0B, 0x07, 0x01, 0x01, 0x0C, 0x07, 0x56, 0x00,
+	// @12770 0x61 (41 pixels wide)
+	0x25, 0x00, 0x01, 0x01, 0x0E, 0x0C, 0x01, 0x01, 0x0A, 0x14, 0x01, 0x01, 0x07, 0x19, 0x01, 0x01,
+	0x05, 0x1C, 0x01, 0x01, 0x03, 0x1F, 0x01, 0x01, 0x04, 0x1F, 0x01, 0x01, 0x04, 0x20, 0x01, 0x02,
+	0x04, 0x0A, 0x0A, 0x0D, 0x01, 0x02, 0x05, 0x05, 0x10, 0x0C, 0x01, 0x02, 0x05, 0x03, 0x13, 0x0B,
+	0x01, 0x02, 0x05, 0x01, 0x16, 0x0A, 0x01, 0x01, 0x1D, 0x0A, 0x02, 0x01, 0x1E, 0x09, 0x01, 0x01,
+	0x1E, 0x0A, 0x05, 0x01, 0x1F, 0x09, 0x01, 0x01, 0x16, 0x12, 0x01, 0x01, 0x10, 0x18, 0x01, 0x01,
+	0x0D, 0x1B, 0x01, 0x01, 0x0B, 0x1D, 0x01, 0x01, 0x09, 0x1F, 0x01, 0x01, 0x07, 0x21, 0x01, 0x01,
+	0x06, 0x22, 0x01, 0x02, 0x04, 0x10, 0x0B, 0x09, 0x01, 0x02, 0x04, 0x0C, 0x0F, 0x09, 0x01, 0x02,
+	0x03, 0x0B, 0x11, 0x09, 0x01, 0x02, 0x02, 0x0B, 0x12, 0x09, 0x01, 0x02, 0x02, 0x0A, 0x13, 0x09,
+	0x01, 0x02, 0x01, 0x0A, 0x14, 0x09, 0x01, 0x02, 0x01, 0x09, 0x15, 0x09, 0x01, 0x02, 0x00, 0x0A,
+	0x15, 0x09, 0x04, 0x02, 0x00, 0x09, 0x16, 0x09, 0x02, 0x02, 0x00, 0x09, 0x15, 0x0A, 0x01, 0x02,
+	0x00, 0x0A, 0x13, 0x0B, 0x02, 0x02, 0x00, 0x0A, 0x12, 0x0C, 0x01, 0x02, 0x01, 0x0A, 0x0F, 0x0E,
+	0x01, 0x02, 0x01, 0x0B, 0x0D, 0x0F, 0x01, 0x03, 0x01, 0x0D, 0x09, 0x08, 0x01, 0x08, 0x01, 0x02,
+	0x02, 0x1D, 0x01, 0x08, 0x01, 0x02, 0x03, 0x1B, 0x02, 0x09, 0x01, 0x02, 0x04, 0x19, 0x03, 0x09,
+	0x01, 0x02, 0x05, 0x17, 0x04, 0x09, 0x01, 0x02, 0x06, 0x14, 0x06, 0x09, 0x01, 0x02, 0x08, 0x10,
+	0x09, 0x08, 0x01, 0x01, 0x0A, 0x0C, 0x1A, 0x00,
+	// @13002 0x62 (50 pixels wide)
+	0x0E, 0x00, 0x17, 0x01, 0x01, 0x09, 0x01, 0x02, 0x01, 0x09, 0x0D, 0x0A, 0x01, 0x02, 0x01, 0x09,
+	0x09, 0x11, 0x01, 0x02, 0x01, 0x09, 0x07, 0x15, 0x01, 0x02, 0x01, 0x09, 0x06, 0x18, 0x01, 0x02,
+	0x01, 0x09, 0x04, 0x1B, 0x01, 0x02, 0x01, 0x09, 0x03, 0x1D, 0x01, 0x02, 0x01, 0x09, 0x02, 0x1F,
+	0x01, 0x03, 0x01, 0x09, 0x02, 0x0C, 0x02, 0x12, 0x01, 0x03, 0x01, 0x09, 0x01, 0x09, 0x0B, 0x0E,
+	0x01, 0x02, 0x01, 0x11, 0x0F, 0x0C, 0x01, 0x02, 0x01, 0x0F, 0x12, 0x0C, 0x01, 0x02, 0x01, 0x0E,
+	0x14, 0x0C, 0x01, 0x02, 0x01, 0x0D, 0x16, 0x0B, 0x02, 0x02, 0x01, 0x0C, 0x18, 0x0B, 0x01, 0x02,
+	0x01, 0x0B, 0x1A, 0x0A, 0x01, 0x02, 0x01, 0x0B, 0x1A, 0x0B, 0x03, 0x02, 0x01, 0x0A, 0x1C, 0x0A,
+	0x0D, 0x02, 0x01, 0x09, 0x1E, 0x0A, 0x01, 0x02, 0x01, 0x09, 0x1E, 0x09, 0x01, 0x02, 0x01, 0x09,
+	0x1D, 0x0A, 0x02, 0x02, 0x01, 0x0A, 0x1C, 0x0A, 0x01, 0x02, 0x01, 0x0A, 0x1B, 0x0A, 0x01, 0x02,
+	0x01, 0x0B, 0x1A, 0x0A, 0x01, 0x02, 0x01, 0x0B, 0x19, 0x0B, 0x01, 0x02, 0x01, 0x0C, 0x18, 0x0A,
+	0x01, 0x02, 0x01, 0x0D, 0x16, 0x0B, 0x01, 0x02, 0x01, 0x0D, 0x15, 0x0B, 0x01, 0x02, 0x01, 0x0F,
+	0x12, 0x0C, 0x01, 0x02, 0x01, 0x10, 0x10, 0x0C, 0x01, 0x03, 0x01, 0x08, 0x01, 0x09, 0x0C, 0x0D,
+	0x01, 0x03, 0x01, 0x08, 0x02, 0x0B, 0x05, 0x10, 0x01, 0x02, 0x01, 0x08, 0x02, 0x1F, 0x01, 0x02,
+	0x01, 0x08, 0x03, 0x1D, 0x01, 0x02, 0x01, 0x08, 0x04, 0x1B, 0x01, 0x02, 0x01, 0x08, 0x05, 0x19,
+	0x01, 0x02, 0x00, 0x09, 0x07, 0x15, 0x01, 0x02, 0x00, 0x09, 0x09, 0x11, 0x01, 0x01, 0x15, 0x0B,
+	0x1A, 0x00,
+	// @13244 0x63 (41 pixels wide)
+	0x25, 0x00, 0x01, 0x01, 0x16, 0x0C, 0x01, 0x01, 0x12, 0x14, 0x01, 0x01, 0x0F, 0x19, 0x01, 0x01,
+	0x0D, 0x1C, 0x01, 0x01, 0x0C, 0x1C, 0x01, 0x01, 0x0A, 0x1E, 0x01, 0x01, 0x09, 0x1F, 0x01, 0x01,
+	0x08, 0x20, 0x01, 0x02, 0x07, 0x0E, 0x0E, 0x04, 0x01, 0x02, 0x06, 0x0D, 0x13, 0x01, 0x01, 0x01,
+	0x05, 0x0C, 0x01, 0x01, 0x05, 0x0B, 0x01, 0x01, 0x04, 0x0B, 0x01, 0x01, 0x03, 0x0B, 0x01, 0x01,
+	0x03, 0x0A, 0x01, 0x01, 0x02, 0x0B, 0x02, 0x01, 0x02, 0x0A, 0x02, 0x01, 0x01, 0x0A, 0x02, 0x01,
+	0x01, 0x09, 0x0B, 0x01, 0x00, 0x0A, 0x01, 0x01, 0x01, 0x09, 0x03, 0x01, 0x01, 0x0A, 0x01, 0x01,
+	0x02, 0x0A, 0x02, 0x01, 0x02, 0x0B, 0x01, 0x01, 0x03, 0x0B, 0x01, 0x01, 0x03, 0x0C, 0x01, 0x01,
+	0x04, 0x0C, 0x01, 0x01, 0x04, 0x0D, 0x01, 0x02, 0x05, 0x0E, 0x13, 0x01, 0x01, 0x02, 0x06, 0x0F,
+	0x0E, 0x04, 0x01, 0x01, 0x07, 0x21, 0x01, 0x01, 0x08, 0x20, 0x01, 0x01, 0x09, 0x1F, 0x01, 0x01,
+	0x0A, 0x1E, 0x01, 0x01, 0x0C, 0x1D, 0x01, 0x01, 0x0E, 0x1A, 0x01, 0x01, 0x10, 0x15, 0x01, 0x01,
+	0x14, 0x0C, 0x1A, 0x00,
+	// @13408 0x64 (49 pixels wide)
+	0x0E, 0x00, 0x17, 0x01, 0x27, 0x0A, 0x01, 0x02, 0x12, 0x0B, 0x0A, 0x0A, 0x01, 0x02, 0x0F, 0x11,
+	0x07, 0x0A, 0x01, 0x02, 0x0D, 0x15, 0x05, 0x0A, 0x01, 0x02, 0x0B, 0x18, 0x04, 0x0A, 0x01, 0x02,
+	0x0A, 0x1A, 0x03, 0x0A, 0x01, 0x02, 0x09, 0x1C, 0x02, 0x0A, 0x01, 0x02, 0x08, 0x1E, 0x01, 0x0A,
+	0x01, 0x02, 0x07, 0x11, 0x03, 0x16, 0x01, 0x02, 0x06, 0x0D, 0x0C, 0x12, 0x01, 0x02, 0x05, 0x0D,
+	0x0E, 0x11, 0x01, 0x02, 0x05, 0x0B, 0x12, 0x0F, 0x01, 0x02, 0x04, 0x0B, 0x14, 0x0E, 0x01, 0x02,
+	0x03, 0x0B, 0x16, 0x0D, 0x01, 0x02, 0x03, 0x0A, 0x18, 0x0C, 0x01, 0x02, 0x02, 0x0B, 0x18, 0x0C,
+	0x02, 0x02, 0x02, 0x0A, 0x1A, 0x0B, 0x03, 0x02, 0x01, 0x0A, 0x1C, 0x0A, 0x02, 0x02, 0x01, 0x09,
+	0x1D, 0x0A, 0x0C, 0x02, 0x00, 0x0A, 0x1D, 0x0A, 0x01, 0x02, 0x01, 0x09, 0x1D, 0x0A, 0x01, 0x02,
+	0x01, 0x0A, 0x1C, 0x0A, 0x02, 0x02, 0x01, 0x0A, 0x1B, 0x0B, 0x01, 0x02, 0x02, 0x0A, 0x1A, 0x0B,
+	0x01, 0x02, 0x02, 0x0B, 0x18, 0x0C, 0x01, 0x02, 0x02, 0x0B, 0x17, 0x0D, 0x01, 0x02, 0x03, 0x0B,
+	0x16, 0x0D, 0x01, 0x02, 0x03, 0x0C, 0x14, 0x0E, 0x01, 0x02, 0x04, 0x0C, 0x12, 0x0F, 0x01, 0x02,
+	0x05, 0x0C, 0x0F, 0x11, 0x01, 0x03, 0x05, 0x0E, 0x0B, 0x09, 0x01, 0x09, 0x01, 0x03, 0x06, 0x11,
+	0x03, 0x0C, 0x02, 0x09, 0x01, 0x02, 0x07, 0x1F, 0x02, 0x09, 0x01, 0x02, 0x08, 0x1D, 0x03, 0x09,
+	0x01, 0x02, 0x09, 0x1B, 0x04, 0x09, 0x01, 0x02, 0x0A, 0x19, 0x05, 0x09, 0x01, 0x02, 0x0C, 0x15,
+	0x07, 0x09, 0x01, 0x02, 0x0E, 0x11, 0x09, 0x09, 0x01, 0x01, 0x11, 0x0B, 0x1A, 0x00,
+	// @13646 0x65 (46 pixels wide)
+	0x25, 0x00, 0x01, 0x01, 0x13, 0x0B, 0x01, 0x01, 0x10, 0x11, 0x01, 0x01, 0x0D, 0x16, 0x01, 0x01,
+	0x0C, 0x19, 0x01, 0x01, 0x0A, 0x1C, 0x01, 0x01, 0x09, 0x1E, 0x01, 0x01, 0x08, 0x20, 0x01, 0x02,
+	0x07, 0x0C, 0x09, 0x0D, 0x01, 0x02, 0x06, 0x0B, 0x0D, 0x0B, 0x01, 0x02, 0x06, 0x0A, 0x10, 0x0A,
+	0x01, 0x02, 0x05, 0x09, 0x13, 0x0A, 0x01, 0x02, 0x04, 0x0A, 0x14, 0x09, 0x01, 0x02, 0x04, 0x09,
+	0x15, 0x0A, 0x02, 0x02, 0x03, 0x09, 0x17, 0x09, 0x02, 0x02, 0x02, 0x09, 0x19, 0x09, 0x01, 0x02,
+	0x02, 0x08, 0x1A, 0x09, 0x01, 0x02, 0x01, 0x09, 0x1A, 0x09, 0x01, 0x02, 0x01, 0x09, 0x1B, 0x08,
+	0x02, 0x02, 0x01, 0x08, 0x1C, 0x09, 0x06, 0x01, 0x00, 0x2E, 0x01, 0x01, 0x00, 0x2D, 0x04, 0x01,
+	0x00, 0x09, 0x01, 0x01, 0x00, 0x0A, 0x02, 0x01, 0x01, 0x09, 0x02, 0x01, 0x01, 0x0A, 0x01, 0x01,
+	0x02, 0x09, 0x01, 0x01, 0x02, 0x0A, 0x01, 0x01, 0x03, 0x0A, 0x01, 0x01, 0x03, 0x0B, 0x01, 0x01,
+	0x04, 0x0B, 0x01, 0x01, 0x04, 0x0C, 0x01, 0x02, 0x05, 0x0C, 0x17, 0x01, 0x01, 0x02, 0x06, 0x0E,
+	0x11, 0x05, 0x01, 0x02, 0x07, 0x11, 0x07, 0x0B, 0x01, 0x01, 0x08, 0x22, 0x01, 0x01, 0x09, 0x21,
+	0x01, 0x01, 0x0A, 0x21, 0x01, 0x01, 0x0B, 0x20, 0x01, 0x01, 0x0D, 0x1C, 0x01, 0x01, 0x10, 0x16,
+	0x01, 0x01, 0x13, 0x0E, 0x1A, 0x00,
+	// @13844 0x66 (33 pixels wide)
+	0x0D, 0x00, 0x01, 0x01, 0x14, 0x0B, 0x01, 0x01, 0x11, 0x10, 0x01, 0x01, 0x10, 0x11, 0x01, 0x01,
+	0x0E, 0x13, 0x01, 0x01, 0x0D, 0x14, 0x01, 0x01, 0x0C, 0x15, 0x01, 0x01, 0x0B, 0x15, 0x01, 0x02,
+	0x0A, 0x0F, 0x02, 0x05, 0x01, 0x01, 0x0A, 0x0B, 0x01, 0x01, 0x09, 0x0B, 0x01, 0x01, 0x09, 0x0A,
+	0x02, 0x01, 0x08, 0x0A, 0x02, 0x01, 0x08, 0x09, 0x01, 0x01, 0x07, 0x0A, 0x09, 0x01, 0x07, 0x09,
+	0x07, 0x01, 0x00, 0x1D, 0x2D, 0x01, 0x07, 0x09, 0x1B, 0x00,
+	// @13918 0x67 (49 pixels wide)
+	0x25, 0x00, 0x01, 0x01, 0x13, 0x09, 0x01, 0x02, 0x0F, 0x10, 0x09, 0x09, 0x01, 0x02, 0x0D, 0x14,
+	0x07, 0x08, 0x01, 0x02, 0x0C, 0x17, 0x05, 0x08, 0x01, 0x02, 0x0A, 0x1A, 0x04, 0x08, 0x01, 0x02,
+	0x09, 0x1C, 0x03, 0x08, 0x01, 0x02, 0x08, 0x1E, 0x02, 0x08, 0x01, 0x03, 0x07, 0x10, 0x04, 0x0C,
+	0x01, 0x08, 0x01, 0x03, 0x06, 0x0D, 0x0C, 0x08, 0x01, 0x08, 0x01, 0x02, 0x05, 0x0C, 0x10, 0x0F,
+	0x01, 0x02, 0x05, 0x0B, 0x12, 0x0E, 0x01, 0x02, 0x04, 0x0B, 0x14, 0x0D, 0x01, 0x02, 0x03, 0x0B,
+	0x16, 0x0C, 0x01, 0x02, 0x03, 0x0A, 0x17, 0x0C, 0x01, 0x02, 0x02, 0x0B, 0x18, 0x0B, 0x01, 0x02,
+	0x02, 0x0A, 0x19, 0x0B, 0x01, 0x02, 0x02, 0x0A, 0x1A, 0x0A, 0x02, 0x02, 0x01, 0x0A, 0x1B, 0x0A,
+	0x03, 0x02, 0x01, 0x09, 0x1D, 0x09, 0x0B, 0x02, 0x00, 0x0A, 0x1D, 0x09, 0x01, 0x02, 0x01, 0x09,
+	0x1D, 0x09, 0x03, 0x02, 0x01, 0x0A, 0x1B, 0x0A, 0x02, 0x02, 0x02, 0x0A, 0x19, 0x0B, 0x01, 0x02,
+	0x02, 0x0B, 0x17, 0x0C, 0x01, 0x02, 0x03, 0x0B, 0x16, 0x0C, 0x01, 0x02, 0x03, 0x0C, 0x14, 0x0D,
+	0x01, 0x02, 0x04, 0x0C, 0x12, 0x0E, 0x01, 0x02, 0x05, 0x0C, 0x0F, 0x10, 0x01, 0x03, 0x05, 0x0E,
+	0x0B, 0x08, 0x01, 0x09, 0x01, 0x03, 0x06, 0x11, 0x04, 0x0B, 0x01, 0x09, 0x01, 0x02, 0x07, 0x1E,
+	0x02, 0x09, 0x01, 0x02, 0x08, 0x1C, 0x03, 0x09, 0x01, 0x02, 0x09, 0x1A, 0x04, 0x09, 0x01, 0x02,
+	0x0B, 0x17, 0x05, 0x09, 0x01, 0x02, 0x0C, 0x14, 0x07, 0x09, 0x01, 0x02, 0x0F, 0x0F, 0x09, 0x09,
+	0x01, 0x02, 0x12, 0x08, 0x0D, 0x09, 0x01, 0x01, 0x27, 0x09, 0x05, 0x01, 0x26, 0x09, 0x02, 0x01,
+	0x25, 0x09, 0x01, 0x01, 0x24, 0x0A, 0x02, 0x01, 0x23, 0x0A, 0x01, 0x02, 0x07, 0x01, 0x1A, 0x0A,
+	0x01, 0x02, 0x06, 0x04, 0x16, 0x0C, 0x01, 0x02, 0x06, 0x06, 0x12, 0x0D, 0x01, 0x02, 0x06, 0x0A,
+	0x0B, 0x0F, 0x01, 0x01, 0x05, 0x24, 0x01, 0x01, 0x05, 0x23, 0x01, 0x01, 0x05, 0x22, 0x01, 0x01,
+	0x05, 0x21, 0x01, 0x01, 0x07, 0x1D, 0x01, 0x01, 0x09, 0x18, 0x01, 0x01, 0x0D, 0x11, 0x05, 0x00,
+	// @14222 0x68 (44 pixels wide)
+	0x0E, 0x00, 0x17, 0x01, 0x00, 0x09, 0x01, 0x02, 0x00, 0x09, 0x0C, 0x09, 0x01, 0x02, 0x00, 0x09,
+	0x09, 0x0F, 0x01, 0x02, 0x00, 0x09, 0x07, 0x13, 0x01, 0x02, 0x00, 0x09, 0x06, 0x15, 0x01, 0x02,
+	0x00, 0x09, 0x04, 0x19, 0x01, 0x02, 0x00, 0x09, 0x03, 0x1B, 0x01, 0x02, 0x00, 0x09, 0x02, 0x1C,
+	0x01, 0x02, 0x00, 0x09, 0x02, 0x1D, 0x01, 0x03, 0x00, 0x09, 0x01, 0x08, 0x09, 0x0E, 0x01, 0x02,
+	0x00, 0x10, 0x0D, 0x0C, 0x01, 0x02, 0x00, 0x0F, 0x0F, 0x0C, 0x01, 0x02, 0x00, 0x0E, 0x11, 0x0B,
+	0x01, 0x02, 0x00, 0x0D, 0x13, 0x0B, 0x01, 0x02, 0x00, 0x0C, 0x15, 0x0A, 0x02, 0x02, 0x00, 0x0B,
+	0x16, 0x0A, 0x01, 0x02, 0x00, 0x0A, 0x18, 0x09, 0x02, 0x02, 0x00, 0x0A, 0x18, 0x0A, 0x22, 0x02,
+	0x00, 0x09, 0x19, 0x0A, 0x1B, 0x00,
+	// @14340 0x69 (11 pixels wide)
+	0x12, 0x00, 0x01, 0x01, 0x03, 0x05, 0x01, 0x01, 0x01, 0x09, 0x01, 0x01, 0x00, 0x0A, 0x06, 0x01,
+	0x00, 0x0B, 0x01, 0x01, 0x01, 0x09, 0x01, 0x01, 0x02, 0x07, 0x09, 0x00, 0x34, 0x01, 0x01, 0x09,
+	0x1B, 0x00,
+	// @14374 0x6A (24 pixels wide)
+	0x12, 0x00, 0x01, 0x01, 0x10, 0x06, 0x01, 0x01, 0x0E, 0x09, 0x01, 0x01, 0x0E, 0x0A, 0x05, 0x01,
+	0x0D, 0x0B, 0x01, 0x01, 0x0E, 0x0A, 0x01, 0x01, 0x0E, 0x09, 0x01, 0x01, 0x0F, 0x07, 0x09, 0x00,
+	0x35, 0x01, 0x0E, 0x09, 0x05, 0x01, 0x0D, 0x0A, 0x01, 0x01, 0x0D, 0x09, 0x02, 0x01, 0x0C, 0x0A,
+	0x02, 0x01, 0x0B, 0x0A, 0x01, 0x01, 0x0A, 0x0B, 0x01, 0x01, 0x09, 0x0B, 0x01, 0x01, 0x07, 0x0D,
+	0x01, 0x01, 0x05, 0x0E, 0x01, 0x01, 0x00, 0x12, 0x01, 0x01, 0x00, 0x11, 0x01, 0x01, 0x00, 0x10,
+	0x01, 0x01, 0x01, 0x0E, 0x01, 0x01, 0x01, 0x0C, 0x01, 0x01, 0x01, 0x0A, 0x01, 0x01, 0x01, 0x08,
+	0x01, 0x01, 0x01, 0x02, 0x04, 0x00,
+	// @14476 0x6B (43 pixels wide)
+	0x0E, 0x00, 0x18, 0x01, 0x00, 0x09, 0x01, 0x02, 0x00, 0x09, 0x14, 0x0B, 0x01, 0x02, 0x00, 0x09,
+	0x13, 0x0B, 0x01, 0x02, 0x00, 0x09, 0x12, 0x0B, 0x01, 0x02, 0x00, 0x09, 0x11, 0x0B, 0x01, 0x02,
+	0x00, 0x09, 0x11, 0x0A, 0x01, 0x02, 0x00, 0x09, 0x10, 0x0B, 0x01, 0x02, 0x00, 0x09, 0x0F, 0x0B,
+	0x01, 0x02, 0x00, 0x09, 0x0E, 0x0B, 0x01, 0x02, 0x00, 0x09, 0x0D, 0x0B, 0x01, 0x02, 0x00, 0x09,
+	0x0C, 0x0B, 0x01, 0x02, 0x00, 0x09, 0x0B, 0x0B, 0x01, 0x02, 0x00, 0x09, 0x0B, 0x0A, 0x01, 0x02,
+	0x00, 0x09, 0x0A, 0x0A, 0x01, 0x02, 0x00, 0x09, 0x09, 0x0A, 0x01, 0x02, 0x00, 0x09, 0x08, 0x0A,
+	0x01, 0x02, 0x00, 0x09, 0x07, 0x0A, 0x01, 0x02, 0x00, 0x09, 0x06, 0x0A, 0x01, 0x02, 0x00, 0x09,
+	0x05, 0x0A, 0x01, 0x02, 0x00, 0x09, 0x05, 0x09, 0x01, 0x02, 0x00, 0x09, 0x04, 0x09, 0x01, 0x02,
+	0x00, 0x09, 0x03, 0x09, 0x01, 0x02, 0x00, 0x09, 0x02, 0x09, 0x01, 0x02, 0x00, 0x09, 0x01, 0x0B,
+	0x01, 0x02, 0x00, 0x09, 0x01, 0x0C, 0x02, 0x01, 0x00, 0x17, 0x01, 0x01, 0x00, 0x18, 0x01, 0x01,
+	0x00, 0x19, 0x01, 0x02, 0x00, 0x0D, 0x02, 0x0B, 0x01, 0x02, 0x00, 0x0C, 0x04, 0x0A, 0x01, 0x02,
+	0x00, 0x0B, 0x05, 0x0B, 0x01, 0x02, 0x00, 0x0A, 0x07, 0x0B, 0x01, 0x02, 0x00, 0x09, 0x09, 0x0B,
+	0x01, 0x02, 0x00, 0x09, 0x0A, 0x0A, 0x01, 0x02, 0x00, 0x09, 0x0A, 0x0B, 0x01, 0x02, 0x00, 0x09,
+	0x0B, 0x0B, 0x02, 0x02, 0x00, 0x09, 0x0C, 0x0B, 0x01, 0x02, 0x00, 0x09, 0x0D, 0x0B, 0x01, 0x02,
+	0x00, 0x09, 0x0E, 0x0B, 0x02, 0x02, 0x00, 0x09, 0x0F, 0x0B, 0x01, 0x02, 0x00, 0x09, 0x10, 0x0B,
+	0x01, 0x02, 0x00, 0x09, 0x11, 0x0B, 0x01, 0x02, 0x00, 0x09, 0x11, 0x0C, 0x01, 0x02, 0x00, 0x09,
+	0x12, 0x0B, 0x01, 0x02, 0x00, 0x09, 0x13, 0x0B, 0x01, 0x02, 0x00, 0x09, 0x14, 0x0B, 0x01, 0x02,
+	0x00, 0x09, 0x14, 0x0C, 0x01, 0x02, 0x00, 0x09, 0x15, 0x0B, 0x01, 0x02, 0x00, 0x09, 0x16, 0x0B,
+	0x01, 0x02, 0x00, 0x09, 0x16, 0x0C, 0x1B, 0x00,
+	// @14772 0x6C (9 pixels wide)
+	0x0E, 0x00, 0x4C, 0x01, 0x00, 0x09, 0x1B, 0x00,
+	// @14780 0x6D (75 pixels wide)
+	0x25, 0x00, 0x01, 0x02, 0x15, 0x09, 0x17, 0x09, 0x01, 0x03, 0x00, 0x09, 0x09, 0x0E, 0x12, 0x0F,
+	0x01, 0x03, 0x00, 0x09, 0x07, 0x12, 0x0E, 0x12, 0x01, 0x03, 0x00, 0x09, 0x06, 0x14, 0x0C, 0x15,
+	0x01, 0x03, 0x01, 0x08, 0x04, 0x18, 0x08, 0x18, 0x01, 0x03, 0x01, 0x08, 0x03, 0x1A, 0x06, 0x1A,
+	0x01, 0x03, 0x01, 0x08, 0x02, 0x1B, 0x05, 0x1C, 0x01, 0x03, 0x01, 0x08, 0x02, 0x1C, 0x03, 0x1D,
+	0x01, 0x05, 0x01, 0x08, 0x01, 0x08, 0x09, 0x0C, 0x03, 0x08, 0x09, 0x0D, 0x01, 0x04, 0x01, 0x10,
+	0x0B, 0x0C, 0x01, 0x07, 0x0D, 0x0B, 0x01, 0x03, 0x01, 0x0E, 0x0E, 0x12, 0x0F, 0x0B, 0x01, 0x03,
+	0x01, 0x0D, 0x10, 0x10, 0x11, 0x0A, 0x01, 0x03, 0x01, 0x0C, 0x12, 0x0E, 0x12, 0x0B, 0x01, 0x03,
+	0x01, 0x0C, 0x13, 0x0C, 0x14, 0x0A, 0x01, 0x03, 0x01, 0x0B, 0x14, 0x0C, 0x14, 0x0A, 0x01, 0x03,
+	0x01, 0x0A, 0x15, 0x0B, 0x16, 0x09, 0x01, 0x03, 0x01, 0x0A, 0x16, 0x0A, 0x16, 0x09, 0x01, 0x03,
+	0x01, 0x0A, 0x16, 0x0A, 0x16, 0x0A, 0x01, 0x03, 0x01, 0x09, 0x17, 0x0A, 0x16, 0x0A, 0x01, 0x03,
+	0x01, 0x09, 0x17, 0x09, 0x17, 0x0A, 0x21, 0x03, 0x01, 0x09, 0x17, 0x09, 0x18, 0x09, 0x1B, 0x00,
+	// @14956 0x6E (45 pixels wide)
+	0x25, 0x00, 0x01, 0x01, 0x16, 0x09, 0x01, 0x02, 0x00, 0x09, 0x0A, 0x0F, 0x01, 0x02, 0x00, 0x09,
+	0x08, 0x13, 0x01, 0x02, 0x01, 0x08, 0x06, 0x16, 0x01, 0x02, 0x01, 0x08, 0x05, 0x19, 0x01, 0x02,
+	0x01, 0x08, 0x04, 0x1B, 0x01, 0x02, 0x01, 0x08, 0x03, 0x1C, 0x01, 0x02, 0x01, 0x08, 0x02, 0x1E,
+	0x01, 0x03, 0x01, 0x08, 0x01, 0x09, 0x09, 0x0E, 0x01, 0x03, 0x01, 0x08, 0x01, 0x07, 0x0D, 0x0C,
+	0x01, 0x02, 0x01, 0x0F, 0x0F, 0x0C, 0x01, 0x02, 0x01, 0x0D, 0x12, 0x0B, 0x01, 0x02, 0x01, 0x0D,
+	0x13, 0x0B, 0x01, 0x02, 0x01, 0x0C, 0x15, 0x0A, 0x02, 0x02, 0x01, 0x0B, 0x16, 0x0A, 0x01, 0x02,
+	0x01, 0x0A, 0x18, 0x09, 0x02, 0x02, 0x01, 0x0A, 0x18, 0x0A, 0x22, 0x02, 0x01, 0x09, 0x19, 0x0A,
+	0x1B, 0x00,
+	// @15070 0x6F (51 pixels wide)
+	0x25, 0x00, 0x01, 0x01, 0x14, 0x0B, 0x01, 0x01, 0x11, 0x12, 0x01, 0x01, 0x0E, 0x17, 0x01, 0x01,
+	0x0C, 0x1B, 0x01, 0x01, 0x0B, 0x1E, 0x01, 0x01, 0x09, 0x21, 0x01, 0x01, 0x08, 0x23, 0x01, 0x02,
+	0x07, 0x0F, 0x07, 0x0F, 0x01, 0x02, 0x06, 0x0D, 0x0D, 0x0D, 0x01, 0x02, 0x06, 0x0B, 0x11, 0x0C,
+	0x01, 0x02, 0x05, 0x0B, 0x13, 0x0B, 0x01, 0x02, 0x04, 0x0B, 0x15, 0x0B, 0x01, 0x02, 0x04, 0x0A,
+	0x17, 0x0A, 0x01, 0x02, 0x03, 0x0A, 0x18, 0x0B, 0x01, 0x02, 0x03, 0x0A, 0x19, 0x0A, 0x02, 0x02,
+	0x02, 0x0A, 0x1B, 0x0A, 0x01, 0x02, 0x01, 0x0A, 0x1C, 0x0B, 0x02, 0x02, 0x01, 0x0A, 0x1D, 0x0A,
+	0x01, 0x02, 0x01, 0x09, 0x1E, 0x0A, 0x01, 0x02, 0x01, 0x09, 0x1F, 0x09, 0x09, 0x02, 0x00, 0x0A,
+	0x1F, 0x0A, 0x02, 0x02, 0x00, 0x0A, 0x1F, 0x09, 0x01, 0x02, 0x01, 0x09, 0x1E, 0x0A, 0x02, 0x02,
+	0x01, 0x0A, 0x1D, 0x0A, 0x01, 0x02, 0x01, 0x0A, 0x1C, 0x0A, 0x01, 0x02, 0x02, 0x0A, 0x1B, 0x0A,
+	0x01, 0x02, 0x02, 0x0A, 0x1A, 0x0B, 0x01, 0x02, 0x02, 0x0B, 0x19, 0x0A, 0x01, 0x02, 0x03, 0x0A,
+	0x18, 0x0B, 0x01, 0x02, 0x03, 0x0B, 0x16, 0x0B, 0x01, 0x02, 0x04, 0x0B, 0x15, 0x0B, 0x01, 0x02,
+	0x04, 0x0C, 0x13, 0x0B, 0x01, 0x02, 0x05, 0x0C, 0x10, 0x0C, 0x01, 0x02, 0x06, 0x0D, 0x0D, 0x0D,
+	0x01, 0x02, 0x07, 0x0E, 0x08, 0x0F, 0x01, 0x01, 0x08, 0x23, 0x01, 0x01, 0x09, 0x20, 0x01, 0x01,
+	0x0A, 0x1E, 0x01, 0x01, 0x0C, 0x1B, 0x01, 0x01, 0x0D, 0x18, 0x01, 0x01, 0x0F, 0x14, 0x01, 0x01,
+	0x13, 0x0C, 0x1A, 0x00,
+	// @15298 0x70 (50 pixels wide)
+	0x25, 0x00, 0x01, 0x01, 0x17, 0x0A, 0x01, 0x02, 0x00, 0x09, 0x0A, 0x11, 0x01, 0x02, 0x00, 0x09,
+	0x08, 0x15, 0x01, 0x02, 0x01, 0x08, 0x07, 0x18, 0x01, 0x02, 0x01, 0x08, 0x05, 0x1B, 0x01, 0x02,
+	0x01, 0x08, 0x04, 0x1D, 0x01, 0x02, 0x01, 0x08, 0x03, 0x1F, 0x01, 0x02, 0x01, 0x08, 0x02, 0x21,
+	0x01, 0x03, 0x01, 0x08, 0x02, 0x09, 0x0A, 0x0F, 0x01, 0x03, 0x01, 0x08, 0x01, 0x08, 0x0E, 0x0D,
+	0x01, 0x02, 0x01, 0x0F, 0x12, 0x0C, 0x01, 0x02, 0x01, 0x0E, 0x14, 0x0C, 0x01, 0x02, 0x01, 0x0D,
+	0x16, 0x0B, 0x02, 0x02, 0x01, 0x0C, 0x18, 0x0B, 0x01, 0x02, 0x01, 0x0B, 0x1A, 0x0A, 0x01, 0x02,
+	0x01, 0x0B, 0x1A, 0x0B, 0x03, 0x02, 0x01, 0x0A, 0x1C, 0x0A, 0x01, 0x02, 0x01, 0x0A, 0x1D, 0x0A,
+	0x0C, 0x02, 0x01, 0x09, 0x1E, 0x0A, 0x01, 0x02, 0x01, 0x09, 0x1E, 0x09, 0x01, 0x02, 0x01, 0x09,
+	0x1D, 0x0A, 0x02, 0x02, 0x01, 0x0A, 0x1C, 0x0A, 0x01, 0x02, 0x01, 0x0A, 0x1B, 0x0A, 0x01, 0x02,
+	0x01, 0x0B, 0x1A, 0x0A, 0x01, 0x02, 0x01, 0x0B, 0x19, 0x0B, 0x01, 0x02, 0x01, 0x0C, 0x18, 0x0A,
+	0x01, 0x02, 0x01, 0x0C, 0x17, 0x0B, 0x01, 0x02, 0x01, 0x0D, 0x15, 0x0B, 0x01, 0x02, 0x01, 0x0E,
+	0x13, 0x0C, 0x01, 0x02, 0x01, 0x10, 0x10, 0x0C, 0x01, 0x02, 0x01, 0x12, 0x0C, 0x0D, 0x01, 0x03,
+	0x01, 0x09, 0x01, 0x0B, 0x06, 0x0F, 0x01, 0x02, 0x01, 0x09, 0x01, 0x1F, 0x01, 0x02, 0x01, 0x09,
+	0x02, 0x1D, 0x01, 0x02, 0x01, 0x09, 0x03, 0x1B, 0x01, 0x02, 0x01, 0x09, 0x04, 0x19, 0x01, 0x02,
+	0x01, 0x09, 0x06, 0x15, 0x01, 0x02, 0x01, 0x09, 0x08, 0x11, 0x01, 0x02, 0x01, 0x09, 0x0A, 0x0C,
+	0x14, 0x01, 0x01, 0x09, 0x06, 0x00,
+	// @15544 0x71 (49 pixels wide)
+	0x25, 0x00, 0x01, 0x01, 0x13, 0x09, 0x01, 0x02, 0x0F, 0x11, 0x08, 0x09, 0x01, 0x02, 0x0D, 0x15,
+	0x06, 0x09, 0x01, 0x02, 0x0C, 0x17, 0x05, 0x09, 0x01, 0x02, 0x0A, 0x1A, 0x04, 0x09, 0x01, 0x02,
+	0x09, 0x1C, 0x03, 0x09, 0x01, 0x02, 0x08, 0x1E, 0x02, 0x09, 0x01, 0x02, 0x07, 0x20, 0x01, 0x09,
+	0x01, 0x03, 0x06, 0x0E, 0x0A, 0x09, 0x01, 0x09, 0x01, 0x02, 0x05, 0x0D, 0x0E, 0x11, 0x01, 0x02,
+	0x05, 0x0B, 0x12, 0x0F, 0x01, 0x02, 0x04, 0x0B, 0x14, 0x0E, 0x01, 0x02, 0x03, 0x0B, 0x16, 0x0D,
+	0x02, 0x02, 0x03, 0x0A, 0x18, 0x0C, 0x02, 0x02, 0x02, 0x0A, 0x1A, 0x0B, 0x01, 0x02, 0x01, 0x0A,
+	0x1B, 0x0B, 0x02, 0x02, 0x01, 0x0A, 0x1C, 0x0A, 0x02, 0x02, 0x01, 0x09, 0x1D, 0x0A, 0x0C, 0x02,
+	0x00, 0x0A, 0x1D, 0x0A, 0x01, 0x02, 0x01, 0x09, 0x1D, 0x0A, 0x01, 0x02, 0x01, 0x0A, 0x1C, 0x0A,
+	0x02, 0x02, 0x01, 0x0A, 0x1B, 0x0B, 0x01, 0x02, 0x02, 0x0A, 0x1A, 0x0B, 0x01, 0x02, 0x02, 0x0A,
+	0x19, 0x0C, 0x01, 0x02, 0x02, 0x0B, 0x17, 0x0D, 0x01, 0x02, 0x03, 0x0B, 0x16, 0x0D, 0x01, 0x02,
+	0x03, 0x0C, 0x14, 0x0E, 0x01, 0x02, 0x04, 0x0C, 0x12, 0x0F, 0x01, 0x02, 0x05, 0x0C, 0x0F, 0x11,
+	0x01, 0x02, 0x05, 0x0E, 0x0C, 0x12, 0x01, 0x03, 0x06, 0x10, 0x05, 0x0B, 0x01, 0x0A, 0x01, 0x02,
+	0x07, 0x1E, 0x02, 0x0A, 0x01, 0x02, 0x08, 0x1C, 0x03, 0x0A, 0x01, 0x02, 0x09, 0x1B, 0x03, 0x0A,
+	0x01, 0x02, 0x0A, 0x18, 0x05, 0x0A, 0x01, 0x02, 0x0C, 0x15, 0x06, 0x0A, 0x01, 0x02, 0x0E, 0x11,
+	0x08, 0x0A, 0x01, 0x02, 0x10, 0x0C, 0x0B, 0x0A, 0x14, 0x01, 0x27, 0x0A, 0x06, 0x00,
+	// @15782 0x72 (26 pixels wide)
+	0x25, 0x00, 0x01, 0x01, 0x14, 0x06, 0x01, 0x02, 0x00, 0x09, 0x09, 0x08, 0x01, 0x02, 0x00, 0x09,
+	0x07, 0x0A, 0x01, 0x02, 0x01, 0x08, 0x06, 0x0B, 0x01, 0x02, 0x01, 0x08, 0x05, 0x0C, 0x01, 0x02,
+	0x01, 0x08, 0x04, 0x0D, 0x01, 0x02, 0x01, 0x08, 0x03, 0x0E, 0x02, 0x02, 0x01, 0x08, 0x02, 0x0F,
+	0x01, 0x02, 0x01, 0x08, 0x01, 0x09, 0x01, 0x02, 0x01, 0x08, 0x01, 0x07, 0x01, 0x01, 0x01, 0x0F,
+	0x01, 0x01, 0x01, 0x0E, 0x01, 0x01, 0x01, 0x0D, 0x01, 0x01, 0x01, 0x0C, 0x03, 0x01, 0x01, 0x0B,
+	0x03, 0x01, 0x01, 0x0A, 0x20, 0x01, 0x01, 0x09, 0x1B, 0x00,
+	// @15872 0x73 (34 pixels wide)
+	0x25, 0x00, 0x01, 0x01, 0x0F, 0x0A, 0x01, 0x01, 0x0B, 0x12, 0x01, 0x01, 0x09, 0x16, 0x01, 0x01,
+	0x08, 0x18, 0x01, 0x01, 0x06, 0x1A, 0x02, 0x01, 0x05, 0x1A, 0x01, 0x02, 0x04, 0x0C, 0x08, 0x07,
+	0x01, 0x02, 0x03, 0x0B, 0x0D, 0x03, 0x01, 0x02, 0x03, 0x0A, 0x10, 0x01, 0x01, 0x01, 0x02, 0x0A,
+	0x06, 0x01, 0x02, 0x09, 0x02, 0x01, 0x02, 0x0A, 0x01, 0x01, 0x02, 0x0C, 0x01, 0x01, 0x03, 0x0C,
+	0x01, 0x01, 0x03, 0x0E, 0x01, 0x01, 0x04, 0x0F, 0x01, 0x01, 0x05, 0x11, 0x01, 0x01, 0x06, 0x12,
+	0x01, 0x01, 0x07, 0x13, 0x01, 0x01, 0x08, 0x13, 0x01, 0x01, 0x0A, 0x13, 0x01, 0x01, 0x0C, 0x12,
+	0x01, 0x01, 0x0E, 0x11, 0x01, 0x01, 0x11, 0x0F, 0x01, 0x01, 0x13, 0x0D, 0x01, 0x01, 0x15, 0x0C,
+	0x01, 0x01, 0x16, 0x0B, 0x01, 0x01, 0x17, 0x0B, 0x01, 0x01, 0x18, 0x0A, 0x06, 0x01, 0x19, 0x09,
+	0x01, 0x01, 0x18, 0x0A, 0x01, 0x02, 0x02, 0x01, 0x15, 0x09, 0x01, 0x02, 0x02, 0x03, 0x12, 0x0A,
+	0x01, 0x02, 0x02, 0x05, 0x0F, 0x0A, 0x01, 0x02, 0x02, 0x09, 0x08, 0x0D, 0x01, 0x01, 0x01, 0x1E,
+	0x01, 0x01, 0x01, 0x1D, 0x01, 0x01, 0x01, 0x1C, 0x01, 0x01, 0x00, 0x1C, 0x01, 0x01, 0x02, 0x18,
+	0x01, 0x01, 0x05, 0x13, 0x01, 0x01, 0x09, 0x0C, 0x1A, 0x00,
+	// @16058 0x74 (31 pixels wide)
+	0x1A, 0x00, 0x01, 0x01, 0x0F, 0x02, 0x01, 0x01, 0x0C, 0x05, 0x0A, 0x01, 0x08, 0x09, 0x07, 0x01,
+	0x00, 0x1F, 0x20, 0x01, 0x08, 0x09, 0x03, 0x01, 0x08, 0x0A, 0x01, 0x01, 0x09, 0x0A, 0x01, 0x01,
+	0x09, 0x0B, 0x01, 0x01, 0x09, 0x0C, 0x01, 0x01, 0x09, 0x15, 0x02, 0x01, 0x0A, 0x14, 0x01, 0x01,
+	0x0B, 0x13, 0x01, 0x01, 0x0C, 0x12, 0x01, 0x01, 0x0D, 0x11, 0x01, 0x01, 0x0F, 0x0F, 0x01, 0x01,
+	0x11, 0x0B, 0x1A, 0x00,
+	// @16126 0x75 (45 pixels wide)
+	0x26, 0x00, 0x20, 0x02, 0x00, 0x0A, 0x19, 0x09, 0x03, 0x02, 0x01, 0x09, 0x19, 0x09, 0x03, 0x02,
+	0x01, 0x0A, 0x17, 0x0A, 0x01, 0x02, 0x01, 0x0A, 0x16, 0x0B, 0x01, 0x02, 0x01, 0x0B, 0x14, 0x0C,
+	0x01, 0x02, 0x02, 0x0A, 0x14, 0x0C, 0x01, 0x02, 0x02, 0x0B, 0x12, 0x0D, 0x01, 0x02, 0x02, 0x0C,
+	0x10, 0x0E, 0x01, 0x02, 0x03, 0x0C, 0x0D, 0x10, 0x01, 0x03, 0x03, 0x0E, 0x09, 0x09, 0x01, 0x08,
+	0x01, 0x02, 0x04, 0x1E, 0x02, 0x08, 0x01, 0x02, 0x05, 0x1C, 0x03, 0x08, 0x01, 0x02, 0x05, 0x1B,
+	0x04, 0x08, 0x01, 0x02, 0x06, 0x19, 0x05, 0x08, 0x01, 0x02, 0x07, 0x17, 0x06, 0x08, 0x01, 0x02,
+	0x09, 0x14, 0x07, 0x08, 0x01, 0x02, 0x0A, 0x11, 0x09, 0x09, 0x01, 0x01, 0x0D, 0x0B, 0x1A, 0x00,
+	// @16238 0x76 (48 pixels wide)
+	0x26, 0x00, 0x03, 0x02, 0x00, 0x0A, 0x1C, 0x0A, 0x02, 0x02, 0x01, 0x0A, 0x1A, 0x0A, 0x01, 0x02,
+	0x01, 0x0A, 0x1A, 0x09, 0x02, 0x02, 0x02, 0x0A, 0x18, 0x0A, 0x01, 0x02, 0x03, 0x09, 0x18, 0x09,
+	0x01, 0x02, 0x03, 0x0A, 0x16, 0x0A, 0x01, 0x02, 0x03, 0x0A, 0x16, 0x09, 0x01, 0x02, 0x04, 0x09,
+	0x16, 0x09, 0x01, 0x02, 0x04, 0x0A, 0x14, 0x0A, 0x01, 0x02, 0x04, 0x0A, 0x14, 0x09, 0x01, 0x02,
+	0x05, 0x09, 0x14, 0x09, 0x01, 0x02, 0x05, 0x0A, 0x12, 0x09, 0x01, 0x02, 0x06, 0x09, 0x12, 0x09,
+	0x01, 0x02, 0x06, 0x0A, 0x11, 0x09, 0x01, 0x02, 0x06, 0x0A, 0x10, 0x09, 0x01, 0x02, 0x07, 0x09,
+	0x10, 0x09, 0x01, 0x02, 0x07, 0x0A, 0x0F, 0x08, 0x01, 0x02, 0x07, 0x0A, 0x0E, 0x09, 0x01, 0x02,
+	0x08, 0x09, 0x0E, 0x09, 0x01, 0x02, 0x08, 0x0A, 0x0C, 0x09, 0x01, 0x02, 0x09, 0x09, 0x0C, 0x09,
+	0x01, 0x02, 0x09, 0x09, 0x0C, 0x08, 0x01, 0x02, 0x09, 0x0A, 0x0A, 0x09, 0x01, 0x02, 0x0A, 0x09,
+	0x0A, 0x09, 0x01, 0x02, 0x0A, 0x09, 0x0A, 0x08, 0x02, 0x02, 0x0B, 0x09, 0x08, 0x09, 0x01, 0x02,
+	0x0B, 0x09, 0x08, 0x08, 0x01, 0x02, 0x0C, 0x09, 0x06, 0x09, 0x02, 0x02, 0x0C, 0x09, 0x06, 0x08,
+	0x01, 0x02, 0x0D, 0x09, 0x04, 0x09, 0x01, 0x02, 0x0D, 0x09, 0x04, 0x08, 0x01, 0x02, 0x0E, 0x08,
+	0x04, 0x08, 0x02, 0x02, 0x0E, 0x09, 0x02, 0x08, 0x01, 0x02, 0x0F, 0x08, 0x02, 0x08, 0x02, 0x01,
+	0x0F, 0x11, 0x02, 0x01, 0x10, 0x0F, 0x01, 0x01, 0x11, 0x0E, 0x02, 0x01, 0x11, 0x0D, 0x03, 0x01,
+	0x12, 0x0B, 0x01, 0x01, 0x13, 0x09, 0x1B, 0x00,
+	// @16470 0x77 (75 pixels wide)
+	0x26, 0x00, 0x01, 0x03, 0x00, 0x0A, 0x18, 0x08, 0x18, 0x09, 0x01, 0x03, 0x00, 0x0A, 0x17, 0x09,
+	0x17, 0x0A, 0x01, 0x03, 0x01, 0x09, 0x17, 0x09, 0x17, 0x09, 0x01, 0x03, 0x01, 0x09, 0x17, 0x0A,
+	0x16, 0x09, 0x01, 0x03, 0x01, 0x0A, 0x15, 0x0B, 0x16, 0x09, 0x01, 0x03, 0x02, 0x09, 0x15, 0x0B,
+	0x15, 0x09, 0x01, 0x03, 0x02, 0x09, 0x15, 0x0C, 0x14, 0x09, 0x01, 0x03, 0x02, 0x09, 0x14, 0x0D,
+	0x14, 0x09, 0x01, 0x03, 0x02, 0x0A, 0x13, 0x0D, 0x13, 0x09, 0x01, 0x03, 0x03, 0x09, 0x13, 0x0D,
+	0x13, 0x09, 0x01, 0x03, 0x03, 0x09, 0x12, 0x0F, 0x12, 0x09, 0x01, 0x04, 0x03, 0x0A, 0x11, 0x07,
+	0x01, 0x07, 0x12, 0x09, 0x01, 0x04, 0x04, 0x09, 0x11, 0x07, 0x01, 0x07, 0x11, 0x09, 0x02, 0x04,
+	0x04, 0x09, 0x10, 0x07, 0x02, 0x08, 0x10, 0x09, 0x01, 0x04, 0x05, 0x09, 0x0F, 0x07, 0x03, 0x07,
+	0x0F, 0x09, 0x01, 0x04, 0x05, 0x09, 0x0E, 0x08, 0x03, 0x08, 0x0E, 0x09, 0x01, 0x04, 0x05, 0x09,
+	0x0E, 0x07, 0x04, 0x08, 0x0E, 0x09, 0x01, 0x04, 0x05, 0x09, 0x0E, 0x07, 0x04, 0x08, 0x0E, 0x08,
+	0x02, 0x04, 0x06, 0x09, 0x0C, 0x08, 0x05, 0x08, 0x0C, 0x09, 0x01, 0x04, 0x06, 0x09, 0x0C, 0x07,
+	0x06, 0x08, 0x0C, 0x08, 0x01, 0x04, 0x07, 0x08, 0x0B, 0x08, 0x07, 0x07, 0x0B, 0x09, 0x01, 0x04,
+	0x07, 0x09, 0x0A, 0x08, 0x07, 0x08, 0x0A, 0x09, 0x01, 0x04, 0x07, 0x09, 0x0A, 0x07, 0x08, 0x08,
+	0x0A, 0x08, 0x01, 0x04, 0x08, 0x08, 0x0A, 0x07, 0x08, 0x08, 0x0A, 0x08, 0x01, 0x04, 0x08, 0x09,
+	0x08, 0x08, 0x09, 0x08, 0x08, 0x09, 0x02, 0x04, 0x08, 0x09, 0x08, 0x07, 0x0A, 0x08, 0x08, 0x08,
+	0x01, 0x04, 0x09, 0x08, 0x07, 0x08, 0x0B, 0x08, 0x07, 0x08, 0x02, 0x04, 0x09, 0x09, 0x06, 0x07,
+	0x0C, 0x08, 0x06, 0x08, 0x01, 0x04, 0x0A, 0x08, 0x05, 0x08, 0x0D, 0x07, 0x06, 0x08, 0x01, 0x04,
+	0x0A, 0x08, 0x05, 0x07, 0x0E, 0x08, 0x05, 0x07, 0x01, 0x04, 0x0A, 0x08, 0x05, 0x07, 0x0E, 0x08,
+	0x04, 0x08, 0x01, 0x04, 0x0B, 0x08, 0x03, 0x08, 0x0F, 0x07, 0x04, 0x08, 0x02, 0x04, 0x0B, 0x08,
+	0x03, 0x07, 0x10, 0x08, 0x03, 0x07, 0x01, 0x04, 0x0B, 0x08, 0x03, 0x07, 0x11, 0x07, 0x02, 0x08,
+	0x01, 0x04, 0x0C, 0x08, 0x01, 0x07, 0x12, 0x07, 0x02, 0x07, 0x01, 0x04, 0x0C, 0x08, 0x01, 0x07,
+	0x12, 0x08, 0x01, 0x07, 0x01, 0x04, 0x0C, 0x08, 0x01, 0x07, 0x13, 0x07, 0x01, 0x07, 0x01, 0x04,
+	0x0D, 0x07, 0x01, 0x06, 0x14, 0x07, 0x01, 0x07, 0x02, 0x02, 0x0D, 0x0E, 0x14, 0x0E, 0x01, 0x02,
+	0x0E, 0x0C, 0x16, 0x0D, 0x02, 0x02, 0x0E, 0x0C, 0x16, 0x0C, 0x01, 0x02, 0x0F, 0x0A, 0x18, 0x0B,
+	0x02, 0x02, 0x0F, 0x0A, 0x18, 0x0A, 0x01, 0x02, 0x0F, 0x09, 0x1A, 0x09, 0x1B, 0x00,
+	// @16868 0x78 (47 pixels wide)
+	0x26, 0x00, 0x01, 0x02, 0x01, 0x0A, 0x19, 0x0B, 0x01, 0x02, 0x02, 0x0A, 0x18, 0x0A, 0x01, 0x02,
+	0x02, 0x0B, 0x16, 0x0A, 0x01, 0x02, 0x03, 0x0A, 0x15, 0x0B, 0x01, 0x02, 0x04, 0x0A, 0x14, 0x0A,
+	0x01, 0x02, 0x04, 0x0B, 0x12, 0x0A, 0x01, 0x02, 0x05, 0x0A, 0x11, 0x0A, 0x01, 0x02, 0x06, 0x0A,
+	0x10, 0x0A, 0x01, 0x02, 0x06, 0x0B, 0x0E, 0x0A, 0x01, 0x02, 0x07, 0x0A, 0x0E, 0x09, 0x01, 0x02,
+	0x08, 0x0A, 0x0C, 0x0A, 0x01, 0x02, 0x09, 0x0A, 0x0A, 0x0A, 0x01, 0x02, 0x09, 0x0A, 0x0A, 0x09,
+	0x01, 0x02, 0x0A, 0x0A, 0x08, 0x09, 0x01, 0x02, 0x0B, 0x0A, 0x06, 0x0A, 0x01, 0x02, 0x0B, 0x0A,
+	0x06, 0x09, 0x01, 0x02, 0x0C, 0x0A, 0x04, 0x09, 0x01, 0x02, 0x0D, 0x09, 0x03, 0x0A, 0x01, 0x02,
+	0x0D, 0x0A, 0x02, 0x09, 0x01, 0x01, 0x0E, 0x13, 0x01, 0x01, 0x0F, 0x12, 0x01, 0x01, 0x0F, 0x11,
+	0x01, 0x01, 0x10, 0x0F, 0x01, 0x01, 0x11, 0x0D, 0x01, 0x01, 0x12, 0x0C, 0x01, 0x01, 0x12, 0x0B,
+	0x01, 0x01, 0x12, 0x0C, 0x01, 0x01, 0x11, 0x0E, 0x01, 0x01, 0x10, 0x0F, 0x01, 0x01, 0x10, 0x10,
+	0x01, 0x01, 0x0F, 0x12, 0x01, 0x01, 0x0E, 0x13, 0x01, 0x02, 0x0D, 0x0A, 0x01, 0x0A, 0x01, 0x02,
+	0x0D, 0x09, 0x03, 0x0A, 0x01, 0x02, 0x0C, 0x09, 0x04, 0x0A, 0x01, 0x02, 0x0B, 0x0A, 0x05, 0x0A,
+	0x01, 0x02, 0x0B, 0x09, 0x06, 0x0B, 0x01, 0x02, 0x0A, 0x0A, 0x07, 0x0A, 0x01, 0x02, 0x09, 0x0A,
+	0x09, 0x0A, 0x01, 0x02, 0x09, 0x09, 0x0A, 0x0B, 0x01, 0x02, 0x08, 0x0A, 0x0B, 0x0B, 0x01, 0x02,
+	0x07, 0x0A, 0x0D, 0x0A, 0x01, 0x02, 0x06, 0x0A, 0x0E, 0x0B, 0x01, 0x02, 0x06, 0x0A, 0x0F, 0x0B,
+	0x01, 0x02, 0x05, 0x0A, 0x11, 0x0A, 0x01, 0x02, 0x04, 0x0A, 0x12, 0x0B, 0x01, 0x02, 0x04, 0x0A,
+	0x13, 0x0B, 0x01, 0x02, 0x03, 0x0A, 0x15, 0x0A, 0x01, 0x02, 0x02, 0x0A, 0x16, 0x0B, 0x01, 0x02,
+	0x02, 0x0A, 0x17, 0x0B, 0x01, 0x02, 0x01, 0x0A, 0x19, 0x0A, 0x01, 0x02, 0x00, 0x0B, 0x19, 0x0B,
+	0x1B, 0x00,
+	// @17158 0x79 (49 pixels wide)
+	0x26, 0x00, 0x01, 0x02, 0x00, 0x0A, 0x1D, 0x0A, 0x01, 0x02, 0x00, 0x0B, 0x1B, 0x0A, 0x01, 0x02,
+	0x01, 0x0A, 0x1B, 0x0A, 0x01, 0x02, 0x01, 0x0A, 0x1B, 0x09, 0x02, 0x02, 0x02, 0x0A, 0x19, 0x0A,
+	0x01, 0x02, 0x02, 0x0B, 0x18, 0x09, 0x01, 0x02, 0x03, 0x0A, 0x17, 0x0A, 0x01, 0x02, 0x03, 0x0A,
+	0x17, 0x09, 0x01, 0x02, 0x04, 0x0A, 0x16, 0x09, 0x01, 0x02, 0x04, 0x0A, 0x15, 0x0A, 0x01, 0x02,
+	0x04, 0x0A, 0x15, 0x09, 0x01, 0x02, 0x05, 0x0A, 0x14, 0x09, 0x01, 0x02, 0x05, 0x0A, 0x13, 0x0A,
+	0x01, 0x02, 0x06, 0x09, 0x13, 0x09, 0x01, 0x02, 0x06, 0x0A, 0x12, 0x09, 0x01, 0x02, 0x06, 0x0A,
+	0x11, 0x09, 0x02, 0x02, 0x07, 0x0A, 0x10, 0x09, 0x01, 0x02, 0x08, 0x09, 0x0F, 0x09, 0x01, 0x02,
+	0x08, 0x0A, 0x0E, 0x09, 0x01, 0x02, 0x08, 0x0A, 0x0D, 0x0A, 0x01, 0x02, 0x09, 0x09, 0x0D, 0x09,
+	0x01, 0x02, 0x09, 0x0A, 0x0C, 0x09, 0x01, 0x02, 0x0A, 0x09, 0x0B, 0x09, 0x02, 0x02, 0x0A, 0x0A,
+	0x0A, 0x09, 0x01, 0x02, 0x0B, 0x09, 0x09, 0x09, 0x01, 0x02, 0x0B, 0x0A, 0x08, 0x09, 0x01, 0x02,
+	0x0C, 0x09, 0x08, 0x08, 0x01, 0x02, 0x0C, 0x09, 0x07, 0x09, 0x01, 0x02, 0x0C, 0x0A, 0x06, 0x09,
+	0x01, 0x02, 0x0D, 0x09, 0x06, 0x08, 0x01, 0x02, 0x0D, 0x09, 0x05, 0x09, 0x01, 0x02, 0x0E, 0x09,
+	0x04, 0x09, 0x02, 0x02, 0x0E, 0x09, 0x04, 0x08, 0x02, 0x02, 0x0F, 0x09, 0x02, 0x08, 0x01, 0x02,
+	0x10, 0x08, 0x02, 0x08, 0x02, 0x01, 0x10, 0x11, 0x02, 0x01, 0x11, 0x0F, 0x01, 0x01, 0x12, 0x0E,
+	0x02, 0x01, 0x12, 0x0D, 0x02, 0x01, 0x13, 0x0B, 0x02, 0x01, 0x14, 0x09, 0x01, 0x01, 0x13, 0x0A,
+	0x02, 0x01, 0x13, 0x09, 0x02, 0x01, 0x12, 0x09, 0x01, 0x01, 0x11, 0x09, 0x01, 0x01, 0x10, 0x0A,
+	0x01, 0x01, 0x10, 0x09, 0x01, 0x01, 0x0F, 0x09, 0x01, 0x01, 0x0E, 0x0A, 0x01, 0x01, 0x0D, 0x0A,
+	0x01, 0x01, 0x0C, 0x0B, 0x01, 0x01, 0x0B, 0x0B, 0x01, 0x01, 0x09, 0x0C, 0x01, 0x01, 0x08, 0x0C,
+	0x01, 0x01, 0x06, 0x0E, 0x01, 0x01, 0x04, 0x0F, 0x01, 0x01, 0x03, 0x0F, 0x01, 0x01, 0x03, 0x0E,
+	0x01, 0x01, 0x04, 0x0C, 0x01, 0x01, 0x04, 0x0A, 0x01, 0x01, 0x04, 0x09, 0x01, 0x01, 0x05, 0x06,
+	0x01, 0x01, 0x05, 0x04, 0x01, 0x01, 0x05, 0x01, 0x03, 0x00,
+	// @17488 0x7A (42 pixels wide)
+	0x26, 0x00, 0x06, 0x01, 0x02, 0x28, 0x01, 0x01, 0x02, 0x27, 0x01, 0x01, 0x02, 0x26, 0x01, 0x01,
+	0x1E, 0x0A, 0x01, 0x01, 0x1D, 0x0A, 0x01, 0x01, 0x1C, 0x0A, 0x01, 0x01, 0x1B, 0x0A, 0x01, 0x01,
+	0x1A, 0x0B, 0x01, 0x01, 0x19, 0x0B, 0x01, 0x01, 0x19, 0x0A, 0x01, 0x01, 0x18, 0x0A, 0x01, 0x01,
+	0x17, 0x0B, 0x01, 0x01, 0x16, 0x0B, 0x01, 0x01, 0x15, 0x0B, 0x01, 0x01, 0x15, 0x0A, 0x01, 0x01,
+	0x14, 0x0A, 0x01, 0x01, 0x13, 0x0B, 0x01, 0x01, 0x12, 0x0B, 0x01, 0x01, 0x12, 0x0A, 0x01, 0x01,
+	0x11, 0x0A, 0x01, 0x01, 0x10, 0x0B, 0x01, 0x01, 0x0F, 0x0B, 0x01, 0x01, 0x0F, 0x0A, 0x01, 0x01,
+	0x0E, 0x0A, 0x01, 0x01, 0x0D, 0x0B, 0x01, 0x01, 0x0C, 0x0B, 0x01, 0x01, 0x0B, 0x0B, 0x01, 0x01,
+	0x0B, 0x0A, 0x01, 0x01, 0x0A, 0x0A, 0x01, 0x01, 0x09, 0x0B, 0x01, 0x01, 0x08, 0x0B, 0x01, 0x01,
+	0x08, 0x0A, 0x01, 0x01, 0x07, 0x0A, 0x01, 0x01, 0x06, 0x0B, 0x01, 0x01, 0x05, 0x0B, 0x01, 0x01,
+	0x05, 0x0A, 0x01, 0x01, 0x04, 0x0A, 0x01, 0x01, 0x03, 0x0A, 0x02, 0x01, 0x02, 0x0A, 0x01, 0x01,
+	0x01, 0x29, 0x06, 0x01, 0x00, 0x2A, 0x1B, 0x00,
+	// @17656 0x7B (25 pixels wide)
+	0x11, 0x00, 0x01, 0x01, 0x10, 0x09, 0x01, 0x01, 0x0D, 0x0C, 0x01, 0x01, 0x0C, 0x0D, 0x02, 0x01,
+	0x0A, 0x0F, 0x01, 0x01, 0x09, 0x10, 0x01, 0x01, 0x08, 0x0A, 0x01, 0x01, 0x08, 0x09, 0x01, 0x01,
+	0x08, 0x08, 0x03, 0x01, 0x07, 0x08, 0x05, 0x01, 0x07, 0x07, 0x03, 0x01, 0x07, 0x08, 0x05, 0x01,
+	0x08, 0x07, 0x03, 0x01, 0x08, 0x08, 0x06, 0x01, 0x09, 0x07, 0x01, 0x01, 0x08, 0x08, 0x01, 0x01,
+	0x08, 0x07, 0x01, 0x01, 0x07, 0x08, 0x01, 0x01, 0x07, 0x07, 0x01, 0x01, 0x05, 0x09, 0x01, 0x01,
+	0x00, 0x0D, 0x01, 0x01, 0x00, 0x0C, 0x01, 0x01, 0x00, 0x0A, 0x01, 0x01, 0x00, 0x09, 0x01, 0x01,
+	0x00, 0x0B, 0x01, 0x01, 0x00, 0x0D, 0x01, 0x01, 0x04, 0x0A, 0x01, 0x01, 0x06, 0x08, 0x01, 0x01,
+	0x07, 0x08, 0x02, 0x01, 0x08, 0x07, 0x01, 0x01, 0x08, 0x08, 0x05, 0x01, 0x09, 0x07, 0x03, 0x01,
+	0x08, 0x08, 0x05, 0x01, 0x08, 0x07, 0x03, 0x01, 0x07, 0x08, 0x05, 0x01, 0x07, 0x07, 0x03, 0x01,
+	0x07, 0x08, 0x02, 0x01, 0x08, 0x08, 0x01, 0x01, 0x08, 0x09, 0x01, 0x01, 0x09, 0x0A, 0x01, 0x01,
+	0x09, 0x10, 0x01, 0x01, 0x0A, 0x0F, 0x01, 0x01, 0x0B, 0x0E, 0x01, 0x01, 0x0C, 0x0D, 0x01, 0x01,
+	0x0E, 0x0B, 0x01, 0x01, 0x11, 0x08, 0x0F, 0x00,
+	// @17840 0x7C (7 pixels wide)
+	0x0A, 0x00, 0x6B, 0x01, 0x00, 0x07,
+	// @17846 0x7D (24 pixels wide)
+	0x11, 0x00, 0x01, 0x01, 0x00, 0x09, 0x01, 0x01, 0x00, 0x0B, 0x01, 0x01, 0x00, 0x0D, 0x01, 0x01,
+	0x00, 0x0E, 0x01, 0x01, 0x00, 0x0F, 0x01, 0x01, 0x00, 0x10, 0x01, 0x01, 0x06, 0x0A, 0x01, 0x01,
+	0x08, 0x08, 0x01, 0x01, 0x08, 0x09, 0x02, 0x01, 0x09, 0x08, 0x0A, 0x01, 0x0A, 0x07, 0x02, 0x01,
+	0x09, 0x08, 0x06, 0x01, 0x09, 0x07, 0x03, 0x01, 0x08, 0x08, 0x04, 0x01, 0x09, 0x07, 0x01, 0x01,
+	0x09, 0x08, 0x01, 0x01, 0x0A, 0x08, 0x01, 0x01, 0x0B, 0x08, 0x01, 0x01, 0x0C, 0x0C, 0x01, 0x01,
+	0x0D, 0x0B, 0x02, 0x01, 0x0F, 0x09, 0x01, 0x01, 0x0D, 0x0B, 0x01, 0x01, 0x0C, 0x0C, 0x01, 0x01,
+	0x0B, 0x09, 0x01, 0x01, 0x0A, 0x08, 0x01, 0x01, 0x0A, 0x07, 0x01, 0x01, 0x09, 0x08, 0x03, 0x01,
+	0x09, 0x07, 0x04, 0x01, 0x08, 0x08, 0x05, 0x01, 0x09, 0x07, 0x02, 0x01, 0x09, 0x08, 0x0B, 0x01,
+	0x0A, 0x07, 0x02, 0x01, 0x09, 0x08, 0x01, 0x01, 0x08, 0x09, 0x01, 0x01, 0x07, 0x09, 0x01, 0x01,
+	0x05, 0x0B, 0x01, 0x01, 0x00, 0x0F, 0x01, 0x01, 0x00, 0x0E, 0x01, 0x01, 0x00, 0x0D, 0x01, 0x01,
+	0x00, 0x0C, 0x01, 0x01, 0x00, 0x0A, 0x01, 0x01, 0x00, 0x07, 0x0F, 0x00,
+	// @18018 0x7E (54 pixels wide)
+	0x33, 0x00, 0x01, 0x01, 0x0B, 0x04, 0x01, 0x02, 0x08, 0x0B, 0x1C, 0x07, 0x01, 0x02, 0x06, 0x10,
+	0x19, 0x07, 0x01, 0x02, 0x05, 0x13, 0x17, 0x07, 0x01, 0x02, 0x04, 0x17, 0x14, 0x06, 0x01, 0x02,
+	0x03, 0x1A, 0x12, 0x06, 0x01, 0x02, 0x02, 0x1D, 0x0F, 0x07, 0x01, 0x03, 0x02, 0x0A, 0x02, 0x13,
+	0x0D, 0x07, 0x01, 0x03, 0x01, 0x08, 0x08, 0x13, 0x09, 0x08, 0x01, 0x03, 0x01, 0x07, 0x0C, 0x14,
+	0x03, 0x09, 0x01, 0x02, 0x01, 0x07, 0x0E, 0x1E, 0x01, 0x02, 0x01, 0x06, 0x12, 0x1A, 0x01, 0x02,
+	0x00, 0x07, 0x14, 0x18, 0x01, 0x02, 0x00, 0x07, 0x16, 0x15, 0x01, 0x02, 0x00, 0x07, 0x18, 0x12,
+	0x01, 0x02, 0x00, 0x07, 0x1B, 0x0D, 0x01, 0x01, 0x26, 0x07, 0x31, 0x00,
+	// @18126 0x7F (2 pixels wide)
+	0x75, 0x00,
+	// @18128 0x80 (2 pixels wide)
+	0x75, 0x00,
+	// @18130 0x81 (2 pixels wide)
+	0x75, 0x00,
+	// @18132 0x82 (16 pixels wide)
+	0x54, 0x00, 0x01, 0x01, 0x03, 0x07, 0x01, 0x01, 0x02, 0x09, 0x01, 0x01, 0x01, 0x0B, 0x01, 0x01,
+	0x01, 0x0C, 0x02, 0x01, 0x00, 0x0E, 0x04, 0x01, 0x00, 0x0F, 0x01, 0x01, 0x01, 0x0F, 0x01, 0x01,
+	0x02, 0x0E, 0x01, 0x02, 0x04, 0x04, 0x02, 0x06, 0x04, 0x01, 0x0B, 0x04, 0x02, 0x01, 0x0A, 0x04,
+	0x02, 0x01, 0x09, 0x04, 0x01, 0x01, 0x08, 0x04, 0x01, 0x01, 0x07, 0x04, 0x01, 0x01, 0x06, 0x04,
+	0x01, 0x01, 0x05, 0x04, 0x01, 0x01, 0x04, 0x04, 0x01, 0x01, 0x03, 0x04, 0x01, 0x01, 0x02, 0x04,
+	0x01, 0x01, 0x02, 0x02, 0x04, 0x00,
+	// @18218 0x83 (52 pixels wide)
+	0x0C, 0x00, 0x01, 0x01, 0x27, 0x09, 0x01, 0x01, 0x25, 0x0C, 0x01, 0x02, 0x24, 0x04, 0x05, 0x05,
+	0x01, 0x02, 0x22, 0x05, 0x07, 0x05, 0x01, 0x02, 0x22, 0x04, 0x08, 0x06, 0x01, 0x02, 0x21, 0x04,
+	0x08, 0x07, 0x01, 0x02, 0x20, 0x05, 0x08, 0x07, 0x01, 0x02, 0x1F, 0x05, 0x09, 0x07, 0x01, 0x02,
+	0x1F, 0x05, 0x08, 0x08, 0x01, 0x02, 0x1E, 0x05, 0x09, 0x08, 0x01, 0x02, 0x1E, 0x05, 0x0A, 0x07,
+	0x01, 0x02, 0x1D, 0x06, 0x0A, 0x06, 0x01, 0x02, 0x1D, 0x06, 0x0C, 0x02, 0x03, 0x01, 0x1C, 0x06,
+	0x02, 0x01, 0x1B, 0x07, 0x02, 0x01, 0x1B, 0x06, 0x04, 0x01, 0x1A, 0x07, 0x02, 0x01, 0x19, 0x08,
+	0x04, 0x01, 0x19, 0x07, 0x04, 0x01, 0x18, 0x08, 0x02, 0x01, 0x0B, 0x22, 0x08, 0x01, 0x17, 0x08,
+	0x01, 0x01, 0x16, 0x09, 0x07, 0x01, 0x16, 0x08, 0x01, 0x01, 0x15, 0x09, 0x06, 0x01, 0x15, 0x08,
+	0x01, 0x01, 0x14, 0x09, 0x07, 0x01, 0x14, 0x08, 0x03, 0x01, 0x14, 0x07, 0x03, 0x01, 0x13, 0x08,
+	0x06, 0x01, 0x13, 0x07, 0x02, 0x01, 0x13, 0x06, 0x02, 0x01, 0x12, 0x07, 0x03, 0x01, 0x12, 0x06,
+	0x02, 0x01, 0x12, 0x05, 0x01, 0x02, 0x02, 0x04, 0x0B, 0x06, 0x01, 0x02, 0x01, 0x06, 0x0A, 0x05,
+	0x01, 0x02, 0x00, 0x07, 0x0A, 0x05, 0x01, 0x02, 0x00, 0x08, 0x09, 0x05, 0x02, 0x02, 0x00, 0x07,
+	0x09, 0x05, 0x01, 0x02, 0x00, 0x07, 0x08, 0x05, 0x01, 0x02, 0x00, 0x06, 0x09, 0x04, 0x01, 0x02,
+	0x01, 0x05, 0x08, 0x04, 0x01, 0x02, 0x01, 0x05, 0x07, 0x04, 0x01, 0x02, 0x02, 0x04, 0x06, 0x04,
+	0x01, 0x01, 0x03, 0x0C, 0x01, 0x01, 0x05, 0x07, 0x04, 0x00,
+	// @18452 0x84 (36 pixels wide)
+	0x51, 0x00, 0x01, 0x02, 0x03, 0x05, 0x11, 0x04, 0x01, 0x02, 0x02, 0x08, 0x0D, 0x08, 0x01, 0x02,
+	0x01, 0x0A, 0x0B, 0x0A, 0x01, 0x02, 0x00, 0x0C, 0x0A, 0x0B, 0x01, 0x02, 0x00, 0x0C, 0x09, 0x0D,
+	0x01, 0x02, 0x00, 0x0D, 0x08, 0x0D, 0x02, 0x02, 0x00, 0x0D, 0x08, 0x0E, 0x02, 0x02, 0x00, 0x0E,
+	0x07, 0x0E, 0x01, 0x02, 0x00, 0x0E, 0x08, 0x0E, 0x01, 0x02, 0x01, 0x0D, 0x09, 0x0D, 0x01, 0x02,
+	0x03, 0x0B, 0x0A, 0x0C, 0x01, 0x02, 0x0A, 0x04, 0x12, 0x04, 0x02, 0x02, 0x0B, 0x03, 0x12, 0x03,
+	0x02, 0x02, 0x0B, 0x02, 0x13, 0x03, 0x01, 0x02, 0x0A, 0x03, 0x13, 0x02, 0x01, 0x02, 0x0A, 0x02,
+	0x14, 0x02, 0x01, 0x02, 0x0A, 0x02, 0x13, 0x02, 0x01, 0x02, 0x09, 0x02, 0x14, 0x02, 0x01, 0x02,
+	0x08, 0x03, 0x13, 0x02, 0x01, 0x02, 0x08, 0x02, 0x13, 0x02, 0x01, 0x02, 0x07, 0x02, 0x14, 0x02,
+	0x01, 0x02, 0x06, 0x02, 0x14, 0x02, 0x01, 0x02, 0x05, 0x02, 0x14, 0x02, 0x01, 0x02, 0x04, 0x02,
+	0x14, 0x02, 0x01, 0x02, 0x03, 0x02, 0x14, 0x02, 0x01, 0x02, 0x02, 0x02, 0x14, 0x02, 0x01, 0x01,
+	0x02, 0x01, 0x05, 0x00,
+	// @18616 0x85 (2 pixels wide)
+	0x75, 0x00,
+	// @18618 0x86 (42 pixels wide)
+	0x09, 0x00, 0x01, 0x01, 0x14, 0x02, 0x01, 0x01, 0x12, 0x06, 0x01, 0x01, 0x12, 0x07, 0x05, 0x01,
+	0x11, 0x09, 0x01, 0x01, 0x11, 0x08, 0x02, 0x01, 0x12, 0x07, 0x01, 0x01, 0x12, 0x06, 0x02, 0x01,
+	0x13, 0x05, 0x01, 0x01, 0x13, 0x04, 0x03, 0x01, 0x14, 0x03, 0x02, 0x01, 0x14, 0x02, 0x03, 0x01,
+	0x15, 0x01, 0x01, 0x03, 0x03, 0x03, 0x0F, 0x01, 0x0F, 0x03, 0x01, 0x03, 0x01, 0x08, 0x0C, 0x01,
+	0x0C, 0x07, 0x01, 0x03, 0x01, 0x0A, 0x0A, 0x01, 0x0A, 0x0A, 0x01, 0x03, 0x00, 0x0D, 0x08, 0x01,
+	0x08, 0x0C, 0x01, 0x03, 0x00, 0x11, 0x04, 0x01, 0x04, 0x10, 0x01, 0x01, 0x00, 0x2A, 0x01, 0x03,
+	0x00, 0x0F, 0x06, 0x01, 0x05, 0x0F, 0x01, 0x03, 0x01, 0x0B, 0x09, 0x01, 0x09, 0x0B, 0x01, 0x03,
+	0x01, 0x09, 0x0B, 0x01, 0x0B, 0x08, 0x01, 0x03, 0x02, 0x05, 0x0E, 0x01, 0x0E, 0x04, 0x04, 0x01,
+	0x15, 0x01, 0x04, 0x01, 0x14, 0x02, 0x03, 0x01, 0x14, 0x03, 0x02, 0x01, 0x13, 0x04, 0x01, 0x01,
+	0x13, 0x05, 0x01, 0x01, 0x12, 0x06, 0x02, 0x01, 0x12, 0x07, 0x01, 0x01, 0x11, 0x09, 0x02, 0x01,
+	0x10, 0x0A, 0x02, 0x01, 0x11, 0x09, 0x01, 0x01, 0x11, 0x08, 0x02, 0x01, 0x12, 0x07, 0x03, 0x01,
+	0x12, 0x06, 0x03, 0x01, 0x13, 0x05, 0x03, 0x01, 0x13, 0x04, 0x06, 0x01, 0x14, 0x03, 0x04, 0x01,
+	0x14, 0x02, 0x19, 0x01, 0x15, 0x01, 0x06, 0x00,
+	// @18818 0x87 (42 pixels wide)
+	0x09, 0x00, 0x01, 0x01, 0x14, 0x03, 0x01, 0x01, 0x12, 0x06, 0x01, 0x01, 0x12, 0x07, 0x05, 0x01,
+	0x11, 0x09, 0x01, 0x01, 0x11, 0x08, 0x02, 0x01, 0x12, 0x07, 0x01, 0x01, 0x12, 0x06, 0x02, 0x01,
+	0x13, 0x05, 0x01, 0x01, 0x13, 0x04, 0x03, 0x01, 0x14, 0x03, 0x02, 0x01, 0x14, 0x02, 0x03, 0x01,
+	0x15, 0x01, 0x01, 0x03, 0x03, 0x03, 0x0F, 0x01, 0x0F, 0x03, 0x01, 0x03, 0x01, 0x08, 0x0C, 0x01,
+	0x0C, 0x07, 0x01, 0x03, 0x01, 0x0A, 0x0A, 0x01, 0x0A, 0x0A, 0x01, 0x03, 0x00, 0x0D, 0x08, 0x01,
+	0x08, 0x0C, 0x01, 0x03, 0x00, 0x11, 0x04, 0x01, 0x04, 0x10, 0x01, 0x01, 0x00, 0x2A, 0x01, 0x03,
+	0x00, 0x0F, 0x06, 0x01, 0x05, 0x0F, 0x01, 0x03, 0x01, 0x0B, 0x09, 0x01, 0x09, 0x0B, 0x01, 0x03,
+	0x01, 0x09, 0x0B, 0x01, 0x0B, 0x08, 0x01, 0x03, 0x02, 0x05, 0x0E, 0x01, 0x0E, 0x04, 0x04, 0x01,
+	0x15, 0x01, 0x05, 0x01, 0x14, 0x02, 0x02, 0x01, 0x14, 0x03, 0x02, 0x01, 0x13, 0x04, 0x01, 0x01,
+	0x13, 0x05, 0x02, 0x01, 0x12, 0x06, 0x01, 0x01, 0x12, 0x07, 0x01, 0x01, 0x11, 0x08, 0x01, 0x01,
+	0x10, 0x0A, 0x01, 0x01, 0x11, 0x08, 0x01, 0x01, 0x12, 0x07, 0x01, 0x01, 0x12, 0x06, 0x01, 0x01,
+	0x13, 0x05, 0x03, 0x01, 0x13, 0x04, 0x01, 0x01, 0x14, 0x03, 0x06, 0x01, 0x14, 0x02, 0x04, 0x01,
+	0x15, 0x01, 0x01, 0x03, 0x02, 0x06, 0x0D, 0x01, 0x0D, 0x06, 0x01, 0x03, 0x01, 0x09, 0x0B, 0x01,
+	0x0A, 0x09, 0x01, 0x03, 0x00, 0x0C, 0x09, 0x01, 0x08, 0x0C, 0x01, 0x03, 0x00, 0x10, 0x05, 0x01,
+	0x04, 0x10, 0x01, 0x01, 0x00, 0x2A, 0x01, 0x03, 0x00, 0x0F, 0x06, 0x01, 0x05, 0x0F, 0x01, 0x03,
+	0x00, 0x0C, 0x09, 0x01, 0x08, 0x0C, 0x01, 0x03, 0x01, 0x09, 0x0B, 0x01, 0x0B, 0x09, 0x01, 0x03,
+	0x01, 0x07, 0x0D, 0x01, 0x0D, 0x06, 0x01, 0x03, 0x04, 0x01, 0x10, 0x01, 0x10, 0x01, 0x01, 0x01,
+	0x15, 0x01, 0x04, 0x01, 0x14, 0x02, 0x02, 0x01, 0x14, 0x03, 0x02, 0x01, 0x13, 0x04, 0x01, 0x01,
+	0x13, 0x05, 0x02, 0x01, 0x12, 0x06, 0x01, 0x01, 0x12, 0x07, 0x02, 0x01, 0x11, 0x08, 0x04, 0x01,
+	0x11, 0x09, 0x01, 0x01, 0x11, 0x08, 0x01, 0x01, 0x12, 0x06, 0x01, 0x01, 0x13, 0x04, 0x06, 0x00,
+	// @19138 0x88 (33 pixels wide)
+	0x01, 0x01, 0x0B, 0x0A, 0x01, 0x01, 0x0A, 0x0D, 0x01, 0x01, 0x08, 0x10, 0x01, 0x01, 0x07, 0x12,
+	0x01, 0x02, 0x06, 0x09, 0x02, 0x09, 0x01, 0x02, 0x05, 0x08, 0x06, 0x09, 0x01, 0x02, 0x03, 0x09,
+	0x08, 0x09, 0x01, 0x02, 0x02, 0x08, 0x0C, 0x08, 0x01, 0x02, 0x01, 0x07, 0x10, 0x07, 0x01, 0x02,
+	0x00, 0x07, 0x13, 0x07, 0x6B, 0x00,
+	// @19192 0x89 (87 pixels wide)
+	0x0C, 0x00, 0x01, 0x01, 0x2C, 0x03, 0x01, 0x02, 0x0E, 0x09, 0x14, 0x03, 0x01, 0x02, 0x0C, 0x0C,
+	0x12, 0x04, 0x01, 0x02, 0x0B, 0x0E, 0x10, 0x05, 0x01, 0x03, 0x0A, 0x07, 0x03, 0x06, 0x0E, 0x05,
+	0x01, 0x03, 0x09, 0x07, 0x04, 0x07, 0x0B, 0x07, 0x01, 0x03, 0x08, 0x07, 0x06, 0x08, 0x06, 0x0A,
+	0x01, 0x03, 0x08, 0x06, 0x09, 0x10, 0x01, 0x04, 0x01, 0x04, 0x07, 0x06, 0x0B, 0x03, 0x01, 0x09,
+	0x03, 0x04, 0x01, 0x03, 0x06, 0x07, 0x0B, 0x03, 0x0D, 0x03, 0x01, 0x03, 0x06, 0x06, 0x0D, 0x02,
+	0x0C, 0x04, 0x01, 0x03, 0x05, 0x07, 0x0D, 0x02, 0x0C, 0x04, 0x01, 0x03, 0x05, 0x06, 0x0E, 0x03,
+	0x0A, 0x04, 0x01, 0x03, 0x04, 0x07, 0x0E, 0x03, 0x0A, 0x04, 0x01, 0x03, 0x04, 0x06, 0x0F, 0x03,
+	0x0A, 0x03, 0x02, 0x03, 0x03, 0x07, 0x0F, 0x03, 0x09, 0x04, 0x01, 0x03, 0x02, 0x07, 0x10, 0x03,
+	0x09, 0x03, 0x01, 0x03, 0x02, 0x07, 0x10, 0x03, 0x08, 0x04, 0x01, 0x03, 0x02, 0x06, 0x11, 0x03,
+	0x08, 0x03, 0x01, 0x03, 0x01, 0x07, 0x11, 0x03, 0x07, 0x04, 0x01, 0x03, 0x01, 0x07, 0x11, 0x02,
+	0x08, 0x04, 0x01, 0x03, 0x01, 0x07, 0x11, 0x02, 0x08, 0x03, 0x01, 0x03, 0x01, 0x06, 0x11, 0x03,
+	0x07, 0x04, 0x01, 0x03, 0x00, 0x07, 0x11, 0x03, 0x07, 0x03, 0x02, 0x03, 0x00, 0x07, 0x11, 0x03,
+	0x06, 0x04, 0x01, 0x03, 0x00, 0x06, 0x12, 0x02, 0x07, 0x03, 0x02, 0x03, 0x00, 0x06, 0x11, 0x03,
+	0x06, 0x04, 0x01, 0x03, 0x00, 0x06, 0x11, 0x02, 0x06, 0x04, 0x01, 0x03, 0x00, 0x06, 0x10, 0x03,
+	0x06, 0x04, 0x01, 0x03, 0x00, 0x06, 0x10, 0x03, 0x06, 0x03, 0x01, 0x03, 0x00, 0x06, 0x10, 0x02,
+	0x06, 0x04, 0x01, 0x03, 0x00, 0x06, 0x0F, 0x03, 0x06, 0x04, 0x01, 0x03, 0x00, 0x06, 0x0F, 0x03,
+	0x05, 0x04, 0x01, 0x03, 0x00, 0x06, 0x0E, 0x03, 0x06, 0x04, 0x01, 0x03, 0x01, 0x05, 0x0D, 0x04,
+	0x06, 0x03, 0x01, 0x03, 0x01, 0x05, 0x0D, 0x03, 0x06, 0x04, 0x01, 0x05, 0x01, 0x05, 0x0C, 0x03,
+	0x07, 0x04, 0x0A, 0x09, 0x18, 0x06, 0x01, 0x05, 0x02, 0x05, 0x0A, 0x04, 0x07, 0x03, 0x0A, 0x0B,
+	0x15, 0x0A, 0x01, 0x05, 0x02, 0x05, 0x09, 0x04, 0x07, 0x04, 0x08, 0x0E, 0x12, 0x0D, 0x01, 0x06,
+	0x03, 0x06, 0x06, 0x04, 0x08, 0x03, 0x08, 0x08, 0x04, 0x04, 0x10, 0x0F, 0x01, 0x06, 0x03, 0x10,
+	0x07, 0x04, 0x07, 0x07, 0x07, 0x03, 0x0F, 0x07, 0x06, 0x04, 0x01, 0x06, 0x04, 0x0E, 0x08, 0x04,
+	0x06, 0x07, 0x08, 0x04, 0x0D, 0x07, 0x08, 0x03, 0x01, 0x06, 0x05, 0x0B, 0x0A, 0x03, 0x06, 0x07,
+	0x0A, 0x03, 0x0C, 0x07, 0x09, 0x03, 0x01, 0x06, 0x06, 0x09, 0x0A, 0x04, 0x06, 0x06, 0x0B, 0x03,
+	0x0C, 0x06, 0x0B, 0x03, 0x01, 0x06, 0x09, 0x03, 0x0D, 0x03, 0x06, 0x07, 0x0B, 0x04, 0x0A, 0x06,
+	0x0C, 0x03, 0x01, 0x05, 0x18, 0x04, 0x05, 0x07, 0x0D, 0x03, 0x09, 0x07, 0x0C, 0x03, 0x01, 0x05,
+	0x18, 0x04, 0x05, 0x07, 0x0D, 0x03, 0x09, 0x06, 0x0D, 0x03, 0x01, 0x05, 0x18, 0x03, 0x05, 0x07,
+	0x0E, 0x03, 0x08, 0x07, 0x0D, 0x03, 0x01, 0x05, 0x17, 0x04, 0x05, 0x07, 0x0E, 0x03, 0x07, 0x07,
+	0x0E, 0x03, 0x01, 0x05, 0x17, 0x03, 0x05, 0x07, 0x0F, 0x03, 0x07, 0x07, 0x0F, 0x02, 0x01, 0x05,
+	0x16, 0x04, 0x05, 0x07, 0x0F, 0x03, 0x06, 0x07, 0x10, 0x02, 0x01, 0x05, 0x16, 0x04, 0x04, 0x07,
+	0x10, 0x03, 0x06, 0x07, 0x10, 0x02, 0x01, 0x05, 0x16, 0x03, 0x05, 0x07, 0x10, 0x03, 0x06, 0x06,
+	0x10, 0x03, 0x01, 0x05, 0x15, 0x04, 0x05, 0x07, 0x10, 0x03, 0x05, 0x07, 0x10, 0x03, 0x01, 0x05,
+	0x15, 0x04, 0x04, 0x07, 0x11, 0x03, 0x05, 0x07, 0x10, 0x03, 0x01, 0x05, 0x14, 0x04, 0x05, 0x07,
+	0x11, 0x02, 0x05, 0x07, 0x11, 0x03, 0x01, 0x05, 0x14, 0x04, 0x05, 0x07, 0x10, 0x03, 0x05, 0x07,
+	0x11, 0x03, 0x01, 0x05, 0x14, 0x03, 0x06, 0x06, 0x11, 0x03, 0x05, 0x07, 0x11, 0x03, 0x01, 0x05,
+	0x13, 0x04, 0x05, 0x07, 0x11, 0x03, 0x05, 0x07, 0x11, 0x03, 0x01, 0x05, 0x13, 0x04, 0x05, 0x07,
+	0x11, 0x03, 0x04, 0x07, 0x12, 0x02, 0x01, 0x05, 0x13, 0x03, 0x06, 0x07, 0x11, 0x03, 0x04, 0x07,
+	0x11, 0x03, 0x01, 0x05, 0x12, 0x04, 0x06, 0x06, 0x12, 0x02, 0x05, 0x07, 0x11, 0x03, 0x01, 0x05,
+	0x12, 0x03, 0x07, 0x06, 0x11, 0x03, 0x05, 0x07, 0x11, 0x03, 0x01, 0x05, 0x11, 0x04, 0x07, 0x06,
+	0x11, 0x03, 0x05, 0x07, 0x11, 0x02, 0x01, 0x05, 0x11, 0x04, 0x07, 0x06, 0x11, 0x02, 0x06, 0x06,
+	0x11, 0x03, 0x01, 0x05, 0x11, 0x03, 0x08, 0x06, 0x10, 0x03, 0x06, 0x06, 0x11, 0x03, 0x01, 0x05,
+	0x10, 0x04, 0x08, 0x06, 0x10, 0x03, 0x06, 0x06, 0x11, 0x02, 0x01, 0x05, 0x10, 0x03, 0x09, 0x05,
+	0x11, 0x02, 0x07, 0x06, 0x10, 0x03, 0x01, 0x05, 0x0F, 0x04, 0x09, 0x05, 0x10, 0x03, 0x07, 0x06,
+	0x10, 0x03, 0x01, 0x05, 0x0F, 0x04, 0x09, 0x05, 0x10, 0x03, 0x07, 0x06, 0x0F, 0x03, 0x01, 0x05,
+	0x0F, 0x03, 0x0A, 0x06, 0x0E, 0x03, 0x08, 0x06, 0x0F, 0x03, 0x01, 0x05, 0x0E, 0x04, 0x0A, 0x06,
+	0x0E, 0x03, 0x08, 0x06, 0x0F, 0x02, 0x01, 0x05, 0x0E, 0x03, 0x0C, 0x05, 0x0D, 0x03, 0x0A, 0x05,
+	0x0E, 0x03, 0x01, 0x05, 0x0D, 0x04, 0x0C, 0x05, 0x0C, 0x04, 0x0A, 0x06, 0x0C, 0x03, 0x01, 0x05,
+	0x0D, 0x04, 0x0C, 0x05, 0x0C, 0x03, 0x0B, 0x06, 0x0C, 0x03, 0x01, 0x05, 0x0D, 0x03, 0x0E, 0x05,
+	0x0A, 0x03, 0x0D, 0x05, 0x0B, 0x03, 0x01, 0x05, 0x0C, 0x04, 0x0E, 0x06, 0x07, 0x05, 0x0D, 0x06,
+	0x09, 0x03, 0x01, 0x05, 0x0C, 0x04, 0x0F, 0x07, 0x03, 0x06, 0x0F, 0x07, 0x05, 0x05, 0x01, 0x03,
+	0x0B, 0x04, 0x10, 0x0F, 0x10, 0x10, 0x01, 0x03, 0x0B, 0x04, 0x11, 0x0D, 0x12, 0x0E, 0x01, 0x03,
+	0x0B, 0x03, 0x14, 0x09, 0x15, 0x0B, 0x01, 0x03, 0x0A, 0x04, 0x16, 0x04, 0x1A, 0x07, 0x01, 0x01,
+	0x0A, 0x04, 0x01, 0x01, 0x0A, 0x03, 0x12, 0x00,
+	// @20032 0x8A (48 pixels wide)
+	0x01, 0x02, 0x07, 0x07, 0x14, 0x07, 0x01, 0x02, 0x08, 0x08, 0x10, 0x08, 0x01, 0x02, 0x0A, 0x08,
+	0x0C, 0x08, 0x01, 0x02, 0x0B, 0x08, 0x0A, 0x08, 0x01, 0x02, 0x0C, 0x09, 0x06, 0x09, 0x01, 0x02,
+	0x0D, 0x0A, 0x02, 0x0A, 0x01, 0x01, 0x0F, 0x12, 0x01, 0x01, 0x10, 0x10, 0x01, 0x01, 0x11, 0x0E,
+	0x01, 0x01, 0x12, 0x0C, 0x05, 0x00, 0x01, 0x02, 0x12, 0x08, 0x0F, 0x03, 0x01, 0x02, 0x0F, 0x0E,
+	0x0C, 0x03, 0x01, 0x02, 0x0D, 0x13, 0x08, 0x04, 0x01, 0x03, 0x0B, 0x09, 0x05, 0x0A, 0x05, 0x04,
+	0x01, 0x02, 0x0A, 0x07, 0x0C, 0x0F, 0x01, 0x02, 0x09, 0x06, 0x10, 0x0D, 0x01, 0x02, 0x08, 0x06,
+	0x13, 0x0B, 0x01, 0x02, 0x07, 0x06, 0x15, 0x0A, 0x01, 0x02, 0x06, 0x06, 0x17, 0x09, 0x01, 0x02,
+	0x06, 0x05, 0x19, 0x08, 0x01, 0x02, 0x05, 0x06, 0x1A, 0x07, 0x01, 0x02, 0x05, 0x05, 0x1B, 0x08,
+	0x01, 0x02, 0x04, 0x06, 0x1C, 0x07, 0x01, 0x02, 0x04, 0x06, 0x1D, 0x06, 0x01, 0x02, 0x03, 0x07,
+	0x1D, 0x06, 0x02, 0x02, 0x03, 0x06, 0x1F, 0x05, 0x01, 0x02, 0x03, 0x06, 0x20, 0x04, 0x02, 0x02,
+	0x03, 0x07, 0x1F, 0x04, 0x02, 0x02, 0x03, 0x07, 0x20, 0x03, 0x01, 0x02, 0x03, 0x08, 0x1F, 0x04,
+	0x01, 0x02, 0x03, 0x08, 0x20, 0x03, 0x01, 0x02, 0x03, 0x09, 0x1F, 0x03, 0x01, 0x02, 0x03, 0x0A,
+	0x1E, 0x03, 0x01, 0x01, 0x03, 0x0A, 0x01, 0x01, 0x04, 0x0A, 0x01, 0x01, 0x04, 0x0B, 0x01, 0x01,
+	0x04, 0x0C, 0x01, 0x01, 0x05, 0x0C, 0x01, 0x01, 0x05, 0x0D, 0x01, 0x01, 0x06, 0x0E, 0x01, 0x01,
+	0x07, 0x0E, 0x01, 0x01, 0x07, 0x0F, 0x01, 0x01, 0x08, 0x10, 0x01, 0x01, 0x09, 0x10, 0x01, 0x01,
+	0x0B, 0x10, 0x01, 0x01, 0x0C, 0x10, 0x01, 0x01, 0x0D, 0x10, 0x01, 0x01, 0x0E, 0x11, 0x01, 0x01,
+	0x10, 0x10, 0x01, 0x01, 0x11, 0x10, 0x01, 0x01, 0x13, 0x10, 0x01, 0x01, 0x14, 0x10, 0x01, 0x01,
+	0x16, 0x10, 0x01, 0x01, 0x17, 0x10, 0x01, 0x01, 0x18, 0x10, 0x01, 0x01, 0x1A, 0x0F, 0x01, 0x01,
+	0x1B, 0x0F, 0x01, 0x01, 0x1C, 0x0F, 0x01, 0x01, 0x1E, 0x0D, 0x01, 0x01, 0x1F, 0x0D, 0x01, 0x01,
+	0x20, 0x0D, 0x01, 0x01, 0x21, 0x0C, 0x01, 0x01, 0x22, 0x0C, 0x01, 0x01, 0x23, 0x0B, 0x01, 0x01,
+	0x24, 0x0B, 0x01, 0x01, 0x25, 0x0A, 0x02, 0x01, 0x26, 0x0A, 0x01, 0x02, 0x00, 0x02, 0x25, 0x09,
+	0x01, 0x02, 0x00, 0x03, 0x24, 0x09, 0x02, 0x02, 0x00, 0x03, 0x25, 0x08, 0x03, 0x02, 0x00, 0x04,
+	0x24, 0x08, 0x01, 0x02, 0x00, 0x05, 0x23, 0x08, 0x01, 0x02, 0x01, 0x04, 0x23, 0x08, 0x01, 0x02,
+	0x01, 0x05, 0x22, 0x08, 0x01, 0x02, 0x01, 0x05, 0x22, 0x07, 0x01, 0x02, 0x01, 0x06, 0x21, 0x07,
+	0x01, 0x02, 0x01, 0x07, 0x1F, 0x08, 0x01, 0x02, 0x01, 0x07, 0x1F, 0x07, 0x01, 0x02, 0x01, 0x08,
+	0x1D, 0x08, 0x01, 0x02, 0x01, 0x09, 0x1C, 0x07, 0x01, 0x02, 0x02, 0x09, 0x1A, 0x08, 0x01, 0x02,
+	0x02, 0x0A, 0x18, 0x08, 0x01, 0x02, 0x02, 0x0B, 0x16, 0x08, 0x01, 0x02, 0x02, 0x0C, 0x14, 0x08,
+	0x01, 0x02, 0x02, 0x0E, 0x10, 0x09, 0x01, 0x02, 0x02, 0x11, 0x0B, 0x0A, 0x01, 0x02, 0x02, 0x05,
+	0x06, 0x19, 0x01, 0x02, 0x03, 0x03, 0x09, 0x16, 0x01, 0x02, 0x03, 0x03, 0x0C, 0x10, 0x01, 0x02,
+	0x03, 0x02, 0x10, 0x09, 0x0F, 0x00,
+	// @20502 0x8B (23 pixels wide)
+	0x2D, 0x00, 0x01, 0x01, 0x16, 0x01, 0x01, 0x01, 0x15, 0x02, 0x01, 0x01, 0x14, 0x02, 0x01, 0x01,
+	0x13, 0x03, 0x01, 0x01, 0x12, 0x03, 0x01, 0x01, 0x11, 0x04, 0x01, 0x01, 0x10, 0x04, 0x01, 0x01,
+	0x0F, 0x04, 0x01, 0x01, 0x0E, 0x05, 0x01, 0x01, 0x0D, 0x05, 0x01, 0x01, 0x0C, 0x05, 0x01, 0x01,
+	0x0B, 0x06, 0x01, 0x01, 0x0A, 0x06, 0x01, 0x01, 0x09, 0x06, 0x01, 0x01, 0x08, 0x07, 0x01, 0x01,
+	0x08, 0x06, 0x01, 0x01, 0x07, 0x06, 0x01, 0x01, 0x06, 0x07, 0x01, 0x01, 0x05, 0x07, 0x01, 0x01,
+	0x04, 0x07, 0x01, 0x01, 0x03, 0x07, 0x01, 0x01, 0x02, 0x08, 0x01, 0x01, 0x01, 0x08, 0x01, 0x01,
+	0x00, 0x09, 0x01, 0x01, 0x01, 0x09, 0x01, 0x01, 0x02, 0x08, 0x01, 0x01, 0x03, 0x08, 0x01, 0x01,
+	0x04, 0x08, 0x01, 0x01, 0x05, 0x07, 0x01, 0x01, 0x06, 0x07, 0x01, 0x01, 0x07, 0x07, 0x01, 0x01,
+	0x08, 0x06, 0x01, 0x01, 0x09, 0x06, 0x01, 0x01, 0x0A, 0x06, 0x01, 0x01, 0x0B, 0x05, 0x01, 0x01,
+	0x0C, 0x05, 0x01, 0x01, 0x0D, 0x05, 0x01, 0x01, 0x0E, 0x04, 0x01, 0x01, 0x0E, 0x05, 0x01, 0x01,
+	0x0F, 0x05, 0x01, 0x01, 0x10, 0x04, 0x01, 0x01, 0x11, 0x04, 0x01, 0x01, 0x12, 0x03, 0x01, 0x01,
+	0x13, 0x03, 0x01, 0x01, 0x14, 0x03, 0x01, 0x01, 0x15, 0x02, 0x01, 0x01, 0x16, 0x01, 0x19, 0x00,
+	// @20694 0x8C (105 pixels wide)
+	0x0E, 0x00, 0x01, 0x01, 0x1E, 0x07, 0x01, 0x01, 0x19, 0x12, 0x01, 0x01, 0x16, 0x4E, 0x01, 0x01,
+	0x14, 0x50, 0x01, 0x02, 0x12, 0x0B, 0x0C, 0x3B, 0x01, 0x02, 0x10, 0x09, 0x13, 0x38, 0x01, 0x03,
+	0x0F, 0x07, 0x18, 0x0D, 0x1E, 0x0B, 0x01, 0x03, 0x0E, 0x06, 0x1B, 0x0C, 0x21, 0x08, 0x01, 0x03,
+	0x0C, 0x06, 0x1F, 0x0A, 0x23, 0x06, 0x01, 0x03, 0x0B, 0x06, 0x21, 0x09, 0x23, 0x06, 0x01, 0x03,
+	0x0B, 0x05, 0x23, 0x08, 0x24, 0x05, 0x01, 0x03, 0x0A, 0x05, 0x25, 0x07, 0x25, 0x04, 0x01, 0x03,
+	0x09, 0x05, 0x26, 0x07, 0x25, 0x04, 0x01, 0x03, 0x08, 0x05, 0x28, 0x06, 0x25, 0x04, 0x02, 0x03,
+	0x07, 0x05, 0x29, 0x06, 0x26, 0x03, 0x01, 0x03, 0x06, 0x06, 0x29, 0x06, 0x26, 0x03, 0x01, 0x03,
+	0x06, 0x05, 0x2A, 0x06, 0x26, 0x03, 0x01, 0x03, 0x05, 0x06, 0x2A, 0x06, 0x26, 0x03, 0x01, 0x02,
+	0x05, 0x06, 0x2A, 0x06, 0x02, 0x02, 0x04, 0x06, 0x2B, 0x06, 0x02, 0x02, 0x03, 0x07, 0x2B, 0x06,
+	0x01, 0x02, 0x03, 0x06, 0x2C, 0x06, 0x02, 0x02, 0x02, 0x07, 0x2C, 0x06, 0x02, 0x03, 0x02, 0x07,
+	0x2C, 0x06, 0x20, 0x02, 0x01, 0x03, 0x01, 0x08, 0x2C, 0x06, 0x20, 0x02, 0x04, 0x03, 0x01, 0x08,
+	0x2C, 0x06, 0x1F, 0x03, 0x02, 0x03, 0x01, 0x08, 0x2C, 0x06, 0x1E, 0x04, 0x01, 0x03, 0x00, 0x09,
+	0x2C, 0x06, 0x1D, 0x05, 0x01, 0x03, 0x00, 0x09, 0x2C, 0x06, 0x1C, 0x06, 0x01, 0x03, 0x00, 0x08,
+	0x2D, 0x06, 0x19, 0x09, 0x05, 0x02, 0x00, 0x08, 0x2D, 0x28, 0x01, 0x03, 0x00, 0x08, 0x2D, 0x06,
+	0x1A, 0x08, 0x02, 0x03, 0x00, 0x08, 0x2D, 0x06, 0x1D, 0x05, 0x01, 0x03, 0x00, 0x08, 0x2D, 0x06,
+	0x1E, 0x04, 0x01, 0x03, 0x00, 0x09, 0x2C, 0x06, 0x1E, 0x04, 0x03, 0x03, 0x00, 0x09, 0x2C, 0x06,
+	0x1F, 0x03, 0x04, 0x03, 0x01, 0x08, 0x2C, 0x06, 0x20, 0x02, 0x01, 0x02, 0x01, 0x08, 0x2C, 0x06,
+	0x02, 0x02, 0x01, 0x09, 0x2B, 0x06, 0x02, 0x02, 0x02, 0x08, 0x2B, 0x06, 0x02, 0x02, 0x02, 0x09,
+	0x2A, 0x06, 0x01, 0x02, 0x03, 0x08, 0x2A, 0x06, 0x01, 0x02, 0x03, 0x09, 0x29, 0x06, 0x01, 0x03,
+	0x03, 0x09, 0x29, 0x06, 0x2C, 0x02, 0x01, 0x03, 0x04, 0x08, 0x29, 0x06, 0x2B, 0x03, 0x01, 0x03,
+	0x04, 0x09, 0x28, 0x06, 0x2B, 0x03, 0x01, 0x03, 0x05, 0x08, 0x28, 0x06, 0x2A, 0x03, 0x01, 0x03,
+	0x05, 0x09, 0x27, 0x06, 0x2A, 0x03, 0x02, 0x03, 0x06, 0x09, 0x26, 0x06, 0x29, 0x04, 0x01, 0x03,
+	0x07, 0x09, 0x25, 0x06, 0x28, 0x05, 0x01, 0x03, 0x07, 0x0A, 0x24, 0x07, 0x27, 0x04, 0x01, 0x03,
+	0x08, 0x0A, 0x22, 0x08, 0x26, 0x05, 0x01, 0x03, 0x09, 0x0A, 0x21, 0x08, 0x25, 0x06, 0x01, 0x03,
+	0x0A, 0x0A, 0x20, 0x09, 0x23, 0x07, 0x01, 0x03, 0x0B, 0x0A, 0x1F, 0x09, 0x22, 0x07, 0x01, 0x03,
+	0x0B, 0x0B, 0x1D, 0x0B, 0x20, 0x08, 0x01, 0x03, 0x0C, 0x0C, 0x19, 0x0F, 0x1C, 0x0A, 0x01, 0x03,
+	0x0E, 0x0C, 0x15, 0x14, 0x16, 0x0D, 0x01, 0x03, 0x0F, 0x0D, 0x10, 0x1F, 0x06, 0x14, 0x01, 0x02,
+	0x10, 0x11, 0x06, 0x3E, 0x01, 0x01, 0x12, 0x53, 0x01, 0x01, 0x14, 0x51, 0x01, 0x01, 0x17, 0x15,
+	0x01, 0x01, 0x1A, 0x0E, 0x10, 0x00,
+	// @21148 0x8D (2 pixels wide)
+	0x75, 0x00,
+	// @21150 0x8E (2 pixels wide)
+	0x75, 0x00,
+	// @21152 0x8F (2 pixels wide)
+	0x75, 0x00,
+	// @21154 0x90 (2 pixels wide)
+	0x75, 0x00,
+	// @21156 0x91 (14 pixels wide)
+	0x0C, 0x00, 0x01, 0x01, 0x0A, 0x02, 0x01, 0x01, 0x09, 0x02, 0x01, 0x01, 0x08, 0x02, 0x01, 0x01,
+	0x07, 0x02, 0x01, 0x01, 0x06, 0x02, 0x01, 0x01, 0x05, 0x02, 0x01, 0x01, 0x04, 0x02, 0x02, 0x01,
+	0x03, 0x02, 0x02, 0x01, 0x02, 0x02, 0x03, 0x01, 0x01, 0x02, 0x03, 0x01, 0x00, 0x03, 0x01, 0x02,
+	0x00, 0x04, 0x02, 0x04, 0x01, 0x01, 0x00, 0x0C, 0x01, 0x01, 0x00, 0x0D, 0x03, 0x01, 0x00, 0x0E,
+	0x03, 0x01, 0x01, 0x0D, 0x01, 0x01, 0x02, 0x0C, 0x01, 0x01, 0x03, 0x0A, 0x01, 0x01, 0x04, 0x09,
+	0x01, 0x01, 0x06, 0x05, 0x4B, 0x00,
+	// @21242 0x92 (14 pixels wide)
+	0x0C, 0x00, 0x01, 0x01, 0x02, 0x07, 0x01, 0x01, 0x01, 0x0A, 0x01, 0x01, 0x01, 0x0B, 0x01, 0x01,
+	0x00, 0x0C, 0x02, 0x01, 0x00, 0x0D, 0x04, 0x01, 0x00, 0x0E, 0x01, 0x01, 0x01, 0x0D, 0x01, 0x01,
+	0x02, 0x0C, 0x01, 0x01, 0x0A, 0x04, 0x03, 0x01, 0x0B, 0x03, 0x02, 0x01, 0x0B, 0x02, 0x01, 0x01,
+	0x0A, 0x03, 0x02, 0x01, 0x0A, 0x02, 0x01, 0x01, 0x09, 0x02, 0x02, 0x01, 0x08, 0x02, 0x01, 0x01,
+	0x07, 0x02, 0x01, 0x01, 0x06, 0x02, 0x01, 0x01, 0x05, 0x02, 0x01, 0x01, 0x04, 0x02, 0x01, 0x01,
+	0x03, 0x02, 0x01, 0x01, 0x02, 0x02, 0x4B, 0x00,
+	// @21330 0x93 (40 pixels wide)
+	0x0C, 0x00, 0x01, 0x02, 0x0A, 0x02, 0x18, 0x02, 0x01, 0x02, 0x09, 0x02, 0x18, 0x02, 0x01, 0x02,
+	0x08, 0x02, 0x18, 0x02, 0x01, 0x02, 0x07, 0x02, 0x18, 0x02, 0x01, 0x02, 0x06, 0x02, 0x18, 0x02,
+	0x01, 0x02, 0x05, 0x02, 0x18, 0x02, 0x01, 0x02, 0x04, 0x02, 0x18, 0x02, 0x01, 0x02, 0x03, 0x02,
+	0x19, 0x02, 0x01, 0x02, 0x03, 0x02, 0x18, 0x02, 0x02, 0x02, 0x02, 0x02, 0x18, 0x02, 0x01, 0x02,
+	0x01, 0x02, 0x19, 0x02, 0x02, 0x02, 0x01, 0x02, 0x18, 0x02, 0x01, 0x02, 0x00, 0x03, 0x18, 0x02,
+	0x02, 0x02, 0x00, 0x03, 0x17, 0x03, 0x01, 0x04, 0x00, 0x04, 0x02, 0x04, 0x10, 0x04, 0x03, 0x03,
+	0x01, 0x02, 0x00, 0x0C, 0x0E, 0x0D, 0x01, 0x02, 0x00, 0x0D, 0x0D, 0x0D, 0x02, 0x02, 0x00, 0x0E,
+	0x0C, 0x0E, 0x01, 0x02, 0x00, 0x0E, 0x0D, 0x0D, 0x02, 0x02, 0x01, 0x0D, 0x0D, 0x0D, 0x01, 0x02,
+	0x01, 0x0D, 0x0E, 0x0C, 0x01, 0x02, 0x02, 0x0C, 0x0E, 0x0C, 0x01, 0x02, 0x03, 0x0A, 0x10, 0x0B,
+	0x01, 0x02, 0x04, 0x09, 0x11, 0x09, 0x01, 0x02, 0x06, 0x05, 0x15, 0x05, 0x4B, 0x00,
+	// @21488 0x94 (40 pixels wide)
+	0x0C, 0x00, 0x01, 0x02, 0x02, 0x07, 0x13, 0x07, 0x01, 0x02, 0x01, 0x0A, 0x10, 0x0A, 0x01, 0x02,
+	0x01, 0x0B, 0x0F, 0x0B, 0x01, 0x02, 0x00, 0x0C, 0x0E, 0x0D, 0x02, 0x02, 0x00, 0x0D, 0x0D, 0x0D,
+	0x04, 0x02, 0x00, 0x0E, 0x0C, 0x0E, 0x01, 0x02, 0x01, 0x0D, 0x0D, 0x0D, 0x01, 0x02, 0x02, 0x0C,
+	0x0E, 0x0C, 0x01, 0x02, 0x0A, 0x04, 0x17, 0x03, 0x03, 0x02, 0x0B, 0x03, 0x17, 0x03, 0x01, 0x02,
+	0x0B, 0x02, 0x18, 0x03, 0x01, 0x02, 0x0B, 0x02, 0x18, 0x02, 0x01, 0x02, 0x0A, 0x03, 0x18, 0x02,
+	0x02, 0x02, 0x0A, 0x02, 0x18, 0x02, 0x01, 0x02, 0x09, 0x02, 0x18, 0x02, 0x01, 0x02, 0x08, 0x02,
+	0x19, 0x02, 0x01, 0x02, 0x08, 0x02, 0x18, 0x02, 0x01, 0x02, 0x07, 0x02, 0x18, 0x02, 0x01, 0x02,
+	0x06, 0x02, 0x18, 0x02, 0x01, 0x02, 0x05, 0x02, 0x18, 0x02, 0x01, 0x02, 0x04, 0x02, 0x18, 0x02,
+	0x01, 0x02, 0x03, 0x02, 0x18, 0x02, 0x01, 0x02, 0x02, 0x02, 0x19, 0x01, 0x4B, 0x00,
+	// @21630 0x95 (2 pixels wide)
+	0x75, 0x00,
+	// @21632 0x96 (36 pixels wide)
+	0x34, 0x00, 0x05, 0x01, 0x00, 0x24, 0x3C, 0x00,
+	// @21640 0x97 (104 pixels wide)
+	0x35, 0x00, 0x04, 0x01, 0x00, 0x68, 0x3C, 0x00,
+	// @21648 0x98 (32 pixels wide)
+	0x03, 0x00, 0x01, 0x02, 0x05, 0x06, 0x12, 0x01, 0x01, 0x02, 0x03, 0x0A, 0x10, 0x02, 0x01, 0x02,
+	0x02, 0x0D, 0x0D, 0x03, 0x01, 0x02, 0x01, 0x10, 0x0A, 0x05, 0x01, 0x02, 0x01, 0x12, 0x07, 0x05,
+	0x01, 0x03, 0x00, 0x05, 0x07, 0x09, 0x04, 0x06, 0x01, 0x02, 0x00, 0x04, 0x0A, 0x10, 0x01, 0x02,
+	0x00, 0x03, 0x0C, 0x0E, 0x01, 0x02, 0x00, 0x03, 0x0E, 0x0B, 0x01, 0x02, 0x01, 0x01, 0x10, 0x09,
+	0x01, 0x01, 0x14, 0x06, 0x67, 0x00,
+	// @21718 0x99 (101 pixels wide)
+	0x0D, 0x00, 0x01, 0x03, 0x00, 0x24, 0x07, 0x0B, 0x23, 0x0C, 0x01, 0x03, 0x00, 0x24, 0x07, 0x0B,
+	0x22, 0x0D, 0x01, 0x03, 0x00, 0x24, 0x08, 0x0B, 0x21, 0x0A, 0x01, 0x05, 0x00, 0x06, 0x0A, 0x04,
+	0x0A, 0x06, 0x0B, 0x08, 0x20, 0x09, 0x01, 0x05, 0x00, 0x04, 0x0C, 0x04, 0x0B, 0x05, 0x0C, 0x08,
+	0x1F, 0x08, 0x01, 0x05, 0x00, 0x03, 0x0D, 0x04, 0x0C, 0x04, 0x0C, 0x08, 0x1E, 0x08, 0x01, 0x05,
+	0x00, 0x02, 0x0E, 0x04, 0x0D, 0x03, 0x0D, 0x07, 0x1E, 0x08, 0x01, 0x05, 0x00, 0x02, 0x0E, 0x04,
+	0x0E, 0x02, 0x0D, 0x08, 0x1D, 0x08, 0x01, 0x06, 0x00, 0x02, 0x0E, 0x04, 0x0E, 0x02, 0x0D, 0x08,
+	0x1C, 0x03, 0x01, 0x04, 0x01, 0x07, 0x00, 0x01, 0x0F, 0x04, 0x0E, 0x02, 0x0D, 0x02, 0x01, 0x06,
+	0x1B, 0x03, 0x01, 0x04, 0x01, 0x05, 0x10, 0x04, 0x1D, 0x02, 0x02, 0x05, 0x1A, 0x03, 0x02, 0x04,
+	0x01, 0x05, 0x10, 0x04, 0x1D, 0x02, 0x02, 0x06, 0x19, 0x03, 0x02, 0x04, 0x02, 0x05, 0x10, 0x04,
+	0x1D, 0x02, 0x03, 0x05, 0x18, 0x03, 0x03, 0x04, 0x01, 0x05, 0x10, 0x04, 0x1D, 0x02, 0x04, 0x05,
+	0x17, 0x03, 0x03, 0x04, 0x01, 0x05, 0x10, 0x04, 0x1D, 0x02, 0x04, 0x05, 0x16, 0x03, 0x04, 0x04,
+	0x01, 0x05, 0x10, 0x04, 0x1D, 0x02, 0x04, 0x06, 0x15, 0x03, 0x04, 0x04, 0x01, 0x05, 0x10, 0x04,
+	0x1D, 0x02, 0x05, 0x05, 0x14, 0x03, 0x05, 0x04, 0x01, 0x05, 0x10, 0x04, 0x1D, 0x02, 0x05, 0x06,
+	0x13, 0x03, 0x05, 0x04, 0x01, 0x05, 0x10, 0x04, 0x1D, 0x02, 0x06, 0x05, 0x12, 0x03, 0x06, 0x04,
+	0x02, 0x05, 0x10, 0x04, 0x1D, 0x02, 0x06, 0x06, 0x11, 0x03, 0x06, 0x04, 0x01, 0x05, 0x10, 0x04,
+	0x1D, 0x02, 0x07, 0x05, 0x10, 0x03, 0x07, 0x04, 0x01, 0x05, 0x10, 0x04, 0x1D, 0x02, 0x07, 0x06,
+	0x0F, 0x03, 0x07, 0x04, 0x01, 0x05, 0x10, 0x04, 0x1D, 0x02, 0x08, 0x05, 0x0E, 0x03, 0x08, 0x04,
+	0x01, 0x05, 0x10, 0x04, 0x1D, 0x02, 0x08, 0x06, 0x0D, 0x03, 0x08, 0x04, 0x01, 0x05, 0x10, 0x04,
+	0x1D, 0x02, 0x09, 0x05, 0x0C, 0x03, 0x09, 0x04, 0x02, 0x05, 0x10, 0x04, 0x1D, 0x02, 0x09, 0x06,
+	0x0B, 0x03, 0x09, 0x04, 0x01, 0x05, 0x10, 0x04, 0x1D, 0x02, 0x0A, 0x05, 0x0A, 0x03, 0x0A, 0x04,
+	0x01, 0x05, 0x10, 0x04, 0x1D, 0x02, 0x0A, 0x06, 0x09, 0x03, 0x0A, 0x04, 0x01, 0x05, 0x10, 0x04,
+	0x1D, 0x02, 0x0B, 0x05, 0x08, 0x03, 0x0B, 0x04, 0x01, 0x05, 0x10, 0x04, 0x1D, 0x02, 0x0B, 0x06,
+	0x07, 0x03, 0x0B, 0x04, 0x01, 0x05, 0x10, 0x04, 0x1D, 0x02, 0x0B, 0x06, 0x06, 0x04, 0x0B, 0x04,
+	0x02, 0x05, 0x10, 0x04, 0x1D, 0x02, 0x0C, 0x06, 0x05, 0x03, 0x0C, 0x04, 0x02, 0x05, 0x10, 0x04,
+	0x1D, 0x02, 0x0D, 0x06, 0x03, 0x03, 0x0D, 0x04, 0x01, 0x05, 0x10, 0x04, 0x1D, 0x02, 0x0E, 0x05,
+	0x02, 0x03, 0x0E, 0x04, 0x01, 0x05, 0x10, 0x04, 0x1D, 0x02, 0x0E, 0x06, 0x01, 0x03, 0x0E, 0x04,
+	0x01, 0x04, 0x10, 0x04, 0x1D, 0x02, 0x0E, 0x0A, 0x0E, 0x04, 0x02, 0x04, 0x10, 0x04, 0x1D, 0x02,
+	0x0F, 0x08, 0x0F, 0x04, 0x01, 0x04, 0x0F, 0x05, 0x1D, 0x03, 0x0F, 0x06, 0x10, 0x04, 0x01, 0x04,
+	0x0F, 0x05, 0x1D, 0x03, 0x0F, 0x06, 0x10, 0x05, 0x01, 0x04, 0x0F, 0x06, 0x1B, 0x04, 0x0F, 0x06,
+	0x10, 0x05, 0x01, 0x04, 0x0F, 0x06, 0x1B, 0x05, 0x0F, 0x04, 0x10, 0x06, 0x01, 0x04, 0x0E, 0x08,
+	0x19, 0x07, 0x0E, 0x04, 0x0F, 0x08, 0x01, 0x04, 0x0C, 0x0C, 0x16, 0x0A, 0x0D, 0x02, 0x0E, 0x0C,
+	0x01, 0x04, 0x09, 0x12, 0x11, 0x0E, 0x0B, 0x02, 0x0C, 0x11, 0x01, 0x03, 0x09, 0x12, 0x11, 0x0E,
+	0x19, 0x11, 0x35, 0x00,
+	// @22234 0x9A (34 pixels wide)
+	0x19, 0x00, 0x01, 0x02, 0x00, 0x07, 0x14, 0x07, 0x01, 0x02, 0x02, 0x07, 0x10, 0x08, 0x01, 0x02,
+	0x03, 0x08, 0x0C, 0x08, 0x01, 0x02, 0x04, 0x09, 0x09, 0x08, 0x01, 0x02, 0x05, 0x09, 0x06, 0x09,
+	0x01, 0x02, 0x07, 0x09, 0x02, 0x0A, 0x01, 0x01, 0x08, 0x12, 0x01, 0x01, 0x09, 0x10, 0x01, 0x01,
+	0x0A, 0x0E, 0x01, 0x01, 0x0C, 0x0A, 0x08, 0x00, 0x01, 0x01, 0x0B, 0x09, 0x01, 0x02, 0x09, 0x0E,
+	0x04, 0x02, 0x01, 0x03, 0x07, 0x07, 0x05, 0x06, 0x02, 0x02, 0x01, 0x02, 0x06, 0x05, 0x0B, 0x07,
+	0x01, 0x02, 0x05, 0x04, 0x0E, 0x06, 0x01, 0x02, 0x04, 0x04, 0x10, 0x05, 0x01, 0x02, 0x03, 0x05,
+	0x11, 0x04, 0x01, 0x02, 0x03, 0x04, 0x12, 0x04, 0x03, 0x02, 0x02, 0x04, 0x14, 0x03, 0x04, 0x02,
+	0x01, 0x05, 0x15, 0x03, 0x02, 0x02, 0x01, 0x06, 0x15, 0x02, 0x01, 0x01, 0x01, 0x07, 0x01, 0x01,
+	0x01, 0x08, 0x01, 0x01, 0x02, 0x08, 0x01, 0x01, 0x02, 0x09, 0x01, 0x01, 0x02, 0x0A, 0x01, 0x01,
+	0x03, 0x0B, 0x01, 0x01, 0x04, 0x0B, 0x01, 0x01, 0x05, 0x0C, 0x01, 0x01, 0x06, 0x0C, 0x01, 0x01,
+	0x07, 0x0D, 0x01, 0x01, 0x08, 0x0D, 0x01, 0x01, 0x0A, 0x0D, 0x01, 0x01, 0x0B, 0x0D, 0x01, 0x01,
+	0x0D, 0x0D, 0x01, 0x01, 0x0E, 0x0D, 0x01, 0x01, 0x10, 0x0C, 0x01, 0x01, 0x11, 0x0C, 0x01, 0x01,
+	0x12, 0x0C, 0x01, 0x01, 0x14, 0x0B, 0x01, 0x01, 0x15, 0x0B, 0x01, 0x01, 0x17, 0x09, 0x01, 0x01,
+	0x18, 0x09, 0x01, 0x01, 0x19, 0x08, 0x02, 0x02, 0x01, 0x02, 0x17, 0x07, 0x01, 0x02, 0x01, 0x02,
+	0x18, 0x06, 0x02, 0x02, 0x01, 0x03, 0x17, 0x06, 0x01, 0x02, 0x01, 0x03, 0x18, 0x05, 0x03, 0x02,
+	0x01, 0x04, 0x17, 0x05, 0x02, 0x02, 0x01, 0x05, 0x15, 0x05, 0x01, 0x02, 0x01, 0x06, 0x14, 0x04,
+	0x01, 0x02, 0x01, 0x07, 0x12, 0x05, 0x01, 0x02, 0x01, 0x08, 0x10, 0x05, 0x01, 0x02, 0x01, 0x09,
+	0x0E, 0x05, 0x01, 0x02, 0x01, 0x0C, 0x08, 0x07, 0x01, 0x02, 0x01, 0x02, 0x04, 0x13, 0x01, 0x02,
+	0x01, 0x02, 0x07, 0x0E, 0x01, 0x01, 0x0E, 0x07, 0x0F, 0x00,
+	// @22532 0x9B (23 pixels wide)
+	0x2D, 0x00, 0x01, 0x01, 0x00, 0x01, 0x01, 0x01, 0x00, 0x02, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01,
+	0x01, 0x03, 0x01, 0x01, 0x02, 0x03, 0x01, 0x01, 0x02, 0x04, 0x01, 0x01, 0x03, 0x04, 0x01, 0x01,
+	0x04, 0x04, 0x01, 0x01, 0x04, 0x05, 0x01, 0x01, 0x05, 0x05, 0x01, 0x01, 0x06, 0x04, 0x01, 0x01,
+	0x06, 0x05, 0x01, 0x01, 0x07, 0x05, 0x01, 0x01, 0x08, 0x05, 0x01, 0x01, 0x08, 0x06, 0x01, 0x01,
+	0x09, 0x06, 0x01, 0x01, 0x0A, 0x06, 0x01, 0x01, 0x0A, 0x07, 0x01, 0x01, 0x0B, 0x07, 0x01, 0x01,
+	0x0C, 0x07, 0x01, 0x01, 0x0C, 0x08, 0x01, 0x01, 0x0D, 0x08, 0x01, 0x01, 0x0E, 0x08, 0x01, 0x01,
+	0x0E, 0x09, 0x01, 0x01, 0x0D, 0x09, 0x01, 0x01, 0x0D, 0x08, 0x01, 0x01, 0x0C, 0x08, 0x01, 0x01,
+	0x0B, 0x08, 0x01, 0x01, 0x0B, 0x07, 0x01, 0x01, 0x0A, 0x07, 0x01, 0x01, 0x09, 0x07, 0x01, 0x01,
+	0x09, 0x06, 0x01, 0x01, 0x08, 0x06, 0x01, 0x01, 0x07, 0x06, 0x01, 0x01, 0x07, 0x05, 0x01, 0x01,
+	0x06, 0x05, 0x01, 0x01, 0x05, 0x05, 0x01, 0x01, 0x05, 0x04, 0x01, 0x01, 0x04, 0x05, 0x01, 0x01,
+	0x03, 0x05, 0x01, 0x01, 0x03, 0x04, 0x01, 0x01, 0x02, 0x04, 0x01, 0x01, 0x02, 0x03, 0x01, 0x01,
+	0x01, 0x03, 0x01, 0x01, 0x00, 0x03, 0x01, 0x01, 0x00, 0x02, 0x01, 0x01, 0x00, 0x01, 0x19, 0x00,
+	// @22724 0x9C (63 pixels wide)
+	0x25, 0x00, 0x01, 0x02, 0x0E, 0x07, 0x1A, 0x02, 0x01, 0x02, 0x0B, 0x0D, 0x13, 0x0A, 0x01, 0x02,
+	0x0A, 0x0F, 0x10, 0x0D, 0x01, 0x03, 0x09, 0x07, 0x04, 0x07, 0x0D, 0x0F, 0x01, 0x03, 0x08, 0x06,
+	0x07, 0x06, 0x0C, 0x11, 0x01, 0x04, 0x07, 0x06, 0x0A, 0x05, 0x0A, 0x07, 0x04, 0x08, 0x01, 0x04,
+	0x06, 0x06, 0x0B, 0x06, 0x08, 0x06, 0x08, 0x07, 0x01, 0x04, 0x05, 0x06, 0x0D, 0x06, 0x07, 0x05,
+	0x0A, 0x06, 0x01, 0x04, 0x05, 0x05, 0x0F, 0x05, 0x06, 0x05, 0x0C, 0x06, 0x01, 0x04, 0x04, 0x06,
+	0x0F, 0x06, 0x05, 0x05, 0x0D, 0x05, 0x01, 0x04, 0x04, 0x05, 0x11, 0x05, 0x04, 0x05, 0x0E, 0x06,
+	0x01, 0x04, 0x03, 0x06, 0x11, 0x06, 0x03, 0x05, 0x0F, 0x05, 0x01, 0x04, 0x03, 0x05, 0x13, 0x05,
+	0x02, 0x05, 0x10, 0x05, 0x01, 0x04, 0x02, 0x06, 0x13, 0x05, 0x02, 0x05, 0x10, 0x05, 0x01, 0x04,
+	0x02, 0x06, 0x13, 0x06, 0x01, 0x04, 0x11, 0x06, 0x01, 0x03, 0x02, 0x05, 0x15, 0x0A, 0x12, 0x05,
+	0x02, 0x03, 0x01, 0x06, 0x15, 0x0A, 0x12, 0x05, 0x01, 0x03, 0x01, 0x05, 0x16, 0x09, 0x13, 0x05,
+	0x01, 0x02, 0x01, 0x05, 0x16, 0x21, 0x03, 0x02, 0x00, 0x06, 0x17, 0x21, 0x01, 0x02, 0x00, 0x06,
+	0x17, 0x07, 0x06, 0x02, 0x00, 0x05, 0x18, 0x07, 0x06, 0x02, 0x00, 0x05, 0x18, 0x08, 0x02, 0x02,
+	0x00, 0x06, 0x17, 0x08, 0x01, 0x02, 0x00, 0x06, 0x17, 0x09, 0x01, 0x03, 0x01, 0x05, 0x16, 0x0A,
+	0x16, 0x03, 0x01, 0x03, 0x01, 0x05, 0x16, 0x0A, 0x16, 0x02, 0x01, 0x03, 0x01, 0x05, 0x16, 0x0A,
+	0x15, 0x03, 0x02, 0x03, 0x01, 0x06, 0x15, 0x0B, 0x14, 0x03, 0x01, 0x04, 0x02, 0x05, 0x14, 0x05,
+	0x01, 0x06, 0x13, 0x03, 0x01, 0x04, 0x02, 0x05, 0x14, 0x05, 0x01, 0x07, 0x12, 0x03, 0x01, 0x04,
+	0x02, 0x06, 0x13, 0x05, 0x01, 0x07, 0x11, 0x04, 0x01, 0x04, 0x03, 0x05, 0x12, 0x05, 0x02, 0x08,
+	0x10, 0x03, 0x01, 0x04, 0x03, 0x06, 0x11, 0x05, 0x03, 0x07, 0x0F, 0x04, 0x01, 0x04, 0x04, 0x05,
+	0x10, 0x05, 0x04, 0x08, 0x0D, 0x04, 0x01, 0x04, 0x04, 0x06, 0x0F, 0x05, 0x04, 0x09, 0x0B, 0x05,
+	0x01, 0x04, 0x05, 0x05, 0x0E, 0x05, 0x06, 0x09, 0x09, 0x05, 0x01, 0x04, 0x05, 0x06, 0x0D, 0x05,
+	0x06, 0x0B, 0x04, 0x08, 0x01, 0x03, 0x06, 0x06, 0x0B, 0x05, 0x08, 0x15, 0x01, 0x03, 0x07, 0x06,
+	0x09, 0x05, 0x09, 0x15, 0x01, 0x03, 0x08, 0x06, 0x07, 0x06, 0x0A, 0x13, 0x01, 0x03, 0x09, 0x08,
+	0x01, 0x08, 0x0C, 0x11, 0x01, 0x02, 0x0A, 0x0E, 0x0F, 0x0F, 0x01, 0x02, 0x0C, 0x0B, 0x11, 0x0C,
+	0x01, 0x02, 0x0F, 0x05, 0x16, 0x08, 0x14, 0x00,
+	// @23100 0x9D (2 pixels wide)
+	0x75, 0x00,
+	// @23102 0x9E (2 pixels wide)
+	0x75, 0x00,
+	// @23104 0x9F (74 pixels wide)
+	0x02, 0x02, 0x11, 0x0A, 0x13, 0x0A, 0x02, 0x02, 0x11, 0x0B, 0x12, 0x0B, 0x02, 0x02, 0x11, 0x0A,
+	0x13, 0x0A, 0x01, 0x02, 0x12, 0x08, 0x15, 0x08, 0x01, 0x02, 0x13, 0x06, 0x17, 0x06, 0x06, 0x00,
+	0x02, 0x02, 0x00, 0x1D, 0x16, 0x17, 0x01, 0x02, 0x05, 0x15, 0x1C, 0x10, 0x01, 0x02, 0x07, 0x0F,
+	0x23, 0x0B, 0x01, 0x02, 0x08, 0x0D, 0x24, 0x09, 0x01, 0x02, 0x09, 0x0B, 0x26, 0x07, 0x01, 0x02,
+	0x0A, 0x0A, 0x26, 0x06, 0x01, 0x02, 0x0B, 0x09, 0x26, 0x06, 0x01, 0x02, 0x0B, 0x0A, 0x24, 0x06,
+	0x01, 0x02, 0x0C, 0x09, 0x24, 0x05, 0x01, 0x02, 0x0D, 0x09, 0x22, 0x06, 0x01, 0x02, 0x0D, 0x09,
+	0x22, 0x05, 0x01, 0x02, 0x0E, 0x09, 0x20, 0x05, 0x01, 0x02, 0x0F, 0x08, 0x20, 0x05, 0x01, 0x02,
+	0x0F, 0x09, 0x1E, 0x05, 0x01, 0x02, 0x10, 0x08, 0x1D, 0x05, 0x01, 0x02, 0x11, 0x08, 0x1C, 0x05,
+	0x01, 0x02, 0x11, 0x09, 0x1A, 0x05, 0x01, 0x02, 0x12, 0x08, 0x1A, 0x05, 0x01, 0x02, 0x12, 0x09,
+	0x18, 0x05, 0x01, 0x02, 0x13, 0x09, 0x17, 0x04, 0x01, 0x02, 0x14, 0x08, 0x16, 0x05, 0x01, 0x02,
+	0x14, 0x09, 0x14, 0x05, 0x01, 0x02, 0x15, 0x08, 0x14, 0x05, 0x01, 0x02, 0x15, 0x09, 0x12, 0x05,
+	0x01, 0x02, 0x16, 0x09, 0x11, 0x04, 0x01, 0x02, 0x16, 0x09, 0x10, 0x05, 0x01, 0x02, 0x17, 0x09,
+	0x0E, 0x05, 0x01, 0x02, 0x18, 0x08, 0x0E, 0x05, 0x01, 0x02, 0x18, 0x09, 0x0C, 0x05, 0x01, 0x02,
+	0x19, 0x09, 0x0B, 0x04, 0x01, 0x02, 0x19, 0x09, 0x0A, 0x05, 0x01, 0x02, 0x1A, 0x09, 0x08, 0x05,
+	0x01, 0x02, 0x1B, 0x08, 0x08, 0x05, 0x01, 0x02, 0x1B, 0x09, 0x06, 0x05, 0x01, 0x02, 0x1C, 0x09,
+	0x05, 0x04, 0x01, 0x02, 0x1C, 0x09, 0x04, 0x05, 0x01, 0x02, 0x1D, 0x09, 0x02, 0x05, 0x01, 0x02,
+	0x1D, 0x09, 0x02, 0x04, 0x01, 0x01, 0x1E, 0x0E, 0x02, 0x01, 0x1F, 0x0C, 0x01, 0x01, 0x20, 0x0A,
+	0x01, 0x01, 0x20, 0x09, 0x1E, 0x01, 0x21, 0x08, 0x01, 0x01, 0x20, 0x09, 0x02, 0x01, 0x20, 0x0A,
+	0x01, 0x01, 0x1F, 0x0C, 0x01, 0x01, 0x1E, 0x0E, 0x01, 0x01, 0x1B, 0x13, 0x01, 0x01, 0x17, 0x1C,
+	0x02, 0x01, 0x15, 0x20, 0x14, 0x00,
+	// @23414 0xA0 (2 pixels wide)
+	0x75, 0x00,
+	// @23416 0xA1 (13 pixels wide)
+	0x26, 0x00, 0x01, 0x01, 0x03, 0x06, 0x01, 0x01, 0x02, 0x09, 0x02, 0x01, 0x01, 0x0B, 0x01, 0x01,
+	0x00, 0x0C, 0x03, 0x01, 0x00, 0x0D, 0x01, 0x01, 0x00, 0x0C, 0x01, 0x01, 0x01, 0x0B, 0x01, 0x01,
+	0x01, 0x0A, 0x01, 0x01, 0x02, 0x09, 0x01, 0x01, 0x04, 0x05, 0x09, 0x00, 0x06, 0x01, 0x03, 0x07,
+	0x0D, 0x01, 0x02, 0x08, 0x14, 0x01, 0x02, 0x09, 0x0C, 0x01, 0x01, 0x0A, 0x06, 0x00,
+	// @23478 0xA2 (40 pixels wide)
+	0x12, 0x00, 0x0A, 0x01, 0x16, 0x06, 0x01, 0x01, 0x16, 0x08, 0x01, 0x01, 0x12, 0x12, 0x01, 0x01,
+	0x0F, 0x18, 0x01, 0x01, 0x0D, 0x1B, 0x01, 0x01, 0x0C, 0x1C, 0x01, 0x01, 0x0A, 0x1D, 0x01, 0x01,
+	0x09, 0x1E, 0x01, 0x01, 0x08, 0x1F, 0x01, 0x02, 0x07, 0x0E, 0x0C, 0x05, 0x01, 0x02, 0x06, 0x0D,
+	0x11, 0x02, 0x01, 0x01, 0x05, 0x0C, 0x01, 0x01, 0x05, 0x0B, 0x01, 0x01, 0x04, 0x0B, 0x01, 0x01,
+	0x03, 0x0B, 0x01, 0x01, 0x03, 0x0A, 0x01, 0x01, 0x02, 0x0B, 0x01, 0x01, 0x02, 0x0A, 0x01, 0x01,
+	0x02, 0x09, 0x02, 0x01, 0x01, 0x0A, 0x02, 0x01, 0x01, 0x09, 0x0A, 0x01, 0x00, 0x0A, 0x02, 0x01,
+	0x01, 0x09, 0x02, 0x01, 0x01, 0x0A, 0x01, 0x01, 0x01, 0x0B, 0x01, 0x01, 0x02, 0x0A, 0x01, 0x01,
+	0x02, 0x0B, 0x02, 0x01, 0x03, 0x0B, 0x01, 0x01, 0x04, 0x0B, 0x01, 0x01, 0x04, 0x0D, 0x01, 0x02,
+	0x05, 0x0D, 0x13, 0x02, 0x01, 0x02, 0x06, 0x0E, 0x0E, 0x05, 0x01, 0x02, 0x07, 0x12, 0x03, 0x0B,
+	0x01, 0x01, 0x08, 0x1F, 0x01, 0x01, 0x09, 0x1F, 0x01, 0x01, 0x0A, 0x1E, 0x01, 0x01, 0x0C, 0x1C,
+	0x01, 0x01, 0x0E, 0x19, 0x01, 0x01, 0x10, 0x14, 0x01, 0x01, 0x14, 0x0B, 0x0B, 0x01, 0x16, 0x06,
+	0x19, 0x00,
+	// @23656 0xA3 (44 pixels wide)
+	0x13, 0x00, 0x01, 0x01, 0x1A, 0x08, 0x01, 0x01, 0x16, 0x11, 0x01, 0x01, 0x14, 0x15, 0x01, 0x01,
+	0x12, 0x17, 0x01, 0x01, 0x11, 0x18, 0x01, 0x01, 0x10, 0x19, 0x01, 0x01, 0x0F, 0x1A, 0x01, 0x01,
+	0x0E, 0x1A, 0x01, 0x02, 0x0D, 0x0C, 0x0B, 0x04, 0x01, 0x02, 0x0C, 0x0B, 0x10, 0x01, 0x01, 0x01,
+	0x0C, 0x0A, 0x01, 0x01, 0x0B, 0x0A, 0x02, 0x01, 0x0B, 0x09, 0x04, 0x01, 0x0A, 0x09, 0x01, 0x01,
+	0x0A, 0x08, 0x05, 0x01, 0x09, 0x09, 0x02, 0x01, 0x0A, 0x08, 0x06, 0x01, 0x0A, 0x09, 0x01, 0x01,
+	0x0B, 0x08, 0x06, 0x01, 0x01, 0x22, 0x03, 0x01, 0x0C, 0x08, 0x05, 0x01, 0x0C, 0x09, 0x05, 0x01,
+	0x0C, 0x08, 0x01, 0x01, 0x0B, 0x09, 0x02, 0x01, 0x0B, 0x08, 0x02, 0x01, 0x0A, 0x08, 0x01, 0x01,
+	0x09, 0x08, 0x01, 0x01, 0x08, 0x09, 0x01, 0x01, 0x08, 0x08, 0x01, 0x01, 0x07, 0x08, 0x01, 0x01,
+	0x06, 0x08, 0x01, 0x01, 0x05, 0x08, 0x01, 0x01, 0x03, 0x29, 0x01, 0x01, 0x02, 0x2A, 0x06, 0x01,
+	0x00, 0x2C, 0x1B, 0x00,
+	// @23804 0xA4 (49 pixels wide)
+	0x1D, 0x00, 0x01, 0x02, 0x04, 0x01, 0x27, 0x01, 0x01, 0x02, 0x03, 0x03, 0x25, 0x03, 0x01, 0x02,
+	0x03, 0x04, 0x23, 0x05, 0x01, 0x02, 0x02, 0x06, 0x21, 0x07, 0x01, 0x03, 0x01, 0x08, 0x0A, 0x0B,
+	0x0A, 0x09, 0x01, 0x03, 0x00, 0x0A, 0x06, 0x11, 0x06, 0x0A, 0x01, 0x03, 0x02, 0x09, 0x03, 0x15,
+	0x03, 0x0A, 0x01, 0x03, 0x03, 0x08, 0x02, 0x17, 0x01, 0x09, 0x01, 0x01, 0x04, 0x29, 0x01, 0x01,
+	0x05, 0x27, 0x01, 0x01, 0x06, 0x25, 0x01, 0x02, 0x07, 0x0C, 0x0A, 0x0D, 0x01, 0x02, 0x08, 0x0A,
+	0x0D, 0x0A, 0x01, 0x02, 0x07, 0x09, 0x10, 0x09, 0x01, 0x02, 0x07, 0x08, 0x12, 0x09, 0x01, 0x02,
+	0x06, 0x09, 0x13, 0x08, 0x01, 0x02, 0x06, 0x08, 0x15, 0x08, 0x01, 0x02, 0x05, 0x08, 0x16, 0x08,
+	0x02, 0x02, 0x05, 0x08, 0x17, 0x08, 0x01, 0x02, 0x04, 0x08, 0x18, 0x08, 0x09, 0x02, 0x04, 0x08,
+	0x19, 0x07, 0x01, 0x02, 0x04, 0x08, 0x18, 0x08, 0x01, 0x02, 0x05, 0x07, 0x18, 0x08, 0x01, 0x02,
+	0x05, 0x08, 0x17, 0x08, 0x01, 0x02, 0x05, 0x08, 0x16, 0x08, 0x01, 0x02, 0x06, 0x08, 0x15, 0x08,
+	0x01, 0x02, 0x06, 0x08, 0x14, 0x08, 0x01, 0x02, 0x06, 0x09, 0x12, 0x09, 0x01, 0x02, 0x07, 0x09,
+	0x10, 0x09, 0x01, 0x02, 0x08, 0x0A, 0x0D, 0x0A, 0x01, 0x02, 0x07, 0x0C, 0x0A, 0x0D, 0x01, 0x02,
+	0x06, 0x11, 0x03, 0x11, 0x01, 0x01, 0x05, 0x27, 0x01, 0x01, 0x04, 0x29, 0x01, 0x03, 0x03, 0x09,
+	0x01, 0x17, 0x01, 0x09, 0x01, 0x03, 0x02, 0x09, 0x03, 0x15, 0x03, 0x09, 0x01, 0x03, 0x01, 0x09,
+	0x06, 0x11, 0x06, 0x09, 0x01, 0x03, 0x00, 0x09, 0x09, 0x0C, 0x0A, 0x09, 0x01, 0x02, 0x01, 0x07,
+	0x21, 0x07, 0x01, 0x02, 0x02, 0x05, 0x23, 0x05, 0x01, 0x02, 0x03, 0x03, 0x25, 0x03, 0x01, 0x02,
+	0x04, 0x01, 0x27, 0x01, 0x25, 0x00,
+	// @24066 0xA5 (51 pixels wide)
+	0x14, 0x00, 0x02, 0x02, 0x00, 0x0A, 0x1F, 0x0A, 0x01, 0x02, 0x01, 0x0A, 0x1D, 0x0A, 0x01, 0x02,
+	0x01, 0x0A, 0x1D, 0x09, 0x01, 0x02, 0x02, 0x0A, 0x1B, 0x0A, 0x01, 0x02, 0x03, 0x09, 0x1B, 0x09,
+	0x01, 0x02, 0x03, 0x0A, 0x19, 0x0A, 0x01, 0x02, 0x04, 0x09, 0x19, 0x09, 0x01, 0x02, 0x04, 0x0A,
+	0x17, 0x09, 0x01, 0x02, 0x05, 0x09, 0x17, 0x09, 0x01, 0x02, 0x05, 0x0A, 0x15, 0x09, 0x01, 0x02,
+	0x06, 0x09, 0x14, 0x0A, 0x01, 0x02, 0x06, 0x0A, 0x13, 0x09, 0x01, 0x02, 0x07, 0x09, 0x12, 0x09,
+	0x01, 0x02, 0x08, 0x09, 0x11, 0x09, 0x01, 0x02, 0x08, 0x09, 0x10, 0x09, 0x01, 0x02, 0x09, 0x09,
+	0x0F, 0x09, 0x01, 0x02, 0x09, 0x09, 0x0E, 0x09, 0x01, 0x02, 0x0A, 0x09, 0x0D, 0x09, 0x01, 0x02,
+	0x0A, 0x09, 0x0C, 0x09, 0x01, 0x02, 0x0B, 0x09, 0x0B, 0x08, 0x01, 0x02, 0x0B, 0x09, 0x0A, 0x09,
+	0x01, 0x02, 0x0C, 0x09, 0x09, 0x08, 0x01, 0x02, 0x0D, 0x08, 0x08, 0x09, 0x01, 0x02, 0x0D, 0x09,
+	0x07, 0x08, 0x01, 0x02, 0x0E, 0x08, 0x06, 0x08, 0x01, 0x02, 0x0E, 0x09, 0x05, 0x08, 0x01, 0x02,
+	0x0F, 0x08, 0x04, 0x08, 0x01, 0x02, 0x0F, 0x09, 0x03, 0x08, 0x01, 0x02, 0x10, 0x08, 0x03, 0x07,
+	0x01, 0x02, 0x10, 0x08, 0x02, 0x07, 0x01, 0x02, 0x11, 0x08, 0x01, 0x07, 0x01, 0x01, 0x12, 0x0E,
+	0x05, 0x01, 0x04, 0x2A, 0x08, 0x01, 0x14, 0x09, 0x05, 0x01, 0x04, 0x2A, 0x13, 0x01, 0x14, 0x09,
+	0x1B, 0x00,
+	// @24276 0xA6 (7 pixels wide)
+	0x12, 0x00, 0x25, 0x01, 0x00, 0x07, 0x10, 0x00, 0x26, 0x01, 0x00, 0x07, 0x08, 0x00,
+	// @24290 0xA7 (43 pixels wide)
+	0x11, 0x00, 0x01, 0x01, 0x12, 0x0D, 0x01, 0x01, 0x0E, 0x14, 0x01, 0x01, 0x0C, 0x19, 0x01, 0x01,
+	0x0B, 0x1C, 0x01, 0x01, 0x09, 0x1D, 0x01, 0x01, 0x08, 0x1E, 0x01, 0x02, 0x07, 0x0D, 0x08, 0x0A,
+	0x01, 0x02, 0x07, 0x0A, 0x0F, 0x05, 0x01, 0x02, 0x06, 0x09, 0x13, 0x03, 0x01, 0x01, 0x05, 0x09,
+	0x03, 0x01, 0x05, 0x08, 0x05, 0x01, 0x04, 0x09, 0x01, 0x01, 0x05, 0x09, 0x01, 0x01, 0x05, 0x0A,
+	0x01, 0x01, 0x05, 0x0C, 0x01, 0x01, 0x06, 0x0D, 0x01, 0x01, 0x07, 0x0E, 0x01, 0x01, 0x08, 0x10,
+	0x01, 0x01, 0x07, 0x13, 0x01, 0x01, 0x06, 0x17, 0x01, 0x01, 0x05, 0x1B, 0x01, 0x02, 0x04, 0x08,
+	0x02, 0x14, 0x01, 0x02, 0x03, 0x08, 0x05, 0x14, 0x01, 0x02, 0x02, 0x08, 0x08, 0x13, 0x01, 0x02,
+	0x02, 0x07, 0x0C, 0x11, 0x01, 0x02, 0x01, 0x08, 0x0E, 0x11, 0x01, 0x02, 0x01, 0x07, 0x12, 0x0E,
+	0x01, 0x02, 0x01, 0x07, 0x14, 0x0D, 0x01, 0x02, 0x00, 0x08, 0x16, 0x0C, 0x01, 0x02, 0x00, 0x08,
+	0x18, 0x0A, 0x01, 0x02, 0x00, 0x08, 0x19, 0x0A, 0x01, 0x02, 0x00, 0x08, 0x1A, 0x09, 0x01, 0x02,
+	0x00, 0x09, 0x19, 0x09, 0x01, 0x02, 0x01, 0x08, 0x1A, 0x08, 0x01, 0x02, 0x01, 0x09, 0x19, 0x08,
+	0x01, 0x02, 0x01, 0x0A, 0x18, 0x08, 0x01, 0x02, 0x02, 0x0B, 0x17, 0x07, 0x01, 0x02, 0x02, 0x0D,
+	0x14, 0x08, 0x01, 0x02, 0x03, 0x0E, 0x12, 0x08, 0x01, 0x02, 0x04, 0x0F, 0x10, 0x08, 0x01, 0x02,
+	0x05, 0x11, 0x0D, 0x07, 0x01, 0x02, 0x06, 0x12, 0x0A, 0x08, 0x01, 0x02, 0x08, 0x13, 0x07, 0x07,
+	0x01, 0x02, 0x09, 0x14, 0x04, 0x08, 0x01, 0x02, 0x0B, 0x14, 0x01, 0x08, 0x01, 0x01, 0x0E, 0x19,
+	0x01, 0x01, 0x10, 0x16, 0x01, 0x01, 0x13, 0x12, 0x01, 0x01, 0x16, 0x0F, 0x01, 0x01, 0x18, 0x0E,
+	0x01, 0x01, 0x1A, 0x0C, 0x01, 0x01, 0x1C, 0x0B, 0x01, 0x01, 0x1D, 0x0A, 0x01, 0x01, 0x1E, 0x0A,
+	0x02, 0x01, 0x1F, 0x09, 0x05, 0x01, 0x20, 0x08, 0x02, 0x01, 0x1F, 0x09, 0x01, 0x02, 0x06, 0x01,
+	0x17, 0x09, 0x01, 0x02, 0x05, 0x03, 0x15, 0x0A, 0x01, 0x02, 0x05, 0x06, 0x11, 0x0A, 0x01, 0x02,
+	0x04, 0x0A, 0x0C, 0x0C, 0x01, 0x01, 0x04, 0x21, 0x01, 0x01, 0x04, 0x20, 0x01, 0x01, 0x04, 0x1E,
+	0x01, 0x01, 0x05, 0x1C, 0x01, 0x01, 0x07, 0x18, 0x01, 0x01, 0x0A, 0x12, 0x01, 0x01, 0x10, 0x07,
+	0x14, 0x00,
+	// @24628 0xA8 (30 pixels wide)
+	0x12, 0x00, 0x01, 0x02, 0x03, 0x04, 0x10, 0x04, 0x01, 0x02, 0x01, 0x08, 0x0C, 0x08, 0x01, 0x02,
+	0x01, 0x09, 0x0B, 0x08, 0x05, 0x02, 0x00, 0x0A, 0x0A, 0x0A, 0x01, 0x02, 0x01, 0x09, 0x0A, 0x09,
+	0x01, 0x02, 0x01, 0x08, 0x0C, 0x08, 0x01, 0x02, 0x03, 0x04, 0x10, 0x04, 0x58, 0x00,
+	// @24674 0xA9 (65 pixels wide)
+	0x15, 0x00, 0x01, 0x01, 0x19, 0x0F, 0x01, 0x01, 0x15, 0x16, 0x01, 0x01, 0x13, 0x1B, 0x01, 0x01,
+	0x11, 0x1F, 0x01, 0x02, 0x0F, 0x0C, 0x0A, 0x0D, 0x01, 0x02, 0x0E, 0x09, 0x12, 0x0A, 0x01, 0x02,
+	0x0C, 0x09, 0x17, 0x08, 0x01, 0x02, 0x0B, 0x08, 0x1A, 0x08, 0x01, 0x02, 0x0A, 0x08, 0x1D, 0x08,
+	0x01, 0x02, 0x09, 0x07, 0x20, 0x07, 0x01, 0x02, 0x08, 0x07, 0x23, 0x06, 0x01, 0x02, 0x07, 0x07,
+	0x25, 0x06, 0x01, 0x02, 0x07, 0x06, 0x27, 0x06, 0x01, 0x03, 0x06, 0x06, 0x14, 0x06, 0x0E, 0x07,
+	0x01, 0x03, 0x05, 0x06, 0x11, 0x0F, 0x0A, 0x06, 0x01, 0x03, 0x04, 0x06, 0x0F, 0x15, 0x08, 0x06,
+	0x01, 0x03, 0x04, 0x06, 0x0E, 0x17, 0x08, 0x06, 0x01, 0x03, 0x03, 0x06, 0x0D, 0x18, 0x09, 0x06,
+	0x01, 0x04, 0x03, 0x06, 0x0C, 0x09, 0x0A, 0x06, 0x0A, 0x06, 0x01, 0x04, 0x02, 0x06, 0x0C, 0x07,
+	0x10, 0x03, 0x0A, 0x06, 0x01, 0x03, 0x02, 0x06, 0x0B, 0x07, 0x1F, 0x05, 0x01, 0x03, 0x02, 0x05,
+	0x0B, 0x07, 0x20, 0x06, 0x01, 0x03, 0x01, 0x06, 0x0A, 0x07, 0x22, 0x05, 0x01, 0x03, 0x01, 0x06,
+	0x0A, 0x06, 0x23, 0x05, 0x02, 0x03, 0x01, 0x05, 0x0A, 0x06, 0x24, 0x06, 0x01, 0x03, 0x00, 0x06,
+	0x0A, 0x05, 0x26, 0x05, 0x01, 0x03, 0x00, 0x06, 0x09, 0x06, 0x26, 0x05, 0x01, 0x03, 0x00, 0x05,
+	0x0A, 0x06, 0x26, 0x05, 0x01, 0x03, 0x00, 0x05, 0x0A, 0x05, 0x27, 0x05, 0x05, 0x03, 0x00, 0x05,
+	0x0A, 0x05, 0x27, 0x06, 0x02, 0x03, 0x00, 0x05, 0x0A, 0x05, 0x27, 0x05, 0x01, 0x03, 0x00, 0x05,
+	0x0A, 0x06, 0x26, 0x05, 0x01, 0x03, 0x00, 0x06, 0x09, 0x06, 0x26, 0x05, 0x01, 0x03, 0x01, 0x05,
+	0x09, 0x06, 0x26, 0x05, 0x02, 0x03, 0x01, 0x05, 0x0A, 0x06, 0x24, 0x06, 0x01, 0x03, 0x01, 0x06,
+	0x09, 0x07, 0x23, 0x05, 0x01, 0x03, 0x02, 0x05, 0x0A, 0x07, 0x21, 0x06, 0x01, 0x03, 0x02, 0x05,
+	0x0B, 0x07, 0x20, 0x06, 0x01, 0x03, 0x02, 0x06, 0x0A, 0x08, 0x1F, 0x05, 0x01, 0x04, 0x03, 0x05,
+	0x0B, 0x09, 0x10, 0x02, 0x0A, 0x06, 0x01, 0x04, 0x03, 0x06, 0x0B, 0x0B, 0x0A, 0x06, 0x09, 0x05,
+	0x01, 0x03, 0x04, 0x05, 0x0C, 0x1A, 0x08, 0x06, 0x01, 0x03, 0x04, 0x06, 0x0D, 0x18, 0x07, 0x06,
+	0x01, 0x03, 0x05, 0x06, 0x0D, 0x15, 0x09, 0x06, 0x01, 0x03, 0x06, 0x06, 0x0F, 0x10, 0x0A, 0x06,
+	0x01, 0x03, 0x06, 0x06, 0x13, 0x06, 0x0F, 0x06, 0x01, 0x02, 0x07, 0x06, 0x26, 0x07, 0x01, 0x02,
+	0x08, 0x06, 0x24, 0x07, 0x01, 0x02, 0x09, 0x07, 0x21, 0x07, 0x01, 0x02, 0x0A, 0x07, 0x1F, 0x07,
+	0x01, 0x02, 0x0B, 0x07, 0x1C, 0x08, 0x01, 0x02, 0x0C, 0x08, 0x19, 0x08, 0x01, 0x02, 0x0D, 0x09,
+	0x15, 0x08, 0x01, 0x02, 0x0F, 0x0A, 0x0F, 0x0A, 0x01, 0x01, 0x10, 0x21, 0x01, 0x01, 0x12, 0x1D,
+	0x01, 0x01, 0x14, 0x19, 0x01, 0x01, 0x17, 0x13, 0x01, 0x01, 0x1C, 0x09, 0x1E, 0x00,
+	// @25088 0xAA (28 pixels wide)
+	0x1B, 0x00, 0x01, 0x01, 0x08, 0x0C, 0x01, 0x01, 0x05, 0x11, 0x01, 0x01, 0x03, 0x14, 0x01, 0x01,
+	0x02, 0x17, 0x01, 0x01, 0x03, 0x16, 0x01, 0x02, 0x03, 0x06, 0x08, 0x09, 0x01, 0x02, 0x03, 0x03,
+	0x0C, 0x08, 0x02, 0x01, 0x14, 0x07, 0x01, 0x01, 0x15, 0x06, 0x03, 0x01, 0x15, 0x07, 0x01, 0x01,
+	0x0B, 0x11, 0x01, 0x01, 0x08, 0x14, 0x01, 0x01, 0x06, 0x16, 0x01, 0x01, 0x04, 0x18, 0x01, 0x02,
+	0x03, 0x0D, 0x05, 0x07, 0x01, 0x02, 0x02, 0x09, 0x0A, 0x07, 0x01, 0x02, 0x01, 0x08, 0x0C, 0x07,
+	0x01, 0x02, 0x00, 0x08, 0x0D, 0x07, 0x04, 0x02, 0x00, 0x07, 0x0E, 0x07, 0x02, 0x02, 0x00, 0x07,
+	0x0D, 0x08, 0x01, 0x02, 0x00, 0x08, 0x0B, 0x09, 0x01, 0x02, 0x00, 0x09, 0x09, 0x0A, 0x01, 0x02,
+	0x01, 0x09, 0x05, 0x0D, 0x01, 0x02, 0x01, 0x14, 0x01, 0x06, 0x01, 0x02, 0x02, 0x12, 0x02, 0x06,
+	0x01, 0x02, 0x03, 0x10, 0x03, 0x06, 0x01, 0x02, 0x04, 0x0D, 0x05, 0x06, 0x01, 0x01, 0x07, 0x07,
+	0x37, 0x00,
+	// @25234 0xAB (39 pixels wide)
+	0x2B, 0x00, 0x01, 0x02, 0x0E, 0x08, 0x0A, 0x07, 0x01, 0x02, 0x0D, 0x08, 0x0A, 0x08, 0x01, 0x02,
+	0x0D, 0x07, 0x0A, 0x08, 0x01, 0x02, 0x0C, 0x08, 0x0A, 0x07, 0x01, 0x02, 0x0B, 0x08, 0x0A, 0x07,
+	0x01, 0x02, 0x0B, 0x07, 0x0A, 0x08, 0x01, 0x02, 0x0A, 0x07, 0x0A, 0x08, 0x01, 0x02, 0x09, 0x08,
+	0x0A, 0x07, 0x01, 0x02, 0x08, 0x08, 0x0A, 0x07, 0x01, 0x02, 0x08, 0x07, 0x0A, 0x08, 0x01, 0x02,
+	0x07, 0x07, 0x0A, 0x08, 0x01, 0x02, 0x06, 0x08, 0x0A, 0x07, 0x01, 0x02, 0x06, 0x07, 0x0A, 0x08,
+	0x01, 0x02, 0x05, 0x07, 0x0A, 0x08, 0x01, 0x02, 0x04, 0x08, 0x0A, 0x07, 0x01, 0x02, 0x03, 0x08,
+	0x0A, 0x07, 0x01, 0x02, 0x03, 0x07, 0x0A, 0x08, 0x01, 0x02, 0x02, 0x07, 0x0A, 0x08, 0x01, 0x02,
+	0x01, 0x08, 0x0A, 0x07, 0x01, 0x02, 0x00, 0x08, 0x0A, 0x08, 0x01, 0x02, 0x00, 0x08, 0x0A, 0x07,
+	0x01, 0x02, 0x01, 0x08, 0x0A, 0x07, 0x01, 0x02, 0x02, 0x07, 0x0A, 0x08, 0x01, 0x02, 0x03, 0x07,
+	0x0A, 0x08, 0x01, 0x02, 0x03, 0x08, 0x0A, 0x07, 0x01, 0x02, 0x04, 0x08, 0x0A, 0x07, 0x01, 0x02,
+	0x05, 0x07, 0x0A, 0x08, 0x01, 0x02, 0x05, 0x08, 0x0A, 0x08, 0x01, 0x02, 0x06, 0x08, 0x0A, 0x07,
+	0x01, 0x02, 0x07, 0x07, 0x0A, 0x08, 0x01, 0x02, 0x08, 0x07, 0x0A, 0x08, 0x01, 0x02, 0x08, 0x08,
+	0x0A, 0x07, 0x01, 0x02, 0x09, 0x08, 0x0A, 0x07, 0x01, 0x02, 0x0A, 0x07, 0x0A, 0x08, 0x01, 0x02,
+	0x0B, 0x07, 0x0A, 0x08, 0x01, 0x02, 0x0B, 0x08, 0x0A, 0x07, 0x01, 0x02, 0x0C, 0x08, 0x0A, 0x07,
+	0x01, 0x02, 0x0D, 0x07, 0x0A, 0x08, 0x01, 0x02, 0x0D, 0x08, 0x0A, 0x08, 0x01, 0x02, 0x0E, 0x08,
+	0x0A, 0x07, 0x22, 0x00,
+	// @25478 0xAC (56 pixels wide)
+	0x2F, 0x00, 0x07, 0x01, 0x00, 0x38, 0x17, 0x01, 0x31, 0x07, 0x28, 0x00,
+	// @25490 0xAD (2 pixels wide)
+	0x75, 0x00,
+	// @25492 0xAE (36 pixels wide)
+	0x11, 0x00, 0x01, 0x01, 0x0E, 0x09, 0x01, 0x01, 0x0B, 0x0F, 0x01, 0x01, 0x09, 0x13, 0x01, 0x02,
+	0x07, 0x0A, 0x03, 0x0A, 0x01, 0x02, 0x06, 0x07, 0x0B, 0x07, 0x01, 0x02, 0x05, 0x06, 0x0F, 0x06,
+	0x01, 0x02, 0x04, 0x06, 0x11, 0x06, 0x01, 0x02, 0x03, 0x06, 0x13, 0x05, 0x01, 0x03, 0x03, 0x05,
+	0x09, 0x03, 0x09, 0x05, 0x01, 0x03, 0x02, 0x05, 0x05, 0x0C, 0x06, 0x05, 0x01, 0x03, 0x02, 0x05,
+	0x05, 0x0D, 0x05, 0x05, 0x01, 0x04, 0x01, 0x05, 0x06, 0x05, 0x02, 0x07, 0x05, 0x04, 0x01, 0x04,
+	0x01, 0x05, 0x06, 0x04, 0x05, 0x05, 0x05, 0x05, 0x01, 0x04, 0x01, 0x04, 0x07, 0x04, 0x06, 0x04,
+	0x05, 0x05, 0x01, 0x04, 0x01, 0x04, 0x07, 0x04, 0x06, 0x04, 0x06, 0x04, 0x01, 0x04, 0x00, 0x05,
+	0x07, 0x04, 0x05, 0x05, 0x06, 0x04, 0x01, 0x04, 0x00, 0x05, 0x07, 0x04, 0x04, 0x05, 0x07, 0x04,
+	0x01, 0x03, 0x00, 0x05, 0x07, 0x0B, 0x09, 0x04, 0x01, 0x03, 0x00, 0x05, 0x07, 0x0C, 0x08, 0x04,
+	0x01, 0x03, 0x00, 0x05, 0x07, 0x0D, 0x07, 0x04, 0x01, 0x04, 0x01, 0x04, 0x07, 0x04, 0x04, 0x05,
+	0x07, 0x04, 0x01, 0x04, 0x01, 0x04, 0x07, 0x04, 0x05, 0x04, 0x06, 0x05, 0x01, 0x04, 0x01, 0x05,
+	0x06, 0x04, 0x05, 0x05, 0x05, 0x05, 0x01, 0x04, 0x01, 0x05, 0x06, 0x04, 0x06, 0x04, 0x05, 0x04,
+	0x02, 0x04, 0x02, 0x05, 0x05, 0x04, 0x06, 0x04, 0x04, 0x05, 0x01, 0x04, 0x03, 0x05, 0x04, 0x04,
+	0x07, 0x04, 0x02, 0x05, 0x01, 0x02, 0x04, 0x05, 0x13, 0x05, 0x01, 0x02, 0x04, 0x06, 0x11, 0x06,
+	0x01, 0x02, 0x05, 0x06, 0x0F, 0x06, 0x01, 0x02, 0x06, 0x07, 0x0B, 0x07, 0x01, 0x01, 0x07, 0x16,
+	0x01, 0x01, 0x09, 0x13, 0x01, 0x01, 0x0B, 0x0F, 0x01, 0x01, 0x0D, 0x0A, 0x41, 0x00,
+	// @25746 0xAF (24 pixels wide)
+	0x15, 0x00, 0x06, 0x01, 0x00, 0x18, 0x5A, 0x00,
+	// @25754 0xB0 (28 pixels wide)
+	0x11, 0x00, 0x01, 0x01, 0x09, 0x0A, 0x01, 0x01, 0x07, 0x0F, 0x01, 0x01, 0x06, 0x11, 0x01, 0x01,
+	0x05, 0x13, 0x01, 0x01, 0x04, 0x15, 0x01, 0x02, 0x03, 0x08, 0x07, 0x08, 0x01, 0x02, 0x02, 0x07,
+	0x0B, 0x07, 0x01, 0x02, 0x02, 0x06, 0x0D, 0x06, 0x01, 0x02, 0x01, 0x06, 0x0E, 0x07, 0x01, 0x02,
+	0x01, 0x06, 0x0F, 0x06, 0x02, 0x02, 0x00, 0x06, 0x10, 0x06, 0x04, 0x02, 0x00, 0x06, 0x11, 0x05,
+	0x02, 0x02, 0x00, 0x06, 0x10, 0x06, 0x01, 0x02, 0x01, 0x06, 0x0F, 0x06, 0x01, 0x02, 0x01, 0x07,
+	0x0D, 0x06, 0x01, 0x02, 0x02, 0x06, 0x0C, 0x07, 0x01, 0x02, 0x02, 0x08, 0x09, 0x07, 0x01, 0x02,
+	0x03, 0x09, 0x05, 0x08, 0x01, 0x01, 0x04, 0x15, 0x01, 0x01, 0x05, 0x12, 0x01, 0x01, 0x06, 0x10,
+	0x01, 0x01, 0x08, 0x0C, 0x01, 0x01, 0x0B, 0x06, 0x48, 0x00,
+	// @25876 0xB1 (56 pixels wide)
+	0x1D, 0x00, 0x15, 0x01, 0x18, 0x07, 0x06, 0x01, 0x00, 0x38, 0x15, 0x01, 0x18, 0x07, 0x07, 0x00,
+	0x06, 0x01, 0x00, 0x38, 0x1B, 0x00,
+	// @25898 0xB2 (29 pixels wide)
+	0x01, 0x01, 0x0B, 0x06, 0x01, 0x01, 0x07, 0x0E, 0x01, 0x01, 0x05, 0x12, 0x01, 0x01, 0x03, 0x15,
+	0x01, 0x01, 0x01, 0x18, 0x01, 0x01, 0x01, 0x19, 0x01, 0x02, 0x02, 0x08, 0x05, 0x0C, 0x01, 0x02,
+	0x02, 0x05, 0x0B, 0x09, 0x01, 0x02, 0x03, 0x02, 0x0E, 0x09, 0x01, 0x02, 0x03, 0x01, 0x10, 0x08,
+	0x03, 0x01, 0x14, 0x08, 0x01, 0x01, 0x15, 0x07, 0x04, 0x01, 0x14, 0x08, 0x02, 0x01, 0x13, 0x08,
+	0x01, 0x01, 0x12, 0x08, 0x01, 0x01, 0x11, 0x09, 0x01, 0x01, 0x11, 0x08, 0x01, 0x01, 0x10, 0x08,
+	0x01, 0x01, 0x0F, 0x08, 0x01, 0x01, 0x0E, 0x08, 0x01, 0x01, 0x0D, 0x08, 0x01, 0x01, 0x0C, 0x09,
+	0x01, 0x01, 0x0B, 0x09, 0x01, 0x01, 0x0A, 0x08, 0x01, 0x01, 0x09, 0x08, 0x01, 0x01, 0x08, 0x08,
+	0x01, 0x01, 0x07, 0x08, 0x01, 0x01, 0x06, 0x08, 0x01, 0x01, 0x05, 0x08, 0x01, 0x01, 0x04, 0x08,
+	0x01, 0x01, 0x03, 0x08, 0x01, 0x01, 0x01, 0x1C, 0x05, 0x01, 0x00, 0x1D, 0x4A, 0x00,
+	// @26040 0xB3 (29 pixels wide)
+	0x01, 0x01, 0x0C, 0x05, 0x01, 0x01, 0x07, 0x0E, 0x01, 0x01, 0x04, 0x13, 0x01, 0x01, 0x02, 0x16,
+	0x01, 0x01, 0x02, 0x17, 0x01, 0x01, 0x03, 0x17, 0x01, 0x02, 0x03, 0x06, 0x07, 0x0B, 0x01, 0x02,
+	0x03, 0x03, 0x0C, 0x09, 0x02, 0x01, 0x13, 0x08, 0x02, 0x01, 0x14, 0x07, 0x02, 0x01, 0x13, 0x08,
+	0x01, 0x01, 0x13, 0x07, 0x01, 0x01, 0x12, 0x08, 0x01, 0x01, 0x10, 0x09, 0x01, 0x01, 0x0D, 0x0B,
+	0x01, 0x01, 0x07, 0x0F, 0x01, 0x01, 0x07, 0x0E, 0x01, 0x01, 0x07, 0x0D, 0x01, 0x01, 0x07, 0x10,
+	0x01, 0x01, 0x07, 0x12, 0x01, 0x01, 0x0F, 0x0B, 0x01, 0x01, 0x12, 0x09, 0x01, 0x01, 0x13, 0x09,
+	0x01, 0x01, 0x14, 0x08, 0x06, 0x01, 0x15, 0x08, 0x01, 0x01, 0x14, 0x09, 0x01, 0x01, 0x14, 0x08,
+	0x01, 0x02, 0x01, 0x02, 0x10, 0x09, 0x01, 0x02, 0x01, 0x05, 0x0B, 0x0A, 0x01, 0x01, 0x01, 0x1A,
+	0x01, 0x01, 0x00, 0x1A, 0x01, 0x01, 0x00, 0x18, 0x01, 0x01, 0x01, 0x16, 0x01, 0x01, 0x03, 0x12,
+	0x01, 0x01, 0x06, 0x0C, 0x4A, 0x00,
+	// @26190 0xB4 (19 pixels wide)
+	0x10, 0x00, 0x01, 0x01, 0x09, 0x0A, 0x01, 0x01, 0x08, 0x0A, 0x01, 0x01, 0x08, 0x09, 0x01, 0x01,
+	0x07, 0x09, 0x01, 0x01, 0x06, 0x0A, 0x01, 0x01, 0x06, 0x09, 0x01, 0x01, 0x05, 0x09, 0x01, 0x01,
+	0x05, 0x08, 0x01, 0x01, 0x04, 0x08, 0x01, 0x01, 0x03, 0x08, 0x01, 0x01, 0x03, 0x07, 0x01, 0x01,
+	0x02, 0x08, 0x01, 0x01, 0x01, 0x08, 0x01, 0x01, 0x01, 0x07, 0x01, 0x01, 0x00, 0x07, 0x56, 0x00,
+	// @26254 0xB5 (48 pixels wide)
+	0x26, 0x00, 0x23, 0x02, 0x00, 0x09, 0x19, 0x09, 0x01, 0x02, 0x00, 0x0A, 0x18, 0x09, 0x02, 0x02,
+	0x00, 0x0A, 0x17, 0x0A, 0x01, 0x02, 0x00, 0x0A, 0x16, 0x0B, 0x01, 0x02, 0x00, 0x0B, 0x15, 0x0C,
+	0x01, 0x02, 0x00, 0x0B, 0x14, 0x0D, 0x01, 0x02, 0x00, 0x0C, 0x12, 0x0E, 0x01, 0x02, 0x00, 0x0D,
+	0x10, 0x0F, 0x01, 0x02, 0x00, 0x0E, 0x0D, 0x11, 0x01, 0x03, 0x00, 0x10, 0x0A, 0x08, 0x01, 0x0A,
+	0x01, 0x02, 0x00, 0x22, 0x01, 0x0B, 0x01, 0x02, 0x00, 0x21, 0x03, 0x0C, 0x01, 0x02, 0x00, 0x20,
+	0x04, 0x0C, 0x01, 0x02, 0x00, 0x1F, 0x05, 0x0C, 0x01, 0x03, 0x00, 0x09, 0x01, 0x14, 0x07, 0x0B,
+	0x01, 0x03, 0x00, 0x09, 0x02, 0x12, 0x09, 0x0A, 0x01, 0x03, 0x00, 0x09, 0x04, 0x0E, 0x0C, 0x09,
+	0x01, 0x03, 0x00, 0x09, 0x07, 0x08, 0x10, 0x08, 0x10, 0x01, 0x00, 0x09, 0x03, 0x01, 0x01, 0x08,
+	0x01, 0x01, 0x01, 0x09, 0x06, 0x00,
+	// @26388 0xB6 (42 pixels wide)
+	0x12, 0x00, 0x01, 0x01, 0x14, 0x15, 0x01, 0x01, 0x0F, 0x1B, 0x01, 0x01, 0x0D, 0x1D, 0x01, 0x01,
+	0x0B, 0x1F, 0x01, 0x01, 0x09, 0x21, 0x01, 0x01, 0x08, 0x22, 0x01, 0x02, 0x06, 0x15, 0x08, 0x07,
+	0x01, 0x02, 0x05, 0x16, 0x08, 0x07, 0x02, 0x02, 0x04, 0x17, 0x08, 0x07, 0x01, 0x02, 0x03, 0x18,
+	0x08, 0x07, 0x02, 0x02, 0x02, 0x19, 0x08, 0x07, 0x03, 0x02, 0x01, 0x1A, 0x08, 0x07, 0x0D, 0x02,
+	0x00, 0x1B, 0x08, 0x07, 0x03, 0x02, 0x01, 0x1A, 0x08, 0x07, 0x02, 0x02, 0x02, 0x19, 0x08, 0x07,
+	0x01, 0x02, 0x03, 0x18, 0x08, 0x07, 0x02, 0x02, 0x04, 0x17, 0x08, 0x07, 0x01, 0x02, 0x05, 0x16,
+	0x08, 0x07, 0x01, 0x02, 0x07, 0x14, 0x08, 0x07, 0x01, 0x02, 0x08, 0x13, 0x08, 0x07, 0x01, 0x02,
+	0x09, 0x12, 0x08, 0x07, 0x01, 0x02, 0x0B, 0x10, 0x08, 0x07, 0x01, 0x02, 0x0D, 0x0E, 0x08, 0x07,
+	0x01, 0x02, 0x12, 0x09, 0x08, 0x07, 0x21, 0x02, 0x15, 0x06, 0x08, 0x07, 0x16, 0x00,
+	// @26530 0xB7 (12 pixels wide)
+	0x37, 0x00, 0x01, 0x01, 0x04, 0x04, 0x01, 0x01, 0x02, 0x08, 0x01, 0x01, 0x01, 0x0A, 0x01, 0x01,
+	0x01, 0x0B, 0x06, 0x01, 0x00, 0x0C, 0x01, 0x01, 0x01, 0x0B, 0x01, 0x01, 0x01, 0x0A, 0x01, 0x01,
+	0x02, 0x08, 0x01, 0x01, 0x05, 0x02, 0x30, 0x00,
+	// @26570 0xB8 (18 pixels wide)
+	0x5A, 0x00, 0x01, 0x01, 0x08, 0x06, 0x02, 0x01, 0x07, 0x06, 0x01, 0x01, 0x06, 0x06, 0x01, 0x01,
+	0x06, 0x05, 0x01, 0x01, 0x05, 0x07, 0x01, 0x01, 0x05, 0x09, 0x01, 0x01, 0x04, 0x0C, 0x01, 0x01,
+	0x04, 0x0D, 0x01, 0x01, 0x08, 0x09, 0x01, 0x01, 0x0A, 0x08, 0x01, 0x01, 0x0B, 0x07, 0x03, 0x01,
+	0x0C, 0x06, 0x01, 0x02, 0x01, 0x01, 0x09, 0x07, 0x01, 0x01, 0x01, 0x11, 0x01, 0x01, 0x00, 0x11,
+	0x01, 0x01, 0x00, 0x10, 0x01, 0x01, 0x00, 0x0F, 0x01, 0x01, 0x02, 0x0B, 0x06, 0x00,
+	// @26648 0xB9 (17 pixels wide)
+	0x01, 0x00, 0x01, 0x01, 0x09, 0x08, 0x01, 0x01, 0x07, 0x0A, 0x01, 0x01, 0x05, 0x0C, 0x01, 0x01,
+	0x03, 0x0E, 0x01, 0x01, 0x00, 0x11, 0x02, 0x01, 0x01, 0x10, 0x01, 0x02, 0x01, 0x06, 0x02, 0x08,
+	0x01, 0x02, 0x01, 0x04, 0x04, 0x08, 0x01, 0x02, 0x01, 0x02, 0x06, 0x08, 0x20, 0x01, 0x09, 0x08,
+	0x4A, 0x00,
+	// @26698 0xBA (34 pixels wide)
+	0x1B, 0x00, 0x01, 0x01, 0x0C, 0x0B, 0x01, 0x01, 0x09, 0x10, 0x01, 0x01, 0x08, 0x13, 0x01, 0x01,
+	0x06, 0x16, 0x01, 0x01, 0x05, 0x18, 0x01, 0x02, 0x04, 0x0A, 0x06, 0x0A, 0x01, 0x02, 0x03, 0x09,
+	0x0A, 0x09, 0x01, 0x02, 0x03, 0x08, 0x0C, 0x09, 0x01, 0x02, 0x02, 0x08, 0x0E, 0x08, 0x01, 0x02,
+	0x02, 0x07, 0x10, 0x08, 0x01, 0x02, 0x01, 0x08, 0x10, 0x08, 0x01, 0x02, 0x01, 0x07, 0x12, 0x07,
+	0x01, 0x02, 0x01, 0x07, 0x12, 0x08, 0x01, 0x02, 0x00, 0x08, 0x12, 0x08, 0x07, 0x02, 0x00, 0x07,
+	0x14, 0x07, 0x01, 0x02, 0x00, 0x08, 0x12, 0x08, 0x01, 0x02, 0x00, 0x08, 0x12, 0x07, 0x01, 0x02,
+	0x01, 0x07, 0x12, 0x07, 0x01, 0x02, 0x01, 0x08, 0x10, 0x08, 0x01, 0x02, 0x02, 0x08, 0x0F, 0x07,
+	0x01, 0x02, 0x02, 0x08, 0x0E, 0x08, 0x01, 0x02, 0x03, 0x08, 0x0C, 0x08, 0x01, 0x02, 0x03, 0x0A,
+	0x08, 0x0A, 0x01, 0x02, 0x04, 0x0C, 0x03, 0x0B, 0x01, 0x01, 0x05, 0x18, 0x01, 0x01, 0x06, 0x16,
+	0x01, 0x01, 0x08, 0x12, 0x01, 0x01, 0x0A, 0x0E, 0x01, 0x01, 0x0D, 0x08, 0x37, 0x00,
+	// @26856 0xBB (38 pixels wide)
+	0x2B, 0x00, 0x01, 0x02, 0x00, 0x07, 0x0A, 0x08, 0x01, 0x02, 0x00, 0x08, 0x0A, 0x07, 0x01, 0x02,
+	0x01, 0x08, 0x09, 0x08, 0x01, 0x02, 0x02, 0x07, 0x0A, 0x08, 0x01, 0x02, 0x02, 0x08, 0x0A, 0x07,
+	0x01, 0x02, 0x03, 0x08, 0x0A, 0x07, 0x01, 0x02, 0x04, 0x08, 0x09, 0x08, 0x01, 0x02, 0x05, 0x07,
+	0x0A, 0x08, 0x01, 0x02, 0x05, 0x08, 0x0A, 0x07, 0x01, 0x02, 0x06, 0x08, 0x0A, 0x07, 0x01, 0x02,
+	0x07, 0x07, 0x0A, 0x08, 0x01, 0x02, 0x08, 0x07, 0x0A, 0x08, 0x01, 0x02, 0x08, 0x08, 0x0A, 0x07,
+	0x01, 0x02, 0x09, 0x08, 0x09, 0x08, 0x01, 0x02, 0x0A, 0x07, 0x0A, 0x08, 0x01, 0x02, 0x0B, 0x07,
+	0x0A, 0x07, 0x01, 0x02, 0x0B, 0x08, 0x0A, 0x07, 0x01, 0x02, 0x0C, 0x07, 0x0A, 0x08, 0x01, 0x02,
+	0x0D, 0x07, 0x0A, 0x08, 0x02, 0x02, 0x0D, 0x08, 0x0A, 0x07, 0x01, 0x02, 0x0D, 0x07, 0x0A, 0x08,
+	0x01, 0x02, 0x0C, 0x08, 0x09, 0x08, 0x01, 0x02, 0x0B, 0x08, 0x0A, 0x07, 0x01, 0x02, 0x0B, 0x07,
+	0x0A, 0x08, 0x01, 0x02, 0x0A, 0x07, 0x0A, 0x08, 0x01, 0x02, 0x09, 0x08, 0x0A, 0x07, 0x01, 0x02,
+	0x08, 0x08, 0x0A, 0x07, 0x01, 0x02, 0x08, 0x07, 0x0A, 0x08, 0x01, 0x02, 0x07, 0x07, 0x0A, 0x08,
+	0x01, 0x02, 0x06, 0x08, 0x0A, 0x07, 0x01, 0x02, 0x06, 0x07, 0x0A, 0x07, 0x01, 0x02, 0x05, 0x07,
+	0x0A, 0x08, 0x01, 0x02, 0x04, 0x08, 0x0A, 0x07, 0x01, 0x02, 0x03, 0x08, 0x0A, 0x07, 0x01, 0x02,
+	0x03, 0x07, 0x0A, 0x08, 0x01, 0x02, 0x02, 0x07, 0x0A, 0x08, 0x01, 0x02, 0x01, 0x08, 0x0A, 0x07,
+	0x01, 0x02, 0x00, 0x08, 0x0A, 0x07, 0x01, 0x02, 0x00, 0x07, 0x0A, 0x08, 0x22, 0x00,
+	// @27094 0xBC (72 pixels wide)
+	0x13, 0x00, 0x01, 0x01, 0x32, 0x06, 0x01, 0x02, 0x08, 0x08, 0x22, 0x06, 0x01, 0x02, 0x06, 0x0A,
+	0x21, 0x06, 0x01, 0x02, 0x04, 0x0C, 0x21, 0x06, 0x01, 0x02, 0x02, 0x0E, 0x20, 0x06, 0x02, 0x02,
+	0x00, 0x10, 0x1F, 0x06, 0x01, 0x03, 0x00, 0x08, 0x01, 0x07, 0x1E, 0x06, 0x01, 0x03, 0x00, 0x06,
+	0x03, 0x07, 0x1E, 0x06, 0x01, 0x03, 0x00, 0x04, 0x05, 0x07, 0x1D, 0x06, 0x01, 0x03, 0x01, 0x01,
+	0x07, 0x07, 0x1D, 0x06, 0x02, 0x02, 0x09, 0x07, 0x1C, 0x06, 0x01, 0x02, 0x09, 0x07, 0x1B, 0x06,
+	0x02, 0x02, 0x09, 0x07, 0x1A, 0x06, 0x02, 0x02, 0x09, 0x07, 0x19, 0x06, 0x02, 0x02, 0x09, 0x07,
+	0x18, 0x06, 0x01, 0x02, 0x09, 0x07, 0x17, 0x06, 0x02, 0x02, 0x09, 0x07, 0x16, 0x06, 0x02, 0x02,
+	0x09, 0x07, 0x15, 0x06, 0x02, 0x02, 0x09, 0x07, 0x14, 0x06, 0x01, 0x02, 0x09, 0x07, 0x13, 0x06,
+	0x01, 0x02, 0x09, 0x07, 0x12, 0x07, 0x01, 0x03, 0x09, 0x07, 0x12, 0x06, 0x12, 0x08, 0x01, 0x03,
+	0x09, 0x07, 0x11, 0x06, 0x12, 0x09, 0x01, 0x03, 0x09, 0x07, 0x11, 0x06, 0x11, 0x0A, 0x01, 0x03,
+	0x09, 0x07, 0x10, 0x06, 0x11, 0x0B, 0x01, 0x03, 0x09, 0x07, 0x10, 0x06, 0x10, 0x0C, 0x01, 0x03,
+	0x09, 0x07, 0x0F, 0x06, 0x11, 0x0C, 0x01, 0x03, 0x09, 0x07, 0x0F, 0x06, 0x10, 0x0D, 0x01, 0x04,
+	0x09, 0x07, 0x0E, 0x06, 0x10, 0x06, 0x01, 0x07, 0x01, 0x04, 0x09, 0x07, 0x0D, 0x06, 0x10, 0x07,
+	0x01, 0x07, 0x01, 0x04, 0x09, 0x07, 0x0D, 0x06, 0x10, 0x06, 0x02, 0x07, 0x01, 0x04, 0x09, 0x07,
+	0x0C, 0x06, 0x10, 0x07, 0x02, 0x07, 0x01, 0x04, 0x09, 0x07, 0x0C, 0x06, 0x0F, 0x07, 0x03, 0x07,
+	0x01, 0x04, 0x09, 0x07, 0x0B, 0x06, 0x0F, 0x07, 0x04, 0x07, 0x01, 0x03, 0x1B, 0x06, 0x0F, 0x06,
+	0x05, 0x07, 0x01, 0x03, 0x1A, 0x06, 0x0F, 0x07, 0x05, 0x07, 0x01, 0x03, 0x19, 0x06, 0x0F, 0x07,
+	0x06, 0x07, 0x01, 0x03, 0x19, 0x06, 0x0E, 0x07, 0x07, 0x07, 0x01, 0x03, 0x18, 0x06, 0x0F, 0x06,
+	0x08, 0x07, 0x01, 0x03, 0x18, 0x06, 0x0E, 0x07, 0x08, 0x07, 0x01, 0x03, 0x17, 0x06, 0x0E, 0x07,
+	0x09, 0x07, 0x01, 0x03, 0x17, 0x06, 0x0D, 0x07, 0x0A, 0x07, 0x01, 0x03, 0x16, 0x06, 0x0E, 0x06,
+	0x0B, 0x07, 0x01, 0x03, 0x15, 0x07, 0x0D, 0x07, 0x0B, 0x07, 0x01, 0x03, 0x15, 0x06, 0x0D, 0x07,
+	0x0C, 0x07, 0x01, 0x03, 0x14, 0x06, 0x0D, 0x07, 0x0D, 0x07, 0x01, 0x03, 0x14, 0x06, 0x0C, 0x07,
+	0x0E, 0x07, 0x01, 0x02, 0x13, 0x06, 0x0D, 0x22, 0x01, 0x02, 0x13, 0x06, 0x0C, 0x23, 0x02, 0x02,
+	0x12, 0x06, 0x0D, 0x23, 0x01, 0x02, 0x11, 0x06, 0x0E, 0x23, 0x02, 0x02, 0x10, 0x06, 0x25, 0x07,
+	0x02, 0x02, 0x0F, 0x06, 0x26, 0x07, 0x02, 0x02, 0x0E, 0x06, 0x27, 0x07, 0x01, 0x02, 0x0D, 0x06,
+	0x28, 0x07, 0x02, 0x02, 0x0C, 0x06, 0x29, 0x07, 0x02, 0x02, 0x0B, 0x06, 0x2A, 0x07, 0x01, 0x01,
+	0x0A, 0x06, 0x1A, 0x00,
+	// @27514 0xBD (73 pixels wide)
+	0x13, 0x00, 0x01, 0x01, 0x32, 0x06, 0x01, 0x02, 0x09, 0x08, 0x21, 0x06, 0x01, 0x02, 0x07, 0x0A,
+	0x20, 0x06, 0x01, 0x02, 0x04, 0x0D, 0x1F, 0x06, 0x01, 0x02, 0x02, 0x0F, 0x1F, 0x06, 0x02, 0x02,
+	0x00, 0x11, 0x1E, 0x06, 0x01, 0x02, 0x01, 0x10, 0x1D, 0x06, 0x01, 0x03, 0x01, 0x06, 0x02, 0x08,
+	0x1D, 0x06, 0x01, 0x03, 0x01, 0x04, 0x04, 0x08, 0x1C, 0x06, 0x01, 0x03, 0x01, 0x01, 0x07, 0x08,
+	0x1C, 0x06, 0x01, 0x02, 0x09, 0x08, 0x1B, 0x06, 0x02, 0x02, 0x09, 0x08, 0x1A, 0x06, 0x02, 0x02,
+	0x09, 0x08, 0x19, 0x06, 0x02, 0x02, 0x09, 0x08, 0x18, 0x06, 0x01, 0x02, 0x09, 0x08, 0x17, 0x06,
+	0x02, 0x02, 0x09, 0x08, 0x16, 0x06, 0x02, 0x02, 0x09, 0x08, 0x15, 0x06, 0x02, 0x02, 0x09, 0x08,
+	0x14, 0x06, 0x01, 0x02, 0x09, 0x08, 0x13, 0x06, 0x01, 0x02, 0x09, 0x08, 0x13, 0x05, 0x01, 0x02,
+	0x09, 0x08, 0x12, 0x06, 0x01, 0x02, 0x09, 0x08, 0x11, 0x06, 0x01, 0x03, 0x09, 0x08, 0x11, 0x06,
+	0x0C, 0x0C, 0x01, 0x03, 0x09, 0x08, 0x10, 0x06, 0x0A, 0x11, 0x01, 0x03, 0x09, 0x08, 0x10, 0x06,
+	0x08, 0x15, 0x01, 0x03, 0x09, 0x08, 0x0F, 0x06, 0x08, 0x17, 0x01, 0x03, 0x09, 0x08, 0x0F, 0x06,
+	0x07, 0x19, 0x01, 0x03, 0x09, 0x08, 0x0E, 0x06, 0x09, 0x18, 0x01, 0x04, 0x09, 0x08, 0x0D, 0x06,
+	0x0A, 0x06, 0x09, 0x0A, 0x01, 0x04, 0x09, 0x08, 0x0D, 0x06, 0x0B, 0x03, 0x0C, 0x0A, 0x01, 0x04,
+	0x09, 0x08, 0x0C, 0x06, 0x0C, 0x01, 0x0F, 0x09, 0x01, 0x03, 0x09, 0x08, 0x0C, 0x06, 0x1D, 0x08,
+	0x02, 0x03, 0x09, 0x08, 0x0B, 0x06, 0x1E, 0x08, 0x01, 0x03, 0x09, 0x08, 0x0A, 0x06, 0x1F, 0x08,
+	0x02, 0x02, 0x1A, 0x06, 0x20, 0x08, 0x01, 0x02, 0x19, 0x06, 0x21, 0x08, 0x01, 0x02, 0x19, 0x06,
+	0x21, 0x07, 0x02, 0x02, 0x18, 0x06, 0x21, 0x08, 0x02, 0x02, 0x17, 0x06, 0x21, 0x08, 0x01, 0x02,
+	0x16, 0x06, 0x21, 0x08, 0x01, 0x02, 0x15, 0x06, 0x21, 0x08, 0x01, 0x02, 0x15, 0x06, 0x20, 0x08,
+	0x01, 0x02, 0x14, 0x06, 0x20, 0x09, 0x01, 0x02, 0x14, 0x06, 0x1F, 0x09, 0x01, 0x02, 0x13, 0x06,
+	0x1F, 0x09, 0x01, 0x02, 0x13, 0x06, 0x1E, 0x09, 0x01, 0x02, 0x12, 0x06, 0x1E, 0x09, 0x01, 0x02,
+	0x11, 0x06, 0x1E, 0x09, 0x01, 0x02, 0x11, 0x06, 0x1D, 0x09, 0x01, 0x02, 0x10, 0x06, 0x1D, 0x09,
+	0x01, 0x02, 0x10, 0x06, 0x1C, 0x08, 0x01, 0x02, 0x0F, 0x06, 0x1C, 0x08, 0x01, 0x02, 0x0F, 0x06,
+	0x1B, 0x08, 0x01, 0x02, 0x0E, 0x06, 0x1B, 0x08, 0x01, 0x02, 0x0E, 0x05, 0x1B, 0x1B, 0x01, 0x02,
+	0x0D, 0x06, 0x1A, 0x1C, 0x02, 0x02, 0x0C, 0x06, 0x1A, 0x1D, 0x02, 0x02, 0x0B, 0x06, 0x1B, 0x1D,
+	0x01, 0x01, 0x0A, 0x06, 0x1A, 0x00,
+	// @27904 0xBE (76 pixels wide)
+	0x13, 0x00, 0x01, 0x02, 0x0B, 0x07, 0x26, 0x06, 0x01, 0x02, 0x07, 0x0E, 0x23, 0x06, 0x01, 0x02,
+	0x04, 0x13, 0x20, 0x06, 0x01, 0x02, 0x03, 0x16, 0x1E, 0x06, 0x01, 0x02, 0x03, 0x17, 0x1C, 0x06,
+	0x01, 0x02, 0x03, 0x17, 0x1B, 0x06, 0x01, 0x03, 0x03, 0x06, 0x08, 0x0A, 0x1A, 0x06, 0x01, 0x03,
+	0x04, 0x02, 0x0C, 0x09, 0x19, 0x06, 0x01, 0x02, 0x13, 0x08, 0x19, 0x06, 0x02, 0x02, 0x14, 0x08,
+	0x17, 0x06, 0x01, 0x02, 0x14, 0x08, 0x16, 0x06, 0x01, 0x02, 0x14, 0x07, 0x16, 0x06, 0x01, 0x02,
+	0x13, 0x08, 0x16, 0x06, 0x01, 0x02, 0x13, 0x08, 0x15, 0x06, 0x01, 0x02, 0x12, 0x08, 0x16, 0x06,
+	0x01, 0x02, 0x10, 0x09, 0x16, 0x06, 0x01, 0x02, 0x0D, 0x0B, 0x17, 0x06, 0x01, 0x02, 0x07, 0x10,
+	0x17, 0x06, 0x01, 0x02, 0x07, 0x0E, 0x19, 0x06, 0x01, 0x02, 0x07, 0x0E, 0x18, 0x06, 0x01, 0x02,
+	0x07, 0x11, 0x14, 0x06, 0x01, 0x02, 0x07, 0x12, 0x13, 0x06, 0x01, 0x02, 0x10, 0x0B, 0x10, 0x06,
+	0x01, 0x02, 0x12, 0x09, 0x10, 0x06, 0x01, 0x02, 0x13, 0x09, 0x0E, 0x06, 0x01, 0x02, 0x14, 0x09,
+	0x0D, 0x06, 0x01, 0x02, 0x15, 0x08, 0x0C, 0x06, 0x01, 0x02, 0x15, 0x08, 0x0B, 0x06, 0x01, 0x03,
+	0x15, 0x08, 0x0B, 0x06, 0x0F, 0x08, 0x01, 0x03, 0x15, 0x08, 0x0A, 0x06, 0x0F, 0x09, 0x01, 0x03,
+	0x15, 0x08, 0x0A, 0x06, 0x0E, 0x0A, 0x02, 0x03, 0x15, 0x08, 0x09, 0x06, 0x0E, 0x0B, 0x01, 0x03,
+	0x14, 0x09, 0x08, 0x06, 0x0E, 0x0C, 0x01, 0x04, 0x02, 0x02, 0x0F, 0x09, 0x08, 0x06, 0x0E, 0x0D,
+	0x01, 0x05, 0x01, 0x05, 0x0B, 0x0B, 0x08, 0x06, 0x0D, 0x06, 0x01, 0x07, 0x01, 0x04, 0x01, 0x1A,
+	0x08, 0x06, 0x0E, 0x06, 0x01, 0x07, 0x01, 0x04, 0x01, 0x19, 0x09, 0x06, 0x0D, 0x06, 0x02, 0x07,
+	0x01, 0x04, 0x00, 0x19, 0x09, 0x06, 0x0D, 0x07, 0x02, 0x07, 0x01, 0x04, 0x01, 0x16, 0x0B, 0x06,
+	0x0C, 0x07, 0x03, 0x07, 0x01, 0x04, 0x03, 0x12, 0x0C, 0x06, 0x0D, 0x06, 0x04, 0x07, 0x01, 0x04,
+	0x07, 0x0B, 0x0F, 0x06, 0x0C, 0x07, 0x04, 0x07, 0x01, 0x03, 0x20, 0x06, 0x0C, 0x07, 0x05, 0x07,
+	0x01, 0x03, 0x1F, 0x06, 0x0C, 0x07, 0x06, 0x07, 0x01, 0x03, 0x1F, 0x06, 0x0C, 0x06, 0x07, 0x07,
+	0x01, 0x03, 0x1E, 0x06, 0x0C, 0x07, 0x07, 0x07, 0x01, 0x03, 0x1E, 0x06, 0x0B, 0x07, 0x08, 0x07,
+	0x01, 0x03, 0x1D, 0x06, 0x0B, 0x07, 0x09, 0x07, 0x01, 0x03, 0x1D, 0x06, 0x0A, 0x07, 0x0A, 0x07,
+	0x01, 0x03, 0x1C, 0x06, 0x0B, 0x06, 0x0B, 0x07, 0x01, 0x03, 0x1B, 0x06, 0x0B, 0x07, 0x0B, 0x07,
+	0x01, 0x03, 0x1B, 0x06, 0x0A, 0x07, 0x0C, 0x07, 0x01, 0x03, 0x1A, 0x06, 0x0A, 0x07, 0x0D, 0x07,
+	0x01, 0x03, 0x1A, 0x06, 0x0A, 0x06, 0x0E, 0x07, 0x02, 0x02, 0x19, 0x06, 0x0A, 0x23, 0x01, 0x02,
+	0x18, 0x06, 0x0B, 0x23, 0x01, 0x02, 0x17, 0x07, 0x0B, 0x23, 0x01, 0x02, 0x17, 0x06, 0x0C, 0x23,
+	0x02, 0x02, 0x16, 0x06, 0x22, 0x07, 0x02, 0x02, 0x15, 0x06, 0x23, 0x07, 0x01, 0x02, 0x14, 0x06,
+	0x24, 0x07, 0x01, 0x02, 0x13, 0x07, 0x24, 0x07, 0x01, 0x02, 0x13, 0x06, 0x25, 0x07, 0x02, 0x02,
+	0x12, 0x06, 0x26, 0x07, 0x02, 0x02, 0x11, 0x06, 0x27, 0x07, 0x01, 0x01, 0x10, 0x06, 0x1A, 0x00,
+	// @28368 0xBF (33 pixels wide)
+	0x26, 0x00, 0x01, 0x01, 0x10, 0x06, 0x01, 0x01, 0x0F, 0x09, 0x02, 0x01, 0x0E, 0x0B, 0x01, 0x01,
+	0x0D, 0x0C, 0x03, 0x01, 0x0D, 0x0D, 0x01, 0x01, 0x0D, 0x0C, 0x02, 0x01, 0x0E, 0x0B, 0x01, 0x01,
+	0x0F, 0x09, 0x01, 0x01, 0x10, 0x06, 0x08, 0x00, 0x01, 0x01, 0x0F, 0x08, 0x08, 0x01, 0x0F, 0x09,
+	0x03, 0x01, 0x0E, 0x09, 0x02, 0x01, 0x0D, 0x09, 0x01, 0x01, 0x0C, 0x0A, 0x01, 0x01, 0x0C, 0x09,
+	0x01, 0x01, 0x0B, 0x0A, 0x01, 0x01, 0x0A, 0x0A, 0x01, 0x01, 0x0A, 0x09, 0x01, 0x01, 0x09, 0x0A,
+	0x01, 0x01, 0x08, 0x0A, 0x01, 0x01, 0x07, 0x0A, 0x02, 0x01, 0x06, 0x0A, 0x01, 0x01, 0x05, 0x0A,
+	0x01, 0x01, 0x04, 0x0A, 0x01, 0x01, 0x04, 0x09, 0x01, 0x01, 0x03, 0x0A, 0x02, 0x01, 0x02, 0x0A,
+	0x01, 0x01, 0x02, 0x09, 0x01, 0x01, 0x01, 0x0A, 0x01, 0x01, 0x01, 0x09, 0x08, 0x01, 0x00, 0x0A,
+	0x01, 0x01, 0x00, 0x0B, 0x01, 0x02, 0x01, 0x0A, 0x13, 0x01, 0x01, 0x02, 0x01, 0x0B, 0x11, 0x02,
+	0x01, 0x02, 0x01, 0x0D, 0x0C, 0x05, 0x01, 0x02, 0x02, 0x10, 0x04, 0x0A, 0x01, 0x01, 0x03, 0x1D,
+	0x01, 0x01, 0x03, 0x1E, 0x01, 0x01, 0x04, 0x1D, 0x01, 0x01, 0x05, 0x1B, 0x01, 0x01, 0x07, 0x18,
+	0x01, 0x01, 0x08, 0x14, 0x01, 0x01, 0x0B, 0x0E, 0x05, 0x00,
+	// @28554 0xC0 (60 pixels wide)
+	0x12, 0x00, 0x02, 0x01, 0x18, 0x0C, 0x01, 0x01, 0x17, 0x0D, 0x02, 0x01, 0x17, 0x0E, 0x01, 0x01,
+	0x16, 0x0F, 0x02, 0x01, 0x16, 0x10, 0x01, 0x02, 0x15, 0x08, 0x01, 0x08, 0x02, 0x02, 0x15, 0x08,
+	0x01, 0x09, 0x01, 0x02, 0x14, 0x08, 0x02, 0x09, 0x02, 0x02, 0x14, 0x08, 0x03, 0x09, 0x01, 0x02,
+	0x13, 0x09, 0x03, 0x09, 0x02, 0x02, 0x13, 0x08, 0x05, 0x09, 0x01, 0x02, 0x12, 0x09, 0x05, 0x09,
+	0x01, 0x02, 0x12, 0x09, 0x05, 0x0A, 0x01, 0x02, 0x12, 0x08, 0x07, 0x09, 0x01, 0x02, 0x11, 0x09,
+	0x07, 0x09, 0x01, 0x02, 0x11, 0x09, 0x07, 0x0A, 0x02, 0x02, 0x10, 0x09, 0x09, 0x09, 0x01, 0x02,
+	0x10, 0x09, 0x09, 0x0A, 0x02, 0x02, 0x0F, 0x09, 0x0B, 0x09, 0x01, 0x02, 0x0F, 0x09, 0x0B, 0x0A,
+	0x01, 0x02, 0x0E, 0x09, 0x0D, 0x09, 0x02, 0x02, 0x0E, 0x09, 0x0D, 0x0A, 0x01, 0x02, 0x0D, 0x09,
+	0x0F, 0x09, 0x02, 0x02, 0x0D, 0x09, 0x0F, 0x0A, 0x01, 0x02, 0x0C, 0x09, 0x11, 0x09, 0x01, 0x02,
+	0x0C, 0x09, 0x11, 0x0A, 0x01, 0x02, 0x0C, 0x09, 0x12, 0x09, 0x01, 0x02, 0x0B, 0x09, 0x13, 0x09,
+	0x01, 0x02, 0x0B, 0x09, 0x13, 0x0A, 0x01, 0x02, 0x0B, 0x09, 0x14, 0x09, 0x01, 0x02, 0x0A, 0x09,
+	0x15, 0x09, 0x01, 0x02, 0x0A, 0x09, 0x15, 0x0A, 0x01, 0x01, 0x0A, 0x28, 0x01, 0x01, 0x09, 0x29,
+	0x02, 0x01, 0x09, 0x2A, 0x01, 0x01, 0x08, 0x2B, 0x02, 0x01, 0x08, 0x2C, 0x01, 0x02, 0x07, 0x0A,
+	0x19, 0x0A, 0x02, 0x02, 0x07, 0x09, 0x1B, 0x0A, 0x01, 0x02, 0x06, 0x0A, 0x1B, 0x0A, 0x02, 0x02,
+	0x06, 0x09, 0x1D, 0x0A, 0x01, 0x02, 0x05, 0x0A, 0x1D, 0x0A, 0x02, 0x02, 0x05, 0x09, 0x1F, 0x0A,
+	0x01, 0x02, 0x04, 0x0A, 0x1F, 0x0A, 0x02, 0x02, 0x04, 0x09, 0x21, 0x0A, 0x01, 0x02, 0x03, 0x0A,
+	0x21, 0x0A, 0x02, 0x02, 0x03, 0x09, 0x23, 0x0A, 0x01, 0x02, 0x02, 0x0A, 0x24, 0x09, 0x02, 0x02,
+	0x02, 0x09, 0x25, 0x0A, 0x01, 0x02, 0x01, 0x0A, 0x26, 0x09, 0x02, 0x02, 0x01, 0x09, 0x27, 0x0A,
+	0x01, 0x02, 0x00, 0x0A, 0x28, 0x0A, 0x01, 0x02, 0x00, 0x09, 0x29, 0x0A, 0x1B, 0x00,
+	// @28856 0xC1 (46 pixels wide)
+	0x12, 0x00, 0x08, 0x01, 0x00, 0x29, 0x13, 0x01, 0x00, 0x09, 0x01, 0x01, 0x00, 0x1C, 0x01, 0x01,
+	0x00, 0x1F, 0x01, 0x01, 0x00, 0x22, 0x01, 0x01, 0x00, 0x24, 0x01, 0x01, 0x00, 0x25, 0x01, 0x01,
+	0x00, 0x27, 0x01, 0x01, 0x00, 0x28, 0x01, 0x02, 0x00, 0x09, 0x0F, 0x11, 0x01, 0x02, 0x00, 0x09,
+	0x12, 0x0F, 0x01, 0x02, 0x00, 0x09, 0x14, 0x0D, 0x01, 0x02, 0x00, 0x09, 0x16, 0x0C, 0x01, 0x02,
+	0x00, 0x09, 0x17, 0x0C, 0x01, 0x02, 0x00, 0x09, 0x18, 0x0B, 0x02, 0x02, 0x00, 0x09, 0x19, 0x0B,
+	0x01, 0x02, 0x00, 0x09, 0x1A, 0x0A, 0x01, 0x02, 0x00, 0x09, 0x1A, 0x0B, 0x0B, 0x02, 0x00, 0x09,
+	0x1B, 0x0A, 0x02, 0x02, 0x00, 0x09, 0x1A, 0x0A, 0x01, 0x02, 0x00, 0x09, 0x19, 0x0B, 0x01, 0x02,
+	0x00, 0x09, 0x19, 0x0A, 0x01, 0x02, 0x00, 0x09, 0x18, 0x0B, 0x01, 0x02, 0x00, 0x09, 0x17, 0x0B,
+	0x01, 0x02, 0x00, 0x09, 0x16, 0x0C, 0x01, 0x02, 0x00, 0x09, 0x14, 0x0D, 0x01, 0x02, 0x00, 0x09,
+	0x12, 0x0E, 0x01, 0x02, 0x00, 0x09, 0x0F, 0x10, 0x01, 0x01, 0x00, 0x27, 0x01, 0x01, 0x00, 0x26,
+	0x01, 0x01, 0x00, 0x25, 0x01, 0x01, 0x00, 0x23, 0x01, 0x01, 0x00, 0x21, 0x01, 0x01, 0x00, 0x1E,
+	0x01, 0x01, 0x00, 0x1A, 0x01, 0x01, 0x09, 0x0A, 0x1A, 0x00,
+	// @29042 0xC2 (46 pixels wide)
+	0x11, 0x00, 0x01, 0x01, 0x0B, 0x0B, 0x01, 0x01, 0x02, 0x1A, 0x01, 0x01, 0x00, 0x1F, 0x01, 0x01,
+	0x00, 0x22, 0x01, 0x01, 0x00, 0x23, 0x01, 0x01, 0x00, 0x25, 0x01, 0x01, 0x00, 0x26, 0x01, 0x01,
+	0x00, 0x27, 0x01, 0x02, 0x00, 0x09, 0x10, 0x0F, 0x01, 0x02, 0x00, 0x09, 0x13, 0x0D, 0x01, 0x02,
+	0x00, 0x09, 0x15, 0x0B, 0x01, 0x02, 0x00, 0x09, 0x16, 0x0B, 0x02, 0x02, 0x00, 0x09, 0x17, 0x0A,
+	0x08, 0x02, 0x00, 0x09, 0x18, 0x0A, 0x02, 0x02, 0x00, 0x09, 0x18, 0x09, 0x01, 0x02, 0x00, 0x09,
+	0x17, 0x0A, 0x01, 0x02, 0x00, 0x09, 0x17, 0x09, 0x01, 0x02, 0x00, 0x09, 0x16, 0x0A, 0x01, 0x02,
+	0x00, 0x09, 0x15, 0x0A, 0x01, 0x02, 0x00, 0x09, 0x14, 0x0A, 0x01, 0x02, 0x00, 0x09, 0x12, 0x0B,
+	0x01, 0x02, 0x00, 0x09, 0x10, 0x0C, 0x01, 0x01, 0x00, 0x24, 0x01, 0x01, 0x00, 0x22, 0x01, 0x01,
+	0x00, 0x20, 0x01, 0x01, 0x00, 0x1F, 0x01, 0x01, 0x00, 0x22, 0x01, 0x01, 0x00, 0x24, 0x01, 0x01,
+	0x00, 0x26, 0x01, 0x02, 0x00, 0x09, 0x0B, 0x13, 0x01, 0x02, 0x00, 0x09, 0x10, 0x0F, 0x01, 0x02,
+	0x00, 0x09, 0x13, 0x0D, 0x01, 0x02, 0x00, 0x09, 0x15, 0x0C, 0x01, 0x02, 0x00, 0x09, 0x16, 0x0C,
+	0x01, 0x02, 0x00, 0x09, 0x17, 0x0B, 0x01, 0x02, 0x00, 0x09, 0x18, 0x0B, 0x01, 0x02, 0x00, 0x09,
+	0x19, 0x0A, 0x03, 0x02, 0x00, 0x09, 0x1A, 0x0A, 0x01, 0x02, 0x00, 0x09, 0x1B, 0x09, 0x05, 0x02,
+	0x00, 0x09, 0x1B, 0x0A, 0x03, 0x02, 0x00, 0x09, 0x1A, 0x0A, 0x01, 0x02, 0x00, 0x09, 0x19, 0x0B,
+	0x01, 0x02, 0x00, 0x09, 0x19, 0x0A, 0x01, 0x02, 0x00, 0x09, 0x18, 0x0B, 0x01, 0x02, 0x00, 0x09,
+	0x17, 0x0C, 0x01, 0x02, 0x00, 0x09, 0x16, 0x0C, 0x01, 0x02, 0x00, 0x09, 0x15, 0x0C, 0x01, 0x02,
+	0x00, 0x09, 0x13, 0x0E, 0x01, 0x02, 0x00, 0x09, 0x10, 0x10, 0x01, 0x01, 0x00, 0x28, 0x01, 0x01,
+	0x00, 0x27, 0x01, 0x01, 0x00, 0x25, 0x01, 0x01, 0x00, 0x24, 0x01, 0x01, 0x00, 0x22, 0x01, 0x01,
+	0x00, 0x1F, 0x01, 0x01, 0x00, 0x1B, 0x01, 0x01, 0x08, 0x0B, 0x1A, 0x00,
+	// @29342 0xC3 (38 pixels wide)
+	0x12, 0x00, 0x08, 0x01, 0x00, 0x26, 0x40, 0x01, 0x00, 0x09, 0x1B, 0x00,
+	// @29354 0xC4 (63 pixels wide)
+	0x12, 0x00, 0x08, 0x01, 0x10, 0x28, 0x17, 0x02, 0x10, 0x09, 0x16, 0x09, 0x02, 0x02, 0x10, 0x08,
+	0x17, 0x09, 0x07, 0x02, 0x0F, 0x09, 0x17, 0x09, 0x01, 0x02, 0x0F, 0x08, 0x18, 0x09, 0x05, 0x02,
+	0x0E, 0x09, 0x18, 0x09, 0x03, 0x02, 0x0D, 0x09, 0x19, 0x09, 0x03, 0x02, 0x0C, 0x09, 0x1A, 0x09,
+	0x01, 0x02, 0x0B, 0x0A, 0x1A, 0x09, 0x01, 0x02, 0x0B, 0x09, 0x1B, 0x09, 0x01, 0x02, 0x0A, 0x0A,
+	0x1B, 0x09, 0x02, 0x02, 0x0A, 0x09, 0x1C, 0x09, 0x01, 0x02, 0x09, 0x0A, 0x1C, 0x09, 0x01, 0x02,
+	0x09, 0x09, 0x1D, 0x09, 0x01, 0x02, 0x08, 0x0A, 0x1D, 0x09, 0x01, 0x02, 0x08, 0x09, 0x1E, 0x09,
+	0x01, 0x02, 0x07, 0x0A, 0x1E, 0x09, 0x01, 0x02, 0x07, 0x09, 0x1F, 0x09, 0x01, 0x02, 0x06, 0x0A,
+	0x1F, 0x09, 0x01, 0x01, 0x04, 0x37, 0x07, 0x01, 0x00, 0x3F, 0x03, 0x02, 0x00, 0x09, 0x2D, 0x09,
+	0x01, 0x02, 0x00, 0x09, 0x2D, 0x08, 0x02, 0x02, 0x01, 0x08, 0x2D, 0x08, 0x02, 0x02, 0x01, 0x07,
+	0x2E, 0x08, 0x09, 0x02, 0x01, 0x07, 0x2F, 0x07, 0x0A, 0x00,
+	// @29508 0xC5 (41 pixels wide)
+	0x12, 0x00, 0x08, 0x01, 0x00, 0x27, 0x16, 0x01, 0x00, 0x09, 0x08, 0x01, 0x00, 0x25, 0x1A, 0x01,
+	0x00, 0x09, 0x08, 0x01, 0x00, 0x29, 0x1B, 0x00,
+	// @29532 0xC6 (83 pixels wide)
+	0x12, 0x00, 0x01, 0x03, 0x02, 0x0B, 0x18, 0x09, 0x19, 0x0B, 0x01, 0x03, 0x03, 0x0A, 0x18, 0x09,
+	0x19, 0x0A, 0x01, 0x03, 0x03, 0x0B, 0x17, 0x09, 0x18, 0x0A, 0x01, 0x03, 0x04, 0x0B, 0x16, 0x09,
+	0x17, 0x0B, 0x01, 0x03, 0x05, 0x0A, 0x16, 0x09, 0x16, 0x0B, 0x01, 0x03, 0x06, 0x0A, 0x15, 0x09,
+	0x16, 0x0A, 0x01, 0x03, 0x06, 0x0B, 0x14, 0x09, 0x15, 0x0A, 0x01, 0x03, 0x07, 0x0A, 0x14, 0x09,
+	0x14, 0x0B, 0x01, 0x03, 0x08, 0x0A, 0x13, 0x09, 0x14, 0x0A, 0x01, 0x03, 0x09, 0x0A, 0x12, 0x09,
+	0x13, 0x0A, 0x01, 0x03, 0x09, 0x0B, 0x11, 0x09, 0x12, 0x0A, 0x01, 0x03, 0x0A, 0x0A, 0x11, 0x09,
+	0x12, 0x0A, 0x01, 0x03, 0x0B, 0x0A, 0x10, 0x09, 0x11, 0x0A, 0x01, 0x03, 0x0C, 0x0A, 0x0F, 0x09,
+	0x10, 0x0A, 0x01, 0x03, 0x0D, 0x09, 0x0F, 0x09, 0x0F, 0x0A, 0x01, 0x03, 0x0D, 0x0A, 0x0E, 0x09,
+	0x0F, 0x09, 0x01, 0x03, 0x0E, 0x0A, 0x0D, 0x09, 0x0E, 0x0A, 0x01, 0x03, 0x0F, 0x09, 0x0D, 0x09,
+	0x0D, 0x0A, 0x01, 0x03, 0x10, 0x09, 0x0C, 0x09, 0x0D, 0x09, 0x01, 0x03, 0x10, 0x0A, 0x0B, 0x09,
+	0x0C, 0x09, 0x01, 0x03, 0x11, 0x0A, 0x0A, 0x09, 0x0B, 0x0A, 0x01, 0x03, 0x12, 0x09, 0x0A, 0x09,
+	0x0B, 0x09, 0x01, 0x03, 0x13, 0x09, 0x09, 0x09, 0x0A, 0x09, 0x01, 0x03, 0x13, 0x0A, 0x08, 0x09,
+	0x09, 0x09, 0x01, 0x03, 0x14, 0x09, 0x08, 0x09, 0x08, 0x09, 0x01, 0x03, 0x15, 0x09, 0x07, 0x09,
+	0x08, 0x09, 0x01, 0x03, 0x16, 0x09, 0x06, 0x09, 0x07, 0x09, 0x01, 0x03, 0x17, 0x08, 0x06, 0x09,
+	0x06, 0x09, 0x01, 0x03, 0x17, 0x09, 0x05, 0x09, 0x06, 0x08, 0x01, 0x03, 0x18, 0x09, 0x04, 0x09,
+	0x05, 0x09, 0x01, 0x03, 0x19, 0x09, 0x03, 0x09, 0x04, 0x09, 0x01, 0x03, 0x1A, 0x08, 0x03, 0x09,
+	0x04, 0x08, 0x01, 0x01, 0x1A, 0x1F, 0x01, 0x01, 0x18, 0x24, 0x01, 0x01, 0x15, 0x2A, 0x01, 0x01,
+	0x13, 0x2E, 0x01, 0x01, 0x11, 0x32, 0x01, 0x01, 0x10, 0x34, 0x01, 0x01, 0x0F, 0x36, 0x01, 0x03,
+	0x0E, 0x0F, 0x08, 0x09, 0x09, 0x0F, 0x01, 0x03, 0x0D, 0x0D, 0x0B, 0x09, 0x0C, 0x0D, 0x01, 0x03,
+	0x0C, 0x0C, 0x0D, 0x09, 0x0E, 0x0C, 0x01, 0x03, 0x0C, 0x0B, 0x0E, 0x09, 0x0F, 0x0B, 0x01, 0x03,
+	0x0B, 0x0B, 0x0F, 0x09, 0x10, 0x0B, 0x01, 0x03, 0x0B, 0x0A, 0x10, 0x09, 0x11, 0x0A, 0x01, 0x03,
+	0x0A, 0x0A, 0x11, 0x09, 0x12, 0x0A, 0x01, 0x03, 0x0A, 0x09, 0x12, 0x09, 0x12, 0x0A, 0x01, 0x03,
+	0x09, 0x0A, 0x12, 0x09, 0x13, 0x0A, 0x01, 0x03, 0x09, 0x09, 0x13, 0x09, 0x13, 0x0A, 0x01, 0x03,
+	0x08, 0x0A, 0x13, 0x09, 0x14, 0x0A, 0x01, 0x03, 0x08, 0x09, 0x14, 0x09, 0x14, 0x0A, 0x01, 0x03,
+	0x08, 0x09, 0x14, 0x09, 0x15, 0x09, 0x01, 0x03, 0x07, 0x0A, 0x14, 0x09, 0x15, 0x0A, 0x02, 0x03,
+	0x07, 0x09, 0x15, 0x09, 0x16, 0x09, 0x01, 0x03, 0x06, 0x09, 0x16, 0x09, 0x16, 0x0A, 0x01, 0x03,
+	0x06, 0x09, 0x16, 0x09, 0x17, 0x09, 0x01, 0x03, 0x05, 0x0A, 0x16, 0x09, 0x17, 0x09, 0x01, 0x03,
+	0x05, 0x09, 0x17, 0x09, 0x17, 0x0A, 0x02, 0x03, 0x05, 0x09, 0x17, 0x09, 0x18, 0x09, 0x01, 0x03,
+	0x04, 0x0A, 0x17, 0x09, 0x18, 0x0A, 0x01, 0x03, 0x04, 0x09, 0x18, 0x09, 0x18, 0x0A, 0x01, 0x03,
+	0x04, 0x09, 0x18, 0x09, 0x19, 0x09, 0x01, 0x03, 0x03, 0x0A, 0x18, 0x09, 0x19, 0x0A, 0x01, 0x03,
+	0x03, 0x09, 0x19, 0x09, 0x19, 0x0A, 0x01, 0x03, 0x02, 0x0A, 0x19, 0x09, 0x1A, 0x09, 0x01, 0x03,
+	0x02, 0x0A, 0x19, 0x09, 0x1A, 0x0A, 0x01, 0x03, 0x02, 0x09, 0x1A, 0x09, 0x1A, 0x0A, 0x01, 0x03,
+	0x01, 0x0A, 0x1A, 0x09, 0x1B, 0x09, 0x01, 0x03, 0x01, 0x09, 0x1B, 0x09, 0x1B, 0x0A, 0x01, 0x03,
+	0x00, 0x0A, 0x1B, 0x09, 0x1C, 0x09, 0x1B, 0x00,
+	// @30068 0xC7 (45 pixels wide)
+	0x11, 0x00, 0x01, 0x01, 0x0E, 0x0F, 0x01, 0x01, 0x0A, 0x16, 0x01, 0x01, 0x07, 0x1B, 0x01, 0x01,
+	0x05, 0x1F, 0x01, 0x01, 0x03, 0x22, 0x01, 0x01, 0x02, 0x24, 0x01, 0x01, 0x03, 0x24, 0x01, 0x02,
+	0x03, 0x0E, 0x06, 0x11, 0x01, 0x02, 0x04, 0x08, 0x0E, 0x0E, 0x01, 0x02, 0x04, 0x06, 0x12, 0x0D,
+	0x01, 0x02, 0x04, 0x04, 0x16, 0x0B, 0x01, 0x02, 0x05, 0x01, 0x19, 0x0B, 0x01, 0x01, 0x1F, 0x0B,
+	0x03, 0x01, 0x20, 0x0A, 0x03, 0x01, 0x21, 0x0A, 0x02, 0x01, 0x21, 0x09, 0x02, 0x01, 0x20, 0x0A,
+	0x01, 0x01, 0x20, 0x09, 0x02, 0x01, 0x1F, 0x0A, 0x01, 0x01, 0x1E, 0x0A, 0x01, 0x01, 0x1D, 0x0A,
+	0x01, 0x01, 0x1B, 0x0B, 0x01, 0x01, 0x1A, 0x0C, 0x01, 0x01, 0x18, 0x0D, 0x01, 0x01, 0x14, 0x0F,
+	0x01, 0x01, 0x0C, 0x16, 0x01, 0x01, 0x0C, 0x14, 0x02, 0x01, 0x0C, 0x12, 0x01, 0x01, 0x0C, 0x16,
+	0x01, 0x01, 0x0C, 0x18, 0x01, 0x01, 0x0C, 0x1A, 0x01, 0x01, 0x16, 0x11, 0x01, 0x01, 0x1A, 0x0E,
+	0x01, 0x01, 0x1C, 0x0D, 0x01, 0x01, 0x1E, 0x0C, 0x01, 0x01, 0x1F, 0x0C, 0x01, 0x01, 0x20, 0x0B,
+	0x01, 0x01, 0x21, 0x0B, 0x01, 0x01, 0x22, 0x0A, 0x01, 0x01, 0x22, 0x0B, 0x0A, 0x01, 0x23, 0x0A,
+	0x02, 0x01, 0x22, 0x0B, 0x01, 0x01, 0x21, 0x0B, 0x01, 0x01, 0x20, 0x0C, 0x01, 0x01, 0x20, 0x0B,
+	0x01, 0x02, 0x02, 0x03, 0x19, 0x0D, 0x01, 0x02, 0x02, 0x06, 0x15, 0x0D, 0x01, 0x02, 0x02, 0x09,
+	0x0F, 0x0F, 0x01, 0x02, 0x01, 0x10, 0x04, 0x13, 0x01, 0x01, 0x01, 0x26, 0x01, 0x01, 0x01, 0x25,
+	0x01, 0x01, 0x00, 0x25, 0x01, 0x01, 0x02, 0x21, 0x01, 0x01, 0x04, 0x1D, 0x01, 0x01, 0x07, 0x18,
+	0x01, 0x01, 0x0B, 0x10, 0x1A, 0x00,
+	// @30314 0xC8 (54 pixels wide)
+	0x12, 0x00, 0x01, 0x02, 0x00, 0x09, 0x24, 0x09, 0x01, 0x02, 0x00, 0x09, 0x23, 0x0A, 0x02, 0x02,
+	0x00, 0x09, 0x22, 0x0B, 0x01, 0x02, 0x00, 0x09, 0x21, 0x0C, 0x02, 0x02, 0x00, 0x09, 0x20, 0x0D,
+	0x02, 0x02, 0x00, 0x09, 0x1F, 0x0E, 0x01, 0x02, 0x00, 0x09, 0x1E, 0x0F, 0x02, 0x02, 0x00, 0x09,
+	0x1D, 0x10, 0x01, 0x02, 0x00, 0x09, 0x1C, 0x11, 0x02, 0x03, 0x00, 0x09, 0x1B, 0x09, 0x01, 0x08,
+	0x02, 0x03, 0x00, 0x09, 0x1A, 0x09, 0x02, 0x08, 0x01, 0x03, 0x00, 0x09, 0x19, 0x09, 0x03, 0x08,
+	0x01, 0x03, 0x00, 0x09, 0x18, 0x0A, 0x03, 0x08, 0x01, 0x03, 0x00, 0x09, 0x18, 0x09, 0x04, 0x08,
+	0x01, 0x03, 0x00, 0x09, 0x17, 0x0A, 0x04, 0x08, 0x02, 0x03, 0x00, 0x09, 0x16, 0x0A, 0x05, 0x08,
+	0x01, 0x03, 0x00, 0x09, 0x15, 0x0A, 0x06, 0x08, 0x02, 0x03, 0x00, 0x09, 0x14, 0x0A, 0x07, 0x08,
+	0x02, 0x03, 0x00, 0x09, 0x13, 0x0A, 0x08, 0x08, 0x01, 0x03, 0x00, 0x09, 0x12, 0x0A, 0x09, 0x08,
+	0x01, 0x03, 0x00, 0x09, 0x11, 0x0B, 0x09, 0x08, 0x01, 0x03, 0x00, 0x09, 0x11, 0x0A, 0x0A, 0x08,
+	0x01, 0x03, 0x00, 0x09, 0x10, 0x0A, 0x0B, 0x08, 0x01, 0x03, 0x00, 0x09, 0x0F, 0x0B, 0x0B, 0x08,
+	0x01, 0x03, 0x00, 0x09, 0x0F, 0x0A, 0x0C, 0x08, 0x01, 0x03, 0x00, 0x09, 0x0E, 0x0B, 0x0C, 0x08,
+	0x01, 0x03, 0x00, 0x09, 0x0E, 0x0A, 0x0D, 0x08, 0x01, 0x03, 0x00, 0x09, 0x0D, 0x0A, 0x0E, 0x08,
+	0x01, 0x03, 0x00, 0x09, 0x0C, 0x0B, 0x0E, 0x08, 0x01, 0x03, 0x00, 0x09, 0x0C, 0x0A, 0x0F, 0x08,
+	0x01, 0x03, 0x00, 0x09, 0x0B, 0x0B, 0x0F, 0x08, 0x01, 0x03, 0x00, 0x09, 0x0A, 0x0B, 0x10, 0x08,
+	0x01, 0x03, 0x00, 0x09, 0x0A, 0x0A, 0x10, 0x09, 0x01, 0x03, 0x00, 0x09, 0x09, 0x0B, 0x10, 0x09,
+	0x01, 0x03, 0x00, 0x09, 0x09, 0x0A, 0x11, 0x09, 0x02, 0x03, 0x00, 0x09, 0x08, 0x0A, 0x12, 0x09,
+	0x01, 0x03, 0x00, 0x09, 0x07, 0x0A, 0x13, 0x09, 0x01, 0x03, 0x00, 0x09, 0x06, 0x0B, 0x13, 0x09,
+	0x01, 0x03, 0x00, 0x09, 0x06, 0x0A, 0x14, 0x09, 0x02, 0x03, 0x00, 0x09, 0x05, 0x0A, 0x15, 0x09,
+	0x01, 0x03, 0x00, 0x09, 0x04, 0x0A, 0x16, 0x09, 0x01, 0x03, 0x00, 0x08, 0x05, 0x09, 0x17, 0x09,
+	0x01, 0x03, 0x00, 0x08, 0x04, 0x0A, 0x17, 0x09, 0x01, 0x03, 0x00, 0x08, 0x04, 0x09, 0x18, 0x09,
+	0x01, 0x03, 0x00, 0x08, 0x03, 0x09, 0x19, 0x09, 0x01, 0x03, 0x00, 0x08, 0x02, 0x0A, 0x19, 0x09,
+	0x01, 0x03, 0x00, 0x08, 0x02, 0x09, 0x1A, 0x09, 0x01, 0x03, 0x00, 0x08, 0x01, 0x0A, 0x1A, 0x09,
+	0x01, 0x03, 0x00, 0x08, 0x01, 0x09, 0x1B, 0x09, 0x01, 0x03, 0x00, 0x08, 0x01, 0x08, 0x1C, 0x09,
+	0x01, 0x02, 0x00, 0x11, 0x1C, 0x09, 0x01, 0x02, 0x00, 0x10, 0x1D, 0x09, 0x02, 0x02, 0x00, 0x0F,
+	0x1E, 0x09, 0x02, 0x02, 0x00, 0x0E, 0x1F, 0x09, 0x01, 0x02, 0x00, 0x0D, 0x20, 0x09, 0x02, 0x02,
+	0x00, 0x0C, 0x21, 0x09, 0x01, 0x02, 0x00, 0x0B, 0x22, 0x09, 0x01, 0x02, 0x00, 0x0A, 0x23, 0x09,
+	0x1B, 0x00,
+	// @30748 0xC9 (54 pixels wide)
+	0x03, 0x00, 0x01, 0x02, 0x0E, 0x07, 0x0D, 0x07, 0x01, 0x02, 0x0E, 0x07, 0x0C, 0x08, 0x01, 0x02,
+	0x0E, 0x07, 0x0C, 0x07, 0x01, 0x02, 0x0E, 0x08, 0x0B, 0x07, 0x01, 0x02, 0x0F, 0x08, 0x09, 0x08,
+	0x01, 0x02, 0x0F, 0x09, 0x07, 0x08, 0x01, 0x01, 0x10, 0x17, 0x01, 0x01, 0x10, 0x16, 0x01, 0x01,
+	0x11, 0x14, 0x01, 0x01, 0x13, 0x10, 0x01, 0x01, 0x15, 0x0C, 0x04, 0x00, 0x01, 0x02, 0x00, 0x09,
+	0x24, 0x09, 0x01, 0x02, 0x00, 0x09, 0x23, 0x0A, 0x02, 0x02, 0x00, 0x09, 0x22, 0x0B, 0x01, 0x02,
+	0x00, 0x09, 0x21, 0x0C, 0x02, 0x02, 0x00, 0x09, 0x20, 0x0D, 0x02, 0x02, 0x00, 0x09, 0x1F, 0x0E,
+	0x01, 0x02, 0x00, 0x09, 0x1E, 0x0F, 0x02, 0x02, 0x00, 0x09, 0x1D, 0x10, 0x01, 0x02, 0x00, 0x09,
+	0x1C, 0x11, 0x02, 0x03, 0x00, 0x09, 0x1B, 0x09, 0x01, 0x08, 0x02, 0x03, 0x00, 0x09, 0x1A, 0x09,
+	0x02, 0x08, 0x01, 0x03, 0x00, 0x09, 0x19, 0x09, 0x03, 0x08, 0x01, 0x03, 0x00, 0x09, 0x18, 0x0A,
+	0x03, 0x08, 0x01, 0x03, 0x00, 0x09, 0x18, 0x09, 0x04, 0x08, 0x01, 0x03, 0x00, 0x09, 0x17, 0x0A,
+	0x04, 0x08, 0x02, 0x03, 0x00, 0x09, 0x16, 0x0A, 0x05, 0x08, 0x01, 0x03, 0x00, 0x09, 0x15, 0x0A,
+	0x06, 0x08, 0x02, 0x03, 0x00, 0x09, 0x14, 0x0A, 0x07, 0x08, 0x02, 0x03, 0x00, 0x09, 0x13, 0x0A,
+	0x08, 0x08, 0x01, 0x03, 0x00, 0x09, 0x12, 0x0A, 0x09, 0x08, 0x01, 0x03, 0x00, 0x09, 0x11, 0x0B,
+	0x09, 0x08, 0x01, 0x03, 0x00, 0x09, 0x11, 0x0A, 0x0A, 0x08, 0x01, 0x03, 0x00, 0x09, 0x10, 0x0A,
+	0x0B, 0x08, 0x01, 0x03, 0x00, 0x09, 0x0F, 0x0B, 0x0B, 0x08, 0x01, 0x03, 0x00, 0x09, 0x0F, 0x0A,
+	0x0C, 0x08, 0x01, 0x03, 0x00, 0x09, 0x0E, 0x0B, 0x0C, 0x08, 0x01, 0x03, 0x00, 0x09, 0x0E, 0x0A,
+	0x0D, 0x08, 0x01, 0x03, 0x00, 0x09, 0x0D, 0x0A, 0x0E, 0x08, 0x01, 0x03, 0x00, 0x09, 0x0C, 0x0B,
+	0x0E, 0x08, 0x01, 0x03, 0x00, 0x09, 0x0C, 0x0A, 0x0F, 0x08, 0x01, 0x03, 0x00, 0x09, 0x0B, 0x0B,
+	0x0F, 0x08, 0x01, 0x03, 0x00, 0x09, 0x0A, 0x0B, 0x10, 0x08, 0x01, 0x03, 0x00, 0x09, 0x0A, 0x0A,
+	0x10, 0x09, 0x01, 0x03, 0x00, 0x09, 0x09, 0x0B, 0x10, 0x09, 0x01, 0x03, 0x00, 0x09, 0x09, 0x0A,
+	0x11, 0x09, 0x02, 0x03, 0x00, 0x09, 0x08, 0x0A, 0x12, 0x09, 0x01, 0x03, 0x00, 0x09, 0x07, 0x0A,
+	0x13, 0x09, 0x01, 0x03, 0x00, 0x09, 0x06, 0x0B, 0x13, 0x09, 0x01, 0x03, 0x00, 0x09, 0x06, 0x0A,
+	0x14, 0x09, 0x02, 0x03, 0x00, 0x09, 0x05, 0x0A, 0x15, 0x09, 0x01, 0x03, 0x00, 0x09, 0x04, 0x0A,
+	0x16, 0x09, 0x01, 0x03, 0x00, 0x08, 0x05, 0x09, 0x17, 0x09, 0x01, 0x03, 0x00, 0x08, 0x04, 0x0A,
+	0x17, 0x09, 0x01, 0x03, 0x00, 0x08, 0x04, 0x09, 0x18, 0x09, 0x01, 0x03, 0x00, 0x08, 0x03, 0x09,
+	0x19, 0x09, 0x01, 0x03, 0x00, 0x08, 0x02, 0x0A, 0x19, 0x09, 0x01, 0x03, 0x00, 0x08, 0x02, 0x09,
+	0x1A, 0x09, 0x01, 0x03, 0x00, 0x08, 0x01, 0x0A, 0x1A, 0x09, 0x01, 0x03, 0x00, 0x08, 0x01, 0x09,
+	0x1B, 0x09, 0x01, 0x03, 0x00, 0x08, 0x01, 0x08, 0x1C, 0x09, 0x01, 0x02, 0x00, 0x11, 0x1C, 0x09,
+	0x01, 0x02, 0x00, 0x10, 0x1D, 0x09, 0x02, 0x02, 0x00, 0x0F, 0x1E, 0x09, 0x02, 0x02, 0x00, 0x0E,
+	0x1F, 0x09, 0x01, 0x02, 0x00, 0x0D, 0x20, 0x09, 0x02, 0x02, 0x00, 0x0C, 0x21, 0x09, 0x01, 0x02,
+	0x00, 0x0B, 0x22, 0x09, 0x01, 0x02, 0x00, 0x0A, 0x23, 0x09, 0x1B, 0x00,
+	// @31240 0xCA (49 pixels wide)
+	0x12, 0x00, 0x01, 0x02, 0x00, 0x09, 0x1C, 0x0B, 0x01, 0x02, 0x00, 0x09, 0x1B, 0x0B, 0x01, 0x02,
+	0x00, 0x09, 0x1A, 0x0B, 0x01, 0x02, 0x00, 0x09, 0x19, 0x0B, 0x02, 0x02, 0x00, 0x09, 0x18, 0x0B,
+	0x01, 0x02, 0x00, 0x09, 0x17, 0x0B, 0x01, 0x02, 0x00, 0x09, 0x16, 0x0B, 0x01, 0x02, 0x00, 0x09,
+	0x15, 0x0B, 0x01, 0x02, 0x00, 0x09, 0x15, 0x0A, 0x01, 0x02, 0x00, 0x09, 0x14, 0x0A, 0x01, 0x02,
+	0x00, 0x09, 0x13, 0x0B, 0x01, 0x02, 0x00, 0x09, 0x12, 0x0B, 0x01, 0x02, 0x00, 0x09, 0x12, 0x0A,
+	0x01, 0x02, 0x00, 0x09, 0x11, 0x0A, 0x01, 0x02, 0x00, 0x09, 0x10, 0x0A, 0x01, 0x02, 0x00, 0x09,
+	0x0F, 0x0A, 0x01, 0x02, 0x00, 0x09, 0x0E, 0x0B, 0x01, 0x02, 0x00, 0x09, 0x0E, 0x0A, 0x01, 0x02,
+	0x00, 0x09, 0x0D, 0x0A, 0x01, 0x02, 0x00, 0x09, 0x0C, 0x0A, 0x02, 0x02, 0x00, 0x09, 0x0B, 0x0A,
+	0x01, 0x02, 0x00, 0x09, 0x0A, 0x0A, 0x01, 0x02, 0x00, 0x09, 0x09, 0x0A, 0x01, 0x02, 0x00, 0x09,
+	0x08, 0x0A, 0x01, 0x02, 0x00, 0x09, 0x07, 0x0A, 0x01, 0x02, 0x00, 0x09, 0x07, 0x09, 0x01, 0x02,
+	0x00, 0x09, 0x06, 0x0A, 0x01, 0x02, 0x00, 0x09, 0x05, 0x0A, 0x01, 0x02, 0x00, 0x09, 0x04, 0x0A,
+	0x01, 0x02, 0x00, 0x09, 0x04, 0x09, 0x01, 0x01, 0x00, 0x15, 0x01, 0x01, 0x00, 0x18, 0x01, 0x01,
+	0x00, 0x1B, 0x01, 0x01, 0x00, 0x1D, 0x01, 0x01, 0x00, 0x1F, 0x01, 0x01, 0x00, 0x20, 0x01, 0x01,
+	0x00, 0x21, 0x01, 0x02, 0x00, 0x09, 0x09, 0x10, 0x01, 0x02, 0x00, 0x09, 0x0C, 0x0E, 0x01, 0x02,
+	0x00, 0x09, 0x0E, 0x0D, 0x01, 0x02, 0x00, 0x09, 0x10, 0x0C, 0x01, 0x02, 0x00, 0x09, 0x11, 0x0B,
+	0x01, 0x02, 0x00, 0x09, 0x12, 0x0B, 0x01, 0x02, 0x00, 0x09, 0x13, 0x0A, 0x01, 0x02, 0x00, 0x09,
+	0x13, 0x0B, 0x01, 0x02, 0x00, 0x09, 0x14, 0x0A, 0x02, 0x02, 0x00, 0x09, 0x15, 0x0A, 0x02, 0x02,
+	0x00, 0x09, 0x16, 0x0A, 0x01, 0x02, 0x00, 0x09, 0x17, 0x09, 0x02, 0x02, 0x00, 0x09, 0x17, 0x0A,
+	0x03, 0x02, 0x00, 0x09, 0x18, 0x0A, 0x03, 0x02, 0x00, 0x09, 0x19, 0x0A, 0x03, 0x02, 0x00, 0x09,
+	0x1A, 0x0A, 0x02, 0x02, 0x00, 0x09, 0x1B, 0x0A, 0x03, 0x02, 0x00, 0x09, 0x1C, 0x0A, 0x02, 0x02,
+	0x00, 0x09, 0x1D, 0x0A, 0x01, 0x02, 0x00, 0x09, 0x1E, 0x0A, 0x1B, 0x00,
+	// @31572 0xCB (57 pixels wide)
+	0x12, 0x00, 0x08, 0x01, 0x0E, 0x2B, 0x26, 0x02, 0x0E, 0x09, 0x18, 0x0A, 0x02, 0x02, 0x0D, 0x0A,
+	0x18, 0x0A, 0x04, 0x02, 0x0D, 0x09, 0x19, 0x0A, 0x02, 0x02, 0x0C, 0x0A, 0x19, 0x0A, 0x01, 0x02,
+	0x0C, 0x09, 0x1A, 0x0A, 0x03, 0x02, 0x0B, 0x0A, 0x1A, 0x0A, 0x01, 0x02, 0x0A, 0x0A, 0x1B, 0x0A,
+	0x01, 0x02, 0x09, 0x0B, 0x1B, 0x0A, 0x01, 0x02, 0x09, 0x0A, 0x1C, 0x0A, 0x01, 0x02, 0x08, 0x0B,
+	0x1C, 0x0A, 0x01, 0x02, 0x07, 0x0B, 0x1D, 0x0A, 0x01, 0x02, 0x05, 0x0D, 0x1D, 0x0A, 0x01, 0x02,
+	0x03, 0x0E, 0x1E, 0x0A, 0x01, 0x02, 0x00, 0x11, 0x1E, 0x0A, 0x01, 0x02, 0x00, 0x10, 0x1F, 0x0A,
+	0x01, 0x02, 0x01, 0x0E, 0x20, 0x0A, 0x01, 0x02, 0x01, 0x0D, 0x21, 0x0A, 0x01, 0x02, 0x01, 0x0B,
+	0x23, 0x0A, 0x01, 0x02, 0x01, 0x0A, 0x24, 0x0A, 0x01, 0x02, 0x01, 0x07, 0x27, 0x0A, 0x01, 0x01,
+	0x01, 0x04, 0x1A, 0x00,
+	// @31704 0xCC (74 pixels wide)
+	0x12, 0x00, 0x01, 0x02, 0x05, 0x0C, 0x28, 0x0C, 0x01, 0x02, 0x05, 0x0D, 0x27, 0x0C, 0x02, 0x02,
+	0x05, 0x0D, 0x26, 0x0E, 0x01, 0x02, 0x05, 0x0E, 0x25, 0x0E, 0x02, 0x02, 0x05, 0x0E, 0x24, 0x0F,
+	0x01, 0x02, 0x05, 0x0F, 0x23, 0x0F, 0x01, 0x02, 0x05, 0x0F, 0x22, 0x10, 0x01, 0x04, 0x05, 0x07,
+	0x01, 0x07, 0x22, 0x07, 0x01, 0x08, 0x01, 0x04, 0x04, 0x08, 0x01, 0x08, 0x21, 0x07, 0x01, 0x08,
+	0x01, 0x04, 0x04, 0x08, 0x01, 0x08, 0x20, 0x08, 0x01, 0x08, 0x01, 0x04, 0x04, 0x08, 0x01, 0x09,
+	0x1F, 0x07, 0x02, 0x08, 0x02, 0x04, 0x04, 0x08, 0x02, 0x08, 0x1E, 0x08, 0x02, 0x08, 0x01, 0x04,
+	0x04, 0x08, 0x02, 0x09, 0x1D, 0x08, 0x02, 0x08, 0x01, 0x04, 0x04, 0x08, 0x02, 0x09, 0x1C, 0x08,
+	0x03, 0x08, 0x01, 0x04, 0x04, 0x08, 0x03, 0x08, 0x1C, 0x08, 0x03, 0x08, 0x01, 0x04, 0x04, 0x08,
+	0x03, 0x09, 0x1B, 0x08, 0x03, 0x09, 0x01, 0x04, 0x04, 0x08, 0x03, 0x09, 0x1A, 0x08, 0x04, 0x09,
+	0x01, 0x04, 0x04, 0x08, 0x04, 0x08, 0x1A, 0x08, 0x04, 0x09, 0x01, 0x04, 0x04, 0x08, 0x04, 0x09,
+	0x18, 0x09, 0x04, 0x09, 0x02, 0x04, 0x04, 0x08, 0x04, 0x09, 0x18, 0x08, 0x05, 0x09, 0x01, 0x04,
+	0x04, 0x08, 0x05, 0x09, 0x16, 0x09, 0x05, 0x09, 0x01, 0x04, 0x03, 0x09, 0x05, 0x09, 0x16, 0x08,
+	0x06, 0x09, 0x01, 0x04, 0x03, 0x09, 0x05, 0x0A, 0x15, 0x08, 0x06, 0x09, 0x01, 0x04, 0x03, 0x09,
+	0x06, 0x09, 0x14, 0x09, 0x06, 0x09, 0x01, 0x04, 0x03, 0x09, 0x06, 0x09, 0x14, 0x08, 0x07, 0x09,
+	0x01, 0x04, 0x03, 0x09, 0x06, 0x0A, 0x13, 0x08, 0x07, 0x09, 0x01, 0x04, 0x03, 0x09, 0x07, 0x09,
+	0x12, 0x09, 0x07, 0x09, 0x01, 0x04, 0x03, 0x09, 0x07, 0x09, 0x12, 0x08, 0x08, 0x09, 0x01, 0x04,
+	0x03, 0x09, 0x07, 0x0A, 0x10, 0x09, 0x08, 0x09, 0x01, 0x04, 0x03, 0x08, 0x09, 0x09, 0x10, 0x09,
+	0x09, 0x08, 0x01, 0x04, 0x03, 0x08, 0x09, 0x09, 0x10, 0x08, 0x0A, 0x08, 0x01, 0x04, 0x03, 0x08,
+	0x09, 0x0A, 0x0E, 0x09, 0x0A, 0x09, 0x02, 0x04, 0x03, 0x08, 0x0A, 0x09, 0x0E, 0x08, 0x0B, 0x09,
+	0x01, 0x04, 0x03, 0x08, 0x0A, 0x0A, 0x0C, 0x09, 0x0B, 0x09, 0x02, 0x04, 0x02, 0x09, 0x0B, 0x09,
+	0x0C, 0x08, 0x0C, 0x09, 0x01, 0x04, 0x02, 0x09, 0x0B, 0x0A, 0x0A, 0x09, 0x0C, 0x09, 0x02, 0x04,
+	0x02, 0x09, 0x0C, 0x09, 0x0A, 0x08, 0x0D, 0x09, 0x01, 0x04, 0x02, 0x09, 0x0C, 0x0A, 0x08, 0x09,
+	0x0D, 0x09, 0x02, 0x04, 0x02, 0x09, 0x0D, 0x09, 0x08, 0x08, 0x0E, 0x09, 0x01, 0x04, 0x02, 0x09,
+	0x0D, 0x09, 0x07, 0x08, 0x0F, 0x09, 0x02, 0x04, 0x02, 0x09, 0x0E, 0x09, 0x06, 0x08, 0x0F, 0x09,
+	0x01, 0x04, 0x02, 0x08, 0x0F, 0x09, 0x05, 0x08, 0x10, 0x09, 0x02, 0x04, 0x02, 0x08, 0x10, 0x09,
+	0x04, 0x08, 0x11, 0x09, 0x01, 0x04, 0x02, 0x08, 0x10, 0x09, 0x03, 0x08, 0x12, 0x09, 0x01, 0x04,
+	0x01, 0x09, 0x11, 0x08, 0x03, 0x08, 0x12, 0x09, 0x01, 0x04, 0x01, 0x09, 0x11, 0x09, 0x02, 0x08,
+	0x12, 0x09, 0x01, 0x04, 0x01, 0x09, 0x11, 0x09, 0x02, 0x07, 0x13, 0x09, 0x01, 0x04, 0x01, 0x09,
+	0x12, 0x08, 0x01, 0x08, 0x13, 0x09, 0x02, 0x03, 0x01, 0x09, 0x12, 0x10, 0x14, 0x09, 0x01, 0x03,
+	0x01, 0x09, 0x13, 0x0F, 0x14, 0x09, 0x01, 0x03, 0x01, 0x09, 0x13, 0x0E, 0x15, 0x09, 0x02, 0x03,
+	0x01, 0x09, 0x14, 0x0D, 0x15, 0x09, 0x01, 0x03, 0x01, 0x09, 0x14, 0x0C, 0x16, 0x09, 0x01, 0x03,
+	0x01, 0x09, 0x15, 0x0B, 0x16, 0x09, 0x01, 0x03, 0x01, 0x08, 0x16, 0x0B, 0x16, 0x09, 0x01, 0x03,
+	0x01, 0x08, 0x16, 0x0A, 0x17, 0x0A, 0x01, 0x03, 0x00, 0x09, 0x17, 0x09, 0x17, 0x0A, 0x02, 0x03,
+	0x00, 0x09, 0x17, 0x08, 0x19, 0x09, 0x01, 0x03, 0x00, 0x09, 0x18, 0x07, 0x19, 0x09, 0x1B, 0x00,
+	// @32248 0xCD (54 pixels wide)
+	0x12, 0x00, 0x1E, 0x02, 0x00, 0x09, 0x23, 0x0A, 0x08, 0x01, 0x00, 0x36, 0x22, 0x02, 0x00, 0x09,
+	0x23, 0x0A, 0x1B, 0x00,
+	// @32268 0xCE (66 pixels wide)
+	0x11, 0x00, 0x01, 0x01, 0x1A, 0x0F, 0x01, 0x01, 0x16, 0x17, 0x01, 0x01, 0x14, 0x1B, 0x01, 0x01,
+	0x12, 0x1F, 0x01, 0x01, 0x10, 0x23, 0x01, 0x01, 0x0E, 0x26, 0x01, 0x01, 0x0D, 0x28, 0x01, 0x02,
+	0x0C, 0x12, 0x06, 0x13, 0x01, 0x02, 0x0B, 0x0F, 0x0E, 0x10, 0x01, 0x02, 0x0A, 0x0D, 0x13, 0x0F,
+	0x01, 0x02, 0x09, 0x0C, 0x17, 0x0D, 0x01, 0x02, 0x08, 0x0C, 0x1A, 0x0C, 0x01, 0x02, 0x07, 0x0C,
+	0x1C, 0x0C, 0x01, 0x02, 0x07, 0x0B, 0x1E, 0x0C, 0x01, 0x02, 0x06, 0x0B, 0x20, 0x0B, 0x01, 0x02,
+	0x05, 0x0B, 0x21, 0x0C, 0x01, 0x02, 0x05, 0x0A, 0x23, 0x0B, 0x01, 0x02, 0x04, 0x0B, 0x24, 0x0B,
+	0x01, 0x02, 0x04, 0x0A, 0x25, 0x0B, 0x01, 0x02, 0x03, 0x0B, 0x26, 0x0B, 0x01, 0x02, 0x03, 0x0A,
+	0x28, 0x0A, 0x01, 0x02, 0x02, 0x0B, 0x28, 0x0B, 0x01, 0x02, 0x02, 0x0A, 0x29, 0x0B, 0x02, 0x02,
+	0x02, 0x0A, 0x2A, 0x0A, 0x01, 0x02, 0x01, 0x0A, 0x2B, 0x0B, 0x03, 0x02, 0x01, 0x0A, 0x2C, 0x0A,
+	0x01, 0x02, 0x00, 0x0A, 0x2D, 0x0A, 0x01, 0x02, 0x00, 0x0A, 0x2E, 0x09, 0x0B, 0x02, 0x00, 0x0A,
+	0x2E, 0x0A, 0x01, 0x02, 0x00, 0x0A, 0x2E, 0x09, 0x03, 0x02, 0x00, 0x0A, 0x2D, 0x0A, 0x02, 0x02,
+	0x01, 0x0A, 0x2C, 0x0A, 0x01, 0x02, 0x01, 0x0A, 0x2B, 0x0A, 0x01, 0x02, 0x01, 0x0B, 0x2A, 0x0A,
+	0x01, 0x02, 0x02, 0x0A, 0x2A, 0x0A, 0x01, 0x02, 0x02, 0x0A, 0x29, 0x0B, 0x01, 0x02, 0x02, 0x0B,
+	0x28, 0x0A, 0x01, 0x02, 0x03, 0x0A, 0x27, 0x0B, 0x01, 0x02, 0x03, 0x0B, 0x26, 0x0A, 0x01, 0x02,
+	0x03, 0x0B, 0x25, 0x0B, 0x01, 0x02, 0x04, 0x0B, 0x24, 0x0A, 0x01, 0x02, 0x04, 0x0C, 0x22, 0x0B,
+	0x01, 0x02, 0x05, 0x0B, 0x21, 0x0B, 0x01, 0x02, 0x05, 0x0C, 0x20, 0x0B, 0x01, 0x02, 0x06, 0x0C,
+	0x1E, 0x0B, 0x01, 0x02, 0x07, 0x0C, 0x1C, 0x0B, 0x01, 0x02, 0x08, 0x0C, 0x19, 0x0D, 0x01, 0x02,
+	0x08, 0x0E, 0x16, 0x0D, 0x01, 0x02, 0x09, 0x0E, 0x13, 0x0E, 0x01, 0x02, 0x0A, 0x10, 0x0E, 0x0F,
+	0x01, 0x02, 0x0B, 0x14, 0x04, 0x13, 0x01, 0x01, 0x0C, 0x29, 0x01, 0x01, 0x0E, 0x25, 0x01, 0x01,
+	0x0F, 0x23, 0x01, 0x01, 0x11, 0x1F, 0x01, 0x01, 0x13, 0x1B, 0x01, 0x01, 0x15, 0x17, 0x01, 0x01,
+	0x19, 0x0F, 0x1A, 0x00,
+	// @32592 0xCF (52 pixels wide)
+	0x12, 0x00, 0x08, 0x01, 0x00, 0x34, 0x40, 0x02, 0x00, 0x09, 0x22, 0x09, 0x1B, 0x00,
+	// @32606 0xD0 (45 pixels wide)
+	0x11, 0x00, 0x01, 0x01, 0x0C, 0x0B, 0x01, 0x01, 0x02, 0x1B, 0x01, 0x01, 0x00, 0x20, 0x01, 0x01,
+	0x00, 0x22, 0x01, 0x01, 0x00, 0x24, 0x01, 0x01, 0x00, 0x25, 0x01, 0x01, 0x00, 0x26, 0x01, 0x01,
+	0x00, 0x27, 0x01, 0x02, 0x00, 0x09, 0x10, 0x0F, 0x01, 0x02, 0x00, 0x09, 0x13, 0x0D, 0x01, 0x02,
+	0x00, 0x09, 0x15, 0x0C, 0x01, 0x02, 0x00, 0x09, 0x16, 0x0B, 0x01, 0x02, 0x00, 0x09, 0x17, 0x0B,
+	0x01, 0x02, 0x00, 0x09, 0x18, 0x0A, 0x01, 0x02, 0x00, 0x09, 0x18, 0x0B, 0x02, 0x02, 0x00, 0x09,
+	0x19, 0x0A, 0x01, 0x02, 0x00, 0x09, 0x1A, 0x09, 0x07, 0x02, 0x00, 0x09, 0x1A, 0x0A, 0x02, 0x02,
+	0x00, 0x09, 0x1A, 0x09, 0x02, 0x02, 0x00, 0x09, 0x19, 0x0A, 0x02, 0x02, 0x00, 0x09, 0x18, 0x0A,
+	0x01, 0x02, 0x00, 0x09, 0x17, 0x0B, 0x01, 0x02, 0x00, 0x09, 0x16, 0x0B, 0x01, 0x02, 0x00, 0x09,
+	0x15, 0x0C, 0x01, 0x02, 0x00, 0x09, 0x14, 0x0C, 0x01, 0x02, 0x00, 0x09, 0x12, 0x0D, 0x01, 0x02,
+	0x00, 0x0A, 0x0D, 0x10, 0x01, 0x01, 0x00, 0x26, 0x01, 0x01, 0x00, 0x25, 0x01, 0x01, 0x00, 0x24,
+	0x01, 0x01, 0x00, 0x22, 0x01, 0x01, 0x00, 0x20, 0x01, 0x01, 0x00, 0x1E, 0x01, 0x01, 0x00, 0x1B,
+	0x01, 0x02, 0x00, 0x09, 0x04, 0x07, 0x1C, 0x01, 0x00, 0x09, 0x1B, 0x00,
+	// @32794 0xD1 (54 pixels wide)
+	0x11, 0x00, 0x01, 0x01, 0x1D, 0x11, 0x01, 0x01, 0x19, 0x1A, 0x01, 0x01, 0x16, 0x20, 0x01, 0x01,
+	0x14, 0x22, 0x01, 0x01, 0x12, 0x24, 0x01, 0x01, 0x10, 0x26, 0x01, 0x01, 0x0F, 0x27, 0x01, 0x01,
+	0x0D, 0x28, 0x01, 0x02, 0x0C, 0x12, 0x10, 0x07, 0x01, 0x02, 0x0B, 0x0F, 0x18, 0x03, 0x01, 0x01,
+	0x0A, 0x0E, 0x01, 0x01, 0x09, 0x0D, 0x01, 0x01, 0x08, 0x0D, 0x01, 0x01, 0x07, 0x0C, 0x01, 0x01,
+	0x07, 0x0B, 0x01, 0x01, 0x06, 0x0B, 0x02, 0x01, 0x05, 0x0B, 0x01, 0x01, 0x04, 0x0B, 0x01, 0x01,
+	0x04, 0x0A, 0x01, 0x01, 0x03, 0x0B, 0x01, 0x01, 0x03, 0x0A, 0x01, 0x01, 0x02, 0x0B, 0x02, 0x01,
+	0x02, 0x0A, 0x04, 0x01, 0x01, 0x0A, 0x01, 0x01, 0x01, 0x09, 0x10, 0x01, 0x00, 0x0A, 0x03, 0x01,
+	0x01, 0x0A, 0x01, 0x01, 0x01, 0x0B, 0x02, 0x01, 0x02, 0x0A, 0x01, 0x01, 0x02, 0x0B, 0x01, 0x01,
+	0x03, 0x0A, 0x01, 0x01, 0x03, 0x0B, 0x01, 0x01, 0x03, 0x0C, 0x01, 0x01, 0x04, 0x0B, 0x01, 0x01,
+	0x04, 0x0C, 0x01, 0x01, 0x05, 0x0C, 0x01, 0x01, 0x06, 0x0C, 0x01, 0x01, 0x06, 0x0D, 0x01, 0x01,
+	0x07, 0x0E, 0x01, 0x01, 0x08, 0x0E, 0x01, 0x02, 0x09, 0x0F, 0x1C, 0x01, 0x01, 0x02, 0x0A, 0x11,
+	0x16, 0x04, 0x01, 0x02, 0x0B, 0x13, 0x0F, 0x08, 0x01, 0x01, 0x0C, 0x29, 0x01, 0x01, 0x0D, 0x29,
+	0x01, 0x01, 0x0F, 0x27, 0x01, 0x01, 0x10, 0x26, 0x01, 0x01, 0x12, 0x24, 0x01, 0x01, 0x15, 0x20,
+	0x01, 0x01, 0x18, 0x1A, 0x01, 0x01, 0x1C, 0x11, 0x1A, 0x00,
+	// @33012 0xD2 (53 pixels wide)
+	0x12, 0x00, 0x08, 0x01, 0x00, 0x35, 0x40, 0x01, 0x16, 0x09, 0x1B, 0x00,
+	// @33024 0xD3 (55 pixels wide)
+	0x12, 0x00, 0x01, 0x02, 0x00, 0x0A, 0x23, 0x0A, 0x01, 0x02, 0x00, 0x0B, 0x22, 0x0A, 0x01, 0x02,
+	0x01, 0x0A, 0x21, 0x0A, 0x01, 0x02, 0x01, 0x0B, 0x20, 0x0A, 0x01, 0x02, 0x02, 0x0A, 0x20, 0x09,
+	0x01, 0x02, 0x02, 0x0A, 0x1F, 0x0A, 0x02, 0x02, 0x03, 0x0A, 0x1E, 0x09, 0x01, 0x02, 0x04, 0x0A,
+	0x1C, 0x0A, 0x01, 0x02, 0x04, 0x0A, 0x1C, 0x09, 0x01, 0x02, 0x05, 0x0A, 0x1A, 0x0A, 0x01, 0x02,
+	0x05, 0x0A, 0x1A, 0x09, 0x01, 0x02, 0x06, 0x0A, 0x19, 0x09, 0x01, 0x02, 0x06, 0x0A, 0x18, 0x0A,
+	0x01, 0x02, 0x06, 0x0B, 0x17, 0x09, 0x01, 0x02, 0x07, 0x0A, 0x17, 0x09, 0x01, 0x02, 0x07, 0x0B,
+	0x15, 0x09, 0x02, 0x02, 0x08, 0x0A, 0x15, 0x09, 0x02, 0x02, 0x09, 0x0A, 0x13, 0x09, 0x02, 0x02,
+	0x0A, 0x0A, 0x11, 0x09, 0x01, 0x02, 0x0B, 0x0A, 0x10, 0x09, 0x01, 0x02, 0x0B, 0x0A, 0x0F, 0x09,
+	0x01, 0x02, 0x0C, 0x0A, 0x0E, 0x09, 0x01, 0x02, 0x0C, 0x0A, 0x0E, 0x08, 0x02, 0x02, 0x0D, 0x0A,
+	0x0C, 0x09, 0x02, 0x02, 0x0E, 0x0A, 0x0A, 0x09, 0x01, 0x02, 0x0F, 0x09, 0x0A, 0x08, 0x01, 0x02,
+	0x0F, 0x0A, 0x08, 0x09, 0x01, 0x02, 0x10, 0x09, 0x08, 0x09, 0x01, 0x02, 0x10, 0x0A, 0x07, 0x08,
+	0x01, 0x02, 0x11, 0x09, 0x06, 0x09, 0x01, 0x02, 0x11, 0x0A, 0x05, 0x08, 0x01, 0x02, 0x12, 0x09,
+	0x05, 0x08, 0x01, 0x02, 0x12, 0x09, 0x04, 0x09, 0x02, 0x02, 0x13, 0x09, 0x03, 0x08, 0x02, 0x02,
+	0x14, 0x09, 0x01, 0x08, 0x02, 0x01, 0x15, 0x10, 0x01, 0x01, 0x16, 0x0F, 0x01, 0x01, 0x16, 0x0E,
+	0x01, 0x01, 0x17, 0x0D, 0x01, 0x01, 0x17, 0x0C, 0x01, 0x01, 0x18, 0x0B, 0x02, 0x01, 0x18, 0x0A,
+	0x01, 0x01, 0x18, 0x09, 0x01, 0x01, 0x17, 0x0A, 0x01, 0x01, 0x17, 0x09, 0x01, 0x01, 0x16, 0x0A,
+	0x01, 0x01, 0x16, 0x09, 0x01, 0x01, 0x15, 0x0A, 0x01, 0x01, 0x15, 0x09, 0x01, 0x01, 0x14, 0x0A,
+	0x01, 0x01, 0x13, 0x0A, 0x01, 0x01, 0x12, 0x0B, 0x01, 0x01, 0x11, 0x0B, 0x01, 0x01, 0x10, 0x0B,
+	0x01, 0x01, 0x0E, 0x0D, 0x01, 0x01, 0x06, 0x14, 0x01, 0x01, 0x06, 0x13, 0x01, 0x01, 0x06, 0x12,
+	0x01, 0x01, 0x06, 0x11, 0x01, 0x01, 0x05, 0x10, 0x01, 0x01, 0x05, 0x0F, 0x01, 0x01, 0x05, 0x0D,
+	0x01, 0x01, 0x05, 0x0B, 0x1A, 0x00,
+	// @33350 0xD4 (70 pixels wide)
+	0x0F, 0x00, 0x07, 0x01, 0x1E, 0x09, 0x01, 0x01, 0x18, 0x17, 0x01, 0x01, 0x14, 0x1E, 0x01, 0x01,
+	0x12, 0x23, 0x01, 0x01, 0x10, 0x27, 0x01, 0x01, 0x0E, 0x2A, 0x01, 0x01, 0x0C, 0x2E, 0x01, 0x03,
+	0x0B, 0x10, 0x03, 0x09, 0x03, 0x11, 0x01, 0x03, 0x0A, 0x0E, 0x06, 0x09, 0x07, 0x0E, 0x01, 0x03,
+	0x09, 0x0C, 0x09, 0x09, 0x09, 0x0D, 0x01, 0x03, 0x08, 0x0C, 0x0A, 0x09, 0x0B, 0x0C, 0x01, 0x03,
+	0x07, 0x0B, 0x0C, 0x09, 0x0D, 0x0B, 0x01, 0x03, 0x06, 0x0B, 0x0D, 0x09, 0x0E, 0x0B, 0x01, 0x03,
+	0x05, 0x0B, 0x0E, 0x09, 0x0F, 0x0B, 0x01, 0x03, 0x05, 0x0A, 0x0F, 0x09, 0x10, 0x0A, 0x01, 0x03,
+	0x04, 0x0A, 0x10, 0x09, 0x10, 0x0B, 0x01, 0x03, 0x04, 0x0A, 0x10, 0x09, 0x11, 0x0A, 0x02, 0x03,
+	0x03, 0x0A, 0x11, 0x09, 0x12, 0x0A, 0x02, 0x03, 0x02, 0x0A, 0x12, 0x09, 0x13, 0x0A, 0x01, 0x03,
+	0x01, 0x0A, 0x13, 0x09, 0x13, 0x0A, 0x01, 0x03, 0x01, 0x0A, 0x13, 0x09, 0x14, 0x09, 0x01, 0x03,
+	0x01, 0x0A, 0x13, 0x09, 0x14, 0x0A, 0x02, 0x03, 0x01, 0x09, 0x14, 0x09, 0x14, 0x0A, 0x02, 0x03,
+	0x00, 0x0A, 0x14, 0x09, 0x15, 0x09, 0x03, 0x03, 0x00, 0x0A, 0x14, 0x09, 0x15, 0x0A, 0x04, 0x03,
+	0x00, 0x09, 0x15, 0x09, 0x15, 0x0A, 0x03, 0x03, 0x00, 0x0A, 0x14, 0x09, 0x15, 0x0A, 0x02, 0x03,
+	0x00, 0x0A, 0x14, 0x09, 0x15, 0x09, 0x01, 0x03, 0x00, 0x0A, 0x14, 0x09, 0x14, 0x0A, 0x01, 0x03,
+	0x01, 0x09, 0x14, 0x09, 0x14, 0x0A, 0x01, 0x03, 0x01, 0x0A, 0x13, 0x09, 0x14, 0x0A, 0x01, 0x03,
+	0x01, 0x0A, 0x13, 0x09, 0x14, 0x09, 0x01, 0x03, 0x01, 0x0A, 0x13, 0x09, 0x13, 0x0A, 0x01, 0x03,
+	0x02, 0x0A, 0x12, 0x09, 0x13, 0x0A, 0x01, 0x03, 0x02, 0x0A, 0x12, 0x09, 0x12, 0x0B, 0x01, 0x03,
+	0x02, 0x0B, 0x11, 0x09, 0x12, 0x0A, 0x01, 0x03, 0x03, 0x0A, 0x11, 0x09, 0x11, 0x0B, 0x01, 0x03,
+	0x03, 0x0B, 0x10, 0x09, 0x11, 0x0A, 0x01, 0x03, 0x04, 0x0B, 0x0F, 0x09, 0x10, 0x0B, 0x01, 0x03,
+	0x04, 0x0C, 0x0E, 0x09, 0x0F, 0x0B, 0x01, 0x03, 0x05, 0x0C, 0x0D, 0x09, 0x0E, 0x0B, 0x01, 0x03,
+	0x06, 0x0C, 0x0C, 0x09, 0x0D, 0x0C, 0x01, 0x03, 0x06, 0x0D, 0x0B, 0x09, 0x0C, 0x0C, 0x01, 0x03,
+	0x07, 0x0E, 0x09, 0x09, 0x0A, 0x0D, 0x01, 0x03, 0x08, 0x0F, 0x07, 0x09, 0x08, 0x0E, 0x01, 0x03,
+	0x09, 0x10, 0x05, 0x09, 0x06, 0x0F, 0x01, 0x01, 0x0B, 0x30, 0x01, 0x01, 0x0C, 0x2D, 0x01, 0x01,
+	0x0D, 0x2B, 0x01, 0x01, 0x0F, 0x27, 0x01, 0x01, 0x11, 0x23, 0x01, 0x01, 0x14, 0x1D, 0x01, 0x01,
+	0x18, 0x15, 0x07, 0x01, 0x1E, 0x09, 0x18, 0x00,
+	// @33726 0xD5 (55 pixels wide)
+	0x12, 0x00, 0x01, 0x02, 0x01, 0x0B, 0x20, 0x0B, 0x01, 0x02, 0x01, 0x0B, 0x1F, 0x0B, 0x01, 0x02,
+	0x02, 0x0B, 0x1E, 0x0A, 0x01, 0x02, 0x03, 0x0A, 0x1D, 0x0B, 0x01, 0x02, 0x03, 0x0B, 0x1B, 0x0B,
+	0x01, 0x02, 0x04, 0x0A, 0x1B, 0x0A, 0x01, 0x02, 0x04, 0x0B, 0x19, 0x0B, 0x01, 0x02, 0x05, 0x0B,
+	0x18, 0x0A, 0x01, 0x02, 0x06, 0x0A, 0x17, 0x0B, 0x01, 0x02, 0x06, 0x0B, 0x16, 0x0A, 0x01, 0x02,
+	0x07, 0x0A, 0x15, 0x0A, 0x01, 0x02, 0x07, 0x0B, 0x13, 0x0B, 0x01, 0x02, 0x08, 0x0A, 0x13, 0x0A,
+	0x01, 0x02, 0x09, 0x0A, 0x11, 0x0A, 0x01, 0x02, 0x09, 0x0B, 0x10, 0x0A, 0x01, 0x02, 0x0A, 0x0A,
+	0x0F, 0x0A, 0x01, 0x02, 0x0A, 0x0B, 0x0E, 0x0A, 0x01, 0x02, 0x0B, 0x0A, 0x0D, 0x0A, 0x02, 0x02,
+	0x0C, 0x0A, 0x0B, 0x0A, 0x01, 0x02, 0x0D, 0x0A, 0x09, 0x0A, 0x01, 0x02, 0x0D, 0x0B, 0x08, 0x09,
+	0x01, 0x02, 0x0E, 0x0A, 0x07, 0x0A, 0x01, 0x02, 0x0F, 0x0A, 0x06, 0x09, 0x01, 0x02, 0x0F, 0x0A,
+	0x05, 0x09, 0x01, 0x02, 0x10, 0x0A, 0x04, 0x09, 0x01, 0x02, 0x10, 0x0A, 0x03, 0x09, 0x01, 0x02,
+	0x11, 0x0A, 0x02, 0x09, 0x01, 0x02, 0x12, 0x09, 0x01, 0x09, 0x01, 0x01, 0x12, 0x12, 0x01, 0x01,
+	0x13, 0x11, 0x01, 0x01, 0x13, 0x10, 0x01, 0x01, 0x14, 0x0E, 0x01, 0x01, 0x15, 0x0D, 0x01, 0x01,
+	0x15, 0x0C, 0x01, 0x01, 0x16, 0x0B, 0x02, 0x01, 0x15, 0x0D, 0x01, 0x01, 0x14, 0x0F, 0x02, 0x01,
+	0x13, 0x11, 0x01, 0x01, 0x12, 0x13, 0x01, 0x02, 0x12, 0x08, 0x01, 0x0B, 0x01, 0x02, 0x11, 0x09,
+	0x02, 0x0A, 0x02, 0x02, 0x10, 0x09, 0x04, 0x0A, 0x01, 0x02, 0x0F, 0x09, 0x06, 0x0A, 0x01, 0x02,
+	0x0E, 0x0A, 0x06, 0x0B, 0x01, 0x02, 0x0E, 0x09, 0x08, 0x0A, 0x01, 0x02, 0x0D, 0x0A, 0x08, 0x0B,
+	0x01, 0x02, 0x0D, 0x09, 0x0A, 0x0A, 0x01, 0x02, 0x0C, 0x0A, 0x0B, 0x0A, 0x01, 0x02, 0x0B, 0x0A,
+	0x0C, 0x0B, 0x01, 0x02, 0x0B, 0x0A, 0x0D, 0x0A, 0x01, 0x02, 0x0A, 0x0A, 0x0E, 0x0B, 0x01, 0x02,
+	0x0A, 0x09, 0x10, 0x0A, 0x01, 0x02, 0x09, 0x0A, 0x11, 0x0A, 0x01, 0x02, 0x08, 0x0A, 0x12, 0x0B,
+	0x01, 0x02, 0x08, 0x0A, 0x13, 0x0A, 0x01, 0x02, 0x07, 0x0A, 0x14, 0x0B, 0x01, 0x02, 0x07, 0x0A,
+	0x15, 0x0A, 0x01, 0x02, 0x06, 0x0A, 0x16, 0x0B, 0x01, 0x02, 0x05, 0x0B, 0x17, 0x0B, 0x01, 0x02,
+	0x05, 0x0A, 0x19, 0x0A, 0x01, 0x02, 0x04, 0x0A, 0x1A, 0x0B, 0x01, 0x02, 0x04, 0x0A, 0x1B, 0x0A,
+	0x01, 0x02, 0x03, 0x0A, 0x1C, 0x0B, 0x01, 0x02, 0x02, 0x0B, 0x1D, 0x0B, 0x01, 0x02, 0x02, 0x0A,
+	0x1F, 0x0A, 0x01, 0x02, 0x01, 0x0B, 0x1F, 0x0B, 0x01, 0x02, 0x01, 0x0A, 0x21, 0x0A, 0x01, 0x02,
+	0x00, 0x0B, 0x21, 0x0B, 0x1B, 0x00,
+	// @34116 0xD6 (58 pixels wide)
+	0x12, 0x00, 0x40, 0x02, 0x00, 0x09, 0x22, 0x09, 0x01, 0x01, 0x00, 0x36, 0x07, 0x01, 0x00, 0x3A,
+	0x11, 0x01, 0x32, 0x08, 0x0A, 0x00,
+	// @34138 0xD7 (49 pixels wide)
+	0x12, 0x00, 0x1A, 0x02, 0x00, 0x0A, 0x1D, 0x0A, 0x03, 0x02, 0x01, 0x09, 0x1D, 0x0A, 0x02, 0x02,
+	0x01, 0x0A, 0x1C, 0x0A, 0x02, 0x02, 0x01, 0x0B, 0x1B, 0x0A, 0x01, 0x02, 0x02, 0x0B, 0x1A, 0x0A,
+	0x01, 0x02, 0x02, 0x0C, 0x19, 0x0A, 0x01, 0x02, 0x03, 0x0C, 0x16, 0x0C, 0x01, 0x02, 0x03, 0x0D,
+	0x13, 0x0E, 0x01, 0x02, 0x04, 0x0E, 0x0F, 0x10, 0x01, 0x02, 0x04, 0x14, 0x02, 0x17, 0x01, 0x01,
+	0x05, 0x2C, 0x01, 0x01, 0x06, 0x2B, 0x01, 0x01, 0x07, 0x2A, 0x01, 0x02, 0x08, 0x1E, 0x01, 0x0A,
+	0x01, 0x02, 0x0A, 0x19, 0x04, 0x0A, 0x01, 0x02, 0x0C, 0x15, 0x06, 0x0A, 0x01, 0x02, 0x10, 0x0D,
+	0x0A, 0x0A, 0x1A, 0x01, 0x27, 0x0A, 0x1B, 0x00,
+	// @34242 0xD8 (75 pixels wide)
+	0x12, 0x00, 0x40, 0x03, 0x00, 0x09, 0x18, 0x09, 0x17, 0x0A, 0x08, 0x01, 0x00, 0x4B, 0x1B, 0x00,
+	// @34258 0xD9 (81 pixels wide)
+	0x12, 0x00, 0x40, 0x03, 0x00, 0x09, 0x18, 0x09, 0x17, 0x0A, 0x01, 0x01, 0x00, 0x4D, 0x07, 0x01,
+	0x00, 0x51, 0x05, 0x01, 0x48, 0x09, 0x04, 0x01, 0x49, 0x08, 0x08, 0x01, 0x49, 0x07, 0x0A, 0x00,
+	// @34290 0xDA (63 pixels wide)
+	0x12, 0x00, 0x08, 0x01, 0x00, 0x1C, 0x12, 0x01, 0x12, 0x0A, 0x01, 0x02, 0x12, 0x0A, 0x03, 0x09,
+	0x01, 0x01, 0x12, 0x1C, 0x01, 0x01, 0x12, 0x1F, 0x01, 0x01, 0x12, 0x21, 0x01, 0x01, 0x12, 0x23,
+	0x01, 0x01, 0x12, 0x25, 0x01, 0x01, 0x12, 0x26, 0x01, 0x01, 0x12, 0x27, 0x01, 0x02, 0x12, 0x0A,
+	0x0D, 0x11, 0x01, 0x02, 0x12, 0x0A, 0x11, 0x0E, 0x01, 0x02, 0x12, 0x0A, 0x13, 0x0D, 0x01, 0x02,
+	0x12, 0x0A, 0x14, 0x0C, 0x01, 0x02, 0x12, 0x0A, 0x15, 0x0C, 0x01, 0x02, 0x12, 0x0A, 0x16, 0x0B,
+	0x01, 0x02, 0x12, 0x0A, 0x17, 0x0B, 0x01, 0x02, 0x12, 0x0A, 0x18, 0x0A, 0x01, 0x02, 0x12, 0x0A,
+	0x18, 0x0B, 0x04, 0x02, 0x12, 0x0A, 0x19, 0x0A, 0x04, 0x02, 0x12, 0x0A, 0x1A, 0x09, 0x05, 0x02,
+	0x12, 0x0A, 0x19, 0x0A, 0x02, 0x02, 0x12, 0x0A, 0x18, 0x0A, 0x01, 0x02, 0x12, 0x0A, 0x17, 0x0B,
+	0x01, 0x02, 0x12, 0x0A, 0x16, 0x0B, 0x01, 0x02, 0x12, 0x0A, 0x15, 0x0C, 0x01, 0x02, 0x12, 0x0A,
+	0x14, 0x0C, 0x01, 0x02, 0x12, 0x0A, 0x13, 0x0C, 0x01, 0x02, 0x12, 0x0A, 0x11, 0x0D, 0x01, 0x02,
+	0x12, 0x0A, 0x0E, 0x0F, 0x01, 0x01, 0x12, 0x26, 0x01, 0x01, 0x12, 0x25, 0x01, 0x01, 0x12, 0x24,
+	0x01, 0x01, 0x12, 0x22, 0x01, 0x01, 0x12, 0x20, 0x01, 0x01, 0x12, 0x1D, 0x01, 0x01, 0x12, 0x1A,
+	0x01, 0x01, 0x1B, 0x0A, 0x1A, 0x00,
+	// @34488 0xDB (63 pixels wide)
+	0x12, 0x00, 0x1A, 0x02, 0x00, 0x09, 0x2D, 0x09, 0x01, 0x03, 0x00, 0x09, 0x05, 0x08, 0x20, 0x09,
+	0x01, 0x02, 0x00, 0x1C, 0x1A, 0x09, 0x01, 0x02, 0x00, 0x20, 0x16, 0x09, 0x01, 0x02, 0x00, 0x22,
+	0x14, 0x09, 0x01, 0x02, 0x00, 0x24, 0x12, 0x09, 0x01, 0x02, 0x00, 0x25, 0x11, 0x09, 0x01, 0x02,
+	0x00, 0x27, 0x0F, 0x09, 0x01, 0x02, 0x00, 0x28, 0x0E, 0x09, 0x01, 0x03, 0x00, 0x09, 0x0E, 0x12,
+	0x0D, 0x09, 0x01, 0x03, 0x00, 0x09, 0x12, 0x0F, 0x0C, 0x09, 0x01, 0x03, 0x00, 0x09, 0x14, 0x0D,
+	0x0C, 0x09, 0x01, 0x03, 0x00, 0x09, 0x15, 0x0D, 0x0B, 0x09, 0x01, 0x03, 0x00, 0x09, 0x17, 0x0C,
+	0x0A, 0x09, 0x02, 0x03, 0x00, 0x09, 0x18, 0x0B, 0x0A, 0x09, 0x01, 0x03, 0x00, 0x09, 0x19, 0x0B,
+	0x09, 0x09, 0x03, 0x03, 0x00, 0x09, 0x1A, 0x0A, 0x09, 0x09, 0x08, 0x03, 0x00, 0x09, 0x1B, 0x0A,
+	0x08, 0x09, 0x01, 0x03, 0x00, 0x09, 0x1B, 0x09, 0x09, 0x09, 0x02, 0x03, 0x00, 0x09, 0x1A, 0x0A,
+	0x09, 0x09, 0x01, 0x03, 0x00, 0x09, 0x19, 0x0B, 0x09, 0x09, 0x01, 0x03, 0x00, 0x09, 0x19, 0x0A,
+	0x0A, 0x09, 0x01, 0x03, 0x00, 0x09, 0x18, 0x0B, 0x0A, 0x09, 0x01, 0x03, 0x00, 0x09, 0x17, 0x0B,
+	0x0B, 0x09, 0x01, 0x03, 0x00, 0x09, 0x16, 0x0C, 0x0B, 0x09, 0x01, 0x03, 0x00, 0x09, 0x15, 0x0C,
+	0x0C, 0x09, 0x01, 0x03, 0x00, 0x09, 0x14, 0x0D, 0x0C, 0x09, 0x01, 0x03, 0x00, 0x09, 0x12, 0x0E,
+	0x0D, 0x09, 0x01, 0x03, 0x00, 0x09, 0x0F, 0x10, 0x0E, 0x09, 0x01, 0x02, 0x00, 0x27, 0x0F, 0x09,
+	0x01, 0x02, 0x00, 0x26, 0x10, 0x09, 0x01, 0x02, 0x00, 0x24, 0x12, 0x09, 0x01, 0x02, 0x00, 0x23,
+	0x13, 0x09, 0x01, 0x02, 0x00, 0x20, 0x16, 0x09, 0x01, 0x02, 0x00, 0x1E, 0x18, 0x09, 0x01, 0x02,
+	0x00, 0x1A, 0x1C, 0x09, 0x01, 0x01, 0x08, 0x0B, 0x1A, 0x00,
+	// @34754 0xDC (46 pixels wide)
+	0x12, 0x00, 0x1A, 0x01, 0x00, 0x09, 0x01, 0x02, 0x00, 0x09, 0x04, 0x09, 0x01, 0x01, 0x00, 0x1D,
+	0x01, 0x01, 0x00, 0x20, 0x01, 0x01, 0x00, 0x22, 0x01, 0x01, 0x00, 0x24, 0x01, 0x01, 0x00, 0x26,
+	0x01, 0x01, 0x00, 0x27, 0x01, 0x01, 0x00, 0x28, 0x01, 0x02, 0x00, 0x09, 0x0F, 0x11, 0x01, 0x02,
+	0x00, 0x09, 0x12, 0x0F, 0x01, 0x02, 0x00, 0x09, 0x14, 0x0E, 0x01, 0x02, 0x00, 0x09, 0x16, 0x0C,
+	0x01, 0x02, 0x00, 0x09, 0x17, 0x0C, 0x01, 0x02, 0x00, 0x09, 0x18, 0x0B, 0x02, 0x02, 0x00, 0x09,
+	0x19, 0x0B, 0x01, 0x02, 0x00, 0x09, 0x1A, 0x0A, 0x01, 0x02, 0x00, 0x09, 0x1A, 0x0B, 0x0B, 0x02,
+	0x00, 0x09, 0x1B, 0x0A, 0x02, 0x02, 0x00, 0x09, 0x1A, 0x0A, 0x01, 0x02, 0x00, 0x09, 0x19, 0x0B,
+	0x01, 0x02, 0x00, 0x09, 0x19, 0x0A, 0x01, 0x02, 0x00, 0x09, 0x18, 0x0B, 0x01, 0x02, 0x00, 0x09,
+	0x17, 0x0B, 0x01, 0x02, 0x00, 0x09, 0x16, 0x0C, 0x01, 0x02, 0x00, 0x09, 0x14, 0x0D, 0x01, 0x02,
+	0x00, 0x09, 0x12, 0x0E, 0x01, 0x02, 0x00, 0x09, 0x0F, 0x10, 0x01, 0x01, 0x00, 0x27, 0x01, 0x01,
+	0x00, 0x26, 0x01, 0x01, 0x00, 0x25, 0x01, 0x01, 0x00, 0x23, 0x01, 0x01, 0x00, 0x21, 0x01, 0x01,
+	0x00, 0x1E, 0x01, 0x01, 0x00, 0x1A, 0x01, 0x01, 0x09, 0x0A, 0x1A, 0x00,
+	// @34942 0xDD (54 pixels wide)
+	0x11, 0x00, 0x01, 0x01, 0x0C, 0x10, 0x01, 0x01, 0x08, 0x18, 0x01, 0x01, 0x05, 0x1D, 0x01, 0x01,
+	0x02, 0x23, 0x01, 0x01, 0x02, 0x24, 0x01, 0x01, 0x02, 0x26, 0x01, 0x01, 0x02, 0x27, 0x01, 0x02,
+	0x03, 0x0E, 0x04, 0x15, 0x01, 0x02, 0x03, 0x08, 0x10, 0x10, 0x01, 0x02, 0x03, 0x04, 0x17, 0x0E,
+	0x01, 0x02, 0x04, 0x01, 0x1A, 0x0E, 0x01, 0x01, 0x21, 0x0D, 0x01, 0x01, 0x22, 0x0D, 0x01, 0x01,
+	0x23, 0x0C, 0x01, 0x01, 0x24, 0x0C, 0x01, 0x01, 0x25, 0x0C, 0x01, 0x01, 0x26, 0x0B, 0x01, 0x01,
+	0x27, 0x0B, 0x01, 0x01, 0x28, 0x0A, 0x01, 0x01, 0x28, 0x0B, 0x02, 0x01, 0x29, 0x0A, 0x03, 0x01,
+	0x2A, 0x0A, 0x05, 0x01, 0x2B, 0x0A, 0x01, 0x01, 0x2C, 0x09, 0x01, 0x01, 0x2C, 0x0A, 0x08, 0x01,
+	0x0A, 0x2C, 0x03, 0x01, 0x2C, 0x0A, 0x01, 0x01, 0x2C, 0x09, 0x04, 0x01, 0x2B, 0x0A, 0x03, 0x01,
+	0x2A, 0x0A, 0x01, 0x01, 0x29, 0x0B, 0x01, 0x01, 0x29, 0x0A, 0x01, 0x01, 0x28, 0x0B, 0x01, 0x01,
+	0x28, 0x0A, 0x01, 0x01, 0x27, 0x0B, 0x02, 0x01, 0x26, 0x0B, 0x01, 0x01, 0x25, 0x0B, 0x01, 0x01,
+	0x24, 0x0C, 0x01, 0x01, 0x23, 0x0C, 0x01, 0x01, 0x22, 0x0C, 0x01, 0x01, 0x20, 0x0D, 0x01, 0x02,
+	0x02, 0x01, 0x1B, 0x0F, 0x01, 0x02, 0x02, 0x04, 0x16, 0x10, 0x01, 0x02, 0x02, 0x08, 0x0F, 0x12,
+	0x01, 0x01, 0x01, 0x28, 0x01, 0x01, 0x01, 0x27, 0x01, 0x01, 0x01, 0x26, 0x01, 0x01, 0x00, 0x25,
+	0x01, 0x01, 0x00, 0x23, 0x01, 0x01, 0x03, 0x1E, 0x01, 0x01, 0x06, 0x19, 0x01, 0x01, 0x0A, 0x11,
+	0x1A, 0x00,
+	// @35168 0xDE (81 pixels wide)
+	0x11, 0x00, 0x01, 0x01, 0x2B, 0x0F, 0x01, 0x02, 0x00, 0x09, 0x1F, 0x15, 0x01, 0x02, 0x00, 0x09,
+	0x1D, 0x1A, 0x01, 0x02, 0x00, 0x09, 0x1B, 0x1E, 0x01, 0x02, 0x00, 0x09, 0x19, 0x21, 0x01, 0x02,
+	0x00, 0x09, 0x18, 0x24, 0x01, 0x02, 0x00, 0x09, 0x17, 0x26, 0x01, 0x03, 0x00, 0x09, 0x16, 0x10,
+	0x07, 0x11, 0x01, 0x03, 0x00, 0x09, 0x15, 0x0D, 0x0E, 0x0F, 0x01, 0x03, 0x00, 0x09, 0x14, 0x0C,
+	0x12, 0x0E, 0x01, 0x03, 0x00, 0x09, 0x13, 0x0C, 0x15, 0x0C, 0x01, 0x03, 0x00, 0x09, 0x12, 0x0B,
+	0x18, 0x0C, 0x01, 0x03, 0x00, 0x09, 0x11, 0x0B, 0x1A, 0x0C, 0x01, 0x03, 0x00, 0x09, 0x11, 0x0B,
+	0x1B, 0x0B, 0x01, 0x03, 0x00, 0x09, 0x10, 0x0B, 0x1D, 0x0B, 0x01, 0x03, 0x00, 0x09, 0x10, 0x0A,
+	0x1F, 0x0A, 0x01, 0x03, 0x00, 0x09, 0x0F, 0x0A, 0x20, 0x0B, 0x01, 0x03, 0x00, 0x09, 0x0F, 0x0A,
+	0x21, 0x0A, 0x01, 0x03, 0x00, 0x09, 0x0E, 0x0A, 0x22, 0x0B, 0x01, 0x03, 0x00, 0x09, 0x0E, 0x0A,
+	0x23, 0x0A, 0x01, 0x03, 0x00, 0x09, 0x0E, 0x09, 0x24, 0x0B, 0x01, 0x03, 0x00, 0x09, 0x0D, 0x0A,
+	0x25, 0x0A, 0x01, 0x03, 0x00, 0x09, 0x0D, 0x09, 0x26, 0x0A, 0x01, 0x03, 0x00, 0x09, 0x0D, 0x09,
+	0x27, 0x09, 0x02, 0x03, 0x00, 0x09, 0x0C, 0x0A, 0x27, 0x0A, 0x01, 0x03, 0x00, 0x09, 0x0C, 0x09,
+	0x28, 0x0A, 0x02, 0x03, 0x00, 0x09, 0x0C, 0x09, 0x29, 0x09, 0x02, 0x03, 0x00, 0x09, 0x0B, 0x0A,
+	0x29, 0x0A, 0x01, 0x03, 0x00, 0x09, 0x0B, 0x09, 0x2A, 0x0A, 0x08, 0x02, 0x00, 0x1D, 0x2A, 0x0A,
+	0x03, 0x03, 0x00, 0x09, 0x0B, 0x09, 0x2A, 0x0A, 0x01, 0x03, 0x00, 0x09, 0x0B, 0x0A, 0x29, 0x0A,
+	0x02, 0x03, 0x00, 0x09, 0x0B, 0x0A, 0x29, 0x09, 0x03, 0x03, 0x00, 0x09, 0x0C, 0x09, 0x28, 0x0A,
+	0x01, 0x03, 0x00, 0x09, 0x0C, 0x0A, 0x27, 0x09, 0x01, 0x03, 0x00, 0x09, 0x0C, 0x0A, 0x26, 0x0A,
+	0x01, 0x03, 0x00, 0x09, 0x0D, 0x09, 0x26, 0x0A, 0x01, 0x03, 0x00, 0x09, 0x0D, 0x0A, 0x25, 0x0A,
+	0x01, 0x03, 0x00, 0x09, 0x0D, 0x0A, 0x24, 0x0A, 0x01, 0x03, 0x00, 0x09, 0x0E, 0x0A, 0x23, 0x0A,
+	0x01, 0x03, 0x00, 0x09, 0x0E, 0x0A, 0x22, 0x0A, 0x01, 0x03, 0x00, 0x09, 0x0E, 0x0B, 0x21, 0x0A,
+	0x01, 0x03, 0x00, 0x09, 0x0F, 0x0A, 0x20, 0x0B, 0x01, 0x03, 0x00, 0x09, 0x0F, 0x0B, 0x1E, 0x0B,
+	0x01, 0x03, 0x00, 0x09, 0x10, 0x0B, 0x1D, 0x0B, 0x01, 0x03, 0x00, 0x09, 0x10, 0x0C, 0x1B, 0x0B,
+	0x01, 0x03, 0x00, 0x09, 0x11, 0x0C, 0x19, 0x0B, 0x01, 0x03, 0x00, 0x09, 0x12, 0x0C, 0x17, 0x0C,
+	0x01, 0x03, 0x00, 0x09, 0x12, 0x0D, 0x15, 0x0C, 0x01, 0x03, 0x00, 0x09, 0x13, 0x0E, 0x11, 0x0D,
+	0x01, 0x03, 0x00, 0x09, 0x14, 0x0F, 0x0D, 0x0E, 0x01, 0x03, 0x00, 0x09, 0x15, 0x11, 0x06, 0x11,
+	0x01, 0x02, 0x00, 0x09, 0x16, 0x26, 0x01, 0x02, 0x00, 0x09, 0x17, 0x24, 0x01, 0x02, 0x00, 0x09,
+	0x19, 0x20, 0x01, 0x02, 0x00, 0x09, 0x1A, 0x1E, 0x01, 0x02, 0x00, 0x09, 0x1C, 0x1A, 0x01, 0x02,
+	0x00, 0x09, 0x1F, 0x14, 0x01, 0x01, 0x2B, 0x0E, 0x1A, 0x00,
+	// @35610 0xDF (48 pixels wide)
+	0x11, 0x00, 0x01, 0x01, 0x1A, 0x0B, 0x01, 0x01, 0x14, 0x1A, 0x01, 0x01, 0x10, 0x20, 0x01, 0x01,
+	0x0E, 0x22, 0x01, 0x01, 0x0C, 0x24, 0x01, 0x01, 0x0B, 0x25, 0x01, 0x01, 0x09, 0x27, 0x01, 0x01,
+	0x08, 0x28, 0x01, 0x02, 0x07, 0x0F, 0x11, 0x09, 0x01, 0x02, 0x07, 0x0D, 0x13, 0x09, 0x01, 0x02,
+	0x06, 0x0C, 0x15, 0x09, 0x01, 0x02, 0x05, 0x0C, 0x16, 0x09, 0x01, 0x02, 0x05, 0x0B, 0x17, 0x09,
+	0x01, 0x02, 0x05, 0x0A, 0x18, 0x09, 0x02, 0x02, 0x04, 0x0A, 0x19, 0x09, 0x03, 0x02, 0x04, 0x09,
+	0x1A, 0x09, 0x03, 0x02, 0x03, 0x0A, 0x1A, 0x09, 0x03, 0x02, 0x04, 0x09, 0x1A, 0x09, 0x02, 0x02,
+	0x04, 0x0A, 0x19, 0x09, 0x02, 0x02, 0x05, 0x0A, 0x18, 0x09, 0x01, 0x02, 0x06, 0x0A, 0x17, 0x09,
+	0x01, 0x02, 0x06, 0x0B, 0x16, 0x09, 0x01, 0x02, 0x07, 0x0C, 0x14, 0x09, 0x01, 0x02, 0x08, 0x0C,
+	0x13, 0x09, 0x01, 0x02, 0x09, 0x0E, 0x10, 0x09, 0x01, 0x02, 0x0A, 0x11, 0x0C, 0x09, 0x01, 0x01,
+	0x0C, 0x24, 0x01, 0x01, 0x0D, 0x23, 0x01, 0x01, 0x10, 0x20, 0x01, 0x01, 0x13, 0x1D, 0x01, 0x01,
+	0x11, 0x1F, 0x01, 0x01, 0x0F, 0x21, 0x01, 0x01, 0x0E, 0x22, 0x01, 0x02, 0x0D, 0x0D, 0x0D, 0x09,
+	0x01, 0x02, 0x0C, 0x0C, 0x0F, 0x09, 0x01, 0x02, 0x0B, 0x0B, 0x11, 0x09, 0x01, 0x02, 0x0B, 0x0A,
+	0x12, 0x09, 0x02, 0x02, 0x0A, 0x0A, 0x13, 0x09, 0x01, 0x02, 0x09, 0x0A, 0x14, 0x09, 0x01, 0x02,
+	0x09, 0x09, 0x15, 0x09, 0x01, 0x02, 0x08, 0x0A, 0x15, 0x09, 0x01, 0x02, 0x08, 0x09, 0x16, 0x09,
+	0x02, 0x02, 0x07, 0x0A, 0x16, 0x09, 0x03, 0x02, 0x06, 0x0A, 0x17, 0x09, 0x03, 0x02, 0x05, 0x0A,
+	0x18, 0x09, 0x01, 0x02, 0x05, 0x09, 0x19, 0x09, 0x02, 0x02, 0x04, 0x0A, 0x19, 0x09, 0x01, 0x02,
+	0x04, 0x09, 0x1A, 0x09, 0x02, 0x02, 0x03, 0x0A, 0x1A, 0x09, 0x03, 0x02, 0x02, 0x0A, 0x1B, 0x09,
+	0x02, 0x02, 0x01, 0x0A, 0x1C, 0x09, 0x02, 0x02, 0x00, 0x0A, 0x1D, 0x09, 0x1B, 0x00,
+	// @35896 0xE0 (41 pixels wide)
+	0x25, 0x00, 0x01, 0x01, 0x0E, 0x0C, 0x01, 0x01, 0x0A, 0x14, 0x01, 0x01, 0x07, 0x19, 0x01, 0x01,
+	0x05, 0x1C, 0x01, 0x01, 0x03, 0x1F, 0x01, 0x01, 0x04, 0x1F, 0x01, 0x01, 0x04, 0x20, 0x01, 0x02,
+	0x04, 0x0A, 0x0A, 0x0D, 0x01, 0x02, 0x05, 0x05, 0x10, 0x0C, 0x01, 0x02, 0x05, 0x03, 0x13, 0x0B,
+	0x01, 0x02, 0x05, 0x01, 0x16, 0x0A, 0x01, 0x01, 0x1D, 0x0A, 0x02, 0x01, 0x1E, 0x09, 0x01, 0x01,
+	0x1E, 0x0A, 0x05, 0x01, 0x1F, 0x09, 0x01, 0x01, 0x16, 0x12, 0x01, 0x01, 0x10, 0x18, 0x01, 0x01,
+	0x0D, 0x1B, 0x01, 0x01, 0x0B, 0x1D, 0x01, 0x01, 0x09, 0x1F, 0x01, 0x01, 0x07, 0x21, 0x01, 0x01,
+	0x06, 0x22, 0x01, 0x02, 0x04, 0x10, 0x0B, 0x09, 0x01, 0x02, 0x04, 0x0C, 0x0F, 0x09, 0x01, 0x02,
+	0x03, 0x0B, 0x11, 0x09, 0x01, 0x02, 0x02, 0x0B, 0x12, 0x09, 0x01, 0x02, 0x02, 0x0A, 0x13, 0x09,
+	0x01, 0x02, 0x01, 0x0A, 0x14, 0x09, 0x01, 0x02, 0x01, 0x09, 0x15, 0x09, 0x01, 0x02, 0x00, 0x0A,
+	0x15, 0x09, 0x04, 0x02, 0x00, 0x09, 0x16, 0x09, 0x02, 0x02, 0x00, 0x09, 0x15, 0x0A, 0x01, 0x02,
+	0x00, 0x0A, 0x13, 0x0B, 0x02, 0x02, 0x00, 0x0A, 0x12, 0x0C, 0x01, 0x02, 0x01, 0x0A, 0x0F, 0x0E,
+	0x01, 0x02, 0x01, 0x0B, 0x0D, 0x0F, 0x01, 0x03, 0x01, 0x0D, 0x09, 0x08, 0x01, 0x08, 0x01, 0x02,
+	0x02, 0x1D, 0x01, 0x08, 0x01, 0x02, 0x03, 0x1B, 0x02, 0x09, 0x01, 0x02, 0x04, 0x19, 0x03, 0x09,
+	0x01, 0x02, 0x05, 0x17, 0x04, 0x09, 0x01, 0x02, 0x06, 0x14, 0x06, 0x09, 0x01, 0x02, 0x08, 0x10,
+	0x09, 0x08, 0x01, 0x01, 0x0A, 0x0C, 0x1A, 0x00,
+	// @36128 0xE1 (48 pixels wide)
+	0x0D, 0x00, 0x01, 0x01, 0x29, 0x02, 0x01, 0x01, 0x25, 0x06, 0x01, 0x01, 0x1F, 0x0C, 0x01, 0x01,
+	0x1A, 0x11, 0x01, 0x01, 0x17, 0x14, 0x01, 0x01, 0x14, 0x17, 0x01, 0x01, 0x12, 0x19, 0x01, 0x01,
+	0x10, 0x1B, 0x01, 0x01, 0x0F, 0x19, 0x01, 0x01, 0x0D, 0x16, 0x01, 0x01, 0x0C, 0x11, 0x01, 0x01,
+	0x0B, 0x0F, 0x01, 0x01, 0x0A, 0x0D, 0x01, 0x01, 0x09, 0x0C, 0x01, 0x01, 0x08, 0x0B, 0x01, 0x01,
+	0x08, 0x0A, 0x01, 0x01, 0x07, 0x0A, 0x02, 0x01, 0x06, 0x09, 0x01, 0x01, 0x05, 0x09, 0x01, 0x01,
+	0x05, 0x08, 0x01, 0x01, 0x04, 0x09, 0x01, 0x01, 0x04, 0x08, 0x02, 0x01, 0x03, 0x08, 0x01, 0x02,
+	0x03, 0x08, 0x0C, 0x07, 0x01, 0x02, 0x02, 0x08, 0x09, 0x0F, 0x01, 0x02, 0x02, 0x08, 0x07, 0x14,
+	0x01, 0x02, 0x02, 0x08, 0x05, 0x17, 0x01, 0x02, 0x02, 0x07, 0x05, 0x1A, 0x01, 0x02, 0x01, 0x08,
+	0x04, 0x1C, 0x01, 0x02, 0x01, 0x08, 0x03, 0x1E, 0x01, 0x03, 0x01, 0x08, 0x02, 0x0A, 0x07, 0x0F,
+	0x01, 0x03, 0x01, 0x07, 0x02, 0x08, 0x0D, 0x0D, 0x01, 0x03, 0x01, 0x07, 0x02, 0x07, 0x0F, 0x0C,
+	0x01, 0x03, 0x01, 0x07, 0x01, 0x06, 0x12, 0x0C, 0x01, 0x02, 0x01, 0x0E, 0x13, 0x0B, 0x01, 0x02,
+	0x01, 0x0D, 0x15, 0x0B, 0x01, 0x02, 0x00, 0x0D, 0x17, 0x0A, 0x01, 0x02, 0x00, 0x0D, 0x17, 0x0B,
+	0x02, 0x02, 0x00, 0x0C, 0x19, 0x0A, 0x03, 0x02, 0x00, 0x0B, 0x1B, 0x0A, 0x01, 0x02, 0x00, 0x0A,
+	0x1C, 0x0A, 0x03, 0x02, 0x00, 0x0A, 0x1D, 0x09, 0x06, 0x02, 0x01, 0x09, 0x1D, 0x09, 0x01, 0x02,
+	0x01, 0x0A, 0x1C, 0x09, 0x01, 0x02, 0x02, 0x09, 0x1C, 0x09, 0x02, 0x02, 0x02, 0x09, 0x1B, 0x0A,
+	0x01, 0x02, 0x02, 0x0A, 0x1A, 0x0A, 0x01, 0x02, 0x03, 0x09, 0x1A, 0x09, 0x01, 0x02, 0x03, 0x09,
+	0x19, 0x0A, 0x01, 0x02, 0x03, 0x0A, 0x18, 0x0A, 0x01, 0x02, 0x04, 0x09, 0x17, 0x0A, 0x01, 0x02,
+	0x04, 0x0A, 0x16, 0x0A, 0x01, 0x02, 0x05, 0x0A, 0x14, 0x0B, 0x01, 0x02, 0x05, 0x0A, 0x14, 0x0A,
+	0x01, 0x02, 0x06, 0x0A, 0x12, 0x0B, 0x01, 0x02, 0x06, 0x0B, 0x10, 0x0B, 0x01, 0x02, 0x07, 0x0C,
+	0x0C, 0x0C, 0x01, 0x02, 0x08, 0x0D, 0x08, 0x0D, 0x01, 0x01, 0x09, 0x21, 0x01, 0x01, 0x0A, 0x1F,
+	0x01, 0x01, 0x0B, 0x1C, 0x01, 0x01, 0x0C, 0x1A, 0x01, 0x01, 0x0D, 0x17, 0x01, 0x01, 0x0F, 0x13,
+	0x01, 0x01, 0x12, 0x0D, 0x1A, 0x00,
+	// @36470 0xE2 (42 pixels wide)
+	0x26, 0x00, 0x01, 0x01, 0x02, 0x19, 0x01, 0x01, 0x00, 0x1F, 0x01, 0x01, 0x00, 0x22, 0x01, 0x01,
+	0x00, 0x23, 0x01, 0x01, 0x00, 0x25, 0x01, 0x01, 0x00, 0x26, 0x01, 0x02, 0x00, 0x0A, 0x0D, 0x0F,
+	0x01, 0x02, 0x00, 0x0A, 0x10, 0x0D, 0x01, 0x02, 0x00, 0x0A, 0x12, 0x0B, 0x01, 0x02, 0x00, 0x0A,
+	0x13, 0x0B, 0x02, 0x02, 0x00, 0x0A, 0x14, 0x0A, 0x04, 0x02, 0x00, 0x0A, 0x15, 0x09, 0x02, 0x02,
+	0x00, 0x0A, 0x14, 0x09, 0x01, 0x02, 0x00, 0x0A, 0x13, 0x09, 0x01, 0x02, 0x00, 0x0A, 0x12, 0x0A,
+	0x01, 0x02, 0x00, 0x0A, 0x10, 0x0B, 0x01, 0x02, 0x00, 0x0A, 0x0C, 0x0E, 0x01, 0x01, 0x00, 0x22,
+	0x01, 0x01, 0x00, 0x20, 0x01, 0x01, 0x00, 0x1D, 0x01, 0x01, 0x00, 0x21, 0x01, 0x01, 0x00, 0x24,
+	0x01, 0x01, 0x00, 0x26, 0x01, 0x02, 0x00, 0x09, 0x0D, 0x11, 0x01, 0x02, 0x00, 0x09, 0x12, 0x0D,
+	0x01, 0x02, 0x00, 0x09, 0x14, 0x0C, 0x01, 0x02, 0x00, 0x09, 0x15, 0x0B, 0x01, 0x02, 0x00, 0x09,
+	0x16, 0x0B, 0x02, 0x02, 0x00, 0x09, 0x17, 0x0A, 0x04, 0x02, 0x00, 0x09, 0x18, 0x09, 0x03, 0x02,
+	0x00, 0x09, 0x17, 0x0A, 0x01, 0x02, 0x00, 0x09, 0x16, 0x0A, 0x01, 0x02, 0x00, 0x09, 0x14, 0x0C,
+	0x01, 0x02, 0x00, 0x09, 0x12, 0x0D, 0x01, 0x02, 0x00, 0x09, 0x0F, 0x10, 0x01, 0x01, 0x00, 0x27,
+	0x01, 0x01, 0x00, 0x25, 0x01, 0x01, 0x00, 0x24, 0x01, 0x01, 0x00, 0x22, 0x01, 0x01, 0x00, 0x1F,
+	0x01, 0x01, 0x00, 0x1C, 0x01, 0x01, 0x09, 0x0B, 0x1A, 0x00,
+	// @36688 0xE3 (32 pixels wide)
+	0x26, 0x00, 0x08, 0x01, 0x00, 0x20, 0x2C, 0x01, 0x00, 0x0A, 0x1B, 0x00,
+	// @36700 0xE4 (52 pixels wide)
+	0x26, 0x00, 0x07, 0x01, 0x0C, 0x23, 0x0D, 0x02, 0x0C, 0x09, 0x11, 0x09, 0x05, 0x02, 0x0C, 0x08,
+	0x12, 0x09, 0x04, 0x02, 0x0B, 0x09, 0x12, 0x09, 0x01, 0x02, 0x0B, 0x08, 0x13, 0x09, 0x03, 0x02,
+	0x0A, 0x09, 0x13, 0x09, 0x01, 0x02, 0x0A, 0x08, 0x14, 0x09, 0x02, 0x02, 0x09, 0x09, 0x14, 0x09,
+	0x01, 0x02, 0x09, 0x08, 0x15, 0x09, 0x02, 0x02, 0x08, 0x09, 0x15, 0x09, 0x02, 0x02, 0x07, 0x09,
+	0x16, 0x09, 0x01, 0x02, 0x06, 0x0A, 0x16, 0x09, 0x01, 0x02, 0x06, 0x09, 0x17, 0x09, 0x01, 0x02,
+	0x05, 0x0A, 0x17, 0x09, 0x01, 0x02, 0x05, 0x09, 0x18, 0x09, 0x07, 0x01, 0x00, 0x34, 0x10, 0x02,
+	0x00, 0x08, 0x24, 0x08, 0x0B, 0x00,
+	// @36802 0xE5 (46 pixels wide)
+	0x25, 0x00, 0x01, 0x01, 0x13, 0x0B, 0x01, 0x01, 0x10, 0x11, 0x01, 0x01, 0x0D, 0x16, 0x01, 0x01,
+	0x0C, 0x19, 0x01, 0x01, 0x0A, 0x1C, 0x01, 0x01, 0x09, 0x1E, 0x01, 0x01, 0x08, 0x20, 0x01, 0x02,
+	0x07, 0x0C, 0x09, 0x0D, 0x01, 0x02, 0x06, 0x0B, 0x0D, 0x0B, 0x01, 0x02, 0x06, 0x0A, 0x10, 0x0A,
+	0x01, 0x02, 0x05, 0x09, 0x13, 0x0A, 0x01, 0x02, 0x04, 0x0A, 0x14, 0x09, 0x01, 0x02, 0x04, 0x09,
+	0x15, 0x0A, 0x02, 0x02, 0x03, 0x09, 0x17, 0x09, 0x02, 0x02, 0x02, 0x09, 0x19, 0x09, 0x01, 0x02,
+	0x02, 0x08, 0x1A, 0x09, 0x01, 0x02, 0x01, 0x09, 0x1A, 0x09, 0x01, 0x02, 0x01, 0x09, 0x1B, 0x08,
+	0x02, 0x02, 0x01, 0x08, 0x1C, 0x09, 0x06, 0x01, 0x00, 0x2E, 0x01, 0x01, 0x00, 0x2D, 0x04, 0x01,
+	0x00, 0x09, 0x01, 0x01, 0x00, 0x0A, 0x02, 0x01, 0x01, 0x09, 0x02, 0x01, 0x01, 0x0A, 0x01, 0x01,
+	0x02, 0x09, 0x01, 0x01, 0x02, 0x0A, 0x01, 0x01, 0x03, 0x0A, 0x01, 0x01, 0x03, 0x0B, 0x01, 0x01,
+	0x04, 0x0B, 0x01, 0x01, 0x04, 0x0C, 0x01, 0x02, 0x05, 0x0C, 0x17, 0x01, 0x01, 0x02, 0x06, 0x0E,
+	0x11, 0x05, 0x01, 0x02, 0x07, 0x11, 0x07, 0x0B, 0x01, 0x01, 0x08, 0x22, 0x01, 0x01, 0x09, 0x21,
+	0x01, 0x01, 0x0A, 0x21, 0x01, 0x01, 0x0B, 0x20, 0x01, 0x01, 0x0D, 0x1C, 0x01, 0x01, 0x10, 0x16,
+	0x01, 0x01, 0x13, 0x0E, 0x1A, 0x00,
+	// @37000 0xE6 (69 pixels wide)
+	0x26, 0x00, 0x01, 0x03, 0x01, 0x0A, 0x13, 0x09, 0x13, 0x0B, 0x01, 0x03, 0x02, 0x0A, 0x12, 0x09,
+	0x12, 0x0B, 0x01, 0x03, 0x02, 0x0B, 0x11, 0x09, 0x11, 0x0B, 0x01, 0x03, 0x03, 0x0B, 0x10, 0x09,
+	0x11, 0x0A, 0x01, 0x03, 0x04, 0x0A, 0x10, 0x09, 0x10, 0x0A, 0x01, 0x03, 0x05, 0x0A, 0x0F, 0x09,
+	0x0F, 0x0A, 0x01, 0x03, 0x06, 0x0A, 0x0E, 0x09, 0x0E, 0x0A, 0x01, 0x03, 0x07, 0x0A, 0x0D, 0x09,
+	0x0E, 0x0A, 0x01, 0x03, 0x08, 0x09, 0x0D, 0x09, 0x0D, 0x0A, 0x01, 0x03, 0x09, 0x09, 0x0C, 0x09,
+	0x0C, 0x0A, 0x01, 0x03, 0x09, 0x0A, 0x0B, 0x09, 0x0B, 0x0A, 0x01, 0x03, 0x0A, 0x0A, 0x0A, 0x09,
+	0x0B, 0x09, 0x01, 0x03, 0x0B, 0x0A, 0x09, 0x09, 0x0A, 0x09, 0x01, 0x03, 0x0C, 0x09, 0x09, 0x09,
+	0x09, 0x09, 0x01, 0x03, 0x0D, 0x09, 0x08, 0x09, 0x08, 0x0A, 0x01, 0x03, 0x0E, 0x09, 0x07, 0x09,
+	0x08, 0x09, 0x01, 0x03, 0x0F, 0x09, 0x06, 0x09, 0x07, 0x09, 0x01, 0x03, 0x10, 0x08, 0x06, 0x09,
+	0x06, 0x09, 0x01, 0x03, 0x10, 0x09, 0x05, 0x09, 0x05, 0x09, 0x01, 0x03, 0x11, 0x09, 0x04, 0x09,
+	0x05, 0x08, 0x01, 0x03, 0x12, 0x09, 0x03, 0x09, 0x04, 0x08, 0x01, 0x03, 0x13, 0x08, 0x03, 0x09,
+	0x03, 0x08, 0x01, 0x03, 0x14, 0x08, 0x02, 0x09, 0x02, 0x09, 0x01, 0x01, 0x15, 0x1C, 0x01, 0x01,
+	0x11, 0x23, 0x01, 0x01, 0x0F, 0x28, 0x01, 0x01, 0x0D, 0x2B, 0x01, 0x01, 0x0C, 0x2E, 0x01, 0x01,
+	0x0B, 0x30, 0x01, 0x03, 0x0A, 0x0E, 0x06, 0x09, 0x06, 0x0F, 0x01, 0x03, 0x09, 0x0C, 0x09, 0x09,
+	0x09, 0x0C, 0x01, 0x03, 0x09, 0x0B, 0x0A, 0x09, 0x0A, 0x0C, 0x01, 0x03, 0x08, 0x0A, 0x0C, 0x09,
+	0x0C, 0x0B, 0x01, 0x03, 0x07, 0x0A, 0x0D, 0x09, 0x0D, 0x0A, 0x01, 0x03, 0x07, 0x0A, 0x0D, 0x09,
+	0x0D, 0x0B, 0x01, 0x03, 0x06, 0x0A, 0x0E, 0x09, 0x0E, 0x0A, 0x01, 0x03, 0x06, 0x09, 0x0F, 0x09,
+	0x0F, 0x0A, 0x01, 0x03, 0x05, 0x0A, 0x0F, 0x09, 0x0F, 0x0A, 0x01, 0x03, 0x05, 0x09, 0x10, 0x09,
+	0x10, 0x09, 0x01, 0x03, 0x05, 0x09, 0x10, 0x09, 0x10, 0x0A, 0x01, 0x03, 0x04, 0x0A, 0x10, 0x09,
+	0x11, 0x09, 0x01, 0x03, 0x04, 0x09, 0x11, 0x09, 0x11, 0x09, 0x01, 0x03, 0x04, 0x09, 0x11, 0x09,
+	0x11, 0x0A, 0x01, 0x03, 0x03, 0x09, 0x12, 0x09, 0x12, 0x09, 0x02, 0x03, 0x03, 0x09, 0x12, 0x09,
+	0x12, 0x0A, 0x01, 0x03, 0x02, 0x09, 0x13, 0x09, 0x13, 0x09, 0x01, 0x03, 0x02, 0x09, 0x13, 0x09,
+	0x13, 0x0A, 0x01, 0x03, 0x01, 0x09, 0x14, 0x09, 0x14, 0x09, 0x01, 0x03, 0x01, 0x09, 0x14, 0x09,
+	0x14, 0x0A, 0x01, 0x03, 0x00, 0x0A, 0x14, 0x09, 0x15, 0x09, 0x01, 0x03, 0x00, 0x09, 0x15, 0x09,
+	0x15, 0x09, 0x1B, 0x00,
+	// @37388 0xE7 (39 pixels wide)
+	0x25, 0x00, 0x01, 0x01, 0x0E, 0x0A, 0x01, 0x01, 0x09, 0x13, 0x01, 0x01, 0x06, 0x18, 0x01, 0x01,
+	0x04, 0x1B, 0x01, 0x01, 0x02, 0x1F, 0x01, 0x01, 0x02, 0x20, 0x01, 0x01, 0x03, 0x20, 0x01, 0x02,
+	0x03, 0x09, 0x09, 0x0E, 0x01, 0x02, 0x03, 0x05, 0x0F, 0x0D, 0x01, 0x02, 0x04, 0x02, 0x13, 0x0B,
+	0x01, 0x01, 0x1A, 0x0A, 0x01, 0x01, 0x1A, 0x0B, 0x04, 0x01, 0x1B, 0x0A, 0x01, 0x01, 0x1B, 0x09,
+	0x01, 0x01, 0x1A, 0x0A, 0x01, 0x01, 0x19, 0x0B, 0x01, 0x01, 0x18, 0x0B, 0x01, 0x01, 0x17, 0x0B,
+	0x01, 0x01, 0x15, 0x0C, 0x01, 0x01, 0x12, 0x0E, 0x01, 0x01, 0x09, 0x15, 0x01, 0x01, 0x09, 0x13,
+	0x01, 0x01, 0x09, 0x10, 0x01, 0x01, 0x09, 0x14, 0x01, 0x01, 0x09, 0x17, 0x01, 0x01, 0x09, 0x18,
+	0x01, 0x01, 0x12, 0x11, 0x01, 0x01, 0x17, 0x0D, 0x01, 0x01, 0x19, 0x0C, 0x01, 0x01, 0x1A, 0x0B,
+	0x01, 0x01, 0x1B, 0x0B, 0x01, 0x01, 0x1C, 0x0A, 0x01, 0x01, 0x1C, 0x0B, 0x05, 0x01, 0x1D, 0x0A,
+	0x02, 0x01, 0x1C, 0x0B, 0x01, 0x01, 0x1B, 0x0B, 0x01, 0x02, 0x02, 0x02, 0x16, 0x0C, 0x01, 0x02,
+	0x02, 0x05, 0x11, 0x0D, 0x01, 0x02, 0x01, 0x09, 0x0B, 0x10, 0x01, 0x01, 0x01, 0x23, 0x01, 0x01,
+	0x01, 0x22, 0x01, 0x01, 0x00, 0x22, 0x01, 0x01, 0x01, 0x1F, 0x01, 0x01, 0x03, 0x1B, 0x01, 0x01,
+	0x06, 0x16, 0x01, 0x01, 0x0A, 0x0E, 0x1A, 0x00,
+	// @37588 0xE8 (45 pixels wide)
+	0x26, 0x00, 0x01, 0x02, 0x00, 0x09, 0x19, 0x0B, 0x01, 0x02, 0x00, 0x09, 0x18, 0x0C, 0x02, 0x02,
+	0x00, 0x09, 0x17, 0x0D, 0x02, 0x02, 0x00, 0x09, 0x16, 0x0E, 0x01, 0x02, 0x00, 0x09, 0x15, 0x0F,
+	0x02, 0x02, 0x00, 0x09, 0x14, 0x10, 0x01, 0x02, 0x00, 0x09, 0x13, 0x11, 0x01, 0x03, 0x00, 0x09,
+	0x13, 0x07, 0x01, 0x09, 0x01, 0x03, 0x00, 0x09, 0x12, 0x08, 0x01, 0x09, 0x02, 0x03, 0x00, 0x09,
+	0x11, 0x08, 0x02, 0x09, 0x02, 0x03, 0x00, 0x09, 0x10, 0x08, 0x03, 0x09, 0x01, 0x03, 0x00, 0x09,
+	0x0F, 0x08, 0x04, 0x09, 0x01, 0x03, 0x00, 0x09, 0x0E, 0x09, 0x04, 0x09, 0x01, 0x03, 0x00, 0x09,
+	0x0E, 0x08, 0x05, 0x09, 0x01, 0x03, 0x00, 0x09, 0x0D, 0x09, 0x05, 0x09, 0x01, 0x03, 0x00, 0x09,
+	0x0D, 0x08, 0x06, 0x09, 0x01, 0x03, 0x00, 0x09, 0x0C, 0x09, 0x06, 0x09, 0x01, 0x03, 0x00, 0x09,
+	0x0B, 0x09, 0x07, 0x09, 0x01, 0x03, 0x00, 0x09, 0x0B, 0x08, 0x08, 0x09, 0x01, 0x03, 0x00, 0x09,
+	0x0A, 0x09, 0x08, 0x09, 0x02, 0x03, 0x00, 0x09, 0x09, 0x09, 0x09, 0x09, 0x01, 0x03, 0x00, 0x09,
+	0x08, 0x09, 0x0A, 0x09, 0x01, 0x03, 0x00, 0x09, 0x08, 0x08, 0x0B, 0x09, 0x01, 0x03, 0x00, 0x09,
+	0x07, 0x09, 0x0B, 0x09, 0x01, 0x03, 0x00, 0x09, 0x07, 0x08, 0x0C, 0x09, 0x01, 0x03, 0x00, 0x09,
+	0x06, 0x09, 0x0C, 0x09, 0x01, 0x03, 0x00, 0x09, 0x06, 0x08, 0x0D, 0x09, 0x01, 0x03, 0x00, 0x09,
+	0x05, 0x08, 0x0E, 0x09, 0x01, 0x03, 0x00, 0x09, 0x04, 0x09, 0x0E, 0x09, 0x01, 0x03, 0x00, 0x09,
+	0x04, 0x08, 0x0F, 0x09, 0x01, 0x03, 0x00, 0x09, 0x03, 0x09, 0x0F, 0x09, 0x01, 0x03, 0x00, 0x09,
+	0x03, 0x08, 0x10, 0x09, 0x02, 0x03, 0x00, 0x09, 0x02, 0x08, 0x11, 0x09, 0x02, 0x03, 0x00, 0x09,
+	0x01, 0x08, 0x12, 0x09, 0x01, 0x02, 0x00, 0x11, 0x13, 0x09, 0x02, 0x02, 0x00, 0x10, 0x14, 0x09,
+	0x02, 0x02, 0x00, 0x0F, 0x15, 0x09, 0x01, 0x02, 0x00, 0x0E, 0x16, 0x09, 0x02, 0x02, 0x00, 0x0D,
+	0x17, 0x09, 0x02, 0x02, 0x00, 0x0C, 0x18, 0x09, 0x1B, 0x00,
+	// @37886 0xE9 (45 pixels wide)
+	0x11, 0x00, 0x01, 0x02, 0x09, 0x07, 0x0E, 0x07, 0x01, 0x02, 0x09, 0x07, 0x0E, 0x06, 0x02, 0x02,
+	0x09, 0x07, 0x0D, 0x07, 0x01, 0x02, 0x09, 0x08, 0x0C, 0x07, 0x01, 0x02, 0x0A, 0x07, 0x0B, 0x07,
+	0x01, 0x02, 0x0A, 0x08, 0x09, 0x08, 0x01, 0x02, 0x0B, 0x08, 0x07, 0x08, 0x01, 0x01, 0x0B, 0x17,
+	0x01, 0x01, 0x0C, 0x15, 0x01, 0x01, 0x0D, 0x13, 0x01, 0x01, 0x0E, 0x10, 0x01, 0x01, 0x10, 0x0C,
+	0x08, 0x00, 0x01, 0x02, 0x00, 0x09, 0x19, 0x0B, 0x01, 0x02, 0x00, 0x09, 0x18, 0x0C, 0x02, 0x02,
+	0x00, 0x09, 0x17, 0x0D, 0x02, 0x02, 0x00, 0x09, 0x16, 0x0E, 0x01, 0x02, 0x00, 0x09, 0x15, 0x0F,
+	0x02, 0x02, 0x00, 0x09, 0x14, 0x10, 0x01, 0x02, 0x00, 0x09, 0x13, 0x11, 0x01, 0x03, 0x00, 0x09,
+	0x13, 0x07, 0x01, 0x09, 0x01, 0x03, 0x00, 0x09, 0x12, 0x08, 0x01, 0x09, 0x02, 0x03, 0x00, 0x09,
+	0x11, 0x08, 0x02, 0x09, 0x02, 0x03, 0x00, 0x09, 0x10, 0x08, 0x03, 0x09, 0x01, 0x03, 0x00, 0x09,
+	0x0F, 0x08, 0x04, 0x09, 0x01, 0x03, 0x00, 0x09, 0x0E, 0x09, 0x04, 0x09, 0x01, 0x03, 0x00, 0x09,
+	0x0E, 0x08, 0x05, 0x09, 0x01, 0x03, 0x00, 0x09, 0x0D, 0x09, 0x05, 0x09, 0x01, 0x03, 0x00, 0x09,
+	0x0D, 0x08, 0x06, 0x09, 0x01, 0x03, 0x00, 0x09, 0x0C, 0x09, 0x06, 0x09, 0x01, 0x03, 0x00, 0x09,
+	0x0B, 0x09, 0x07, 0x09, 0x01, 0x03, 0x00, 0x09, 0x0B, 0x08, 0x08, 0x09, 0x01, 0x03, 0x00, 0x09,
+	0x0A, 0x09, 0x08, 0x09, 0x02, 0x03, 0x00, 0x09, 0x09, 0x09, 0x09, 0x09, 0x01, 0x03, 0x00, 0x09,
+	0x08, 0x09, 0x0A, 0x09, 0x01, 0x03, 0x00, 0x09, 0x08, 0x08, 0x0B, 0x09, 0x01, 0x03, 0x00, 0x09,
+	0x07, 0x09, 0x0B, 0x09, 0x01, 0x03, 0x00, 0x09, 0x07, 0x08, 0x0C, 0x09, 0x01, 0x03, 0x00, 0x09,
+	0x06, 0x09, 0x0C, 0x09, 0x01, 0x03, 0x00, 0x09, 0x06, 0x08, 0x0D, 0x09, 0x01, 0x03, 0x00, 0x09,
+	0x05, 0x08, 0x0E, 0x09, 0x01, 0x03, 0x00, 0x09, 0x04, 0x09, 0x0E, 0x09, 0x01, 0x03, 0x00, 0x09,
+	0x04, 0x08, 0x0F, 0x09, 0x01, 0x03, 0x00, 0x09, 0x03, 0x09, 0x0F, 0x09, 0x01, 0x03, 0x00, 0x09,
+	0x03, 0x08, 0x10, 0x09, 0x02, 0x03, 0x00, 0x09, 0x02, 0x08, 0x11, 0x09, 0x02, 0x03, 0x00, 0x09,
+	0x01, 0x08, 0x12, 0x09, 0x01, 0x02, 0x00, 0x11, 0x13, 0x09, 0x02, 0x02, 0x00, 0x10, 0x14, 0x09,
+	0x02, 0x02, 0x00, 0x0F, 0x15, 0x09, 0x01, 0x02, 0x00, 0x0E, 0x16, 0x09, 0x02, 0x02, 0x00, 0x0D,
+	0x17, 0x09, 0x02, 0x02, 0x00, 0x0C, 0x18, 0x09, 0x1B, 0x00,
+	// @38248 0xEA (42 pixels wide)
+	0x26, 0x00, 0x01, 0x02, 0x00, 0x09, 0x16, 0x0B, 0x01, 0x02, 0x00, 0x09, 0x15, 0x0B, 0x01, 0x02,
+	0x00, 0x09, 0x14, 0x0B, 0x01, 0x02, 0x00, 0x09, 0x13, 0x0B, 0x01, 0x02, 0x00, 0x09, 0x12, 0x0B,
+	0x01, 0x02, 0x00, 0x09, 0x11, 0x0B, 0x01, 0x02, 0x00, 0x09, 0x10, 0x0B, 0x01, 0x02, 0x00, 0x09,
+	0x10, 0x0A, 0x01, 0x02, 0x00, 0x09, 0x0F, 0x0A, 0x01, 0x02, 0x00, 0x09, 0x0E, 0x0A, 0x01, 0x02,
+	0x00, 0x09, 0x0D, 0x0A, 0x01, 0x02, 0x00, 0x09, 0x0C, 0x0A, 0x01, 0x02, 0x00, 0x09, 0x0B, 0x0A,
+	0x01, 0x02, 0x00, 0x09, 0x0A, 0x0A, 0x01, 0x02, 0x00, 0x09, 0x09, 0x0A, 0x01, 0x02, 0x00, 0x09,
+	0x09, 0x09, 0x01, 0x02, 0x00, 0x09, 0x08, 0x0A, 0x01, 0x02, 0x00, 0x09, 0x07, 0x0A, 0x01, 0x02,
+	0x00, 0x09, 0x06, 0x0A, 0x01, 0x02, 0x00, 0x09, 0x05, 0x0A, 0x01, 0x02, 0x00, 0x09, 0x04, 0x0A,
+	0x01, 0x02, 0x00, 0x09, 0x03, 0x0A, 0x01, 0x02, 0x00, 0x09, 0x03, 0x09, 0x01, 0x01, 0x00, 0x14,
+	0x01, 0x01, 0x00, 0x18, 0x01, 0x01, 0x00, 0x1A, 0x01, 0x01, 0x00, 0x1C, 0x01, 0x01, 0x00, 0x1D,
+	0x01, 0x01, 0x00, 0x1E, 0x01, 0x02, 0x00, 0x09, 0x05, 0x11, 0x01, 0x02, 0x00, 0x09, 0x09, 0x0E,
+	0x01, 0x02, 0x00, 0x09, 0x0B, 0x0D, 0x01, 0x02, 0x00, 0x09, 0x0D, 0x0B, 0x01, 0x02, 0x00, 0x09,
+	0x0E, 0x0B, 0x01, 0x02, 0x00, 0x09, 0x0F, 0x0B, 0x01, 0x02, 0x00, 0x09, 0x10, 0x0A, 0x01, 0x02,
+	0x00, 0x09, 0x10, 0x0B, 0x01, 0x02, 0x00, 0x09, 0x11, 0x0A, 0x02, 0x02, 0x00, 0x09, 0x12, 0x0A,
+	0x03, 0x02, 0x00, 0x09, 0x13, 0x0A, 0x02, 0x02, 0x00, 0x09, 0x14, 0x0A, 0x02, 0x02, 0x00, 0x09,
+	0x15, 0x0A, 0x02, 0x02, 0x00, 0x09, 0x16, 0x0A, 0x01, 0x02, 0x00, 0x09, 0x17, 0x09, 0x01, 0x02,
+	0x00, 0x09, 0x17, 0x0A, 0x01, 0x02, 0x00, 0x09, 0x18, 0x09, 0x1B, 0x00,
+	// @38516 0xEB (47 pixels wide)
+	0x26, 0x00, 0x08, 0x01, 0x0B, 0x24, 0x12, 0x02, 0x0B, 0x09, 0x11, 0x0A, 0x03, 0x02, 0x0B, 0x08,
+	0x12, 0x0A, 0x07, 0x02, 0x0A, 0x09, 0x12, 0x0A, 0x01, 0x02, 0x09, 0x0A, 0x12, 0x0A, 0x02, 0x02,
+	0x09, 0x09, 0x13, 0x0A, 0x02, 0x02, 0x08, 0x0A, 0x13, 0x0A, 0x01, 0x02, 0x07, 0x0A, 0x14, 0x0A,
+	0x01, 0x02, 0x06, 0x0B, 0x14, 0x0A, 0x01, 0x02, 0x05, 0x0B, 0x15, 0x0A, 0x01, 0x02, 0x03, 0x0D,
+	0x15, 0x0A, 0x02, 0x02, 0x00, 0x0F, 0x16, 0x0A, 0x01, 0x02, 0x00, 0x0E, 0x17, 0x0A, 0x01, 0x02,
+	0x01, 0x0C, 0x18, 0x0A, 0x01, 0x02, 0x01, 0x0B, 0x19, 0x0A, 0x01, 0x02, 0x01, 0x09, 0x1B, 0x0A,
+	0x01, 0x02, 0x01, 0x07, 0x1D, 0x0A, 0x01, 0x01, 0x01, 0x03, 0x1A, 0x00,
+	// @38624 0xEC (59 pixels wide)
+	0x26, 0x00, 0x01, 0x02, 0x03, 0x0C, 0x1D, 0x0B, 0x01, 0x02, 0x03, 0x0C, 0x1C, 0x0C, 0x01, 0x02,
+	0x03, 0x0D, 0x1B, 0x0D, 0x01, 0x02, 0x03, 0x0D, 0x1A, 0x0E, 0x02, 0x02, 0x03, 0x0E, 0x19, 0x0E,
+	0x01, 0x02, 0x03, 0x0E, 0x18, 0x0F, 0x02, 0x02, 0x03, 0x0F, 0x17, 0x0F, 0x01, 0x04, 0x03, 0x07,
+	0x01, 0x07, 0x16, 0x07, 0x01, 0x08, 0x02, 0x04, 0x03, 0x07, 0x01, 0x08, 0x15, 0x07, 0x01, 0x08,
+	0x01, 0x04, 0x03, 0x07, 0x02, 0x07, 0x14, 0x07, 0x02, 0x08, 0x01, 0x04, 0x02, 0x08, 0x02, 0x08,
+	0x13, 0x07, 0x02, 0x08, 0x01, 0x04, 0x02, 0x08, 0x02, 0x08, 0x12, 0x08, 0x02, 0x08, 0x01, 0x04,
+	0x02, 0x08, 0x03, 0x07, 0x12, 0x07, 0x03, 0x08, 0x01, 0x04, 0x02, 0x08, 0x03, 0x08, 0x11, 0x07,
+	0x03, 0x08, 0x01, 0x04, 0x02, 0x08, 0x03, 0x08, 0x10, 0x08, 0x03, 0x09, 0x01, 0x04, 0x02, 0x08,
+	0x03, 0x09, 0x0F, 0x07, 0x04, 0x09, 0x01, 0x04, 0x02, 0x08, 0x04, 0x08, 0x0F, 0x07, 0x04, 0x09,
+	0x01, 0x04, 0x02, 0x08, 0x04, 0x08, 0x0E, 0x08, 0x04, 0x09, 0x01, 0x04, 0x02, 0x08, 0x04, 0x09,
+	0x0D, 0x07, 0x06, 0x08, 0x01, 0x04, 0x02, 0x08, 0x05, 0x08, 0x0D, 0x07, 0x06, 0x08, 0x01, 0x04,
+	0x02, 0x08, 0x05, 0x08, 0x0C, 0x08, 0x06, 0x08, 0x01, 0x04, 0x02, 0x08, 0x05, 0x09, 0x0B, 0x07,
+	0x07, 0x08, 0x01, 0x04, 0x02, 0x08, 0x06, 0x08, 0x0A, 0x08, 0x07, 0x08, 0x01, 0x04, 0x01, 0x09,
+	0x06, 0x08, 0x0A, 0x08, 0x07, 0x08, 0x01, 0x04, 0x01, 0x09, 0x06, 0x09, 0x09, 0x07, 0x08, 0x08,
+	0x01, 0x04, 0x01, 0x09, 0x07, 0x08, 0x08, 0x08, 0x08, 0x08, 0x01, 0x04, 0x01, 0x08, 0x08, 0x08,
+	0x08, 0x07, 0x09, 0x08, 0x01, 0x04, 0x01, 0x08, 0x09, 0x08, 0x07, 0x07, 0x09, 0x08, 0x01, 0x04,
+	0x01, 0x08, 0x09, 0x08, 0x06, 0x08, 0x09, 0x09, 0x01, 0x04, 0x01, 0x08, 0x09, 0x08, 0x06, 0x07,
+	0x0A, 0x09, 0x01, 0x04, 0x01, 0x08, 0x0A, 0x08, 0x05, 0x07, 0x0A, 0x09, 0x02, 0x04, 0x01, 0x08,
+	0x0A, 0x08, 0x04, 0x07, 0x0B, 0x09, 0x01, 0x04, 0x01, 0x08, 0x0B, 0x08, 0x03, 0x07, 0x0B, 0x09,
+	0x02, 0x04, 0x01, 0x08, 0x0B, 0x08, 0x02, 0x07, 0x0C, 0x09, 0x01, 0x04, 0x00, 0x09, 0x0C, 0x08,
+	0x01, 0x07, 0x0C, 0x09, 0x01, 0x03, 0x00, 0x09, 0x0C, 0x0F, 0x0D, 0x09, 0x01, 0x03, 0x00, 0x09,
+	0x0D, 0x0E, 0x0E, 0x08, 0x02, 0x03, 0x00, 0x09, 0x0D, 0x0D, 0x0F, 0x08, 0x01, 0x03, 0x00, 0x09,
+	0x0E, 0x0C, 0x0F, 0x08, 0x01, 0x03, 0x00, 0x09, 0x0E, 0x0B, 0x10, 0x09, 0x01, 0x03, 0x00, 0x08,
+	0x0F, 0x0B, 0x10, 0x09, 0x01, 0x03, 0x00, 0x08, 0x10, 0x0A, 0x10, 0x09, 0x02, 0x03, 0x00, 0x08,
+	0x10, 0x09, 0x11, 0x09, 0x02, 0x03, 0x00, 0x08, 0x11, 0x07, 0x12, 0x09, 0x1B, 0x00,
+	// @39022 0xED (44 pixels wide)
+	0x26, 0x00, 0x15, 0x02, 0x00, 0x0A, 0x18, 0x0A, 0x08, 0x01, 0x00, 0x2C, 0x17, 0x02, 0x00, 0x0A,
+	0x18, 0x0A, 0x1B, 0x00,
+	// @39042 0xEE (51 pixels wide)
+	0x25, 0x00, 0x01, 0x01, 0x14, 0x0B, 0x01, 0x01, 0x11, 0x12, 0x01, 0x01, 0x0E, 0x17, 0x01, 0x01,
+	0x0C, 0x1B, 0x01, 0x01, 0x0B, 0x1E, 0x01, 0x01, 0x09, 0x21, 0x01, 0x01, 0x08, 0x23, 0x01, 0x02,
+	0x07, 0x0F, 0x07, 0x0F, 0x01, 0x02, 0x06, 0x0D, 0x0D, 0x0D, 0x01, 0x02, 0x06, 0x0B, 0x11, 0x0C,
+	0x01, 0x02, 0x05, 0x0B, 0x13, 0x0B, 0x01, 0x02, 0x04, 0x0B, 0x15, 0x0B, 0x01, 0x02, 0x04, 0x0A,
+	0x17, 0x0A, 0x01, 0x02, 0x03, 0x0A, 0x18, 0x0B, 0x01, 0x02, 0x03, 0x0A, 0x19, 0x0A, 0x02, 0x02,
+	0x02, 0x0A, 0x1B, 0x0A, 0x01, 0x02, 0x01, 0x0A, 0x1C, 0x0B, 0x02, 0x02, 0x01, 0x0A, 0x1D, 0x0A,
+	0x01, 0x02, 0x01, 0x09, 0x1E, 0x0A, 0x01, 0x02, 0x01, 0x09, 0x1F, 0x09, 0x09, 0x02, 0x00, 0x0A,
+	0x1F, 0x0A, 0x02, 0x02, 0x00, 0x0A, 0x1F, 0x09, 0x01, 0x02, 0x01, 0x09, 0x1E, 0x0A, 0x02, 0x02,
+	0x01, 0x0A, 0x1D, 0x0A, 0x01, 0x02, 0x01, 0x0A, 0x1C, 0x0A, 0x01, 0x02, 0x02, 0x0A, 0x1B, 0x0A,
+	0x01, 0x02, 0x02, 0x0A, 0x1A, 0x0B, 0x01, 0x02, 0x02, 0x0B, 0x19, 0x0A, 0x01, 0x02, 0x03, 0x0A,
+	0x18, 0x0B, 0x01, 0x02, 0x03, 0x0B, 0x16, 0x0B, 0x01, 0x02, 0x04, 0x0B, 0x15, 0x0B, 0x01, 0x02,
+	0x04, 0x0C, 0x13, 0x0B, 0x01, 0x02, 0x05, 0x0C, 0x10, 0x0C, 0x01, 0x02, 0x06, 0x0D, 0x0D, 0x0D,
+	0x01, 0x02, 0x07, 0x0E, 0x08, 0x0F, 0x01, 0x01, 0x08, 0x23, 0x01, 0x01, 0x09, 0x20, 0x01, 0x01,
+	0x0A, 0x1E, 0x01, 0x01, 0x0C, 0x1B, 0x01, 0x01, 0x0D, 0x18, 0x01, 0x01, 0x0F, 0x14, 0x01, 0x01,
+	0x13, 0x0C, 0x1A, 0x00,
+	// @39270 0xEF (43 pixels wide)
+	0x26, 0x00, 0x08, 0x01, 0x00, 0x2B, 0x2C, 0x02, 0x00, 0x0A, 0x18, 0x09, 0x1B, 0x00,
+	// @39284 0xF0 (50 pixels wide)
+	0x25, 0x00, 0x01, 0x01, 0x17, 0x0A, 0x01, 0x02, 0x00, 0x09, 0x0A, 0x11, 0x01, 0x02, 0x00, 0x09,
+	0x08, 0x15, 0x01, 0x02, 0x01, 0x08, 0x07, 0x18, 0x01, 0x02, 0x01, 0x08, 0x05, 0x1B, 0x01, 0x02,
+	0x01, 0x08, 0x04, 0x1D, 0x01, 0x02, 0x01, 0x08, 0x03, 0x1F, 0x01, 0x02, 0x01, 0x08, 0x02, 0x21,
+	0x01, 0x03, 0x01, 0x08, 0x02, 0x09, 0x0A, 0x0F, 0x01, 0x03, 0x01, 0x08, 0x01, 0x08, 0x0E, 0x0D,
+	0x01, 0x02, 0x01, 0x0F, 0x12, 0x0C, 0x01, 0x02, 0x01, 0x0E, 0x14, 0x0C, 0x01, 0x02, 0x01, 0x0D,
+	0x16, 0x0B, 0x02, 0x02, 0x01, 0x0C, 0x18, 0x0B, 0x01, 0x02, 0x01, 0x0B, 0x1A, 0x0A, 0x01, 0x02,
+	0x01, 0x0B, 0x1A, 0x0B, 0x03, 0x02, 0x01, 0x0A, 0x1C, 0x0A, 0x01, 0x02, 0x01, 0x0A, 0x1D, 0x0A,
+	0x0C, 0x02, 0x01, 0x09, 0x1E, 0x0A, 0x01, 0x02, 0x01, 0x09, 0x1E, 0x09, 0x01, 0x02, 0x01, 0x09,
+	0x1D, 0x0A, 0x02, 0x02, 0x01, 0x0A, 0x1C, 0x0A, 0x01, 0x02, 0x01, 0x0A, 0x1B, 0x0A, 0x01, 0x02,
+	0x01, 0x0B, 0x1A, 0x0A, 0x01, 0x02, 0x01, 0x0B, 0x19, 0x0B, 0x01, 0x02, 0x01, 0x0C, 0x18, 0x0A,
+	0x01, 0x02, 0x01, 0x0C, 0x17, 0x0B, 0x01, 0x02, 0x01, 0x0D, 0x15, 0x0B, 0x01, 0x02, 0x01, 0x0E,
+	0x13, 0x0C, 0x01, 0x02, 0x01, 0x10, 0x10, 0x0C, 0x01, 0x02, 0x01, 0x12, 0x0C, 0x0D, 0x01, 0x03,
+	0x01, 0x09, 0x01, 0x0B, 0x06, 0x0F, 0x01, 0x02, 0x01, 0x09, 0x01, 0x1F, 0x01, 0x02, 0x01, 0x09,
+	0x02, 0x1D, 0x01, 0x02, 0x01, 0x09, 0x03, 0x1B, 0x01, 0x02, 0x01, 0x09, 0x04, 0x19, 0x01, 0x02,
+	0x01, 0x09, 0x06, 0x15, 0x01, 0x02, 0x01, 0x09, 0x08, 0x11, 0x01, 0x02, 0x01, 0x09, 0x0A, 0x0C,
+	0x14, 0x01, 0x01, 0x09, 0x06, 0x00,
+	// @39530 0xF1 (41 pixels wide)
+	0x25, 0x00, 0x01, 0x01, 0x16, 0x0C, 0x01, 0x01, 0x12, 0x14, 0x01, 0x01, 0x0F, 0x19, 0x01, 0x01,
+	0x0D, 0x1C, 0x01, 0x01, 0x0C, 0x1C, 0x01, 0x01, 0x0A, 0x1E, 0x01, 0x01, 0x09, 0x1F, 0x01, 0x01,
+	0x08, 0x20, 0x01, 0x02, 0x07, 0x0E, 0x0E, 0x04, 0x01, 0x02, 0x06, 0x0D, 0x13, 0x01, 0x01, 0x01,
+	0x05, 0x0C, 0x01, 0x01, 0x05, 0x0B, 0x01, 0x01, 0x04, 0x0B, 0x01, 0x01, 0x03, 0x0B, 0x01, 0x01,
+	0x03, 0x0A, 0x01, 0x01, 0x02, 0x0B, 0x02, 0x01, 0x02, 0x0A, 0x02, 0x01, 0x01, 0x0A, 0x02, 0x01,
+	0x01, 0x09, 0x0B, 0x01, 0x00, 0x0A, 0x01, 0x01, 0x01, 0x09, 0x03, 0x01, 0x01, 0x0A, 0x01, 0x01,
+	0x02, 0x0A, 0x02, 0x01, 0x02, 0x0B, 0x01, 0x01, 0x03, 0x0B, 0x01, 0x01, 0x03, 0x0C, 0x01, 0x01,
+	0x04, 0x0C, 0x01, 0x01, 0x04, 0x0D, 0x01, 0x02, 0x05, 0x0E, 0x13, 0x01, 0x01, 0x02, 0x06, 0x0F,
+	0x0E, 0x04, 0x01, 0x01, 0x07, 0x21, 0x01, 0x01, 0x08, 0x20, 0x01, 0x01, 0x09, 0x1F, 0x01, 0x01,
+	0x0A, 0x1E, 0x01, 0x01, 0x0C, 0x1D, 0x01, 0x01, 0x0E, 0x1A, 0x01, 0x01, 0x10, 0x15, 0x01, 0x01,
+	0x14, 0x0C, 0x1A, 0x00,
+	// @39694 0xF2 (42 pixels wide)
+	0x26, 0x00, 0x08, 0x01, 0x00, 0x2A, 0x2C, 0x01, 0x10, 0x0A, 0x1B, 0x00,
+	// @39706 0xF3 (49 pixels wide)
+	0x26, 0x00, 0x01, 0x02, 0x00, 0x0A, 0x1D, 0x0A, 0x01, 0x02, 0x00, 0x0B, 0x1B, 0x0A, 0x01, 0x02,
+	0x01, 0x0A, 0x1B, 0x0A, 0x01, 0x02, 0x01, 0x0A, 0x1B, 0x09, 0x02, 0x02, 0x02, 0x0A, 0x19, 0x0A,
+	0x01, 0x02, 0x02, 0x0B, 0x18, 0x09, 0x01, 0x02, 0x03, 0x0A, 0x17, 0x0A, 0x01, 0x02, 0x03, 0x0A,
+	0x17, 0x09, 0x01, 0x02, 0x04, 0x0A, 0x16, 0x09, 0x01, 0x02, 0x04, 0x0A, 0x15, 0x0A, 0x01, 0x02,
+	0x04, 0x0A, 0x15, 0x09, 0x01, 0x02, 0x05, 0x0A, 0x14, 0x09, 0x01, 0x02, 0x05, 0x0A, 0x13, 0x0A,
+	0x01, 0x02, 0x06, 0x09, 0x13, 0x09, 0x01, 0x02, 0x06, 0x0A, 0x12, 0x09, 0x01, 0x02, 0x06, 0x0A,
+	0x11, 0x09, 0x02, 0x02, 0x07, 0x0A, 0x10, 0x09, 0x01, 0x02, 0x08, 0x09, 0x0F, 0x09, 0x01, 0x02,
+	0x08, 0x0A, 0x0E, 0x09, 0x01, 0x02, 0x08, 0x0A, 0x0D, 0x0A, 0x01, 0x02, 0x09, 0x09, 0x0D, 0x09,
+	0x01, 0x02, 0x09, 0x0A, 0x0C, 0x09, 0x01, 0x02, 0x0A, 0x09, 0x0B, 0x09, 0x02, 0x02, 0x0A, 0x0A,
+	0x0A, 0x09, 0x01, 0x02, 0x0B, 0x09, 0x09, 0x09, 0x01, 0x02, 0x0B, 0x0A, 0x08, 0x09, 0x01, 0x02,
+	0x0C, 0x09, 0x08, 0x08, 0x01, 0x02, 0x0C, 0x09, 0x07, 0x09, 0x01, 0x02, 0x0C, 0x0A, 0x06, 0x09,
+	0x01, 0x02, 0x0D, 0x09, 0x06, 0x08, 0x01, 0x02, 0x0D, 0x09, 0x05, 0x09, 0x01, 0x02, 0x0E, 0x09,
+	0x04, 0x09, 0x02, 0x02, 0x0E, 0x09, 0x04, 0x08, 0x02, 0x02, 0x0F, 0x09, 0x02, 0x08, 0x01, 0x02,
+	0x10, 0x08, 0x02, 0x08, 0x02, 0x01, 0x10, 0x11, 0x02, 0x01, 0x11, 0x0F, 0x01, 0x01, 0x12, 0x0E,
+	0x02, 0x01, 0x12, 0x0D, 0x02, 0x01, 0x13, 0x0B, 0x02, 0x01, 0x14, 0x09, 0x01, 0x01, 0x13, 0x0A,
+	0x02, 0x01, 0x13, 0x09, 0x02, 0x01, 0x12, 0x09, 0x01, 0x01, 0x11, 0x09, 0x01, 0x01, 0x10, 0x0A,
+	0x01, 0x01, 0x10, 0x09, 0x01, 0x01, 0x0F, 0x09, 0x01, 0x01, 0x0E, 0x0A, 0x01, 0x01, 0x0D, 0x0A,
+	0x01, 0x01, 0x0C, 0x0B, 0x01, 0x01, 0x0B, 0x0B, 0x01, 0x01, 0x09, 0x0C, 0x01, 0x01, 0x08, 0x0C,
+	0x01, 0x01, 0x06, 0x0E, 0x01, 0x01, 0x04, 0x0F, 0x01, 0x01, 0x03, 0x0F, 0x01, 0x01, 0x03, 0x0E,
+	0x01, 0x01, 0x04, 0x0C, 0x01, 0x01, 0x04, 0x0A, 0x01, 0x01, 0x04, 0x09, 0x01, 0x01, 0x05, 0x06,
+	0x01, 0x01, 0x05, 0x04, 0x01, 0x01, 0x05, 0x01, 0x03, 0x00,
+	// @40036 0xF4 (61 pixels wide)
+	0x0E, 0x00, 0x17, 0x01, 0x1A, 0x09, 0x01, 0x01, 0x18, 0x0E, 0x01, 0x01, 0x13, 0x17, 0x01, 0x01,
+	0x10, 0x1D, 0x01, 0x01, 0x0E, 0x21, 0x01, 0x01, 0x0C, 0x25, 0x01, 0x01, 0x0A, 0x28, 0x01, 0x01,
+	0x09, 0x2B, 0x01, 0x03, 0x08, 0x0E, 0x04, 0x09, 0x03, 0x0F, 0x01, 0x03, 0x07, 0x0D, 0x06, 0x09,
+	0x06, 0x0D, 0x01, 0x03, 0x06, 0x0C, 0x08, 0x09, 0x08, 0x0C, 0x01, 0x03, 0x05, 0x0C, 0x09, 0x09,
+	0x09, 0x0C, 0x01, 0x03, 0x05, 0x0B, 0x0A, 0x09, 0x0A, 0x0B, 0x01, 0x03, 0x04, 0x0B, 0x0B, 0x09,
+	0x0B, 0x0B, 0x01, 0x03, 0x03, 0x0B, 0x0C, 0x09, 0x0C, 0x0B, 0x01, 0x03, 0x03, 0x0A, 0x0D, 0x09,
+	0x0D, 0x0A, 0x01, 0x03, 0x02, 0x0A, 0x0E, 0x09, 0x0D, 0x0A, 0x01, 0x03, 0x02, 0x0A, 0x0E, 0x09,
+	0x0E, 0x0A, 0x01, 0x03, 0x02, 0x09, 0x0F, 0x09, 0x0E, 0x0A, 0x02, 0x03, 0x01, 0x0A, 0x0F, 0x09,
+	0x0F, 0x0A, 0x02, 0x03, 0x01, 0x09, 0x10, 0x09, 0x10, 0x09, 0x02, 0x03, 0x00, 0x0A, 0x10, 0x09,
+	0x10, 0x09, 0x01, 0x03, 0x00, 0x0A, 0x10, 0x09, 0x10, 0x0A, 0x05, 0x03, 0x00, 0x09, 0x11, 0x09,
+	0x10, 0x0A, 0x03, 0x03, 0x00, 0x0A, 0x10, 0x09, 0x10, 0x09, 0x01, 0x03, 0x01, 0x09, 0x10, 0x09,
+	0x10, 0x09, 0x01, 0x03, 0x01, 0x09, 0x10, 0x09, 0x0F, 0x0A, 0x01, 0x03, 0x01, 0x0A, 0x0F, 0x09,
+	0x0F, 0x0A, 0x01, 0x03, 0x01, 0x0A, 0x0F, 0x09, 0x0E, 0x0A, 0x01, 0x03, 0x02, 0x0A, 0x0E, 0x09,
+	0x0E, 0x0A, 0x01, 0x03, 0x02, 0x0A, 0x0E, 0x09, 0x0D, 0x0B, 0x01, 0x03, 0x02, 0x0B, 0x0D, 0x09,
+	0x0D, 0x0A, 0x01, 0x03, 0x03, 0x0B, 0x0C, 0x09, 0x0C, 0x0B, 0x01, 0x03, 0x04, 0x0A, 0x0C, 0x09,
+	0x0B, 0x0B, 0x01, 0x03, 0x04, 0x0B, 0x0B, 0x09, 0x0A, 0x0B, 0x01, 0x03, 0x05, 0x0B, 0x0A, 0x09,
+	0x09, 0x0C, 0x01, 0x03, 0x06, 0x0C, 0x08, 0x09, 0x08, 0x0C, 0x01, 0x03, 0x06, 0x0D, 0x07, 0x09,
+	0x06, 0x0D, 0x01, 0x03, 0x07, 0x0F, 0x04, 0x09, 0x04, 0x0E, 0x01, 0x01, 0x09, 0x2B, 0x01, 0x01,
+	0x0A, 0x29, 0x01, 0x01, 0x0B, 0x26, 0x01, 0x01, 0x0D, 0x22, 0x01, 0x01, 0x0F, 0x1E, 0x01, 0x01,
+	0x12, 0x19, 0x01, 0x01, 0x16, 0x10, 0x14, 0x01, 0x1A, 0x09, 0x06, 0x00,
+	// @40352 0xF5 (47 pixels wide)
+	0x26, 0x00, 0x01, 0x02, 0x01, 0x0A, 0x19, 0x0B, 0x01, 0x02, 0x02, 0x0A, 0x18, 0x0A, 0x01, 0x02,
+	0x02, 0x0B, 0x16, 0x0A, 0x01, 0x02, 0x03, 0x0A, 0x15, 0x0B, 0x01, 0x02, 0x04, 0x0A, 0x14, 0x0A,
+	0x01, 0x02, 0x04, 0x0B, 0x12, 0x0A, 0x01, 0x02, 0x05, 0x0A, 0x11, 0x0A, 0x01, 0x02, 0x06, 0x0A,
+	0x10, 0x0A, 0x01, 0x02, 0x06, 0x0B, 0x0E, 0x0A, 0x01, 0x02, 0x07, 0x0A, 0x0E, 0x09, 0x01, 0x02,
+	0x08, 0x0A, 0x0C, 0x0A, 0x01, 0x02, 0x09, 0x0A, 0x0A, 0x0A, 0x01, 0x02, 0x09, 0x0A, 0x0A, 0x09,
+	0x01, 0x02, 0x0A, 0x0A, 0x08, 0x09, 0x01, 0x02, 0x0B, 0x0A, 0x06, 0x0A, 0x01, 0x02, 0x0B, 0x0A,
+	0x06, 0x09, 0x01, 0x02, 0x0C, 0x0A, 0x04, 0x09, 0x01, 0x02, 0x0D, 0x09, 0x03, 0x0A, 0x01, 0x02,
+	0x0D, 0x0A, 0x02, 0x09, 0x01, 0x01, 0x0E, 0x13, 0x01, 0x01, 0x0F, 0x12, 0x01, 0x01, 0x0F, 0x11,
+	0x01, 0x01, 0x10, 0x0F, 0x01, 0x01, 0x11, 0x0D, 0x01, 0x01, 0x12, 0x0C, 0x01, 0x01, 0x12, 0x0B,
+	0x01, 0x01, 0x12, 0x0C, 0x01, 0x01, 0x11, 0x0E, 0x01, 0x01, 0x10, 0x0F, 0x01, 0x01, 0x10, 0x10,
+	0x01, 0x01, 0x0F, 0x12, 0x01, 0x01, 0x0E, 0x13, 0x01, 0x02, 0x0D, 0x0A, 0x01, 0x0A, 0x01, 0x02,
+	0x0D, 0x09, 0x03, 0x0A, 0x01, 0x02, 0x0C, 0x09, 0x04, 0x0A, 0x01, 0x02, 0x0B, 0x0A, 0x05, 0x0A,
+	0x01, 0x02, 0x0B, 0x09, 0x06, 0x0B, 0x01, 0x02, 0x0A, 0x0A, 0x07, 0x0A, 0x01, 0x02, 0x09, 0x0A,
+	0x09, 0x0A, 0x01, 0x02, 0x09, 0x09, 0x0A, 0x0B, 0x01, 0x02, 0x08, 0x0A, 0x0B, 0x0B, 0x01, 0x02,
+	0x07, 0x0A, 0x0D, 0x0A, 0x01, 0x02, 0x06, 0x0A, 0x0E, 0x0B, 0x01, 0x02, 0x06, 0x0A, 0x0F, 0x0B,
+	0x01, 0x02, 0x05, 0x0A, 0x11, 0x0A, 0x01, 0x02, 0x04, 0x0A, 0x12, 0x0B, 0x01, 0x02, 0x04, 0x0A,
+	0x13, 0x0B, 0x01, 0x02, 0x03, 0x0A, 0x15, 0x0A, 0x01, 0x02, 0x02, 0x0A, 0x16, 0x0B, 0x01, 0x02,
+	0x02, 0x0A, 0x17, 0x0B, 0x01, 0x02, 0x01, 0x0A, 0x19, 0x0A, 0x01, 0x02, 0x00, 0x0B, 0x19, 0x0B,
+	0x1B, 0x00,
+	// @40642 0xF6 (48 pixels wide)
+	0x26, 0x00, 0x2D, 0x02, 0x00, 0x0A, 0x18, 0x09, 0x07, 0x01, 0x00, 0x30, 0x0D, 0x01, 0x28, 0x08,
+	0x03, 0x01, 0x29, 0x07, 0x0B, 0x00,
+	// @40664 0xF7 (41 pixels wide)
+	0x26, 0x00, 0x14, 0x02, 0x00, 0x09, 0x16, 0x0A, 0x04, 0x02, 0x00, 0x0A, 0x15, 0x0A, 0x01, 0x02,
+	0x01, 0x0A, 0x14, 0x0A, 0x01, 0x02, 0x01, 0x0B, 0x13, 0x0A, 0x01, 0x02, 0x01, 0x0C, 0x10, 0x0C,
+	0x01, 0x02, 0x02, 0x0C, 0x0D, 0x0E, 0x01, 0x02, 0x02, 0x0F, 0x06, 0x12, 0x01, 0x01, 0x03, 0x26,
+	0x01, 0x01, 0x04, 0x25, 0x01, 0x01, 0x05, 0x24, 0x01, 0x02, 0x06, 0x18, 0x01, 0x0A, 0x01, 0x02,
+	0x07, 0x15, 0x03, 0x0A, 0x01, 0x02, 0x0A, 0x0F, 0x06, 0x0A, 0x01, 0x02, 0x0E, 0x06, 0x0B, 0x0A,
+	0x11, 0x01, 0x1F, 0x0A, 0x1A, 0x00,
+	// @40750 0xF8 (64 pixels wide)
+	0x26, 0x00, 0x2D, 0x03, 0x00, 0x0A, 0x12, 0x09, 0x12, 0x09, 0x07, 0x01, 0x00, 0x40, 0x1B, 0x00,
+	// @40766 0xF9 (70 pixels wide)
+	0x26, 0x00, 0x2D, 0x03, 0x00, 0x0A, 0x12, 0x09, 0x12, 0x09, 0x07, 0x01, 0x00, 0x46, 0x02, 0x01,
+	0x3E, 0x08, 0x0E, 0x01, 0x3E, 0x07, 0x0B, 0x00,
+	// @40790 0xFA (56 pixels wide)
+	0x26, 0x00, 0x08, 0x01, 0x00, 0x18, 0x09, 0x01, 0x0F, 0x09, 0x01, 0x02, 0x0F, 0x09, 0x01, 0x0E,
+	0x01, 0x01, 0x0F, 0x1C, 0x01, 0x01, 0x0F, 0x1F, 0x01, 0x01, 0x0F, 0x21, 0x01, 0x01, 0x0F, 0x23,
+	0x01, 0x01, 0x0F, 0x24, 0x01, 0x01, 0x0F, 0x25, 0x01, 0x02, 0x0F, 0x09, 0x0D, 0x10, 0x01, 0x02,
+	0x0F, 0x09, 0x10, 0x0E, 0x01, 0x02, 0x0F, 0x09, 0x12, 0x0C, 0x01, 0x02, 0x0F, 0x09, 0x14, 0x0B,
+	0x02, 0x02, 0x0F, 0x09, 0x15, 0x0A, 0x03, 0x02, 0x0F, 0x09, 0x16, 0x0A, 0x04, 0x02, 0x0F, 0x09,
+	0x17, 0x09, 0x02, 0x02, 0x0F, 0x09, 0x16, 0x0A, 0x01, 0x02, 0x0F, 0x09, 0x16, 0x09, 0x01, 0x02,
+	0x0F, 0x09, 0x15, 0x0A, 0x01, 0x02, 0x0F, 0x09, 0x14, 0x0B, 0x01, 0x02, 0x0F, 0x09, 0x13, 0x0B,
+	0x01, 0x02, 0x0F, 0x09, 0x12, 0x0C, 0x01, 0x02, 0x0F, 0x09, 0x10, 0x0D, 0x01, 0x02, 0x0F, 0x0A,
+	0x0A, 0x11, 0x01, 0x01, 0x0F, 0x24, 0x01, 0x01, 0x0F, 0x23, 0x01, 0x01, 0x0F, 0x21, 0x01, 0x01,
+	0x0F, 0x1F, 0x01, 0x01, 0x0F, 0x1D, 0x01, 0x01, 0x0F, 0x19, 0x01, 0x01, 0x1B, 0x02, 0x1A, 0x00,
+	// @40950 0xFB (56 pixels wide)
+	0x26, 0x00, 0x11, 0x02, 0x00, 0x09, 0x25, 0x0A, 0x01, 0x03, 0x00, 0x09, 0x02, 0x0C, 0x17, 0x0A,
+	0x01, 0x02, 0x00, 0x1B, 0x13, 0x0A, 0x01, 0x02, 0x00, 0x1E, 0x10, 0x0A, 0x01, 0x02, 0x00, 0x20,
+	0x0E, 0x0A, 0x01, 0x02, 0x00, 0x21, 0x0D, 0x0A, 0x01, 0x02, 0x00, 0x23, 0x0B, 0x0A, 0x01, 0x02,
+	0x00, 0x24, 0x0A, 0x0A, 0x01, 0x03, 0x00, 0x09, 0x0D, 0x0F, 0x09, 0x0A, 0x01, 0x03, 0x00, 0x09,
+	0x0F, 0x0D, 0x09, 0x0A, 0x01, 0x03, 0x00, 0x09, 0x11, 0x0C, 0x08, 0x0A, 0x01, 0x03, 0x00, 0x09,
+	0x12, 0x0B, 0x08, 0x0A, 0x01, 0x03, 0x00, 0x09, 0x13, 0x0B, 0x07, 0x0A, 0x01, 0x03, 0x00, 0x09,
+	0x14, 0x0A, 0x07, 0x0A, 0x02, 0x03, 0x00, 0x09, 0x15, 0x09, 0x07, 0x0A, 0x05, 0x03, 0x00, 0x09,
+	0x15, 0x0A, 0x06, 0x0A, 0x02, 0x03, 0x00, 0x09, 0x15, 0x09, 0x07, 0x0A, 0x02, 0x03, 0x00, 0x09,
+	0x14, 0x0A, 0x07, 0x0A, 0x01, 0x03, 0x00, 0x09, 0x13, 0x0A, 0x08, 0x0A, 0x01, 0x03, 0x00, 0x09,
+	0x12, 0x0B, 0x08, 0x0A, 0x01, 0x03, 0x00, 0x09, 0x10, 0x0C, 0x09, 0x0A, 0x01, 0x03, 0x00, 0x09,
+	0x0E, 0x0D, 0x0A, 0x0A, 0x01, 0x03, 0x00, 0x0A, 0x09, 0x10, 0x0B, 0x0A, 0x01, 0x02, 0x00, 0x22,
+	0x0C, 0x0A, 0x01, 0x02, 0x00, 0x21, 0x0D, 0x0A, 0x01, 0x02, 0x00, 0x20, 0x0E, 0x0A, 0x01, 0x02,
+	0x00, 0x1E, 0x10, 0x0A, 0x01, 0x02, 0x00, 0x1B, 0x13, 0x0A, 0x01, 0x02, 0x00, 0x18, 0x16, 0x0A,
+	0x01, 0x01, 0x0C, 0x03, 0x1A, 0x00,
+	// @41164 0xFC (41 pixels wide)
+	0x26, 0x00, 0x11, 0x01, 0x00, 0x09, 0x01, 0x02, 0x00, 0x09, 0x01, 0x0E, 0x01, 0x01, 0x00, 0x1D,
+	0x01, 0x01, 0x00, 0x1F, 0x01, 0x01, 0x00, 0x21, 0x01, 0x01, 0x00, 0x23, 0x01, 0x01, 0x00, 0x24,
+	0x01, 0x01, 0x00, 0x25, 0x01, 0x02, 0x00, 0x09, 0x0D, 0x10, 0x01, 0x02, 0x00, 0x09, 0x10, 0x0E,
+	0x01, 0x02, 0x00, 0x09, 0x12, 0x0D, 0x01, 0x02, 0x00, 0x09, 0x14, 0x0B, 0x01, 0x02, 0x00, 0x09,
+	0x15, 0x0A, 0x02, 0x02, 0x00, 0x09, 0x16, 0x0A, 0x07, 0x02, 0x00, 0x09, 0x17, 0x09, 0x02, 0x02,
+	0x00, 0x09, 0x16, 0x0A, 0x01, 0x02, 0x00, 0x09, 0x15, 0x0A, 0x01, 0x02, 0x00, 0x09, 0x14, 0x0B,
+	0x01, 0x02, 0x00, 0x09, 0x13, 0x0B, 0x01, 0x02, 0x00, 0x09, 0x12, 0x0C, 0x01, 0x02, 0x00, 0x09,
+	0x0F, 0x0E, 0x01, 0x02, 0x00, 0x0A, 0x0A, 0x11, 0x01, 0x01, 0x00, 0x24, 0x01, 0x01, 0x00, 0x23,
+	0x01, 0x01, 0x00, 0x21, 0x01, 0x01, 0x00, 0x1F, 0x01, 0x01, 0x00, 0x1D, 0x01, 0x01, 0x00, 0x19,
+	0x01, 0x01, 0x0C, 0x03, 0x1A, 0x00,
+	// @41314 0xFD (43 pixels wide)
+	0x25, 0x00, 0x01, 0x01, 0x0B, 0x0C, 0x01, 0x01, 0x07, 0x13, 0x01, 0x01, 0x04, 0x19, 0x01, 0x01,
+	0x02, 0x1D, 0x01, 0x01, 0x01, 0x1F, 0x01, 0x01, 0x01, 0x20, 0x01, 0x01, 0x02, 0x21, 0x01, 0x02,
+	0x02, 0x0A, 0x06, 0x12, 0x01, 0x02, 0x02, 0x05, 0x0F, 0x0E, 0x01, 0x02, 0x03, 0x01, 0x15, 0x0C,
+	0x01, 0x01, 0x1A, 0x0C, 0x01, 0x01, 0x1C, 0x0B, 0x01, 0x01, 0x1D, 0x0A, 0x01, 0x01, 0x1D, 0x0B,
+	0x01, 0x01, 0x1E, 0x0A, 0x02, 0x01, 0x1F, 0x0A, 0x01, 0x01, 0x20, 0x09, 0x02, 0x01, 0x20, 0x0A,
+	0x03, 0x01, 0x21, 0x09, 0x02, 0x01, 0x07, 0x23, 0x04, 0x01, 0x07, 0x24, 0x01, 0x01, 0x07, 0x23,
+	0x03, 0x01, 0x21, 0x09, 0x03, 0x01, 0x20, 0x0A, 0x02, 0x01, 0x1F, 0x0A, 0x01, 0x01, 0x1E, 0x0B,
+	0x01, 0x01, 0x1E, 0x0A, 0x01, 0x01, 0x1D, 0x0B, 0x01, 0x01, 0x1C, 0x0B, 0x01, 0x01, 0x1B, 0x0B,
+	0x01, 0x01, 0x1A, 0x0C, 0x01, 0x02, 0x02, 0x01, 0x15, 0x0D, 0x01, 0x02, 0x01, 0x05, 0x10, 0x0E,
+	0x01, 0x02, 0x01, 0x0A, 0x07, 0x11, 0x01, 0x01, 0x01, 0x21, 0x01, 0x01, 0x01, 0x20, 0x01, 0x01,
+	0x00, 0x20, 0x01, 0x01, 0x00, 0x1E, 0x01, 0x01, 0x02, 0x1A, 0x01, 0x01, 0x04, 0x16, 0x01, 0x01,
+	0x08, 0x0E, 0x1A, 0x00,
+	// @41494 0xFE (63 pixels wide)
+	0x25, 0x00, 0x01, 0x01, 0x24, 0x0A, 0x01, 0x02, 0x00, 0x09, 0x17, 0x11, 0x01, 0x02, 0x00, 0x09,
+	0x15, 0x15, 0x01, 0x02, 0x00, 0x09, 0x14, 0x18, 0x01, 0x02, 0x00, 0x09, 0x12, 0x1B, 0x01, 0x02,
+	0x00, 0x09, 0x11, 0x1D, 0x01, 0x02, 0x00, 0x09, 0x10, 0x1F, 0x01, 0x03, 0x00, 0x09, 0x0F, 0x0D,
+	0x07, 0x0D, 0x01, 0x03, 0x00, 0x09, 0x0E, 0x0C, 0x0B, 0x0C, 0x01, 0x03, 0x00, 0x09, 0x0D, 0x0B,
+	0x0E, 0x0C, 0x01, 0x03, 0x00, 0x09, 0x0D, 0x0A, 0x10, 0x0B, 0x01, 0x03, 0x00, 0x09, 0x0C, 0x0A,
+	0x12, 0x0B, 0x01, 0x03, 0x00, 0x09, 0x0C, 0x0A, 0x13, 0x0A, 0x01, 0x03, 0x00, 0x09, 0x0B, 0x0A,
+	0x15, 0x0A, 0x01, 0x03, 0x00, 0x09, 0x0B, 0x09, 0x16, 0x0A, 0x01, 0x03, 0x00, 0x09, 0x0A, 0x0A,
+	0x17, 0x0A, 0x01, 0x03, 0x00, 0x09, 0x0A, 0x09, 0x18, 0x0A, 0x01, 0x03, 0x00, 0x09, 0x0A, 0x09,
+	0x19, 0x09, 0x01, 0x03, 0x00, 0x09, 0x0A, 0x09, 0x19, 0x0A, 0x02, 0x03, 0x00, 0x09, 0x09, 0x09,
+	0x1A, 0x0A, 0x02, 0x03, 0x00, 0x09, 0x09, 0x09, 0x1B, 0x09, 0x02, 0x02, 0x00, 0x1B, 0x1B, 0x09,
+	0x05, 0x02, 0x00, 0x1A, 0x1C, 0x09, 0x01, 0x03, 0x00, 0x09, 0x08, 0x0A, 0x1B, 0x09, 0x02, 0x03,
+	0x00, 0x09, 0x09, 0x09, 0x1B, 0x09, 0x02, 0x03, 0x00, 0x09, 0x09, 0x09, 0x1A, 0x0A, 0x01, 0x03,
+	0x00, 0x09, 0x09, 0x09, 0x1A, 0x09, 0x01, 0x03, 0x00, 0x09, 0x09, 0x0A, 0x19, 0x09, 0x01, 0x03,
+	0x00, 0x09, 0x0A, 0x09, 0x18, 0x0A, 0x01, 0x03, 0x00, 0x09, 0x0A, 0x0A, 0x17, 0x09, 0x01, 0x03,
+	0x00, 0x09, 0x0A, 0x0A, 0x16, 0x0A, 0x01, 0x03, 0x00, 0x09, 0x0B, 0x0A, 0x15, 0x0A, 0x01, 0x03,
+	0x00, 0x09, 0x0B, 0x0A, 0x14, 0x0A, 0x01, 0x03, 0x00, 0x09, 0x0C, 0x0A, 0x12, 0x0B, 0x01, 0x03,
+	0x00, 0x09, 0x0C, 0x0B, 0x11, 0x0A, 0x01, 0x03, 0x00, 0x09, 0x0D, 0x0B, 0x0F, 0x0A, 0x01, 0x03,
+	0x00, 0x09, 0x0E, 0x0B, 0x0C, 0x0C, 0x01, 0x03, 0x00, 0x09, 0x0E, 0x0D, 0x08, 0x0D, 0x01, 0x02,
+	0x00, 0x09, 0x0F, 0x20, 0x01, 0x02, 0x00, 0x09, 0x10, 0x1E, 0x01, 0x02, 0x00, 0x09, 0x11, 0x1C,
+	0x01, 0x02, 0x00, 0x09, 0x13, 0x18, 0x01, 0x02, 0x00, 0x09, 0x14, 0x16, 0x01, 0x02, 0x00, 0x09,
+	0x16, 0x12, 0x01, 0x01, 0x22, 0x0C, 0x1A, 0x00,
+	// @41822 0xFF (48 pixels wide)
+	0x23, 0x00, 0x01, 0x01, 0x10, 0x20, 0x01, 0x01, 0x0C, 0x24, 0x01, 0x01, 0x0A, 0x26, 0x01, 0x01,
+	0x08, 0x28, 0x01, 0x01, 0x07, 0x29, 0x01, 0x01, 0x06, 0x2A, 0x01, 0x01, 0x05, 0x2B, 0x01, 0x01,
+	0x04, 0x2C, 0x01, 0x02, 0x04, 0x0E, 0x14, 0x0A, 0x01, 0x02, 0x03, 0x0D, 0x16, 0x0A, 0x01, 0x02,
+	0x03, 0x0B, 0x18, 0x0A, 0x02, 0x02, 0x02, 0x0B, 0x19, 0x0A, 0x07, 0x02, 0x02, 0x0A, 0x1A, 0x0A,
+	0x02, 0x02, 0x02, 0x0B, 0x19, 0x0A, 0x01, 0x02, 0x03, 0x0B, 0x18, 0x0A, 0x01, 0x02, 0x03, 0x0C,
+	0x17, 0x0A, 0x01, 0x02, 0x04, 0x0D, 0x15, 0x0A, 0x01, 0x02, 0x04, 0x10, 0x12, 0x0A, 0x01, 0x01,
+	0x05, 0x2B, 0x01, 0x01, 0x06, 0x2A, 0x01, 0x01, 0x07, 0x29, 0x01, 0x01, 0x08, 0x28, 0x01, 0x01,
+	0x0A, 0x26, 0x01, 0x01, 0x0C, 0x24, 0x01, 0x01, 0x10, 0x20, 0x01, 0x01, 0x0F, 0x21, 0x01, 0x02,
+	0x0D, 0x0D, 0x0C, 0x0A, 0x01, 0x02, 0x0C, 0x0B, 0x0F, 0x0A, 0x01, 0x02, 0x0B, 0x0B, 0x10, 0x0A,
+	0x01, 0x02, 0x0A, 0x0B, 0x11, 0x0A, 0x01, 0x02, 0x09, 0x0B, 0x12, 0x0A, 0x02, 0x02, 0x08, 0x0B,
+	0x13, 0x0A, 0x02, 0x02, 0x07, 0x0B, 0x14, 0x0A, 0x02, 0x02, 0x06, 0x0B, 0x15, 0x0A, 0x02, 0x02,
+	0x05, 0x0B, 0x16, 0x0A, 0x01, 0x02, 0x04, 0x0B, 0x17, 0x0A, 0x02, 0x02, 0x03, 0x0B, 0x18, 0x0A,
+	0x02, 0x02, 0x02, 0x0B, 0x19, 0x0A, 0x02, 0x02, 0x01, 0x0B, 0x1A, 0x0A, 0x01, 0x02, 0x00, 0x0B,
+	0x1B, 0x0A, 0x1B, 0x00,
+};
+
+const struct FONT_CHAR_INFO RIAD_80ptRLEDescriptors[] = 
+{
+	{2, 0}, 		// 0x20
+	{13, 2}, 		// 0x21
+	{26, 64}, 		// 0x22
+	{45, 110}, 		// 0x23
+	{40, 302}, 		// 0x24
+	{78, 536}, 		// 0x25
+	{61, 1060}, 		// 0x26
+	{10, 1492}, 		// 0x27
+	{21, 1516}, 		// 0x28
+	{21, 1704}, 		// 0x29
+	{38, 1868}, 		// 0x2A
+	{56, 2078}, 		// 0x2B
+	{16, 2094}, 		// 0x2C
+	{27, 2170}, 		// 0x2D
+	{12, 2178}, 		// 0x2E
+	{37, 2210}, 		// 0x2F
+	{47, 2422}, 		// 0x30
+	{23, 2678}, 		// 0x31
+	{44, 2752}, 		// 0x32
+	{43, 2980}, 		// 0x33
+	{51, 3220}, 		// 0x34
+	{43, 3444}, 		// 0x35
+	{47, 3630}, 		// 0x36
+	{44, 3942}, 		// 0x37
+	{47, 4138}, 		// 0x38
+	{47, 4430}, 		// 0x39
+	{12, 4742}, 		// 0x3A
+	{11, 4800}, 		// 0x3B
+	{50, 4846}, 		// 0x3C
+	{56, 5078}, 		// 0x3D
+	{50, 5092}, 		// 0x3E
+	{33, 5324}, 		// 0x3F
+	{70, 5500}, 		// 0x40
+	{60, 6034}, 		// 0x41
+	{46, 6336}, 		// 0x42
+	{54, 6636}, 		// 0x43
+	{59, 6854}, 		// 0x44
+	{41, 7138}, 		// 0x45
+	{39, 7162}, 		// 0x46
+	{59, 7182}, 		// 0x47
+	{54, 7440}, 		// 0x48
+	{9, 7460}, 		// 0x49
+	{32, 7468}, 		// 0x4A
+	{51, 7542}, 		// 0x4B
+	{40, 7932}, 		// 0x4C
+	{74, 7944}, 		// 0x4D
+	{54, 8488}, 		// 0x4E
+	{66, 8908}, 		// 0x4F
+	{45, 9232}, 		// 0x50
+	{66, 9420}, 		// 0x51
+	{47, 9774}, 		// 0x52
+	{43, 10066}, 		// 0x53
+	{53, 10324}, 		// 0x54
+	{53, 10336}, 		// 0x55
+	{59, 10470}, 		// 0x56
+	{87, 10772}, 		// 0x57
+	{55, 11382}, 		// 0x58
+	{55, 11772}, 		// 0x59
+	{53, 11994}, 		// 0x5A
+	{19, 12242}, 		// 0x5B
+	{35, 12258}, 		// 0x5C
+	{20, 12454}, 		// 0x5D
+	{50, 12470}, 		// 0x5E
+	{54, 12702}, 		// 0x5F
+	{19, 12710}, 		// 0x60
+	{41, 12770}, 		// 0x61
+	{50, 13002}, 		// 0x62
+	{41, 13244}, 		// 0x63
+	{49, 13408}, 		// 0x64
+	{46, 13646}, 		// 0x65
+	{33, 13844}, 		// 0x66
+	{49, 13918}, 		// 0x67
+	{44, 14222}, 		// 0x68
+	{11, 14340}, 		// 0x69
+	{24, 14374}, 		// 0x6A
+	{43, 14476}, 		// 0x6B
+	{9, 14772}, 		// 0x6C
+	{75, 14780}, 		// 0x6D
+	{45, 14956}, 		// 0x6E
+	{51, 15070}, 		// 0x6F
+	{50, 15298}, 		// 0x70
+	{49, 15544}, 		// 0x71
+	{26, 15782}, 		// 0x72
+	{34, 15872}, 		// 0x73
+	{31, 16058}, 		// 0x74
+	{45, 16126}, 		// 0x75
+	{48, 16238}, 		// 0x76
+	{75, 16470}, 		// 0x77
+	{47, 16868}, 		// 0x78
+	{49, 17158}, 		// 0x79
+	{42, 17488}, 		// 0x7A
+	{25, 17656}, 		// 0x7B
+	{7, 17840}, 		// 0x7C
+	{24, 17846}, 		// 0x7D
+	{54, 18018}, 		// 0x7E
+	{2, 18126}, 		// 0x7F
+	{2, 18128}, 		// 0x80
+	{2, 18130}, 		// 0x81
+	{16, 18132}, 		// 0x82
+	{52, 18218}, 		// 0x83
+	{36, 18452}, 		// 0x84
+	{2, 18616}, 		// 0x85
+	{42, 18618}, 		// 0x86
+	{42, 18818}, 		// 0x87
+	{33, 19138}, 		// 0x88
+	{87, 19192}, 		// 0x89
+	{48, 20032}, 		// 0x8A
+	{23, 20502}, 		// 0x8B
+	{105, 20694}, 		// 0x8C
+	{2, 21148}, 		// 0x8D
+	{2, 21150}, 		// 0x8E
+	{2, 21152}, 		// 0x8F
+	{2, 21154}, 		// 0x90
+	{14, 21156}, 		// 0x91
+	{14, 21242}, 		// 0x92
+	{40, 21330}, 		// 0x93
+	{40, 21488}, 		// 0x94
+	{2, 21630}, 		// 0x95
+	{36, 21632}, 		// 0x96
+	{104, 21640}, 		// 0x97
+	{32, 21648}, 		// 0x98
+	{101, 21718}, 		// 0x99
+	{34, 22234}, 		// 0x9A
+	{23, 22532}, 		// 0x9B
+	{63, 22724}, 		// 0x9C
+	{2, 23100}, 		// 0x9D
+	{2, 23102}, 		// 0x9E
+	{74, 23104}, 		// 0x9F
+	{2, 23414}, 		// 0xA0
+	{13, 23416}, 		// 0xA1
+	{40, 23478}, 		// 0xA2
+	{44, 23656}, 		// 0xA3
+	{49, 23804}, 		// 0xA4
+	{51, 24066}, 		// 0xA5
+	{7, 24276}, 		// 0xA6
+	{43, 24290}, 		// 0xA7
+	{30, 24628}, 		// 0xA8
+	{65, 24674}, 		// 0xA9
+	{28, 25088}, 		// 0xAA
+	{39, 25234}, 		// 0xAB
+	{56, 25478}, 		// 0xAC
+	{2, 25490}, 		// 0xAD
+	{36, 25492}, 		// 0xAE
+	{24, 25746}, 		// 0xAF
+	{28, 25754}, 		// 0xB0
+	{56, 25876}, 		// 0xB1
+	{29, 25898}, 		// 0xB2
+	{29, 26040}, 		// 0xB3
+	{19, 26190}, 		// 0xB4
+	{48, 26254}, 		// 0xB5
+	{42, 26388}, 		// 0xB6
+	{12, 26530}, 		// 0xB7
+	{18, 26570}, 		// 0xB8
+	{17, 26648}, 		// 0xB9
+	{34, 26698}, 		// 0xBA
+	{38, 26856}, 		// 0xBB
+	{72, 27094}, 		// 0xBC
+	{73, 27514}, 		// 0xBD
+	{76, 27904}, 		// 0xBE
+	{33, 28368}, 		// 0xBF
+	{60, 28554}, 		// 0xC0
+	{46, 28856}, 		// 0xC1
+	{46, 29042}, 		// 0xC2
+	{38, 29342}, 		// 0xC3
+	{63, 29354}, 		// 0xC4
+	{41, 29508}, 		// 0xC5
+	{83, 29532}, 		// 0xC6
+	{45, 30068}, 		// 0xC7
+	{54, 30314}, 		// 0xC8
+	{54, 30748}, 		// 0xC9
+	{49, 31240}, 		// 0xCA
+	{57, 31572}, 		// 0xCB
+	{74, 31704}, 		// 0xCC
+	{54, 32248}, 		// 0xCD
+	{66, 32268}, 		// 0xCE
+	{52, 32592}, 		// 0xCF
+	{45, 32606}, 		// 0xD0
+	{54, 32794}, 		// 0xD1
+	{53, 33012}, 		// 0xD2
+	{55, 33024}, 		// 0xD3
+	{70, 33350}, 		// 0xD4
+	{55, 33726}, 		// 0xD5
+	{58, 34116}, 		// 0xD6
+	{49, 34138}, 		// 0xD7
+	{75, 34242}, 		// 0xD8
+	{81, 34258}, 		// 0xD9
+	{63, 34290}, 		// 0xDA
+	{63, 34488}, 		// 0xDB
+	{46, 34754}, 		// 0xDC
+	{54, 34942}, 		// 0xDD
+	{81, 35168}, 		// 0xDE
+	{48, 35610}, 		// 0xDF
+	{41, 35896}, 		// 0xE0
+	{48, 36128}, 		// 0xE1
+	{42, 36470}, 		// 0xE2
+	{32, 36688}, 		// 0xE3
+	{52, 36700}, 		// 0xE4
+	{46, 36802}, 		// 0xE5
+	{69, 37000}, 		// 0xE6
+	{39, 37388}, 		// 0xE7
+	{45, 37588}, 		// 0xE8
+	{45, 37886}, 		// 0xE9
+	{42, 38248}, 		// 0xEA
+	{47, 38516}, 		// 0xEB
+	{59, 38624}, 		// 0xEC
+	{44, 39022}, 		// 0xED
+	{51, 39042}, 		// 0xEE
+	{43, 39270}, 		// 0xEF
+	{50, 39284}, 		// 0xF0
+	{41, 39530}, 		// 0xF1
+	{42, 39694}, 		// 0xF2
+	{49, 39706}, 		// 0xF3
+	{61, 40036}, 		// 0xF4
+	{47, 40352}, 		// 0xF5
+	{48, 40642}, 		// 0xF6
+	{41, 40664}, 		// 0xF7
+	{64, 40750}, 		// 0xF8
+	{70, 40766}, 		// 0xF9
+	{56, 40790}, 		// 0xFA
+	{56, 40950}, 		// 0xFB
+	{41, 41164}, 		// 0xFC
+	{43, 41314}, 		// 0xFD
+	{63, 41494}, 		// 0xFE
+	{48, 41822}, 		// 0xFF
+};
+
+sFONT RIAD_80pt = {
+  0,
+  RIAD_80ptRLEDescriptors,
+  117, /* Height */
+  RIAD_80ptRLE,
+};
+#endif
@@ -0,0 +1,237 @@
+// 
+//  RIAD_80pt, 14 signs of RIAD_80pt.c run coded, made by Tools/font_subset.py, don't edit
+// 
+#include "variables.h"
+#include "fonts.h"
+
+#if RIAD_80pt_FROM == FONT_SUBSET
+static const uint8_t Signs[] = 
+{
+	// @0 0x20 (2 pixels wide)
+	0x75, 0x00,
+	// @2 0x2D (27 pixels wide)
+	0x3A, 0x00, 0x07, 0x01, 0x00, 0x1B, 0x34, 0x00,
+	// @10 0x2E (12 pixels wide)
+	0x4E, 0x00, 0x01, 0x01, 0x03, 0x06, 0x01, 0x01, 0x01, 0x09, 0x01, 0x01, 0x01, 0x0A, 0x07, 0x01,
+	0x00, 0x0C, 0x01, 0x01, 0x01, 0x0A, 0x01, 0x01, 0x02, 0x08, 0x01, 0x01, 0x03, 0x06, 0x1A, 0x00,
+	// @42 0x30 (47 pixels wide)
+	0x13, 0x00, 0x01, 0x01, 0x15, 0x07, 0x01, 0x01, 0x11, 0x0E, 0x01, 0x01, 0x0E, 0x14, 0x01, 0x01,
+	0x0D, 0x16, 0x01, 0x01, 0x0B, 0x1A, 0x01, 0x01, 0x0A, 0x1C, 0x01, 0x01, 0x09, 0x1E, 0x01, 0x01,
+	0x08, 0x20, 0x01, 0x02, 0x07, 0x0C, 0x09, 0x0C, 0x01, 0x02, 0x07, 0x0B, 0x0C, 0x0B, 0x01, 0x02,
+	0x06, 0x0B, 0x0E, 0x0B, 0x01, 0x02, 0x05, 0x0B, 0x10, 0x0A, 0x01, 0x02, 0x05, 0x0A, 0x12, 0x0A,
+	0x01, 0x02, 0x04, 0x0A, 0x13, 0x0A, 0x01, 0x02, 0x04, 0x0A, 0x14, 0x0A, 0x01, 0x02, 0x03, 0x0A,
+	0x15, 0x0A, 0x01, 0x02, 0x03, 0x0A, 0x16, 0x09, 0x01, 0x02, 0x03, 0x09, 0x17, 0x0A, 0x02, 0x02,
+	0x02, 0x0A, 0x18, 0x09, 0x01, 0x02, 0x02, 0x09, 0x19, 0x0A, 0x01, 0x02, 0x01, 0x0A, 0x19, 0x0A,
+	0x01, 0x02, 0x01, 0x0A, 0x1A, 0x09, 0x02, 0x02, 0x01, 0x09, 0x1B, 0x09, 0x02, 0x02, 0x01, 0x09,
+	0x1B, 0x0A, 0x04, 0x02, 0x00, 0x0A, 0x1B, 0x0A, 0x0A, 0x02, 0x00, 0x09, 0x1D, 0x09, 0x05, 0x02,
+	0x00, 0x0A, 0x1B, 0x0A, 0x03, 0x02, 0x01, 0x09, 0x1B, 0x09, 0x02, 0x02, 0x01, 0x0A, 0x19, 0x0A,
+	0x02, 0x02, 0x02, 0x09, 0x19, 0x09, 0x02, 0x02, 0x02, 0x0A, 0x17, 0x0A, 0x01, 0x02, 0x03, 0x09,
+	0x17, 0x09, 0x01, 0x02, 0x03, 0x0A, 0x15, 0x0A, 0x01, 0x02, 0x04, 0x09, 0x15, 0x0A, 0x02, 0x02,
+	0x04, 0x0A, 0x13, 0x0A, 0x01, 0x02, 0x05, 0x0A, 0x11, 0x0A, 0x01, 0x02, 0x05, 0x0B, 0x0F, 0x0B,
+	0x01, 0x02, 0x06, 0x0B, 0x0D, 0x0B, 0x01, 0x02, 0x07, 0x0B, 0x0B, 0x0B, 0x01, 0x02, 0x08, 0x0D,
+	0x05, 0x0E, 0x01, 0x01, 0x08, 0x1F, 0x01, 0x01, 0x09, 0x1D, 0x01, 0x01, 0x0A, 0x1B, 0x01, 0x01,
+	0x0B, 0x18, 0x01, 0x01, 0x0D, 0x15, 0x01, 0x01, 0x0F, 0x11, 0x01, 0x01, 0x11, 0x0C, 0x1A, 0x00,
+	// @298 0x31 (23 pixels wide)
+	0x14, 0x00, 0x01, 0x01, 0x0F, 0x08, 0x01, 0x01, 0x0D, 0x0A, 0x01, 0x01, 0x0B, 0x0C, 0x01, 0x01,
+	0x0A, 0x0D, 0x01, 0x01, 0x08, 0x0F, 0x01, 0x01, 0x06, 0x11, 0x01, 0x01, 0x04, 0x13, 0x01, 0x01,
+	0x02, 0x15, 0x02, 0x01, 0x00, 0x17, 0x01, 0x02, 0x01, 0x0B, 0x02, 0x09, 0x01, 0x02, 0x01, 0x09,
+	0x04, 0x09, 0x01, 0x02, 0x01, 0x07, 0x06, 0x09, 0x01, 0x02, 0x01, 0x05, 0x08, 0x09, 0x01, 0x02,
+	0x02, 0x02, 0x0A, 0x09, 0x37, 0x01, 0x0E, 0x09, 0x1B, 0x00,
+	// @372 0x32 (44 pixels wide)
+	0x13, 0x00, 0x01, 0x01, 0x11, 0x08, 0x01, 0x01, 0x0C, 0x12, 0x01, 0x01, 0x09, 0x17, 0x01, 0x01,
+	0x07, 0x1B, 0x01, 0x01, 0x06, 0x1D, 0x01, 0x01, 0x04, 0x20, 0x01, 0x01, 0x03, 0x22, 0x01, 0x01,
+	0x02, 0x24, 0x01, 0x02, 0x02, 0x0D, 0x09, 0x0F, 0x01, 0x02, 0x03, 0x09, 0x0F, 0x0D, 0x01, 0x02,
+	0x03, 0x07, 0x13, 0x0B, 0x01, 0x02, 0x04, 0x04, 0x16, 0x0B, 0x01, 0x02, 0x04, 0x03, 0x18, 0x0A,
+	0x01, 0x02, 0x04, 0x01, 0x1A, 0x0A, 0x03, 0x01, 0x20, 0x0A, 0x09, 0x01, 0x21, 0x09, 0x02, 0x01,
+	0x20, 0x0A, 0x01, 0x01, 0x20, 0x09, 0x01, 0x01, 0x1F, 0x0A, 0x02, 0x01, 0x1F, 0x09, 0x01, 0x01,
+	0x1E, 0x0A, 0x02, 0x01, 0x1D, 0x0A, 0x01, 0x01, 0x1C, 0x0A, 0x01, 0x01, 0x1C, 0x09, 0x01, 0x01,
+	0x1B, 0x0A, 0x01, 0x01, 0x1A, 0x0A, 0x01, 0x01, 0x19, 0x0A, 0x01, 0x01, 0x18, 0x0B, 0x01, 0x01,
+	0x17, 0x0B, 0x01, 0x01, 0x17, 0x0A, 0x01, 0x01, 0x16, 0x0A, 0x01, 0x01, 0x15, 0x0A, 0x01, 0x01,
+	0x14, 0x0B, 0x01, 0x01, 0x13, 0x0B, 0x01, 0x01, 0x12, 0x0B, 0x01, 0x01, 0x11, 0x0B, 0x01, 0x01,
+	0x10, 0x0B, 0x01, 0x01, 0x0F, 0x0B, 0x01, 0x01, 0x0E, 0x0B, 0x01, 0x01, 0x0D, 0x0B, 0x01, 0x01,
+	0x0C, 0x0B, 0x01, 0x01, 0x0B, 0x0B, 0x01, 0x01, 0x0A, 0x0B, 0x01, 0x01, 0x09, 0x0B, 0x01, 0x01,
+	0x08, 0x0B, 0x01, 0x01, 0x07, 0x0B, 0x01, 0x01, 0x06, 0x0B, 0x01, 0x01, 0x05, 0x0B, 0x01, 0x01,
+	0x04, 0x0B, 0x01, 0x01, 0x03, 0x0B, 0x01, 0x01, 0x02, 0x2A, 0x01, 0x01, 0x01, 0x2B, 0x06, 0x01,
+	0x00, 0x2C, 0x1B, 0x00,
+	// @600 0x33 (43 pixels wide)
+	0x13, 0x00, 0x01, 0x01, 0x10, 0x08, 0x01, 0x01, 0x0B, 0x12, 0x01, 0x01, 0x08, 0x17, 0x01, 0x01,
+	0x06, 0x1B, 0x01, 0x01, 0x04, 0x1E, 0x01, 0x01, 0x02, 0x22, 0x01, 0x01, 0x02, 0x23, 0x01, 0x01,
+	0x03, 0x22, 0x01, 0x02, 0x03, 0x0A, 0x0A, 0x0F, 0x01, 0x02, 0x03, 0x07, 0x10, 0x0D, 0x01, 0x02,
+	0x04, 0x04, 0x13, 0x0C, 0x01, 0x02, 0x04, 0x02, 0x16, 0x0B, 0x01, 0x01, 0x1D, 0x0B, 0x03, 0x01,
+	0x1E, 0x0A, 0x05, 0x01, 0x1F, 0x09, 0x01, 0x01, 0x1E, 0x0A, 0x01, 0x01, 0x1E, 0x09, 0x02, 0x01,
+	0x1D, 0x0A, 0x01, 0x01, 0x1C, 0x0A, 0x01, 0x01, 0x1B, 0x0A, 0x01, 0x01, 0x19, 0x0C, 0x01, 0x01,
+	0x17, 0x0D, 0x01, 0x01, 0x15, 0x0D, 0x01, 0x01, 0x0A, 0x17, 0x01, 0x01, 0x0A, 0x15, 0x01, 0x01,
+	0x0A, 0x14, 0x01, 0x01, 0x0A, 0x11, 0x01, 0x01, 0x0A, 0x15, 0x01, 0x01, 0x0A, 0x17, 0x01, 0x01,
+	0x0A, 0x19, 0x01, 0x01, 0x13, 0x11, 0x01, 0x01, 0x18, 0x0D, 0x01, 0x01, 0x1A, 0x0C, 0x01, 0x01,
+	0x1C, 0x0B, 0x01, 0x01, 0x1D, 0x0B, 0x01, 0x01, 0x1E, 0x0B, 0x01, 0x01, 0x1F, 0x0A, 0x01, 0x01,
+	0x1F, 0x0B, 0x02, 0x01, 0x20, 0x0A, 0x09, 0x01, 0x21, 0x0A, 0x02, 0x01, 0x20, 0x0A, 0x01, 0x01,
+	0x1F, 0x0B, 0x01, 0x01, 0x1E, 0x0B, 0x01, 0x01, 0x1D, 0x0C, 0x01, 0x02, 0x02, 0x02, 0x18, 0x0C,
+	0x01, 0x02, 0x01, 0x06, 0x14, 0x0D, 0x01, 0x02, 0x01, 0x09, 0x0F, 0x0E, 0x01, 0x02, 0x01, 0x0E,
+	0x05, 0x12, 0x01, 0x01, 0x00, 0x25, 0x01, 0x01, 0x00, 0x24, 0x01, 0x01, 0x00, 0x23, 0x01, 0x01,
+	0x01, 0x20, 0x01, 0x01, 0x03, 0x1C, 0x01, 0x01, 0x06, 0x17, 0x01, 0x01, 0x0A, 0x0F, 0x1A, 0x00,
+	// @840 0x34 (51 pixels wide)
+	0x14, 0x00, 0x01, 0x01, 0x1F, 0x0A, 0x01, 0x01, 0x1E, 0x0B, 0x02, 0x01, 0x1D, 0x0C, 0x01, 0x01,
+	0x1C, 0x0D, 0x01, 0x01, 0x1B, 0x0E, 0x02, 0x01, 0x1A, 0x0F, 0x01, 0x01, 0x19, 0x10, 0x01, 0x01,
+	0x18, 0x11, 0x01, 0x02, 0x18, 0x07, 0x01, 0x09, 0x01, 0x02, 0x17, 0x08, 0x01, 0x09, 0x02, 0x02,
+	0x16, 0x08, 0x02, 0x09, 0x01, 0x02, 0x15, 0x08, 0x03, 0x09, 0x01, 0x02, 0x14, 0x09, 0x03, 0x09,
+	0x02, 0x02, 0x13, 0x09, 0x04, 0x09, 0x01, 0x02, 0x12, 0x09, 0x05, 0x09, 0x02, 0x02, 0x11, 0x09,
+	0x06, 0x09, 0x01, 0x02, 0x10, 0x09, 0x07, 0x09, 0x01, 0x02, 0x0F, 0x09, 0x08, 0x09, 0x01, 0x02,
+	0x0F, 0x08, 0x09, 0x09, 0x01, 0x02, 0x0E, 0x09, 0x09, 0x09, 0x01, 0x02, 0x0D, 0x09, 0x0A, 0x09,
+	0x02, 0x02, 0x0C, 0x09, 0x0B, 0x09, 0x01, 0x02, 0x0B, 0x09, 0x0C, 0x09, 0x01, 0x02, 0x0A, 0x09,
+	0x0D, 0x09, 0x01, 0x02, 0x0A, 0x08, 0x0E, 0x09, 0x01, 0x02, 0x09, 0x09, 0x0E, 0x09, 0x01, 0x02,
+	0x08, 0x09, 0x0F, 0x09, 0x01, 0x02, 0x08, 0x08, 0x10, 0x09, 0x01, 0x02, 0x07, 0x09, 0x10, 0x09,
+	0x01, 0x02, 0x06, 0x09, 0x11, 0x09, 0x01, 0x02, 0x05, 0x09, 0x12, 0x09, 0x01, 0x02, 0x05, 0x08,
+	0x13, 0x09, 0x01, 0x02, 0x04, 0x09, 0x13, 0x09, 0x01, 0x02, 0x03, 0x09, 0x14, 0x09, 0x01, 0x02,
+	0x03, 0x08, 0x15, 0x09, 0x01, 0x02, 0x02, 0x09, 0x15, 0x09, 0x01, 0x02, 0x01, 0x09, 0x16, 0x09,
+	0x01, 0x02, 0x01, 0x08, 0x17, 0x09, 0x07, 0x01, 0x00, 0x33, 0x13, 0x01, 0x20, 0x09, 0x1B, 0x00,
+	// @1064 0x35 (43 pixels wide)
+	0x14, 0x00, 0x05, 0x01, 0x08, 0x21, 0x03, 0x01, 0x07, 0x22, 0x02, 0x01, 0x07, 0x08, 0x02, 0x01,
+	0x07, 0x07, 0x05, 0x01, 0x06, 0x08, 0x02, 0x01, 0x06, 0x07, 0x05, 0x01, 0x05, 0x08, 0x02, 0x01,
+	0x05, 0x07, 0x01, 0x01, 0x05, 0x14, 0x01, 0x01, 0x04, 0x18, 0x01, 0x01, 0x04, 0x1B, 0x01, 0x01,
+	0x04, 0x1D, 0x01, 0x01, 0x04, 0x1E, 0x01, 0x01, 0x04, 0x20, 0x01, 0x01, 0x04, 0x21, 0x01, 0x02,
+	0x04, 0x02, 0x0D, 0x13, 0x01, 0x01, 0x17, 0x10, 0x01, 0x01, 0x1A, 0x0D, 0x01, 0x01, 0x1B, 0x0D,
+	0x01, 0x01, 0x1D, 0x0C, 0x02, 0x01, 0x1E, 0x0B, 0x01, 0x01, 0x1F, 0x0B, 0x02, 0x01, 0x20, 0x0A,
+	0x01, 0x01, 0x21, 0x09, 0x07, 0x01, 0x21, 0x0A, 0x02, 0x01, 0x21, 0x09, 0x02, 0x01, 0x20, 0x0A,
+	0x01, 0x01, 0x20, 0x09, 0x01, 0x01, 0x1F, 0x0A, 0x01, 0x01, 0x1E, 0x0B, 0x01, 0x01, 0x1D, 0x0B,
+	0x01, 0x01, 0x1C, 0x0B, 0x01, 0x02, 0x02, 0x01, 0x18, 0x0C, 0x01, 0x02, 0x01, 0x05, 0x13, 0x0D,
+	0x01, 0x02, 0x01, 0x08, 0x0E, 0x0E, 0x01, 0x02, 0x01, 0x0E, 0x04, 0x11, 0x01, 0x01, 0x00, 0x23,
+	0x01, 0x01, 0x00, 0x22, 0x01, 0x01, 0x00, 0x21, 0x01, 0x01, 0x00, 0x1F, 0x01, 0x01, 0x02, 0x1B,
+	0x01, 0x01, 0x05, 0x16, 0x01, 0x01, 0x09, 0x0F, 0x1A, 0x00,
+	// @1250 0x36 (47 pixels wide)
+	0x13, 0x00, 0x01, 0x01, 0x25, 0x04, 0x01, 0x01, 0x1E, 0x0B, 0x01, 0x01, 0x1A, 0x0F, 0x01, 0x01,
+	0x17, 0x12, 0x01, 0x01, 0x15, 0x14, 0x01, 0x01, 0x13, 0x16, 0x01, 0x01, 0x11, 0x18, 0x01, 0x01,
+	0x10, 0x19, 0x01, 0x01, 0x0E, 0x14, 0x01, 0x01, 0x0D, 0x10, 0x01, 0x01, 0x0C, 0x0E, 0x01, 0x01,
+	0x0B, 0x0D, 0x01, 0x01, 0x0A, 0x0C, 0x01, 0x01, 0x09, 0x0C, 0x01, 0x01, 0x08, 0x0C, 0x01, 0x01,
+	0x08, 0x0A, 0x01, 0x01, 0x07, 0x0A, 0x01, 0x01, 0x06, 0x0A, 0x01, 0x01, 0x06, 0x09, 0x01, 0x01,
+	0x05, 0x0A, 0x01, 0x01, 0x05, 0x09, 0x02, 0x01, 0x04, 0x09, 0x02, 0x01, 0x03, 0x09, 0x01, 0x02,
+	0x02, 0x09, 0x0B, 0x09, 0x01, 0x02, 0x02, 0x09, 0x07, 0x10, 0x01, 0x02, 0x02, 0x09, 0x05, 0x15,
+	0x01, 0x02, 0x01, 0x09, 0x04, 0x18, 0x01, 0x02, 0x01, 0x09, 0x03, 0x1B, 0x01, 0x02, 0x01, 0x09,
+	0x02, 0x1D, 0x01, 0x02, 0x01, 0x09, 0x01, 0x1F, 0x01, 0x03, 0x01, 0x08, 0x01, 0x0B, 0x05, 0x11,
+	0x01, 0x02, 0x00, 0x12, 0x0C, 0x0D, 0x01, 0x02, 0x00, 0x10, 0x10, 0x0C, 0x01, 0x02, 0x00, 0x0E,
+	0x13, 0x0C, 0x01, 0x02, 0x00, 0x0D, 0x15, 0x0B, 0x01, 0x02, 0x00, 0x0C, 0x17, 0x0B, 0x01, 0x02,
+	0x00, 0x0B, 0x18, 0x0B, 0x01, 0x02, 0x00, 0x0B, 0x19, 0x0A, 0x01, 0x02, 0x00, 0x0A, 0x1A, 0x0B,
+	0x01, 0x02, 0x00, 0x0A, 0x1B, 0x0A, 0x02, 0x02, 0x00, 0x09, 0x1C, 0x0A, 0x07, 0x02, 0x00, 0x09,
+	0x1D, 0x09, 0x01, 0x02, 0x01, 0x09, 0x1C, 0x09, 0x03, 0x02, 0x01, 0x09, 0x1B, 0x0A, 0x01, 0x02,
+	0x02, 0x09, 0x1A, 0x09, 0x01, 0x02, 0x02, 0x09, 0x19, 0x0A, 0x01, 0x02, 0x02, 0x0A, 0x18, 0x0A,
+	0x01, 0x02, 0x03, 0x09, 0x17, 0x0A, 0x01, 0x02, 0x03, 0x0A, 0x16, 0x0A, 0x01, 0x02, 0x04, 0x0A,
+	0x14, 0x0A, 0x01, 0x02, 0x04, 0x0B, 0x12, 0x0B, 0x01, 0x02, 0x05, 0x0B, 0x10, 0x0B, 0x01, 0x02,
+	0x06, 0x0C, 0x0C, 0x0C, 0x01, 0x02, 0x07, 0x0E, 0x07, 0x0D, 0x01, 0x01, 0x08, 0x20, 0x01, 0x01,
+	0x09, 0x1E, 0x01, 0x01, 0x0A, 0x1C, 0x01, 0x01, 0x0B, 0x1A, 0x01, 0x01, 0x0D, 0x16, 0x01, 0x01,
+	0x0F, 0x12, 0x01, 0x01, 0x12, 0x0C, 0x1A, 0x00,
+	// @1562 0x37 (44 pixels wide)
+	0x14, 0x00, 0x08, 0x01, 0x00, 0x2C, 0x02, 0x01, 0x22, 0x09, 0x02, 0x01, 0x21, 0x09, 0x02, 0x01,
+	0x20, 0x09, 0x02, 0x01, 0x1F, 0x09, 0x02, 0x01, 0x1E, 0x09, 0x02, 0x01, 0x1D, 0x09, 0x02, 0x01,
+	0x1C, 0x09, 0x02, 0x01, 0x1B, 0x09, 0x02, 0x01, 0x1A, 0x09, 0x02, 0x01, 0x19, 0x09, 0x01, 0x01,
+	0x18, 0x0A, 0x01, 0x01, 0x18, 0x09, 0x01, 0x01, 0x17, 0x0A, 0x01, 0x01, 0x17, 0x09, 0x01, 0x01,
+	0x16, 0x0A, 0x01, 0x01, 0x16, 0x09, 0x01, 0x01, 0x15, 0x0A, 0x01, 0x01, 0x15, 0x09, 0x01, 0x01,
+	0x14, 0x0A, 0x01, 0x01, 0x14, 0x09, 0x01, 0x01, 0x13, 0x0A, 0x01, 0x01, 0x13, 0x09, 0x01, 0x01,
+	0x12, 0x0A, 0x02, 0x01, 0x12, 0x09, 0x02, 0x01, 0x11, 0x09, 0x02, 0x01, 0x10, 0x09, 0x02, 0x01,
+	0x0F, 0x09, 0x02, 0x01, 0x0E, 0x09, 0x01, 0x01, 0x0D, 0x0A, 0x01, 0x01, 0x0D, 0x09, 0x01, 0x01,
+	0x0C, 0x0A, 0x01, 0x01, 0x0C, 0x09, 0x01, 0x01, 0x0B, 0x0A, 0x01, 0x01, 0x0B, 0x09, 0x01, 0x01,
+	0x0A, 0x0A, 0x01, 0x01, 0x0A, 0x09, 0x01, 0x01, 0x09, 0x0A, 0x01, 0x01, 0x09, 0x09, 0x01, 0x01,
+	0x08, 0x0A, 0x01, 0x01, 0x08, 0x09, 0x01, 0x01, 0x07, 0x0A, 0x01, 0x01, 0x07, 0x09, 0x01, 0x01,
+	0x06, 0x0A, 0x01, 0x01, 0x06, 0x09, 0x01, 0x01, 0x05, 0x0A, 0x01, 0x01, 0x05, 0x09, 0x01, 0x01,
+	0x04, 0x0A, 0x1B, 0x00,
+	// @1758 0x38 (47 pixels wide)
+	0x13, 0x00, 0x01, 0x01, 0x14, 0x08, 0x01, 0x01, 0x10, 0x10, 0x01, 0x01, 0x0D, 0x16, 0x01, 0x01,
+	0x0B, 0x1A, 0x01, 0x01, 0x0A, 0x1C, 0x01, 0x01, 0x09, 0x1E, 0x01, 0x01, 0x07, 0x21, 0x01, 0x02,
+	0x07, 0x0D, 0x08, 0x0D, 0x01, 0x02, 0x06, 0x0B, 0x0D, 0x0C, 0x01, 0x02, 0x05, 0x0B, 0x10, 0x0B,
+	0x02, 0x02, 0x04, 0x0A, 0x13, 0x0A, 0x01, 0x02, 0x04, 0x09, 0x15, 0x0A, 0x01, 0x02, 0x03, 0x09,
+	0x16, 0x0A, 0x09, 0x02, 0x03, 0x09, 0x17, 0x09, 0x02, 0x02, 0x03, 0x0A, 0x15, 0x09, 0x01, 0x02,
+	0x04, 0x0A, 0x13, 0x09, 0x01, 0x02, 0x04, 0x0B, 0x11, 0x0A, 0x01, 0x02, 0x05, 0x0C, 0x0E, 0x0A,
+	0x01, 0x02, 0x06, 0x0C, 0x0C, 0x0A, 0x01, 0x02, 0x07, 0x0D, 0x08, 0x0B, 0x01, 0x02, 0x08, 0x0F,
+	0x03, 0x0C, 0x01, 0x01, 0x09, 0x1C, 0x01, 0x01, 0x0A, 0x19, 0x01, 0x01, 0x0C, 0x15, 0x01, 0x01,
+	0x0E, 0x14, 0x01, 0x01, 0x0C, 0x18, 0x01, 0x01, 0x0A, 0x1C, 0x01, 0x01, 0x09, 0x1F, 0x01, 0x02,
+	0x07, 0x0D, 0x05, 0x10, 0x01, 0x02, 0x06, 0x0C, 0x09, 0x0F, 0x01, 0x02, 0x05, 0x0B, 0x0D, 0x0E,
+	0x01, 0x02, 0x04, 0x0A, 0x11, 0x0D, 0x01, 0x02, 0x03, 0x0A, 0x13, 0x0C, 0x01, 0x02, 0x03, 0x09,
+	0x15, 0x0C, 0x01, 0x02, 0x02, 0x0A, 0x16, 0x0B, 0x01, 0x02, 0x02, 0x09, 0x18, 0x0B, 0x01, 0x02,
+	0x01, 0x0A, 0x19, 0x0A, 0x01, 0x02, 0x01, 0x09, 0x1A, 0x0A, 0x01, 0x02, 0x01, 0x09, 0x1B, 0x0A,
+	0x07, 0x02, 0x00, 0x0A, 0x1B, 0x0A, 0x02, 0x02, 0x00, 0x0A, 0x1B, 0x09, 0x01, 0x02, 0x01, 0x0A,
+	0x19, 0x0A, 0x01, 0x02, 0x01, 0x0B, 0x18, 0x0A, 0x01, 0x02, 0x01, 0x0B, 0x17, 0x0A, 0x01, 0x02,
+	0x02, 0x0B, 0x15, 0x0B, 0x01, 0x02, 0x03, 0x0B, 0x13, 0x0B, 0x01, 0x02, 0x03, 0x0D, 0x0F, 0x0C,
+	0x01, 0x02, 0x04, 0x0E, 0x0B, 0x0D, 0x01, 0x01, 0x05, 0x24, 0x01, 0x01, 0x06, 0x22, 0x01, 0x01,
+	0x07, 0x20, 0x01, 0x01, 0x09, 0x1D, 0x01, 0x01, 0x0B, 0x19, 0x01, 0x01, 0x0D, 0x14, 0x01, 0x01,
+	0x10, 0x0E, 0x1A, 0x00,
+	// @2050 0x39 (47 pixels wide)
+	0x13, 0x00, 0x01, 0x01, 0x15, 0x07, 0x01, 0x01, 0x10, 0x10, 0x01, 0x01, 0x0E, 0x14, 0x01, 0x01,
+	0x0C, 0x18, 0x01, 0x01, 0x0A, 0x1B, 0x01, 0x01, 0x09, 0x1D, 0x01, 0x01, 0x08, 0x1F, 0x01, 0x02,
+	0x07, 0x0F, 0x03, 0x0F, 0x01, 0x02, 0x06, 0x0C, 0x0B, 0x0C, 0x01, 0x02, 0x05, 0x0B, 0x0F, 0x0B,
+	0x01, 0x02, 0x05, 0x0A, 0x11, 0x0B, 0x01, 0x02, 0x04, 0x0A, 0x13, 0x0A, 0x02, 0x02, 0x03, 0x0A,
+	0x15, 0x0A, 0x01, 0x02, 0x02, 0x0A, 0x17, 0x0A, 0x01, 0x02, 0x02, 0x09, 0x18, 0x0A, 0x01, 0x02,
+	0x02, 0x09, 0x19, 0x09, 0x01, 0x02, 0x01, 0x0A, 0x19, 0x0A, 0x01, 0x02, 0x01, 0x09, 0x1A, 0x0A,
+	0x02, 0x02, 0x01, 0x09, 0x1B, 0x09, 0x04, 0x02, 0x00, 0x0A, 0x1B, 0x0A, 0x03, 0x02, 0x00, 0x0A,
+	0x1C, 0x09, 0x02, 0x02, 0x01, 0x09, 0x1C, 0x09, 0x02, 0x02, 0x01, 0x0A, 0x1A, 0x0A, 0x01, 0x02,
+	0x01, 0x0B, 0x18, 0x0B, 0x01, 0x02, 0x02, 0x0A, 0x18, 0x0B, 0x01, 0x02, 0x02, 0x0B, 0x16, 0x0C,
+	0x01, 0x02, 0x03, 0x0B, 0x14, 0x0D, 0x01, 0x02, 0x03, 0x0C, 0x12, 0x0E, 0x01, 0x02, 0x04, 0x0C,
+	0x0F, 0x10, 0x01, 0x02, 0x05, 0x0E, 0x09, 0x13, 0x01, 0x02, 0x05, 0x20, 0x01, 0x08, 0x01, 0x02,
+	0x06, 0x1E, 0x01, 0x09, 0x01, 0x02, 0x07, 0x1C, 0x02, 0x09, 0x01, 0x02, 0x09, 0x18, 0x04, 0x09,
+	0x01, 0x02, 0x0A, 0x16, 0x05, 0x09, 0x01, 0x02, 0x0C, 0x12, 0x06, 0x09, 0x01, 0x02, 0x0F, 0x0C,
+	0x09, 0x09, 0x01, 0x01, 0x24, 0x09, 0x02, 0x01, 0x23, 0x09, 0x01, 0x01, 0x22, 0x0A, 0x01, 0x01,
+	0x22, 0x09, 0x01, 0x01, 0x21, 0x0A, 0x01, 0x01, 0x21, 0x09, 0x01, 0x01, 0x20, 0x0A, 0x01, 0x01,
+	0x1F, 0x0A, 0x01, 0x01, 0x1E, 0x0B, 0x01, 0x01, 0x1D, 0x0B, 0x01, 0x01, 0x1C, 0x0B, 0x01, 0x01,
+	0x1B, 0x0C, 0x01, 0x01, 0x1A, 0x0C, 0x01, 0x01, 0x18, 0x0D, 0x01, 0x01, 0x16, 0x0E, 0x01, 0x01,
+	0x14, 0x0F, 0x01, 0x01, 0x11, 0x11, 0x01, 0x01, 0x06, 0x1B, 0x01, 0x01, 0x06, 0x19, 0x01, 0x01,
+	0x06, 0x18, 0x01, 0x01, 0x06, 0x16, 0x01, 0x01, 0x06, 0x14, 0x01, 0x01, 0x06, 0x12, 0x01, 0x01,
+	0x06, 0x0E, 0x01, 0x01, 0x06, 0x09, 0x1A, 0x00,
+	// @2362 0x3F (33 pixels wide)
+	0x11, 0x00, 0x01, 0x01, 0x07, 0x0F, 0x01, 0x01, 0x04, 0x14, 0x01, 0x01, 0x02, 0x18, 0x01, 0x01,
+	0x00, 0x1B, 0x01, 0x01, 0x00, 0x1C, 0x01, 0x01, 0x00, 0x1D, 0x01, 0x01, 0x00, 0x1E, 0x01, 0x02,
+	0x01, 0x0A, 0x03, 0x11, 0x01, 0x02, 0x01, 0x05, 0x0D, 0x0C, 0x01, 0x02, 0x02, 0x02, 0x10, 0x0C,
+	0x01, 0x01, 0x15, 0x0B, 0x02, 0x01, 0x16, 0x0A, 0x04, 0x01, 0x17, 0x0A, 0x03, 0x01, 0x17, 0x09,
+	0x01, 0x01, 0x16, 0x0A, 0x01, 0x01, 0x16, 0x09, 0x02, 0x01, 0x15, 0x0A, 0x01, 0x01, 0x14, 0x0A,
+	0x01, 0x01, 0x14, 0x09, 0x01, 0x01, 0x13, 0x0A, 0x02, 0x01, 0x12, 0x0A, 0x01, 0x01, 0x11, 0x0A,
+	0x01, 0x01, 0x10, 0x0A, 0x02, 0x01, 0x0F, 0x0A, 0x01, 0x01, 0x0E, 0x0A, 0x01, 0x01, 0x0D, 0x0A,
+	0x01, 0x01, 0x0C, 0x0A, 0x01, 0x01, 0x0C, 0x09, 0x01, 0x01, 0x0B, 0x0A, 0x01, 0x01, 0x0B, 0x09,
+	0x01, 0x01, 0x0A, 0x0A, 0x02, 0x01, 0x0A, 0x09, 0x04, 0x01, 0x09, 0x09, 0x06, 0x01, 0x09, 0x08,
+	0x09, 0x00, 0x01, 0x01, 0x0A, 0x06, 0x01, 0x01, 0x09, 0x09, 0x01, 0x01, 0x08, 0x0A, 0x07, 0x01,
+	0x07, 0x0C, 0x01, 0x01, 0x08, 0x0A, 0x01, 0x01, 0x09, 0x09, 0x01, 0x01, 0x0A, 0x06, 0x1A, 0x00,
+};
+
+static const struct FONT_CHAR_INFO Descriptors[] = 
+{
+	{2, 0}, 		// 0x20
+	{27, 2}, 		// 0x2D
+	{12, 10}, 		// 0x2E
+	{47, 42}, 		// 0x30
+	{23, 298}, 		// 0x31
+	{44, 372}, 		// 0x32
+	{43, 600}, 		// 0x33
+	{51, 840}, 		// 0x34
+	{43, 1064}, 		// 0x35
+	{47, 1250}, 		// 0x36
+	{44, 1562}, 		// 0x37
+	{47, 1758}, 		// 0x38
+	{47, 2050}, 		// 0x39
+	{33, 2362}, 		// 0x3F
+};
+
+// the sign of every code, 0x3F for the codes which are not here
+static const uint8_t Map[256] = 
+{
+	 13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,
+	 13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,
+	  0,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,   1,   2,  13,
+	  3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  13,  13,  13,  13,  13,
+	 13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,
+	 13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,
+	 13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,
+	 13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,
+	 13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,
+	 13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,
+	 13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,
+	 13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,
+	 13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,
+	 13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,
+	 13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,
+	 13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,
+};
+
+sFONT RIAD_80pt = {
+  0,
+  Descriptors,
+  117, /* Height */
+  Signs,
+  1, /* Bpp */
+  Map,
+};
+#endif
@@ -0,0 +1,72 @@
+#include "beam.h"
+#include "ltdc.h"
+#include "core.h"
+#include "dma2d_jobs.h"
+
+volatile uint32_t BeamBands = 0;
+uint32_t BeamMissed = 0;
+
+static volatile uint8_t Band = 0;       // the band the LTDC reads now
+static uint8_t Active = 0;
+
+static uint32_t BandEndLine(uint8_t b);
+
+void Beam_Start(void){
+ Band = 0;
+ BeamBands = 0;
+ Active = 1;
+ HAL_LTDC_ProgramLineEvent(&hltdc, BandEndLine(0));
+}
+
+void Beam_Stop(void){
+ Active = 0;
+ __HAL_LTDC_DISABLE_IT(&hltdc, LTDC_IT_LI);
+}
+
+uint8_t Beam_Active(void){
+ return Active;
+}
+
+uint8_t Beam_Render(uint32_t Background, uint32_t Frame, void (*Draw)(void)){
+ uint32_t q, last, offset;
+ uint8_t ok = 1;
+
+ while(!BeamBands){ M_pull()();}        // the first line event after Beam_Start()
+
+ // q counts the bands as the LTDC reads them, the band q % BEAM_BANDS is free
+ // when BeamBands > q and the LTDC is back to it when BeamBands >= q + BEAM_BANDS.
+ // We begin with the band just read out, it has the most time
+ q = BeamBands - 1;
+ for(last = q + BEAM_BANDS; q < last; q++){
+   while(BeamBands <= q){ M_pull()();}  // the LTDC is still in this band
+   offset = 4 * (q % BEAM_BANDS) * BEAM_BAND_H * DisplayWIDTH;
+   Jobs_Wait(Jobs_Copy(Background + offset, Frame + offset, DisplayWIDTH, BEAM_BAND_H, 0, 0));
+   if(LCD_ClipPush(0, (q % BEAM_BANDS) * BEAM_BAND_H, DisplayWIDTH - 1, (q % BEAM_BANDS + 1) * BEAM_BAND_H - 1) == LCD_OK){
+     Draw();
+     LCD_ClipPop();
+   }
+   Jobs_WaitIdle();
+   __DSB();     // the CPU writes are in SDRAM too
+   if(BeamBands >= q + BEAM_BANDS){
+     BeamMissed++;
+     ok = 0;
+   }
+ }
+ return ok;
+}
+
+void Beam_LineEvent(void){
+ if(!Active) return;
+ BeamBands++;
+ Band = (Band + 1) % BEAM_BANDS;
+ LTDC->LIPCR = BandEndLine(Band);       // the end of the next band
+}
+
+/*******************************************************************************
+                            Static Functions
+*******************************************************************************/
+
+// the first line after the band, the line counter of the LTDC counts the sync and the back porch too
+static uint32_t BandEndLine(uint8_t b){
+ return hltdc.Init.AccumulatedVBP + 1 + (uint32_t)(b + 1) * BEAM_BAND_H;
+}
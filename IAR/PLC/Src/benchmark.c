@@ -0,0 +1,275 @@
+#include "benchmark.h"
+#include "perf.h"
+#include "lcd.h"
+#include "stroke.h"
+#include "dma2d_jobs.h"
+#include "video.h"
+#include "rotate.h"
+#include "glyphs.h"
+#include "fonts.h"
+#include "ugui_dma2d.h"
+#include <math.h>
+
+BenchPolyline BenchPoly;
+BenchFillResult BenchFill;
+BenchRotateResult BenchRotate;
+BenchTextResult BenchText;
+BenchUGuiResult BenchUGui;
+
+static Point PolyPoints[BENCH_POLY_POINTS];
+static UG_WINDOW Window;
+
+static uint32_t DrawPoly(uint8_t Width, uint8_t Join, uint8_t Cap);
+static uint32_t WindowRedraw(uint8_t Drivers);
+static uint32_t UpdateTime(void);
+static void WindowEvent(UG_MESSAGE * Msg);
+static uint32_t TextRate(uint8_t Cache);
+static uint32_t FillCpu(uint32_t Address, uint32_t Size, uint32_t Color);
+static uint32_t FillHal(uint32_t Address, uint32_t Size, uint32_t Color);
+static uint32_t FillReg(uint32_t Address, uint32_t Size, uint32_t Color);
+
+void Benchmark_Run(void){
+ Benchmark_Polyline();
+ Benchmark_Fill();
+ Benchmark_Rotate();
+ Benchmark_Text();
+ Benchmark_UGui();
+}
+
+void Benchmark_Polyline(void){
+ static const uint8_t Widths[4] = {1, 2, 4, 8};
+ uint32_t seed = 12345, start;
+ uint16_t i;
+
+ // a trend: slow sine and some noise, like a real signal
+ for(i = 0; i < BENCH_POLY_POINTS; i++){
+   seed = seed * 1103515245 + 12345;
+   PolyPoints[i].X = i;
+   PolyPoints[i].Y = 240 + (int16_t)(150.0f * sinf(i * 0.02f)) + (int16_t)((seed >> 16) % 41) - 20;
+ }
+
+ LCD_SetTextColor(LCD_COLOR_WHITE);
+ start = Perf_Cycles();
+ for(i = 0; i < BENCH_POLY_POINTS - 1; i++)
+   LCD_DrawLine(PolyPoints[i].X, PolyPoints[i].Y, PolyPoints[i + 1].X, PolyPoints[i + 1].Y);
+ BenchPoly.Thin = Perf_Cycles() - start;
+
+ for(i = 0; i < 4; i++)
+   BenchPoly.Width[i] = DrawPoly(Widths[i], STROKE_JOIN_MITER, STROKE_CAP_BUTT);
+ BenchPoly.Bevel3 = DrawPoly(3, STROKE_JOIN_BEVEL, STROKE_CAP_BUTT);
+ BenchPoly.Round3 = DrawPoly(3, STROKE_JOIN_MITER, STROKE_CAP_ROUND);
+}
+
+/* one line of Size pixels by CPU, by HAL and by the register level job ring,
+   the best of 8 runs each, so the interrupts don't spoil the numbers */
+void Benchmark_Fill(void){
+ static const uint16_t Sizes[BENCH_FILL_SIZES] = {1, 2, 4, 8, 16, 32, 64, 128, 256, 512, 800};
+ uint32_t address = ProjectionLayerAddress[LayerOfView], cpu, hal, reg, t;
+ uint8_t i, run;
+
+ Jobs_WaitIdle();
+ BenchFill.BreakEven = 0;
+ for(i = 0; i < BENCH_FILL_SIZES; i++){
+   cpu = hal = reg = 0xFFFFFFFF;
+   for(run = 0; run < 8; run++){
+     t = FillCpu(address, Sizes[i], LCD_COLOR_WHITE);
+     if(t < cpu) cpu = t;
+     t = FillHal(address, Sizes[i], LCD_COLOR_BLACK);
+     if(t < hal) hal = t;
+     t = FillReg(address, Sizes[i], LCD_COLOR_WHITE);
+     if(t < reg) reg = t;
+   }
+   BenchFill.Size[i] = Sizes[i];
+   BenchFill.Cpu[i] = cpu;
+   BenchFill.Hal[i] = hal;
+   BenchFill.Reg[i] = reg;
+   if((BenchFill.BreakEven == 0) && (reg < cpu)) BenchFill.BreakEven = Sizes[i];
+ }
+}
+
+void Benchmark_Text(void){
+ sFONT * font = LCD_GetFont();
+
+ LCD_SetFont(&RIAD_80pt);
+ LCD_SetTextColor(LCD_COLOR_WHITE);
+ LCD_SetBackColor(0);   // transparent, the signs are blended
+ BenchText.BitLoop = TextRate(0);
+ Glyph_Flush();
+ BenchText.CacheCold = TextRate(1);
+ BenchText.CacheWarm = TextRate(1);
+ LCD_SetFont(&RIAD_80pt_AA);
+ BenchText.A4 = TextRate(0);
+ LCD_SetFont(font);
+}
+
+/* A window with the title, 3 buttons and 2 text boxes, the whole of it is drawn
+   again by UG_Update(), the best of 4 runs with the drivers and without them.
+   Then one object is changed, UG_Update() draws only its damage */
+void Benchmark_UGui(void){
+ static UG_GUI gui;
+ static UG_OBJECT objects[5];
+ static UG_BUTTON buttons[3];
+ static UG_TEXTBOX boxes[2];
+ uint32_t t;
+ uint8_t i, run;
+
+ UGD_Init(&gui);
+ UG_WindowCreate(&Window, objects, 5, WindowEvent);
+ UG_WindowResize(&Window, 100, 60, 699, 419);
+ UG_WindowSetTitleText(&Window, "Benchmark");
+ UG_WindowSetTitleTextFont(&Window, &FONT_12X20);
+ UG_WindowSetTitleHeight(&Window, 24);
+ for(i = 0; i < 3; i++){
+   UG_ButtonCreate(&Window, &buttons[i], BTN_ID_0 + i, 10 + i * 195, 10, 190 + i * 195, 70);
+   UG_ButtonSetFont(&Window, BTN_ID_0 + i, &FONT_12X20);
+   UG_ButtonSetText(&Window, BTN_ID_0 + i, "Button");
+ }
+ for(i = 0; i < 2; i++){
+   UG_TextboxCreate(&Window, &boxes[i], TXB_ID_0 + i, 10, 90 + i * 120, 580, 200 + i * 120);
+   UG_TextboxSetFont(&Window, TXB_ID_0 + i, &FONT_8X14);
+   UG_TextboxSetAlignment(&Window, TXB_ID_0 + i, ALIGN_TOP_LEFT);
+   UG_TextboxSetText(&Window, TXB_ID_0 + i, "0123456789 ABCDEFGHIJKLMNOPQRSTUVWXYZ\nabcdefghijklmnopqrstuvwxyz 0123456789\n0123456789 ABCDEFGHIJKLMNOPQRSTUVWXYZ");
+ }
+ BenchUGui.Soft = WindowRedraw(0);
+ BenchUGui.Dma2d = WindowRedraw(1);
+
+ BenchUGui.Button = BenchUGui.Textbox = 0xFFFFFFFF;
+ for(run = 0; run < 4; run++){
+   UG_ButtonSetBackColor(&Window, BTN_ID_1, (run & 1) ? C_RED : C_GRAY);
+   t = UpdateTime();
+   if(t < BenchUGui.Button) BenchUGui.Button = t;
+   UG_TextboxSetText(&Window, TXB_ID_1, (run & 1) ? "0123456789" : "9876543210");
+   t = UpdateTime();
+   if(t < BenchUGui.Textbox) BenchUGui.Textbox = t;
+ }
+}
+
+/* the portrait surface (whatever is there) to the shown layer, the best of 4 runs */
+void Benchmark_Rotate(void){
+ static const uint16_t Dirs[2] = {ROT_90, ROT_270};
+ uint32_t dst = ProjectionLayerAddress[LayerOfView], t, start;
+ uint8_t i, run;
+
+ Jobs_WaitIdle();
+ for(i = 0; i < 2; i++){
+   BenchRotate.Naive[i] = BenchRotate.Blocked[i] = 0xFFFFFFFF;
+   for(run = 0; run < 4; run++){
+     start = Perf_Cycles();
+     Rot_RegionNaive(ROT_PORTRAIT_ADDRESS, dst, 0, 0, ROT_PORTRAIT_W, ROT_PORTRAIT_H, Dirs[i]);
+     t = Perf_Cycles() - start;
+     if(t < BenchRotate.Naive[i]) BenchRotate.Naive[i] = t;
+     start = Perf_Cycles();
+     Rot_Region(ROT_PORTRAIT_ADDRESS, dst, 0, 0, ROT_PORTRAIT_W, ROT_PORTRAIT_H, Dirs[i]);
+     t = Perf_Cycles() - start;
+     if(t < BenchRotate.Blocked[i]) BenchRotate.Blocked[i] = t;
+   }
+ }
+ BenchRotate.NaiveDirty = BenchRotate.BlockedDirty = 0xFFFFFFFF;
+ for(run = 0; run < 4; run++){
+   start = Perf_Cycles();
+   Rot_RegionNaive(ROT_PORTRAIT_ADDRESS, dst, 200, 300, 64, 64, ROT_90);
+   t = Perf_Cycles() - start;
+   if(t < BenchRotate.NaiveDirty) BenchRotate.NaiveDirty = t;
+   start = Perf_Cycles();
+   Rot_Region(ROT_PORTRAIT_ADDRESS, dst, 200, 300, 64, 64, ROT_90);
+   t = Perf_Cycles() - start;
+   if(t < BenchRotate.BlockedDirty) BenchRotate.BlockedDirty = t;
+ }
+}
+
+/*******************************************************************************
+                            Static Functions
+*******************************************************************************/
+
+static uint32_t FillCpu(uint32_t Address, uint32_t Size, uint32_t Color){
+ __IO uint32_t * pDst = (__IO uint32_t *)Address;
+ uint32_t start;
+
+ start = Perf_Cycles();
+ while(Size--) *pDst++ = Color;
+ return Perf_Cycles() - start;
+}
+
+static uint32_t FillHal(uint32_t Address, uint32_t Size, uint32_t Color){
+ void (*complete)(DMA2D_HandleTypeDef *) = hdma2d.XferCpltCallback;
+ void (*error)(DMA2D_HandleTypeDef *) = hdma2d.XferErrorCallback;
+ uint32_t start;
+
+ start = Perf_Cycles();
+ hdma2d.Init.Mode = DMA2D_R2M;
+ hdma2d.Init.ColorMode = DMA2D_ARGB8888;
+ hdma2d.Init.OutputOffset = 0;
+ hdma2d.XferCpltCallback = NULL;      // polling, the ring must not see it
+ hdma2d.XferErrorCallback = NULL;
+ if(HAL_DMA2D_Init(&hdma2d) == HAL_OK)
+   if(HAL_DMA2D_Start(&hdma2d, Color, Address, Size, 1) == HAL_OK)
+     HAL_DMA2D_PollForTransfer(&hdma2d, 10);
+ start = Perf_Cycles() - start;
+ hdma2d.XferCpltCallback = complete;
+ hdma2d.XferErrorCallback = error;
+ D2D_Invalidate();                     // HAL has written the registers
+ return start;
+}
+
+static uint32_t FillReg(uint32_t Address, uint32_t Size, uint32_t Color){
+ uint32_t start;
+
+ start = Perf_Cycles();
+ Jobs_Wait(Jobs_Fill(Address, Size, 1, 0, Color));
+ return Perf_Cycles() - start;
+}
+
+/* 10 lines of 10 digits, characters per second */
+static uint32_t TextRate(uint8_t Cache){
+ uint32_t start, t;
+ uint8_t line;
+
+ LCD_SetGlyphCache(Cache);
+ start = Perf_Cycles();
+ for(line = 0; line < 10; line++)
+   LCD_DisplayStringAt(10, 10 + line * 40, (uint8_t *)"0123456789", LEFT_MODE, 0);
+ t = Perf_Cycles() - start;
+ LCD_SetGlyphCache(1);
+ return (uint32_t)((uint64_t)100 * SystemCoreClock / t);
+}
+
+static uint32_t WindowRedraw(uint8_t Drivers){
+ uint32_t best = 0xFFFFFFFF, t;
+ uint8_t i, run;
+
+ for(i = 0; i < NUMBER_OF_DRIVERS; i++){
+   if(Drivers) UG_DriverEnable(i);
+   else UG_DriverDisable(i);
+ }
+ for(run = 0; run < 4; run++){
+   UG_WindowShow(&Window);
+   t = UpdateTime();
+   if(t < best) best = t;
+ }
+ return best;
+}
+
+static uint32_t UpdateTime(void){
+ uint32_t start = Perf_Cycles();
+
+ UG_Update();
+ Jobs_WaitIdle();
+ return Perf_Cycles() - start;
+}
+
+static void WindowEvent(UG_MESSAGE * Msg){
+ (void)Msg;
+}
+
+static uint32_t DrawPoly(uint8_t Width, uint8_t Join, uint8_t Cap){
+ StrokeStyle Style;
+ uint32_t start;
+
+ Style.Width = Width;
+ Style.Join = Join;
+ Style.Cap = Cap;
+ Style.MiterLimit = STROKE_MITER_LIMIT;
+ start = Perf_Cycles();
+ LCD_DrawThickPolyline(PolyPoints, BENCH_POLY_POINTS, &Style);
+ return Perf_Cycles() - start;
+}
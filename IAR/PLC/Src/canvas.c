@@ -0,0 +1,137 @@
+#include "canvas.h"
+#include "ltdc.h"
+#include "core.h"
+#include "video.h"
+
+#define LAYER                   LTDC_LAYER(&hltdc, CANVAS_LAYER)
+
+static Trend * DrawTrend;       // for TrendColumn()
+static int16_t DrawValue;
+
+static void Reload(void);
+static void WaitReload(void);
+static void TrendColumn(void);
+
+void Canvas_Init(Canvas * c, uint32_t Address, uint8_t Ring, uint16_t Width, uint16_t Height,
+                 int16_t WinX, int16_t WinY, uint16_t WinW, uint16_t WinH){
+ c->Address = Address;
+ c->Ring = Ring;
+ c->WinX = WinX;
+ c->WinY = WinY;
+ c->WinW = WinW;
+ c->WinH = WinH;
+ c->ScrollX = 0;
+ c->ScrollY = 0;
+ c->Width = Width;
+ c->Height = Height;
+ c->Period = 0;
+ if(Ring == CANVAS_RING_X){
+   c->Period = WinW + 1;        // one column is never shown, the next strip goes there
+   c->Width = 2 * c->Period;
+   c->Height = WinH;
+ }
+ else if(Ring == CANVAS_RING_Y){
+   c->Period = WinH + 1;
+   c->Width = WinW;
+   c->Height = 2 * c->Period;
+ }
+}
+
+uint32_t Canvas_Size(const Canvas * c){
+ return 4 * (uint32_t)c->Width * c->Height;
+}
+
+void Canvas_Show(Canvas * c){
+ uint32_t ahbp = (LTDC->BPCR & LTDC_BPCR_AHBP) >> 16;
+ uint32_t avbp = LTDC->BPCR & LTDC_BPCR_AVBP;
+
+ WaitReload();
+ LAYER->WHPCR = (c->WinX + ahbp + 1) | ((uint32_t)(c->WinX + c->WinW + ahbp) << 16);
+ LAYER->WVPCR = (c->WinY + avbp + 1) | ((uint32_t)(c->WinY + c->WinH + avbp) << 16);
+ LAYER->PFCR = LTDC_PIXEL_FORMAT_ARGB8888;
+ LAYER->BFCR = LTDC_BLENDING_FACTOR1_CA | LTDC_BLENDING_FACTOR2_CA;
+ LAYER->CACR = 255;
+ LAYER->DCCR = 0;
+ LAYER->CFBLR = ((uint32_t)c->Width * 4 << 16) | (c->WinW * 4 + 3);
+ LAYER->CFBLNR = c->WinH;
+ LAYER->CR = (LAYER->CR & ~(LTDC_LxCR_CLUTEN | LTDC_LxCR_COLKEN)) | LTDC_LxCR_LEN;      // not the L8 overlay
+ Canvas_ScrollTo(c, c->ScrollX, c->ScrollY);
+}
+
+void Canvas_Hide(void){
+ WaitReload();
+ LAYER->CR &= ~LTDC_LxCR_LEN;
+ Reload();
+}
+
+void Canvas_ScrollTo(Canvas * c, int16_t x, int16_t y){
+ if(x > c->Width - c->WinW) x = c->Width - c->WinW;
+ if(y > c->Height - c->WinH) y = c->Height - c->WinH;
+ if(x < 0) x = 0;
+ if(y < 0) y = 0;
+ c->ScrollX = x;
+ c->ScrollY = y;
+ LAYER->CFBAR = c->Address + 4 * ((uint32_t)y * c->Width + x);
+ Reload();
+}
+
+void Canvas_Draw(Canvas * c, int16_t x, int16_t y, uint16_t w, uint16_t h, void (*Draw)(void)){
+ WaitReload();  // the strip may be in the window till the last scroll is loaded
+ LCD_SetSurface(c->Address, c->Width, 0, 0);
+ if(LCD_ClipPushSurface(x, y, x + w - 1, y + h - 1) == LCD_OK){
+   Draw();
+   LCD_ClipPop();
+ }
+ if(c->Ring == CANVAS_RING_X) LCD_SetSurface(c->Address + 4 * c->Period, c->Width, 0, 0);
+ if(c->Ring == CANVAS_RING_Y) LCD_SetSurface(c->Address + 4 * (uint32_t)c->Period * c->Width, c->Width, 0, 0);
+ if((c->Ring != CANVAS_PLAIN) && (LCD_ClipPushSurface(x, y, x + w - 1, y + h - 1) == LCD_OK)){
+   Draw();
+   LCD_ClipPop();
+ }
+ LCD_ResetSurface();
+}
+
+void Trend_Init(Trend * t, uint32_t Address, int16_t WinX, int16_t WinY, uint16_t WinW, uint16_t WinH, uint32_t Color, uint32_t Back){
+ Canvas_Init(&t->View, Address, CANVAS_RING_X, 0, 0, WinX, WinY, WinW, WinH);
+ t->Next = 0;
+ t->Last = 0;
+ t->Color = Color;
+ t->Back = Back;
+ _HW_Fill_Region(Address, t->View.Width, t->View.Height, 0, Back);
+}
+
+void Trend_Add(Trend * t, int16_t Value){
+ if(Value < 0) Value = 0;
+ if(Value > t->View.WinH - 1) Value = t->View.WinH - 1;
+
+ DrawTrend = t;
+ DrawValue = Value;
+ Canvas_Draw(&t->View, t->Next, 0, 1, t->View.WinH, TrendColumn);
+ t->Last = Value;
+ // the newest column at the right side of the window, its copy is at Next + Period
+ Canvas_ScrollTo(&t->View, (t->Next + 2) % t->View.Period, 0);
+ t->Next = (t->Next + 1) % t->View.Period;
+}
+
+/*******************************************************************************
+                            Static Functions
+*******************************************************************************/
+
+static void Reload(void){
+ LTDC->SRCR = LTDC_SRCR_VBR;    // in the next vertical blanking
+}
+
+static void WaitReload(void){
+ while(LTDC->SRCR & LTDC_SRCR_VBR){ M_pull()();}
+}
+
+/* the background of the column and the line from the last value */
+static void TrendColumn(void){
+ const ClipRect * clip = LCD_GetClip();
+ int16_t x = clip->X0, h = DrawTrend->View.WinH;
+
+ LCD_SetTextColor(DrawTrend->Back);
+ DrawFastLineVertical(x, 0, h - 1);
+ LCD_SetTextColor(DrawTrend->Color);
+ DrawFastLineVertical(x, h - 1 - DrawTrend->Last, h - 1 - DrawValue);
+}
@@ -18,6 +18,7 @@
  */
 
 #include "dma2d_graphic.h"
+#include "spans.h"
 
 /* Absolute number */
 #define ABS(X)	((X) > 0 ? (X) : -(X))    
@@ -49,8 +50,7 @@ __STATIC_INLINE void DrawPixel(uint16_t x, uint16_t y, uint32_t color) {
 /* Private functions */
 void TM_INT_DMA2DGRAPHIC_InitAndTransfer(void);
 void TM_INT_DMA2DGRAPHIC_SetMemory(uint32_t MemoryAddress, uint32_t Offset, uint32_t NumberOfLine, uint32_t PixelPerLine);
-void TM_INT_DMA2DGRAPHIC_DrawCircleCorner(int16_t x0, int16_t y0, int16_t r, uint8_t corner, uint32_t color);
-void TM_INT_DMA2DGRAPHIC_DrawFilledCircleCorner(int16_t x0, int16_t y0, int16_t r, uint8_t corner, uint32_t color);
+void TM_INT_DMA2DGRAPHIC_DrawSpan(int16_t y, int16_t x1, int16_t x2, uint32_t color);
 
 void TM_DMA2DGRAPHIC_Init(void) {
 	/* Internal settings */
@@ -226,18 +226,8 @@ void TM_DMA2DGRAPHIC_DrawRoundedRectangle(uint16_t x, uint16_t y, uint16_t width
 		return;
 	}
 	
-	/* Draw lines */
-	TM_DMA2DGRAPHIC_DrawHorizontalLine(x + r, y, width - 2 * r, color); /* Top */
-	TM_DMA2DGRAPHIC_DrawHorizontalLine(x + r, y + height - 1, width - 2 * r, color); /* Bottom */
-	
-	TM_DMA2DGRAPHIC_DrawVerticalLine(x, y + r, height - 2 * r, color); /* Right */
-	TM_DMA2DGRAPHIC_DrawVerticalLine(x + width - 1, y + r, height - 2 * r, color); /* Left */
-	
-	/* Draw corners */
-	TM_INT_DMA2DGRAPHIC_DrawCircleCorner(x + r, y + r, r, 0x01, color); /* Top left */
-	TM_INT_DMA2DGRAPHIC_DrawCircleCorner(x + width - r - 1, y + r, r, 0x02, color); /* Top right */
-	TM_INT_DMA2DGRAPHIC_DrawCircleCorner(x + width - r - 1, y + height - r - 1, r, 0x04, color); /* Bottom right */
-	TM_INT_DMA2DGRAPHIC_DrawCircleCorner(x + r, y + height - r - 1, r, 0x08, color); /* Bottom left */
+	/* Draw outline as horizontal spans, corners and sides together */
+	Span_DrawRoundRect(x, y, x + width - 1, y + height - 1, r, color, TM_INT_DMA2DGRAPHIC_DrawSpan);
 }
 
 void TM_DMA2DGRAPHIC_DrawFilledRoundedRectangle(uint16_t x, uint16_t y, uint16_t width, uint16_t height, uint16_t r, uint32_t color) {
@@ -266,16 +256,8 @@ void TM_DMA2DGRAPHIC_DrawFilledRoundedRectangle(uint16_t x, uint16_t y, uint16_t
 		return;
 	}
 	
-	/* Draw rectangles */
-	TM_DMA2DGRAPHIC_DrawFilledRectangle(x + r, y, width - 2 * r, height, color);
-	TM_DMA2DGRAPHIC_DrawFilledRectangle(x, y + r, r, height - 2 * r, color);
-	TM_DMA2DGRAPHIC_DrawFilledRectangle(x + width - r, y + r, r, height - 2 * r, color);
-	
-	/* Draw corners */
-	TM_INT_DMA2DGRAPHIC_DrawFilledCircleCorner(x + r, y + r, r, 0x01, color); /* Top left */
-	TM_INT_DMA2DGRAPHIC_DrawFilledCircleCorner(x + width - r - 1, y + r, r, 0x02, color); /* Top right */
-	TM_INT_DMA2DGRAPHIC_DrawFilledCircleCorner(x + width - r - 1, y + height - r - 1, r, 0x04, color); /* Bottom right */
-	TM_INT_DMA2DGRAPHIC_DrawFilledCircleCorner(x + r, y + height - r - 1, r, 0x08, color); /* Bottom left */
+	/* One span per line */
+	Span_FillRoundRect(x, y, x + width - 1, y + height - 1, r, color, TM_INT_DMA2DGRAPHIC_DrawSpan);
 }
 
 void TM_DMA2DGRAPHIC_DrawVerticalLine(int16_t x, int16_t y, uint16_t length, uint32_t color) {
@@ -458,68 +440,11 @@ void TM_DMA2DGRAPHIC_DrawPolyLine(TM_DMA2DRAPHIC_Poly_t* Coordinates, uint16_t c
 }
 
 void TM_DMA2DGRAPHIC_DrawCircle(uint16_t x0, uint16_t y0, uint16_t r, uint32_t color) {
-	int16_t f = 1 - r;
-	int16_t ddF_x = 1;
-	int16_t ddF_y = -2 * r;
-	int16_t x = 0;
-	int16_t y = r;
-
-    TM_DMA2DGRAPHIC_DrawVerticalLine(x0, y0 + r, 1, color);
-    TM_DMA2DGRAPHIC_DrawVerticalLine(x0, y0 - r, 1, color);
-    TM_DMA2DGRAPHIC_DrawVerticalLine(x0 + r, y0, 1, color);
-    TM_DMA2DGRAPHIC_DrawVerticalLine(x0 - r, y0, 1, color);
-
-    while (x < y) {
-        if (f >= 0) {
-            y--;
-            ddF_y += 2;
-            f += ddF_y;
-        }
-        x++;
-        ddF_x += 2;
-        f += ddF_x;
-
-        TM_DMA2DGRAPHIC_DrawVerticalLine(x0 + x, y0 + y, 1, color);
-        TM_DMA2DGRAPHIC_DrawVerticalLine(x0 - x, y0 + y, 1, color);
-        TM_DMA2DGRAPHIC_DrawVerticalLine(x0 + x, y0 - y, 1, color);
-        TM_DMA2DGRAPHIC_DrawVerticalLine(x0 - x, y0 - y, 1, color);
-
-        TM_DMA2DGRAPHIC_DrawVerticalLine(x0 + y, y0 + x, 1, color);
-        TM_DMA2DGRAPHIC_DrawVerticalLine(x0 - y, y0 + x, 1, color);
-        TM_DMA2DGRAPHIC_DrawVerticalLine(x0 + y, y0 - x, 1, color);
-        TM_DMA2DGRAPHIC_DrawVerticalLine(x0 - y, y0 - x, 1, color);
-    }
+	Span_DrawCircle(x0, y0, r, color, TM_INT_DMA2DGRAPHIC_DrawSpan);
 }
 
 void TM_DMA2DGRAPHIC_DrawFilledCircle(uint16_t x0, uint16_t y0, uint16_t r, uint32_t color) {
-	int16_t f = 1 - r;
-	int16_t ddF_x = 1;
-	int16_t ddF_y = -2 * r;
-	int16_t x = 0;
-	int16_t y = r;
-
-    TM_DMA2DGRAPHIC_DrawVerticalLine(x0, y0 + r, 1, color);
-    TM_DMA2DGRAPHIC_DrawVerticalLine(x0, y0 - r, 1, color);
-    TM_DMA2DGRAPHIC_DrawVerticalLine(x0 + r, y0, 1, color);
-    TM_DMA2DGRAPHIC_DrawVerticalLine(x0 - r, y0, 1, color);
-    TM_DMA2DGRAPHIC_DrawHorizontalLine(x0 - r, y0, 2 * r, color);
-
-    while (x < y) {
-        if (f >= 0) {
-            y--;
-            ddF_y += 2;
-            f += ddF_y;
-        }
-        x++;
-        ddF_x += 2;
-        f += ddF_x;
-
-        TM_DMA2DGRAPHIC_DrawHorizontalLine(x0 - x, y0 + y, 2 * x, color);
-		TM_DMA2DGRAPHIC_DrawHorizontalLine(x0 - x, y0 - y, 2 * x, color);
-
-        TM_DMA2DGRAPHIC_DrawHorizontalLine(x0 - y, y0 + x, 2 * y, color);
-        TM_DMA2DGRAPHIC_DrawHorizontalLine(x0 - y, y0 - x, 2 * y, color);
-    }
+	Span_FillCircle(x0, y0, r, color, TM_INT_DMA2DGRAPHIC_DrawSpan);
 }
 
 void TM_DMA2DGRAPHIC_DrawTriangle(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t x3, uint16_t y3, uint32_t color) {
@@ -662,80 +587,10 @@ void TM_INT_DMA2DGRAPHIC_SetMemory(uint32_t MemoryAddress, uint32_t Offset, uint
 	GRAPHIC_DMA2D_InitStruct.DMA2D_PixelPerLine = PixelPerLine;
 }
 
-void TM_INT_DMA2DGRAPHIC_DrawCircleCorner(int16_t x0, int16_t y0, int16_t r, uint8_t corner, uint32_t color) {
-	int16_t f = 1 - r;
-	int16_t ddF_x = 1;
-	int16_t ddF_y = -2 * r;
-	int16_t x = 0;
-	int16_t y = r;
-
-    while (x < y) {
-        if (f >= 0) {
-            y--;
-            ddF_y += 2;
-            f += ddF_y;
-        }
-        x++;
-        ddF_x += 2;
-        f += ddF_x;
-
-        if (corner & 0x01) {/* Top left */	
-			TM_DMA2DGRAPHIC_DrawPixel(x0 - y, y0 - x, color);
-			TM_DMA2DGRAPHIC_DrawPixel(x0 - x, y0 - y, color);
-		}
-		
-        if (corner & 0x02) {/* Top right */
-			TM_DMA2DGRAPHIC_DrawPixel(x0 + x, y0 - y, color);
-			TM_DMA2DGRAPHIC_DrawPixel(x0 + y, y0 - x, color);
-		}
-		
-		if (corner & 0x04) {/* Bottom right */
-			TM_DMA2DGRAPHIC_DrawPixel(x0 + x, y0 + y, color);
-			TM_DMA2DGRAPHIC_DrawPixel(x0 + y, y0 + x, color);
-		}
-		
-        if (corner & 0x08) {/* Bottom left */	
-			TM_DMA2DGRAPHIC_DrawPixel(x0 - x, y0 + y, color);
-			TM_DMA2DGRAPHIC_DrawPixel(x0 - y, y0 + x, color);
-		}
-    }
-}
-
-void TM_INT_DMA2DGRAPHIC_DrawFilledCircleCorner(int16_t x0, int16_t y0, int16_t r, uint8_t corner, uint32_t color) {
-	int16_t f = 1 - r;
-	int16_t ddF_x = 1;
-	int16_t ddF_y = -2 * r;
-	int16_t x = 0;
-	int16_t y = r;
-
-    while (x < y) {
-        if (f >= 0) {
-            y--;
-            ddF_y += 2;
-            f += ddF_y;
-        }
-        x++;
-        ddF_x += 2;
-        f += ddF_x;
-
-        if (corner & 0x01) {/* Top left */
-			TM_DMA2DGRAPHIC_DrawLine(x0, y0 - y, x0 - x, y0 - y, color);
-			TM_DMA2DGRAPHIC_DrawLine(x0, y0 - x, x0 - y, y0 - x, color);
-		}
-		
-        if (corner & 0x02) {/* Top right */
-			TM_DMA2DGRAPHIC_DrawLine(x0 + x, y0 - y, x0, y0 - y, color);
-			TM_DMA2DGRAPHIC_DrawLine(x0 + y, y0 - x, x0, y0 - x, color);
-		}
-		
-		if (corner & 0x04) {/* Bottom right */
-			TM_DMA2DGRAPHIC_DrawLine(x0, y0 + y, x0 + x, y0 + y, color);
-			TM_DMA2DGRAPHIC_DrawLine(x0 + y, y0 + x, x0, y0 + x, color);
-		}
-		
-        if (corner & 0x08) {/* Bottom left */
-			TM_DMA2DGRAPHIC_DrawLine(x0 - x, y0 + y, x0, y0 + y, color);
-			TM_DMA2DGRAPHIC_DrawLine(x0, y0 + x, x0 - y, y0 + x, color);
-		}
-    }
+void TM_INT_DMA2DGRAPHIC_DrawSpan(int16_t y, int16_t x1, int16_t x2, uint32_t color) {
+	/* Span generators give inclusive ends */
+	if (x2 < x1 || y < 0) {
+		return;
+	}
+	TM_DMA2DGRAPHIC_DrawHorizontalLine(x1, y, x2 - x1 + 1, color);
 }
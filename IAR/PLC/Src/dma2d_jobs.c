@@ -0,0 +1,177 @@
+#include "dma2d_jobs.h"
+#include "video.h"
+#include "core.h"
+
+#define JOBS_MASK               (JOBS_RING_SIZE - 1)
+
+volatile uint32_t JobsErrors = 0;
+
+static DMA2D_Job Ring[JOBS_RING_SIZE];
+static volatile uint32_t Head = 0;     // jobs submitted, the fence of the last one
+static volatile uint32_t Tail = 0;     // jobs done, Ring[Tail] is running
+
+static void Transfer_DMA2D_Error(DMA2D_HandleTypeDef *hdma2d);
+
+void Jobs_Init(void){
+ D2D_Init(Transfer_DMA2D_Completed, Transfer_DMA2D_Error);
+}
+
+uint32_t Jobs_Submit(const DMA2D_Job * Job){
+ uint32_t primask, fence;
+
+ while(Head - Tail >= JOBS_RING_SIZE){ M_pull()();}  // full, nothing is dropped
+ Ring[Head & JOBS_MASK] = *Job;    // the slot is free, the interrupt doesn't touch it
+
+ primask = __get_PRIMASK();
+ __disable_irq();
+ fence = ++Head;
+ if(PLC_DMA2D_Status.Ready){  // idle, nobody will start it from the interrupt
+   PLC_DMA2D_Status.Ready = 0;
+   D2D_Start(&Ring[Tail & JOBS_MASK]);
+ }
+ __set_PRIMASK(primask);
+ return fence;
+}
+
+uint32_t Jobs_Fill(uint32_t Dst, uint32_t xSize, uint32_t ySize, uint32_t DstOffLine, uint32_t Color){
+ DMA2D_Job job;
+
+ job.Mode = DMA2D_R2M;
+ job.Src = Color;
+ job.Dst = Dst;
+ job.xSize = xSize;
+ job.ySize = ySize;
+ job.DstOffLine = DstOffLine;
+ job.ColorMode = DMA2D_ARGB8888;
+ return Jobs_Submit(&job);
+}
+
+uint32_t Jobs_Copy(uint32_t Src, uint32_t Dst, uint32_t xSize, uint32_t ySize, uint32_t SrcOffLine, uint32_t DstOffLine){
+ DMA2D_Job job;
+
+ job.Mode = DMA2D_M2M;
+ job.Src = Src;
+ job.Dst = Dst;
+ job.xSize = xSize;
+ job.ySize = ySize;
+ job.SrcOffLine = SrcOffLine;
+ job.DstOffLine = DstOffLine;
+ job.ColorMode = DMA2D_ARGB8888;
+ job.SrcColorMode = CM_ARGB8888;
+ job.AlphaMode = DMA2D_NO_MODIF_ALPHA;
+ job.Alpha = 0xFF;
+ return Jobs_Submit(&job);
+}
+
+uint32_t Jobs_CopyPFC(uint32_t Src, uint32_t Dst, uint32_t xSize, uint32_t ySize, uint32_t SrcOffLine, uint32_t DstOffLine, uint32_t SrcColorMode){
+ DMA2D_Job job;
+
+ job.Mode = DMA2D_M2M_PFC;
+ job.Src = Src;
+ job.Dst = Dst;
+ job.xSize = xSize;
+ job.ySize = ySize;
+ job.SrcOffLine = SrcOffLine;
+ job.DstOffLine = DstOffLine;
+ job.ColorMode = DMA2D_ARGB8888;
+ job.SrcColorMode = SrcColorMode;
+ job.AlphaMode = DMA2D_NO_MODIF_ALPHA;
+ job.Alpha = 0xFF;
+ job.Clut = 0;
+ return Jobs_Submit(&job);
+}
+
+uint32_t Jobs_CopyCLUT(uint32_t Src, uint32_t Dst, uint32_t xSize, uint32_t ySize, uint32_t SrcOffLine, uint32_t DstOffLine, uint32_t SrcColorMode, uint32_t Clut, uint16_t Colors){
+ DMA2D_Job job;
+
+ job.Mode = DMA2D_M2M_PFC;
+ job.Src = Src;
+ job.Dst = Dst;
+ job.xSize = xSize;
+ job.ySize = ySize;
+ job.SrcOffLine = SrcOffLine;
+ job.DstOffLine = DstOffLine;
+ job.ColorMode = DMA2D_ARGB8888;
+ job.SrcColorMode = SrcColorMode;
+ job.AlphaMode = DMA2D_NO_MODIF_ALPHA;
+ job.Alpha = 0xFF;
+ job.Clut = Clut;
+ job.ClutSize = Colors;
+ return Jobs_Submit(&job);
+}
+
+// the alpha of the palette colors is used, 0 - transparent
+uint32_t Jobs_BlendCLUT(uint32_t Fore, uint32_t Back, uint32_t Dst, uint32_t xSize, uint32_t ySize, uint32_t ForeOffLine, uint32_t BackOffLine, uint32_t DstOffLine, uint32_t ForeColorMode, uint32_t Clut, uint16_t Colors){
+ DMA2D_Job job;
+
+ job.Mode = DMA2D_M2M_BLEND;
+ job.Src = Fore;
+ job.Back = Back;
+ job.Dst = Dst;
+ job.xSize = xSize;
+ job.ySize = ySize;
+ job.SrcOffLine = ForeOffLine;
+ job.BackOffLine = BackOffLine;
+ job.DstOffLine = DstOffLine;
+ job.ColorMode = DMA2D_ARGB8888;
+ job.SrcColorMode = ForeColorMode;
+ job.BackColorMode = CM_ARGB8888;
+ job.AlphaMode = DMA2D_NO_MODIF_ALPHA;
+ job.Alpha = 0xFF;
+ job.Clut = Clut;
+ job.ClutSize = Colors;
+ return Jobs_Submit(&job);
+}
+
+uint32_t Jobs_Blend(uint32_t Fore, uint32_t Back, uint32_t Dst, uint32_t xSize, uint32_t ySize, uint32_t ForeOffLine, uint32_t BackOffLine, uint32_t DstOffLine, uint32_t ForeColorMode, uint32_t ForeAlpha){
+ DMA2D_Job job;
+
+ job.Mode = DMA2D_M2M_BLEND;
+ job.Src = Fore;
+ job.Back = Back;
+ job.Dst = Dst;
+ job.xSize = xSize;
+ job.ySize = ySize;
+ job.SrcOffLine = ForeOffLine;
+ job.BackOffLine = BackOffLine;
+ job.DstOffLine = DstOffLine;
+ job.ColorMode = DMA2D_ARGB8888;
+ job.SrcColorMode = ForeColorMode;
+ job.BackColorMode = CM_ARGB8888;
+ job.AlphaMode = ((ForeColorMode == CM_A8) || (ForeColorMode == CM_A4)) ? DMA2D_NO_MODIF_ALPHA : DMA2D_COMBINE_ALPHA;
+ job.Alpha = ForeAlpha;
+ job.Clut = 0;
+ return Jobs_Submit(&job);
+}
+
+uint8_t Jobs_Done(uint32_t Fence){
+ return (int32_t)(Tail - Fence) >= 0;  // the counters wrap
+}
+
+void Jobs_Wait(uint32_t Fence){
+ while(!Jobs_Done(Fence)){ M_pull()();}
+}
+
+void Jobs_WaitIdle(void){
+ Jobs_Wait(Head);
+}
+
+uint8_t Jobs_Idle(void){
+ return Head == Tail;
+}
+
+/* the running job is done, start the next one */
+void Jobs_Next(void){
+ Tail++;
+ if(Head != Tail) D2D_Start(&Ring[Tail & JOBS_MASK]);
+ else PLC_DMA2D_Status.Ready = 1;
+}
+
+/*******************************************************************************
+                            Static Functions
+*******************************************************************************/
+
+static void Transfer_DMA2D_Error(DMA2D_HandleTypeDef *hdma2d){
+ JobsErrors++;
+ Jobs_Next();
+}
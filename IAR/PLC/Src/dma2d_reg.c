@@ -0,0 +1,125 @@
+#include "dma2d_reg.h"
+#include "dma2d.h"
+#include "ltdc_mon.h"
+
+#define D2D_IT                  (DMA2D_CR_TCIE | DMA2D_CR_TEIE | DMA2D_CR_CEIE)
+
+// the registers as they were written last time, Valid = 0 - unknown
+typedef struct{
+ uint8_t Valid;
+ uint32_t OPFCCR;
+ uint32_t OOR;
+ uint32_t OCOLR;
+ uint32_t FGPFCCR;
+ uint32_t FGOR;
+ uint32_t FGCOLR;
+ uint32_t BGPFCCR;
+ uint32_t BGOR;
+ uint32_t Clut;         // the palette in the foreground CLUT, 0 - none
+}D2D_Cache;
+
+static D2D_Cache Cache;
+
+static uint32_t OutputColor(uint32_t Color, uint32_t ColorMode);
+static uint32_t LayerPFC(uint32_t ColorMode, uint32_t AlphaMode, uint32_t Alpha);
+static void LoadClut(uint32_t Clut, uint32_t PFC);
+
+void D2D_Init(void (*Complete)(DMA2D_HandleTypeDef *), void (*Error)(DMA2D_HandleTypeDef *)){
+ hdma2d.Instance = DMA2D;
+ hdma2d.XferCpltCallback = Complete;
+ hdma2d.XferErrorCallback = Error;
+ D2D_Invalidate();
+}
+
+void D2D_Invalidate(void){
+ Cache.Valid = 0;
+}
+
+void D2D_Start(const DMA2D_Job * Job){
+ uint32_t reg;
+
+ if(!Cache.Valid){ // write everything once
+   Cache.OPFCCR = ~DMA2D->OPFCCR;
+   Cache.OOR = ~DMA2D->OOR;
+   Cache.OCOLR = ~DMA2D->OCOLR;
+   Cache.FGPFCCR = ~DMA2D->FGPFCCR;
+   Cache.FGOR = ~DMA2D->FGOR;
+   Cache.FGCOLR = ~DMA2D->FGCOLR;
+   Cache.BGPFCCR = ~DMA2D->BGPFCCR;
+   Cache.BGOR = ~DMA2D->BGOR;
+   Cache.Clut = 0;
+   Cache.Valid = 1;
+ }
+
+ if(Cache.OPFCCR != Job->ColorMode) DMA2D->OPFCCR = Cache.OPFCCR = Job->ColorMode;
+ if(Cache.OOR != Job->DstOffLine) DMA2D->OOR = Cache.OOR = Job->DstOffLine;
+
+ if(Job->Mode == DMA2D_R2M){
+   reg = OutputColor(Job->Src, Job->ColorMode);
+   if(Cache.OCOLR != reg) DMA2D->OCOLR = Cache.OCOLR = reg;
+ }
+ else{
+   reg = LayerPFC(Job->SrcColorMode, Job->AlphaMode, Job->Alpha);
+   if(((Job->SrcColorMode == CM_L8) || (Job->SrcColorMode == CM_L4)) && Job->Clut){
+     reg |= ((uint32_t)(Job->ClutSize - 1) << 8) & DMA2D_FGPFCCR_CS; // CCM = 0, ARGB8888 palette
+     if((Cache.Clut != Job->Clut) || (Cache.FGPFCCR != reg)) LoadClut(Job->Clut, reg);
+   }
+   if(Cache.FGPFCCR != reg) DMA2D->FGPFCCR = Cache.FGPFCCR = reg;
+   if(Cache.FGOR != Job->SrcOffLine) DMA2D->FGOR = Cache.FGOR = Job->SrcOffLine;
+   if((Job->SrcColorMode == CM_A8) || (Job->SrcColorMode == CM_A4)){
+     reg = Job->Alpha & 0x00FFFFFF;
+     if(Cache.FGCOLR != reg) DMA2D->FGCOLR = Cache.FGCOLR = reg;
+   }
+   DMA2D->FGMAR = Job->Src;
+   if(Job->Mode == DMA2D_M2M_BLEND){
+     reg = LayerPFC(Job->BackColorMode, DMA2D_NO_MODIF_ALPHA, 0xFF);
+     if(Cache.BGPFCCR != reg) DMA2D->BGPFCCR = Cache.BGPFCCR = reg;
+     if(Cache.BGOR != Job->BackOffLine) DMA2D->BGOR = Cache.BGOR = Job->BackOffLine;
+     DMA2D->BGMAR = Job->Back;
+   }
+ }
+ DMA2D->NLR = ((uint32_t)Job->xSize << 16) | Job->ySize;
+ DMA2D->OMAR = Job->Dst;
+ Mon_Dma2dJob(Job);
+ __DSB();      // the CPU stores to the frame are done before DMA2D starts
+ DMA2D->CR = Job->Mode | D2D_IT | DMA2D_CR_START;
+}
+
+uint8_t D2D_Busy(void){
+ return (DMA2D->CR & DMA2D_CR_START) != 0;
+}
+
+/*******************************************************************************
+                            Static Functions
+*******************************************************************************/
+
+/* the color of R2M is written in the output format, the same as HAL does */
+static uint32_t OutputColor(uint32_t Color, uint32_t ColorMode){
+ uint32_t a, r, g, b;
+
+ if(ColorMode == DMA2D_ARGB8888) return Color;
+ if(ColorMode == DMA2D_RGB888) return Color & 0x00FFFFFF;
+ a = Color >> 24;
+ r = (Color >> 16) & 0xFF;
+ g = (Color >> 8) & 0xFF;
+ b = Color & 0xFF;
+ if(ColorMode == DMA2D_RGB565) return ((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3);
+ if(ColorMode == DMA2D_ARGB1555) return ((a >> 7) << 15) | ((r >> 3) << 10) | ((g >> 3) << 5) | (b >> 3);
+ return ((a >> 4) << 12) | ((r >> 4) << 8) | ((g >> 4) << 4) | (b >> 4);  // DMA2D_ARGB4444
+}
+
+/* Automatic CLUT loading, a few hundred bus reads, it is done before the transfer
+   starts. It may be called from the transfer complete interrupt (Jobs_Next) */
+static void LoadClut(uint32_t Clut, uint32_t PFC){
+ DMA2D->FGCMAR = Clut;
+ DMA2D->FGPFCCR = PFC | DMA2D_FGPFCCR_START;
+ Cache.FGPFCCR = PFC;
+ Cache.Clut = Clut;
+ while(DMA2D->FGPFCCR & DMA2D_FGPFCCR_START);
+}
+
+static uint32_t LayerPFC(uint32_t ColorMode, uint32_t AlphaMode, uint32_t Alpha){
+ if((ColorMode == CM_A8) || (ColorMode == CM_A4))
+   return ColorMode | (AlphaMode << 16) | (Alpha & 0xFF000000);
+ return ColorMode | (AlphaMode << 16) | (Alpha << 24);
+}
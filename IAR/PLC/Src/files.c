@@ -1,5 +1,30 @@
 #include "files.h"
 #include "ff.h"
+#include "lcd.h"
+#include "ltdc.h"
+#include "perf.h"
+#include "dma2d_jobs.h"
+#include "glyphs.h"
+#include "number.h"
+#include <string.h>
+
+#define SHOT_LINE_BYTES         (DisplayWIDTH * 3)      // a multiple of 4, no padding
+#define SHOT_CHUNK              (SHOT_LINES * SHOT_LINE_BYTES)
+
+ShotStat ShotLast;
+
+static struct{
+ uint8_t  State;
+ uint16_t Line;         // the first line of the chunk which is written next
+ uint32_t Fence;        // its conversion
+ uint32_t Start;        // HAL_GetTick()
+ FATFS    Fs;
+ FIL      File;
+}Shot;
+
+static uint32_t Convert(uint16_t Line);
+static void Finish(uint8_t Result);
+static void PutLE(uint8_t * p, uint32_t Value, uint8_t Bytes);
 
 void WriteNewTextFileSD(uint8_t * buff, char const * NameOfFile, uint32_t NumberOfBytes){
 uint8_t res; //variable for return values
@@ -22,4 +47,153 @@ if (res == FR_OK){
  }
 }
 
+uint8_t Shot_Start(char const * NameOfFile){
+ uint8_t header[SHOT_HEADER];
+ UINT bw;
+
+ if(Shot.State == SHOT_BUSY) return 0;
+ ShotLast.Ms = 0;
+ ShotLast.MaxStep = 0;
+ ShotLast.Steps = 0;
+ Shot.Start = HAL_GetTick();
+ if(f_mount(&Shot.Fs, "0:", 1) != FR_OK){
+   Shot.State = ShotLast.Result = SHOT_ERROR;
+   return 1;
+ }
+ if(f_open(&Shot.File, NameOfFile, FA_WRITE | FA_CREATE_ALWAYS) != FR_OK){
+   Finish(SHOT_ERROR);
+   return 1;
+ }
+
+ // BITMAPFILEHEADER + BITMAPINFOHEADER, the height is negative: top-down lines,
+ // the same order as the frame, one DMA2D job per chunk
+ memset(header, 0, sizeof(header));
+ header[0] = 'B';
+ header[1] = 'M';
+ PutLE(header + 2, SHOT_HEADER + (uint32_t)SHOT_LINE_BYTES * DisplayHEIGHT, 4);
+ PutLE(header + 10, SHOT_HEADER, 4);
+ PutLE(header + 14, 40, 4);
+ PutLE(header + 18, DisplayWIDTH, 4);
+ PutLE(header + 22, (uint32_t)(-DisplayHEIGHT), 4);
+ PutLE(header + 26, 1, 2);
+ PutLE(header + 28, 24, 2);
+ PutLE(header + 34, (uint32_t)SHOT_LINE_BYTES * DisplayHEIGHT, 4);
+ PutLE(header + 38, 2835, 4);  // 72 dpi
+ PutLE(header + 42, 2835, 4);
+ if((f_write(&Shot.File, header, SHOT_HEADER, &bw) != FR_OK) || (bw != SHOT_HEADER)){
+   Finish(SHOT_ERROR);
+   return 1;
+ }
+ Shot.Line = 0;
+ Shot.Fence = Convert(0);
+ Shot.State = SHOT_BUSY;
+ return 1;
+}
+
+/* The chunk converted last time goes to the card while DMA2D converts the next one */
+void Shot_Step(void){
+ uint32_t start, bytes, next;
+ uint8_t * chunk;
+ UINT bw;
+
+ if(Shot.State != SHOT_BUSY) return;
+ if(HAL_GetTick() - Shot.Start > SHOT_TIMEOUT_MS){
+   Finish(SHOT_TIMEOUT);
+   return;
+ }
+ if(!Jobs_Done(Shot.Fence)) return;    // next time, the UI goes on
+
+ start = Perf_Cycles();
+ chunk = (uint8_t *)(SHOT_ADDRESS + ((Shot.Line / SHOT_LINES) & 1) * SHOT_CHUNK);
+ bytes = (uint32_t)((DisplayHEIGHT - Shot.Line < SHOT_LINES) ? DisplayHEIGHT - Shot.Line : SHOT_LINES) * SHOT_LINE_BYTES;
+ next = Shot.Line + SHOT_LINES;
+ if(next < DisplayHEIGHT) Shot.Fence = Convert(next);  // to the other half of the buffer
+ if((f_write(&Shot.File, chunk, bytes, &bw) != FR_OK) || (bw != bytes)){
+   Jobs_Wait(Shot.Fence);
+   Finish(SHOT_ERROR);
+   return;
+ }
+ Shot.Line = next;
+ ShotLast.Steps++;
+ if(Perf_Cycles() - start > ShotLast.MaxStep) ShotLast.MaxStep = Perf_Cycles() - start;
+ if(Shot.Line >= DisplayHEIGHT) Finish(SHOT_DONE);
+}
+
+uint8_t Shot_State(void){
+ return Shot.State;
+}
+
+uint32_t Font_Load(char const * NameOfFile, sFONT * Font, uint32_t Address){
+ FATFS fs;
+ FIL file;
+ UINT br;
+ uint8_t * p = (uint8_t *)Address;
+ uint32_t size = 0, count, bitmaps;
+
+ if(Shot.State == SHOT_BUSY) return 0;  // the card is mounted for it
+ if(f_mount(&fs, "0:", 1) != FR_OK) return 0;
+ if(f_open(&file, NameOfFile, FA_READ) == FR_OK){
+   size = f_size(&file);
+   if((size > FONT_FILE_HEADER) && (Address + size <= FONT_ADDRESS + FONT_AREA_SIZE) &&
+      (f_read(&file, p, size, &br) == FR_OK) && (br == size) && (memcmp(p, "FNT1", 4) == 0)){
+     count = p[10] | (p[11] << 8);
+     bitmaps = p[12] | (p[13] << 8) | (p[14] << 16) | ((uint32_t)p[15] << 24);
+     // the tables are indexed by code - ' ', all the codes must be there
+     if((p[8] == ' ') && (p[9] == 0) && (count == 256 - ' ') &&
+        (size == FONT_FILE_HEADER + count * sizeof(struct FONT_CHAR_INFO) + bitmaps)){
+       Glyph_Flush();
+       Num_Flush();
+       Font->tableInfo = (const struct FONT_CHAR_INFO *)(p + FONT_FILE_HEADER);
+       Font->table = p + FONT_FILE_HEADER + count * sizeof(struct FONT_CHAR_INFO);
+       Font->Height = p[6] | (p[7] << 8);
+       Font->rle = 0;
+       Font->Bpp = p[4];
+       Font->map = 0;
+       size = (size + 3) & ~3;
+     }
+     else size = 0;
+   }
+   else size = 0;
+   f_close(&file);
+ }
+ f_mount(NULL, "0:", 0);
+ return size;
+}
+
+/*******************************************************************************
+                            Static Functions
+*******************************************************************************/
 
+/* SHOT_LINES lines of the shown layer, ARGB8888 -> RGB888 (B, G, R in memory as BMP wants) */
+static uint32_t Convert(uint16_t Line){
+ DMA2D_Job job;
+ uint16_t lines = (DisplayHEIGHT - Line < SHOT_LINES) ? DisplayHEIGHT - Line : SHOT_LINES;
+
+ job.Mode = DMA2D_M2M_PFC;
+ job.Src = LTDC_LAYER(&hltdc, 0)->CFBAR + 4 * (uint32_t)Line * DisplayWIDTH;
+ job.Dst = SHOT_ADDRESS + ((Line / SHOT_LINES) & 1) * SHOT_CHUNK;
+ job.xSize = DisplayWIDTH;
+ job.ySize = lines;
+ job.SrcOffLine = 0;
+ job.DstOffLine = 0;
+ job.ColorMode = DMA2D_RGB888;
+ job.SrcColorMode = CM_ARGB8888;
+ job.AlphaMode = DMA2D_NO_MODIF_ALPHA;
+ job.Alpha = 0xFF;
+ job.Clut = 0;
+ return Jobs_Submit(&job);
+}
+
+static void Finish(uint8_t Result){
+ f_close(&Shot.File);
+ f_mount(NULL, "0:", 0);
+ ShotLast.Ms = HAL_GetTick() - Shot.Start;
+ Shot.State = ShotLast.Result = Result;
+}
+
+static void PutLE(uint8_t * p, uint32_t Value, uint8_t Bytes){
+ while(Bytes--){
+   *p++ = Value & 0xFF;
+   Value >>= 8;
+ }
+}
@@ -0,0 +1,50 @@
+#include "font_rle.h"
+#include <string.h>
+
+void FontRLE_Draw(const sFONT * Font, uint8_t Code, int16_t x, int16_t y, uint32_t Color, uint32_t BackColor, SpanFunc span){
+ const uint8_t * c = &Font->rle[FONT_INFO(Font, Code)->Offset];
+ const uint8_t * row;
+ int16_t wide = FONT_INFO(Font, Code)->Wide;
+ int16_t end = y + Font->Height;
+ int16_t pos;
+ uint8_t repeat, n, i;
+
+ if(!wide) return;      // no sign, no code for it
+ while(y < end){
+   repeat = *c++;
+   n = *c++;
+   row = c;
+   c += 2 * n;
+   for(; repeat; repeat--, y++){
+     pos = x;
+     for(i = 0; i < 2 * n; i += 2){
+       if(row[i] && (BackColor & 0xFF000000)) span(y, pos, pos + row[i] - 1, BackColor);
+       pos += row[i];
+       span(y, pos, pos + row[i + 1] - 1, Color);
+       pos += row[i + 1];
+     }
+     if((pos < x + wide) && (BackColor & 0xFF000000)) span(y, pos, x + wide - 1, BackColor);
+   }
+ }
+}
+
+void FontRLE_Expand(const sFONT * Font, uint8_t Code, uint8_t * dst){
+ const uint8_t * c = &Font->rle[FONT_INFO(Font, Code)->Offset];
+ uint16_t wide = FONT_INFO(Font, Code)->Wide;
+ uint16_t rows = 0, pos;
+ uint8_t repeat, n;
+
+ if(!wide) return;
+ while(rows < Font->Height){
+   repeat = *c++;
+   n = *c++;
+   memset(dst, 0, wide);
+   for(pos = 0; n; n--, c += 2){
+     pos += c[0];
+     memset(dst + pos, 0xFF, c[1]);
+     pos += c[1];
+   }
+   for(rows++, dst += wide; --repeat; rows++, dst += wide)  // the same row again
+     memcpy(dst, dst - wide, wide);
+ }
+}
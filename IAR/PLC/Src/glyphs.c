@@ -0,0 +1,78 @@
+#include "glyphs.h"
+#include "dma2d_jobs.h"
+#include "ltdc_mon.h"
+#include "font_rle.h"
+#include <string.h>
+
+#define GLYPH_MASK              (GLYPH_SLOTS - 1)
+
+uint32_t GlyphMisses = 0;
+uint32_t GlyphFlushes = 0;
+
+static GlyphEntry Table[GLYPH_SLOTS];
+static uint32_t Next = GLYPH_ADDRESS;  // the first free byte of the cache
+static uint16_t Used = 0;
+
+static uint32_t Hash(const sFONT * Font, uint16_t Code);
+static void Expand(GlyphEntry * Entry, const sFONT * Font, uint16_t Code);
+
+const GlyphEntry * Glyph_Get(const sFONT * Font, uint16_t Code){
+ uint32_t i, bytes;
+
+ for(i = Hash(Font, Code); Table[i].Font; i = (i + 1) & GLYPH_MASK)
+   if((Table[i].Font == Font) && (Table[i].Code == Code)) return &Table[i];
+
+ bytes = (uint32_t)FONT_INFO(Font, Code)->Wide * Font->Height;
+ if((Used >= GLYPH_SLOTS * 3 / 4) || (Next + bytes > GLYPH_ADDRESS + GLYPH_CACHE_SIZE)){
+   Glyph_Flush();
+   for(i = Hash(Font, Code); Table[i].Font; i = (i + 1) & GLYPH_MASK);
+ }
+ Expand(&Table[i], Font, Code);
+ return &Table[i];
+}
+
+void Glyph_Flush(void){
+ Jobs_WaitIdle();
+ memset(Table, 0, sizeof(Table));
+ Next = GLYPH_ADDRESS;
+ Used = 0;
+ GlyphFlushes++;
+}
+
+/*******************************************************************************
+                            Static Functions
+*******************************************************************************/
+
+static uint32_t Hash(const sFONT * Font, uint16_t Code){
+ return ((((uint32_t)Font >> 2) ^ Code) * 2654435761u) >> 16 & GLYPH_MASK;
+}
+
+/* the rows of the font are byte aligned, MSB first, 1, 2 or 4 bits per pixel, or run coded */
+static void Expand(GlyphEntry * Entry, const sFONT * Font, uint16_t Code){
+ const uint8_t * c = Font->table ? &Font->table[FONT_INFO(Font, Code)->Offset] : 0;
+ uint16_t wide = FONT_INFO(Font, Code)->Wide;
+ uint16_t bytesWide = ((wide - 1) / 8) + 1;
+ uint8_t * dst = (uint8_t *)Next;
+ uint16_t x, y;
+ uint8_t bpp = (Font->Bpp > 1) ? Font->Bpp : 1;
+ uint8_t top = (1 << bpp) - 1;
+
+ Entry->Font = Font;
+ Entry->Code = Code;
+ Entry->Wide = wide;
+ Entry->Address = Next;
+ if(Font->rle) FontRLE_Expand(Font, Code, dst);
+ else if(bpp == 1) for(y = 0; y < Font->Height; y++, c += bytesWide)
+   for(x = 0; x < wide; x++)
+     *dst++ = (c[x >> 3] & (0x80 >> (x & 7))) ? 0xFF : 0x00;
+ else if(bpp == 4) for(y = 0, bytesWide = (wide + 1) / 2; y < Font->Height; y++, c += bytesWide)
+   for(x = 0; x < wide; x++)    // the low nibble first, 255 / 15 = 17
+     *dst++ = ((c[x >> 1] >> ((x & 1) << 2)) & 0x0F) * 17;
+ else for(y = 0, bytesWide = ((wide * bpp - 1) / 8) + 1; y < Font->Height; y++, c += bytesWide)
+   for(x = 0; x < wide; x++)    // 255 / 3 = 85
+     *dst++ = ((c[(x * bpp) >> 3] >> (8 - bpp - ((x * bpp) & 7))) & top) * (255 / top);
+ MON_CPU_BYTES((uint32_t)wide * Font->Height);
+ Next = (Next + (uint32_t)wide * Font->Height + 3) & ~3;
+ Used++;
+ GlyphMisses++;
+}
@@ -6,8 +6,37 @@
 #include "ltdc.h"
 #include "calculations.h"
 #include "initial.h"
+#include "perf.h"
+#include "stroke.h"
+#include "dma2d_jobs.h"
+#include "tiles.h"
+#include "beam.h"
+#include "ltdc_mon.h"
+#include "transition.h"
+#include "rotate.h"
+#include "number.h"
+
+#define ABS(X)          ((X) > 0 ? (X) : -(X))
+#define MIN(A, B)       ((A) < (B) ? (A) : (B))
+#define MAX(A, B)       ((A) > (B) ? (A) : (B))
 
 static GUI_Object GUI_Objects[MAX_OBJECTS_Q];
+static ClipRect ObjBox[MAX_OBJECTS_Q];   // where the object was drawn last time, X0 > X1 - nowhere
+static uint32_t ObjSign[MAX_OBJECTS_Q];  // hash of everything the drawing depends on
+static uint8_t Tracked = 0;              // 0 - the boxes are not known, the whole screen is dirty
+static uint8_t Transition = TRANS_NONE;  // for the next Show_GUI()
+static TextLayout Layouts[MAX_OBJECTS_Q]; // of the TEXT_STRING objects
+static uint32_t LayoutSign[MAX_OBJECTS_Q]; // TextSign() the layout was made for, 0 - none
+static uint8_t NumShown[MAX_OBJECTS_Q][NUM_CELLS_MAX + 1]; // the text of the NUMBER_TYPE objects on the screen
+
+static void GUI_Track(void);
+static void RenderTo(uint32_t Address);
+static void ObjectBox(const GUI_Object * Obj, ClipRect * Box);
+static uint32_t ObjectSign(const GUI_Object * Obj);
+static void PointsBox(const Point * Points, uint16_t Count, int16_t Border, ClipRect * Box);
+static const TextLayout * TextLayoutOf(const GUI_Object * Obj);
+static uint32_t TextSign(const GUI_Object * Obj);
+static void NumberTrack(uint8_t i);
 
 
 void GUI_Free(void){
@@ -19,7 +48,9 @@ int i, j;
    GUI_Objects[i].z_index = 0;
    for (j = 0; j < MAX_PARAMS_Q; j++)
    GUI_Objects[i].params[j] = 0;
+   LayoutSign[i] = 0;
   }
+ Tracked = 0;   // a new screen
 return;
 }
 
@@ -62,6 +93,8 @@ return &NullObj;
 
 void GUI_Release(){  // create GUI 
   static int i, j;       //indexes
+  StrokeStyle Stroke;
+  const ClipRect * clip = LCD_GetClip();
 
  //if z-index == 0 eq hide
  for(j = 1; j < MAX_Z_INDEX; j++ ){
@@ -69,6 +102,8 @@ void GUI_Release(){  // create GUI
     for(i = 0; i < MAX_OBJECTS_Q; i++){
      if(GUI_Objects[i].z_index == j){
        if(GUI_Objects[i].existance){
+        if((ObjBox[i].X0 > clip->X1) || (ObjBox[i].X1 < clip->X0) ||
+           (ObjBox[i].Y0 > clip->Y1) || (ObjBox[i].Y1 < clip->Y0)) continue; // nothing to draw here
       LCD_SetColorPixel(GUI_Objects[i].color); // set the font, color of font and the color of line
         switch(GUI_Objects[i].type){
           case LINE_TYPE:
@@ -82,6 +117,11 @@ void GUI_Release(){  // create GUI
           case POLYGON_TYPE:
                    break;
           case TEXT_STRING:
+            LCD_SetBackColor(GUI_Objects[i].params[6]);
+            if(TextLayoutOf(&GUI_Objects[i])){        // the text is as it was, only the blits
+              LCD_DrawLayout(&Layouts[i], GUI_Objects[i].params[0], GUI_Objects[i].params[1]);
+              break;
+            }
             LCD_InitParams(0, GUI_Objects[i].params[6], GUI_Objects[i].color, (sFONT*) GUI_Objects[i].params[5]);
             LCD_DisplayStringAt(GUI_Objects[i].params[0], GUI_Objects[i].params[1], (uint8_t*)GUI_Objects[i].params[2], (Text_AlignModeTypdef) GUI_Objects[i].params[3], (uint8_t)GUI_Objects[i].params[4]);
                    break; 
@@ -118,6 +158,17 @@ void GUI_Release(){  // create GUI
              LCD_FillPolygon((pPoint)GUI_Objects[i].params[0], (uint16_t)GUI_Objects[i].params[1]); 
              RestorePoly((pPoint)(GUI_Objects[i].params[0]),(uint16_t)(GUI_Objects[i].params[1]));
               break;
+          case THICK_POLY_TYPE:
+             Stroke.Width = GUI_Objects[i].params[2];
+             Stroke.Join = GUI_Objects[i].params[3];
+             Stroke.Cap = GUI_Objects[i].params[4];
+             Stroke.MiterLimit = STROKE_MITER_LIMIT;
+             LCD_DrawThickPolyline((pPoint)GUI_Objects[i].params[0], (uint16_t)GUI_Objects[i].params[1], &Stroke);
+              break;
+          case NUMBER_TYPE:     // the text of GUI_Track(), the sprites of number.h
+             Num_Draw((const sFONT *)GUI_Objects[i].params[5], GUI_Objects[i].color, GUI_Objects[i].params[6], (uint8_t)GUI_Objects[i].params[4],
+                      GUI_Objects[i].params[0], GUI_Objects[i].params[1], NumShown[i], (Text_AlignModeTypdef)GUI_Objects[i].params[3]);
+              break;
         }
       } 
     }
@@ -140,11 +191,41 @@ uint8_t GUI_SetVisibility_Obj(GUI_Object* Obj, uint32_t Value){  // the alpha le
 return 0;
 }
 
+static uint32_t BackFence = 0;  // the background copy of the layer we draw on
+
 void Show_GUI(void){
   
- RCC->PLLSAICFGR =0x44003300;
+ Mon_Frame();       // SDRAM traffic of the last frame, less load if the LTDC had underruns
+ if(Transition != TRANS_NONE){ // the new screen comes by the LTDC, it is on the shown layer then
+   Trans_Run(Transition, TRANS_FRAMES, RenderTo);
+   Transition = TRANS_NONE;
+   GUI_InvalidateAll();
+   return;
+ }
 
+  GUI_Track();      // the boxes of the objects, the changed ones make their tiles dirty
+  LCD_ClipReset();  // the whole layer, drop whatever was pushed and not popped
+  if(Beam_Active()){ // one layer, it is shown while we draw it
+    Perf_Start(&PerfRelease);
+    if(!Beam_Render(SDRAM_BANK_ADDR + LAYER_BACK_OFFSET, ProjectionLayerAddress[LayerOfView], GUI_Release))
+      GUI_SetBeamMode(0);  // too slow for the beam, back to two layers
+    Perf_Stop(&PerfRelease);
+    return;
+  }
+#if GUI_ROTATION
+  Perf_Start(&PerfRelease);
+  Rot_Render(SDRAM_BANK_ADDR + LAYER_BACK_OFFSET, ProjectionLayerAddress[LayerOfView], GUI_Release, GUI_ROTATION);
+  Perf_Stop(&PerfRelease);
+#elif GUI_TILED
+  Perf_Start(&PerfRelease);
+  Tiles_Render(SDRAM_BANK_ADDR + LAYER_BACK_OFFSET, ProjectionLayerAddress[LayerOfView], GUI_Release);
+  Perf_Stop(&PerfRelease);
+#else
+  Jobs_Wait(BackFence);  // the copy ran while Run_GUI() was working
+  Perf_Start(&PerfRelease);
   GUI_Release(); 
+  Perf_Stop(&PerfRelease);
+#endif
   
  if(!LayerOfView){
      HAL_LTDC_SetAddress(&hltdc, SDRAM_BANK_ADDR + LAYER_1_OFFSET, 0); // set the present layer address
@@ -156,10 +237,317 @@ void Show_GUI(void){
  LayerOfView++;
  LayerOfView %= 2;
 // FillImageSoft(SDRAM_BANK_ADDR + LAYER_BACK_OFFSET, ProjectionLayerAddress[LayerOfView], 800, 480);  
- _HW_Fill_Display_From_Mem(SDRAM_BANK_ADDR + LAYER_BACK_OFFSET, ProjectionLayerAddress[LayerOfView]);
-            
-
+#if !GUI_TILED && !GUI_ROTATION
+ BackFence = Jobs_Copy(SDRAM_BANK_ADDR + LAYER_BACK_OFFSET, ProjectionLayerAddress[LayerOfView], DisplayWIDTH, DisplayHEIGHT, 0, 0);
+#endif
             
 }  
 
+/* 1 - draw to the layer which is shown, band by band behind the LTDC (beam.h),
+   0 - draw to the hidden layer and flip */
+void GUI_SetBeamMode(uint8_t On){
+ if(On == Beam_Active()) return;
+ Jobs_WaitIdle();
+ if(On){
+   LayerOfView = (hltdc.LayerCfg[0].FBStartAdress == ProjectionLayerAddress[0]) ? 0 : 1;
+   Beam_Start();
+ }
+ else{
+   Beam_Stop();
+   LayerOfView ^= 1;   // the shown layer stays till the next flip
+   BackFence = Jobs_Copy(SDRAM_BANK_ADDR + LAYER_BACK_OFFSET, ProjectionLayerAddress[LayerOfView], DisplayWIDTH, DisplayHEIGHT, 0, 0);
+   GUI_InvalidateAll(); // the tiles of this layer are old
+ }
+}
+
+/* the next Show_GUI() animates the change of the screen, TRANS_FADE ... of transition.h */
+void GUI_Transition(uint8_t Type){
+ Transition = Type;
+}
+
+void GUI_Invalidate(int16_t x1, int16_t y1, int16_t x2, int16_t y2){
+#if GUI_ROTATION
+ Rot_Invalidate(x1, y1, x2, y2);
+#else
+ Tiles_Invalidate(x1, y1, x2, y2);
+#endif
+}
+
+void GUI_InvalidateAll(void){
+#if GUI_ROTATION
+ Rot_InvalidateAll();
+#else
+ Tiles_InvalidateAll();
+#endif
+}
+
+/*******************************************************************************
+                            Static Functions
+*******************************************************************************/
+
+/* The whole screen to a buffer which is not a layer we flip */
+static void RenderTo(uint32_t Address){
+ GUI_Track();
+ LCD_ClipReset();
+ Jobs_Wait(Jobs_Copy(SDRAM_BANK_ADDR + LAYER_BACK_OFFSET, Address, DisplayWIDTH, DisplayHEIGHT, 0, 0));
+ LCD_SetSurface(Address, DisplayWIDTH, 0, 0);
+ GUI_Release();
+ LCD_ResetSurface();
+ Jobs_WaitIdle();
+}
+
+/* Compares every object with the last frame, the old and the new places of a
+   changed object are invalidated. The sprites of the numbers are drawn here,
+   before any surface of a tile or a band is set */
+static void GUI_Track(void){
+ ClipRect box;
+ uint32_t sign;
+ uint8_t i;
+
+ if(!Tracked) GUI_InvalidateAll();
+ for(i = 0; i < MAX_OBJECTS_Q; i++){
+   sign = ObjectSign(&GUI_Objects[i]);
+   if(Tracked && (sign == ObjSign[i])){
+     if(GUI_Objects[i].type == NUMBER_TYPE) NumberTrack(i);
+     continue;
+   }
+   ObjectBox(&GUI_Objects[i], &box);
+   if(Tracked){
+     GUI_Invalidate(ObjBox[i].X0, ObjBox[i].Y0, ObjBox[i].X1, ObjBox[i].Y1);
+     GUI_Invalidate(box.X0, box.Y0, box.X1, box.Y1);
+   }
+   ObjBox[i] = box;
+   ObjSign[i] = sign;
+   if(GUI_Objects[i].type == NUMBER_TYPE){
+     NumShown[i][0] = 0;
+     NumberTrack(i);
+   }
+ }
+ Tracked = 1;
+}
+
+/* The pixels the object can touch, a bit more is fine, less is not */
+static void ObjectBox(const GUI_Object * Obj, ClipRect * Box){
+ const uint32_t * p = Obj->params;
+ const sFONT * font;
+ const uint8_t * text;
+ const TextLayout * layout;
+ const Point * points;
+ const ImageInfo * image;
+ uint8_t digits[NUM_CELLS_MAX + 1];
+ int32_t width = 0, r, d;
+ uint16_t i;
+
+ Box->X0 = 1;   // nothing
+ Box->X1 = 0;
+ Box->Y0 = 1;
+ Box->Y1 = 0;
+ if(!Obj->existance || (Obj->z_index < 1) || (Obj->z_index >= MAX_Z_INDEX)) return;
+
+ switch(Obj->type){
+   case LINE_TYPE:
+   case FILLED_RECT_TYPE:
+   case RECT_TYPE:
+     Box->X0 = MIN((int16_t)p[0], (int16_t)p[2]);
+     Box->X1 = MAX((int16_t)p[0], (int16_t)p[2]);
+     Box->Y0 = MIN((int16_t)p[1], (int16_t)p[3]);
+     Box->Y1 = MAX((int16_t)p[1], (int16_t)p[3]);
+     break;
+   case VERTICAL_LINE_TYPE:
+   case POLYGON_TYPE:
+     break;     // not drawn
+   case HORIZONTAL_LINE_TYPE:
+     Box->X0 = MIN((int16_t)p[1], (int16_t)p[2]);
+     Box->X1 = MAX((int16_t)p[1], (int16_t)p[2]);
+     Box->Y0 = Box->Y1 = (int16_t)p[0];
+     break;
+   case TEXT_STRING:    // the same layout as LCD_DisplayStringAt()
+     font = (const sFONT *)p[5];
+     if((layout = TextLayoutOf(Obj)) != 0){
+       Box->X0 = (int16_t)p[0] + layout->DX;
+       Box->Y0 = (int16_t)p[1] + layout->DY;
+       Box->X1 = Box->X0 + layout->Width;
+       Box->Y1 = Box->Y0 + font->Height - 1;
+       break;
+     }
+     for(text = (const uint8_t *)p[2]; *text; text++)
+       width += FONT_INFO(font, *text)->Wide + (uint8_t)p[4];
+     width -= (uint8_t)p[4];
+     Box->X0 = (int16_t)p[0];
+     Box->Y0 = (int16_t)p[1];
+     if(p[3] == CENTER_MODE){
+       Box->X0 -= width / 2;
+       Box->Y0 -= font->Height / 2;
+     }
+     else if(p[3] == RIGHT_MODE) Box->X0 -= width;
+     Box->X1 = Box->X0 + width;
+     Box->Y1 = Box->Y0 + font->Height - 1;
+     break;
+   case NUMBER_TYPE:    // the width doesn't depend on the value
+     font = (const sFONT *)p[5];
+     Num_Format(digits, 0, (uint8_t)p[7], (uint8_t)p[8], (Text_AlignModeTypdef)p[3]);
+     Box->X0 = (int16_t)p[0] + Num_CellX(font, (uint8_t)p[4], digits, 0, (Text_AlignModeTypdef)p[3]);
+     Box->X1 = (int16_t)p[0] + Num_CellX(font, (uint8_t)p[4], digits, NUM_CELLS_MAX, (Text_AlignModeTypdef)p[3]) - 1;
+     Box->Y0 = (int16_t)p[1];
+     if(p[3] == CENTER_MODE) Box->Y0 -= font->Height / 2;
+     Box->Y1 = Box->Y0 + font->Height - 1;
+     break;
+   case CIRCLE_TYPE:
+   case FILLED_CIRCLE_TYPE:
+     Box->X0 = (int16_t)p[0] - (int16_t)p[2] - 1;
+     Box->X1 = (int16_t)p[0] + (int16_t)p[2] + 1;
+     Box->Y0 = (int16_t)p[1] - (int16_t)p[2] - 1;
+     Box->Y1 = (int16_t)p[1] + (int16_t)p[2] + 1;
+     break;
+   case IMAGE_FAST_FILL:
+   case IMAGE_WITH_TRANSP:
+     image = (const ImageInfo *)p[0];
+     Box->X0 = (int16_t)p[1];
+     Box->Y0 = (int16_t)p[2];
+     Box->X1 = Box->X0 + image->xsize - 1;
+     Box->Y1 = Box->Y0 + image->ysize - 1;
+     break;
+   case FILLED_TRIANGLE:  // x1, x2, x3, y1, y2, y3
+     Box->X0 = MIN(MIN((int16_t)p[0], (int16_t)p[1]), (int16_t)p[2]);
+     Box->X1 = MAX(MAX((int16_t)p[0], (int16_t)p[1]), (int16_t)p[2]);
+     Box->Y0 = MIN(MIN((int16_t)p[3], (int16_t)p[4]), (int16_t)p[5]);
+     Box->Y1 = MAX(MAX((int16_t)p[3], (int16_t)p[4]), (int16_t)p[5]);
+     break;
+   case FILLED_POLY:
+   case POLY_TYPE:
+     PointsBox((const Point *)p[0], (uint16_t)p[1], 0, Box);
+     break;
+   case THICK_POLY_TYPE:
+     PointsBox((const Point *)p[0], (uint16_t)p[1], (int16_t)p[2], Box);
+     break;
+   case ROTATING_FILLED_POLY_TYPE:  // any angle: the circle around the origin
+     points = (const Point *)p[0];
+     r = 0;
+     for(i = 0; i < (uint16_t)p[1]; i++){
+       d = ABS(points[i].X - ((const Point *)p[2])->X) + ABS(points[i].Y - ((const Point *)p[2])->Y);
+       if(d > r) r = d;
+     }
+     Box->X0 = ((const Point *)p[2])->X - r - 1;
+     Box->X1 = ((const Point *)p[2])->X + r + 1;
+     Box->Y0 = ((const Point *)p[2])->Y - r - 1;
+     Box->Y1 = ((const Point *)p[2])->Y + r + 1;
+     break;
+   default:     // unknown, the whole screen
+     Box->X0 = 0;
+     Box->X1 = DisplayWIDTH - 1;
+     Box->Y0 = 0;
+     Box->Y1 = DisplayHEIGHT - 1;
+     break;
+ }
+}
+
+/* FNV-1a of the object and of the data it points to: the text, the points */
+static uint32_t ObjectSign(const GUI_Object * Obj){
+ const uint8_t * data;
+ uint32_t h = 2166136261u, size = 0;
+ uint8_t i;
+
+ for(data = (const uint8_t *)Obj, i = 0; i < sizeof(GUI_Object); i++)
+   h = (h ^ data[i]) * 16777619u;
+ if(!Obj->existance) return h;
+
+ switch(Obj->type){
+   case TEXT_STRING:
+     for(data = (const uint8_t *)Obj->params[2]; *data; data++)
+       h = (h ^ *data) * 16777619u;
+     return h;
+   case NUMBER_TYPE:    // the value is followed by NumberTrack(), cell by cell
+     return h;
+   case FILLED_POLY:
+   case POLY_TYPE:
+   case THICK_POLY_TYPE:
+   case ROTATING_FILLED_POLY_TYPE:
+     size = Obj->params[1] * sizeof(Point);
+     break;
+ }
+ for(data = (const uint8_t *)Obj->params[0]; size; size--)
+   h = (h ^ *data++) * 16777619u;
+ if(Obj->type == ROTATING_FILLED_POLY_TYPE)
+   for(data = (const uint8_t *)Obj->params[2], i = 0; i < sizeof(Point); i++)
+     h = (h ^ data[i]) * 16777619u;
+ return h;
+}
+
+/* The layout of a TEXT_STRING object, made again only when the text, the font, the
+   alignment or the kerning has changed. 0 - the text is too long for a layout */
+static const TextLayout * TextLayoutOf(const GUI_Object * Obj){
+ uint8_t i = Obj - GUI_Objects;
+ uint32_t sign = TextSign(Obj);
+
+ if(LayoutSign[i] != sign){
+   LayoutSign[i] = 0;
+   if(!LCD_LayoutString(&Layouts[i], (sFONT *)Obj->params[5], (const uint8_t *)Obj->params[2],
+                        (Text_AlignModeTypdef)Obj->params[3], (uint8_t)Obj->params[4])) return 0;
+   LayoutSign[i] = sign;
+ }
+ return &Layouts[i];
+}
+
+/* FNV-1a of the text and of the parameters of its layout, never 0 */
+static uint32_t TextSign(const GUI_Object * Obj){
+ const uint8_t * text;
+ uint32_t h = 2166136261u;
+
+ for(text = (const uint8_t *)Obj->params[2]; *text; text++)
+   h = (h ^ *text) * 16777619u;
+ h = (h ^ Obj->params[3]) * 16777619u;
+ h = (h ^ (uint8_t)Obj->params[4]) * 16777619u;
+ h = (h ^ Obj->params[5]) * 16777619u;
+ return h ? h : 1;
+}
+
+/* The new text of a NUMBER_TYPE object, only the cells which show another
+   character are invalidated, not the whole number. The cells keep their places
+   unless the narrow point has moved (LEFT_MODE, CENTER_MODE): then the cells
+   from the first to the last changed one, they cover the same pixels before and after */
+static void NumberTrack(uint8_t i){
+ const uint32_t * p = GUI_Objects[i].params;
+ const sFONT * font = (const sFONT *)p[5];
+ Text_AlignModeTypdef mode = (Text_AlignModeTypdef)p[3];
+ uint8_t text[NUM_CELLS_MAX + 1], k, first = 0xFF, last = 0, moved = 0;
+
+ if(ObjBox[i].X0 > ObjBox[i].X1) return;        // not drawn
+ Num_Prepare(font, GUI_Objects[i].color, p[6], (uint8_t)p[4]);   // again after a Num_Flush()
+ Num_Format(text, *(const int32_t *)p[2], (uint8_t)p[7], (uint8_t)p[8], mode);
+ if(NumShown[i][0]){    // else the whole box is invalidated already
+   for(k = 0; text[k]; k++)
+     if((text[k] == '.') != (NumShown[i][k] == '.')) moved = 1;
+   for(k = 0; text[k]; k++){
+     if(text[k] == NumShown[i][k]) continue;
+     if(first == 0xFF) first = k;
+     last = k;
+     if(!moved)
+       GUI_Invalidate((int16_t)p[0] + Num_CellX(font, (uint8_t)p[4], text, k, mode), ObjBox[i].Y0,
+                      (int16_t)p[0] + Num_CellX(font, (uint8_t)p[4], text, k + 1, mode) - 1, ObjBox[i].Y1);
+   }
+   if(moved && (first != 0xFF))
+     GUI_Invalidate((int16_t)p[0] + Num_CellX(font, (uint8_t)p[4], text, first, mode), ObjBox[i].Y0,
+                    (int16_t)p[0] + Num_CellX(font, (uint8_t)p[4], text, last + 1, mode) - 1, ObjBox[i].Y1);
+ }
+ for(k = 0; k <= NUM_CELLS_MAX; k++) NumShown[i][k] = text[k];
+}
+
+static void PointsBox(const Point * Points, uint16_t Count, int16_t Border, ClipRect * Box){
+ uint16_t i;
+
+ if(!Count) return;
+ Box->X0 = Box->X1 = Points[0].X;
+ Box->Y0 = Box->Y1 = Points[0].Y;
+ for(i = 1; i < Count; i++){
+   if(Points[i].X < Box->X0) Box->X0 = Points[i].X;
+   if(Points[i].X > Box->X1) Box->X1 = Points[i].X;
+   if(Points[i].Y < Box->Y0) Box->Y0 = Points[i].Y;
+   if(Points[i].Y > Box->Y1) Box->Y1 = Points[i].Y;
+ }
+ Box->X0 -= Border + 1;
+ Box->X1 += Border + 1;
+ Box->Y0 -= Border + 1;
+ Box->Y1 += Border + 1;
+}
+
 
@@ -8,6 +8,8 @@ SDRAM_Initialization_Sequence(&hsdram1);
   pMediumQueueIni();            // fill the medium queue by Zero functions
   pFastQueueIni();              // fill the fast queue by Zero functions
   pSlowQueueIni();              // fill the slow queue by Zero functions
+  Perf_Init();                  // DWT cycle counter for the frame time
+  Jobs_Init();                  // DMA2D job ring callbacks
   
   NAND_readId();
   
@@ -29,8 +31,15 @@ SDRAM_Initialization_Sequence(&hsdram1);
  // Switch_Camera(1);
   MX_LTDC_Init();
   LCD_Init();
+  Mon_Init();                   // pixel clock for MON_REFRESH_DEFAULT
+#ifdef BENCHMARK_GRAPHICS
+  Benchmark_Run();
+#endif
   LCD_SetLight(7);
   Load_GUI_0(); 
+#if GUI_BEAM_MODE
+  GUI_SetBeamMode(1);           // one framebuffer, falls back to two if it is too slow
+#endif
   HAL_NVIC_EnableIRQ(EXTI9_5_IRQn);
   LED_control(1);
  
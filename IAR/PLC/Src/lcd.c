@@ -6,18 +6,42 @@
 #include "core.h"
 #include "variables.h"
 #include "fonts.h"
+#include "spans.h"
+#include "pixel_ops.h"
+#include "dma2d_jobs.h"
+#include "ltdc_mon.h"
+#include "glyphs.h"
+#include "font_rle.h"
+#include "text.h"
 
 #define POLY_X(Z)              ((int32_t)((Points + Z)->X))
 #define POLY_Y(Z)              ((int32_t)((Points + Z)->Y))      
 
 #define ABS(X)  ((X) > 0 ? (X) : -(X))      
+#define KEY_CHUNK       64      // pixels of an RGB888 line keyed at once by Pix_ColorKey()
     
 /* Default LCD configuration with LCD Layer 1 */
 static uint32_t            ActiveLayer = 0;
-static _FourBytesU dataIMG;
 static LCD_DrawPropTypeDef DrawProp[MAX_LAYER_NUMBER];
 static uint32_t LayerIndex = 0;
-static void DrawChar(uint16_t Xpos, uint16_t Ypos, const uint8_t *c, uint16_t SignWide);
+static ClipRect ClipStack[CLIP_STACK_DEPTH];
+static uint8_t ClipDepth = 0;
+static ClipRect Clip = {0, 0, DisplayWIDTH - 1, DisplayHEIGHT - 1}; // top of the stack, always inside the layer
+static DrawSurface Surface = {0, DisplayWIDTH, 0, 0};
+static uint8_t GlyphCache = 1;
+/* the address of the pixel x, y of the screen on the drawing surface */
+#define SURFACE_ADDRESS(x, y)  ((Surface.Address ? Surface.Address : ProjectionLayerAddress[LayerOfView]) + \
+                               4 * ((int32_t)((y) - Surface.OriginY) * Surface.Pitch + (int32_t)((x) - Surface.OriginX)))
+/* CPU bytes written to the layer, a tile buffer is not in SDRAM */
+#define SURFACE_WRITES(n)      ((void)(Surface.Address ? 0 : MON_CPU_BYTES(n)))
+static void DrawChar(int16_t Xpos, int16_t Ypos, const uint8_t *c, uint16_t SignWide);
+static uint32_t DrawGlyph(int16_t Xpos, int16_t Ypos, uint8_t Ascii);
+static uint32_t DrawA4(int16_t Xpos, int16_t Ypos, uint8_t Ascii);
+static uint32_t PutChar(int16_t Xpos, int16_t Ypos, uint8_t Ascii);
+static uint8_t ClipOut(int16_t x1, int16_t y1, int16_t x2, int16_t y2);
+static uint8_t ClipImage(ImageInfo * Image, int16_t * x, int16_t * y, uint16_t * w, uint16_t * h, uint32_t * src);
+static void FillImageSoftOffLine(uint32_t ImageAddress, uint32_t address, uint32_t xSize, uint32_t ySize, uint32_t SrcOffLine, uint32_t DstPitch);
+static void FillImageTranspL8(ImageInfo * Image, uint32_t src, uint32_t address, uint16_t w, uint16_t h);
 static void LL_FillBuffer(uint32_t LayerIndex, void *pDst, uint32_t xSize, uint32_t ySize, uint32_t OffLine, uint32_t ColorIndex);
 
 uint32_t LCD_GetXSize(void)
@@ -176,6 +200,93 @@ sFONT *LCD_GetFont(void)
   return DrawProp[ActiveLayer].pFont;
 }
 
+/**
+  * @brief  Pushes a clip rectangle, it is intersected with the current one.
+  * @param  x1, y1: top left corner, inclusive
+  * @param  x2, y2: bottom right corner, inclusive
+  * @retval LCD_OK or LCD_ERROR if the stack is full
+  */
+uint8_t LCD_ClipPush(int16_t x1, int16_t y1, int16_t x2, int16_t y2)
+{
+  if(ClipDepth >= CLIP_STACK_DEPTH) return LCD_ERROR;
+  
+  ClipStack[ClipDepth++] = Clip;
+  if(x1 > Clip.X0) Clip.X0 = x1;
+  if(y1 > Clip.Y0) Clip.Y0 = y1;
+  if(x2 < Clip.X1) Clip.X1 = x2;
+  if(y2 < Clip.Y1) Clip.Y1 = y2;   // X0 > X1 or Y0 > Y1 means nothing is drawn
+  return LCD_OK;
+}
+
+/* the same for a surface which is not the screen (bigger), the clip is not cut by the screen */
+uint8_t LCD_ClipPushSurface(int16_t x1, int16_t y1, int16_t x2, int16_t y2)
+{
+  if(ClipDepth >= CLIP_STACK_DEPTH) return LCD_ERROR;
+  
+  ClipStack[ClipDepth++] = Clip;
+  Clip.X0 = x1;
+  Clip.Y0 = y1;
+  Clip.X1 = x2;
+  Clip.Y1 = y2;
+  return LCD_OK;
+}
+
+void LCD_ClipPop(void)
+{
+  if(ClipDepth) Clip = ClipStack[--ClipDepth];
+}
+
+void LCD_ClipReset(void)
+{
+  ClipDepth = 0;
+  Clip.X0 = 0;
+  Clip.Y0 = 0;
+  Clip.X1 = DisplayWIDTH - 1;
+  Clip.Y1 = DisplayHEIGHT - 1;
+}
+
+const ClipRect* LCD_GetClip(void)
+{
+  return &Clip;
+}
+
+/**
+  * @brief  Sends the drawing to a buffer which holds the screen rectangle
+  *         starting at OriginX, OriginY, for example a tile of the tiled renderer.
+  * @param  Address: the pixel OriginX, OriginY, ARGB8888
+  * @param  Pitch: pixels per line of the buffer
+  * @retval None
+  */
+void LCD_SetSurface(uint32_t Address, uint16_t Pitch, int16_t OriginX, int16_t OriginY)
+{
+  Surface.Address = Address;
+  Surface.Pitch = Pitch;
+  Surface.OriginX = OriginX;
+  Surface.OriginY = OriginY;
+}
+
+/* back to the layer we draw on now */
+void LCD_ResetSurface(void)
+{
+  LCD_SetSurface(0, DisplayWIDTH, 0, 0);
+}
+
+uint32_t LCD_SurfaceAddress(int16_t x, int16_t y)
+{
+  return SURFACE_ADDRESS(x, y);
+}
+
+uint16_t LCD_SurfacePitch(void)
+{
+  return Surface.Pitch;
+}
+
+/* 1 - the box is out of the clip and the shape inside it can be skipped */
+static uint8_t ClipOut(int16_t x1, int16_t y1, int16_t x2, int16_t y2)
+{
+  return (x1 > Clip.X1) || (x2 < Clip.X0) || (y1 > Clip.Y1) || (y2 < Clip.Y0);
+}
+
 uint32_t LCD_ReadPixel(uint16_t Xpos, uint16_t Ypos)
 {
   uint32_t ret = 0;
@@ -224,15 +335,25 @@ void LCD_ClearStringLine(uint32_t Line)
   LCD_SetTextColor(DrawProp[ActiveLayer].TextColor);  
 }
 
-void LCD_DisplayChar(uint16_t Xpos, uint16_t Ypos, uint8_t Ascii)
+void LCD_DisplayChar(int16_t Xpos, int16_t Ypos, uint8_t Ascii)
+{
+  uint32_t fence = PutChar(Xpos, Ypos, Ascii);
+
+  if(fence) Jobs_Wait(fence);
+}
+
+void LCD_SetGlyphCache(uint8_t On)
 {
-  DrawChar(Xpos, Ypos, &DrawProp[ActiveLayer].pFont->table[DrawProp[ActiveLayer].pFont->tableInfo[(Ascii-' ')].Offset],(uint16_t)DrawProp[ActiveLayer].pFont->tableInfo[(Ascii-' ')].Wide);
+  Jobs_WaitIdle();
+  GlyphCache = On;
 }
 
 void LCD_DisplayStringAt(uint16_t Xpos, uint16_t Ypos, uint8_t *Text, Text_AlignModeTypdef Mode, uint8_t Kerning )
 {
-  uint32_t ref_column = 1, i = 0;
+  int32_t  ref_column = 1;
+  uint32_t i = 0;
   uint32_t size = 0, xsize = 0; 
+  uint32_t fence = 0, f;
   uint8_t  *ptr = Text;
   
   /* Get the text size */
@@ -241,14 +362,14 @@ void LCD_DisplayStringAt(uint16_t Xpos, uint16_t Ypos, uint8_t *Text, Text_Align
   /* Characters number per line */
   if(Mode)
   for(i = 0; i < size; i++)
-  xsize += DrawProp[ActiveLayer].pFont->tableInfo[(Text[i]-' ')].Wide + Kerning;
+  xsize += FONT_INFO(DrawProp[ActiveLayer].pFont, Text[i])->Wide + Kerning;
   xsize -= Kerning;
   
   switch (Mode)
   {
   case CENTER_MODE:
     {
-      ref_column = Xpos - xsize/2;
+      ref_column = (int32_t)Xpos - (int32_t)(xsize/2);
       Ypos -= (DrawProp[ActiveLayer].pFont->Height)/2;
       break;
     }
@@ -259,7 +380,7 @@ void LCD_DisplayStringAt(uint16_t Xpos, uint16_t Ypos, uint8_t *Text, Text_Align
     }
   case RIGHT_MODE:
     {
-      ref_column = Xpos - xsize;
+      ref_column = (int32_t)Xpos - (int32_t)xsize;
       break;
     }    
   default:
@@ -269,23 +390,71 @@ void LCD_DisplayStringAt(uint16_t Xpos, uint16_t Ypos, uint8_t *Text, Text_Align
     }
   }
   
-  /* Check that the Start column is located in the screen */
-  if ((ref_column < 1) || (ref_column >= 0x8000))
-  {
-    ref_column = 1;
-  }
-
-  /* Send the string character by character on LCD */
+  /* Send the string character by character on LCD, the clipping cuts the signs out of the screen */
   while (*Text != 0)
   {
+    if(ref_column > Clip.X1) break; // the rest of the string is out of the clip
     /* Display one character on LCD */    /* Decrement the column position by 16 */
     
-    LCD_DisplayChar(ref_column, Ypos, *Text);
-    ref_column += DrawProp[ActiveLayer].pFont->tableInfo[(*Text-' ')].Wide + (uint16_t)Kerning; // display with kerning
+    f = PutChar(ref_column, Ypos, *Text);
+    if(f) fence = f;
+    ref_column += FONT_INFO(DrawProp[ActiveLayer].pFont, *Text)->Wide + (uint16_t)Kerning; // display with kerning
     /* Point on the next character */
     Text++;
     i++;
   }  
+  if(fence) Jobs_Wait(fence);   // the CPU may draw over the text after it
+}
+
+/* the same measure and alignment as LCD_DisplayStringAt(), kept for LCD_DrawLayout() */
+uint8_t LCD_LayoutString(TextLayout * Layout, sFONT * Font, const uint8_t *Text, Text_AlignModeTypdef Mode, uint8_t Kerning)
+{
+  int32_t x = 0;
+  uint8_t n;
+
+  for(n = 0; Text[n]; n++){
+    if(n == TEXT_LAYOUT_CHARS) return 0;
+    Layout->Codes[n] = Text[n];
+    Layout->X[n] = x;
+    x += FONT_INFO(Font, Text[n])->Wide + Kerning;
+  }
+  Layout->Font = Font;
+  Layout->Count = n;
+  Layout->Width = x - Kerning;
+  Layout->DX = 0;
+  Layout->DY = 0;
+  if(Mode == CENTER_MODE){
+    Layout->DX = -(int16_t)((uint32_t)Layout->Width / 2);
+    Layout->DY = -(int16_t)(Font->Height / 2);
+  }
+  else if(Mode == RIGHT_MODE) Layout->DX = -Layout->Width;
+  return 1;
+}
+
+/* no measure, no lookup of the widths, the signs of the layout at their places */
+void LCD_DrawLayout(const TextLayout * Layout, int16_t Xpos, int16_t Ypos)
+{
+  uint32_t fence = 0, f;
+  uint8_t i;
+
+  DrawProp[ActiveLayer].pFont = (sFONT *)Layout->Font;
+  Xpos += Layout->DX;
+  Ypos += Layout->DY;
+  for(i = 0; i < Layout->Count; i++){
+    if(Xpos + Layout->X[i] > Clip.X1) break;
+    f = PutChar(Xpos + Layout->X[i], Ypos, Layout->Codes[i]);
+    if(f) fence = f;
+  }
+  if(fence) Jobs_Wait(fence);
+}
+
+/* the string is folded to the codes of the fonts first, then drawn as usual */
+void LCD_DisplayStringAtUTF8(uint16_t Xpos, uint16_t Ypos, const uint8_t *Text, Text_AlignModeTypdef Mode, uint8_t Kerning)
+{
+  uint8_t codes[TEXT_MAX];
+
+  Text_FromUTF8(codes, Text, sizeof(codes));
+  LCD_DisplayStringAt(Xpos, Ypos, codes, Mode, Kerning);
 }
 
 void LCD_DisplayStringAtLine(uint16_t Line, uint8_t *ptr, uint8_t kerning)
@@ -293,9 +462,16 @@ void LCD_DisplayStringAtLine(uint16_t Line, uint8_t *ptr, uint8_t kerning)
   LCD_DisplayStringAt(0, LINE(Line), ptr, LEFT_MODE, kerning);
 }
 
-void LCD_DrawHLine(uint16_t Xpos, uint16_t Ypos, uint16_t Length)
+void LCD_DrawHLine(int16_t Xpos, int16_t Ypos, uint16_t Length)
 {
   uint32_t  Xaddress = 0;
+  int16_t   Xend = Xpos + Length - 1;
+  
+  if((Ypos < Clip.Y0) || (Ypos > Clip.Y1)) return;
+  if(Xpos < Clip.X0) Xpos = Clip.X0;
+  if(Xend > Clip.X1) Xend = Clip.X1;
+  if(Xend < Xpos) return;
+  Length = Xend - Xpos + 1;
   
   /* Get the line address */
   if(hltdc.LayerCfg[ActiveLayer].PixelFormat == LTDC_PIXEL_FORMAT_RGB565)
@@ -311,9 +487,16 @@ void LCD_DrawHLine(uint16_t Xpos, uint16_t Ypos, uint16_t Length)
   LL_FillBuffer(ActiveLayer, (uint32_t *)Xaddress, Length, 1, 0, DrawProp[ActiveLayer].TextColor);
 }
 
-void LCD_DrawVLine(uint16_t Xpos, uint16_t Ypos, uint16_t Length)
+void LCD_DrawVLine(int16_t Xpos, int16_t Ypos, uint16_t Length)
 {
   uint32_t  Xaddress = 0;
+  int16_t   Yend = Ypos + Length - 1;
+  
+  if((Xpos < Clip.X0) || (Xpos > Clip.X1)) return;
+  if(Ypos < Clip.Y0) Ypos = Clip.Y0;
+  if(Yend > Clip.Y1) Yend = Clip.Y1;
+  if(Yend < Ypos) return;
+  Length = Yend - Ypos + 1;
   
   /* Get the line address */
   if(hltdc.LayerCfg[ActiveLayer].PixelFormat == LTDC_PIXEL_FORMAT_RGB565)
@@ -329,12 +512,16 @@ void LCD_DrawVLine(uint16_t Xpos, uint16_t Ypos, uint16_t Length)
   LL_FillBuffer(ActiveLayer, (uint32_t *)Xaddress, 1, Length, (LCD_GetXSize() - 1), DrawProp[ActiveLayer].TextColor);
 }
 
-void LCD_DrawLine(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2)
+void LCD_DrawLine(int16_t x1, int16_t y1, int16_t x2, int16_t y2)
 {
   int16_t deltax = 0, deltay = 0, x = 0, y = 0, xinc1 = 0, xinc2 = 0, 
   yinc1 = 0, yinc2 = 0, den = 0, num = 0, num_add = 0, num_pixels = 0, 
   curpixel = 0;
   
+  /* Both ends on the same outer side of the clip - nothing to draw */
+  if(((x1 < Clip.X0) && (x2 < Clip.X0)) || ((x1 > Clip.X1) && (x2 > Clip.X1)) ||
+     ((y1 < Clip.Y0) && (y2 < Clip.Y0)) || ((y1 > Clip.Y1) && (y2 > Clip.Y1))) return;
+  
   deltax = ABS(x2 - x1);        /* The difference between the x's */
   deltay = ABS(y2 - y1);        /* The difference between the y's */
   x = x1;                       /* Start x off at the first pixel */
@@ -398,90 +585,45 @@ void LCD_DrawLine(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2)
   }
 }
 
-void LCD_DrawRect(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t  y2)
+void LCD_DrawRect(int16_t x1, int16_t y1, int16_t x2, int16_t  y2)
 {
-  /* Draw horizontal lines */
- // LCD_DrawHLine(Xpos, Ypos, Width);
- // LCD_DrawHLine(Xpos, (Ypos+ Height), Width);
-  if(x1 < DisplayWIDTH +1){
-   if(x2 < DisplayWIDTH +1){  
-     if(y1 < DisplayHEIGHT +1){  
-       if(y2 < DisplayHEIGHT +1){  
-            DrawFastLineVertical(x1,y1,y2);
-            DrawFastLineVertical(x2,y1,y2);
-            DrawFastLineHorizontal(y1,x1,x2);
-            DrawFastLineHorizontal(y2,x1,x2);
-     }
-    }
-   }
-  }
-  /* Draw vertical lines */
- // LCD_DrawVLine(Xpos, Ypos, Height);
- // LCD_DrawVLine((Xpos + Width), Ypos, Height);
+  /* the lines are clipped, so a partly visible rectangle is drawn partly */
+  DrawFastLineVertical(x1,y1,y2);
+  DrawFastLineVertical(x2,y1,y2);
+  DrawFastLineHorizontal(y1,x1,x2);
+  DrawFastLineHorizontal(y2,x1,x2);
 }
 
 void LCD_DrawCircle(uint16_t Xpos, uint16_t Ypos, uint16_t Radius)
 {
-  int32_t   decision;    /* Decision Variable */ 
-  uint32_t  current_x;   /* Current X Value */
-  uint32_t  current_y;   /* Current Y Value */
-  
-  decision = 3 - (Radius << 1);
-  current_x = 0;
-  current_y = Radius;
-  
-  while (current_x <= current_y)
-  {
-    Fast_LCD_DrawPixel((Xpos + current_x), (Ypos - current_y), DrawProp[ActiveLayer].TextColor);
-    Fast_LCD_DrawPixel((Xpos - current_x), (Ypos - current_y), DrawProp[ActiveLayer].TextColor);
-    Fast_LCD_DrawPixel((Xpos + current_y), (Ypos - current_x), DrawProp[ActiveLayer].TextColor);
-    Fast_LCD_DrawPixel((Xpos - current_y), (Ypos - current_x), DrawProp[ActiveLayer].TextColor);
-    Fast_LCD_DrawPixel((Xpos + current_x), (Ypos + current_y), DrawProp[ActiveLayer].TextColor);
-    Fast_LCD_DrawPixel((Xpos - current_x), (Ypos + current_y), DrawProp[ActiveLayer].TextColor);
-    Fast_LCD_DrawPixel((Xpos + current_y), (Ypos + current_x), DrawProp[ActiveLayer].TextColor);
-    Fast_LCD_DrawPixel((Xpos - current_y), (Ypos + current_x), DrawProp[ActiveLayer].TextColor);
-    
-    if (decision < 0)
-    { 
-      decision += (current_x << 2) + 6;
-    }
-    else
-    {
-      decision += ((current_x - current_y) << 2) + 10;
-      current_y--;
-    }
-    current_x++;
-  } 
+  if(ClipOut(Xpos - Radius, Ypos - Radius, Xpos + Radius, Ypos + Radius)) return;
+  Span_DrawCircle(Xpos, Ypos, Radius, DrawProp[ActiveLayer].TextColor, LCD_FillSpan);
 }
 
 void LCD_DrawFullCircle(uint16_t Xpos, uint16_t Ypos, uint16_t radius)
 {
-	int16_t f = 1 - radius;
-	int16_t ddF_x = 1;
-	int16_t ddF_y = -2 * radius;
-	int16_t x = 0;
-	int16_t y = radius;
-
-        LCD_DrawLine( Xpos + x, Ypos - y, Xpos + x, Ypos + y);//, DrawProp[ActiveLayer].TextColor);
-	while(x < y)
-	{
-		if(f >= 0)
-		{
-			y--;
-			ddF_y += 2;
-			f += ddF_y;
-		}
-		x++;
-		ddF_x += 2;
-		f += ddF_x;
-                   DrawFastLineVertical(Xpos + x, Ypos - y, Ypos + y);
-                   DrawFastLineVertical(Xpos - x, Ypos - y, Ypos + y);
-                   DrawFastLineVertical(Xpos + y, Ypos - x, Ypos + x);
-                   DrawFastLineVertical(Xpos - y, Ypos - x, Ypos + x);   
-	}
-
-//	LCD_DrawCircle(Xpos, Ypos, radius);
+  if(ClipOut(Xpos - radius, Ypos - radius, Xpos + radius, Ypos + radius)) return;
+  Span_FillCircle(Xpos, Ypos, radius, DrawProp[ActiveLayer].TextColor, LCD_FillSpan);
+}
+
+void LCD_DrawRoundRect(int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t Radius)
+{
+  if(ClipOut(x1, y1, x2, y2)) return;
+  Span_DrawRoundRect(x1, y1, x2, y2, Radius, DrawProp[ActiveLayer].TextColor, LCD_FillSpan);
+}
+
+void LCD_FillRoundRect(int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t Radius)
+{
+  if(ClipOut(x1, y1, x2, y2)) return;
+  Span_FillRoundRect(x1, y1, x2, y2, Radius, DrawProp[ActiveLayer].TextColor, LCD_FillSpan);
+}
+
+void LCD_FillArc(int16_t Xpos, int16_t Ypos, uint16_t RadiusOut, uint16_t RadiusIn, uint8_t Quadrants)
+{
+  if(ClipOut(Xpos - RadiusOut, Ypos - RadiusOut, Xpos + RadiusOut, Ypos + RadiusOut)) return;
+  Span_FillArc(Xpos, Ypos, RadiusOut, RadiusIn, Quadrants, DrawProp[ActiveLayer].TextColor, LCD_FillSpan);
 }
+
 /**
   * @brief  Draws an poly-line (between many points).
   * @param  Points: Pointer to the points array
@@ -518,28 +660,8 @@ void LCD_DrawPolygon(pPoint Points, uint16_t PointCount)
   */
 void LCD_DrawEllipse(int Xpos, int Ypos, int XRadius, int YRadius)
 {
-  int x = 0, y = -YRadius, err = 2-2*XRadius, e2;
-  float k = 0, rad1 = 0, rad2 = 0;
-  
-  rad1 = XRadius;
-  rad2 = YRadius;
-  
-  k = (float)(rad2/rad1);  
-  
-  do { 
-    LCD_DrawPixel((Xpos-(uint16_t)(x/k)), (Ypos+y), DrawProp[ActiveLayer].TextColor);
-    LCD_DrawPixel((Xpos+(uint16_t)(x/k)), (Ypos+y), DrawProp[ActiveLayer].TextColor);
-    LCD_DrawPixel((Xpos+(uint16_t)(x/k)), (Ypos-y), DrawProp[ActiveLayer].TextColor);
-    LCD_DrawPixel((Xpos-(uint16_t)(x/k)), (Ypos-y), DrawProp[ActiveLayer].TextColor);      
-    
-    e2 = err;
-    if (e2 <= x) {
-      err += ++x*2+1;
-      if (-y == x && e2 <= y) e2 = 0;
-    }
-    if (e2 > y) err += ++y*2+1;     
-  }
-  while (y <= 0);
+  if(ClipOut(Xpos - XRadius, Ypos - YRadius, Xpos + XRadius, Ypos + YRadius)) return;
+  Span_DrawEllipse(Xpos, Ypos, XRadius, YRadius, DrawProp[ActiveLayer].TextColor, LCD_FillSpan);
 }
 
 /**
@@ -551,6 +673,7 @@ void LCD_DrawEllipse(int Xpos, int Ypos, int XRadius, int YRadius)
   */
 void LCD_DrawPixel(uint16_t Xpos, uint16_t Ypos, uint32_t RGB_Code)
 {
+  if(((int16_t)Xpos < Clip.X0) || ((int16_t)Xpos > Clip.X1) || ((int16_t)Ypos < Clip.Y0) || ((int16_t)Ypos > Clip.Y1)) return;
   /* Write data value to all SDRAM memory */
   if(hltdc.LayerCfg[ActiveLayer].PixelFormat == LTDC_PIXEL_FORMAT_RGB565)
   { /* RGB565 format */
@@ -563,13 +686,11 @@ void LCD_DrawPixel(uint16_t Xpos, uint16_t Ypos, uint32_t RGB_Code)
 }
 
 
-void Fast_LCD_DrawPixel(uint16_t Xpos, uint16_t Ypos, uint32_t ARGB_Code)
+void Fast_LCD_DrawPixel(int16_t Xpos, int16_t Ypos, uint32_t ARGB_Code)
 {
-  static uint32_t addressDraw; 
-  addressDraw = ProjectionLayerAddress[LayerOfView] + 4 * (Ypos * DisplayWIDTH + Xpos);
-  if(addressDraw > ProjectionLayerAddress[LayerOfView]  -1)
-   if(addressDraw < ProjectionLayerAddress[LayerOfView] + LAYERS_SIZE)
-     *(__IO uint32_t*)(ProjectionLayerAddress[LayerOfView] + 4 * (Ypos * DisplayWIDTH + Xpos)) = ARGB_Code;  //Fast, just write
+  if((Xpos < Clip.X0) || (Xpos > Clip.X1) || (Ypos < Clip.Y0) || (Ypos > Clip.Y1)) return;
+  *(__IO uint32_t*)SURFACE_ADDRESS(Xpos, Ypos) = ARGB_Code;
+  SURFACE_WRITES(4);  //Fast, just write
 }
 /**
   * @brief  Draws a bitmap picture loaded in the internal Flash in ARGB888 format (32 bits per pixel).
@@ -634,45 +755,8 @@ void LCD_DrawBitmap(uint32_t Xpos, uint32_t Ypos, uint8_t *pbmp)
 
 void LCD_FillCircle(uint16_t Xpos, uint16_t Ypos, uint16_t Radius)
 {
-  int32_t  decision;     /* Decision Variable */ 
-  uint32_t  current_x;   /* Current X Value */
-  uint32_t  current_y;   /* Current Y Value */
-  
-  decision = 3 - (Radius << 1);
-  
-  current_x = 0;
-  current_y = Radius;
-  
-  LCD_SetTextColor(DrawProp[ActiveLayer].TextColor);
-  if(Xpos < Radius) Xpos = Radius;
-  if(Ypos < Radius) Ypos = Radius;
-  while (current_x <= current_y)
-  {
-    if(current_y > 0) 
-    {
-      LCD_DrawHLine(Xpos - current_y, Ypos + current_x, 2*current_y);
-      LCD_DrawHLine(Xpos - current_y, Ypos - current_x, 2*current_y);
-    }
-    
-    if(current_x > 0) 
-    {
-      LCD_DrawHLine(Xpos - current_x, Ypos - current_y, 2*current_x);
-      LCD_DrawHLine(Xpos - current_x, Ypos + current_y, 2*current_x);
-    }
-    if (decision < 0)
-    { 
-      decision += (current_x << 2) + 6;
-    }
-    else
-    {
-      decision += ((current_x - current_y) << 2) + 10;
-      current_y--;
-    }
-    current_x++;
-  }
-  
-  LCD_SetTextColor(DrawProp[ActiveLayer].TextColor);
- // LCD_DrawCircle(Xpos, Ypos, Radius);
+  if(ClipOut(Xpos - Radius, Ypos - Radius, Xpos + Radius, Ypos + Radius)) return;
+  Span_FillCircle(Xpos, Ypos, Radius, DrawProp[ActiveLayer].TextColor, LCD_FillSpan);
 }
 
 /**
@@ -684,7 +768,7 @@ void LCD_FillCircle(uint16_t Xpos, uint16_t Ypos, uint16_t Radius)
 void LCD_FillPolygon(pPoint Points, uint16_t PointCount)
 {
   int16_t X = 0, Y = 0, X2 = 0, Y2 = 0, X_center = 0, Y_center = 0, X_first = 0, Y_first = 0, pixelX = 0, pixelY = 0, counter = 0;
-  uint16_t  image_left = 0, image_right = 0, image_top = 0, image_bottom = 0;
+  int16_t  image_left = 0, image_right = 0, image_top = 0, image_bottom = 0;
   
   image_left = image_right = Points->X;
   image_top= image_bottom = Points->Y;
@@ -717,6 +801,12 @@ void LCD_FillPolygon(pPoint Points, uint16_t PointCount)
     return;
   }
   
+  /* the whole polygon is out of the clip */
+  if((image_right < Clip.X0) || (image_left > Clip.X1) || (image_bottom < Clip.Y0) || (image_top > Clip.Y1))
+  {
+    return;
+  }
+  
   X_center = (image_left + image_right)/2;
   Y_center = (image_bottom + image_top)/2;
   
@@ -751,28 +841,8 @@ void LCD_FillPolygon(pPoint Points, uint16_t PointCount)
   */
 void LCD_FillEllipse(int Xpos, int Ypos, int XRadius, int YRadius)
 {
-  int x = 0, y = -YRadius, err = 2-2*XRadius, e2;
-  float k = 0, rad1 = 0, rad2 = 0;
-  
-  rad1 = XRadius;
-  rad2 = YRadius;
-  
-  k = (float)(rad2/rad1);
-  
-  do 
-  {       
-    LCD_DrawHLine((Xpos-(uint16_t)(x/k)), (Ypos+y), (2*(uint16_t)(x/k) + 1));
-    LCD_DrawHLine((Xpos-(uint16_t)(x/k)), (Ypos-y), (2*(uint16_t)(x/k) + 1));
-    
-    e2 = err;
-    if (e2 <= x) 
-    {
-      err += ++x*2+1;
-      if (-y == x && e2 <= y) e2 = 0;
-    }
-    if (e2 > y) err += ++y*2+1;
-  }
-  while (y <= 0);
+  if(ClipOut(Xpos - XRadius, Ypos - YRadius, Xpos + XRadius, Ypos + YRadius)) return;
+  Span_FillEllipse(Xpos, Ypos, XRadius, YRadius, DrawProp[ActiveLayer].TextColor, LCD_FillSpan);
 }
 
 
@@ -789,42 +859,128 @@ void LCD_FillEllipse(int Xpos, int Ypos, int XRadius, int YRadius)
   * @param  c: Pointer to the character data
   * @retval None
   */
-static void DrawChar(uint16_t Xpos, uint16_t Ypos, const uint8_t *c, uint16_t SignWide)
+/* returns the fence of the DMA2D jobs of the sign, 0 - the CPU has drawn it */
+static uint32_t PutChar(int16_t Xpos, int16_t Ypos, uint8_t Ascii)
+{
+  const sFONT * font = DrawProp[ActiveLayer].pFont;
+
+  if((font->Bpp == 4) && !font->rle) return DrawA4(Xpos, Ypos, Ascii);
+  if(GlyphCache || (font->Bpp > 1)) return DrawGlyph(Xpos, Ypos, Ascii);  // the coverage needs the blend
+  if(font->rle){
+    if((Xpos > Clip.X1) || (Ypos > Clip.Y1) || (Ypos + font->Height - 1 < Clip.Y0)) return 0;
+    FontRLE_Draw(font, Ascii, Xpos, Ypos, DrawProp[ActiveLayer].TextColor, DrawProp[ActiveLayer].BackColor, LCD_FillSpan);
+    return 0;
+  }
+  DrawChar(Xpos, Ypos, &font->table[FONT_INFO(font, Ascii)->Offset], (uint16_t)FONT_INFO(font, Ascii)->Wide);
+  return 0;
+}
+
+/* The A8 mask of the sign from the cache, blended with the text color by DMA2D.
+   An opaque back color is filled first, the ring keeps the order of the jobs */
+static uint32_t DrawGlyph(int16_t Xpos, int16_t Ypos, uint8_t Ascii)
+{
+  const sFONT * font = DrawProp[ActiveLayer].pFont;
+  const GlyphEntry * g;
+  int16_t x1, y1, x2, y2;
+  uint16_t w, h;
+  uint32_t src, dst;
+
+  x1 = Xpos;
+  y1 = Ypos;
+  x2 = Xpos + FONT_INFO(font, Ascii)->Wide - 1;
+  y2 = Ypos + font->Height - 1;
+  if((x2 < x1) || (x1 > Clip.X1) || (x2 < Clip.X0) || (y1 > Clip.Y1) || (y2 < Clip.Y0)) return 0;
+  if(x1 < Clip.X0) x1 = Clip.X0;
+  if(y1 < Clip.Y0) y1 = Clip.Y0;
+  if(x2 > Clip.X1) x2 = Clip.X1;
+  if(y2 > Clip.Y1) y2 = Clip.Y1;
+  w = x2 - x1 + 1;
+  h = y2 - y1 + 1;
+
+  g = Glyph_Get(font, Ascii);
+  src = g->Address + (uint32_t)(y1 - Ypos) * g->Wide + (x1 - Xpos);
+  dst = SURFACE_ADDRESS(x1, y1);
+  if(DrawProp[ActiveLayer].BackColor & 0xFF000000)
+    Jobs_Fill(dst, w, h, Surface.Pitch - w, DrawProp[ActiveLayer].BackColor);
+  return Jobs_Blend(src, dst, dst, w, h, g->Wide - w, Surface.Pitch - w, Surface.Pitch - w, CM_A8, DrawProp[ActiveLayer].TextColor);
+}
+
+/* A 4bpp sign straight from the font by DMA2D A4 blending, nothing is expanded.
+   DMA2D can't start a line in the middle of a byte, so the drawn rows must start
+   on an even column of the sign and take an even count of pixels. The pad nibble
+   of an odd wide sign is 0, blending it leaves the pixel as it is. A sign clipped
+   on an odd column goes through the glyph cache */
+static uint32_t DrawA4(int16_t Xpos, int16_t Ypos, uint8_t Ascii)
 {
-  uint32_t i = 0, j = 0, k = 0;
-  uint16_t height; 
-  uint16_t  BytesWide;
-  uint8_t  position;
+  const sFONT * font = DrawProp[ActiveLayer].pFont;
+  uint16_t wide = FONT_INFO(font, Ascii)->Wide;
+  uint16_t pitch = (wide + 1) & ~1;     // pixels of a row of the sign
+  int16_t x1, y1, x2, y2;
+  uint16_t w, h, wBlend;
+  uint32_t src, dst;
+
+  x1 = Xpos;
+  y1 = Ypos;
+  x2 = Xpos + wide - 1;
+  y2 = Ypos + font->Height - 1;
+  if((x2 < x1) || (x1 > Clip.X1) || (x2 < Clip.X0) || (y1 > Clip.Y1) || (y2 < Clip.Y0)) return 0;
+  if(x1 < Clip.X0) x1 = Clip.X0;
+  if(y1 < Clip.Y0) y1 = Clip.Y0;
+  if(x2 > Clip.X1) x2 = Clip.X1;
+  if(y2 > Clip.Y1) y2 = Clip.Y1;
+  w = wBlend = x2 - x1 + 1;
+  h = y2 - y1 + 1;
+  if(wBlend & 1){
+    if((x2 == Xpos + wide - 1) && (wide & 1) && (x2 < Clip.X1)) wBlend++;      // the pad nibble
+    else return DrawGlyph(Xpos, Ypos, Ascii);
+  }
+  if((x1 - Xpos) & 1) return DrawGlyph(Xpos, Ypos, Ascii);
+
+  src = (uint32_t)&font->table[FONT_INFO(font, Ascii)->Offset] + (uint32_t)(y1 - Ypos) * (pitch / 2) + (x1 - Xpos) / 2;
+  dst = SURFACE_ADDRESS(x1, y1);
+  if(DrawProp[ActiveLayer].BackColor & 0xFF000000)
+    Jobs_Fill(dst, w, h, Surface.Pitch - w, DrawProp[ActiveLayer].BackColor);
+  return Jobs_Blend(src, dst, dst, wBlend, h, pitch - wBlend, Surface.Pitch - wBlend, Surface.Pitch - wBlend, CM_A4, DrawProp[ActiveLayer].TextColor);
+}
+
+static void DrawChar(int16_t Xpos, int16_t Ypos, const uint8_t *c, uint16_t SignWide)
+{
+  int16_t  k, first, last, position;
+  int16_t  height; 
+  uint16_t BytesWide;
+  uint32_t TextColor, BackColor;
+  __IO uint32_t* pLine;
 
   height = DrawProp[ActiveLayer].pFont->Height;
   BytesWide = ((SignWide-1)/8) + 1 ;
-  position = 0;
+  TextColor = DrawProp[ActiveLayer].TextColor;
+  BackColor = DrawProp[ActiveLayer].BackColor;
   
-  for (k = 0; k < height; k++)
-    {
-    for (j = 0; j < BytesWide; j++)
+  /* the sign is out of the clip */
+  if((Xpos > Clip.X1) || (Xpos + SignWide - 1 < Clip.X0) || (Ypos > Clip.Y1) || (Ypos + height - 1 < Clip.Y0)) return;
+  
+  /* the visible columns of the sign */
+  first = (Xpos < Clip.X0) ? (Clip.X0 - Xpos) : 0;
+  last = (Xpos + SignWide - 1 > Clip.X1) ? (Clip.X1 - Xpos) : (SignWide - 1);
+  
+  for (k = 0; k < height; k++, Ypos++, c += BytesWide)
+  {
+    if(Ypos < Clip.Y0) continue;
+    if(Ypos > Clip.Y1) break;
+    pLine = (__IO uint32_t*)SURFACE_ADDRESS(Xpos, Ypos);
+    SURFACE_WRITES(4 * (last - first + 1));
+    for(position = first; position <= last; position++)
     {
-      
-      for(i = 0; i < 8; i++ ){
-       if(position < SignWide){ 
-      if(c[j] & (1 << 7-i) ) 
+      if(c[position >> 3] & (0x80 >> (position & 7))) 
       {
-        //LCD_DrawPixel((Xpos + j), Ypos, DrawProp[ActiveLayer].TextColor);
-        Fast_LCD_DrawPixel((Xpos + position), Ypos, DrawProp[ActiveLayer].TextColor);
+        pLine[position] = TextColor;
       }
       else
       {
-       if(DrawProp[ActiveLayer].BackColor & 0xFF000000) Fast_LCD_DrawPixel((Xpos + position), Ypos, DrawProp[ActiveLayer].BackColor);
-      //  LCD_DrawPixel((Xpos + j), Ypos, DrawProp[ActiveLayer].BackColor);
-      }
-      position++;
+       if(BackColor & 0xFF000000) pLine[position] = BackColor;
       }
-      }
-    }
-    c += BytesWide;
-    position = 0;
-    Ypos++;
     }
+  }
 }
 
 /**
@@ -910,33 +1066,24 @@ void LCD_FillTriangle(uint16_t x1, uint16_t x2, uint16_t x3, uint16_t y1, uint16
 
 static void LL_FillBuffer(uint32_t LayerIndex, void *pDst, uint32_t xSize, uint32_t ySize, uint32_t OffLine, uint32_t ColorIndex) 
 {
-  /* Register to memory mode with ARGB8888 as color Mode */ 
-  hdma2d.Init.Mode         = DMA2D_R2M;
+  DMA2D_Job job;
+  
+  /* Register to memory mode with the color mode of the layer */ 
+  job.Mode = DMA2D_R2M;
   if(hltdc.LayerCfg[ActiveLayer].PixelFormat == LTDC_PIXEL_FORMAT_RGB565)
   { /* RGB565 format */ 
-    hdma2d.Init.ColorMode    = DMA2D_RGB565;
+    job.ColorMode = DMA2D_RGB565;
   }
   else
   { /* ARGB8888 format */
-    hdma2d.Init.ColorMode    = DMA2D_ARGB8888;
+    job.ColorMode = DMA2D_ARGB8888;
   }
-  hdma2d.Init.OutputOffset = OffLine;      
-  
-  hdma2d.Instance = DMA2D;
-   hdma2d.XferCpltCallback = Transfer_DMA2D_Completed;
-   
-  /* DMA2D Initialization */
-  if(HAL_DMA2D_Init(&hdma2d) == HAL_OK) 
-  {
-    if(HAL_DMA2D_ConfigLayer(&hdma2d, LayerIndex) == HAL_OK) 
-    {
-      if (HAL_DMA2D_Start_IT(&hdma2d, ColorIndex, (uint32_t)pDst, xSize, ySize) == HAL_OK)
-      {
-        /* Polling For DMA transfer */  
-       HAL_DMA2D_PollForTransfer(&hdma2d, 10);
-      }
-    }
-  } 
+  job.Src = ColorIndex;
+  job.Dst = (uint32_t)pDst;
+  job.xSize = xSize;
+  job.ySize = ySize;
+  job.DstOffLine = OffLine;
+  Jobs_Wait(Jobs_Submit(&job));
 }
 
 /**
@@ -949,89 +1096,30 @@ static void LL_FillBuffer(uint32_t LayerIndex, void *pDst, uint32_t xSize, uint3
   */
 void LL_ConvertLineToARGB8888(void *pSrc, void *pDst, uint32_t xSize, uint32_t ColorMode)
 {    
-  /* Configure the DMA2D Mode, Color Mode and output offset */
-  hdma2d.Init.Mode         = DMA2D_M2M_PFC;
-  hdma2d.Init.ColorMode    = DMA2D_ARGB8888;
-  hdma2d.Init.OutputOffset = 0;     
-  
-  /* Foreground Configuration */
-  hdma2d.LayerCfg[1].AlphaMode = DMA2D_NO_MODIF_ALPHA;
-  hdma2d.LayerCfg[1].InputAlpha = 0xFF;
-  hdma2d.LayerCfg[1].InputColorMode = ColorMode;
-  hdma2d.LayerCfg[1].InputOffset = 0;
-  
-  hdma2d.Instance = DMA2D; 
-  
-  /* DMA2D Initialization */
-  if(HAL_DMA2D_Init(&hdma2d) == HAL_OK) 
-  {
-    if(HAL_DMA2D_ConfigLayer(&hdma2d, 1) == HAL_OK) 
-    {
-      if (HAL_DMA2D_Start(&hdma2d, (uint32_t)pSrc, (uint32_t)pDst, xSize, 1) == HAL_OK)
-      {
-        /* Polling For DMA transfer */  
-        HAL_DMA2D_PollForTransfer(&hdma2d, 10);
-      }
-    }
-  } 
+  Jobs_Wait(Jobs_CopyPFC((uint32_t)pSrc, (uint32_t)pDst, xSize, 1, 0, 0, ColorMode));
 }
 
 void LL_ConvertLineToRGB888(void *pSrc, void *pDst, uint32_t xSize, uint32_t ColorMode)
 {    
-  /* Configure the DMA2D Mode, Color Mode and output offset */
-  hdma2d.Init.Mode         = DMA2D_M2M;
-  hdma2d.Init.ColorMode    = DMA2D_RGB888;
-  hdma2d.Init.OutputOffset = 0;     
-  
-  /* Foreground Configuration */
-//  hdma2d.LayerCfg[1].AlphaMode = DMA2D_NO_MODIF_ALPHA;
-//  hdma2d.LayerCfg[1].InputAlpha = 0xFF;
-  hdma2d.LayerCfg[1].InputColorMode = ColorMode;
-  hdma2d.LayerCfg[1].InputOffset = 0;
-  
-  hdma2d.Instance = DMA2D; 
-  
-  /* DMA2D Initialization */
-  if(HAL_DMA2D_Init(&hdma2d) == HAL_OK) 
-  {
-    if(HAL_DMA2D_ConfigLayer(&hdma2d, 1) == HAL_OK) 
-    {
-      if (HAL_DMA2D_Start(&hdma2d, (uint32_t)pSrc, (uint32_t)pDst, xSize, 1) == HAL_OK)
-      {
-        /* Polling For DMA transfer */  
-        HAL_DMA2D_PollForTransfer(&hdma2d, 10);
-      }
-    }
-  } 
+  DMA2D_Job job;
+  
+  job.Mode = DMA2D_M2M;
+  job.ColorMode = DMA2D_RGB888;
+  job.Src = (uint32_t)pSrc;
+  job.Dst = (uint32_t)pDst;
+  job.xSize = xSize;
+  job.ySize = 1;
+  job.SrcOffLine = 0;
+  job.DstOffLine = 0;
+  job.SrcColorMode = ColorMode;
+  job.AlphaMode = DMA2D_NO_MODIF_ALPHA;
+  job.Alpha = 0xFF;
+  Jobs_Wait(Jobs_Submit(&job));
 }
 
 void LL_ConvertImageToARGB8888(void *pSrc, void *pDst, uint32_t xSize, uint32_t ySize, uint32_t ColorMode)
 {    
-  /* Configure the DMA2D Mode, Color Mode and output offset */
-  hdma2d.Init.Mode         = DMA2D_M2M_PFC;
-  hdma2d.Init.ColorMode    = DMA2D_ARGB8888;
-  hdma2d.Init.OutputOffset = 0;     
-  
-  /* Foreground Configuration */
-  hdma2d.LayerCfg[1].AlphaMode = DMA2D_NO_MODIF_ALPHA;
-  hdma2d.LayerCfg[1].InputAlpha = 0xFF;
-  hdma2d.LayerCfg[1].InputColorMode = ColorMode;
-  hdma2d.LayerCfg[1].InputOffset = 0;
-  
-  hdma2d.Instance = DMA2D; 
-  
-  /* DMA2D Initialization */
-  if(HAL_DMA2D_Init(&hdma2d) == HAL_OK) 
-  {
-    if(HAL_DMA2D_ConfigLayer(&hdma2d, 1) == HAL_OK) 
-    {
-      if (HAL_DMA2D_Start(&hdma2d, (uint32_t)pSrc, (uint32_t)pDst, xSize, ySize) == HAL_OK)
-      {
-        /* Polling For DMA transfer */  
-        HAL_DMA2D_PollForTransfer(&hdma2d, 10);
-      }
-    }
-  } 
+  Jobs_Wait(Jobs_CopyPFC((uint32_t)pSrc, (uint32_t)pDst, xSize, ySize, 0, 0, ColorMode));
 }
 
 void LCD_InitParams(uint32_t LayerIndexGet, uint32_t BackColor, uint32_t TextColor, sFONT* pFont){
@@ -1078,115 +1166,203 @@ void LCD_SetLight(uint16_t Volume){
  
 }
 
-void DrawFastLineVertical(uint16_t x1, uint16_t y1, uint16_t y2){
- static uint32_t temp;
+void DrawFastLineVertical(int16_t x1, int16_t y1, int16_t y2){
  static uint32_t color;
  static uint32_t address;
+ int16_t temp;
  
- address = ProjectionLayerAddress[LayerOfView];
  color = DrawProp[ActiveLayer].TextColor;
  if (y1  > y2){
   temp = y1;
   y1 = y2;
   y2 = temp;
  }
- temp = 4*x1;
-  while(y1 <= y2)
-    *(__IO uint32_t*)(address + 4 * (y1++) * DisplayWIDTH + temp) = color;
+ if((x1 < Clip.X0) || (x1 > Clip.X1)) return;
+ if(y1 < Clip.Y0) y1 = Clip.Y0;
+ if(y2 > Clip.Y1) y2 = Clip.Y1;
+ address = SURFACE_ADDRESS(x1, y1);
+ if(y1 <= y2) SURFACE_WRITES(4 * (y2 - y1 + 1));
+  while(y1++ <= y2){
+    *(__IO uint32_t*)address = color;
+    address += 4 * Surface.Pitch;
+  }
 }
 
-void DrawFastLineHorizontal(uint16_t y1, uint16_t x1, uint16_t x2){
- static uint32_t temp;
- static uint32_t color;
- static uint32_t address;
+void DrawFastLineHorizontal(int16_t y1, int16_t x1, int16_t x2){
+ int16_t temp;
  
- address = ProjectionLayerAddress[LayerOfView];
- color = DrawProp[ActiveLayer].TextColor;
-  
  if (x1  > x2){
   temp = x1;
   x1 = x2;
   x2 = temp;
  }
- temp = 4 * y1 * DisplayWIDTH;
-  while(x1 <= x2)
-    *(__IO uint32_t*)(address + temp + 4*(x1++)) = color;
+ LCD_FillSpan(y1, x1, x2, DrawProp[ActiveLayer].TextColor);
 }
 
-void LCD_FillRect(uint32_t x1, uint32_t y1, uint32_t x2, uint32_t y2){
+/* The backend of all the filled shapes: one horizontal span x1..x2 on the line y, clipped */
+void LCD_FillSpan(int16_t y, int16_t x1, int16_t x2, uint32_t color){
+ __IO uint32_t* pDst;
+ 
+ if((y < Clip.Y0) || (y > Clip.Y1)) return;
+ if(x1 < Clip.X0) x1 = Clip.X0;
+ if(x2 > Clip.X1) x2 = Clip.X1;
+ pDst = (__IO uint32_t*)SURFACE_ADDRESS(x1, y);
+ if(x2 - x1 + 1 >= DMA2D_FILL_BREAK_EVEN){ // long enough to pay for the DMA2D start
+   _HW_Fill_Region((uint32_t)pDst, x2 - x1 + 1, 1, 0, color);
+   return;
+ }
+ if(x1 <= x2) SURFACE_WRITES(4 * (x2 - x1 + 1));
+  while(x1++ <= x2)
+    *pDst++ = color;
+}
+
+void LCD_FillRect(int16_t x1, int16_t y1, int16_t x2, int16_t y2){
 
- uint16_t temp;
+ int16_t temp;
  if (y1  > y2){
   temp = y1;
   y1 = y2;
   y2 = temp;
  }
-
-
+ if (x1  > x2){
+  temp = x1;
+  x1 = x2;
+  x2 = temp;
+ }
+ if(y1 < Clip.Y0) y1 = Clip.Y0;
+ if(y2 > Clip.Y1) y2 = Clip.Y1;
+ if(x1 < Clip.X0) x1 = Clip.X0;
+ if(x2 > Clip.X1) x2 = Clip.X1;
+ if((x1 > x2) || (y1 > y2)) return;
+
+ // one DMA2D job for the whole rectangle when it pays
+ if((int32_t)(x2 - x1 + 1) * (y2 - y1 + 1) >= DMA2D_FILL_BREAK_EVEN){
+   _HW_Fill_Region(SURFACE_ADDRESS(x1, y1), x2 - x1 + 1, y2 - y1 + 1,
+                   Surface.Pitch - (x2 - x1 + 1), DrawProp[ActiveLayer].TextColor);
+   return;
+ }
  while(y1 <= y2)
     DrawFastLineHorizontal(y1++, x1, x2);
 }
 
+/* Cuts the image placed at x, y to the clip rectangle. Returns 0 if nothing is visible,
+   else x, y, w, h and src (RGB888, 3 bytes per pixel, or L8) describe the visible part */
+static uint8_t ClipImage(ImageInfo * Image, int16_t * x, int16_t * y, uint16_t * w, uint16_t * h, uint32_t * src){
+ int16_t x1, y1, x2, y2;
+ 
+ x1 = *x;
+ y1 = *y;
+ x2 = x1 + Image->xsize - 1;
+ y2 = y1 + Image->ysize - 1;
+ if((x1 > Clip.X1) || (x2 < Clip.X0) || (y1 > Clip.Y1) || (y2 < Clip.Y0)) return 0;
+ if(x1 < Clip.X0) x1 = Clip.X0;
+ if(y1 < Clip.Y0) y1 = Clip.Y0;
+ if(x2 > Clip.X1) x2 = Clip.X1;
+ if(y2 > Clip.Y1) y2 = Clip.Y1;
+ 
+ *src = Image->address + (Image->clut ? 1 : 3) * ((uint32_t)(y1 - *y) * Image->xsize + (uint32_t)(x1 - *x));
+ *x = x1;
+ *y = y1;
+ *w = x2 - x1 + 1;
+ *h = y2 - y1 + 1;
+ return 1;
+}
+
 void LCD_Fill_Image(ImageInfo * Image, uint32_t x, uint32_t y){
  static uint32_t address;
-  
- address = ProjectionLayerAddress[LayerOfView] + 4 * y * DisplayWIDTH + 4 * x;
- FillImageSoft(Image->address, address, Image->xsize, Image->ysize);
-
+ int16_t xDst = (int16_t)x, yDst = (int16_t)y;
+ uint16_t w, h;
+ uint32_t src;
+ 
+ if(!ClipImage(Image, &xDst, &yDst, &w, &h, &src)) return;
+ address = SURFACE_ADDRESS(xDst, yDst);
+ if(Image->clut){       // L8 -> ARGB8888 by the DMA2D CLUT
+   Jobs_Wait(Jobs_CopyCLUT(src, address, w, h, Image->xsize - w, Surface.Pitch - w, CM_L8, Image->clut, Image->colors));
+   return;
+ }
+ // RGB888 -> ARGB8888 by DMA2D
+ _HW_Fill_Image_PFC(src, address, w, h, Image->xsize - w, Surface.Pitch - w, CM_RGB888);
 }
 
 
 
 void FillImageSoft(uint32_t ImageAddress, uint32_t address, uint32_t xSize, uint32_t ySize){
-uint32_t S_Y, i , j;
+ FillImageSoftOffLine(ImageAddress, address, xSize, ySize, 0, DisplayWIDTH);
+}
+
+/* SrcOffLine - pixels to skip at the end of every source line, DstPitch - pixels per line of the destination */
+static void FillImageSoftOffLine(uint32_t ImageAddress, uint32_t address, uint32_t xSize, uint32_t ySize, uint32_t SrcOffLine, uint32_t DstPitch){
+uint32_t j;
 uint8_t* pImageAddress = (uint8_t*)ImageAddress;
-dataIMG.Bytes[3] = 0xFF;
+uint32_t* pDst = (uint32_t*)address;
  
+ MON_CPU_BYTES(xSize * ySize * ((address >= MON_SDRAM_START) ? 7 : 3)); // RGB888 in, ARGB8888 out
  for(j = 0; j < ySize; j++){
-   S_Y = 4 * j * DisplayWIDTH;
-  for(i = 0; i < xSize; i++){
-    
-    dataIMG.Bytes[0] = *pImageAddress++; 
-    dataIMG.Bytes[1] = *pImageAddress++;
-    dataIMG.Bytes[2] = *pImageAddress++;
-       
-   
-    
-//       if(data & 0xFF000000) // is it not transparent?
-       *(__IO uint32_t*)(address + i * 4 + S_Y) = dataIMG.DWord;
-   }
+  Pix_RGB888ToARGB8888(pDst, pImageAddress, xSize);
+  pImageAddress += 3 * (xSize + SrcOffLine);
+  pDst += DstPitch;  // the next line of the destination
  }
 }
 
+/* The transparent color is the text color as for RGB888: a copy of the palette gets
+   alpha 0 there and DMA2D blends the icon over the surface */
+static void FillImageTranspL8(ImageInfo * Image, uint32_t src, uint32_t address, uint16_t w, uint16_t h){
+ static uint32_t KeyClut[256];
+ const uint32_t * clut = (const uint32_t *)Image->clut;
+ uint16_t i;
+
+ for(i = 0; i < Image->colors; i++)
+   KeyClut[i] = (clut[i] == DrawProp[LayerIndex].TextColor) ? 0 : clut[i];
+ SCB_CleanDCache_by_Addr((uint32_t *)((uint32_t)KeyClut & ~31), sizeof(KeyClut) + 32); // DMA2D reads it, whole cache lines
+ D2D_Invalidate();      // the same address, new colors
+ Jobs_Wait(Jobs_BlendCLUT(src, address, address, w, h, Image->xsize - w, Surface.Pitch - w, Surface.Pitch - w, CM_L8, (uint32_t)KeyClut, Image->colors));
+}
+
 void LCD_Fill_ImageTRANSP(ImageInfo * Image, uint32_t x, uint32_t y){
 static uint32_t address;
-address = ProjectionLayerAddress[LayerOfView] + 4 * y * DisplayWIDTH + 4 * x;
-uint32_t S_Y, i, j;
-uint8_t* pImageAddress = (uint8_t*) Image->address;
-dataIMG.Bytes[3] = 0xFF;
-
- for(j = 0; j < (Image->ysize); j++){
-   S_Y = 4 * j * DisplayWIDTH;
-  for(i = 0; i < (Image->xsize); i++){
-    dataIMG.Bytes[0] = *pImageAddress++; 
-    dataIMG.Bytes[1] = *pImageAddress++;
-    dataIMG.Bytes[2] = *pImageAddress++;
-       if(dataIMG.DWord != DrawProp[LayerIndex].TextColor) // is it not transparent?
-       *(__IO uint32_t*)(address + i * 4 + S_Y) = dataIMG.DWord;;
+int16_t xDst = (int16_t)x, yDst = (int16_t)y;
+uint16_t w, h;
+uint32_t src, i, j, n, key = DrawProp[LayerIndex].TextColor;
+uint32_t line[KEY_CHUNK];
+uint8_t* pImageAddress;
+
+if(!ClipImage(Image, &xDst, &yDst, &w, &h, &src)) return;
+address = SURFACE_ADDRESS(xDst, yDst);
+if(Image->clut){
+  FillImageTranspL8(Image, src, address, w, h);
+  return;
+}
+if((key >> 24) != 0xFF){        // no opaque pixel is the key, nothing is transparent
+  _HW_Fill_Image_PFC(src, address, w, h, Image->xsize - w, Surface.Pitch - w, CM_RGB888);
+  return;
+}
+pImageAddress = (uint8_t*) src;
+MON_CPU_BYTES(w * h * 3);
+SURFACE_WRITES(w * h * 4);
+
+ // a piece of the line to ARGB8888, Pix_ColorKey() copies the pixels which are not the key
+ for(j = 0; j < h; j++){
+  for(i = 0; i < w; i += n){
+    n = ((w - i) < KEY_CHUNK) ? (w - i) : KEY_CHUNK;
+    Pix_RGB888ToARGB8888(line, pImageAddress, n);
+    Pix_ColorKey((uint32_t *)address + i, line, n, key);
+    pImageAddress += 3 * n;
    }
+  pImageAddress += 3 * (Image->xsize - w);
+  address += 4 * Surface.Pitch;
  }
 }
  /// -- try to draw triangle
-void LCD_FillTriangle(uint16_t x1, uint16_t x2, uint16_t x3, uint16_t y1, uint16_t y2, uint16_t y3){
+void LCD_FillTriangle(int16_t x1, int16_t x2, int16_t x3, int16_t y1, int16_t y2, int16_t y3){
  
 struct point{
- uint16_t x;
- uint16_t y; 
+ int16_t x;
+ int16_t y; 
 };
 
 struct point A, B, C;
 static uint8_t i, indexA, indexB, indexC;
-static uint16_t sy, tmp;
+int16_t sy, syEnd, tmp;
 
 indexA = 1; //let A is first point
 if((y2 < y1) && (y2 < y3)) indexA = 2;
@@ -1226,15 +1402,29 @@ switch (indexB){
 			break;
 }
 
-for (sy = A.y; sy <= C.y; sy++) {
-  x1 = A.x + (sy - A.y) * (C.x - A.x) / (C.y - A.y);
+if((C.y < Clip.Y0) || (A.y > Clip.Y1)) return; // out of the clip
+
+if (C.y == A.y) { // flat triangle, just one line
+  x1 = x2 = A.x;
+  if (B.x < x1) x1 = B.x;
+  if (C.x < x1) x1 = C.x;
+  if (B.x > x2) x2 = B.x;
+  if (C.x > x2) x2 = C.x;
+  DrawFastLineHorizontal(A.y, x1, x2);
+  return;
+}
+
+sy = (A.y < Clip.Y0) ? Clip.Y0 : A.y;
+syEnd = (C.y > Clip.Y1) ? Clip.Y1 : C.y;
+for (; sy <= syEnd; sy++) {
+  x1 = A.x + (int32_t)(sy - A.y) * (C.x - A.x) / (C.y - A.y);
   if (sy < B.y)
-    x2 = A.x + (sy - A.y) * (B.x - A.x) / (B.y - A.y);
+    x2 = A.x + (int32_t)(sy - A.y) * (B.x - A.x) / (B.y - A.y);
   else {
     if (C.y == B.y)
       x2 = B.x;
     else
-      x2 = B.x + (sy - B.y) * (C.x - B.x) / (C.y - B.y);
+      x2 = B.x + (int32_t)(sy - B.y) * (C.x - B.x) / (C.y - B.y);
   }
   if (x1 > x2) { tmp = x1; x1 = x2; x2 = tmp; }
    DrawFastLineHorizontal(sy, x1, x2);
@@ -39,6 +39,8 @@
 
 /* USER CODE BEGIN 0 */
 #include "video.h"
+#include "beam.h"
+#include "ltdc_mon.h"
 /* USER CODE END 0 */
 
 LTDC_HandleTypeDef hltdc;
@@ -264,7 +266,17 @@ void HAL_LTDC_MspDeInit(LTDC_HandleTypeDef* hltdc)
 } 
 
 /* USER CODE BEGIN 1 */
+void HAL_LTDC_ErrorCallback(LTDC_HandleTypeDef *hltdc)
+{
+  Mon_Error(hltdc->ErrorCode);
+  hltdc->ErrorCode = HAL_LTDC_ERROR_NONE;  // it is OR-ed, every error is counted once
+  hltdc->State = HAL_LTDC_STATE_READY;
+}
 
+void HAL_LTDC_LineEvenCallback(LTDC_HandleTypeDef *hltdc)
+{
+  Beam_LineEvent();
+}
 /* USER CODE END 1 */
 
 /**
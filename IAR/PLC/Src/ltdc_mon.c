@@ -0,0 +1,157 @@
+#include "ltdc_mon.h"
+#include "ltdc.h"
+#include "perf.h"
+#include "dma2d_jobs.h"
+
+#define PLLSAI_DIV              8               // PLLSAIR 4 * PLLSAIDIVR 2
+#define PLLSAICFGR_BASE         0x44000000      // PLLSAIR 4, PLLSAIQ 4, PLLSAIP 2
+#define PLLSAI_LOCK_MS          2
+
+volatile uint32_t MonUnderruns = 0;
+volatile uint32_t MonTransferErrors = 0;
+uint32_t MonBackOffs = 0;
+MonBytes MonFrame;
+MonBytes MonCount;
+
+static uint16_t Refresh = 0;            // now
+static uint16_t RefreshTarget = MON_REFRESH_DEFAULT;    // asked by Mon_SetRefresh()
+static uint8_t DeadTime = 0;
+static uint32_t FrameStart;
+
+// bits per pixel of CM_ARGB8888 ... CM_A4, the same numbers for LTDC and DMA2D
+static const uint8_t PixelBits[11] = {32, 24, 16, 16, 16, 8, 8, 16, 4, 8, 4};
+
+static uint8_t ApplyRefresh(uint16_t Hz);
+static uint32_t LtdcFrameBytes(void);
+static void BackOff(void);
+static void StepBack(void);
+
+void Mon_Init(void){
+ ApplyRefresh(RefreshTarget);
+ FrameStart = Perf_Cycles();
+}
+
+uint8_t Mon_SetRefresh(uint16_t Hz){
+ if((Hz < MON_REFRESH_MIN) || (Hz > MON_REFRESH_MAX)) return LCD_ERROR;
+ RefreshTarget = Hz;
+ return ApplyRefresh(Hz);
+}
+
+uint16_t Mon_GetRefresh(void){
+ return Refresh;
+}
+
+uint32_t Mon_PixelClock(void){
+ uint32_t n = (RCC->PLLSAICFGR & RCC_PLLSAICFGR_PLLSAIN) >> 6;
+
+ return (HSE_VALUE / (RCC->PLLCFGR & RCC_PLLCFGR_PLLM)) * n / PLLSAI_DIV;
+}
+
+void Mon_SetDeadTime(uint8_t Cycles){
+ Jobs_WaitIdle();       // not while DMA2D runs
+ DeadTime = Cycles;
+ DMA2D->AMTCR = Cycles ? (((uint32_t)Cycles << 8) | DMA2D_AMTCR_EN) : 0;
+}
+
+void Mon_Frame(void){
+ static uint32_t underruns = 0;
+ static uint16_t calm = 0;
+ uint32_t now = Perf_Cycles(), primask;
+ uint64_t total;
+
+ primask = __get_PRIMASK();
+ __disable_irq();       // the next DMA2D job is started from the interrupt
+ MonFrame.Dma2d = MonCount.Dma2d;
+ MonCount.Dma2d = 0;
+ __set_PRIMASK(primask);
+ MonFrame.Cpu = MonCount.Cpu;
+ MonCount.Cpu = 0;
+ MonFrame.Cycles = now - FrameStart;
+ FrameStart = now;
+ // the LTDC reads the layers all the time, Refresh frames per second
+ MonFrame.Ltdc = (uint32_t)((uint64_t)LtdcFrameBytes() * Refresh * MonFrame.Cycles / SystemCoreClock);
+ total = (uint64_t)MonFrame.Ltdc + MonFrame.Dma2d + MonFrame.Cpu;
+ MonFrame.Load = MonFrame.Cycles ? (uint32_t)(total * 100 / MonFrame.Cycles) : 0;
+
+ if(MonUnderruns != underruns){
+   underruns = MonUnderruns;
+   calm = 0;
+   BackOff();
+ }
+ else if(++calm >= MON_CALM_FRAMES){
+   calm = 0;
+   StepBack();
+ }
+}
+
+void Mon_Error(uint32_t ErrorCode){
+ if(ErrorCode & HAL_LTDC_ERROR_FU) MonUnderruns++;
+ if(ErrorCode & HAL_LTDC_ERROR_TE) MonTransferErrors++;
+}
+
+void Mon_Dma2dJob(const DMA2D_Job * Job){
+ uint32_t bits = 0;
+
+ if(Job->Dst >= MON_SDRAM_START) bits += PixelBits[Job->ColorMode];
+ if((Job->Mode != DMA2D_R2M) && (Job->Src >= MON_SDRAM_START)) bits += PixelBits[Job->SrcColorMode];
+ if((Job->Mode == DMA2D_M2M_BLEND) && (Job->Back >= MON_SDRAM_START)) bits += PixelBits[Job->BackColorMode];
+ MonCount.Dma2d += ((uint32_t)Job->xSize * Job->ySize * bits) >> 3;
+}
+
+/*******************************************************************************
+                            Static Functions
+*******************************************************************************/
+
+/* The PLLSAI may be changed only when it is off, the LTDC has no clock for the
+   lock time, so it is done in the vertical blanking */
+static uint8_t ApplyRefresh(uint16_t Hz){
+ uint32_t in, n, tick;
+
+ in = HSE_VALUE / (RCC->PLLCFGR & RCC_PLLCFGR_PLLM);   // 1 MHz
+ n = ((uint32_t)Hz * (hltdc.Init.TotalWidth + 1) * (hltdc.Init.TotalHeigh + 1) * PLLSAI_DIV + in / 2) / in;
+ if((n < 50) || (n > 432) || (n * in < 100000000) || (n * in > 432000000)) return LCD_ERROR;
+
+ if(LTDC->GCR & LTDC_GCR_LTDCEN){
+   while(LTDC->CDSR & LTDC_CDSR_VSYNCS);
+   while(!(LTDC->CDSR & LTDC_CDSR_VSYNCS));
+ }
+ __HAL_RCC_PLLSAI_DISABLE();
+ tick = HAL_GetTick();
+ while(RCC->CR & RCC_CR_PLLSAIRDY)
+   if(HAL_GetTick() - tick > PLLSAI_LOCK_MS) return LCD_ERROR;
+ RCC->PLLSAICFGR = PLLSAICFGR_BASE | (n << 6);
+ __HAL_RCC_PLLSAI_ENABLE();
+ tick = HAL_GetTick();
+ while(!(RCC->CR & RCC_CR_PLLSAIRDY))
+   if(HAL_GetTick() - tick > PLLSAI_LOCK_MS) return LCD_ERROR;
+ Refresh = Hz;
+ return LCD_OK;
+}
+
+// from the registers, the canvas and the overlay don't go through hltdc.LayerCfg
+static uint32_t LtdcFrameBytes(void){
+ LTDC_Layer_TypeDef * layer;
+ uint32_t bytes = 0, i, w, h;
+
+ for(i = 0; i < MAX_LAYER_NUMBER; i++){
+   layer = LTDC_LAYER(&hltdc, i);
+   if(!(layer->CR & LTDC_LxCR_LEN)) continue;
+   w = ((layer->WHPCR >> 16) & 0xFFF) - (layer->WHPCR & 0xFFF) + 1;
+   h = ((layer->WVPCR >> 16) & 0x7FF) - (layer->WVPCR & 0x7FF) + 1;
+   bytes += w * h * PixelBits[layer->PFCR & 7] / 8;
+ }
+ return bytes;
+}
+
+// DMA2D gives way first, the refresh goes down only when that was not enough
+static void BackOff(void){
+ MonBackOffs++;
+ if(DeadTime < MON_DEAD_TIME_MAX) Mon_SetDeadTime(DeadTime + MON_DEAD_TIME_STEP);
+ else if(Refresh - MON_REFRESH_STEP >= MON_REFRESH_MIN) ApplyRefresh(Refresh - MON_REFRESH_STEP);
+}
+
+// back in the opposite order
+static void StepBack(void){
+ if(Refresh < RefreshTarget) ApplyRefresh((Refresh + MON_REFRESH_STEP < RefreshTarget) ? Refresh + MON_REFRESH_STEP : RefreshTarget);
+ else if(DeadTime) Mon_SetDeadTime(DeadTime - MON_DEAD_TIME_STEP);
+}
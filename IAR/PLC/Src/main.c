@@ -82,6 +82,7 @@ int main(void)
 
   /* USER CODE BEGIN 3 */
    RoutineFast(); // get and run deals from medium queue 
+   Shot_Step();   // a screenshot, one chunk at a time
 
    if(oldRelease && Touch_Data.status == TOUCH_RELEASED){
    ReleaseFunction();
@@ -89,9 +90,11 @@ int main(void)
    else
    {oldRelease = 1;}
  if(UpdateScreen|| DISP.ReleaseFlag || TimeIsReady){
+  Perf_Start(&PerfFrame);
   Run_GUI();
 
   Show_GUI();
+  Perf_Stop(&PerfFrame);
   UpdateScreen = 0;
   DISP.ReleaseFlag = 0;
   }
@@ -0,0 +1,217 @@
+#include "number.h"
+#include "dma2d_jobs.h"
+
+#define NUM_SIGNS       13
+
+typedef struct{
+ const sFONT * Font;    // 0 - free
+ uint32_t Color;
+ uint32_t BackColor;    // alpha 0 - the sprites are blended, else copied
+ uint8_t  Kerning;
+ uint16_t Cell;         // pixels of a digit cell, the kerning is in it
+ uint16_t PointCell;
+ uint32_t Address;      // NUM_SIGNS sprites of Cell x Height, 0 - no room
+}DigitSet;
+
+static const uint8_t Signs[NUM_SIGNS] = "0123456789- .";
+
+static DigitSet Sets[NUM_SETS];
+static uint32_t NextAddress = DIGITS_ADDRESS;
+
+static DigitSet * FindSet(const sFONT * Font, uint32_t Color, uint32_t BackColor, uint8_t Kerning);
+static uint16_t CellOf(const sFONT * Font, uint8_t Kerning);
+static uint8_t SignIndex(uint8_t Code);
+static void RenderSet(DigitSet * s);
+static uint32_t BlitSign(const DigitSet * s, uint8_t Index, int16_t x, int16_t y, uint16_t w);
+
+uint8_t Num_Format(uint8_t * Dst, int32_t Value, uint8_t Cells, uint8_t Decimals, Text_AlignModeTypdef Mode){
+ uint32_t v = (Value < 0) ? 0u - (uint32_t)Value : (uint32_t)Value;
+ uint8_t i, n, k;
+
+ if(Cells > NUM_CELLS_MAX) Cells = NUM_CELLS_MAX;
+ Dst[i = Cells] = 0;
+ /* the digits from the right, at least one before the point */
+ for(n = 0; i && (v || (n <= Decimals)); n++){
+   if(Decimals && (n == Decimals)){
+     Dst[--i] = '.';
+     if(!i) break;
+   }
+   Dst[--i] = '0' + v % 10;
+   v /= 10;
+ }
+ if(v || (n <= Decimals) || ((Value < 0) && !i)){
+   for(i = 0; i < Cells; i++)
+     Dst[i] = (Decimals && (i == Cells - 1 - Decimals)) ? '.' : '-';
+   return Cells;
+ }
+ if(Value < 0) Dst[--i] = '-';
+ /* i cells are blank, n of them go after the number */
+ n = (Mode == LEFT_MODE) ? i : ((Mode == CENTER_MODE) ? i / 2 : 0);
+ for(k = i; k < Cells; k++) Dst[k - n] = Dst[k];
+ for(k = Cells - n; k < Cells; k++) Dst[k] = ' ';
+ for(i -= n; i; ) Dst[--i] = ' ';
+ return Cells;
+}
+
+uint8_t Num_Prepare(const sFONT * Font, uint32_t Color, uint32_t BackColor, uint8_t Kerning){
+ DigitSet * s = FindSet(Font, Color, BackColor, Kerning);
+ uint32_t size;
+ uint8_t i;
+
+ if(s) return s->Address != 0;
+ for(i = 0; (i < NUM_SETS) && Sets[i].Font; i++);
+ if(i == NUM_SETS){
+   Num_Flush();
+   i = 0;
+ }
+ s = &Sets[i];
+ s->Font = Font;
+ s->Color = Color;
+ s->BackColor = BackColor;
+ s->Kerning = Kerning;
+ s->Cell = CellOf(Font, Kerning);
+ s->PointCell = FONT_INFO(Font, '.')->Wide + Kerning;
+ size = 4 * NUM_SIGNS * (uint32_t)s->Cell * Font->Height;
+ s->Address = 0;
+ if(NextAddress + size <= DIGITS_ADDRESS + DIGITS_AREA_SIZE){
+   s->Address = NextAddress;
+   NextAddress += size;
+   RenderSet(s);
+ }
+ return s->Address != 0;
+}
+
+int16_t Num_CellX(const sFONT * Font, uint8_t Kerning, const uint8_t * Text, uint8_t Cell, Text_AlignModeTypdef Mode){
+ uint16_t cell = CellOf(Font, Kerning), point = FONT_INFO(Font, '.')->Wide + Kerning, x = 0, width = 0;
+ uint8_t i;
+
+ for(i = 0; Text[i]; i++){
+   if(i == Cell) x = width;
+   width += (Text[i] == '.') ? point : cell;
+ }
+ if(Cell >= i) x = width;
+ if(Mode == CENTER_MODE) return (int16_t)x - (int16_t)(width / 2);
+ if(Mode == RIGHT_MODE) return (int16_t)x - (int16_t)width;
+ return (int16_t)x;
+}
+
+void Num_Draw(const sFONT * Font, uint32_t Color, uint32_t BackColor, uint8_t Kerning,
+              int16_t Xpos, int16_t Ypos, const uint8_t * Text, Text_AlignModeTypdef Mode){
+ const DigitSet * s = FindSet(Font, Color, BackColor, Kerning);
+ sFONT * font;
+ uint32_t fence = 0, f;
+ uint16_t cell, point, w;
+
+ Xpos += Num_CellX(Font, Kerning, Text, 0, Mode);
+ if(Mode == CENTER_MODE) Ypos -= Font->Height / 2;
+ if(s && s->Address){
+   for(; *Text; Text++){
+     w = (*Text == '.') ? s->PointCell : s->Cell;
+     f = BlitSign(s, SignIndex(*Text), Xpos, Ypos, w);
+     if(f) fence = f;
+     Xpos += w;
+   }
+   if(fence) Jobs_Wait(fence);  // the CPU may draw over the number after it
+   return;
+ }
+ /* no sprites, the signs in the middle of the same cells */
+ cell = CellOf(Font, Kerning);
+ point = FONT_INFO(Font, '.')->Wide + Kerning;
+ font = LCD_GetFont();
+ LCD_SetFont((sFONT *)Font);
+ LCD_SetTextColor(Color);
+ LCD_SetBackColor(BackColor);
+ for(; *Text; Text++){
+   w = (*Text == '.') ? point : cell;
+   LCD_DisplayChar(Xpos + (w - FONT_INFO(Font, *Text)->Wide) / 2, Ypos, *Text);
+   Xpos += w;
+ }
+ LCD_SetFont(font);
+}
+
+void Num_Flush(void){
+ uint8_t i;
+
+ Jobs_WaitIdle();       // no blit reads the sprites
+ for(i = 0; i < NUM_SETS; i++) Sets[i].Font = 0;
+ NextAddress = DIGITS_ADDRESS;
+}
+
+/*******************************************************************************
+                            Static Functions
+*******************************************************************************/
+
+static DigitSet * FindSet(const sFONT * Font, uint32_t Color, uint32_t BackColor, uint8_t Kerning){
+ uint8_t i;
+
+ for(i = 0; i < NUM_SETS; i++)
+   if((Sets[i].Font == Font) && (Sets[i].Color == Color) &&
+      (Sets[i].BackColor == BackColor) && (Sets[i].Kerning == Kerning)) return &Sets[i];
+ return 0;
+}
+
+/* the widest digit, the sign and the space take the same cell */
+static uint16_t CellOf(const sFONT * Font, uint8_t Kerning){
+ uint16_t wide = 0;
+ uint8_t i;
+
+ for(i = 0; i < NUM_SIGNS - 1; i++)
+   if(FONT_INFO(Font, Signs[i])->Wide > wide) wide = FONT_INFO(Font, Signs[i])->Wide;
+ return wide + Kerning;
+}
+
+static uint8_t SignIndex(uint8_t Code){
+ if((Code >= '0') && (Code <= '9')) return Code - '0';
+ if(Code == '-') return 10;
+ if(Code == '.') return 12;
+ return 11;     // the space
+}
+
+/* Every sign in the middle of its cell on the back color, by the usual text path:
+   a transparent back gives the sprite the alpha of the sign */
+static void RenderSet(DigitSet * s){
+ sFONT * font = LCD_GetFont();
+ uint32_t color = LCD_GetTextColor(), back = LCD_GetBackColor();
+ uint32_t address = s->Address;
+ uint16_t w, h = s->Font->Height;
+ uint8_t i;
+
+ LCD_SetFont((sFONT *)s->Font);
+ LCD_SetTextColor(s->Color);
+ LCD_SetBackColor(s->BackColor);
+ for(i = 0; i < NUM_SIGNS; i++, address += 4 * (uint32_t)s->Cell * h){
+   w = (Signs[i] == '.') ? s->PointCell : s->Cell;
+   Jobs_Wait(Jobs_Fill(address, w, h, 0, s->BackColor));  // the CPU may draw the sign
+   LCD_SetSurface(address, w, 0, 0);
+   if(LCD_ClipPushSurface(0, 0, w - 1, h - 1) == LCD_OK){
+     LCD_DisplayChar((w - FONT_INFO(s->Font, Signs[i])->Wide) / 2, 0, Signs[i]);
+     LCD_ClipPop();
+   }
+ }
+ Jobs_WaitIdle();
+ LCD_ResetSurface();
+ LCD_SetFont(font);
+ LCD_SetTextColor(color);
+ LCD_SetBackColor(back);
+}
+
+/* the fence of the copy, 0 - out of the clip */
+static uint32_t BlitSign(const DigitSet * s, uint8_t Index, int16_t x, int16_t y, uint16_t w){
+ const ClipRect * clip = LCD_GetClip();
+ int16_t x1 = x, y1 = y, x2 = x + w - 1, y2 = y + s->Font->Height - 1;
+ uint16_t pitch = LCD_SurfacePitch(), bw, bh;
+ uint32_t src, dst;
+
+ if((x1 > clip->X1) || (x2 < clip->X0) || (y1 > clip->Y1) || (y2 < clip->Y0)) return 0;
+ if(x1 < clip->X0) x1 = clip->X0;
+ if(y1 < clip->Y0) y1 = clip->Y0;
+ if(x2 > clip->X1) x2 = clip->X1;
+ if(y2 > clip->Y1) y2 = clip->Y1;
+ bw = x2 - x1 + 1;
+ bh = y2 - y1 + 1;
+
+ src = s->Address + 4 * ((uint32_t)Index * s->Cell * s->Font->Height + (uint32_t)(y1 - y) * w + (x1 - x));
+ dst = LCD_SurfaceAddress(x1, y1);
+ if(s->BackColor & 0xFF000000) return Jobs_Copy(src, dst, bw, bh, w - bw, pitch - bw);
+ return Jobs_Blend(src, dst, dst, bw, bh, w - bw, pitch - bw, pitch - bw, CM_ARGB8888, 0xFF);
+}
@@ -0,0 +1,105 @@
+#include "overlay.h"
+#include "ltdc.h"
+#include "core.h"
+#include "ltdc_mon.h"
+#include <string.h>
+
+#define LAYER                   LTDC_LAYER(&hltdc, OVERLAY_LAYER)
+
+static uint16_t Width = DisplayWIDTH;  // the pitch of the overlay
+static uint16_t Height = DisplayHEIGHT;
+
+static uint8_t Cut(int16_t * x, int16_t * y, uint16_t * w, uint16_t * h);
+static void WaitReload(void);
+
+/* The CLUT may be written only in the vertical blanking or with the layer off */
+void Overlay_SetPalette(const uint32_t * Palette, uint16_t Colors){
+ uint16_t i;
+
+ WaitReload();
+ if(LAYER->CR & LTDC_LxCR_LEN){
+   while(LTDC->CDSR & LTDC_CDSR_VSYNCS);
+   while(!(LTDC->CDSR & LTDC_CDSR_VSYNCS));
+ }
+ for(i = 0; i < Colors; i++)
+   LAYER->CLUTWR = ((uint32_t)i << 24) | (Palette[i] & 0x00FFFFFF);
+ LAYER->CKCR = Palette[OVERLAY_CLEAR] & 0x00FFFFFF;
+}
+
+void Overlay_Show(int16_t x, int16_t y, uint16_t w, uint16_t h){
+ uint32_t ahbp = (LTDC->BPCR & LTDC_BPCR_AHBP) >> 16;
+ uint32_t avbp = LTDC->BPCR & LTDC_BPCR_AVBP;
+
+ Width = w;
+ Height = h;
+ WaitReload();
+ LAYER->WHPCR = (x + ahbp + 1) | ((uint32_t)(x + w + ahbp) << 16);
+ LAYER->WVPCR = (y + avbp + 1) | ((uint32_t)(y + h + avbp) << 16);
+ LAYER->PFCR = LTDC_PIXEL_FORMAT_L8;
+ LAYER->BFCR = LTDC_BLENDING_FACTOR1_CA | LTDC_BLENDING_FACTOR2_CA;
+ LAYER->CACR = 255;
+ LAYER->DCCR = 0;
+ LAYER->CFBAR = OVERLAY_ADDRESS;
+ LAYER->CFBLR = ((uint32_t)w << 16) | (w + 3);
+ LAYER->CFBLNR = h;
+ LAYER->CR |= LTDC_LxCR_LEN | LTDC_LxCR_CLUTEN | LTDC_LxCR_COLKEN;
+ LTDC->SRCR = LTDC_SRCR_VBR;
+}
+
+void Overlay_Hide(void){
+ WaitReload();
+ LAYER->CR &= ~(LTDC_LxCR_LEN | LTDC_LxCR_CLUTEN | LTDC_LxCR_COLKEN);
+ LTDC->SRCR = LTDC_SRCR_VBR;
+}
+
+// DMA2D has no L8 output, the CPU writes the bytes
+void Overlay_Fill(int16_t x, int16_t y, uint16_t w, uint16_t h, uint8_t Index){
+ uint8_t * dst;
+
+ if(!Cut(&x, &y, &w, &h)) return;
+ MON_CPU_BYTES((uint32_t)w * h);
+ dst = (uint8_t *)(OVERLAY_ADDRESS + (uint32_t)y * Width + x);
+ while(h--){
+   memset(dst, Index, w);
+   dst += Width;
+ }
+}
+
+void Overlay_DrawImage(const ImageInfo * Image, int16_t x, int16_t y){
+ const uint8_t * src;
+ uint8_t * dst;
+ int16_t x0 = x, y0 = y;
+ uint16_t w = Image->xsize, h = Image->ysize;
+
+ if(!Image->clut || !Cut(&x, &y, &w, &h)) return;
+ MON_CPU_BYTES(2 * (uint32_t)w * h);
+ src = (const uint8_t *)(Image->address + (uint32_t)(y - y0) * Image->xsize + (x - x0));
+ dst = (uint8_t *)(OVERLAY_ADDRESS + (uint32_t)y * Width + x);
+ while(h--){
+   memcpy(dst, src, w);
+   src += Image->xsize;
+   dst += Width;
+ }
+}
+
+/*******************************************************************************
+                            Static Functions
+*******************************************************************************/
+
+/* the rectangle inside the overlay, 0 - nothing is left */
+static uint8_t Cut(int16_t * x, int16_t * y, uint16_t * w, uint16_t * h){
+ int32_t x2 = *x + *w, y2 = *y + *h;   // exclusive
+
+ if(*x < 0) *x = 0;
+ if(*y < 0) *y = 0;
+ if(x2 > Width) x2 = Width;
+ if(y2 > Height) y2 = Height;
+ if((x2 <= *x) || (y2 <= *y)) return 0;
+ *w = x2 - *x;
+ *h = y2 - *y;
+ return 1;
+}
+
+static void WaitReload(void){
+ while(LTDC->SRCR & LTDC_SRCR_VBR){ M_pull()();}
+}
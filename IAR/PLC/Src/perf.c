@@ -0,0 +1,46 @@
+#include "perf.h"
+
+PerfCounter PerfFrame;
+PerfCounter PerfRelease;
+
+void Perf_Init(void){
+ CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;   // enable the trace block
+ DWT->LAR = 0xC5ACCE55;                            // unlock DWT on the M7
+ DWT->CYCCNT = 0;
+ DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+ Perf_Reset(&PerfFrame);
+ Perf_Reset(&PerfRelease);
+}
+
+void Perf_Reset(PerfCounter * Counter){
+ Counter->Start = 0;
+ Counter->Last = 0;
+ Counter->Min = 0xFFFFFFFF;
+ Counter->Max = 0;
+ Counter->Avg = 0;
+ Counter->Count = 0;
+}
+
+uint32_t Perf_Cycles(void){
+ return DWT->CYCCNT;
+}
+
+void Perf_Start(PerfCounter * Counter){
+ Counter->Start = DWT->CYCCNT;
+}
+
+void Perf_Stop(PerfCounter * Counter){
+ uint32_t cycles;
+
+ cycles = DWT->CYCCNT - Counter->Start;  // unsigned math handles the wrap
+ Counter->Last = cycles;
+ if(cycles < Counter->Min) Counter->Min = cycles;
+ if(cycles > Counter->Max) Counter->Max = cycles;
+ if(Counter->Count == 0) Counter->Avg = cycles;
+ else Counter->Avg = Counter->Avg - (Counter->Avg >> 4) + (cycles >> 4);
+ Counter->Count++;
+}
+
+uint32_t Perf_CyclesToUs(uint32_t Cycles){
+ return Cycles / (SystemCoreClock / 1000000);
+}
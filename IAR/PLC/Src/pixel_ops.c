@@ -0,0 +1,54 @@
+#include "pixel_ops.h"
+
+void Pix_ColorKey(uint32_t * Dst, const uint32_t * Src, uint32_t Count, uint32_t Key){
+ uint32_t s0, s1;
+
+ // a key is a whole pixel match, there is nothing for the lanes, two pixels per loop
+ Key &= 0x00FFFFFF;
+ for(; Count >= 2; Count -= 2){
+   s0 = Src[0];
+   s1 = Src[1];
+   if((s0 & 0x00FFFFFF) != Key) Dst[0] = s0;
+   if((s1 & 0x00FFFFFF) != Key) Dst[1] = s1;
+   Src += 2;
+   Dst += 2;
+ }
+ if(Count && ((*Src & 0x00FFFFFF) != Key)) *Dst = *Src;
+}
+
+void Pix_RGB888ToARGB8888(uint32_t * Dst, const uint8_t * Src, uint32_t Count){
+ uint32_t w0, w1, w2;
+
+ for(; Count && ((uintptr_t)Src & 3); Count--, Src += 3)    // to the word alignment
+   *Dst++ = 0xFF000000 | ((uint32_t)Src[2] << 16) | ((uint32_t)Src[1] << 8) | Src[0];
+ // BGRB GRBG RBGR: the alpha byte covers what the shift brings from the next pixel
+ for(; Count >= 4; Count -= 4, Src += 12, Dst += 4){
+   w0 = ((const uint32_t *)Src)[0];
+   w1 = ((const uint32_t *)Src)[1];
+   w2 = ((const uint32_t *)Src)[2];
+   Dst[0] = 0xFF000000 | w0;
+   Dst[1] = 0xFF000000 | (w0 >> 24) | (w1 << 8);
+   Dst[2] = 0xFF000000 | (w1 >> 16) | (w2 << 16);
+   Dst[3] = 0xFF000000 | (w2 >> 8);
+ }
+ if(Count) Pix_RGB888ToARGB8888_Ref(Dst, Src, Count);
+}
+
+/*******************************************************************************
+                            Reference versions
+*******************************************************************************/
+
+void Pix_ColorKey_Ref(uint32_t * Dst, const uint32_t * Src, uint32_t Count, uint32_t Key){
+ while(Count--){
+   if(((*Src ^ Key) & 0x00FFFFFF) != 0) *Dst = *Src;
+   Src++;
+   Dst++;
+ }
+}
+
+void Pix_RGB888ToARGB8888_Ref(uint32_t * Dst, const uint8_t * Src, uint32_t Count){
+ while(Count--){
+   *Dst++ = 0xFF000000 | ((uint32_t)Src[2] << 16) | ((uint32_t)Src[1] << 8) | Src[0];
+   Src += 3;
+ }
+}
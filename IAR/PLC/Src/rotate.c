@@ -0,0 +1,124 @@
+#include "rotate.h"
+#include "dma2d_jobs.h"
+#include "ltdc_mon.h"
+
+#define MIN(A, B)       ((A) < (B) ? (A) : (B))
+#define MAX(A, B)       ((A) > (B) ? (A) : (B))
+
+uint32_t RotPixels = 0;
+
+__no_init static uint32_t Block[ROT_BLOCK * ROT_BLOCK] @ROT_BLOCK_ADDR;
+static ClipRect Now = {0, 0, ROT_PORTRAIT_W - 1, ROT_PORTRAIT_H - 1};  // changed since the last frame
+static ClipRect Prev = {0, 0, ROT_PORTRAIT_W - 1, ROT_PORTRAIT_H - 1}; // changed in the last frame
+
+static void Union(ClipRect * Box, const ClipRect * Add);
+
+void Rot_Invalidate(int16_t x1, int16_t y1, int16_t x2, int16_t y2){
+ ClipRect box;
+
+ box.X0 = MAX(x1, 0);
+ box.Y0 = MAX(y1, 0);
+ box.X1 = MIN(x2, ROT_PORTRAIT_W - 1);
+ box.Y1 = MIN(y2, ROT_PORTRAIT_H - 1);
+ if((box.X0 > box.X1) || (box.Y0 > box.Y1)) return;
+ Union(&Now, &box);
+}
+
+void Rot_InvalidateAll(void){
+ Now.X0 = Now.Y0 = 0;
+ Now.X1 = ROT_PORTRAIT_W - 1;
+ Now.Y1 = ROT_PORTRAIT_H - 1;
+}
+
+uint8_t Rot_Render(uint32_t Background, uint32_t Frame, void (*Draw)(void), uint16_t Dir){
+ ClipRect box = Now;
+ uint32_t offset;
+ uint16_t w, h;
+
+ if(Now.X0 <= Now.X1){
+   w = Now.X1 - Now.X0 + 1;
+   h = Now.Y1 - Now.Y0 + 1;
+   offset = 4 * ((uint32_t)Now.Y0 * ROT_PORTRAIT_W + Now.X0);
+   Jobs_Wait(Jobs_Copy(Background + offset, ROT_PORTRAIT_ADDRESS + offset, w, h, ROT_PORTRAIT_W - w, ROT_PORTRAIT_W - w));
+   LCD_SetSurface(ROT_PORTRAIT_ADDRESS, ROT_PORTRAIT_W, 0, 0);
+   if(LCD_ClipPushSurface(Now.X0, Now.Y0, Now.X1, Now.Y1) == LCD_OK){
+     Draw();
+     LCD_ClipPop();
+   }
+   LCD_ResetSurface();
+   Jobs_WaitIdle();
+ }
+
+ // the layer we turn to was shown before the last flip, it misses the last change too
+ Union(&box, &Prev);
+ Prev = Now;
+ Now.X0 = 1;
+ Now.X1 = 0;
+ RotPixels = 0;
+ if(box.X0 > box.X1) return 0;
+ RotPixels = (uint32_t)(box.X1 - box.X0 + 1) * (box.Y1 - box.Y0 + 1);
+ Rot_Region(ROT_PORTRAIT_ADDRESS, Frame, box.X0, box.Y0, box.X1 - box.X0 + 1, box.Y1 - box.Y0 + 1, Dir);
+ return 1;
+}
+
+/* ROT_90: landscape x = 799 - y, landscape y = x; ROT_270: x = y, y = 479 - x.
+   A portrait column of the block is a part of a landscape line */
+void Rot_Region(uint32_t Src, uint32_t Dst, int16_t x, int16_t y, uint16_t w, uint16_t h, uint16_t Dir){
+ const uint32_t * src;
+ uint32_t * dst;
+ uint16_t bx, by, bw, bh, i, j;
+ int16_t px, py;
+
+ MON_CPU_BYTES(8 * (uint32_t)w * h);
+ for(by = 0; by < h; by += ROT_BLOCK){
+   bh = MIN(ROT_BLOCK, h - by);
+   py = y + by;
+   for(bx = 0; bx < w; bx += ROT_BLOCK){
+     bw = MIN(ROT_BLOCK, w - bx);
+     src = (const uint32_t *)Src + (uint32_t)py * ROT_PORTRAIT_W + x + bx;
+     for(j = 0; j < bh; j++, src += ROT_PORTRAIT_W)
+       for(i = 0; i < bw; i++) Block[j * ROT_BLOCK + i] = src[i];
+
+     for(i = 0; i < bw; i++){
+       px = x + bx + i;
+       if(Dir == ROT_90){
+         dst = (uint32_t *)Dst + (uint32_t)px * DisplayWIDTH + (ROT_PORTRAIT_H - py - bh);
+         for(j = 0; j < bh; j++) dst[j] = Block[(bh - 1 - j) * ROT_BLOCK + i];
+       }
+       else{
+         dst = (uint32_t *)Dst + (uint32_t)(ROT_PORTRAIT_W - 1 - px) * DisplayWIDTH + py;
+         for(j = 0; j < bh; j++) dst[j] = Block[j * ROT_BLOCK + i];
+       }
+     }
+   }
+ }
+}
+
+void Rot_RegionNaive(uint32_t Src, uint32_t Dst, int16_t x, int16_t y, uint16_t w, uint16_t h, uint16_t Dir){
+ const uint32_t * src = (const uint32_t *)Src;
+ uint32_t * dst = (uint32_t *)Dst;
+ int16_t px, py;
+
+ for(py = y; py < y + h; py++)
+   for(px = x; px < x + w; px++){
+     if(Dir == ROT_90) dst[(uint32_t)px * DisplayWIDTH + ROT_PORTRAIT_H - 1 - py] = src[(uint32_t)py * ROT_PORTRAIT_W + px];
+     else dst[(uint32_t)(ROT_PORTRAIT_W - 1 - px) * DisplayWIDTH + py] = src[(uint32_t)py * ROT_PORTRAIT_W + px];
+   }
+}
+
+/*******************************************************************************
+                            Static Functions
+*******************************************************************************/
+
+/* X0 > X1 - empty */
+static void Union(ClipRect * Box, const ClipRect * Add){
+ if(Add->X0 > Add->X1) return;
+ if(Box->X0 > Box->X1){
+   *Box = *Add;
+   return;
+ }
+ Box->X0 = MIN(Box->X0, Add->X0);
+ Box->Y0 = MIN(Box->Y0, Add->Y0);
+ Box->X1 = MAX(Box->X1, Add->X1);
+ Box->Y1 = MAX(Box->Y1, Add->Y1);
+}
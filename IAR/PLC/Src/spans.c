@@ -0,0 +1,181 @@
+#include "spans.h"
+
+// The symmetry tables: Table[dy] is the half width of the shape on the line dy
+// from its center, one quarter is enough for the whole shape, fills and outlines
+static int16_t Table[SPAN_TABLE_SIZE];
+static int16_t TableIn[SPAN_TABLE_SIZE]; // inner radius of an arc
+
+static uint16_t CircleTable(int16_t * w, uint16_t r);
+static uint16_t EllipseTable(int16_t * w, uint16_t rx, uint16_t ry);
+static void FillTable(int16_t xL, int16_t xR, int16_t yT, int16_t yB, const int16_t * w, uint16_t n, uint32_t color, SpanFunc span);
+static void OutlineTable(int16_t xL, int16_t xR, int16_t yT, int16_t yB, const int16_t * w, uint16_t n, uint32_t color, SpanFunc span);
+static void OutlineLine(int16_t y, int16_t xL, int16_t xR, int16_t wOut, int16_t wNext, uint32_t color, SpanFunc span);
+
+void Span_FillCircle(int16_t xc, int16_t yc, uint16_t r, uint32_t color, SpanFunc span){
+ uint16_t n;
+
+ n = CircleTable(Table, r);
+ FillTable(xc, xc, yc, yc, Table, n, color, span);
+}
+
+void Span_DrawCircle(int16_t xc, int16_t yc, uint16_t r, uint32_t color, SpanFunc span){
+ uint16_t n;
+
+ n = CircleTable(Table, r);
+ OutlineTable(xc, xc, yc, yc, Table, n, color, span);
+}
+
+void Span_FillEllipse(int16_t xc, int16_t yc, uint16_t rx, uint16_t ry, uint32_t color, SpanFunc span){
+ uint16_t n;
+
+ n = EllipseTable(Table, rx, ry);
+ FillTable(xc, xc, yc, yc, Table, n, color, span);
+}
+
+void Span_DrawEllipse(int16_t xc, int16_t yc, uint16_t rx, uint16_t ry, uint32_t color, SpanFunc span){
+ uint16_t n;
+
+ n = EllipseTable(Table, rx, ry);
+ OutlineTable(xc, xc, yc, yc, Table, n, color, span);
+}
+
+void Span_FillRoundRect(int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t r, uint32_t color, SpanFunc span){
+ int16_t temp;
+ uint16_t n;
+
+ if(x1 > x2){ temp = x1; x1 = x2; x2 = temp; }
+ if(y1 > y2){ temp = y1; y1 = y2; y2 = temp; }
+ if(r > (x2 - x1) / 2) r = (x2 - x1) / 2;
+ if(r > (y2 - y1) / 2) r = (y2 - y1) / 2;
+
+ n = CircleTable(Table, r);
+ // the corners are the quarters of a circle around x1+n, y1+n ... x2-n, y2-n
+ FillTable(x1 + n, x2 - n, y1 + n, y2 - n, Table, n, color, span);
+}
+
+void Span_DrawRoundRect(int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t r, uint32_t color, SpanFunc span){
+ int16_t temp;
+ uint16_t n;
+
+ if(x1 > x2){ temp = x1; x1 = x2; x2 = temp; }
+ if(y1 > y2){ temp = y1; y1 = y2; y2 = temp; }
+ if(r > (x2 - x1) / 2) r = (x2 - x1) / 2;
+ if(r > (y2 - y1) / 2) r = (y2 - y1) / 2;
+
+ n = CircleTable(Table, r);
+ OutlineTable(x1 + n, x2 - n, y1 + n, y2 - n, Table, n, color, span);
+}
+
+void Span_FillArc(int16_t xc, int16_t yc, uint16_t rOut, uint16_t rIn, uint8_t quadrants, uint32_t color, SpanFunc span){
+ int16_t dy, ady, start, wOut;
+ uint16_t nOut, nIn = 0;
+ uint8_t q, left, right;
+
+ nOut = CircleTable(Table, rOut);
+ if(rIn) nIn = CircleTable(TableIn, rIn);
+
+ for(dy = -(int16_t)nOut; dy <= (int16_t)nOut; dy++){
+   q = 0;
+   if(dy <= 0) q |= quadrants & (SPAN_TOP_LEFT | SPAN_TOP_RIGHT);
+   if(dy >= 0) q |= quadrants & (SPAN_BOTTOM_LEFT | SPAN_BOTTOM_RIGHT);
+   if(!q) continue;
+
+   ady = (dy < 0) ? -dy : dy;
+   wOut = Table[ady];
+   start = (rIn && (ady <= nIn)) ? TableIn[ady] + 1 : 0;  // the first x out of the hole
+   if(start > wOut) continue;                              // the whole line is in the hole
+
+   left = q & (SPAN_TOP_LEFT | SPAN_BOTTOM_LEFT);
+   right = q & (SPAN_TOP_RIGHT | SPAN_BOTTOM_RIGHT);
+   if((start == 0) && left && right){
+     span(yc + dy, xc - wOut, xc + wOut, color);
+   }
+   else{
+     if(left) span(yc + dy, xc - wOut, xc - start, color);
+     if(right) span(yc + dy, xc + start, xc + wOut, color);
+   }
+ }
+}
+
+/*******************************************************************************
+                            Static Functions
+*******************************************************************************/
+
+// the last x with x*x + dy*dy <= r*r + r, it gives the same round shape as the midpoint circle
+static uint16_t CircleTable(int16_t * w, uint16_t r){
+ int32_t x, dy, lim;
+
+ if(r > SPAN_TABLE_SIZE - 1) r = SPAN_TABLE_SIZE - 1;
+ lim = (int32_t)r * r + r;
+ x = r;
+ for(dy = 0; dy <= r; dy++){
+   while(x * x + dy * dy > lim) x--;
+   w[dy] = x;
+ }
+ return r;
+}
+
+// the same for an ellipse, x*x*ry*ry + dy*dy*rx*rx <= rx*rx*ry*ry + rx*ry*min(rx,ry)
+static uint16_t EllipseTable(int16_t * w, uint16_t rx, uint16_t ry){
+ int64_t rx2, ry2, lim;
+ int32_t x, dy;
+
+ if(ry > SPAN_TABLE_SIZE - 1) ry = SPAN_TABLE_SIZE - 1;
+ rx2 = (int64_t)rx * rx;
+ ry2 = (int64_t)ry * ry;
+ lim = rx2 * ry2 + (int64_t)rx * ry * ((rx < ry) ? rx : ry);
+ x = rx;
+ for(dy = 0; dy <= ry; dy++){
+   while((x > 0) && ((int64_t)x * x * ry2 + (int64_t)dy * dy * rx2 > lim)) x--;
+   w[dy] = x;
+ }
+ return ry;
+}
+
+// one span per line, from the top to the bottom
+static void FillTable(int16_t xL, int16_t xR, int16_t yT, int16_t yB, const int16_t * w, uint16_t n, uint32_t color, SpanFunc span){
+ int16_t dy, y;
+
+ for(dy = n; dy > 0; dy--)
+   span(yT - dy, xL - w[dy], xR + w[dy], color);
+ for(y = yT; y <= yB; y++)
+   span(y, xL - w[0], xR + w[0], color);
+ for(dy = 1; dy <= n; dy++)
+   span(yB + dy, xL - w[dy], xR + w[dy], color);
+}
+
+// the outline is the border of the same fill: the pixels of the line which have
+// no neighbour on the next line out, and the last pixel of the line
+static void OutlineTable(int16_t xL, int16_t xR, int16_t yT, int16_t yB, const int16_t * w, uint16_t n, uint32_t color, SpanFunc span){
+ int16_t dy, y, wNext;
+
+ for(dy = n; dy > 0; dy--){
+   wNext = (dy < n) ? w[dy + 1] : -1;
+   OutlineLine(yT - dy, xL, xR, w[dy], wNext, color, span);
+ }
+ wNext = (n > 0) ? w[1] : -1;
+ OutlineLine(yT, xL, xR, w[0], wNext, color, span);
+ for(y = yT + 1; y < yB; y++){  // straight sides of a rounded rectangle
+   span(y, xL - w[0], xL - w[0], color);
+   if(xR + w[0] != xL - w[0]) span(y, xR + w[0], xR + w[0], color);
+ }
+ if(yB != yT) OutlineLine(yB, xL, xR, w[0], wNext, color, span);
+ for(dy = 1; dy <= n; dy++){
+   wNext = (dy < n) ? w[dy + 1] : -1;
+   OutlineLine(yB + dy, xL, xR, w[dy], wNext, color, span);
+ }
+}
+
+static void OutlineLine(int16_t y, int16_t xL, int16_t xR, int16_t wOut, int16_t wNext, uint32_t color, SpanFunc span){
+ int16_t start;
+
+ start = wNext + 1;
+ if(start > wOut) start = wOut;
+ if(start == 0){ // the outermost line, left and right parts are joined
+   span(y, xL - wOut, xR + wOut, color);
+ }
+ else{
+   span(y, xL - wOut, xL - start, color);
+   span(y, xR + start, xR + wOut, color);
+ }
+}
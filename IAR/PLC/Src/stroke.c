@@ -0,0 +1,162 @@
+#include "stroke.h"
+#include <math.h>
+
+#define CAP_SEGMENTS    16      // the round cap is a 16-gon
+
+static const float CapCos[CAP_SEGMENTS] = {
+ 1.0000000f, 0.9238795f, 0.7071068f, 0.3826834f, 0.0000000f, -0.3826834f, -0.7071068f, -0.9238795f,
+-1.0000000f, -0.9238795f, -0.7071068f, -0.3826834f, 0.0000000f, 0.3826834f, 0.7071068f, 0.9238795f
+};
+static const float CapSin[CAP_SEGMENTS] = {
+ 0.0000000f, 0.3826834f, 0.7071068f, 0.9238795f, 1.0000000f, 0.9238795f, 0.7071068f, 0.3826834f,
+ 0.0000000f, -0.3826834f, -0.7071068f, -0.9238795f, -1.0000000f, -0.9238795f, -0.7071068f, -0.3826834f
+};
+
+static void FillConvex(const float * px, const float * py, uint8_t n, uint32_t color);
+static void StrokeJoin(float x, float y, float uax, float uay, float ubx, float uby, float hw, const StrokeStyle * Style, uint32_t color);
+static void StrokeCap(float x, float y, float hw, uint32_t color);
+
+void LCD_DrawThickLine(int16_t x1, int16_t y1, int16_t x2, int16_t y2, const StrokeStyle * Style){
+ Point Line[2];
+
+ Line[0].X = x1;
+ Line[0].Y = y1;
+ Line[1].X = x2;
+ Line[1].Y = y2;
+ LCD_DrawThickPolyline(Line, 2, Style);
+}
+
+void LCD_DrawThickPolyline(const Point * Points, uint16_t PointCount, const StrokeStyle * Style){
+ const ClipRect * clip = LCD_GetClip();
+ float hw, dx, dy, len, ux, uy, nx, ny, pux = 0, puy = 0, px[4], py[4];
+ int16_t left, right, top, bottom;
+ uint32_t color;
+ uint16_t i, first = 0, last = 0;
+ uint8_t started = 0;
+
+ if((PointCount < 2) || (Style->Width == 0)) return;
+
+ /* the whole stroke is out of the clip */
+ left = right = Points[0].X;
+ top = bottom = Points[0].Y;
+ for(i = 1; i < PointCount; i++){
+   if(Points[i].X < left) left = Points[i].X;
+   if(Points[i].X > right) right = Points[i].X;
+   if(Points[i].Y < top) top = Points[i].Y;
+   if(Points[i].Y > bottom) bottom = Points[i].Y;
+ }
+ if((left - Style->Width > clip->X1) || (right + Style->Width < clip->X0) ||
+    (top - Style->Width > clip->Y1) || (bottom + Style->Width < clip->Y0)) return;
+
+ color = LCD_GetTextColor();
+ hw = Style->Width * 0.5f;
+
+ for(i = 0; i < PointCount - 1; i++){
+   dx = (float)(Points[i + 1].X - Points[i].X);
+   dy = (float)(Points[i + 1].Y - Points[i].Y);
+   len = sqrtf(dx * dx + dy * dy);
+   if(len == 0.0f) continue;    // the same point twice
+   ux = dx / len;
+   uy = dy / len;
+   nx = -uy * hw;
+   ny = ux * hw;
+
+   /* the body of the segment */
+   px[0] = Points[i].X + nx;      py[0] = Points[i].Y + ny;
+   px[1] = Points[i + 1].X + nx;  py[1] = Points[i + 1].Y + ny;
+   px[2] = Points[i + 1].X - nx;  py[2] = Points[i + 1].Y - ny;
+   px[3] = Points[i].X - nx;      py[3] = Points[i].Y - ny;
+   FillConvex(px, py, 4, color);
+
+   if(started) StrokeJoin(Points[i].X, Points[i].Y, pux, puy, ux, uy, hw, Style, color);
+   else first = i;
+   started = 1;
+   last = i + 1;
+   pux = ux;
+   puy = uy;
+ }
+
+ if(started && (Style->Cap == STROKE_CAP_ROUND)){
+   StrokeCap(Points[first].X, Points[first].Y, hw, color);
+   StrokeCap(Points[last].X, Points[last].Y, hw, color);
+ }
+}
+
+/*******************************************************************************
+                            Static Functions
+*******************************************************************************/
+
+/* Pixel centers are on the integer coordinates, a pixel is filled if its center is
+   inside the polygon: ymin <= y < ymax and xl <= x < xr, so the strokes which touch
+   each other don't overlap and don't leave gaps */
+static void FillConvex(const float * px, const float * py, uint8_t n, uint32_t color){
+ const ClipRect * clip = LCD_GetClip();
+ float ymin, ymax, xl, xr, x, y, y0, y1;
+ int32_t line, lineEnd;
+ uint8_t i, j;
+
+ ymin = ymax = py[0];
+ for(i = 1; i < n; i++){
+   if(py[i] < ymin) ymin = py[i];
+   if(py[i] > ymax) ymax = py[i];
+ }
+ line = (int32_t)ceilf(ymin);
+ lineEnd = (int32_t)ceilf(ymax) - 1;
+ if(line < clip->Y0) line = clip->Y0;
+ if(lineEnd > clip->Y1) lineEnd = clip->Y1;
+
+ for(; line <= lineEnd; line++){
+   y = (float)line;
+   xl = 32767.0f;
+   xr = -32768.0f;
+   for(i = 0, j = n - 1; i < n; j = i++){
+     y0 = py[j];
+     y1 = py[i];
+     if(((y0 <= y) && (y < y1)) || ((y1 <= y) && (y < y0))){
+       x = px[j] + (y - y0) * (px[i] - px[j]) / (y1 - y0);
+       if(x < xl) xl = x;
+       if(x > xr) xr = x;
+     }
+   }
+   if(xl < clip->X0) xl = clip->X0;
+   if(xr > clip->X1 + 1) xr = clip->X1 + 1;
+   if(xl < xr) LCD_FillSpan(line, (int16_t)ceilf(xl), (int16_t)ceilf(xr) - 1, color);
+ }
+}
+
+/* ua - the direction of the segment before the point, ub - after it */
+static void StrokeJoin(float x, float y, float uax, float uay, float ubx, float uby, float hw, const StrokeStyle * Style, uint32_t color){
+ float cross, dot, s, k, px[4], py[4];
+
+ cross = uax * uby - uay * ubx;
+ dot = uax * ubx + uay * uby;
+ if((cross < 1e-4f) && (cross > -1e-4f) && (dot > 0.0f)) return; // straight on, no gap
+
+ s = (cross > 0.0f) ? -hw : hw;  // the outer side of the turn
+ px[0] = x;              py[0] = y;
+ px[1] = x - s * uay;    py[1] = y + s * uax;
+
+ /* miter length / width is 1 / cos(turn / 2) = sqrt(2 / (1 + dot)) */
+ if((Style->Join == STROKE_JOIN_MITER) && (dot > -0.999f) &&
+    (2.0f <= Style->MiterLimit * Style->MiterLimit * (1.0f + dot))){
+   k = s / (1.0f + dot);
+   px[2] = x - k * (uay + uby);  py[2] = y + k * (uax + ubx);
+   px[3] = x - s * uby;          py[3] = y + s * ubx;
+   FillConvex(px, py, 4, color);
+ }
+ else{  // bevel
+   px[2] = x - s * uby;          py[2] = y + s * ubx;
+   FillConvex(px, py, 3, color);
+ }
+}
+
+static void StrokeCap(float x, float y, float hw, uint32_t color){
+ float px[CAP_SEGMENTS], py[CAP_SEGMENTS];
+ uint8_t i;
+
+ for(i = 0; i < CAP_SEGMENTS; i++){
+   px[i] = x + hw * CapCos[i];
+   py[i] = y + hw * CapSin[i];
+ }
+ FillConvex(px, py, CAP_SEGMENTS, color);
+}
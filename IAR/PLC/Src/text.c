@@ -0,0 +1,69 @@
+#include "text.h"
+#include "fonts.h"
+
+// CP1251 codes of the three blocks of the code points it has, 0 - not in CP1251
+static const uint8_t Cyrillic[0x60] = {         // U+0400..U+045F
+ 0x00, 0xA8, 0x80, 0x81, 0xAA, 0xBD, 0xB2, 0xAF,
+ 0xA3, 0x8A, 0x8C, 0x8E, 0x8D, 0x00, 0xA1, 0x8F,
+ 0xC0, 0xC1, 0xC2, 0xC3, 0xC4, 0xC5, 0xC6, 0xC7,
+ 0xC8, 0xC9, 0xCA, 0xCB, 0xCC, 0xCD, 0xCE, 0xCF,
+ 0xD0, 0xD1, 0xD2, 0xD3, 0xD4, 0xD5, 0xD6, 0xD7,
+ 0xD8, 0xD9, 0xDA, 0xDB, 0xDC, 0xDD, 0xDE, 0xDF,
+ 0xE0, 0xE1, 0xE2, 0xE3, 0xE4, 0xE5, 0xE6, 0xE7,
+ 0xE8, 0xE9, 0xEA, 0xEB, 0xEC, 0xED, 0xEE, 0xEF,
+ 0xF0, 0xF1, 0xF2, 0xF3, 0xF4, 0xF5, 0xF6, 0xF7,
+ 0xF8, 0xF9, 0xFA, 0xFB, 0xFC, 0xFD, 0xFE, 0xFF,
+ 0x00, 0xB8, 0x90, 0x83, 0xBA, 0xBE, 0xB3, 0xBF,
+ 0xBC, 0x9A, 0x9C, 0x9E, 0x9D, 0x00, 0xA2, 0x9F
+};
+static const uint8_t Latin1[0x20] = {           // U+00A0..U+00BF
+ 0xA0, 0x00, 0x00, 0x00, 0xA4, 0x00, 0xA6, 0xA7,
+ 0x00, 0xA9, 0x00, 0xAB, 0xAC, 0xAD, 0xAE, 0x00,
+ 0xB0, 0xB1, 0x00, 0x00, 0x00, 0xB5, 0xB6, 0xB7,
+ 0x00, 0x00, 0x00, 0xBB, 0x00, 0x00, 0x00, 0x00
+};
+static const uint8_t Punctuation[0x28] = {      // U+2013..U+203A
+ 0x96, 0x97, 0x00, 0x00, 0x00, 0x91, 0x92, 0x82,
+ 0x00, 0x93, 0x94, 0x84, 0x00, 0x86, 0x87, 0x95,
+ 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0x00,
+ 0x00, 0x00, 0x00, 0x00, 0x00, 0x89, 0x00, 0x00,
+ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8B, 0x9B
+};
+
+/* ASCII, the three blocks by their tables, the five other code points one by one */
+uint8_t Text_Cp1251(uint32_t Unicode){
+ uint8_t c = 0;
+
+ if(Unicode < 0x80) return (uint8_t)Unicode;
+ if((Unicode >= 0x0400) && (Unicode <= 0x045F)) c = Cyrillic[Unicode - 0x0400];
+ else if((Unicode >= 0x00A0) && (Unicode <= 0x00BF)) c = Latin1[Unicode - 0x00A0];
+ else if((Unicode >= 0x2013) && (Unicode <= 0x203A)) c = Punctuation[Unicode - 0x2013];
+ else if(Unicode == 0x0490) c = 0xA5;
+ else if(Unicode == 0x0491) c = 0xB4;
+ else if(Unicode == 0x20AC) c = 0x88;
+ else if(Unicode == 0x2116) c = 0xB9;
+ else if(Unicode == 0x2122) c = 0x99;
+ return c ? c : FONT_REPLACEMENT;
+}
+
+uint16_t Text_FromUTF8(uint8_t * Dst, const uint8_t * Utf8, uint16_t Size){
+ uint32_t cp, min;
+ uint16_t n = 0;
+ uint8_t more;
+
+ if(Size == 0) return 0;
+ while(*Utf8 && (n < Size - 1)){
+   cp = *Utf8++;
+   if(cp < 0x80){ more = 0; min = 0; }
+   else if((cp >= 0xC2) && (cp <= 0xDF)){ cp &= 0x1F; more = 1; min = 0x80; }
+   else if((cp & 0xF0) == 0xE0){ cp &= 0x0F; more = 2; min = 0x800; }
+   else if((cp >= 0xF0) && (cp <= 0xF4)){ cp &= 0x07; more = 3; min = 0x10000; }
+   else{ Dst[n++] = FONT_REPLACEMENT; continue; }  // a continuation byte out of place, C0, C1, F5..FF
+   for(; more && ((*Utf8 & 0xC0) == 0x80); more--)
+     cp = (cp << 6) | (*Utf8++ & 0x3F);
+   // cut short, or overlong: a shorter sequence has this code point
+   Dst[n++] = (more || (cp < min)) ? FONT_REPLACEMENT : Text_Cp1251(cp);
+ }
+ Dst[n] = 0;
+ return n;
+}
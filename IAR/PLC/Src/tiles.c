@@ -0,0 +1,90 @@
+#include "tiles.h"
+#include "dma2d_jobs.h"
+
+#define TILE_NOW        0x01    // changed for the frame we draw now
+#define TILE_PREV       0x02    // changed for the frame before, the other layer has it old
+
+__no_init static uint32_t TileBuf[2][TILE_W * TILE_H] @TILE_BUFFERS_ADDR;
+
+static uint8_t Dirty[TILES_Y][TILES_X];
+static uint16_t List[TILES_Y * TILES_X];       // the tiles to draw, index = y * TILES_X + x
+
+uint16_t TilesDrawn = 0;
+
+static uint32_t LoadTile(uint32_t Background, uint16_t Tile, uint8_t Buf);
+static void TileRect(uint16_t Tile, int16_t * x, int16_t * y, uint16_t * w, uint16_t * h);
+
+void Tiles_Invalidate(int16_t x1, int16_t y1, int16_t x2, int16_t y2){
+ int16_t tx, ty;
+
+ if(x1 < 0) x1 = 0;
+ if(y1 < 0) y1 = 0;
+ if(x2 > DisplayWIDTH - 1) x2 = DisplayWIDTH - 1;
+ if(y2 > DisplayHEIGHT - 1) y2 = DisplayHEIGHT - 1;
+ if((x1 > x2) || (y1 > y2)) return;
+
+ for(ty = y1 / TILE_H; ty <= y2 / TILE_H; ty++)
+   for(tx = x1 / TILE_W; tx <= x2 / TILE_W; tx++)
+     Dirty[ty][tx] |= TILE_NOW;
+}
+
+void Tiles_InvalidateAll(void){
+ Tiles_Invalidate(0, 0, DisplayWIDTH - 1, DisplayHEIGHT - 1);
+}
+
+uint16_t Tiles_Render(uint32_t Background, uint32_t Frame, void (*Draw)(void)){
+ uint32_t fence[2];
+ uint16_t n = 0, k, w, h;
+ int16_t x, y, tx, ty;
+ uint8_t buf = 0;
+
+ // a tile is drawn if it has changed in this frame or in the frame before,
+ // the layers are flipped and every one of them has to catch up
+ for(ty = 0; ty < TILES_Y; ty++)
+   for(tx = 0; tx < TILES_X; tx++){
+     if(Dirty[ty][tx]) List[n++] = ty * TILES_X + tx;
+     Dirty[ty][tx] = (Dirty[ty][tx] & TILE_NOW) ? TILE_PREV : 0;
+   }
+ TilesDrawn = n;
+ if(!n) return 0;
+
+ fence[0] = LoadTile(Background, List[0], 0);
+ for(k = 0; k < n; k++){
+   // the background of the next tile goes to the other buffer while we draw this one,
+   // the ring is in order, so it starts after that buffer was flushed
+   if(k + 1 < n) fence[buf ^ 1] = LoadTile(Background, List[k + 1], buf ^ 1);
+   Jobs_Wait(fence[buf]);
+
+   TileRect(List[k], &x, &y, &w, &h);
+   LCD_SetSurface((uint32_t)TileBuf[buf], TILE_W, x, y);
+   if(LCD_ClipPush(x, y, x + w - 1, y + h - 1) == LCD_OK){
+     Draw();
+     LCD_ClipPop();
+   }
+   Jobs_Copy((uint32_t)TileBuf[buf], Frame + 4 * ((uint32_t)y * DisplayWIDTH + x), w, h, TILE_W - w, DisplayWIDTH - w);
+   buf ^= 1;
+ }
+ LCD_ResetSurface();
+ Jobs_WaitIdle();       // the last tiles are in the layer
+ return n;
+}
+
+/*******************************************************************************
+                            Static Functions
+*******************************************************************************/
+
+static uint32_t LoadTile(uint32_t Background, uint16_t Tile, uint8_t Buf){
+ int16_t x, y;
+ uint16_t w, h;
+
+ TileRect(Tile, &x, &y, &w, &h);
+ return Jobs_Copy(Background + 4 * ((uint32_t)y * DisplayWIDTH + x), (uint32_t)TileBuf[Buf], w, h, DisplayWIDTH - w, TILE_W - w);
+}
+
+// the tiles of the right column and the bottom line can be smaller
+static void TileRect(uint16_t Tile, int16_t * x, int16_t * y, uint16_t * w, uint16_t * h){
+ *x = (Tile % TILES_X) * TILE_W;
+ *y = (Tile / TILES_X) * TILE_H;
+ *w = (*x + TILE_W > DisplayWIDTH) ? (DisplayWIDTH - *x) : TILE_W;
+ *h = (*y + TILE_H > DisplayHEIGHT) ? (DisplayHEIGHT - *y) : TILE_H;
+}
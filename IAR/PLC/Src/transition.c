@@ -0,0 +1,155 @@
+#include "transition.h"
+#include "ltdc.h"
+#include "core.h"
+#include "perf.h"
+#include "dma2d_jobs.h"
+#include "ltdc_mon.h"
+
+#define OLD_LAYER               LTDC_LAYER(&hltdc, 0)
+#define NEW_LAYER               LTDC_LAYER(&hltdc, 1)
+
+TransStat TransLast;
+
+// the registers of the second layer, a canvas may be shown there
+typedef struct{
+ uint32_t CR, WHPCR, WVPCR, PFCR, CACR, DCCR, BFCR, CFBAR, CFBLR, CFBLNR;
+}LayerRegs;
+
+static void SetWindow(LTDC_Layer_TypeDef * Layer, uint32_t Address, uint16_t x, uint16_t Width, uint8_t Alpha);
+static void SaveLayer(LTDC_Layer_TypeDef * Layer, LayerRegs * r);
+static void RestoreLayer(LTDC_Layer_TypeDef * Layer, const LayerRegs * r);
+static void Step(uint8_t Type, uint16_t p, uint32_t Old);
+static void WaitReload(void);
+static uint16_t Ease(uint16_t k, uint16_t n);
+
+void Trans_Run(uint8_t Type, uint16_t Frames, void (*Render)(uint32_t Address)){
+ uint32_t old = hltdc.LayerCfg[0].FBStartAdress;     // the screen shown now
+ uint32_t start;
+ LayerRegs saved;
+ uint16_t k;
+
+ TransLast.Frames = 0;
+ TransLast.Missed = 0;
+ TransLast.MaxCycles = 0;
+ start = Perf_Cycles();
+ Render(TRANS_BUFFER);
+ TransLast.RenderCycles = Perf_Cycles() - start;
+
+ // the second layer over the whole screen, hidden till the first step
+ SaveLayer(NEW_LAYER, &saved);
+ NEW_LAYER->CR &= ~(LTDC_LxCR_LEN | LTDC_LxCR_CLUTEN | LTDC_LxCR_COLKEN);   // the overlay may be there
+ NEW_LAYER->WVPCR = OLD_LAYER->WVPCR;
+ NEW_LAYER->PFCR = LTDC_PIXEL_FORMAT_ARGB8888;
+ NEW_LAYER->BFCR = LTDC_BLENDING_FACTOR1_CA | LTDC_BLENDING_FACTOR2_CA;
+ NEW_LAYER->DCCR = 0;
+ NEW_LAYER->CFBLNR = DisplayHEIGHT;
+
+ for(k = 1; k <= Frames; k++)
+   Step(Type, Ease(k, Frames), old);
+
+ // the new layer covers everything now, its picture goes to the old buffer
+ // under it and the old layer takes the whole screen back
+ Jobs_Wait(Jobs_Copy(TRANS_BUFFER, old, DisplayWIDTH, DisplayHEIGHT, 0, 0));
+ SetWindow(OLD_LAYER, old, 0, DisplayWIDTH, hltdc.LayerCfg[0].Alpha);
+ RestoreLayer(NEW_LAYER, &saved);
+ LTDC->SRCR = LTDC_SRCR_VBR;
+ WaitReload();
+}
+
+/*******************************************************************************
+                            Static Functions
+*******************************************************************************/
+
+/* x, Width - the part of the screen the layer shows, Width = 0 switches it off */
+static void SetWindow(LTDC_Layer_TypeDef * Layer, uint32_t Address, uint16_t x, uint16_t Width, uint8_t Alpha){
+ uint32_t ahbp = (LTDC->BPCR & LTDC_BPCR_AHBP) >> 16;
+
+ if(!Width){
+   Layer->CR &= ~LTDC_LxCR_LEN;
+   return;
+ }
+ Layer->WHPCR = (x + ahbp + 1) | ((uint32_t)(x + Width + ahbp) << 16);
+ Layer->CFBAR = Address;
+ Layer->CFBLR = ((uint32_t)DisplayWIDTH * 4 << 16) | (Width * 4 + 3);   // the pitch stays
+ Layer->CACR = Alpha;
+ Layer->CR |= LTDC_LxCR_LEN;
+}
+
+static void SaveLayer(LTDC_Layer_TypeDef * Layer, LayerRegs * r){
+ r->CR = Layer->CR;
+ r->WHPCR = Layer->WHPCR;
+ r->WVPCR = Layer->WVPCR;
+ r->PFCR = Layer->PFCR;
+ r->CACR = Layer->CACR;
+ r->DCCR = Layer->DCCR;
+ r->BFCR = Layer->BFCR;
+ r->CFBAR = Layer->CFBAR;
+ r->CFBLR = Layer->CFBLR;
+ r->CFBLNR = Layer->CFBLNR;
+}
+
+static void RestoreLayer(LTDC_Layer_TypeDef * Layer, const LayerRegs * r){
+ Layer->WHPCR = r->WHPCR;
+ Layer->WVPCR = r->WVPCR;
+ Layer->PFCR = r->PFCR;
+ Layer->CACR = r->CACR;
+ Layer->DCCR = r->DCCR;
+ Layer->BFCR = r->BFCR;
+ Layer->CFBAR = r->CFBAR;
+ Layer->CFBLR = r->CFBLR;
+ Layer->CFBLNR = r->CFBLNR;
+ Layer->CR = r->CR;
+}
+
+/* p - 0...256 of the way */
+static void Step(uint8_t Type, uint16_t p, uint32_t Old){
+ uint16_t w = ((uint32_t)DisplayWIDTH * p) >> 8;       // width of the new screen
+
+ switch(Type){
+   case TRANS_FADE:
+     SetWindow(NEW_LAYER, TRANS_BUFFER, 0, DisplayWIDTH, (p * 255) >> 8);
+     break;
+   case TRANS_SLIDE_LEFT:       // the left part of the new screen at the right side
+     SetWindow(NEW_LAYER, TRANS_BUFFER, DisplayWIDTH - w, w, 255);
+     break;
+   case TRANS_SLIDE_RIGHT:
+     SetWindow(NEW_LAYER, TRANS_BUFFER + 4 * (DisplayWIDTH - w), 0, w, 255);
+     break;
+   case TRANS_PUSH_LEFT:
+     SetWindow(OLD_LAYER, Old + 4 * w, 0, DisplayWIDTH - w, 255);
+     SetWindow(NEW_LAYER, TRANS_BUFFER, DisplayWIDTH - w, w, 255);
+     break;
+   case TRANS_PUSH_RIGHT:
+     SetWindow(OLD_LAYER, Old, w, DisplayWIDTH - w, 255);
+     SetWindow(NEW_LAYER, TRANS_BUFFER + 4 * (DisplayWIDTH - w), 0, w, 255);
+     break;
+   default:
+     SetWindow(NEW_LAYER, TRANS_BUFFER, 0, DisplayWIDTH, 255);
+     break;
+ }
+ LTDC->SRCR = LTDC_SRCR_VBR;    // the shadow registers are loaded in the next vertical blanking
+ WaitReload();
+}
+
+/* VBR is cleared by the LTDC after the reload, once per frame if we are in time */
+static void WaitReload(void){
+ static uint32_t last = 0;
+ uint32_t now, period;
+
+ while(LTDC->SRCR & LTDC_SRCR_VBR){ M_pull()();}
+ now = Perf_Cycles();
+ if(TransLast.Frames && Mon_GetRefresh()){
+   period = SystemCoreClock / Mon_GetRefresh();
+   if(now - last > TransLast.MaxCycles) TransLast.MaxCycles = now - last;
+   if(now - last > period + period / 2) TransLast.Missed++;
+ }
+ TransLast.Frames++;
+ last = now;
+}
+
+/* smoothstep, slow at the start and at the end */
+static uint16_t Ease(uint16_t k, uint16_t n){
+ uint32_t t = ((uint32_t)k << 8) / n;   // 0...256
+
+ return (t * t * (768 - 2 * t)) >> 16;
+}
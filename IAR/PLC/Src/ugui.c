@@ -33,6 +33,7 @@
 /* Static functions */
  UG_RESULT _UG_WindowDrawTitle( UG_WINDOW* wnd );
  void _UG_WindowUpdate( UG_WINDOW* wnd );
+ void _UG_WindowRedrawDamage( UG_WINDOW* wnd );
  UG_RESULT _UG_WindowClear( UG_WINDOW* wnd );
  void _UG_TextboxUpdate(UG_WINDOW* wnd, UG_OBJECT* obj);
  void _UG_ButtonUpdate(UG_WINDOW* wnd, UG_OBJECT* obj);
@@ -4297,6 +4298,8 @@ UG_S16 UG_Init( UG_GUI* g, void (*p)(UG_S16,UG_S16,UG_COLOR), UG_S16 x, UG_S16 y
       g->driver[i].driver = NULL;
       g->driver[i].state = 0;
    }
+   g->damage.xs = 1;
+   g->damage.xe = 0;
 
    gui = g;
    return 1;
@@ -4714,6 +4717,12 @@ void UG_PutChar( char chr, UG_S16 x, UG_S16 y, UG_COLOR fc, UG_COLOR bc )
    p = gui->font.p;
    p+= bt * gui->font.char_height * bn;
 
+   /* Is hardware acceleration available? */
+   if ( gui->driver[DRIVER_PUT_CHAR].state & DRIVER_ENABLED )
+   {
+      if( ((UG_RESULT(*)(UG_S16 x, UG_S16 y, UG_S16 w, UG_S16 h, unsigned char* p, UG_COLOR fc, UG_COLOR bc))gui->driver[DRIVER_PUT_CHAR].driver)(x,y,gui->font.char_width,gui->font.char_height,p,fc,bc) == UG_RESULT_OK ) return;
+   }
+
    for( j=0;j<gui->font.char_height;j++ )
    {
       xo = x;
@@ -4970,29 +4979,34 @@ void _UG_PutText(UG_TEXT* txt)
          if ( char_width % 8 ) bn++;
          p = txt->font->p;
          p+= bt * char_height * bn;
-         for( j=0;j<char_height;j++ )
+         /* Is hardware acceleration available? */
+         if ( !(gui->driver[DRIVER_PUT_CHAR].state & DRIVER_ENABLED) ||
+              (((UG_RESULT(*)(UG_S16 x, UG_S16 y, UG_S16 w, UG_S16 h, unsigned char* p, UG_COLOR fc, UG_COLOR bc))gui->driver[DRIVER_PUT_CHAR].driver)(xp,yp,char_width,char_height,p,txt->fc,txt->bc) != UG_RESULT_OK) )
          {
-            xo = xp;
-            cw=char_width;
-            for( i=0;i<bn;i++ )
+            for( j=0;j<char_height;j++ )
             {
-               b = *p++;
-               for( k=0;(k<8) && cw;k++ )
+               xo = xp;
+               cw=char_width;
+               for( i=0;i<bn;i++ )
                {
-                  if( b & 0x01 )
-                  {
-                     gui->pset(xo,yo,txt->fc);
-                  }
-                  else
+                  b = *p++;
+                  for( k=0;(k<8) && cw;k++ )
                   {
-                     gui->pset(xo,yo,txt->bc);
+                     if( b & 0x01 )
+                     {
+                        gui->pset(xo,yo,txt->fc);
+                     }
+                     else
+                     {
+                        gui->pset(xo,yo,txt->bc);
+                     }
+                     b >>= 1;
+                     xo++;
+                     cw--;
                   }
-                  b >>= 1;
-                  xo++;
-                  cw--;
                }
+               yo++;
             }
-            yo++;
          }
          /*----------------------------------*/
          xp += char_width + char_h_space;
@@ -5255,6 +5269,7 @@ void UG_DriverDisable( UG_U8 type )
 void UG_Update( void )
 {
    UG_WINDOW* wnd;
+   UG_U8 full;
 
    /* Is somebody waiting for this update? */
    if ( gui->state & UG_SATUS_WAIT_FOR_UPDATE ) gui->state &= ~UG_SATUS_WAIT_FOR_UPDATE;
@@ -5288,8 +5303,11 @@ void UG_Update( void )
       wnd = gui->active_window;
 
       /* Does the window need to be updated? */
+      full = 0;
       if ( wnd->state & WND_STATE_UPDATE )
       {
+         /* All of it or the title only? */
+         full = !((wnd->state & WND_STATE_REDRAW_TITLE) && (wnd->style & WND_STYLE_SHOW_TITLE));
          /* Do it! */
          _UG_WindowUpdate( wnd );
       }
@@ -5298,12 +5316,33 @@ void UG_Update( void )
       if ( wnd->state & WND_STATE_VISIBLE )
       {
          _UG_ProcessTouchData( wnd );
+         /* Only the changed part, if the whole window isn't drawn already */
+         if ( !full ) _UG_WindowRedrawDamage( wnd );
          _UG_UpdateObjects( wnd );
          _UG_HandleEvents( wnd );
       }
    }
 }
 
+/* The area is drawn again by the next UG_Update(): the background of the
+   active window and the objects over it, nothing outside of it */
+void UG_Invalidate( UG_S16 xs, UG_S16 ys, UG_S16 xe, UG_S16 ye )
+{
+   if ( (xs > xe) || (ys > ye) ) return;
+   if ( gui->damage.xs > gui->damage.xe )
+   {
+      gui->damage.xs = xs;
+      gui->damage.ys = ys;
+      gui->damage.xe = xe;
+      gui->damage.ye = ye;
+      return;
+   }
+   if ( xs < gui->damage.xs ) gui->damage.xs = xs;
+   if ( ys < gui->damage.ys ) gui->damage.ys = ys;
+   if ( xe > gui->damage.xe ) gui->damage.xe = xe;
+   if ( ye > gui->damage.ye ) gui->damage.ye = ye;
+}
+
 void UG_WaitForUpdate( void )
 {
    gui->state |= UG_SATUS_WAIT_FOR_UPDATE;
@@ -5320,6 +5359,12 @@ void UG_DrawBMP( UG_S16 xp, UG_S16 yp, UG_BMP* bmp )
 
    if ( bmp->p == NULL ) return;
 
+   /* Is hardware acceleration available? */
+   if ( gui->driver[DRIVER_DRAW_BMP].state & DRIVER_ENABLED )
+   {
+      if( ((UG_RESULT(*)(UG_S16 xp, UG_S16 yp, UG_BMP* bmp))gui->driver[DRIVER_DRAW_BMP].driver)(xp,yp,bmp) == UG_RESULT_OK ) return;
+   }
+
    /* Only support 16 BPP so far */
    if ( bmp->bpp == BMP_BPP_16 )
    {
@@ -6072,6 +6117,8 @@ void _UG_WindowUpdate( UG_WINDOW* wnd )
       }
       /* Draw window area? */
       UG_FillFrame(xs,ys,xe,ye,wnd->bc);
+      gui->damage.xs = 1;
+      gui->damage.xe = 0;
 
       /* Force each object to be updated! */
       objcnt = wnd->objcnt;
@@ -6087,6 +6134,70 @@ void _UG_WindowUpdate( UG_WINDOW* wnd )
    }
 }
 
+/* The objects changed by the API since the last update and UG_Invalidate():
+   the bounding box of them is filled with the window color and only the
+   visible objects over it are drawn again, in the order of the list, inside
+   the box (DRIVER_SET_CLIP). The objects which are not touched are not drawn */
+void _UG_WindowRedrawDamage( UG_WINDOW* wnd )
+{
+   UG_U16 i,objcnt;
+   UG_OBJECT* obj;
+   UG_AREA a,d;
+   UG_U8 clip=0;
+
+   UG_WindowGetArea(wnd,&a);
+   objcnt = wnd->objcnt;
+   for(i=0; i<objcnt; i++)
+   {
+      obj = (UG_OBJECT*)&wnd->objlst[i];
+      if ( !(obj->state & OBJ_STATE_FREE) && (obj->state & OBJ_STATE_VALID) && (obj->state & OBJ_STATE_UPDATE) )
+      {
+         obj->a_abs.xs = obj->a_rel.xs + a.xs;
+         obj->a_abs.ys = obj->a_rel.ys + a.ys;
+         obj->a_abs.xe = obj->a_rel.xe + a.xs;
+         obj->a_abs.ye = obj->a_rel.ye + a.ys;
+         /* Not drawn by its update, as it is out of the window */
+         if ( (obj->a_abs.ye >= wnd->ye) || (obj->a_abs.xe >= wnd->xe) ) continue;
+         UG_Invalidate(obj->a_abs.xs, obj->a_abs.ys, obj->a_abs.xe, obj->a_abs.ye);
+      }
+   }
+
+   /* Only the inside of the window */
+   d = gui->damage;
+   gui->damage.xs = 1;
+   gui->damage.xe = 0;
+   if ( d.xs < a.xs ) d.xs = a.xs;
+   if ( d.ys < a.ys ) d.ys = a.ys;
+   if ( d.xe > a.xe ) d.xe = a.xe;
+   if ( d.ye > a.ye ) d.ye = a.ye;
+   if ( (d.xs > d.xe) || (d.ys > d.ye) ) return;
+
+   if ( gui->driver[DRIVER_SET_CLIP].state & DRIVER_ENABLED )
+   {
+      clip = ( ((UG_RESULT(*)(UG_AREA* a))gui->driver[DRIVER_SET_CLIP].driver)(&d) == UG_RESULT_OK );
+   }
+   UG_FillFrame(d.xs,d.ys,d.xe,d.ye,wnd->bc);
+   for(i=0; i<objcnt; i++)
+   {
+      obj = (UG_OBJECT*)&wnd->objlst[i];
+      if ( (obj->state & OBJ_STATE_FREE) || !(obj->state & OBJ_STATE_VALID) ) continue;
+      if ( !(obj->state & OBJ_STATE_VISIBLE) )
+      {
+         /* Hidden, the background is there already */
+         obj->state &= ~OBJ_STATE_UPDATE;
+         continue;
+      }
+      if ( (obj->a_rel.xs + a.xs > d.xe) || (obj->a_rel.xe + a.xs < d.xs) ||
+           (obj->a_rel.ys + a.ys > d.ye) || (obj->a_rel.ye + a.ys < d.ys) ) continue;
+      obj->state |= OBJ_STATE_UPDATE | OBJ_STATE_REDRAW;
+      obj->update(wnd,obj);
+   }
+   if ( clip )
+   {
+      ((UG_RESULT(*)(UG_AREA* a))gui->driver[DRIVER_SET_CLIP].driver)(NULL);
+   }
+}
+
 UG_RESULT _UG_WindowClear( UG_WINDOW* wnd )
 {
    if ( wnd != NULL )
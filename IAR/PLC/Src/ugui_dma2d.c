@@ -0,0 +1,130 @@
+#include "ugui_dma2d.h"
+#include "lcd.h"
+#include "dma2d_jobs.h"
+
+#define UGD_ARGB(c)     (0xFF000000 | (c))      // uGUI colors are RGB888
+
+static uint8_t CharMask[2][UGD_CHAR_BYTES];     // one is expanded while the DMA2D reads the other
+static uint32_t CharFence[2];
+static uint8_t CharNext;
+
+static UG_RESULT FillFrame(UG_S16 x1, UG_S16 y1, UG_S16 x2, UG_S16 y2, UG_COLOR c);
+static UG_RESULT DrawLine(UG_S16 x1, UG_S16 y1, UG_S16 x2, UG_S16 y2, UG_COLOR c);
+static UG_RESULT DrawBMP(UG_S16 xp, UG_S16 yp, UG_BMP * bmp);
+static UG_RESULT PutChar(UG_S16 x, UG_S16 y, UG_S16 w, UG_S16 h, unsigned char * p, UG_COLOR fc, UG_COLOR bc);
+static UG_RESULT SetClip(UG_AREA * a);
+static uint8_t ClipBox(UG_S16 * x1, UG_S16 * y1, UG_S16 * x2, UG_S16 * y2);
+static void CleanForDMA(const void * p, uint32_t Size);
+
+void UGD_Init(UG_GUI * g){
+ UG_Init(g, UGD_PSet, DisplayWIDTH, DisplayHEIGHT);
+ UG_DriverRegister(DRIVER_FILL_FRAME, (void *)FillFrame);
+ UG_DriverRegister(DRIVER_DRAW_LINE, (void *)DrawLine);
+ UG_DriverRegister(DRIVER_DRAW_BMP, (void *)DrawBMP);
+ UG_DriverRegister(DRIVER_PUT_CHAR, (void *)PutChar);
+ UG_DriverRegister(DRIVER_SET_CLIP, (void *)SetClip);
+}
+
+/* the pixel is written by the CPU after the jobs which may cover it */
+void UGD_PSet(UG_S16 x, UG_S16 y, UG_COLOR c){
+ const ClipRect * clip = LCD_GetClip();
+
+ if((x < clip->X0) || (x > clip->X1) || (y < clip->Y0) || (y > clip->Y1)) return;
+ if(!Jobs_Idle()) Jobs_WaitIdle();
+ *(__IO uint32_t *)LCD_SurfaceAddress(x, y) = UGD_ARGB(c);
+}
+
+/*******************************************************************************
+                            Static Functions
+*******************************************************************************/
+
+static UG_RESULT FillFrame(UG_S16 x1, UG_S16 y1, UG_S16 x2, UG_S16 y2, UG_COLOR c){
+ uint16_t w;
+
+ if(!ClipBox(&x1, &y1, &x2, &y2)) return UG_RESULT_OK;
+ w = x2 - x1 + 1;
+ Jobs_Fill(LCD_SurfaceAddress(x1, y1), w, y2 - y1 + 1, LCD_SurfacePitch() - w, UGD_ARGB(c));
+ return UG_RESULT_OK;
+}
+
+/* a fill for the horizontal and the vertical ones, the others are left to uGUI */
+static UG_RESULT DrawLine(UG_S16 x1, UG_S16 y1, UG_S16 x2, UG_S16 y2, UG_COLOR c){
+ if((x1 != x2) && (y1 != y2)) return UG_RESULT_FAIL;
+ return FillFrame(x1, y1, x2, y2, c);
+}
+
+/* RGB565 by the pixel format conversion, ARGB8888 copied */
+static UG_RESULT DrawBMP(UG_S16 xp, UG_S16 yp, UG_BMP * bmp){
+ UG_S16 x1 = xp, y1 = yp, x2 = xp + bmp->width - 1, y2 = yp + bmp->height - 1;
+ uint32_t bytes, src;
+ uint16_t w, pitch = LCD_SurfacePitch();
+
+ if(bmp->bpp == BMP_BPP_16) bytes = 2;
+ else if(bmp->bpp == BMP_BPP_32) bytes = 4;
+ else return UG_RESULT_FAIL;
+ if(!ClipBox(&x1, &y1, &x2, &y2)) return UG_RESULT_OK;
+
+ w = x2 - x1 + 1;
+ CleanForDMA(bmp->p, bytes * bmp->width * bmp->height);
+ src = (uint32_t)bmp->p + bytes * ((uint32_t)(y1 - yp) * bmp->width + (x1 - xp));
+ if(bytes == 2) Jobs_CopyPFC(src, LCD_SurfaceAddress(x1, y1), w, y2 - y1 + 1, bmp->width - w, pitch - w, CM_RGB565);
+ else Jobs_Copy(src, LCD_SurfaceAddress(x1, y1), w, y2 - y1 + 1, bmp->width - w, pitch - w);
+ return UG_RESULT_OK;
+}
+
+/* The bits of the char (LSB first, rows of whole bytes) to an A8 mask, the back
+   color is filled and the mask is blended with the fore color, the DMA2D has no A1 */
+static UG_RESULT PutChar(UG_S16 x, UG_S16 y, UG_S16 w, UG_S16 h, unsigned char * p, UG_COLOR fc, UG_COLOR bc){
+ UG_S16 x1 = x, y1 = y, x2 = x + w - 1, y2 = y + h - 1;
+ uint8_t * mask = CharMask[CharNext], * dst, b = 0;
+ uint16_t i, j, cw, pitch = LCD_SurfacePitch();
+ uint32_t address;
+
+ if((uint32_t)w * h > UGD_CHAR_BYTES) return UG_RESULT_FAIL;
+ if(!ClipBox(&x1, &y1, &x2, &y2)) return UG_RESULT_OK;
+
+ Jobs_Wait(CharFence[CharNext]);        // the mask of two chars ago is read
+ for(j = 0, dst = mask; j < h; j++){
+   for(i = 0; i < w; i++){
+     if(!(i & 7)) b = *p++;
+     *dst++ = (b & 0x01) ? 0xFF : 0x00;
+     b >>= 1;
+   }
+ }
+ CleanForDMA(mask, (uint32_t)w * h);
+
+ cw = x2 - x1 + 1;
+ address = LCD_SurfaceAddress(x1, y1);
+ Jobs_Fill(address, cw, y2 - y1 + 1, pitch - cw, UGD_ARGB(bc));
+ CharFence[CharNext] = Jobs_Blend((uint32_t)mask + (uint32_t)(y1 - y) * w + (x1 - x), address, address,
+                                  cw, y2 - y1 + 1, w - cw, pitch - cw, pitch - cw, CM_A8, UGD_ARGB(fc));
+ CharNext ^= 1;
+ return UG_RESULT_OK;
+}
+
+/* the damage of a window (UG_Update) on the clip stack of lcd.h, 0 - off it */
+static UG_RESULT SetClip(UG_AREA * a){
+ if(!a){
+   LCD_ClipPop();
+   return UG_RESULT_OK;
+ }
+ return (LCD_ClipPush(a->xs, a->ys, a->xe, a->ye) == LCD_OK) ? UG_RESULT_OK : UG_RESULT_FAIL;
+}
+
+/* 0 - nothing of the box is in the clip */
+static uint8_t ClipBox(UG_S16 * x1, UG_S16 * y1, UG_S16 * x2, UG_S16 * y2){
+ const ClipRect * clip = LCD_GetClip();
+
+ if((*x1 > clip->X1) || (*x2 < clip->X0) || (*y1 > clip->Y1) || (*y2 < clip->Y0)) return 0;
+ if(*x1 < clip->X0) *x1 = clip->X0;
+ if(*y1 < clip->Y0) *y1 = clip->Y0;
+ if(*x2 > clip->X1) *x2 = clip->X1;
+ if(*y2 > clip->Y1) *y2 = clip->Y1;
+ return 1;
+}
+
+/* the DMA2D reads the memory, not the cache: whole cache lines of the SRAM */
+static void CleanForDMA(const void * p, uint32_t Size){
+ if(((uint32_t)p & 0xF0000000) != 0x20000000) return;   // the flash is only read, SDRAM is not cached
+ SCB_CleanDCache_by_Addr((uint32_t *)((uint32_t)p & ~31), Size + 32);
+}
@@ -8,6 +8,7 @@
 #include "timer14.h"
 #include "timer13.h"
 #include "ltdc.h"
+#include "transition.h"
 
 #include "lm75.h"
 #include "spi_mem.h"
@@ -28,6 +29,7 @@ GUI_Object* Poly3;
 uint8_t StrDate[11]="25.04.2016";
 uint8_t StrTime[9]="20:00:00";
 uint8_t StrDATA[16][8];
+int32_t NumDATA[3];     // the numbers of Text[5..7], Text[10] and Text[11]
 
 
 
@@ -151,24 +153,25 @@ uint16_t Temp_16;
   Text[2] = GUI_SetObject(TEXT_STRING ,0xFFFFFFFF, 3, 7, 40, 10, StrTime, LEFT_MODE, 1, &GOST_B_23_var,0);   // watch
   Text[3] = GUI_SetObject(TEXT_STRING ,0xFFFFFFFF, 3, 7, 700, 10, StrDate, LEFT_MODE, 1, &GOST_B_23_var,0);   // date
  
-  Itoa(StrDATA[0], PatchParms.Doze);
   Itoa(StrDATA[1], PatchParms.DiapL);
   Itoa(StrDATA[2], PatchParms.Rate);
   Itoa(StrDATA[3], PatchParms.DiapR);
   Temp_16 = PatchParms.DiapR;
   Temp_16 += PatchParms.DiapL;
-  Itoa(StrDATA[4], Temp_16);
+  NumDATA[0] = Temp_16;
+  NumDATA[1] = PatchParms.Doze;
+  NumDATA[2] = PatchParms.Rate;
   
   Text[4] = GUI_SetObject(TEXT_STRING ,0xFFFFFFFF, 3, 7, 500, 82,"1254     -", CENTER_MODE, 2, &RIAD_16pt,0); 
  
-  Text[5] = GUI_SetObject(TEXT_STRING ,0xFFFFFFFF, 3, 7, 735, 90, StrDATA[0], CENTER_MODE, 2, &RIAD_30pt,0);   // DOSE RIGHT
-  Text[6] = GUI_SetObject(TEXT_STRING ,0xFFFFFFFF, 3, 7, 735, 213, StrDATA[4], CENTER_MODE, 2, &RIAD_30pt,0);  // DIAPAZONE RIGHT 
-  Text[7] = GUI_SetObject(TEXT_STRING ,0xFFFFFFFF, 3, 7, 735, 336, StrDATA[2], CENTER_MODE, 2, &RIAD_30pt,0);  // RATE RIGHT
+  Text[5] = GUI_SetObject(NUMBER_TYPE ,0xFFFFFFFF, 3, 9, 735, 90, &NumDATA[1], CENTER_MODE, 2, &RIAD_30pt, 0, 5, 0);   // DOSE RIGHT
+  Text[6] = GUI_SetObject(NUMBER_TYPE ,0xFFFFFFFF, 3, 9, 735, 213, &NumDATA[0], CENTER_MODE, 2, &RIAD_30pt, 0, 5, 0);  // DIAPAZONE RIGHT 
+  Text[7] = GUI_SetObject(NUMBER_TYPE ,0xFFFFFFFF, 3, 9, 735, 336, &NumDATA[2], CENTER_MODE, 2, &RIAD_30pt, 0, 5, 0);  // RATE RIGHT
   
   Text[8] = GUI_SetObject(TEXT_STRING ,0xFFFFFFFF, 3, 7, 335, 340, "", LEFT_MODE, 1, &RIAD_16pt,0); 
   Text[9] = GUI_SetObject(TEXT_STRING ,0xFFFFFFFF, 3, 7, 330, 200, "/", LEFT_MODE, 1, &RIAD_16pt,0);   
-  Text[10] = GUI_SetObject(TEXT_STRING ,0xFFFFFFFF, 3, 7, 335, 260, StrDATA[4], RIGHT_MODE, 4, &RIAD_80pt,0);
-  Text[11] = GUI_SetObject(TEXT_STRING ,0xFFFFFFFF, 3, 7, 330, 120, StrDATA[0], RIGHT_MODE, 4, &RIAD_80pt,0);
+  Text[10] = GUI_SetObject(NUMBER_TYPE ,0xFFFFFFFF, 3, 9, 335, 260, &NumDATA[0], RIGHT_MODE, 4, &RIAD_80pt, 0, 4, 0);  // only the changed digits are redrawn
+  Text[11] = GUI_SetObject(NUMBER_TYPE ,0xFFFFFFFF, 3, 9, 330, 120, &NumDATA[1], RIGHT_MODE, 4, &RIAD_80pt, 0, 4, 0);
 
   Text[12] = GUI_SetObject(TEXT_STRING ,0xFFFFFFFF, 3, 7, 480, 300, StrDATA[1], RIGHT_MODE, 2, &RIAD_40pt,0);
   Text[13] = GUI_SetObject(TEXT_STRING ,0xFFFFFFFF, 3, 7, 588, 300, StrDATA[3], LEFT_MODE, 2, &RIAD_40pt,0);
@@ -198,13 +201,14 @@ if(TimeIsReady){
     TimeIsReady = 0;
   }
   
-  Itoa(StrDATA[0], PatchParms.Doze);
   Itoa(StrDATA[1], PatchParms.DiapL);
   Itoa(StrDATA[2], PatchParms.Rate);
   Itoa(StrDATA[3], PatchParms.DiapR);
   Temp16 = PatchParms.DiapR;
   Temp16 += PatchParms.DiapL;
-  Itoa(StrDATA[4], Temp16);
+  NumDATA[0] = Temp16;
+  NumDATA[1] = PatchParms.Doze;
+  NumDATA[2] = PatchParms.Rate;
  // }
   if(DISP.Event){ 
      switch(DISP.TS_ZoneNumber){
@@ -524,7 +528,10 @@ uint32_t FillStructIMG(uint32_t address, uint16_t startIndex, uint16_t stopIndex
    IMAGES.ImgArray[IMAGES.Number].xsize   = SizesIMG.width;
    IMAGES.ImgArray[IMAGES.Number].ysize   = SizesIMG.height; 
    IMAGES.ImgArray[IMAGES.Number].address = address;
-   address += ((uint32_t)SizesIMG.height ) * ((uint32_t)SizesIMG.width) * 4;
+   IMAGES.ImgArray[IMAGES.Number].clut    = SizesIMG.clut;
+   IMAGES.ImgArray[IMAGES.Number].colors  = SizesIMG.colors;
+   if(SizesIMG.clut) address = SizesIMG.clut + 4 * (uint32_t)SizesIMG.colors;  // L8 and the palette
+   else address += ((uint32_t)SizesIMG.height ) * ((uint32_t)SizesIMG.width) * 4;
    IMAGES.Number++;
   }
   return address;
@@ -741,6 +748,12 @@ void TouchScreen_Handle(void){ //the handle of Touch Screen
 
 void ViewScreen(void){
  uint16_t i;
+#if GUI_TRANSITIONS
+ static uint8_t LastScreen = 0;
+
+ if(DISP.Screen != LastScreen) GUI_Transition((DISP.Screen > LastScreen) ? TRANS_PUSH_LEFT : TRANS_PUSH_RIGHT);
+ LastScreen = DISP.Screen;
+#endif
  i = sizeof(Images);
   Rect1->z_index = 0;
   for(i = 6; i < sizeof(Images)/4; i++ )  {
@@ -13,60 +13,31 @@
 #include "OSDBasic.h"
 #include "OSDinitTable.h"
 #include "DispInfo.h"
+#include "dma2d_jobs.h"
+#include <string.h>
 
 
 volatile DMA2D_Status PLC_DMA2D_Status = {1};
 volatile uint8_t LayerOfView = 0;
 const uint32_t ProjectionLayerAddress[2]={SDRAM_BANK_ADDR + LAYER_1_OFFSET, SDRAM_BANK_ADDR + LAYER_2_OFFSET}; // Were we fill out our objects?
 
+static void LoadBitmapL8(FIL * File, uint8_t * Buf, ImgSize * Size, uint32_t Bits, uint32_t AddressOfImage);
 
+
+/* All _HW_ functions put a job to the DMA2D ring and wait for it, so nothing is
+   dropped when DMA2D is busy, M_pull() is served while waiting */
 uint8_t _HW_DrawLine( int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint32_t c)
 {
+ uint32_t address = LCD_SurfaceAddress(x1, y1);
 
    if ( y1 == y2 )
    {
-  hdma2d.Instance = DMA2D;
-  hdma2d.Init.Mode = DMA2D_R2M;
-  hdma2d.Init.ColorMode = DMA2D_ARGB8888;
-  hdma2d.Init.OutputOffset = 0;
-  hdma2d.XferCpltCallback = Transfer_DMA2D_Completed;
-  HAL_DMA2D_Init(&hdma2d);
- if(PLC_DMA2D_Status.Ready != 0){
-  PLC_DMA2D_Status.Ready = 0;
-  if(HAL_DMA2D_Start_IT(&hdma2d, 
-                        c, /* Color value in Register to Memory DMA2D mode */
-                        ProjectionLayerAddress[LayerOfView] + 4 * ((uint32_t)y1 * DisplayWIDTH + (uint32_t)x1),  /* DMA2D output buffer */
-                        x2-x1+1, /* width of buffer in pixels */
-                        1) /* height of buffer in lines */ 
-     == HAL_OK)
-    {
-    while(PLC_DMA2D_Status.Ready == 0){ M_pull()();}
-     }  
-    }
+    Jobs_Wait(Jobs_Fill(address, x2 - x1 + 1, 1, 0, c));
    }
-
    else if ( x1 == x2 )
    {
- // hdma2d.Instance = DMA2D;
-  hdma2d.Init.Mode = DMA2D_R2M;
-  hdma2d.Init.ColorMode = DMA2D_ARGB8888;
-  hdma2d.Init.OutputOffset = DisplayWIDTH-1;
-  hdma2d.XferCpltCallback = Transfer_DMA2D_Completed;
-  if(HAL_DMA2D_Init(&hdma2d) == HAL_OK){ 
-  if(PLC_DMA2D_Status.Ready != 0){ 
-    PLC_DMA2D_Status.Ready = 0;
-   if(HAL_DMA2D_Start_IT(&hdma2d, 
-                        c, /* Color value in Register to Memory DMA2D mode */
-                        ProjectionLayerAddress[LayerOfView] + 4 * ((uint32_t)y1 * DisplayWIDTH + (uint32_t)x1),  /* DMA2D output buffer */
-                        1 , /* width of buffer in pixels */
-                        y2-y1+1) /* height of buffer in lines */ 
-     == HAL_OK)
-   {
-    while(PLC_DMA2D_Status.Ready == 0){ M_pull()();}
-   } 
+    Jobs_Wait(Jobs_Fill(address, 1, y2 - y1 + 1, LCD_SurfacePitch() - 1, c));
    }
-  }
- }
  else
    {
      return 1;
@@ -84,122 +55,33 @@ void Fill_Background(void){
 }
 
 void _HW_Fill_Finite_Color(uint32_t StartAddress, uint32_t color){
- // hdma2d.Instance = DMA2D;
-  hdma2d.Init.Mode = DMA2D_R2M;
-  hdma2d.Init.ColorMode = DMA2D_ARGB8888;
-   hdma2d.Init.OutputOffset       = 0;
-  hdma2d.XferCpltCallback = Transfer_DMA2D_Completed;
-  HAL_DMA2D_Init(&hdma2d);
-  
-
-  if(HAL_DMA2D_Init(&hdma2d) == HAL_OK){  
-   if(PLC_DMA2D_Status.Ready != 0){
-   PLC_DMA2D_Status.Ready = 0;
-   if(HAL_DMA2D_Start_IT(&hdma2d, 
-                        color, /* Color value in Register to Memory DMA2D mode */
-                        StartAddress,  /* DMA2D output buffer */
-                        DisplayWIDTH, /* width of buffer in pixels */
-                        DisplayHEIGHT) /* height of buffer in lines */ 
-     == HAL_OK)
-    {
-      while(PLC_DMA2D_Status.Ready == 0){ M_pull()();}
-     }  
-  }
-  }
+  Jobs_Wait(Jobs_Fill(StartAddress, DisplayWIDTH, DisplayHEIGHT, 0, color));
 }  
 
 void _HW_Fill_Display_From_Mem(uint32_t SourceAddress, uint32_t DstAddress){
-  
- hdma2d.Init.Mode               = DMA2D_M2M;
- hdma2d.Init.ColorMode          = DMA2D_ARGB8888;
- hdma2d.Init.OutputOffset       = 0;
- hdma2d.XferCpltCallback = Transfer_DMA2D_Completed;
- 
-  hdma2d.LayerCfg[1].AlphaMode = DMA2D_NO_MODIF_ALPHA;
-  hdma2d.LayerCfg[1].InputAlpha = 0xFF;
-  hdma2d.LayerCfg[1].InputColorMode = CM_ARGB8888;
-  hdma2d.LayerCfg[1].InputOffset = 0;
-  hdma2d.Instance          = DMA2D;
-  
-  if(HAL_DMA2D_Init(&hdma2d) == HAL_OK){  
-   if(PLC_DMA2D_Status.Ready != 0){
-   PLC_DMA2D_Status.Ready = 0;
-   if(HAL_DMA2D_ConfigLayer(&hdma2d, 1) == HAL_OK)
-    {
-   if(HAL_DMA2D_Start_IT(&hdma2d, 
-                        SourceAddress, /* Color value in Register to Memory DMA2D mode */
-                        DstAddress,  /* DMA2D output buffer */
-                        DisplayWIDTH, /* width of buffer in pixels */
-                        DisplayHEIGHT) /* height of buffer in lines */ 
-     == HAL_OK)
-    {
-     while(PLC_DMA2D_Status.Ready == 0){ M_pull()();}
-    //  HAL_DMA2D_PollForTransfer(&hdma2d, 10); 
-     }  
-    }
-   }
-  }
+  Jobs_Wait(Jobs_Copy(SourceAddress, DstAddress, DisplayWIDTH, DisplayHEIGHT, 0, 0));
 }
 
 void _HW_Fill_Region(uint32_t DstAddress, uint32_t xSize, uint32_t ySize, uint32_t OffLine, uint32_t color) 
 {
-  /* Register to memory mode with ARGB8888 as color Mode */ 
-   hdma2d.Init.Mode         = DMA2D_R2M;
-   hdma2d.Init.ColorMode    = DMA2D_ARGB8888;
-   hdma2d.Init.OutputOffset = OffLine;      
-   hdma2d.XferCpltCallback = Transfer_DMA2D_Completed;
-   
-  /* DMA2D Initialization */
-
-   if(HAL_DMA2D_Init(&hdma2d) == HAL_OK){ 
-  if(PLC_DMA2D_Status.Ready != 0){
-  PLC_DMA2D_Status.Ready = 0;
-      if (HAL_DMA2D_Start_IT(&hdma2d, color, DstAddress, xSize, ySize) == HAL_OK)
-      {
-    
-    while(PLC_DMA2D_Status.Ready == 0){ M_pull()();}
-       
-   }
-  }
- }
+  Jobs_Wait(Jobs_Fill(DstAddress, xSize, ySize, OffLine, color));
 }
 
 void _HW_Fill_Image(uint32_t SrcAddress, uint32_t DstAddress, uint32_t xSize, uint32_t ySize) 
 {
-  /* Register to memory mode with ARGB8888 as color Mode */ 
-  
-   hdma2d.Init.Mode         = DMA2D_M2M;
-   hdma2d.Init.ColorMode    = DMA2D_ARGB8888;
-   hdma2d.Init.OutputOffset = DisplayWIDTH - xSize;      
-   hdma2d.XferCpltCallback = Transfer_DMA2D_Completed;
-   
-  /* DMA2D Initialization */
-
- if(HAL_DMA2D_Init(&hdma2d) == HAL_OK) 
-  if(PLC_DMA2D_Status.Ready != 0){
-  PLC_DMA2D_Status.Ready = 0;
-      if (HAL_DMA2D_Start_IT(&hdma2d, SrcAddress, DstAddress, xSize, ySize) == HAL_OK)
-      {
-    while(PLC_DMA2D_Status.Ready == 0){ M_pull()();}
-   }
-  }
+  Jobs_Wait(Jobs_Copy(SrcAddress, DstAddress, xSize, ySize, 0, DisplayWIDTH - xSize));
 }
 
-void _HW_Fill_ImageToRAM(uint32_t SrcAddress, uint32_t DstAddress, uint32_t xSize, uint32_t  ySize){
-   hdma2d.Init.Mode             = DMA2D_M2M;
-   hdma2d.Init.ColorMode        = DMA2D_ARGB8888;
-   hdma2d.Init.OutputOffset     = 0;      
-   hdma2d.XferCpltCallback      = Transfer_DMA2D_Completed;
-   
- if(HAL_DMA2D_Init(&hdma2d) == HAL_OK) 
-  if(PLC_DMA2D_Status.Ready != 0){
-  PLC_DMA2D_Status.Ready = 0;
-      if (HAL_DMA2D_Start_IT(&hdma2d, SrcAddress, DstAddress, xSize, ySize) == HAL_OK)
-      {
-   while(PLC_DMA2D_Status.Ready == 0){ M_pull()();}
-   }
-  }
+/* Memory to memory with pixel format conversion to ARGB8888, the source and destination
+   strides are given as line offsets in pixels. Queued after the jobs before it, so it
+   lands on top of them */
+void _HW_Fill_Image_PFC(uint32_t SrcAddress, uint32_t DstAddress, uint32_t xSize, uint32_t ySize, uint32_t SrcOffLine, uint32_t DstOffLine, uint32_t InputColorMode) 
+{
+  Jobs_Wait(Jobs_CopyPFC(SrcAddress, DstAddress, xSize, ySize, SrcOffLine, DstOffLine, InputColorMode));
+}
 
+void _HW_Fill_ImageToRAM(uint32_t SrcAddress, uint32_t DstAddress, uint32_t xSize, uint32_t  ySize){
+  Jobs_Wait(Jobs_Copy(SrcAddress, DstAddress, xSize, ySize, 0, 0));
 }
 
 void LCD_Layers_Init(void){
@@ -233,12 +115,14 @@ ImgSize LoadBitmapFromSD(uint8_t *NameOfFile, uint32_t AddressOfImage)//
 if (res == FR_OK){
   //open the file
   res = f_open(&OurFile,(char const*)NameOfFile,FA_READ);
-  if (res == FR_OK)f_read(&OurFile, pbmp, 30, &br);
+  if (res == FR_OK)f_read(&OurFile, pbmp, 54, &br);
 
  }
  else{
    //   
    Size.height = Size.width =0;
+   Size.clut = 0;
+   Size.colors = 0;
    
    return Size;
  }
@@ -258,6 +142,14 @@ if (res == FR_OK){
   
   /* Read bit/pixel */
   byte_pixel = (*(uint16_t *) (pbmp + 28))/8;   
+  Size.clut = 0;
+  Size.colors = 0;
+  if(byte_pixel == 1){ // palette icon, kept as L8
+    LoadBitmapL8(&OurFile, pbmp, &Size, index, AddressOfImage);
+    f_close(&OurFile);
+    f_mount(NULL, "0:", 0);
+    return Size;
+  }
   /* Set the address */
   
   /* Get the layer pixel format */    
@@ -305,7 +197,7 @@ if (res == FR_OK){
    
 void Transfer_DMA2D_Completed(DMA2D_HandleTypeDef *hdma2d){
   
-  PLC_DMA2D_Status.Ready = 1;
+  Jobs_Next();  // the next job of the ring or Ready = 1
 //  RCC->PLLSAICFGR = 0x44003FC0;
 }
 
@@ -340,4 +232,35 @@ void VideoCAMOnOff(uint8_t NumbCam, uint8_t On){
             HAL_GPIO_WritePin(GPIOH, GPIO_PIN_6, GPIO_PIN_RESET);
             LCD_Video_GPIO_Init();
           }
-}
\ No newline at end of file
+}
+
+/*******************************************************************************
+                            Static Functions
+*******************************************************************************/
+
+/* 8 bit BMP: the indices are copied as they are (L8, bottom-up lines are turned),
+   the palette follows them at a word address, BGR0 -> ARGB8888 */
+static void LoadBitmapL8(FIL * File, uint8_t * Buf, ImgSize * Size, uint32_t Bits, uint32_t AddressOfImage){
+  uint32_t header, colors, psw, line, i;
+  uint32_t * clut;
+  UINT br;
+
+  header = *(uint32_t *)(Buf + 14);
+  colors = *(uint32_t *)(Buf + 46);
+  if((colors == 0) || (colors > 256)) colors = 256;
+  Size->clut = (AddressOfImage + (uint32_t)Size->width * Size->height + 3) & ~3;
+  Size->colors = colors;
+
+  clut = (uint32_t *)Size->clut;
+  f_lseek(File, 14 + header);
+  f_read(File, Buf, 4 * colors, &br);
+  for(i = 0; i < colors; i++)
+    clut[i] = 0xFF000000 | ((uint32_t)Buf[4 * i + 2] << 16) | ((uint32_t)Buf[4 * i + 1] << 8) | Buf[4 * i];
+
+  psw = (Size->width + 3) & ~3;
+  for(line = 0; line < Size->height; line++){
+    f_lseek(File, Bits + psw * (Size->height - 1 - line));
+    f_read(File, Buf, Size->width, &br);
+    memcpy((void *)(AddressOfImage + line * Size->width), Buf, Size->width);
+  }
+}
@@ -0,0 +1,149 @@
+#!/usr/bin/env python3
+"""Converts the 1bpp font tables of IAR/PLC/Src (sFONT) to the run coded format
+of font_rle.c and writes <font>_rle.c next to the source, it is built instead of
+the full table when <font>_FROM is FONT_RLE (fonts.h).
+
+    python3 Tools/font_rle.py IAR/PLC/Src/RIAD_80pt.c [more fonts ...]
+
+Glyph format, rows from the top, a group of equal rows at a time:
+    R  - the row is repeated R times (1..255)
+    N  - spans in the row
+    N pairs of (gap, length): gap - background pixels after the last span
+The rows are checked back against the 1bpp table before anything is written.
+A font which doesn't get smaller (small sizes with thin strokes) is kept as 1bpp.
+"""
+import re
+import sys
+import os
+
+DESC_SIZE = 8   # struct FONT_CHAR_INFO {uint8_t; uint32_t;} with the padding
+
+
+def parse(path):
+    text = open(path, encoding='latin-1').read()
+    bitmaps = re.search(r'const uint8_t (\w+)\[\]\s*=\s*\{(.*?)\n\};', text, re.S)
+    descs = re.search(r'const struct FONT_CHAR_INFO (\w+)\[\]\s*=\s*\{(.*?)\n\};', text, re.S)
+    font = re.search(r'sFONT (\w+)\s*=\s*\{.*?(\d+),\s*/\* Height \*/', text, re.S)
+    if not (bitmaps and descs and font):
+        sys.exit('%s: not a font table' % path)
+    bpp = re.search(r'(\d+),\s*/\* Bpp \*/', text)
+    body = re.sub(r'//[^\n]*|/\*.*?\*/', '', bitmaps.group(2), flags=re.S)
+    data = [int(x, 16) for x in re.findall(r'0x([0-9A-Fa-f]{2})', body)]
+    body = re.sub(r'//[^\n]*|/\*.*?\*/', '', descs.group(2), flags=re.S)
+    chars = [(int(w), int(o)) for w, o in re.findall(r'\{\s*(\d+)\s*,\s*(\d+)\s*\}', body)]
+    return dict(bitmaps=bitmaps.group(1), descs=descs.group(1), name=font.group(1),
+                height=int(font.group(2)), data=data, chars=chars,
+                bpp=int(bpp.group(1)) if bpp and int(bpp.group(1)) > 1 else 1)
+
+
+def rows_of(font, wide, offset):
+    bytes_wide = (wide - 1) // 8 + 1
+    rows = []
+    for y in range(font['height']):
+        line = font['data'][offset + y * bytes_wide: offset + (y + 1) * bytes_wide]
+        rows.append([(line[x >> 3] >> (7 - (x & 7))) & 1 for x in range(wide)])
+    return rows
+
+
+def spans_of(row):
+    spans, x = [], 0
+    while x < len(row):
+        if row[x]:
+            start = x
+            while x < len(row) and row[x]:
+                x += 1
+            spans.append((start, x - start))
+        else:
+            x += 1
+    return spans
+
+
+def encode(rows):
+    out, y = [], 0
+    while y < len(rows):
+        r = 1
+        while y + r < len(rows) and rows[y + r] == rows[y] and r < 255:
+            r += 1
+        spans = spans_of(rows[y])
+        if len(spans) > 255:
+            sys.exit('too many spans in a row')
+        out += [r, len(spans)]
+        last = 0
+        for start, length in spans:
+            out += [start - last, length]
+            last = start + length
+        y += r
+    return out
+
+
+def decode(code, wide, height):
+    rows, p = [], 0
+    while len(rows) < height:
+        r, n = code[p], code[p + 1]
+        p += 2
+        row, x = [0] * wide, 0
+        for i in range(n):
+            x += code[p]
+            for k in range(code[p + 1]):
+                row[x + k] = 1
+            x += code[p + 1]
+            p += 2
+        rows += [row] * r
+    return rows
+
+
+def convert(path):
+    font = parse(path)
+    if font['bpp'] > 1:
+        sys.exit('%s: %d bpp, only 1bpp fonts are run coded' % (path, font['bpp']))
+    stream, offsets = [], []
+    for wide, offset in font['chars']:
+        offsets.append(len(stream))
+        if wide == 0:
+            continue
+        rows = rows_of(font, wide, offset)
+        code = encode(rows)
+        if decode(code, wide, font['height']) != rows:
+            sys.exit('%s: the code of a glyph doesn\'t decode back' % path)
+        stream += code
+
+    name = font['name']
+    old = len(font['data'])
+    new = len(stream)
+    if new >= old:
+        print('%-16s 1bpp %7d bytes, run coded %7d bytes, kept as 1bpp' % (name, old, new))
+        return old, old
+
+    out = os.path.splitext(path)[0] + '_rle.c'
+    with open(out, 'w', encoding='latin-1', newline='\n') as f:
+        f.write('// \n//  %s, run coded by Tools/font_rle.py from %s, don\'t edit\n// \n'
+                % (name, os.path.basename(path)))
+        f.write('#include "variables.h"\n#include "fonts.h"\n\n#if %s_FROM == FONT_RLE\n' % name)
+        f.write('const uint8_t %sRLE[] = \n{\n' % name)
+        for i, (wide, offset) in enumerate(font['chars']):
+            end = offsets[i + 1] if i + 1 < len(offsets) else len(stream)
+            code = stream[offsets[i]:end]
+            f.write('\t// @%d 0x%02X (%d pixels wide)\n' % (offsets[i], 0x20 + i, wide))
+            for k in range(0, len(code), 16):
+                f.write('\t' + ' '.join('0x%02X,' % b for b in code[k:k + 16]) + '\n')
+        f.write('};\n\nconst struct FONT_CHAR_INFO %sRLEDescriptors[] = \n{\n' % name)
+        for i, (wide, offset) in enumerate(font['chars']):
+            f.write('\t{%d, %d}, \t\t// 0x%02X\n' % (wide, offsets[i], 0x20 + i))
+        f.write('};\n\nsFONT %s = {\n  0,\n  %sRLEDescriptors,\n  %d, /* Height */\n  %sRLE,\n};\n#endif\n'
+                % (name, name, font['height'], name))
+
+    print('%-16s 1bpp %7d bytes, run coded %7d bytes, %5.1f %%, descriptors %d bytes as before'
+          % (name, old, new, 100.0 * new / old, DESC_SIZE * len(font['chars'])))
+    return old, new
+
+
+if __name__ == '__main__':
+    if len(sys.argv) < 2:
+        sys.exit(__doc__)
+    total_old = total_new = 0
+    for path in sys.argv[1:]:
+        old, new = convert(path)
+        total_old += old
+        total_new += new
+    print('%-16s 1bpp %7d bytes, run coded %7d bytes, %d bytes of flash saved'
+          % ('all', total_old, total_new, total_old - total_new))
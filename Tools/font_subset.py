@@ -0,0 +1,124 @@
+#!/usr/bin/env python3
+"""Keeps only the signs a font is used for and writes <font>_sub.c next to the
+source, it is built instead of the full table when <font>_FROM is FONT_SUBSET (fonts.h).
+
+    python3 Tools/font_subset.py IAR/PLC/Src/RIAD_80pt.c --chars "- .0-9" --rle
+    python3 Tools/font_subset.py IAR/PLC/Src/RIAD_16pt.c --scan IAR/PLC/Src/*.c --chars 0-9
+
+--chars   the characters to keep, a-b is a range, 0xC0-0xFF too, '-' itself goes first
+--scan    C sources: the characters of the string literals on the lines which
+          name the font (&RIAD_16pt) are kept. The strings made at run time
+          (Itoa, the clock) are not seen, give their characters in --chars
+--replace the sign drawn for the codes which are not kept, '?' if not given
+--rle     run code the kept signs (1bpp only), see font_rle.py
+
+The descriptors are the kept signs only, map[256] gives the index of the sign
+of every code (FONT_INFO in fonts.h), the codes which are not kept get the
+replacement sign, so there is no read out of the table for any code.
+"""
+import argparse
+import glob
+import os
+import re
+import sys
+
+import font_rle
+
+FIRST_CODE = 0x20
+
+
+def chars_of(text):
+    keep = set()
+    for part in re.findall(r'0x[0-9A-Fa-f]+-0x[0-9A-Fa-f]+|.-.|.', text, re.S):
+        if part.startswith('0x'):
+            a, b = part.split('-')
+            keep.update(range(int(a, 16), int(b, 16) + 1))
+        elif len(part) == 3:
+            keep.update(range(ord(part[0]), ord(part[2]) + 1))
+        else:
+            keep.add(ord(part))
+    return keep
+
+
+def scan(files, name):
+    """the CP1251 bytes of the string literals on the lines which use the font"""
+    keep = set()
+    for pattern in files:
+        for path in glob.glob(pattern):
+            for line in open(path, encoding='latin-1'):
+                if re.search(r'&\s*%s\b' % re.escape(name), line):
+                    for literal in re.findall(r'"((?:[^"\\]|\\.)*)"', line.split('//')[0]):
+                        keep.update(ord(c) for c in literal)
+    return keep
+
+
+def sign_bytes(font, wide):
+    return ((wide * font['bpp'] - 1) // 8 + 1) * font['height']
+
+
+def main():
+    ap = argparse.ArgumentParser(description='font subset')
+    ap.add_argument('font')
+    ap.add_argument('--chars', default='')
+    ap.add_argument('--scan', nargs='*', default=[])
+    ap.add_argument('--replace', default='?')
+    ap.add_argument('--rle', action='store_true')
+    args = ap.parse_args()
+
+    font = font_rle.parse(args.font)
+    name = font['name']
+    if args.rle and font['bpp'] > 1:
+        sys.exit('%s: %d bpp, only 1bpp fonts are run coded' % (args.font, font['bpp']))
+    keep = chars_of(args.chars) | scan(args.scan, name)
+    keep = sorted(c for c in keep if FIRST_CODE <= c < 256 and font['chars'][c - FIRST_CODE][0])
+    replace = ord(args.replace)
+    if not font['chars'][replace - FIRST_CODE][0]:
+        sys.exit('%s: no sign for the replacement %r' % (args.font, args.replace))
+    if replace not in keep:
+        keep.append(replace)
+
+    index, signs, data = {}, [], []
+    for c in keep:
+        wide, offset = font['chars'][c - FIRST_CODE]
+        index[c] = len(signs)
+        signs.append((c, wide, len(data)))
+        if args.rle:
+            rows = font_rle.rows_of(font, wide, offset)
+            code = font_rle.encode(rows)
+            if font_rle.decode(code, wide, font['height']) != rows:
+                sys.exit('%s: the code of a glyph doesn\'t decode back' % args.font)
+            data += code
+        else:
+            data += font['data'][offset:offset + sign_bytes(font, wide)]
+    code_map = [index.get(c, index[replace]) for c in range(256)]
+
+    out = os.path.splitext(args.font)[0] + '_sub.c'
+    with open(out, 'w', encoding='latin-1', newline='\n') as f:
+        f.write('// \n//  %s, %d signs of %s%s, made by Tools/font_subset.py, don\'t edit\n// \n'
+                % (name, len(signs), os.path.basename(args.font), ' run coded' if args.rle else ''))
+        f.write('#include "variables.h"\n#include "fonts.h"\n\n#if %s_FROM == FONT_SUBSET\n' % name)
+        f.write('static const uint8_t Signs[] = \n{\n')
+        for i, (c, wide, offset) in enumerate(signs):
+            end = signs[i + 1][2] if i + 1 < len(signs) else len(data)
+            f.write('\t// @%d 0x%02X (%d pixels wide)\n' % (offset, c, wide))
+            for k in range(offset, end, 16):
+                f.write('\t' + ' '.join('0x%02X,' % b for b in data[k:min(k + 16, end)]) + '\n')
+        f.write('};\n\nstatic const struct FONT_CHAR_INFO Descriptors[] = \n{\n')
+        for c, wide, offset in signs:
+            f.write('\t{%d, %d}, \t\t// 0x%02X\n' % (wide, offset, c))
+        f.write('};\n\n// the sign of every code, 0x%02X for the codes which are not here\n' % replace)
+        f.write('static const uint8_t Map[256] = \n{\n')
+        for k in range(0, 256, 16):
+            f.write('\t' + ' '.join('%3d,' % v for v in code_map[k:k + 16]) + '\n')
+        f.write('};\n\nsFONT %s = {\n' % name)
+        f.write('  %s,\n  Descriptors,\n  %d, /* Height */\n  %s,\n  %d, /* Bpp */\n  Map,\n};\n#endif\n'
+                % ('0' if args.rle else 'Signs', font['height'], 'Signs' if args.rle else '0', font['bpp']))
+
+    full = len(font['data']) + font_rle.DESC_SIZE * len(font['chars'])
+    sub = len(data) + font_rle.DESC_SIZE * len(signs) + 256
+    print('%-16s %3d signs: %7d bytes, subset %7d bytes (%d signs%s, map 256 bytes)'
+          % (name, sum(1 for w, o in font['chars'] if w), full, sub, len(signs), ', run coded' if args.rle else ''))
+
+
+if __name__ == '__main__':
+    main()
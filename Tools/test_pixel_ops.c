@@ -0,0 +1,93 @@
+/* Checks the pixel kernels of pixel_ops.c against their Pix_*_Ref versions on the host:
+
+    gcc -O2 -Wall -DSTM32F746xx -DUSE_HAL_DRIVER -IIAR/PLC/Inc \
+        -IIAR/PLC/Drivers/STM32F7xx_HAL_Driver/Inc -isystem IAR/PLC/Drivers/CMSIS/Include \
+        -isystem IAR/PLC/Drivers/CMSIS/Device/ST/STM32F7xx/Include \
+        Tools/test_pixel_ops.c -o test_pixel_ops && ./test_pixel_ops
+
+   Every RGB888 color from every byte alignment of the source, and random lines
+   of pixels and keys, every length up to TEST_LINE. Exit code 0 - all the same
+   bits, 1 - a mismatch (printed). */
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include "../IAR/PLC/Src/pixel_ops.c"
+
+#define TEST_LINE               67      // odd, the tails of the loops of two and four pixels
+#define TEST_RANDOM_LINES       200000
+
+static uint32_t Seed = 0x12345678;
+static uint32_t Fails;
+
+static uint32_t Random(void){  // xorshift32
+ Seed ^= Seed << 13;
+ Seed ^= Seed >> 17;
+ Seed ^= Seed << 5;
+ return Seed;
+}
+
+static void Compare(const char * Kernel, const uint32_t * Fast, const uint32_t * Ref, uint32_t Count){
+ uint32_t i;
+
+ for(i = 0; i < Count; i++)
+   if((Fast[i] != Ref[i]) && (Fails++ < 16))
+     printf("%s: pixel %u: 0x%08X, ref 0x%08X\n", Kernel, i, Fast[i], Ref[i]);
+}
+
+/* all the colors, 256 per line, the line starts at every byte of a word */
+static void Exhaustive(void){
+ static uint8_t src[3 * 256 + 4];
+ uint32_t fast[256], ref[256], c, i, a;
+
+ for(a = 0; a < 4; a++)
+   for(c = 0; c < 0x1000000; c += 256){
+     for(i = 0; i < 256; i++){
+       src[a + 3 * i] = (uint8_t)(c + i);
+       src[a + 3 * i + 1] = (uint8_t)(c >> 8);
+       src[a + 3 * i + 2] = (uint8_t)(c >> 16);
+     }
+     Pix_RGB888ToARGB8888(fast, src + a, 256);
+     Pix_RGB888ToARGB8888_Ref(ref, src + a, 256);
+     Compare("Pix_RGB888ToARGB8888", fast, ref, 256);
+   }
+}
+
+/* random lines, every length and source alignment, key pixels with any alpha */
+static void Randomized(void){
+ uint32_t src[TEST_LINE], dst[TEST_LINE], fast[TEST_LINE], ref[TEST_LINE];
+ uint8_t bytes[3 * TEST_LINE + 4];
+ uint32_t n, i, key, count, start;
+
+ for(n = 0; n < TEST_RANDOM_LINES; n++){
+   count = n % (TEST_LINE + 1);
+   start = (n / (TEST_LINE + 1)) & 3;
+   key = Random();
+   for(i = 0; i < count; i++){
+     src[i] = Random();
+     dst[i] = Random();
+     if(!(Random() & 3)) src[i] = (key & 0x00FFFFFF) | (src[i] & 0xFF000000);
+   }
+   for(i = 0; i < sizeof(bytes); i++) bytes[i] = (uint8_t)Random();
+
+   memcpy(fast, dst, count * 4);
+   memcpy(ref, dst, count * 4);
+   Pix_ColorKey(fast, src, count, key);
+   Pix_ColorKey_Ref(ref, src, count, key);
+   Compare("Pix_ColorKey", fast, ref, count);
+
+   Pix_RGB888ToARGB8888(fast, bytes + start, count);
+   Pix_RGB888ToARGB8888_Ref(ref, bytes + start, count);
+   Compare("Pix_RGB888ToARGB8888", fast, ref, count);
+ }
+}
+
+int main(void){
+ Exhaustive();
+ Randomized();
+ if(Fails){
+   printf("%u mismatches\n", Fails);
+   return 1;
+ }
+ printf("pixel_ops: all the same bits\n");
+ return 0;
+}
@@ -0,0 +1,362 @@
+#!/usr/bin/env python3
+"""Rasterizes a TrueType font to the sFONT tables of IAR/PLC (fonts.h), or to a
+font file which Font_Load (files.c) reads from the SD card.
+
+    python3 Tools/ttf2font.py IAR/PLC/Additions/MyRiadmod.ttf --size 40 --name RIAD_28pt
+    python3 Tools/ttf2font.py arialbdmod.ttf --size 24 --bpp 4 --name ARIALB_4bpp --bin ARIALB.FNT
+    python3 Tools/ttf2font.py MyRiadmod.ttf --size 24 --chars 0x20-0x7F,0xC0-0xFF ...
+
+--size     pixels per em, the Height of the font comes from the ascender and descender
+--bpp      1, 2 or 4 bits per pixel, 2 and 4 are the coverage of the pixel (anti-aliased)
+--chars    the codes to keep, the others are in the table with Wide 0
+--codepage the codes are CP1251 (default), 'none' - the code is the character itself.
+           A character which is not in the font is looked up by the code itself, the
+           *mod.ttf of Additions keep the Cyrillic letters on their CP1251 codes
+
+The signs are cells of Wide x Height pixels, Wide is the advance width of the
+character rounded to pixels, the baseline is the rounded ascender. The rows of a
+sign are byte aligned, the pixels are MSB first (4bpp - the first pixel in the low
+nibble, the order of DMA2D A4), so the 1bpp output is the format of the existing
+RIAD_*pt.c and can be run coded by font_rle.py. The outlines are not
+hinted, a pixel is the coverage of 4 x 4 samples (1bpp - at least half of them).
+
+Font file (little endian, all the fields aligned as in the firmware):
+    0   'FNT1'
+    4   uint8  bpp
+    5   uint8  0
+    6   uint16 Height
+    8   uint16 the first code (0x20)
+    10  uint16 count of the codes (224)
+    12  uint32 bytes of the bitmaps
+    16  count x struct FONT_CHAR_INFO {uint8 Wide, 3 x 0, uint32 Offset}
+    ..  bitmaps
+"""
+import argparse
+import math
+import struct
+import sys
+
+FIRST_CODE = 0x20
+CODES = 224             # the tables are indexed by code - ' '
+SS = 4                  # samples per pixel in x and y
+
+
+class TrueType:
+    def __init__(self, path):
+        self.data = open(path, 'rb').read()
+        count = struct.unpack_from('>H', self.data, 4)[0]
+        self.tables = {}
+        for i in range(count):
+            tag, _, offset, length = struct.unpack_from('>4sIII', self.data, 12 + 16 * i)
+            self.tables[tag.decode('latin-1')] = offset
+        for tag in ('head', 'hhea', 'hmtx', 'maxp', 'loca', 'glyf', 'cmap'):
+            if tag not in self.tables:
+                sys.exit('%s: no %s table, only TrueType outlines are supported' % (path, tag))
+        head = self.tables['head']
+        self.units = struct.unpack_from('>H', self.data, head + 18)[0]
+        self.long_loca = struct.unpack_from('>h', self.data, head + 50)[0]
+        hhea = self.tables['hhea']
+        self.ascender, self.descender = struct.unpack_from('>hh', self.data, hhea + 4)
+        self.metrics = struct.unpack_from('>H', self.data, hhea + 34)[0]
+        self.glyphs = struct.unpack_from('>H', self.data, self.tables['maxp'] + 4)[0]
+        self.cmap = self.read_cmap()
+
+    def read_cmap(self):
+        base = self.tables['cmap']
+        count = struct.unpack_from('>H', self.data, base + 2)[0]
+        best = None
+        for i in range(count):
+            platform, encoding, offset = struct.unpack_from('>HHI', self.data, base + 4 + 8 * i)
+            fmt = struct.unpack_from('>H', self.data, base + offset)[0]
+            if fmt == 4 and (platform == 0 or (platform == 3 and encoding in (0, 1))):
+                best = base + offset
+        if best is None:
+            sys.exit('no unicode cmap of format 4')
+        segs = struct.unpack_from('>H', self.data, best + 6)[0] // 2
+        ends = best + 14
+        starts = ends + 2 * segs + 2
+        deltas = starts + 2 * segs
+        ranges = deltas + 2 * segs
+        cmap = {}
+        for s in range(segs):
+            end = struct.unpack_from('>H', self.data, ends + 2 * s)[0]
+            start = struct.unpack_from('>H', self.data, starts + 2 * s)[0]
+            delta = struct.unpack_from('>h', self.data, deltas + 2 * s)[0]
+            offset = struct.unpack_from('>H', self.data, ranges + 2 * s)[0]
+            for c in range(start, end + 1):
+                if c == 0xFFFF:
+                    continue
+                if offset == 0:
+                    g = (c + delta) & 0xFFFF
+                else:
+                    p = ranges + 2 * s + offset + 2 * (c - start)
+                    g = struct.unpack_from('>H', self.data, p)[0]
+                    if g:
+                        g = (g + delta) & 0xFFFF
+                if g:
+                    cmap[c] = g
+        return cmap
+
+    def advance(self, glyph):
+        hmtx = self.tables['hmtx']
+        return struct.unpack_from('>H', self.data, hmtx + 4 * min(glyph, self.metrics - 1))[0]
+
+    def location(self, glyph):
+        loca = self.tables['loca']
+        if self.long_loca:
+            a, b = struct.unpack_from('>II', self.data, loca + 4 * glyph)
+        else:
+            a, b = struct.unpack_from('>HH', self.data, loca + 2 * glyph)
+            a, b = 2 * a, 2 * b
+        return self.tables['glyf'] + a, b - a
+
+    def contours(self, glyph, depth=0):
+        """the contours in font units, lists of (x, y, on curve)"""
+        offset, length = self.location(glyph)
+        if length == 0 or depth > 8:
+            return []
+        n = struct.unpack_from('>h', self.data, offset)[0]
+        if n < 0:
+            return self.composite(offset + 10, depth)
+        ends = struct.unpack_from('>%dH' % n, self.data, offset + 10)
+        points = ends[-1] + 1 if n else 0
+        p = offset + 10 + 2 * n
+        p += 2 + struct.unpack_from('>H', self.data, p)[0]      # the instructions
+        flags = []
+        while len(flags) < points:
+            f = self.data[p]
+            p += 1
+            flags.append(f)
+            if f & 8:
+                flags += [f] * self.data[p]
+                p += 1
+        xs, ys = [], []
+        for coords, short, same in ((xs, 2, 16), (ys, 4, 32)):
+            v = 0
+            for f in flags:
+                if f & short:
+                    d = self.data[p]
+                    p += 1
+                    v += d if f & same else -d
+                elif not f & same:
+                    v += struct.unpack_from('>h', self.data, p)[0]
+                    p += 2
+                coords.append(v)
+        result, first = [], 0
+        for end in ends:
+            result.append([(xs[i], ys[i], flags[i] & 1) for i in range(first, end + 1)])
+            first = end + 1
+        return result
+
+    def composite(self, p, depth):
+        result = []
+        while True:
+            flags, glyph = struct.unpack_from('>HH', self.data, p)
+            p += 4
+            if flags & 1:
+                dx, dy = struct.unpack_from('>hh', self.data, p)
+                p += 4
+            else:
+                dx, dy = struct.unpack_from('>bb', self.data, p)
+                p += 2
+            if not flags & 2:
+                dx = dy = 0     # point matching, not used by these fonts
+            a, b, c, d = 1.0, 0.0, 0.0, 1.0
+            if flags & 8:
+                a = d = struct.unpack_from('>h', self.data, p)[0] / 16384.0
+                p += 2
+            elif flags & 0x40:
+                a, d = [v / 16384.0 for v in struct.unpack_from('>hh', self.data, p)]
+                p += 4
+            elif flags & 0x80:
+                a, b, c, d = [v / 16384.0 for v in struct.unpack_from('>hhhh', self.data, p)]
+                p += 8
+            for contour in self.contours(glyph, depth + 1):
+                result.append([(a * x + c * y + dx, b * x + d * y + dy, on) for x, y, on in contour])
+            if not flags & 0x20:
+                return result
+
+
+def edges_of(contours, scale, baseline):
+    """line segments in pixels, y down, the curves are split by their length"""
+    edges = []
+    for contour in contours:
+        pts = [(x * scale, baseline - y * scale, on) for x, y, on in contour]
+        if not pts:
+            continue
+        # the points on the curve between two control points are implied
+        full = []
+        for i, p in enumerate(pts):
+            q = pts[i - 1]
+            if not p[2] and not q[2]:
+                full.append(((p[0] + q[0]) / 2, (p[1] + q[1]) / 2, 1))
+            full.append(p)
+        start = next((i for i, p in enumerate(full) if p[2]), None)
+        if start is None:
+            continue
+        full = full[start:] + full[:start]
+        prev = full[0]
+        i = 1
+        while i <= len(full):
+            p = full[i % len(full)]
+            if p[2]:
+                edges.append((prev[0], prev[1], p[0], p[1]))
+                prev = p
+                i += 1
+                continue
+            end = full[(i + 1) % len(full)]
+            steps = max(2, int(math.hypot(end[0] - prev[0], end[1] - prev[1]) / 2))
+            last = prev
+            for k in range(1, steps + 1):
+                t = k / steps
+                x = (1 - t) ** 2 * prev[0] + 2 * t * (1 - t) * p[0] + t * t * end[0]
+                y = (1 - t) ** 2 * prev[1] + 2 * t * (1 - t) * p[1] + t * t * end[1]
+                edges.append((last[0], last[1], x, y))
+                last = (x, y)
+            prev = end
+            i += 2
+    return edges
+
+
+def rasterize(edges, wide, height):
+    """coverage 0..SS*SS of every pixel, nonzero winding"""
+    cover = []
+    for row in range(height):
+        diff = [0] * (wide * SS + 1)
+        for sub in range(SS):
+            yc = row + (sub + 0.5) / SS
+            cross = []
+            for x0, y0, x1, y1 in edges:
+                if (y0 <= yc < y1) or (y1 <= yc < y0):
+                    cross.append((x0 + (yc - y0) * (x1 - x0) / (y1 - y0), 1 if y1 > y0 else -1))
+            cross.sort()
+            winding = 0
+            for k in range(len(cross) - 1):
+                winding += cross[k][1]
+                if winding:
+                    a = max(0, math.ceil(cross[k][0] * SS - 0.5))
+                    b = min(wide * SS, math.ceil(cross[k + 1][0] * SS - 0.5))
+                    if a < b:
+                        diff[a] += 1
+                        diff[b] -= 1
+        line, run = [0] * wide, 0
+        for s in range(wide * SS):
+            run += diff[s]
+            line[s // SS] += run
+        cover.append(line)
+    return cover
+
+
+def pack(cover, bpp):
+    top = (1 << bpp) - 1
+    out = []
+    for line in cover:
+        bits, n = 0, 0
+        for c in line:
+            if bpp == 1:
+                v = 1 if 2 * c >= SS * SS else 0
+            else:
+                v = (c * top + SS * SS // 2) // (SS * SS)
+            if bpp == 4:
+                bits |= v << n  # the first pixel in the low nibble, as DMA2D A4 reads it
+            else:
+                bits = (bits << bpp) | v
+            n += bpp
+            if n == 8:
+                out.append(bits)
+                bits, n = 0, 0
+        if n:
+            out.append(bits if bpp == 4 else bits << (8 - n))
+    return out
+
+
+def codes_of(text):
+    keep = set()
+    for part in text.split(','):
+        a, _, b = part.partition('-')
+        a = int(a, 0)
+        keep.update(range(a, int(b, 0) + 1 if b else a + 1))
+    return keep
+
+
+def main():
+    ap = argparse.ArgumentParser(description='TrueType to sFONT')
+    ap.add_argument('ttf')
+    ap.add_argument('--size', type=float, required=True, help='pixels per em')
+    ap.add_argument('--bpp', type=int, default=1, choices=(1, 2, 4))
+    ap.add_argument('--name', required=True, help='the sFONT name, RIAD_28pt')
+    ap.add_argument('--chars', default='0x20-0xFF')
+    ap.add_argument('--codepage', default='cp1251')
+    ap.add_argument('--out', help='the C file, IAR/PLC/Src/<name>.c if no --bin')
+    ap.add_argument('--bin', help='the font file for the SD card')
+    args = ap.parse_args()
+
+    font = TrueType(args.ttf)
+    scale = args.size / font.units
+    baseline = round(font.ascender * scale)
+    height = baseline + round(-font.descender * scale)
+    keep = codes_of(args.chars)
+
+    bitmaps, chars = [], []
+    for code in range(FIRST_CODE, FIRST_CODE + CODES):
+        glyph = None
+        if args.codepage != 'none':
+            try:
+                glyph = font.cmap.get(ord(bytes([code]).decode(args.codepage)))
+            except UnicodeDecodeError:
+                pass
+        if glyph is None:
+            glyph = font.cmap.get(code)
+        if code not in keep or glyph is None:
+            chars.append((0, len(bitmaps)))
+            continue
+        wide = round(font.advance(glyph) * scale)
+        if wide <= 0 or wide > 255:
+            chars.append((0, len(bitmaps)))
+            continue
+        cover = rasterize(edges_of(font.contours(glyph), scale, baseline), wide, height)
+        chars.append((wide, len(bitmaps)))
+        bitmaps += pack(cover, args.bpp)
+
+    if args.bin:
+        with open(args.bin, 'wb') as f:
+            f.write(b'FNT1' + struct.pack('<BBHHHI', args.bpp, 0, height, FIRST_CODE, CODES, len(bitmaps)))
+            for wide, offset in chars:
+                f.write(struct.pack('<B3xI', wide, offset))
+            f.write(bytes(bitmaps))
+    else:
+        write_c(args.out or 'IAR/PLC/Src/%s.c' % args.name, args, chars, bitmaps, height)
+
+    print('%s: Height %d, %d signs, %d bpp, bitmaps %d bytes, descriptors %d bytes'
+          % (args.name, height, sum(1 for w, o in chars if w), args.bpp, len(bitmaps), 8 * CODES))
+
+
+def write_c(path, args, chars, bitmaps, height):
+    name = args.name
+    with open(path, 'w', encoding='latin-1', newline='\n') as f:
+        f.write('// \n//  %s, %s %g pixels per em %d bpp, made by Tools/ttf2font.py, don\'t edit\n// \n'
+                % (name, args.ttf.replace('\\', '/').split('/')[-1], args.size, args.bpp))
+        f.write('#include "variables.h"\n#include "fonts.h"\n\n')
+        f.write('const uint8_t %sBitmaps[] = \n{\n' % name)
+        for i, (wide, offset) in enumerate(chars):
+            end = chars[i + 1][1] if i + 1 < len(chars) else len(bitmaps)
+            if wide == 0:
+                continue
+            f.write('\t// @%d 0x%02X (%d pixels wide)\n' % (offset, FIRST_CODE + i, wide))
+            sign = bitmaps[offset:end]
+            for k in range(0, len(sign), 16):
+                f.write('\t' + ' '.join('0x%02X,' % b for b in sign[k:k + 16]) + '\n')
+        if not bitmaps:
+            f.write('\t0x00,\n')
+        f.write('};\n\nconst struct FONT_CHAR_INFO %sDescriptors[] = \n{\n' % name)
+        for i, (wide, offset) in enumerate(chars):
+            f.write('\t{%d, %d}, \t\t// 0x%02X\n' % (wide, offset, FIRST_CODE + i))
+        f.write('};\n\nsFONT %s = {\n  %sBitmaps,\n  %sDescriptors,\n  %d, /* Height */\n'
+                % (name, name, name, height))
+        if args.bpp > 1:
+            f.write('  0,\n  %d, /* Bpp */\n' % args.bpp)
+        f.write('};\n')
+
+
+if __name__ == '__main__':
+    main()